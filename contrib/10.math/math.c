@@ -4,124 +4,37 @@
 
 #include <math.h>
 
-static pic_value
-pic_number_floor2(pic_state *pic)
-{
-  int i, j;
-  bool e1, e2;
-
-  pic_get_args(pic, "II", &i, &e1, &j, &e2);
-
-  if (e1 && e2) {
-    int k;
-
-    k = (i < 0 && j < 0) || (0 <= i && 0 <= j)
-      ? i / j
-      : (i / j) - 1;
-
-    return pic_values(pic, 2, pic_int_value(pic, k), pic_int_value(pic, i - k * j));
-  } else {
-    double q, r;
-
-    q = floor((double)i/j);
-    r = i - j * q;
-    return pic_values(pic, 2, pic_float_value(pic, q), pic_float_value(pic, r));
-  }
-}
-
-static pic_value
-pic_number_trunc2(pic_state *pic)
-{
-  int i, j;
-  bool e1, e2;
-
-  pic_get_args(pic, "II", &i, &e1, &j, &e2);
-
-  if (e1 && e2) {
-    return pic_values(pic, 2, pic_int_value(pic, i/j), pic_int_value(pic, i - (i/j) * j));
-  } else {
-    double q, r;
-
-    q = trunc((double)i/j);
-    r = i - j * q;
-
-    return pic_values(pic, 2, pic_float_value(pic, q), pic_float_value(pic, r));
+#define DEFINE_ROUND(name, func)                \
+  static pic_value                              \
+  name(pic_state *pic)                          \
+  {                                             \
+    pic_value v;                                \
+    double f;                                   \
+    bool e;                                     \
+                                                \
+    pic_get_args(pic, "F+", &f, &e, &v);        \
+                                                \
+    if (e) {                                    \
+      return v;                                 \
+    } else {                                    \
+      return pic_float_value(pic, func(f));     \
+    }                                           \
   }
-}
 
-static pic_value
-pic_number_floor(pic_state *pic)
-{
-  double f;
-  bool e;
-
-  pic_get_args(pic, "F", &f, &e);
-
-  if (e) {
-    return pic_int_value(pic, (int)f);
-  } else {
-    return pic_float_value(pic, floor(f));
-  }
-}
+DEFINE_ROUND(pic_number_floor, floor)
+DEFINE_ROUND(pic_number_ceil, ceil)
+DEFINE_ROUND(pic_number_trunc, trunc)
+DEFINE_ROUND(pic_number_round, round)
 
 static pic_value
-pic_number_ceil(pic_state *pic)
-{
-  double f;
-  bool e;
-
-  pic_get_args(pic, "F", &f, &e);
-
-  if (e) {
-    return pic_int_value(pic, (int)f);
-  } else {
-    return pic_float_value(pic, ceil(f));
-  }
-}
-
-static pic_value
-pic_number_trunc(pic_state *pic)
-{
-  double f;
-  bool e;
-
-  pic_get_args(pic, "F", &f, &e);
-
-  if (e) {
-    return pic_int_value(pic, (int)f);
-  } else {
-    return pic_float_value(pic, trunc(f));
-  }
-}
-
-static pic_value
-pic_number_round(pic_state *pic)
+pic_number_finite_p(pic_state *pic)
 {
   double f;
   bool e;
 
   pic_get_args(pic, "F", &f, &e);
 
-  if (e) {
-    return pic_int_value(pic, (int)f);
-  } else {
-    return pic_float_value(pic, round(f));
-  }
-}
-
-static pic_value
-pic_number_finite_p(pic_state *pic)
-{
-  pic_value v;
-
-  pic_get_args(pic, "o", &v);
-
-  if (pic_int_p(pic, v))
-    return pic_true_value(pic);
-  if (pic_float_p(pic, v) && ! (isinf(pic_float(pic, v)) || isnan(pic_float(pic, v))))
-    return pic_true_value(pic);
-  else
-    return pic_false_value(pic);
+  return pic_bool_value(pic, e || ! (isinf(f) || isnan(f)));
 }
 
 static pic_value
@@ -253,13 +166,14 @@ pic_number_sqrt(pic_state *pic)
 static pic_value
 pic_number_abs(pic_state *pic)
 {
+  pic_value v;
   double f;
   bool e;
 
-  pic_get_args(pic, "F", &f, &e);
+  pic_get_args(pic, "F+", &f, &e, &v);
 
   if (e) {
-    return pic_int_value(pic, f < 0 ? -f : f);
+    return f < 0 ? pic_funcall(pic, "-", 1, v) : v;
   }
   else {
     return pic_float_value(pic, fabs(f));
@@ -269,18 +183,42 @@ pic_number_abs(pic_state *pic)
 static pic_value
 pic_number_expt(pic_state *pic)
 {
-  double f, g, h;
+  pic_value a, b, r;
+  double f, g;
   bool e1, e2;
+  size_t ai;
 
-  pic_get_args(pic, "FF", &f, &e1, &g, &e2);
+  pic_get_args(pic, "F+F+", &f, &e1, &a, &g, &e2, &b);
 
-  h = pow(f, g);
-  if (e1 && e2) {
-    if (h <= INT_MAX) {
-      return pic_int_value(pic, (int)h);
+  /* exact by squaring */
+  if (e1 && e2 && g >= 0) {
+    long n;
+
+    if (g > INT_MAX) {
+      if (f == 0 || f == 1) {
+        return a;
+      }
+      pic_error(pic, "expt: exponent too large", 1, b);
+    }
+    n = pic_int(pic, b);
+    r = pic_int_value(pic, 1);
+    ai = pic_enter(pic);
+    while (1) {
+      if (n & 1) {
+        r = pic_funcall(pic, "*", 2, r, a);
+      }
+      if ((n >>= 1) == 0) {
+        break;
+      }
+      a = pic_funcall(pic, "*", 2, a, a);
+      pic_leave(pic, ai);
+      pic_protect(pic, r);
+      pic_protect(pic, a);
     }
+    pic_leave(pic, ai);
+    return pic_protect(pic, r);
   }
-  return pic_float_value(pic, h);
+  return pic_float_value(pic, pow(f, g));
 }
 
 void
@@ -288,14 +226,12 @@ pic_nitro_init_math(pic_state *pic)
 {
   pic_deflibrary(pic, "picrin.math");
   pic_in_library(pic, "picrin.math");
-  pic_export(pic, 20,
-             "floor/", "truncate/", "floor", "ceiling", "truncate", "round",
+  pic_export(pic, 18,
+             "floor", "ceiling", "truncate", "round",
              "finite?", "infinite?", "nan?",
              "sqrt", "exp", "log", "sin", "cos", "tan",
              "acos", "asin", "atan", "abs", "expt");
 
-  pic_defun(pic, "picrin.math:floor/", pic_number_floor2);
-  pic_defun(pic, "picrin.math:truncate/", pic_number_trunc2);
   pic_defun(pic, "picrin.math:floor", pic_number_floor);
   pic_defun(pic, "picrin.math:ceiling", pic_number_ceil);
   pic_defun(pic, "picrin.math:truncate", pic_number_trunc);
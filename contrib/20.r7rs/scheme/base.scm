@@ -3,8 +3,6 @@
           (only (picrin math)
                 abs
                 expt
-                floor/
-                truncate/
                 floor
                 ceiling
                 truncate
@@ -654,10 +652,6 @@
                (not (infinite? o))
                (= o (floor o)))))
 
-    (define (exact-integer? x)
-      (and (exact? x)
-           (integer? x)))
-
     (define (zero? x)
       (= x 0))
 
@@ -668,7 +662,7 @@
       (< x 0))
 
     (define (even? x)
-      (= x (* (exact (floor (/ x 2))) 2)))
+      (= 0 (truncate-remainder x 2)))
 
     (define (odd? x)
       (not (even? x)))
@@ -689,69 +683,9 @@
             (if exactp acc (inexact acc))
             (loop (cdr args) (max (car args) acc) (and (exact? (car args)) exactp)))))
 
-    (define (floor-quotient i j)
-      (call-with-values (lambda () (floor/ i j))
-        (lambda (q r)
-          q)))
-
-    (define (floor-remainder i j)
-      (call-with-values (lambda () (floor/ i j))
-        (lambda (q r)
-          r)))
-
-    (define (truncate-quotient i j)
-      (call-with-values (lambda () (truncate/ i j))
-        (lambda (q r)
-          q)))
-
-    (define (truncate-remainder i j)
-      (call-with-values (lambda () (truncate/ i j))
-        (lambda (q r)
-          r)))
-
-    (define (gcd . args)
-      (define (gcd i j)
-        (cond
-         ((> i j) (gcd j i))
-         ((< i 0) (gcd (- i) j))
-         ((> i 0) (gcd (truncate-remainder j i) i))
-         (else j)))
-      (let loop ((args args) (acc 0))
-        (if (null? args)
-            acc
-            (loop (cdr args)
-                  (gcd acc (car args))))))
-
-    (define (lcm . args)
-      (define (lcm i j)
-        (/ (abs (* i j)) (gcd i j)))
-      (let loop ((args args) (acc 1))
-        (if (null? args)
-            acc
-            (loop (cdr args)
-                  (lcm acc (car args))))))
-
     (define (square x)
       (* x x))
 
-    (define (exact-integer-sqrt k)
-      (let ((s (exact (floor (sqrt k)))))
-        (values s (- k (square s)))))
-
-    (define (utf8->string v . opts)
-      (let ((start (if (pair? opts) (car opts) 0))
-            (end (if (>= (length opts) 2)
-                     (cadr opts)
-                     (bytevector-length v))))
-        (list->string (map integer->char (bytevector->list v start end)))))
-
-    (define (string->utf8 s . opts)
-      (let ((start (if (pair? opts) (car opts) 0))
-            (end (if (>= (length opts) 2)
-                     (cadr opts)
-                     (string-length s))))
-        (list->bytevector (map char->integer (string->list s start end)))))
-
     (define checkpoints '((0 #f . #f)))
 
     (define (dynamic-wind in thunk out)
@@ -1222,10 +1222,10 @@
 
 (test "a-c" (let ((str (string #\a #\b #\c))) (string-set! str 1 #\-) str))
 
-;; (test (string #\a #\x1F700 #\c)
-;;     (let ((s (string #\a #\b #\c)))
-;;       (string-set! s 1 #\x1F700)
-;;       s))
+(test (string #\a #\x1F700 #\c)
+    (let ((s (string #\a #\b #\c)))
+      (string-set! s 1 #\x1F700)
+      s))
 
 (test #t (string=? "" ""))
 (test #t (string=? "abc" "abc" "abc"))
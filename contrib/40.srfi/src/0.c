@@ -5,12 +5,17 @@ pic_nitro_init_srfi_0(pic_state *pic)
 {
     pic_add_feature(pic, "srfi-0");
     pic_add_feature(pic, "srfi-1");
+    pic_add_feature(pic, "srfi-4");
     pic_add_feature(pic, "srfi-8");
     pic_add_feature(pic, "srfi-17");
     pic_add_feature(pic, "srfi-26");
     pic_add_feature(pic, "srfi-43");
     pic_add_feature(pic, "srfi-60");
+    pic_add_feature(pic, "srfi-69");
     pic_add_feature(pic, "srfi-95");
     pic_add_feature(pic, "srfi-106");
     pic_add_feature(pic, "srfi-111");
+    pic_add_feature(pic, "srfi-125");
+    pic_add_feature(pic, "srfi-132");
+    pic_add_feature(pic, "srfi-151");
 }
@@ -0,0 +1,180 @@
+(define-library (srfi 125)
+  (import (scheme base)
+          (only (picrin base)
+                make-hash-table
+                hash-table
+                hash-table?
+                hash-table-contains?
+                hash-table-ref
+                hash-table-ref/default
+                hash-table-set!
+                hash-table-delete!
+                hash-table-update!
+                hash-table-update!/default
+                hash-table-size
+                hash-table-keys
+                hash-table-values
+                hash-table->alist
+                hash-table-fold
+                hash-table-for-each
+                hash-table-copy
+                hash-table-clear!
+                hash-table-mutable?
+                hash-table-equivalence-function
+                hash-table-hash-function
+                hash
+                string-hash
+                hash-by-identity)
+          (only (srfi 69)
+                alist->hash-table
+                hash-table-exists?
+                hash-table-walk
+                hash-table-merge!))
+
+  ;; The tables, their hashing and the accessors are primitives of the
+  ;; core, and the names SRFI 125 deprecates come from SRFI 69; only the
+  ;; derived operations are written here. An equivalence procedure
+  ;; stands in for a comparator, and it must be one of eq?, eqv?, equal?
+  ;; or string=?.
+
+  ;; Constructors
+  (define (hash-table-unfold stop? mapper successor seed equiv . args)
+    (let ((table (apply make-hash-table equiv args)))
+      (let loop ((seed seed))
+        (if (stop? seed)
+            table
+            (call-with-values (lambda () (mapper seed))
+              (lambda (key value)
+                (hash-table-set! table key value)
+                (loop (successor seed))))))))
+
+  ;; Predicates
+  (define (hash-table-empty? table)
+    (zero? (hash-table-size table)))
+
+  (define (hash-table=? value=? table1 table2)
+    (and (= (hash-table-size table1) (hash-table-size table2))
+         (hash-table-fold
+          (lambda (key value acc)
+            (and acc
+                 (hash-table-contains? table2 key)
+                 (value=? value (hash-table-ref table2 key))))
+          #t
+          table1)))
+
+  ;; Accessors
+  (define (hash-table-intern! table key failure)
+    (if (hash-table-contains? table key)
+        (hash-table-ref table key)
+        (let ((value (failure)))
+          (hash-table-set! table key value)
+          value)))
+
+  (define (hash-table-pop! table)
+    (call/cc
+     (lambda (return)
+       (hash-table-for-each
+        (lambda (key value)
+          (hash-table-delete! table key)
+          (return key value))
+        table)
+       (error "hash-table-pop!: hash table is empty" table))))
+
+  ;; The whole hash table
+  (define (hash-table-entries table)
+    (values (hash-table-keys table) (hash-table-values table)))
+
+  (define (hash-table-find proc table failure)
+    (call/cc
+     (lambda (return)
+       (hash-table-for-each
+        (lambda (key value)
+          (let ((x (proc key value)))
+            (when x
+              (return x))))
+        table)
+       (failure))))
+
+  (define (hash-table-count pred table)
+    (hash-table-fold
+     (lambda (key value n)
+       (if (pred key value) (+ n 1) n))
+     0
+     table))
+
+  ;; Mapping and folding
+  (define (hash-table-map proc equiv table)
+    (let ((result (make-hash-table equiv)))
+      (hash-table-for-each
+       (lambda (key value)
+         (hash-table-set! result key (proc value)))
+       table)
+      result))
+
+  (define (hash-table-map! proc table)
+    (for-each
+     (lambda (key)
+       (hash-table-set! table key (proc key (hash-table-ref table key))))
+     (hash-table-keys table)))
+
+  (define (hash-table-map->list proc table)
+    (hash-table-fold
+     (lambda (key value acc)
+       (cons (proc key value) acc))
+     '()
+     table))
+
+  (define (hash-table-prune! proc table)
+    (for-each
+     (lambda (pair)
+       (when (proc (car pair) (cdr pair))
+         (hash-table-delete! table (car pair))))
+     (hash-table->alist table)))
+
+  ;; Copying and conversion
+  (define (hash-table-empty-copy table)
+    (make-hash-table (hash-table-equivalence-function table)))
+
+  ;; Hash tables as sets
+  (define hash-table-union! hash-table-merge!)
+
+  (define (hash-table-intersection! table1 table2)
+    (hash-table-prune!
+     (lambda (key value)
+       (not (hash-table-contains? table2 key)))
+     table1)
+    table1)
+
+  (define (hash-table-difference! table1 table2)
+    (hash-table-prune!
+     (lambda (key value)
+       (hash-table-contains? table2 key))
+     table1)
+    table1)
+
+  (define (hash-table-xor! table1 table2)
+    (hash-table-for-each
+     (lambda (key value)
+       (if (hash-table-contains? table1 key)
+           (hash-table-delete! table1 key)
+           (hash-table-set! table1 key value)))
+     table2)
+    table1)
+
+  (export make-hash-table hash-table hash-table-unfold alist->hash-table
+          hash-table? hash-table-contains? hash-table-exists?
+          hash-table-empty? hash-table=? hash-table-mutable?
+          hash-table-ref hash-table-ref/default
+          hash-table-set! hash-table-delete! hash-table-intern!
+          hash-table-update! hash-table-update!/default hash-table-pop!
+          hash-table-clear!
+          hash-table-size hash-table-keys hash-table-values
+          hash-table-entries hash-table-find hash-table-count
+          hash-table-map hash-table-for-each hash-table-walk
+          hash-table-map! hash-table-map->list hash-table-fold
+          hash-table-prune!
+          hash-table-copy hash-table-empty-copy hash-table->alist
+          hash-table-union! hash-table-merge! hash-table-intersection!
+          hash-table-difference! hash-table-xor!
+          hash string-hash hash-by-identity
+          hash-table-equivalence-function hash-table-hash-function))
@@ -0,0 +1,130 @@
+(define-library (srfi 132)
+  (import (scheme base)
+          (only (picrin base)
+                list-sort
+                list-stable-sort
+                list-sort!
+                list-stable-sort!
+                list-sorted?
+                list-merge
+                list-merge!
+                vector-sort
+                vector-stable-sort
+                vector-sort!
+                vector-stable-sort!
+                vector-sorted?
+                vector-merge
+                vector-merge!))
+
+  ;; Deleting neighbor duplicates
+
+  (define (list-delete-neighbor-dups same? lis)
+    (if (null? lis)
+        '()
+        (let loop ((prev (car lis)) (lis (cdr lis)) (acc (list (car lis))))
+          (cond ((null? lis)
+                 (reverse acc))
+                ((same? prev (car lis))
+                 (loop prev (cdr lis) acc))
+                (else
+                 (loop (car lis) (cdr lis) (cons (car lis) acc)))))))
+
+  (define (list-delete-neighbor-dups! same? lis)
+    (unless (null? lis)
+      (let loop ((last lis) (lis (cdr lis)))
+        (cond ((null? lis)
+               (set-cdr! last '()))
+              ((same? (car last) (car lis))
+               (loop last (cdr lis)))
+              (else
+               (set-cdr! last lis)
+               (loop lis (cdr lis))))))
+    lis)
+
+  ;; the elements of v[start, end) that are kept go to v[start, result)
+  (define (squeeze! same? v start end)
+    (if (= start end)
+        start
+        (let loop ((i (+ start 1)) (j (+ start 1)))
+          (cond ((= i end)
+                 j)
+                ((same? (vector-ref v (- j 1)) (vector-ref v i))
+                 (loop (+ i 1) j))
+                (else
+                 (vector-set! v j (vector-ref v i))
+                 (loop (+ i 1) (+ j 1)))))))
+
+  (define (vector-delete-neighbor-dups same? v . opt)
+    (let* ((start (if (pair? opt) (car opt) 0))
+           (end (if (and (pair? opt) (pair? (cdr opt))) (cadr opt) (vector-length v)))
+           (w (vector-copy v start end)))
+      (vector-copy w 0 (squeeze! same? w 0 (vector-length w)))))
+
+  (define (vector-delete-neighbor-dups! same? v . opt)
+    (let ((start (if (pair? opt) (car opt) 0))
+          (end (if (and (pair? opt) (pair? (cdr opt))) (cadr opt) (vector-length v))))
+      (squeeze! same? v start end)))
+
+  ;; Finding the median and selection
+
+  (define (vector-find-median less? v knil . opt)
+    (let ((mean (if (pair? opt) (car opt) (lambda (a b) (/ (+ a b) 2))))
+          (n (vector-length v)))
+      (cond ((= n 0)
+             knil)
+            ((odd? n)
+             (vector-select! less? (vector-copy v) (quotient n 2)))
+            (else
+             (let ((w (vector-sort less? v)))
+               (mean (vector-ref w (- (quotient n 2) 1))
+                     (vector-ref w (quotient n 2))))))))
+
+  (define (vector-find-median! less? v knil . opt)
+    (let ((mean (if (pair? opt) (car opt) (lambda (a b) (/ (+ a b) 2))))
+          (n (vector-length v)))
+      (vector-sort! v less?)
+      (cond ((= n 0)
+             knil)
+            ((odd? n)
+             (vector-ref v (quotient n 2)))
+            (else
+             (mean (vector-ref v (- (quotient n 2) 1))
+                   (vector-ref v (quotient n 2)))))))
+
+  (define (vector-select! less? v k . opt)
+    (let ((start (if (pair? opt) (car opt) 0))
+          (end (if (and (pair? opt) (pair? (cdr opt))) (cadr opt) (vector-length v))))
+      (unless (and (<= 0 k) (< k (- end start)))
+        (error "vector-select!: index out of range" k))
+      (vector-sort! v less? start end)
+      (vector-ref v (+ start k))))
+
+  (define (vector-separate! less? v k . opt)
+    (let ((start (if (pair? opt) (car opt) 0))
+          (end (if (and (pair? opt) (pair? (cdr opt))) (cadr opt) (vector-length v))))
+      (unless (and (<= 0 k) (<= k (- end start)))
+        (error "vector-separate!: index out of range" k))
+      (vector-sort! v less? start end)))
+
+  (export list-sort
+          list-stable-sort
+          list-sort!
+          list-stable-sort!
+          list-sorted?
+          list-merge
+          list-merge!
+          list-delete-neighbor-dups
+          list-delete-neighbor-dups!
+          vector-sort
+          vector-stable-sort
+          vector-sort!
+          vector-stable-sort!
+          vector-sorted?
+          vector-merge
+          vector-merge!
+          vector-delete-neighbor-dups
+          vector-delete-neighbor-dups!
+          vector-find-median
+          vector-find-median!
+          vector-select!
+          vector-separate!))
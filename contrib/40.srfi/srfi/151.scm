@@ -0,0 +1,141 @@
+(define-library (srfi 151)
+  (import (scheme base)
+          (only (picrin base)
+                bitwise-and
+                bitwise-ior
+                bitwise-xor
+                bitwise-not
+                arithmetic-shift
+                bit-count
+                integer-length
+                first-set-bit
+                bit-set?
+                bit-field)
+          (only (srfi 60)
+                bitwise-if
+                copy-bit
+                copy-bit-field
+                rotate-bit-field
+                reverse-bit-field))
+
+  ;; Basic operations
+  (define (bitwise-eqv . args)
+    (let loop ((args args) (acc -1))
+      (if (null? args)
+          acc
+          (loop (cdr args) (bitwise-not (bitwise-xor acc (car args)))))))
+
+  (define (bitwise-nand i j) (bitwise-not (bitwise-and i j)))
+  (define (bitwise-nor i j) (bitwise-not (bitwise-ior i j)))
+  (define (bitwise-andc1 i j) (bitwise-and (bitwise-not i) j))
+  (define (bitwise-andc2 i j) (bitwise-and i (bitwise-not j)))
+  (define (bitwise-orc1 i j) (bitwise-ior (bitwise-not i) j))
+  (define (bitwise-orc2 i j) (bitwise-ior i (bitwise-not j)))
+
+  ;; Integer operations
+  (define shift arithmetic-shift)
+
+  ;; Single-bit operations
+  (define (bit-swap index1 index2 i)
+    (copy-bit index2
+              (copy-bit index1 i (bit-set? index2 i))
+              (bit-set? index1 i)))
+
+  (define (any-bit-set? test-bits i)
+    (not (zero? (bitwise-and test-bits i))))
+
+  (define (every-bit-set? test-bits i)
+    (= test-bits (bitwise-and test-bits i)))
+
+  ;; Field operations
+  (define (field-mask start end)
+    (arithmetic-shift (bitwise-not (arithmetic-shift -1 (- end start))) start))
+
+  (define (bit-field-any? i start end)
+    (not (zero? (bit-field i start end))))
+
+  (define (bit-field-every? i start end)
+    (let ((mask (field-mask start end)))
+      (= mask (bitwise-and mask i))))
+
+  (define (bit-field-clear i start end)
+    (bitwise-and i (bitwise-not (field-mask start end))))
+
+  (define (bit-field-set i start end)
+    (bitwise-ior i (field-mask start end)))
+
+  (define bit-field-replace copy-bit-field)
+
+  (define (bit-field-replace-same dest source start end)
+    (bitwise-if (field-mask start end) source dest))
+
+  (define bit-field-rotate rotate-bit-field)
+  (define bit-field-reverse reverse-bit-field)
+
+  ;; Bits conversion
+  (define (bits->list i . len)
+    (let ((len (if (null? len) (integer-length i) (car len))))
+      (let loop ((k (- len 1)) (acc '()))
+        (if (< k 0)
+            acc
+            (loop (- k 1) (cons (bit-set? k i) acc))))))
+
+  (define (bits->vector i . len)
+    (list->vector (apply bits->list i len)))
+
+  (define (list->bits lst)
+    (let loop ((lst lst) (k 0) (acc 0))
+      (cond
+       ((null? lst) acc)
+       ((car lst) (loop (cdr lst) (+ k 1) (bitwise-ior acc (arithmetic-shift 1 k))))
+       (else (loop (cdr lst) (+ k 1) acc)))))
+
+  (define (vector->bits vec)
+    (list->bits (vector->list vec)))
+
+  (define (bits . args)
+    (list->bits args))
+
+  ;; Fold, unfold, and generate
+  (define (bitwise-fold proc seed i)
+    (let ((len (integer-length i)))
+      (let loop ((k 0) (acc seed))
+        (if (= k len)
+            acc
+            (loop (+ k 1) (proc (bit-set? k i) acc))))))
+
+  (define (bitwise-for-each proc i)
+    (let ((len (integer-length i)))
+      (let loop ((k 0))
+        (when (< k len)
+          (proc (bit-set? k i))
+          (loop (+ k 1))))))
+
+  (define (bitwise-unfold stop? mapper successor seed)
+    (let loop ((seed seed) (k 0) (acc 0))
+      (if (stop? seed)
+          acc
+          (loop (successor seed)
+                (+ k 1)
+                (if (mapper seed)
+                    (bitwise-ior acc (arithmetic-shift 1 k))
+                    acc)))))
+
+  (define (make-bitwise-generator i)
+    (lambda ()
+      (let ((bit (odd? i)))
+        (set! i (arithmetic-shift i -1))
+        bit)))
+
+  (export bitwise-not bitwise-and bitwise-ior bitwise-xor bitwise-eqv
+          bitwise-nand bitwise-nor bitwise-andc1 bitwise-andc2
+          bitwise-orc1 bitwise-orc2
+          arithmetic-shift shift bit-count integer-length bitwise-if
+          bit-set? copy-bit bit-swap any-bit-set? every-bit-set?
+          first-set-bit
+          bit-field bit-field-any? bit-field-every? bit-field-clear
+          bit-field-set bit-field-replace bit-field-replace-same
+          bit-field-rotate bit-field-reverse
+          bits->list list->bits bits->vector vector->bits bits
+          bitwise-fold bitwise-for-each bitwise-unfold
+          make-bitwise-generator))
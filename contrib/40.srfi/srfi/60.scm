@@ -1,156 +1,89 @@
 (define-library (srfi 60)
   (import (scheme base)
-          (srfi 1))
+          (only (picrin base)
+                bitwise-and
+                bitwise-ior
+                bitwise-xor
+                bitwise-not
+                arithmetic-shift
+                bit-count
+                integer-length
+                first-set-bit
+                bit-set?
+                bit-field))
+
+  ;; The bitwise operations, shifts and bit counts are primitives of the
+  ;; core; only the derived operations are written here.
 
   ;; # Bitwise Operations
-  (define (logand . args)
-    (letrec ((lgand
-              (lambda (x y)
-                (if (or (zero? x) (zero? y))
-                    0
-                    (+ (* (lgand (floor/ x 2) (floor/ y 2)) 2)
-                       (if (or (even? x) (even? y)) 0 1))))))
-      (fold lgand -1 args)))
-
-  (define bitwise-and logand)
-
-  (define (logior . args)
-    (letrec ((lgior
-              (lambda (x y)
-                (cond
-                 ((= x y) x)
-                 ((zero? x) y)
-                 ((zero? y) x)
-                 (else
-                  (+ (* (lgior (truncate-quotient x 2)
-                               (truncate-quotient y 2))
-                        2)
-                     (if (and (even? x) (even? y)) 0 1)))))))
-      (fold lgior 0 args)))
-
-  (define bitwise-ior logior)
-
-  (define (logxor . args)
-    (letrec ((lgxor
-              (lambda (x y)
-                (cond
-                 ((zero? x) y)
-                 ((zero? y) x)
-                 (else
-                  (+ (* (lgxor (floor/ x 2) (floor/ y 2)) 2)
-                     (if (even? x)
-                         (if (even? y) 0 1)
-                         (if (even? y) 1 0))))))))
-      (fold lgxor 0 args)))
-
-  (define bitwise-xor logxor)
-
-  (define (lognot n)
-    (- -1 n))
-
-  (define bitwise-not lognot)
+  (define logand bitwise-and)
+  (define logior bitwise-ior)
+  (define logxor bitwise-xor)
+  (define lognot bitwise-not)
 
   (define (bitwise-if mask n0 n1)
-    (logior (logand mask n0)
-            (logand (lognot mask) n1)))
+    (bitwise-ior (bitwise-and mask n0)
+                 (bitwise-and (bitwise-not mask) n1)))
 
   (define bitwise-merge bitwise-if)
 
   (define (logtest j k)
-    (not (zero? (logand j k))))
+    (not (zero? (bitwise-and j k))))
 
   (define any-bits-set? logtest)
 
   ;; # Integer Properties
-  (define (logcount n)
-    (letrec ((lgcnt
-              (lambda (n)
-                (if (zero? n) 0
-                    (+ (lgcnt (floor/ n 2))
-                       (if (even? n) 0 1))))))
-      (if (negative? n)
-          (lgcnt (lognot n))
-          (lgcnt n))))
-
-  (define bit-count logcount)
-
-  (define (integer-length n)
-    (let loop ((n n) (count 0))
-      (if (zero? n)
-          count
-          (loop (floor/ n 2) (+ count 1)))))
-
-  (define (log2-binary-factors n)
-    (+ -1 (integer-length (logand n (- n)))))
-
-  (define first-set-bit log2-binary-factors)
-  
-  ;; # Bit Within Word
-  (define (logbit? index n)
-    (logtest (expt 2 index) n))
+  (define logcount bit-count)
+  (define log2-binary-factors first-set-bit)
 
-  (define bit-set? logbit?)
+  ;; # Bit Within Word
+  (define logbit? bit-set?)
 
   (define (copy-bit index from bit)
     (if bit
-        (logior from (expt 2 index))
-        (logand from (lognot (expt 2 index)))))
-
+        (bitwise-ior from (arithmetic-shift 1 index))
+        (bitwise-and from (bitwise-not (arithmetic-shift 1 index)))))
 
   ;; # Field of Bits
-  (define (ash n count)
-    (if (negative? count)
-        (let ((k (expt 2 (- count))))
-          (if (negative? n)
-              (+ -1 (truncate-quotient (+ 1 n) k))
-              (truncate-quotient n k)))
-        (* (expt 2 count) n)))
-
-  (define arithmetic-shift ash)
+  (define ash arithmetic-shift)
 
-  (define (bit-field n start end)
-    (logand (lognot (ash -1 (- end start)))
-            (ash n (- start))))
+  (define (field-mask width)
+    (bitwise-not (arithmetic-shift -1 width)))
 
   (define (copy-bit-field to from start end)
-    (bitwise-if (ash (lognot (ash -1 (- end start))) start)
-                (ash from start)
+    (bitwise-if (arithmetic-shift (field-mask (- end start)) start)
+                (arithmetic-shift from start)
                 to))
 
   (define (rotate-bit-field n count start end)
-    (let* ((width (- start end))
-           (count (floor-remainder count width))
-           (mask (lognot (ash -1 width)))
-           (zn (logand mask (ash n (- start)))))
-      (logior (ash (logior (logand mask (ash zn count))
-                           (ash zn (- count width)))
-                   start)
-              (logand (lognot (ash mask start)) n))))
+    (let ((width (- end start)))
+      (if (zero? width)
+          n
+          (let* ((count (floor-remainder count width))
+                 (zn (bit-field n start end)))
+            (copy-bit-field n
+                            (bitwise-ior (bit-field (arithmetic-shift zn count) 0 width)
+                                         (arithmetic-shift zn (- count width)))
+                            start
+                            end)))))
 
   (define (reverse-bit-field n start end)
-    (letrec ((bit-reverse
-              (lambda (k n)
-                (let loop ((m (if (negative? n) (lognot n) n))
-                           (k (- k 1))
-                           (rvs 0))
-                  (if (negative? k)
-                      (if (negative? n) (lognot rvs) rvs)
-                      (loop (ash m -1)
-                            (- k 1)
-                            (logior (ash rvs 1) (logand 1 m))))))))
-      (let* ((width (- start end))
-             (mask (lognot (ash -1 width)))
-             (zn (logand mask (ash n (- start)))))
-        (logior (ash (bit-reverse width zn) start)
-                (logand (lognot (ash mask start)) n)))))
+    (let loop ((i start) (j (- end 1)) (rvs 0))
+      (if (< j start)
+          (copy-bit-field n rvs start end)
+          (loop (+ i 1)
+                (- j 1)
+                (if (bit-set? j n)
+                    (bitwise-ior rvs (arithmetic-shift 1 (- i start)))
+                    rvs)))))
 
   ;; Bits as Booleans
   (define (integer->list k . len)
-    (let ((len (if (null? len) (integer-length k) len)))
-      (let loop ((k k) (len len) (acc '()))
-        (if (or (zero? k) (zero? len))
+    (let ((len (if (null? len) (integer-length k) (car len))))
+      (let loop ((i 0) (acc '()))
+        (if (= i len)
             acc
-            (loop (floor/ k 2) (- len 1) (cons (if (even? k) #f #t) acc))))))
+            (loop (+ i 1) (cons (bit-set? i k) acc))))))
 
   (define (list->integer lst)
     (let loop ((lst lst) (acc 0))
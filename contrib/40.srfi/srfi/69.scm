@@ -0,0 +1,60 @@
+(define-library (srfi 69)
+  (import (scheme base)
+          (only (picrin base)
+                make-hash-table
+                hash-table?
+                hash-table-contains?
+                hash-table-ref
+                hash-table-ref/default
+                hash-table-set!
+                hash-table-delete!
+                hash-table-update!
+                hash-table-update!/default
+                hash-table-size
+                hash-table-keys
+                hash-table-values
+                hash-table->alist
+                hash-table-fold
+                hash-table-for-each
+                hash-table-copy
+                hash-table-equivalence-function
+                hash-table-hash-function
+                hash
+                string-hash
+                hash-by-identity))
+
+  ;; The tables, their hashing and the accessors are primitives of the
+  ;; core, whose hash-table-fold and hash-table-for-each also take their
+  ;; arguments in the order used here. Equivalence procedures other than
+  ;; eq?, eqv?, equal? and string=? are not supported.
+
+  (define (alist->hash-table alist . args)
+    (let ((table (apply make-hash-table args)))
+      (for-each
+       (lambda (pair)
+         (unless (hash-table-contains? table (car pair))
+           (hash-table-set! table (car pair) (cdr pair))))
+       alist)
+      table))
+
+  (define hash-table-exists? hash-table-contains?)
+
+  (define hash-table-walk hash-table-for-each)
+
+  (define (hash-table-merge! table1 table2)
+    (hash-table-for-each
+     (lambda (key value)
+       (unless (hash-table-contains? table1 key)
+         (hash-table-set! table1 key value)))
+     table2)
+    table1)
+
+  (export make-hash-table hash-table? alist->hash-table
+          hash-table-equivalence-function hash-table-hash-function
+          hash-table-ref hash-table-ref/default hash-table-set!
+          hash-table-delete! hash-table-exists?
+          hash-table-update! hash-table-update!/default
+          hash-table-size hash-table-keys hash-table-values
+          hash-table-walk hash-table-fold hash-table->alist
+          hash-table-copy hash-table-merge!
+          hash string-hash hash-by-identity))
@@ -0,0 +1,54 @@
+(import (scheme base)
+        (srfi 125)
+        (picrin test))
+
+(test-begin)
+
+;; constructors
+
+(define t (alist->hash-table '((a . 1) (b . 2) (a . 3)) eq?))
+
+(test 1 (hash-table-ref t 'a))
+(test 2 (hash-table-size t))
+(test 25 (hash-table-ref (hash-table-unfold (lambda (i) (= i 10)) (lambda (i) (values i (* i i))) (lambda (i) (+ i 1)) 0 eqv?) 5))
+(test 3 (hash-table-size (alist->hash-table '(("x" . 1) ("y" . 2) ("z" . 3)) string=?)))
+
+;; predicates and accessors
+
+(test #t (hash-table-exists? t 'b))
+(test #t (hash-table-empty? (make-hash-table eqv?)))
+(test #t (hash-table=? eqv? t (alist->hash-table '((a . 1) (b . 2)) eq?)))
+(test #f (hash-table=? eqv? t (alist->hash-table '((a . 1) (b . 3)) eq?)))
+(test 7 (hash-table-intern! t 'c (lambda () 7)))
+(test 7 (hash-table-intern! t 'c (lambda () 8)))
+(test 1 (let ((u (hash-table-copy t #t))) (call-with-values (lambda () (hash-table-pop! u)) (lambda (k v) (- 3 (hash-table-size u))))))
+
+;; the whole table
+
+(test 3 (call-with-values (lambda () (hash-table-entries t)) (lambda (ks vs) (length vs))))
+(test 'b (hash-table-find (lambda (k v) (and (= v 2) k)) t (lambda () #f)))
+(test 'none (hash-table-find (lambda (k v) #f) t (lambda () 'none)))
+(test 2 (hash-table-count (lambda (k v) (odd? v)) t))
+(test 14 (hash-table-ref (hash-table-map (lambda (v) (* v 2)) eq? t) 'c))
+(test 10 (apply + (hash-table-map->list (lambda (k v) v) t)))
+(test 20 (let ((u (hash-table-copy t #t))) (hash-table-map! (lambda (k v) (* v 2)) u) (hash-table-fold (lambda (k v acc) (+ v acc)) 0 u)))
+(test 1 (let ((u (hash-table-copy t #t))) (hash-table-prune! (lambda (k v) (odd? v)) u) (hash-table-size u)))
+(test #f (hash-table-contains? (hash-table-empty-copy t) 'a))
+
+;; sets
+
+(define (table . keys)
+  (alist->hash-table (map (lambda (k) (cons k #t)) keys) eqv?))
+
+(test 4 (hash-table-size (hash-table-union! (table 1 2 3) (table 3 4))))
+(test '(3) (hash-table-keys (hash-table-intersection! (table 1 2 3) (table 3 4))))
+(test 2 (hash-table-size (hash-table-difference! (table 1 2 3) (table 3 4))))
+(test 3 (hash-table-size (hash-table-xor! (table 1 2 3) (table 3 4))))
+
+;; SRFI 69 argument orders
+
+(test 10 (hash-table-fold t (lambda (k v acc) (+ v acc)) 0))
+(test 3 (let ((n 0)) (hash-table-walk t (lambda (k v) (set! n (+ n 1)))) n))
+(test #t (< (string-hash "abc" 7) 7))
+
+(test-end)
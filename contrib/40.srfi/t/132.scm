@@ -0,0 +1,32 @@
+(import (scheme base)
+        (srfi 132)
+        (picrin test))
+
+(test-begin)
+
+(test '(1 2 3) (list-sort < '(3 1 2)))
+(test #(1 2 3) (vector-stable-sort < #(3 1 2)))
+(test '(1 2 3 4) (list-merge < '(1 3) '(2 4)))
+
+;; deleting neighbor duplicates
+
+(test '(1 2 3 4 1) (list-delete-neighbor-dups = '(1 1 2 3 3 3 4 1)))
+(test '() (list-delete-neighbor-dups = '()))
+(test '(1 2 3 1) (list-delete-neighbor-dups! = (list 1 1 2 2 2 3 1 1)))
+(test #(1 2 3 4) (vector-delete-neighbor-dups = #(1 1 2 3 3 4)))
+(test #(2 3 4) (vector-delete-neighbor-dups = #(1 1 2 3 3 4) 2))
+(test #(1 2) (vector-delete-neighbor-dups = #(1 1 2 3 3 4) 1 3))
+(test '(4 #(0 0 1 2 2 2)) (let ((v (vector 0 0 1 1 2 2))) (list (vector-delete-neighbor-dups! = v 1) v)))
+
+;; medians and selection
+
+(test 'none (vector-find-median < #() 'none))
+(test 3 (vector-find-median < #(5 1 3) 0))
+(test 2.5 (vector-find-median < #(4 1 3 2) 0))
+(test 2 (vector-find-median < #(4 1 3 2) 0 min))
+(test '(2.5 #(1 2 3 4)) (let ((v (vector 4 1 3 2))) (list (vector-find-median! < v 0) v)))
+(test 3 (vector-select! < (vector 9 3 7 1) 1))
+(test 1 (vector-select! < (vector 9 3 7 1 0) 0 1 4))
+(test #(1 2 3 4 5) (let ((v (vector 5 4 3 2 1))) (vector-separate! < v 2) v))
+
+(test-end)
@@ -0,0 +1,40 @@
+(import (scheme base)
+        (srfi 60)
+        (srfi 151)
+        (picrin test))
+
+(test-begin)
+
+;; (srfi 60)
+
+(test 2 (rotate-bit-field 4 3 0 4))
+(test 229 (reverse-bit-field #xa7 0 8))
+(test 778 (copy-bit-field 874 0 4 8))
+(test '(#t #t #f) (integer->list 6))
+(test '(#f #f #t #t #f) (integer->list 6 5))
+(test 5 (list->integer '(#t #f #t)))
+(test 1 (copy-bit 0 0 #t))
+(test #f (logtest 4 3))
+(test 5 (log2-binary-factors 96))
+
+;; (srfi 151)
+
+(test -42 (bitwise-eqv 37 12))
+(test 9 (bitwise-if 3 1 8))
+(test 1 (bit-swap 0 2 4))
+(test #t (every-bit-set? 4 6))
+(test #t (bit-field-every? 15 0 4))
+(test 243 (bit-field-clear 255 2 4))
+(test 12 (bit-field-set 0 2 4))
+(test 243 (bit-field-replace-same 255 0 2 4))
+(test 11 (bit-field-rotate 7 -1 1 4))
+(test '(#f #t #t) (bits->list 6))
+(test 6 (list->bits '(#f #t #t)))
+(test #(#f #t #t) (bits->vector 6))
+(test '(#t #t #f) (bitwise-fold cons '() 6))
+(test 341 (bitwise-unfold (lambda (i) (= i 10)) even? (lambda (i) (+ i 1)) 0))
+(test '(#f #t #t #f)
+      (let ((g (make-bitwise-generator 6)))
+        (list (g) (g) (g) (g))))
+
+(test-end)
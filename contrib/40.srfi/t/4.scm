@@ -0,0 +1,27 @@
+(import (scheme base)
+        (srfi 4)
+        (picrin test))
+
+(test-begin)
+
+(test #t (u8vector? (bytevector 1 2)))
+(test #t (s16vector? (make-s16vector 3 -7)))
+(test #f (s16vector? (make-u16vector 3)))
+(test #f (f64vector? (vector 1.0)))
+
+(test '(-7 -7 -7) (s16vector->list (make-s16vector 3 -7)))
+(test 4 (u32vector-length (u32vector 1 2 3 4)))
+(test 4294967295 (u32vector-ref (u32vector 4294967295) 0))
+(test '(-128 127) (s8vector->list (s8vector -128 127)))
+(test '(0 65535) (u16vector->list (list->u16vector '(0 65535))))
+(test 18446744073709551615 (u64vector-ref (u64vector 18446744073709551615) 0))
+(test -9223372036854775808 (s64vector-ref (s64vector -9223372036854775808) 0))
+(test 0.5 (f32vector-ref (f32vector 0.5) 0))
+(test 2.5 (let ((v (make-f64vector 2 0))) (f64vector-set! v 1 2.5) (f64vector-ref v 1)))
+
+(test #t (equal? #f64(1 2) (f64vector 1 2)))
+(test #f (equal? #f64(1 2) #f32(1 2)))
+(test #t (equal? #u8(1 2) (bytevector 1 2)))
+(test '(1 -2) (s32vector->list '#s32(1 -2)))
+
+(test-end)
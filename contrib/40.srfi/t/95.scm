@@ -0,0 +1,21 @@
+(import (scheme base)
+        (srfi 95)
+        (picrin test))
+
+(test-begin)
+
+(test '(1 2 3) (sort '(3 1 2) <))
+(test #(3 2 1) (sort #(1 3 2) >))
+(test '((a . 1) (b . 2)) (sort '((b . 2) (a . 1)) < cdr))
+(test '(1 2 3 4) (merge '(1 3) '(2 4) <))
+(test '(1 2 3 4) (merge! (list 1 4) (list 2 3) <))
+(test #t (sorted? '(1 2 3) <))
+(test #f (sorted? #(1 3 2) <))
+
+;; older names
+
+(test #t (list-sorted? '(1 2 3) <))
+(test '(1 2 3) (merge-sort '(2 3 1) <))
+(test '(1 2 3) (merge-sort! (list 2 3 1) <))
+
+(test-end)
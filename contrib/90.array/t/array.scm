@@ -23,4 +23,46 @@
 (test 2 (array-shift! ary))
 (test 1 (array-shift! ary))
 
+;; growth at both ends
+
+(define (fill! ary n)
+  (let loop ((i 0))
+    (when (< i n)
+      (if (even? i)
+          (array-push! ary i)
+          (array-unshift! ary i))
+      (loop (+ i 1)))))
+
+(fill! ary 1000)
+
+(test 1000 (array-length ary))
+(test 999 (array-ref ary 0))
+(test 0 (array-ref ary 500))
+(test 998 (array-ref ary 999))
+(test 999 (array-shift! ary))
+(test 998 (array-pop! ary))
+(array-set! ary 0 'x)
+(test 'x (array-ref ary 0))
+
+;; bulk append and conversions
+
+(define ary (array 1 2))
+
+(array-append! ary #(3 4) '(5) (array 6))
+(test '(1 2 3 4 5 6) (array->list ary))
+(array-append! ary ary)
+(test 12 (array-length ary))
+(test #(1 4 9) (array->vector (array-map (lambda (x) (* x x)) (list->array '(1 2 3)))))
+(test '(a b) (array->list (vector->array #(a b))))
+(test 6 (let ((n 0)) (array-for-each (lambda (x) (set! n (+ n x))) (array 1 2 3)) n))
+(test #t (array? (make-array 100)))
+(test #f (array? #(1 2)))
+(test 0 (begin (array-clear! ary) (array-length ary)))
+
+;; errors
+
+(test "array-pop!: empty array" (guard (e (#t (error-object-message e))) (array-pop! (make-array))))
+(test "array-shift!: empty array" (guard (e (#t (error-object-message e))) (array-shift! (make-array))))
+(test "index out of range" (guard (e (#t (error-object-message e))) (array-ref (array 1) 1)))
+
 (test-end)
@@ -0,0 +1,99 @@
+/**
+ * See Copyright Notice in picrin.h
+ */
+
+/*
+ * Mark-phase scaling benchmark for PIC_GC_THREADS.
+ *
+ * Builds a synthetic heap of roughly the requested size (default 1024MB)
+ * out of many independent lists hanging off a single vector, then times
+ * full collections with 1, 2, 4, ... marker threads. Nothing is garbage,
+ * so the serial sweep only clears mark bits and is the same for every
+ * row; the difference between rows is the mark phase.
+ *
+ *   $ make CFLAGS="-O2 -DPIC_GC_THREADS=8" LDFLAGS=-lpthread bench-gc
+ *   $ etc/gcbench 1024
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "picrin.h"
+#include "picrin/extra.h"
+#include "value.h"
+#include "object.h"
+#include "state.h"
+
+#define WIDTH 4096
+#define RUNS 3
+
+static double
+now(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static double
+time_gc(pic_state *pic)
+{
+  double t, best = -1;
+  int i;
+
+  for (i = 0; i < RUNS; ++i) {
+    t = now();
+    pic_gc(pic);
+    t = now() - t;
+    if (best < 0 || t < best)
+      best = t;
+  }
+  return best;
+}
+
+int
+main(int argc, char *argv[])
+{
+  pic_state *pic;
+  pic_value vec, elt;
+  size_t ai, i, n, mb;
+  double t, base = 0;
+  int threads, max;
+
+  mb = argc > 1 ? strtoul(argv[1], NULL, 10) : 1024;
+
+  pic = pic_open(pic_default_allocf, NULL, pic_default_panicf);
+
+  /* each element is two pairs plus malloc overhead, about 96 bytes */
+  n = mb * 1024 * 1024 / 96;
+
+  vec = pic_make_vec(pic, WIDTH, NULL);
+  ai = pic_enter(pic);
+
+  pic->gc_enable = false;
+  t = now();
+  for (i = 0; i < n; ++i) {
+    elt = pic_cons(pic, pic_int_value(pic, (int) i), pic_int_value(pic, (int) i));
+    pic_vec_set(pic, vec, i % WIDTH, pic_cons(pic, elt, pic_vec_ref(pic, vec, i % WIDTH)));
+    pic_leave(pic, ai);
+  }
+  pic->gc_enable = true;
+  printf("built %lu elements (~%luMB) in %.2fs\n", (unsigned long)n, (unsigned long)mb, now() - t);
+
+  max = pic_gc_set_threads(pic, 1 << 30);
+  printf("%8s %10s %8s\n", "threads", "gc (ms)", "speedup");
+  for (threads = 1; ; threads = threads * 2 > max && threads < max ? max : threads * 2) {
+    pic_gc_set_threads(pic, threads);
+    t = time_gc(pic);
+    if (threads == 1)
+      base = t;
+    printf("%8d %10.1f %8.2f\n", threads, t * 1e3, base / t);
+    if (threads >= max)
+      break;
+  }
+
+  pic_close(pic);
+  return 0;
+}
@@ -0,0 +1,221 @@
+/**
+ * See Copyright Notice in picrin.h
+ */
+
+/*
+ * Hash table benchmark.
+ *
+ * For 10^3, 10^4, ... up to 10^MAX entries (default MAX = 6) inserts
+ * every key and then looks every key up again, and reports nanoseconds
+ * per operation for an alist searched like assv and a hash table keyed
+ * by eqv? (both on fixnums), a dictionary and an eq? hash table (both on
+ * symbols), and a string=? hash table. The alist is quadratic and is
+ * only run up to 10^4 entries. The last column is the slowest single
+ * insertion into the eqv? table; tables move their entries to a larger
+ * array a few at a time, so what is left of a resize is mostly the cost
+ * of allocating the array. Keys are made before the clock starts.
+ *
+ *   $ make CFLAGS=-O2 bench-hash
+ *   $ etc/hashbench 7
+ */
+
+#define _POSIX_C_SOURCE 200112L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "picrin.h"
+#include "picrin/extra.h"
+
+#define ALIST_MAX 10000
+
+static double
+now(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static pic_value
+alist_lookup(pic_state *pic, pic_value alist, pic_value key)
+{
+  while (! pic_nil_p(pic, alist)) {
+    if (pic_eqv_p(pic, pic_car(pic, pic_car(pic, alist)), key))
+      return pic_car(pic, alist);
+    alist = pic_cdr(pic, alist);
+  }
+  return pic_false_value(pic);
+}
+
+/* prints insert and lookup times in ns per operation */
+static void
+report(double insert, double lookup, int n)
+{
+  printf(" %7.0f %7.0f", insert * 1e9 / n, lookup * 1e9 / n);
+}
+
+static void
+bench_alist(pic_state *pic, pic_value ints, int n)
+{
+  pic_value alist = pic_nil_value(pic), key;
+  double t, insert;
+  size_t ai;
+  int i;
+
+  if (n > ALIST_MAX) {
+    printf(" %7s %7s", "-", "-");
+    return;
+  }
+  ai = pic_enter(pic);
+  t = now();
+  for (i = 0; i < n; ++i) {
+    key = pic_vec_ref(pic, ints, i);
+    if (pic_false_p(pic, alist_lookup(pic, alist, key))) {
+      alist = pic_cons(pic, pic_cons(pic, key, key), alist);
+    }
+  }
+  insert = now() - t;
+  t = now();
+  for (i = 0; i < n; ++i) {
+    alist_lookup(pic, alist, pic_vec_ref(pic, ints, i));
+  }
+  report(insert, now() - t, n);
+  pic_leave(pic, ai);
+}
+
+static void
+bench_dict(pic_state *pic, pic_value syms, int n)
+{
+  size_t ai = pic_enter(pic);
+  pic_value dict = pic_make_dict(pic);
+  double t, insert;
+  int i;
+
+  t = now();
+  for (i = 0; i < n; ++i) {
+    pic_dict_set(pic, dict, pic_vec_ref(pic, syms, i), pic_true_value(pic));
+  }
+  insert = now() - t;
+  t = now();
+  for (i = 0; i < n; ++i) {
+    pic_dict_ref(pic, dict, pic_vec_ref(pic, syms, i));
+  }
+  report(insert, now() - t, n);
+  pic_leave(pic, ai);
+  pic_gc(pic);
+}
+
+static void
+bench_table(pic_state *pic, int kind, pic_value keys, int n)
+{
+  size_t ai = pic_enter(pic);
+  pic_value table = pic_make_table(pic, kind), val;
+  double t, insert;
+  int i;
+
+  t = now();
+  for (i = 0; i < n; ++i) {
+    pic_table_set(pic, table, pic_vec_ref(pic, keys, i), pic_true_value(pic));
+  }
+  insert = now() - t;
+  t = now();
+  for (i = 0; i < n; ++i) {
+    pic_table_get(pic, table, pic_vec_ref(pic, keys, i), &val);
+  }
+  report(insert, now() - t, n);
+  pic_leave(pic, ai);
+  pic_gc(pic);                  /* release the table before the next one */
+}
+
+/* fills a table again, timing each insertion on its own */
+static double
+worst_insert(pic_state *pic, int kind, pic_value keys, int n)
+{
+  size_t ai = pic_enter(pic);
+  pic_value table = pic_make_table(pic, kind);
+  double t, worst = 0;
+  int i;
+
+  for (i = 0; i < n; ++i) {
+    t = now();
+    pic_table_set(pic, table, pic_vec_ref(pic, keys, i), pic_true_value(pic));
+    t = now() - t;
+    if (t > worst)
+      worst = t;
+  }
+  pic_leave(pic, ai);
+  pic_gc(pic);
+  return worst;
+}
+
+static pic_value
+make_keys(pic_state *pic, int n, int what)
+{
+  pic_value keys, str;
+  size_t ai;
+  int i;
+
+  keys = pic_make_vec(pic, n, NULL);
+  for (i = 0; i < n; ++i) {
+    ai = pic_enter(pic);
+    if (what == PIC_TABLE_EQV) {
+      pic_vec_set(pic, keys, i, pic_int_value(pic, i));
+    } else {
+      str = pic_strf_value(pic, "key-%d", i);
+      pic_vec_set(pic, keys, i, what == PIC_TABLE_EQ ? pic_intern(pic, str) : str);
+    }
+    pic_leave(pic, ai);
+  }
+  return keys;
+}
+
+int
+main(int argc, char *argv[])
+{
+  pic_state *pic;
+  pic_value keys;
+  double worst;
+  size_t ai;
+  int max, e, i, n;
+
+  max = argc > 1 ? atoi(argv[1]) : 6;
+
+  pic = pic_open(pic_default_allocf, NULL, pic_default_panicf);
+
+  printf("%9s %15s %15s %15s %15s %15s %9s\n", "", "alist", "eqv? table", "dictionary", "eq? table", "string table", "worst");
+  printf("%9s", "entries");
+  for (i = 0; i < 5; ++i) {
+    printf(" %7s %7s", "insert", "lookup");
+  }
+  printf(" %9s\n", "insert us");
+
+  /* one kind of key at a time, so that 10^7 of each need not fit at once */
+  for (e = 3, n = 1000; e <= max; ++e, n *= 10) {
+    printf("%9d", n);
+
+    ai = pic_enter(pic);
+    keys = make_keys(pic, n, PIC_TABLE_EQV);
+    bench_alist(pic, keys, n);
+    bench_table(pic, PIC_TABLE_EQV, keys, n);
+    worst = worst_insert(pic, PIC_TABLE_EQV, keys, n);
+    pic_leave(pic, ai);
+
+    keys = make_keys(pic, n, PIC_TABLE_EQ);
+    bench_dict(pic, keys, n);
+    bench_table(pic, PIC_TABLE_EQ, keys, n);
+    pic_leave(pic, ai);
+
+    keys = make_keys(pic, n, PIC_TABLE_STRING);
+    bench_table(pic, PIC_TABLE_STRING, keys, n);
+    pic_leave(pic, ai);
+
+    printf(" %9.1f\n", worst * 1e6);
+    fflush(stdout);
+  }
+
+  pic_close(pic);
+  return 0;
+}
@@ -0,0 +1,152 @@
+/**
+ * See Copyright Notice in picrin.h
+ */
+
+/*
+ * Microbenchmark for lib/khash.h.
+ *
+ * For tables of 10, 100, ... up to 10^MAX entries (default MAX = 7)
+ * keyed by object pointers, as dictionaries and attributes are, inserts
+ * every key, looks every key up, looks up as many keys that are not in
+ * the table, and deletes every key, and reports nanoseconds per
+ * operation for each. Small tables are built and torn down repeatedly so
+ * that every row does about the same number of operations. Lookups and
+ * deletions go in a different order from the insertions.
+ *
+ *   $ make CFLAGS=-O2 bench-khash
+ *   $ etc/khashbench 7
+ */
+
+#define _POSIX_C_SOURCE 200112L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "picrin.h"
+#include "picrin/extra.h"
+#include "khash.h"
+
+#define OPS 10000000            /* per row and phase, roughly */
+#define STRIDE 32               /* bytes between two keys, like small objects */
+
+KHASH_DECLARE(bench, const char *, int)
+KHASH_DEFINE(bench, const char *, int, kh_ptr_hash_func, kh_ptr_hash_equal)
+
+static double
+now(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/* with a fixed seed, so that runs can be compared */
+static void
+shuffle(const char **keys, int n)
+{
+  unsigned long r = 12345;
+  const char *t;
+  int i, j;
+
+  for (i = n - 1; i > 0; --i) {
+    r = (r * 1103515245UL + 12345) & 0x7fffffffUL;
+    j = (int) (r % (i + 1));
+    t = keys[i];
+    keys[i] = keys[j];
+    keys[j] = t;
+  }
+}
+
+/* keys[0..n) are inserted and keys[n..2n) are missed */
+static void
+bench(pic_state *pic, const char **keys, const char **order, int n)
+{
+  khash_t(bench) h;
+  double t, insert = 0, hit = 0, miss = 0, del = 0;
+  int reps, r, i, it, ret;
+  long found = 0;
+
+  reps = n < OPS ? OPS / n : 1;
+  for (r = 0; r < reps; ++r) {
+    kh_init(bench, &h);
+
+    t = now();
+    for (i = 0; i < n; ++i) {
+      it = kh_put(bench, &h, keys[i], &ret);
+      kh_val(&h, it) = i;
+    }
+    insert += now() - t;
+
+    t = now();
+    for (i = 0; i < n; ++i) {
+      found += kh_val(&h, kh_get(bench, &h, order[i]));
+    }
+    hit += now() - t;
+
+    t = now();
+    for (i = 0; i < n; ++i) {
+      found += kh_get(bench, &h, keys[n + i]) != kh_end(&h);
+    }
+    miss += now() - t;
+
+    t = now();
+    for (i = 0; i < n; ++i) {
+      kh_del(bench, &h, kh_get(bench, &h, order[i]));
+    }
+    del += now() - t;
+
+    if (kh_size(&h) != 0) {
+      fprintf(stderr, "%d entries left after deleting them all\n", kh_size(&h));
+      exit(1);
+    }
+    kh_destroy(bench, &h);
+  }
+  if (found != (long) reps * n * (n - 1) / 2) {
+    fprintf(stderr, "lookups went wrong\n");
+    exit(1);
+  }
+  n *= reps;
+  printf(" %7.1f %7.1f %7.1f %7.1f\n", insert * 1e9 / n, hit * 1e9 / n, miss * 1e9 / n, del * 1e9 / n);
+}
+
+int
+main(int argc, char *argv[])
+{
+  pic_state *pic;
+  char *base;
+  const char **keys, **order;
+  int max, e, i, n, size;
+
+  max = argc > 1 ? atoi(argv[1]) : 7;
+  for (size = 10, e = 1; e < max; ++e) {
+    size *= 10;
+  }
+
+  pic = pic_open(pic_default_allocf, NULL, pic_default_panicf);
+
+  base = malloc((size_t) size * 2 * STRIDE);
+  keys = malloc(sizeof(const char *) * size * 2);
+  order = malloc(sizeof(const char *) * size);
+
+  printf("%9s %7s %7s %7s %7s  (ns/op)\n", "entries", "insert", "lookup", "miss", "delete");
+  for (n = 10; n <= size; n *= 10) {
+    for (i = 0; i < 2 * n; ++i) {
+      keys[i] = base + (size_t) i * STRIDE;
+    }
+    for (i = 0; i < n; ++i) {
+      order[i] = keys[i];
+    }
+    shuffle(order, n);
+    printf("%9d", n);
+    bench(pic, keys, order, n);
+    fflush(stdout);
+  }
+
+  free(order);
+  free(keys);
+  free(base);
+  pic_close(pic);
+  return 0;
+}
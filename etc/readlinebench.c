@@ -0,0 +1,125 @@
+/**
+ * See Copyright Notice in picrin.h
+ */
+
+/*
+ * Line reading benchmark.
+ *
+ * Reads FILE to the end with read-line, then again with read-string in
+ * 64KB chunks, and reports throughput for each. If FILE does not exist a
+ * synthetic access log of roughly the requested size (default 1024MB)
+ * is written there first.
+ *
+ *   $ make CFLAGS=-O2 bench-read-line
+ *   $ etc/readlinebench /tmp/access.log 1024
+ */
+
+#define _POSIX_C_SOURCE 200112L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "picrin.h"
+#include "picrin/extra.h"
+
+#define CHUNK 65536
+
+static double
+now(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void
+generate(const char *path, size_t mb)
+{
+  static const char *const verbs[] = { "GET", "POST", "PUT", "DELETE" };
+  static const int codes[] = { 200, 200, 200, 304, 404, 500 };
+  FILE *fp;
+  size_t total = 0, limit = mb * 1024 * 1024;
+  unsigned long i;
+
+  if ((fp = fopen(path, "w")) == NULL) {
+    perror(path);
+    exit(1);
+  }
+  for (i = 0; total < limit; ++i) {
+    int r = fprintf(fp, "10.%lu.%lu.%lu - - [18/Oct/2026:12:%02lu:%02lu +0000] \"%s /api/v1/items/%lu?page=%lu HTTP/1.1\" %d %lu \"-\" \"bench/1.0\"\n",
+                    i % 256, i / 256 % 256, i / 65536 % 256, i / 60 % 60, i % 60,
+                    verbs[i % 4], i * 7919 % 100000, i % 50, codes[i % 6], i * 31 % 20000);
+    if (r < 0) {
+      perror(path);
+      exit(1);
+    }
+    total += r;
+  }
+  fclose(fp);
+  printf("wrote %lu lines (%luMB) to %s\n", i, (unsigned long) (total >> 20), path);
+}
+
+static pic_value
+open_port(pic_state *pic, const char *path)
+{
+  FILE *fp;
+
+  if ((fp = fopen(path, "r")) == NULL) {
+    perror(path);
+    exit(1);
+  }
+  return pic_fopen(pic, fp, "r");
+}
+
+int
+main(int argc, char *argv[])
+{
+  pic_state *pic;
+  pic_value port, str, read_line, read_string;
+  const char *path;
+  unsigned long lines = 0;
+  double bytes = 0, t;
+  size_t ai;
+  FILE *fp;
+
+  path = argc > 1 ? argv[1] : "/tmp/picrin-readline.log";
+
+  if ((fp = fopen(path, "r")) != NULL) {
+    fclose(fp);
+  } else {
+    generate(path, argc > 2 ? strtoul(argv[2], NULL, 10) : 1024);
+  }
+
+  pic = pic_open(pic_default_allocf, NULL, pic_default_panicf);
+
+  read_line = pic_ref(pic, "read-line");
+  read_string = pic_ref(pic, "read-string");
+
+  port = open_port(pic, path);
+  ai = pic_enter(pic);
+  t = now();
+  while (! pic_eof_p(pic, str = pic_call(pic, read_line, 1, port))) {
+    bytes += pic_str_len(pic, str) + 1;
+    lines++;
+    pic_leave(pic, ai);
+  }
+  t = now() - t;
+  pic_fclose(pic, port);
+  printf("read-line:   %lu lines, %.0fMB in %.2fs (%.1fMB/s)\n", lines, bytes / 1048576, t, bytes / 1048576 / t);
+
+  port = open_port(pic, path);
+  bytes = 0;
+  t = now();
+  while (! pic_eof_p(pic, str = pic_call(pic, read_string, 2, pic_int_value(pic, CHUNK), port))) {
+    bytes += pic_str_len(pic, str);
+    pic_leave(pic, ai);
+  }
+  t = now() - t;
+  pic_fclose(pic, port);
+  printf("read-string: %.0fMB in %.2fs (%.1fMB/s)\n", bytes / 1048576, t, bytes / 1048576 / t);
+
+  pic_close(pic);
+  return 0;
+}
@@ -50,9 +50,23 @@ dump_irep(pic_state *pic, struct irep *irep, unsigned char *buf, int *len)
 static void
 dump_obj(pic_state *pic, pic_value obj, unsigned char *buf, int *len)
 {
-  if (pic_int_p(pic, obj)) {
+  if (pic_int_p(pic, obj) && -0x7fffffffL - 1 <= pic_int(pic, obj) && pic_int(pic, obj) <= 0x7fffffffL) {
     dump1(0x00, buf, len);
-    dump4(pic_int(pic, obj), buf, len);
+    dump4((unsigned long) pic_int(pic, obj) & 0xfffffffful, buf, len);
+  } else if (pic_int_p(pic, obj)) {
+    unsigned long n = pic_int(pic, obj);
+    dump1(0x06, buf, len);
+    dump4(n & 0xfffffffful, buf, len);
+    dump4(n >> 16 >> 16 & 0xfffffffful, buf, len);
+  } else if (pic_big_p(pic, obj)) {
+    int l = pic_big_bytes(pic, obj, NULL);
+    dump1(0x07, buf, len);
+    dump1(big_ptr(pic, obj)->neg, buf, len);
+    dump4(l, buf, len);
+    if (buf) {
+      pic_big_bytes(pic, obj, buf + *len);
+    }
+    *len += l;
   } else if (pic_str_p(pic, obj)) {
     int l, i;
     const char *str = pic_str(pic, obj, &l);
@@ -80,9 +94,12 @@ dump_obj(pic_state *pic, pic_value obj, unsigned char *buf, int *len)
     }
     dump1(0x03, buf, len);
     dump_irep(pic, proc_ptr(pic, obj)->u.irep, buf, len);
-  } else if (pic_char_p(pic, obj)) {
+  } else if (pic_char_p(pic, obj) && pic_char(pic, obj) < 0x80) {
     dump1(0x04, buf, len);
     dump1(pic_char(pic, obj), buf, len);
+  } else if (pic_char_p(pic, obj)) {
+    dump1(0x05, buf, len);
+    dump4(pic_char(pic, obj), buf, len);
   } else {
     pic_error(pic, "dump: unsupported object", 1, obj);
   }
@@ -116,12 +133,18 @@ static unsigned char load1(pic_state *pic, const unsigned char **buf, const unsi
 
 static unsigned long load4(pic_state *pic, const unsigned char **buf, const unsigned char *end) {
   unsigned long x = load1(pic, buf, end);
-  x += load1(pic, buf, end) << 8;
-  x += load1(pic, buf, end) << 16;
-  x += load1(pic, buf, end) << 24;
+  x += (unsigned long) load1(pic, buf, end) << 8;
+  x += (unsigned long) load1(pic, buf, end) << 16;
+  x += (unsigned long) load1(pic, buf, end) << 24;
   return x;
 }
 
+/* two's complement n bits wide */
+static long sign_extend(unsigned long x, int n) {
+  unsigned long m = 1ul << (n - 1);
+  return x & m ? -(long) (m - 1 - (x & (m - 1))) - 1 : (long) x;
+}
+
 static pic_value load_obj(pic_state *pic, const unsigned char **buf, const unsigned char *end);
 
 static struct irep *
@@ -176,7 +199,7 @@ load_obj(pic_state *pic, const unsigned char **buf, const unsigned char *end)
   type = load1(pic, buf, end);
   switch (type) {
   case 0x00:
-    return pic_int_value(pic, load4(pic, buf, end));
+    return pic_int_value(pic, sign_extend(load4(pic, buf, end), 32));
   case 0x01:
     l = load4(pic, buf, end);
     dat = pic_malloc(pic, l + 1); /* TODO */
@@ -200,6 +223,21 @@ load_obj(pic_state *pic, const unsigned char **buf, const unsigned char *end)
   case 0x04:
     c = load1(pic, buf, end);
     return pic_char_value(pic, c);
+  case 0x05:
+    return pic_char_value(pic, (int) load4(pic, buf, end));
+  case 0x06: {
+    unsigned long lo = load4(pic, buf, end), hi = load4(pic, buf, end);
+    return pic_int_value(pic, sign_extend(hi << 16 << 16 | lo, sizeof(long) * CHAR_BIT));
+  }
+  case 0x07:
+    c = load1(pic, buf, end);
+    l = load4(pic, buf, end);
+    if (l < 0 || end - *buf < l) {
+      pic_error(pic, "malformed bytevector", 0);
+    }
+    obj = pic_big_value(pic, c != 0, *buf, l);
+    *buf += l;
+    return obj;
   default:
     pic_error(pic, "load: unsupported object", 1, pic_int_value(pic, type));
   }
@@ -219,7 +257,10 @@ pic_blob_value(pic_state *pic, const unsigned char *buf, int len)
   struct blob *bv;
 
   bv = (struct blob *)pic_obj_alloc(pic, PIC_TYPE_BLOB);
+  bv->buf = NULL;
+  bv->view = false;
   bv->data = pic_malloc(pic, len);
+  pic_obj_charge(pic, (struct object *) bv, len);
   bv->len = len;
   if (buf) {
     memcpy(bv->data, buf, len);
@@ -227,6 +268,86 @@ pic_blob_value(pic_state *pic, const unsigned char *buf, int len)
   return obj_value(pic, bv);
 }
 
+/*
+ * A bytevector owns its data alone until it is shared. Then the data
+ * moves under a reference-counted blob_buffer, which slices and input
+ * ports hold on to without the collector knowing about it.
+ */
+
+static void
+blob_no_dtor(pic_state *PIC_UNUSED(pic), void *PIC_UNUSED(ptr), void *PIC_UNUSED(userdata))
+{
+}
+
+pic_value
+pic_blob_value_external(pic_state *pic, unsigned char *ptr, int len, void (*dtor)(pic_state *, void *, void *), void *userdata)
+{
+  struct blob_buffer *buf;
+  struct blob *bv;
+
+  buf = pic_malloc(pic, sizeof(struct blob_buffer));
+  buf->refs = 1;
+  buf->mem = ptr;
+  buf->dtor = dtor ? dtor : blob_no_dtor;
+  buf->userdata = userdata;
+
+  bv = (struct blob *)pic_obj_alloc(pic, PIC_TYPE_BLOB);
+  bv->data = ptr;
+  bv->len = len;
+  bv->buf = buf;
+  bv->view = false;
+  pic_obj_charge(pic, (struct object *) bv, len);
+  return obj_value(pic, bv);
+}
+
+struct blob_buffer *
+pic_blob_share(pic_state *pic, pic_value blob)
+{
+  struct blob *bv = blob_ptr(pic, blob);
+
+  if (bv->buf == NULL) {
+    bv->buf = pic_malloc(pic, sizeof(struct blob_buffer));
+    bv->buf->refs = 1;
+    bv->buf->mem = bv->data;
+    bv->buf->dtor = NULL;
+    bv->buf->userdata = NULL;
+  }
+  bv->buf->refs++;
+  return bv->buf;
+}
+
+void
+pic_blob_release(pic_state *pic, struct blob_buffer *buf)
+{
+  if (--buf->refs > 0) {
+    return;
+  }
+  if (buf->dtor) {
+    buf->dtor(pic, buf->mem, buf->userdata);
+  } else {
+    pic_free(pic, buf->mem);
+  }
+  pic_free(pic, buf);
+}
+
+pic_value
+pic_blob_slice(pic_state *pic, pic_value blob, int start, int end)
+{
+  struct blob_buffer *buf;
+  struct blob *bv;
+  unsigned char *data;
+
+  data = pic_blob(pic, blob, NULL);
+  buf = pic_blob_share(pic, blob);
+
+  bv = (struct blob *)pic_obj_alloc(pic, PIC_TYPE_BLOB);
+  bv->data = data + start;
+  bv->len = end - start;
+  bv->buf = buf;
+  bv->view = true;
+  return obj_value(pic, bv);
+}
+
 unsigned char *
 pic_blob(pic_state *pic, pic_value blob, int *len)
 {
@@ -336,6 +457,204 @@ pic_blob_bytevector_u8_set(pic_state *pic)
   return pic_undef_value(pic);
 }
 
+/*
+ * Binary accessors
+ *
+ * Multi-byte elements may sit at any offset. They go through an aligned
+ * buffer, byte-swapped there when the byte order asked for is not the
+ * native one, so that the element kinds of numeric vectors can read and
+ * write them.
+ */
+
+#if (defined(__GNUC__) && (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 3))) || defined(__clang__)
+# define bswap32(u) __builtin_bswap32(u)
+# define bswap64(u) __builtin_bswap64(u)
+#else
+# define bswap32(u) ((u) >> 24 | ((u) >> 8 & 0xff00) | ((u) & 0xff00) << 8 | ((u) & 0xff) << 24)
+# define bswap64(u) ((PIC_UINT64_T) bswap32((uint32_t) (u)) << 32 | bswap32((uint32_t) ((u) >> 32)))
+#endif
+
+static bool
+native_big_endian(void)
+{
+  static const union {
+    unsigned short s;
+    unsigned char c[sizeof(unsigned short)];
+  } u = { 1 };
+
+  return u.c[0] == 0;
+}
+
+/* whether an endianness symbol asks for the other byte order; the
+   accessors close over their kind and the symbols big and little */
+static bool
+blob_swap_p(pic_state *pic, pic_value endianness)
+{
+  if (pic_eq_p(pic, endianness, pic_closure_ref(pic, 1))) {
+    return ! native_big_endian();
+  }
+  if (pic_eq_p(pic, endianness, pic_closure_ref(pic, 2))) {
+    return native_big_endian();
+  }
+  pic_error(pic, "endianness must be big or little", 1, endianness);
+  PIC_UNREACHABLE();
+}
+
+/* reverses the bytes of an element in place, a whole word at a time */
+static void
+blob_swap(unsigned char *elt, int size)
+{
+  switch (size) {
+  case 2: {
+    unsigned short u;
+    memcpy(&u, elt, 2);
+    u = (unsigned short) (u >> 8 | u << 8);
+    memcpy(elt, &u, 2);
+    break;
+  }
+  case 4: {
+    uint32_t u;
+    memcpy(&u, elt, 4);
+    u = bswap32(u);
+    memcpy(elt, &u, 4);
+    break;
+  }
+#ifdef PIC_UINT64_T
+  case 8: {
+    PIC_UINT64_T u;
+    memcpy(&u, elt, 8);
+    u = bswap64(u);
+    memcpy(elt, &u, 8);
+    break;
+  }
+#endif
+  }
+}
+
+/* the start of an element of the size at k */
+static unsigned char *
+blob_elt(pic_state *pic, pic_value blob, int k, int size)
+{
+  unsigned char *buf;
+  int len;
+
+  buf = pic_blob(pic, blob, &len);
+  if (k < 0 || k > len - size) {
+    pic_error(pic, "index out of range", 1, pic_int_value(pic, k));
+  }
+  return buf + k;
+}
+
+static pic_value
+blob_ref(pic_state *pic, pic_value blob, int k, bool swap)
+{
+  double elt;                   /* for the alignment */
+  int kind = pic_int(pic, pic_closure_ref(pic, 0)), size = pic_uvec_size(kind);
+
+  TYPE_CHECK(pic, blob, blob);
+  memcpy(&elt, blob_elt(pic, blob, k, size), size);
+  if (swap) {
+    blob_swap((unsigned char *) &elt, size);
+  }
+  return pic_uvec_load(pic, kind, (unsigned char *) &elt, 0);
+}
+
+static pic_value
+blob_set(pic_state *pic, pic_value blob, int k, pic_value v, bool swap)
+{
+  double elt;
+  int kind = pic_int(pic, pic_closure_ref(pic, 0)), size = pic_uvec_size(kind);
+  unsigned char *p;
+
+  TYPE_CHECK(pic, blob, blob);
+  p = blob_elt(pic, blob, k, size);
+  pic_uvec_store(pic, kind, (unsigned char *) &elt, 0, v);
+  if (swap) {
+    blob_swap((unsigned char *) &elt, size);
+  }
+  memcpy(p, &elt, size);
+  return pic_undef_value(pic);
+}
+
+/* (bytevector-T-ref bv k endianness) */
+static pic_value
+pic_blob_bytevector_ref(pic_state *pic)
+{
+  pic_value blob, endianness;
+  int k;
+
+  pic_get_args(pic, "oim", &blob, &k, &endianness);
+
+  return blob_ref(pic, blob, k, blob_swap_p(pic, endianness));
+}
+
+/* (bytevector-T-native-ref bv k), and bytevector-s8-ref */
+static pic_value
+pic_blob_bytevector_native_ref(pic_state *pic)
+{
+  pic_value blob;
+  int k;
+
+  pic_get_args(pic, "oi", &blob, &k);
+
+  return blob_ref(pic, blob, k, false);
+}
+
+/* (bytevector-T-set! bv k v endianness) */
+static pic_value
+pic_blob_bytevector_set(pic_state *pic)
+{
+  pic_value blob, v, endianness;
+  int k;
+
+  pic_get_args(pic, "oiom", &blob, &k, &v, &endianness);
+
+  return blob_set(pic, blob, k, v, blob_swap_p(pic, endianness));
+}
+
+/* (bytevector-T-native-set! bv k v), and bytevector-s8-set! */
+static pic_value
+pic_blob_bytevector_native_set(pic_state *pic)
+{
+  pic_value blob, v;
+  int k;
+
+  pic_get_args(pic, "oio", &blob, &k, &v);
+
+  return blob_set(pic, blob, k, v, false);
+}
+
+static pic_value
+pic_blob_native_endianness(pic_state *pic)
+{
+  pic_get_args(pic, "");
+
+  return native_big_endian() ? pic_intern_lit(pic, "big") : pic_intern_lit(pic, "little");
+}
+
+static pic_value
+pic_blob_bytevector_slice(pic_state *pic)
+{
+  pic_value blob;
+  int n, len, start, end;
+
+  n = pic_get_args(pic, "o|ii", &blob, &start, &end);
+
+  TYPE_CHECK(pic, blob, blob);
+  pic_blob(pic, blob, &len);
+
+  switch (n) {
+  case 1:
+    start = 0;
+  case 2:
+    end = len;
+  }
+
+  VALID_RANGE(pic, len, start, end);
+
+  return pic_blob_slice(pic, blob, start, end);
+}
+
 static pic_value
 pic_blob_bytevector_copy_i(pic_state *pic)
 {
@@ -478,9 +797,45 @@ pic_blob_bytevector_to_object(pic_state *pic)
   return pic_deserialize(pic, blob);
 }
 
+/* defines bytevector-<type><suffix> for the kind */
+static void
+blob_defun(pic_state *pic, const char *type, const char *suffix, pic_func_t f, int kind)
+{
+  char name[40] = "bytevector-";
+  size_t n = strlen(name), l;
+  size_t ai = pic_enter(pic);
+
+  l = strlen(type);
+  memcpy(name + n, type, l);
+  n += l;
+  l = strlen(suffix);
+  memcpy(name + n, suffix, l + 1);
+
+  pic_define(pic, name, pic_lambda(pic, f, 3, pic_int_value(pic, kind), pic_intern_lit(pic, "big"), pic_intern_lit(pic, "little")));
+  pic_leave(pic, ai);
+}
+
 void
 pic_init_blob(pic_state *pic)
 {
+  static const struct {
+    const char *name;
+    int kind;
+  } accessors[] = {
+    { "s8", PIC_UVEC_S8 },
+    { "u16", PIC_UVEC_U16 },
+    { "s16", PIC_UVEC_S16 },
+    { "u32", PIC_UVEC_U32 },
+    { "s32", PIC_UVEC_S32 },
+#ifdef PIC_INT64_T
+    { "u64", PIC_UVEC_U64 },
+    { "s64", PIC_UVEC_S64 },
+#endif
+    { "ieee-single", PIC_UVEC_F32 },
+    { "ieee-double", PIC_UVEC_F64 }
+  };
+  int i;
+
   pic_defun(pic, "bytevector?", pic_blob_bytevector_p);
   pic_defun(pic, "bytevector", pic_blob_bytevector);
   pic_defun(pic, "make-bytevector", pic_blob_make_bytevector);
@@ -489,9 +844,23 @@ pic_init_blob(pic_state *pic)
   pic_defun(pic, "bytevector-u8-set!", pic_blob_bytevector_u8_set);
   pic_defun(pic, "bytevector-copy!", pic_blob_bytevector_copy_i);
   pic_defun(pic, "bytevector-copy", pic_blob_bytevector_copy);
+  pic_defun(pic, "bytevector-slice", pic_blob_bytevector_slice);
   pic_defun(pic, "bytevector-append", pic_blob_bytevector_append);
   pic_defun(pic, "bytevector->list", pic_blob_bytevector_to_list);
   pic_defun(pic, "list->bytevector", pic_blob_list_to_bytevector);
   pic_defun(pic, "bytevector->object", pic_blob_bytevector_to_object);
   pic_defun(pic, "object->bytevector", pic_blob_object_to_bytevector);
+  pic_defun(pic, "native-endianness", pic_blob_native_endianness);
+
+  for (i = 0; i < (int) (sizeof accessors / sizeof accessors[0]); ++i) {
+    if (accessors[i].kind == PIC_UVEC_S8) {
+      blob_defun(pic, accessors[i].name, "-ref", pic_blob_bytevector_native_ref, accessors[i].kind);
+      blob_defun(pic, accessors[i].name, "-set!", pic_blob_bytevector_native_set, accessors[i].kind);
+      continue;
+    }
+    blob_defun(pic, accessors[i].name, "-ref", pic_blob_bytevector_ref, accessors[i].kind);
+    blob_defun(pic, accessors[i].name, "-set!", pic_blob_bytevector_set, accessors[i].kind);
+    blob_defun(pic, accessors[i].name, "-native-ref", pic_blob_bytevector_native_ref, accessors[i].kind);
+    blob_defun(pic, accessors[i].name, "-native-set!", pic_blob_bytevector_native_set, accessors[i].kind);
+  }
 }
@@ -14,8 +14,13 @@ pic_eq_p(pic_state *PIC_UNUSED(pic), pic_value x, pic_value y)
 }
 
 bool
-pic_eqv_p(pic_state *PIC_UNUSED(pic), pic_value x, pic_value y)
+pic_eqv_p(pic_state *pic, pic_value x, pic_value y)
 {
+  if (pic_big_p(pic, x) && pic_big_p(pic, y)) {
+    struct bignum *a = big_ptr(pic, x), *b = big_ptr(pic, y);
+
+    return a->neg == b->neg && a->len == b->len && memcmp(a->digits, b->digits, a->len * sizeof(bigit_t)) == 0;
+  }
   return value_eq_p(&x, &y);
 }
 
@@ -56,6 +61,18 @@ pic_equal_p(pic_state *pic, pic_value x, pic_value y)
     }
     return memcmp(xbuf, ybuf, xlen) == 0;
   }
+  case PIC_TYPE_UVECTOR: {
+    int xkind, ykind, xlen, ylen;
+    const unsigned char *xbuf, *ybuf;
+
+    xbuf = pic_uvec(pic, x, &xkind, &xlen);
+    ybuf = pic_uvec(pic, y, &ykind, &ylen);
+
+    if (xkind != ykind || xlen != ylen) {
+      return false;
+    }
+    return xlen == 0 || memcmp(xbuf, ybuf, (size_t) xlen * pic_uvec_size(xkind)) == 0;
+  }
   case PIC_TYPE_PAIR: {
     if (! pic_equal_p(pic, pic_car(pic, x), pic_car(pic, y))) {
       return false;
@@ -95,12 +112,17 @@ pic_equal_p(pic_state *pic, pic_value x, pic_value y)
     return true;
   }
   case PIC_TYPE_RECORD: {
-    if (! pic_eq_p(pic, pic_record_type(pic, x), pic_record_type(pic, y))) {
+    struct record *xrec = rec_ptr(pic, x), *yrec = rec_ptr(pic, y);
+    int i;
+
+    if (xrec->type != yrec->type) {
       return false;
     }
-    x = pic_record_datum(pic, x);
-    y = pic_record_datum(pic, y);
-    goto LOOP;
+    for (i = 0; i < xrec->type->nfields; ++i) {
+      if (! pic_equal_p(pic, xrec->fields[i], yrec->fields[i]))
+        return false;
+    }
+    return true;
   }
   case PIC_TYPE_DATA: {
     return pic_data(pic, x) == pic_data(pic, y);
@@ -19,10 +19,9 @@ pic_char_char_p(pic_state *pic)
 static pic_value
 pic_char_char_to_integer(pic_state *pic)
 {
-  char c;
+  int c;
 
   pic_get_args(pic, "c", &c);
-  assert((c & 0x80) == 0);
 
   return pic_int_value(pic, c);
 }
@@ -34,11 +33,11 @@ pic_char_integer_to_char(pic_state *pic)
 
   pic_get_args(pic, "i", &i);
 
-  if (i < 0 || i > 127) {
+  if (i < 0 || i > 0x10ffff || (0xd800 <= i && i < 0xe000)) {
     pic_error(pic, "integer->char: integer out of char range", 1, pic_int_value(pic, i));
   }
 
-  return pic_char_value(pic, (char)i);
+  return pic_char_value(pic, i);
 }
 
 #define DEFINE_CHAR_CMP(op, name)			\
@@ -47,7 +46,7 @@ pic_char_integer_to_char(pic_state *pic)
   {							\
     int argc, i;                                        \
     pic_value *argv;					\
-    char c, d;						\
+    int c, d;						\
     							\
     pic_get_args(pic, "cc*", &c, &d, &argc, &argv);	\
     							\
@@ -5,6 +5,7 @@
 #include <picrin.h>
 #include "value.h"
 #include "object.h"
+#include "state.h"
 
 KHASH_DEFINE(dict, struct symbol *, pic_value, kh_ptr_hash_func, kh_ptr_hash_equal)
 
@@ -174,39 +175,59 @@ pic_dict_dictionary_size(pic_state *pic)
   return pic_int_value(pic, pic_dict_size(pic, dict));
 }
 
+/* feeds dictionary-map and dictionary-for-each, appending results after tail unless it is #f */
+struct dict_each {
+  pic_value dict, tail;
+  int it;
+  bool started;
+};
+
+static bool
+dict_each(pic_state *pic, void *data, pic_value result, pic_value *argv)
+{
+  struct dict_each *e = data;
+  pic_value cell;
+
+  if (e->started && ! pic_false_p(pic, e->tail)) {
+    cell = pic_cons(pic, result, pic_nil_value(pic));
+    pic_set_cdr(pic, e->tail, cell);
+    e->tail = cell;
+  }
+  e->started = true;
+  return pic_dict_next(pic, e->dict, &e->it, &argv[0], NULL);
+}
+
 static pic_value
 pic_dict_dictionary_map(pic_state *pic)
 {
-  pic_value dict, proc, key, ret = pic_nil_value(pic);
-  int it = 0;
-  size_t ai;
+  pic_value dict, proc, head;
+  struct dict_each e;
 
   pic_get_args(pic, "ld", &proc, &dict);
 
-  ai = pic_enter(pic);
-  while (pic_dict_next(pic, dict, &it, &key, NULL)) {
-    pic_push(pic, pic_call(pic, proc, 1, key), ret);
-    pic_leave(pic, ai);
-    pic_protect(pic, ret);
-  }
-  return pic_reverse(pic, ret);
+  head = pic_cons(pic, pic_nil_value(pic), pic_nil_value(pic));
+
+  e.dict = dict;
+  e.tail = head;
+  e.it = 0;
+  e.started = false;
+  pic_call_each(pic, proc, 1, dict_each, &e);
+  return pic_cdr(pic, head);
 }
 
 static pic_value
 pic_dict_dictionary_for_each(pic_state *pic)
 {
-  pic_value dict, proc, key;
-  int it = 0;
-  size_t ai;
+  pic_value dict, proc;
+  struct dict_each e;
 
   pic_get_args(pic, "ld", &proc, &dict);
 
-  ai = pic_enter(pic);
-  while (pic_dict_next(pic, dict, &it, &key, NULL)) {
-    pic_call(pic, proc, 1, key);
-    pic_leave(pic, ai);
-  }
-
+  e.dict = dict;
+  e.tail = pic_false_value(pic);
+  e.it = 0;
+  e.started = false;
+  pic_call_each(pic, proc, 1, dict_each, &e);
   return pic_undef_value(pic);
 }
 
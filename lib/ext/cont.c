@@ -24,6 +24,7 @@ pic_cont_reset(pic_state *pic)
 
   CONTEXT_INITK(pic, &cxt, thunk, pic->halt, 0, (pic_value *) NULL);
   cxt.reset = 1;
+  cxt.next = NULL;
   pic_vm(pic, &cxt);
   pic_set(pic, "__picrin_dynenv__", prev);
   return pic_protect(pic, cxt.fp->regs[1]);
@@ -39,6 +40,7 @@ shift_call(pic_state *pic)
 
   CONTEXT_INIT(pic, &cxt, pic_closure_ref(pic, 0), 1, &x);
   cxt.reset = 1;
+  cxt.next = NULL;
   pic_set(pic, "__picrin_dynenv__", pic_closure_ref(pic, 1));
   pic_vm(pic, &cxt);
   pic_set(pic, "__picrin_dynenv__", prev);
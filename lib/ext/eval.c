@@ -308,288 +308,257 @@ static const unsigned char eval_rom[] = {
 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02,
 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00,
 0x00, 0x00, 0x63, 0x64, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
-0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x07, 0x01, 0x00, 0x19,
-0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x01, 0x0d, 0x01, 0x04, 0x02,
-0x0b, 0x01, 0x04, 0x03, 0x08, 0x01, 0x04, 0x04, 0x04, 0x01, 0x04, 0x05,
-0x00, 0x01, 0x01, 0x05, 0x05, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00,
-0x00, 0x02, 0x0b, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x6b, 0x65, 0x2d, 0x72,
-0x65, 0x63, 0x6f, 0x72, 0x64, 0x00, 0x04, 0x00, 0x3a, 0x02, 0x02, 0x01,
-0x00, 0x03, 0x02, 0x00, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0e,
-0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73,
-0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x01, 0x02, 0x0b,
-0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x02, 0x0f, 0x00, 0x00, 0x00,
-0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x02, 0x05,
-0x00, 0x00, 0x00, 0x71, 0x75, 0x6f, 0x74, 0x65, 0x00, 0x06, 0x00, 0x00,
-0x02, 0x01, 0x00, 0x03, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03,
-0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x06, 0x00,
-0x00, 0x00, 0x76, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x00, 0x04, 0x00, 0x3d,
-0x02, 0x02, 0x01, 0x00, 0x03, 0x02, 0x00, 0x01, 0x02, 0x01, 0x00, 0x05,
-0x02, 0x01, 0x0f, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x6d,
-0x61, 0x70, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x02, 0x02, 0x01,
-0x04, 0x03, 0x04, 0x05, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10,
-0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73,
-0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x01, 0x01, 0x04,
-0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00,
-0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00,
-0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x0b, 0x03,
-0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02,
-0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00,
-0x02, 0x01, 0x00, 0x04, 0x02, 0x04, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01,
-0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04,
-0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02,
-0x01, 0x00, 0x04, 0x02, 0x07, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03,
+0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c,
+0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x72, 0x74, 0x64, 0x00,
+0x04, 0x00, 0x39, 0x02, 0x02, 0x01, 0x00, 0x03, 0x02, 0x00, 0x01, 0x02,
+0x01, 0x00, 0x08, 0x01, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+0x04, 0x01, 0x0e, 0x01, 0x04, 0x02, 0x0c, 0x01, 0x04, 0x03, 0x09, 0x01,
+0x04, 0x04, 0x05, 0x01, 0x04, 0x05, 0x01, 0x01, 0x04, 0x06, 0x00, 0x01,
+0x01, 0x06, 0x06, 0x00, 0x06, 0x01, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x02,
+0x00, 0x00, 0x04, 0x01, 0x00, 0x01, 0x0a, 0x02, 0x0a, 0x03, 0x0a, 0x04,
+0x01, 0x04, 0x04, 0x00, 0x04, 0x04, 0x01, 0x21, 0x00, 0x00, 0x00, 0x02,
+0x10, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x6b, 0x65, 0x2d, 0x72, 0x65, 0x63,
+0x6f, 0x72, 0x64, 0x2d, 0x74, 0x79, 0x70, 0x65, 0x00, 0x02, 0x00, 0x00,
+0x05, 0x00, 0x00, 0x04, 0x02, 0x00, 0x01, 0x05, 0x00, 0x00, 0x03, 0x02,
+0x00, 0x02, 0x05, 0x00, 0x00, 0x02, 0x04, 0x00, 0x3c, 0x02, 0x02, 0x01,
+0x03, 0x03, 0x02, 0x00, 0x01, 0x02, 0x02, 0x00, 0x04, 0x01, 0x01, 0x0c,
+0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x6c, 0x65, 0x74, 0x00,
+0x04, 0x00, 0x3d, 0x02, 0x02, 0x01, 0x00, 0x03, 0x02, 0x00, 0x01, 0x02,
 0x01, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00,
 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
-0x00, 0x04, 0x02, 0x00, 0x01, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05,
-0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63,
-0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
-0x0a, 0x03, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01,
-0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f,
-0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x36,
-0x09, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x01, 0x01,
-0x0c, 0x00, 0x00, 0x00, 0x02, 0x06, 0x00, 0x00, 0x00, 0x6c, 0x61, 0x6d,
-0x62, 0x64, 0x61, 0x00, 0x04, 0x00, 0x46, 0x02, 0x02, 0x01, 0x00, 0x03,
-0x02, 0x00, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x02, 0x0d, 0x00, 0x00,
-0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x02,
-0x03, 0x00, 0x00, 0x00, 0x6f, 0x62, 0x6a, 0x00, 0x06, 0x00, 0x00, 0x02,
-0x01, 0x00, 0x03, 0x02, 0x01, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x04,
-0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x61,
-0x6e, 0x64, 0x00, 0x04, 0x00, 0x48, 0x02, 0x02, 0x01, 0x00, 0x03, 0x02,
-0x00, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00,
-0x02, 0x07, 0x00, 0x00, 0x00, 0x72, 0x65, 0x63, 0x6f, 0x72, 0x64, 0x3f,
-0x00, 0x04, 0x00, 0x49, 0x02, 0x02, 0x01, 0x00, 0x03, 0x02, 0x00, 0x01,
-0x02, 0x01, 0x00, 0x05, 0x01, 0x02, 0x0d, 0x00, 0x00, 0x00, 0x02, 0x04,
-0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x02, 0x03, 0x00, 0x00,
-0x00, 0x6f, 0x62, 0x6a, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x03,
-0x02, 0x01, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10,
-0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73,
-0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x01, 0x01, 0x04,
-0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00,
-0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x65, 0x71, 0x3f, 0x00, 0x04,
-0x00, 0x4c, 0x02, 0x02, 0x01, 0x00, 0x03, 0x02, 0x00, 0x01, 0x02, 0x01,
-0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x0b, 0x00, 0x00,
-0x00, 0x72, 0x65, 0x63, 0x6f, 0x72, 0x64, 0x2d, 0x74, 0x79, 0x70, 0x65,
-0x00, 0x04, 0x00, 0x4d, 0x02, 0x02, 0x01, 0x00, 0x03, 0x02, 0x00, 0x01,
-0x02, 0x01, 0x00, 0x05, 0x01, 0x02, 0x0d, 0x00, 0x00, 0x00, 0x02, 0x04,
-0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x02, 0x03, 0x00, 0x00,
-0x00, 0x6f, 0x62, 0x6a, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x03,
-0x02, 0x01, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10,
-0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73,
-0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x01, 0x01, 0x04,
-0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00,
-0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00,
-0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x16, 0x02, 0x0b, 0x03,
-0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x02, 0x0f, 0x00, 0x00, 0x00, 0x02,
-0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x02, 0x05, 0x00,
-0x00, 0x00, 0x71, 0x75, 0x6f, 0x74, 0x65, 0x00, 0x06, 0x00, 0x00, 0x02,
-0x01, 0x00, 0x03, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01,
-0x00, 0x05, 0x01, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00,
-0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
-0x04, 0x02, 0x00, 0x01, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01,
-0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f,
-0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x03,
-0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01,
-0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e,
-0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x07, 0x01,
-0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0e,
-0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73,
-0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x0b,
-0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00,
-0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00,
-0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x0a, 0x01, 0x04, 0x03, 0x00, 0x01,
-0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02,
-0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00,
-0x02, 0x01, 0x00, 0x04, 0x02, 0x0e, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01,
-0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x04,
-0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02,
-0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00,
-0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00,
-0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
-0x02, 0x11, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05,
+0x00, 0x04, 0x02, 0x03, 0x02, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05,
 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63,
 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
-0x13, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01,
+0x04, 0x06, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01,
 0x01, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f,
 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00,
-0x01, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00,
+0x01, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00,
 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00,
-0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x22, 0x04, 0x04, 0x03,
-0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00,
+0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x04, 0x02, 0x0b, 0x03,
+0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02,
+0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00,
+0x02, 0x01, 0x00, 0x04, 0x02, 0x01, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01,
+0x03, 0x01, 0x00, 0x05, 0x00, 0x01, 0x11, 0x00, 0x00, 0x00, 0x02, 0x04,
+0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x04,
+0x01, 0x06, 0x01, 0x04, 0x02, 0x05, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01,
+0x03, 0x02, 0x00, 0x05, 0x01, 0x02, 0x0f, 0x00, 0x00, 0x00, 0x02, 0x01,
+0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x06, 0x00,
+0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x03, 0x03, 0x01, 0x01,
+0x03, 0x01, 0x00, 0x04, 0x02, 0x02, 0x20, 0x00, 0x00, 0x00, 0x02, 0x0f,
+0x00, 0x00, 0x00, 0x63, 0x6f, 0x72, 0x65, 0x23, 0x72, 0x65, 0x63, 0x6f,
+0x72, 0x64, 0x2d, 0x72, 0x65, 0x66, 0x00, 0x02, 0x0a, 0x00, 0x00, 0x00,
+0x72, 0x65, 0x63, 0x6f, 0x72, 0x64, 0x2d, 0x72, 0x65, 0x66, 0x00, 0x04,
+0x00, 0x00, 0x01, 0x08, 0x00, 0x10, 0x00, 0x04, 0x00, 0x3e, 0x02, 0x02,
+0x01, 0x00, 0x03, 0x02, 0x00, 0x01, 0x02, 0x04, 0x00, 0x3e, 0x02, 0x02,
+0x01, 0x01, 0x03, 0x02, 0x01, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x01,
+0x0e, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e,
+0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x02, 0x02,
+0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00,
 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06,
-0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x4e, 0x09, 0x04, 0x03, 0x00,
-0x01, 0x01, 0x03, 0x01, 0x00, 0x03, 0x02, 0x00, 0x08, 0x00, 0x00, 0x00,
-0x02, 0x00, 0x00, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x04, 0x01,
-0x00, 0x0b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x01, 0x00, 0x01,
-0x0a, 0x02, 0x01, 0x02, 0x02, 0x00, 0x06, 0x01, 0x00, 0x1a, 0x00, 0x00,
-0x00, 0x02, 0x00, 0x00, 0x05, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x02,
-0x04, 0x01, 0x00, 0x01, 0x04, 0x02, 0x26, 0x05, 0x0d, 0x03, 0x00, 0x0b,
-0x04, 0x01, 0x04, 0x04, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00,
-0x02, 0x05, 0x00, 0x00, 0x00, 0x6e, 0x75, 0x6c, 0x6c, 0x3f, 0x00, 0x06,
-0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x01, 0x02, 0x01,
-0x00, 0x04, 0x01, 0x01, 0x1e, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00,
-0x00, 0x63, 0x61, 0x72, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x0e,
-0x00, 0x04, 0x00, 0x01, 0x01, 0x04, 0x01, 0x01, 0x04, 0x01, 0x01, 0x06,
-0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01,
-0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04,
-0x01, 0x02, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x02, 0x00, 0x04,
-0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63,
-0x61, 0x64, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
-0x00, 0x02, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x02, 0x0d, 0x00, 0x00,
-0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x02,
-0x03, 0x00, 0x00, 0x00, 0x6f, 0x62, 0x6a, 0x00, 0x06, 0x00, 0x00, 0x02,
-0x01, 0x00, 0x03, 0x02, 0x01, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05,
-0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63,
-0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
-0x01, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01,
-0x02, 0x0d, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f,
-0x6e, 0x73, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x6f, 0x62, 0x6a, 0x00,
-0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x03, 0x02, 0x01, 0x0b, 0x03, 0x01,
-0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04,
-0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02,
-0x01, 0x00, 0x04, 0x02, 0x2e, 0x04, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03,
-0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x0a, 0x00,
-0x00, 0x00, 0x76, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x2d, 0x72, 0x65, 0x66,
-0x00, 0x04, 0x00, 0x69, 0x02, 0x02, 0x01, 0x00, 0x03, 0x02, 0x00, 0x01,
-0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x0c,
-0x00, 0x00, 0x00, 0x72, 0x65, 0x63, 0x6f, 0x72, 0x64, 0x2d, 0x64, 0x61,
-0x74, 0x75, 0x6d, 0x00, 0x04, 0x00, 0x6a, 0x02, 0x02, 0x01, 0x00, 0x03,
-0x02, 0x00, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x02, 0x0d, 0x00, 0x00,
-0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x02,
-0x03, 0x00, 0x00, 0x00, 0x6f, 0x62, 0x6a, 0x00, 0x06, 0x00, 0x00, 0x02,
-0x01, 0x00, 0x03, 0x02, 0x01, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05,
-0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63,
-0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
-0x01, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01,
-0x01, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f,
-0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x0c,
-0x03, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00,
-0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00,
-0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x01, 0x01, 0x04, 0x03,
-0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00,
+0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x05, 0x06, 0x04, 0x03, 0x00,
+0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x02, 0x0f, 0x00, 0x00, 0x00,
+0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x02, 0x03,
+0x00, 0x00, 0x00, 0x6f, 0x62, 0x6a, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
+0x00, 0x03, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00,
+0x05, 0x00, 0x01, 0x11, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00,
+0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x05, 0x01,
+0x04, 0x02, 0x03, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00,
+0x05, 0x01, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00,
+0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
+0x02, 0x02, 0x02, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01,
+0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e,
+0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x05, 0x06,
+0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x02, 0x0f,
+0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73,
+0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x6f, 0x62, 0x6a, 0x00, 0x06, 0x00,
+0x00, 0x02, 0x01, 0x00, 0x03, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01,
+0x03, 0x01, 0x00, 0x05, 0x00, 0x01, 0x11, 0x00, 0x00, 0x00, 0x02, 0x04,
+0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x04,
+0x01, 0x05, 0x01, 0x04, 0x02, 0x03, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01,
+0x03, 0x02, 0x00, 0x05, 0x01, 0x02, 0x0f, 0x00, 0x00, 0x00, 0x02, 0x01,
+0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x06, 0x00,
+0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x03, 0x03, 0x01, 0x01,
+0x03, 0x01, 0x00, 0x04, 0x02, 0x02, 0x20, 0x00, 0x00, 0x00, 0x02, 0x10,
+0x00, 0x00, 0x00, 0x63, 0x6f, 0x72, 0x65, 0x23, 0x72, 0x65, 0x63, 0x6f,
+0x72, 0x64, 0x2d, 0x73, 0x65, 0x74, 0x21, 0x00, 0x02, 0x0b, 0x00, 0x00,
+0x00, 0x72, 0x65, 0x63, 0x6f, 0x72, 0x64, 0x2d, 0x73, 0x65, 0x74, 0x21,
+0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x10, 0x00, 0x04, 0x00, 0x3e,
+0x02, 0x02, 0x01, 0x00, 0x03, 0x02, 0x00, 0x01, 0x02, 0x04, 0x00, 0x3e,
+0x02, 0x02, 0x01, 0x01, 0x03, 0x02, 0x01, 0x01, 0x02, 0x01, 0x00, 0x05,
+0x01, 0x02, 0x0d, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63,
+0x6f, 0x6e, 0x73, 0x00, 0x02, 0x05, 0x00, 0x00, 0x00, 0x76, 0x61, 0x6c,
+0x75, 0x65, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x03, 0x02, 0x01,
+0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00,
 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06,
-0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x05, 0x01, 0x04, 0x03, 0x00,
-0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00,
-0x02, 0x05, 0x00, 0x00, 0x00, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x00, 0x04,
-0x00, 0x70, 0x02, 0x02, 0x01, 0x00, 0x03, 0x02, 0x00, 0x01, 0x02, 0x01,
-0x00, 0x05, 0x01, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00,
-0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
-0x04, 0x02, 0x37, 0x02, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01,
-0x02, 0x0f, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f,
-0x6e, 0x73, 0x00, 0x02, 0x05, 0x00, 0x00, 0x00, 0x71, 0x75, 0x6f, 0x74,
-0x65, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x03, 0x02, 0x01, 0x04,
-0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00,
-0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00,
-0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x0b, 0x03,
+0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x03, 0x02, 0x04, 0x03, 0x00,
+0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00,
+0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00,
+0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x06, 0x06, 0x04, 0x03, 0x00, 0x01,
 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x02, 0x0f, 0x00, 0x00, 0x00, 0x02,
 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x02, 0x03, 0x00,
 0x00, 0x00, 0x6f, 0x62, 0x6a, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
 0x03, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05,
-0x01, 0x02, 0x0f, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63,
-0x6f, 0x6e, 0x73, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x72, 0x65, 0x63,
-0x6f, 0x72, 0x64, 0x20, 0x74, 0x79, 0x70, 0x65, 0x20, 0x6d, 0x69, 0x73,
-0x6d, 0x61, 0x74, 0x63, 0x68, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
-0x03, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05,
-0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63,
-0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
-0x05, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01,
-0x01, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f,
-0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00,
-0x01, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00,
-0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00,
-0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x08, 0x01, 0x04, 0x03,
-0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00,
+0x00, 0x01, 0x11, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63,
+0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x06, 0x01, 0x04,
+0x02, 0x04, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05,
+0x01, 0x02, 0x0d, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63,
+0x6f, 0x6e, 0x73, 0x00, 0x02, 0x05, 0x00, 0x00, 0x00, 0x76, 0x61, 0x6c,
+0x75, 0x65, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x03, 0x02, 0x01,
+0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00,
 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06,
-0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x10, 0x01, 0x04, 0x03, 0x00,
+0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x03, 0x02, 0x04, 0x03, 0x00,
 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00,
 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00,
-0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x6b, 0x0e, 0x04, 0x03, 0x00, 0x01,
-0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x02,
-0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00,
-0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x0b, 0x03, 0x01, 0x03, 0x01,
+0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x06, 0x06, 0x04, 0x03, 0x00, 0x01,
+0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x02, 0x0f, 0x00, 0x00, 0x00, 0x02,
+0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x02, 0x03, 0x00,
+0x00, 0x00, 0x6f, 0x62, 0x6a, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
+0x03, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05,
+0x00, 0x01, 0x11, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63,
+0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x06, 0x01, 0x04,
+0x02, 0x04, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05,
+0x01, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63,
+0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
+0x02, 0x02, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x02, 0x0f,
+0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73,
+0x00, 0x02, 0x05, 0x00, 0x00, 0x00, 0x71, 0x75, 0x6f, 0x74, 0x65, 0x00,
+0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x03, 0x02, 0x01, 0x04, 0x03, 0x00,
+0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x02, 0x0f, 0x00, 0x00, 0x00,
+0x02, 0x03, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x70, 0x00, 0x02, 0x03, 0x00,
+0x00, 0x00, 0x63, 0x61, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
+0x06, 0x02, 0x01, 0x04, 0x03, 0x04, 0x05, 0x01, 0x03, 0x01, 0x00, 0x05,
+0x01, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63,
+0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
+0x00, 0x01, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x02, 0x0f,
+0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73,
+0x00, 0x02, 0x05, 0x00, 0x00, 0x00, 0x71, 0x75, 0x6f, 0x74, 0x65, 0x00,
+0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x03, 0x02, 0x01, 0x04, 0x03, 0x00,
+0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00, 0x00, 0x00,
+0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00,
+0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x0b, 0x03, 0x01, 0x03,
+0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00,
+0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
+0x00, 0x04, 0x02, 0x04, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01,
 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00,
 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
-0x04, 0x02, 0x15, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00,
-0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00,
+0x04, 0x02, 0x07, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00,
+0x05, 0x01, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00,
 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
-0x02, 0x6e, 0x09, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x03,
-0x02, 0x00, 0x08, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x01, 0x01,
-0x01, 0x01, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02,
-0x04, 0x00, 0x00, 0x00, 0x63, 0x64, 0x64, 0x72, 0x00, 0x06, 0x00, 0x00,
-0x02, 0x01, 0x00, 0x04, 0x02, 0x1b, 0x02, 0x01, 0x02, 0x01, 0x00, 0x04,
-0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x05, 0x00, 0x00, 0x00, 0x6e,
-0x75, 0x6c, 0x6c, 0x3f, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
-0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x1c, 0x00,
-0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x64, 0x64, 0x72, 0x00,
-0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x0c, 0x00, 0x04, 0x00, 0x02, 0x01,
-0x0b, 0x01, 0x01, 0x01, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
-0x1d, 0x02, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00,
-0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x61, 0x72, 0x00, 0x06, 0x00,
-0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00,
-0x05, 0x01, 0x02, 0x0d, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00,
-0x63, 0x6f, 0x6e, 0x73, 0x00, 0x02, 0x05, 0x00, 0x00, 0x00, 0x76, 0x61,
-0x6c, 0x75, 0x65, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x03, 0x02,
-0x01, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x02, 0x0f, 0x00,
+0x02, 0x00, 0x01, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01,
+0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e,
+0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x0b, 0x02,
+0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10,
+0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73,
+0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x38, 0x09, 0x04,
+0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x02, 0x0d, 0x00,
+0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00,
+0x02, 0x03, 0x00, 0x00, 0x00, 0x6f, 0x62, 0x6a, 0x00, 0x06, 0x00, 0x00,
+0x02, 0x01, 0x00, 0x03, 0x02, 0x01, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00,
+0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x07, 0x00, 0x00, 0x00,
+0x72, 0x65, 0x63, 0x6f, 0x72, 0x64, 0x3f, 0x00, 0x04, 0x00, 0x49, 0x02,
+0x02, 0x01, 0x00, 0x03, 0x02, 0x00, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01,
+0x01, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f,
+0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x0f,
+0x06, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x02, 0x0f, 0x00,
 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00,
 0x02, 0x03, 0x00, 0x00, 0x00, 0x6f, 0x62, 0x6a, 0x00, 0x06, 0x00, 0x00,
 0x02, 0x01, 0x00, 0x03, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03,
 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00,
 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
 0x00, 0x04, 0x02, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01,
-0x00, 0x05, 0x01, 0x02, 0x0d, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00,
-0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x6f,
-0x62, 0x6a, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x03, 0x02, 0x01,
-0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00,
+0x00, 0x05, 0x01, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00,
+0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
+0x04, 0x02, 0x00, 0x01, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01,
+0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f,
+0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x05,
+0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01,
+0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e,
+0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x40, 0x0a,
+0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d,
+0x00, 0x00, 0x00, 0x04, 0x00, 0x14, 0x04, 0x02, 0x01, 0x00, 0x04, 0x02,
+0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00, 0x00,
 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06,
-0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x4d, 0x04, 0x04, 0x03, 0x00,
-0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00,
-0x02, 0x0b, 0x00, 0x00, 0x00, 0x76, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x2d,
-0x73, 0x65, 0x74, 0x21, 0x00, 0x04, 0x00, 0x88, 0x02, 0x02, 0x01, 0x00,
-0x03, 0x02, 0x00, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00,
-0x00, 0x00, 0x02, 0x0c, 0x00, 0x00, 0x00, 0x72, 0x65, 0x63, 0x6f, 0x72,
-0x64, 0x2d, 0x64, 0x61, 0x74, 0x75, 0x6d, 0x00, 0x04, 0x00, 0x89, 0x02,
-0x02, 0x01, 0x00, 0x03, 0x02, 0x00, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01,
-0x02, 0x0d, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f,
-0x6e, 0x73, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x6f, 0x62, 0x6a, 0x00,
-0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x03, 0x02, 0x01, 0x0b, 0x03, 0x01,
+0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x0b, 0x03, 0x01,
 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04,
 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02,
-0x01, 0x00, 0x04, 0x02, 0x01, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03,
+0x01, 0x00, 0x04, 0x02, 0x17, 0x04, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03,
+0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00,
+0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
+0x00, 0x04, 0x02, 0x44, 0x09, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01,
+0x00, 0x03, 0x02, 0x00, 0x08, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0b, 0x00, 0x00,
+0x00, 0x02, 0x00, 0x00, 0x04, 0x01, 0x00, 0x01, 0x0a, 0x02, 0x01, 0x02,
+0x02, 0x00, 0x06, 0x01, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+0x05, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x02, 0x04, 0x01, 0x00, 0x01,
+0x04, 0x02, 0x1b, 0x05, 0x0d, 0x03, 0x00, 0x0b, 0x04, 0x01, 0x04, 0x04,
+0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x05, 0x00, 0x00,
+0x00, 0x6e, 0x75, 0x6c, 0x6c, 0x3f, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
+0x00, 0x04, 0x02, 0x00, 0x02, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01,
+0x1e, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x61, 0x72,
+0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x0e, 0x00, 0x04, 0x00, 0x01,
+0x01, 0x04, 0x01, 0x01, 0x04, 0x01, 0x01, 0x06, 0x00, 0x00, 0x02, 0x01,
+0x00, 0x04, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x00,
+0x0d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x01, 0x02, 0x01, 0x04,
+0x02, 0x00, 0x01, 0x01, 0x02, 0x02, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00,
+0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x61, 0x64, 0x72, 0x00,
+0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x01, 0x02,
 0x01, 0x00, 0x05, 0x01, 0x02, 0x0d, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00,
-0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x02, 0x05, 0x00, 0x00, 0x00,
-0x76, 0x61, 0x6c, 0x75, 0x65, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
-0x03, 0x02, 0x01, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01,
-0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e,
-0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x2c, 0x03,
-0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10,
-0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73,
-0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x02, 0x01, 0x04,
-0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00,
+0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00,
+0x6f, 0x62, 0x6a, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x03, 0x02,
+0x01, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00,
+0x00, 0x00, 0x04, 0x00, 0x20, 0x03, 0x02, 0x01, 0x00, 0x04, 0x02, 0x05,
+0x03, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00, 0x00, 0x00,
+0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00,
+0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x0b, 0x03, 0x01, 0x03,
+0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00,
+0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
+0x00, 0x04, 0x02, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01,
+0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00,
+0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
+0x04, 0x02, 0x50, 0x0a, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00,
+0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x04, 0x00, 0x24, 0x04, 0x02,
+0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01,
+0x01, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f,
+0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00,
+0x01, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00,
 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00,
-0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x06, 0x01, 0x04, 0x03,
-0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00,
-0x00, 0x02, 0x05, 0x00, 0x00, 0x00, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x00,
-0x04, 0x00, 0x90, 0x02, 0x02, 0x01, 0x00, 0x03, 0x02, 0x00, 0x01, 0x02,
-0x01, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00,
+0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x07, 0x01, 0x04, 0x03,
+0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00,
+0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06,
+0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x54, 0x09, 0x04, 0x03, 0x00,
+0x01, 0x01, 0x03, 0x01, 0x00, 0x03, 0x02, 0x00, 0x08, 0x00, 0x00, 0x00,
+0x02, 0x00, 0x00, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x04, 0x01,
+0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x64,
+0x64, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x0b,
+0x02, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00,
+0x02, 0x05, 0x00, 0x00, 0x00, 0x6e, 0x75, 0x6c, 0x6c, 0x3f, 0x00, 0x06,
+0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01,
+0x00, 0x04, 0x01, 0x01, 0x1c, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00,
+0x00, 0x63, 0x64, 0x64, 0x72, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00,
+0x0c, 0x00, 0x04, 0x00, 0x02, 0x01, 0x0b, 0x01, 0x01, 0x01, 0x06, 0x00,
+0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x0d, 0x02, 0x01, 0x02, 0x01, 0x00,
+0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00,
+0x63, 0x61, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
+0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x02, 0x0d, 0x00, 0x00,
+0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x02,
+0x05, 0x00, 0x00, 0x00, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x00, 0x06, 0x00,
+0x00, 0x02, 0x01, 0x00, 0x03, 0x02, 0x01, 0x0b, 0x03, 0x01, 0x03, 0x01,
+0x00, 0x05, 0x01, 0x02, 0x0f, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00,
+0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x6f,
+0x62, 0x6a, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x03, 0x02, 0x01,
+0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d,
+0x00, 0x00, 0x00, 0x04, 0x00, 0x2f, 0x02, 0x02, 0x01, 0x00, 0x04, 0x02,
+0x14, 0x03, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00, 0x00,
+0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06,
+0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x0b, 0x03, 0x01,
+0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04,
+0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02,
+0x01, 0x00, 0x04, 0x02, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03,
+0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00,
 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
-0x00, 0x04, 0x02, 0x57, 0x02, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05,
-0x01, 0x02, 0x0f, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63,
-0x6f, 0x6e, 0x73, 0x00, 0x02, 0x05, 0x00, 0x00, 0x00, 0x71, 0x75, 0x6f,
-0x74, 0x65, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x03, 0x02, 0x01,
-0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0e,
-0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73,
-0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x0b,
-0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x02, 0x0f, 0x00, 0x00, 0x00,
-0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x02, 0x03,
-0x00, 0x00, 0x00, 0x6f, 0x62, 0x6a, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
-0x00, 0x03, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00,
-0x05, 0x01, 0x02, 0x0f, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00,
-0x63, 0x6f, 0x6e, 0x73, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x72, 0x65,
-0x63, 0x6f, 0x72, 0x64, 0x20, 0x74, 0x79, 0x70, 0x65, 0x20, 0x6d, 0x69,
-0x73, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
-0x00, 0x03, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00,
-0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00,
-0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
-0x02, 0x05, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05,
+0x00, 0x04, 0x02, 0x5f, 0x0a, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01,
+0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x04, 0x00, 0x33, 0x04,
+0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x05,
 0x01, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63,
 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
 0x00, 0x01, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10,
@@ -597,587 +566,669 @@ static const unsigned char eval_rom[] = {
 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x08, 0x01, 0x04,
 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00,
 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00,
-0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x11, 0x01, 0x04, 0x03,
-0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00,
+0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x63, 0x09, 0x04, 0x03,
+0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x00, 0x01, 0x0f, 0x00, 0x00,
 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06,
-0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x8b, 0x0e, 0x04, 0x03, 0x00,
-0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00, 0x00, 0x00,
-0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00,
-0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x0b, 0x03, 0x01, 0x03,
-0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00,
-0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
-0x00, 0x04, 0x02, 0x16, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01,
-0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00,
-0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
-0x04, 0x02, 0x8e, 0x09, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00,
-0x05, 0x00, 0x01, 0x0f, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00,
-0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x1f, 0x01,
-0x04, 0x02, 0x00, 0x01, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01,
-0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f,
-0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x01,
-0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x01, 0x00,
-0x0d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x01, 0x1c, 0x01, 0x04,
-0x02, 0x00, 0x01, 0x01, 0x02, 0x02, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00,
-0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x64, 0x72, 0x00, 0x06,
-0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x20, 0x02, 0x01, 0x02, 0x01,
-0x00, 0x05, 0x01, 0x01, 0x0f, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x00,
-0x00, 0x2b, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x21,
-0x03, 0x0d, 0x03, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10,
-0x00, 0x00, 0x00, 0x02, 0x06, 0x00, 0x00, 0x00, 0x61, 0x70, 0x70, 0x65,
-0x6e, 0x64, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x02,
-0x02, 0x04, 0x03, 0x22, 0x04, 0x01, 0x03, 0x01, 0x00, 0x06, 0x00, 0x00,
-0x16, 0x00, 0x00, 0x00, 0x04, 0x00, 0x24, 0x02, 0x04, 0x01, 0x03, 0x01,
-0x04, 0x02, 0x02, 0x01, 0x04, 0x03, 0x01, 0x01, 0x04, 0x04, 0x00, 0x01,
-0x01, 0x04, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02,
+0x00, 0x00, 0x04, 0x01, 0x0e, 0x01, 0x04, 0x02, 0x00, 0x01, 0x0b, 0x03,
+0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02,
 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00,
 0x02, 0x01, 0x00, 0x04, 0x02, 0x01, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01,
+0x03, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x02, 0x00,
+0x00, 0x04, 0x01, 0x0c, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x02,
+0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00,
+0x00, 0x63, 0x64, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
+0x02, 0x10, 0x02, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0f, 0x00,
+0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x06, 0x00, 0x00,
+0x02, 0x01, 0x00, 0x04, 0x02, 0x11, 0x03, 0x0d, 0x03, 0x01, 0x01, 0x03,
+0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x06, 0x00,
+0x00, 0x00, 0x61, 0x70, 0x70, 0x65, 0x6e, 0x64, 0x00, 0x06, 0x00, 0x00,
+0x02, 0x01, 0x00, 0x04, 0x02, 0x02, 0x02, 0x04, 0x03, 0x12, 0x04, 0x01,
+0x03, 0x01, 0x00, 0x06, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x04, 0x00,
+0x14, 0x02, 0x04, 0x01, 0x03, 0x01, 0x04, 0x02, 0x02, 0x01, 0x04, 0x03,
+0x01, 0x01, 0x04, 0x04, 0x00, 0x01, 0x01, 0x04, 0x01, 0x00, 0x04, 0x01,
+0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x61,
+0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x1a, 0x03,
+0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02,
+0x03, 0x00, 0x00, 0x00, 0x63, 0x64, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02,
+0x01, 0x00, 0x04, 0x02, 0x1b, 0x03, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01,
+0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x0b, 0x00, 0x00, 0x00, 0x6d, 0x61,
+0x6b, 0x65, 0x2d, 0x72, 0x65, 0x63, 0x6f, 0x72, 0x64, 0x00, 0x04, 0x00,
+0x57, 0x02, 0x02, 0x01, 0x00, 0x03, 0x02, 0x00, 0x01, 0x02, 0x01, 0x00,
+0x05, 0x02, 0x01, 0x0f, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00,
+0x6d, 0x61, 0x70, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x02, 0x02,
+0x01, 0x04, 0x03, 0x1d, 0x05, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01,
+0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e,
+0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x1e, 0x06,
+0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10,
+0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73,
+0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x02, 0x01, 0x04,
+0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00,
+0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00,
+0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x0b, 0x03,
+0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02,
+0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00,
+0x02, 0x01, 0x00, 0x04, 0x02, 0x05, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01,
 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04,
 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02,
-0x01, 0x00, 0x04, 0x02, 0x1a, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03,
-0x01, 0x00, 0x05, 0x00, 0x01, 0x11, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00,
-0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01,
-0x27, 0x01, 0x04, 0x02, 0x52, 0x0b, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03,
-0x02, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00,
-0x00, 0x00, 0x63, 0x61, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
-0x04, 0x02, 0x00, 0x02, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c,
-0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x64, 0x72, 0x00,
-0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x06, 0x03, 0x01, 0x02,
-0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00,
-0x00, 0x00, 0x6d, 0x65, 0x6d, 0x71, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
-0x00, 0x04, 0x02, 0x01, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01,
-0x00, 0x04, 0x00, 0x01, 0x1d, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00,
-0x00, 0x63, 0x61, 0x72, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x11,
-0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x03, 0x01, 0x04, 0x02, 0x03, 0x02,
-0x01, 0x02, 0x04, 0x00, 0x03, 0x01, 0x0c, 0x01, 0x01, 0x01, 0x03, 0x00,
-0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00,
-0x63, 0x64, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
-0x00, 0x02, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00,
-0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x61, 0x72, 0x00, 0x06, 0x00,
-0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00,
-0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00,
-0x63, 0x64, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
-0x02, 0x02, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00,
-0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x64, 0x72, 0x00, 0x06, 0x00,
-0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00,
-0x05, 0x01, 0x00, 0x11, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x01,
-0x04, 0x01, 0x04, 0x02, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03,
-0x03, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x05, 0x00,
-0x00, 0x00, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x00, 0x04, 0x00, 0x30, 0x02,
-0x02, 0x01, 0x00, 0x03, 0x02, 0x00, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01,
-0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x70, 0x72,
-0x65, 0x76, 0x00, 0x04, 0x00, 0x31, 0x02, 0x02, 0x01, 0x00, 0x03, 0x02,
-0x00, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00,
-0x02, 0x02, 0x00, 0x00, 0x00, 0x69, 0x74, 0x00, 0x04, 0x00, 0x32, 0x02,
-0x02, 0x01, 0x00, 0x03, 0x02, 0x00, 0x01, 0x02, 0x01, 0x00, 0x06, 0x01,
-0x00, 0x15, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x01, 0x03, 0x01,
-0x04, 0x02, 0x02, 0x01, 0x04, 0x03, 0x01, 0x01, 0x04, 0x04, 0x00, 0x01,
-0x01, 0x04, 0x04, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02,
-0x03, 0x00, 0x00, 0x00, 0x6c, 0x65, 0x74, 0x00, 0x04, 0x00, 0x34, 0x02,
-0x02, 0x01, 0x00, 0x03, 0x02, 0x00, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01,
-0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x0e, 0x00, 0x00, 0x00, 0x6d, 0x61,
-0x6b, 0x65, 0x2d, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65,
-0x00, 0x04, 0x00, 0x35, 0x02, 0x02, 0x01, 0x00, 0x03, 0x02, 0x00, 0x01,
-0x02, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x04,
-0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02,
-0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00,
+0x01, 0x00, 0x04, 0x02, 0x4e, 0x0a, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03,
+0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x04, 0x00, 0x22,
+0x04, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00,
 0x05, 0x01, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00,
 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
 0x02, 0x00, 0x01, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01,
 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e,
-0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x04, 0x02,
-0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c,
-0x00, 0x00, 0x00, 0x02, 0x1b, 0x00, 0x00, 0x00, 0x63, 0x75, 0x72, 0x72,
-0x65, 0x6e, 0x74, 0x2d, 0x64, 0x79, 0x6e, 0x61, 0x6d, 0x69, 0x63, 0x2d,
-0x65, 0x6e, 0x76, 0x69, 0x72, 0x6f, 0x6e, 0x6d, 0x65, 0x6e, 0x74, 0x00,
-0x04, 0x00, 0x39, 0x02, 0x02, 0x01, 0x00, 0x03, 0x02, 0x00, 0x01, 0x02,
-0x01, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00,
-0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
-0x00, 0x04, 0x02, 0x00, 0x01, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05,
-0x01, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63,
-0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
-0x00, 0x01, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10,
+0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x0a, 0x01,
+0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10,
 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73,
-0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x08, 0x03, 0x04,
+0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x52, 0x09, 0x04,
 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00,
 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00,
 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x0b, 0x03,
 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02,
+0x06, 0x00, 0x00, 0x00, 0x61, 0x70, 0x70, 0x65, 0x6e, 0x64, 0x00, 0x06,
+0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x0e, 0x01, 0x04, 0x03, 0x00,
+0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00,
+0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00,
+0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x10, 0x01, 0x04, 0x03, 0x00, 0x01,
+0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02,
 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00,
-0x02, 0x01, 0x00, 0x04, 0x02, 0x05, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01,
-0x03, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x1b,
-0x00, 0x00, 0x00, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x2d, 0x64,
-0x79, 0x6e, 0x61, 0x6d, 0x69, 0x63, 0x2d, 0x65, 0x6e, 0x76, 0x69, 0x72,
-0x6f, 0x6e, 0x6d, 0x65, 0x6e, 0x74, 0x00, 0x04, 0x00, 0x3f, 0x02, 0x02,
-0x01, 0x00, 0x03, 0x02, 0x00, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01,
-0x0c, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e,
-0x73, 0x00, 0x04, 0x00, 0x40, 0x02, 0x02, 0x01, 0x00, 0x03, 0x02, 0x00,
+0x02, 0x01, 0x00, 0x04, 0x02, 0x1d, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01,
+0x03, 0x01, 0x00, 0x05, 0x00, 0x01, 0x11, 0x00, 0x00, 0x00, 0x02, 0x04,
+0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x04,
+0x01, 0x2a, 0x01, 0x04, 0x02, 0x57, 0x0b, 0x04, 0x03, 0x00, 0x01, 0x01,
+0x03, 0x02, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03,
+0x00, 0x00, 0x00, 0x63, 0x61, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
+0x00, 0x04, 0x02, 0x00, 0x02, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01,
+0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x64, 0x72,
+0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x1f, 0x03, 0x01,
+0x02, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04,
+0x00, 0x00, 0x00, 0x6d, 0x65, 0x6d, 0x71, 0x00, 0x06, 0x00, 0x00, 0x02,
+0x01, 0x00, 0x04, 0x02, 0x01, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03,
+0x01, 0x00, 0x04, 0x00, 0x01, 0x1d, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00,
+0x00, 0x00, 0x63, 0x61, 0x72, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00,
+0x11, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x03, 0x01, 0x04, 0x02, 0x03,
+0x02, 0x01, 0x02, 0x04, 0x00, 0x03, 0x01, 0x0c, 0x01, 0x01, 0x01, 0x03,
+0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00,
+0x00, 0x63, 0x64, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
+0x02, 0x00, 0x02, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00,
+0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x61, 0x72, 0x00, 0x06,
+0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01,
+0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00,
+0x00, 0x63, 0x64, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
+0x02, 0x02, 0x02, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00,
+0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x64, 0x72, 0x00, 0x06,
+0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01,
+0x00, 0x05, 0x01, 0x00, 0x11, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04,
+0x01, 0x04, 0x01, 0x04, 0x02, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01,
+0x03, 0x03, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x05,
+0x00, 0x00, 0x00, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x00, 0x04, 0x00, 0x30,
+0x02, 0x02, 0x01, 0x00, 0x03, 0x02, 0x00, 0x01, 0x02, 0x01, 0x00, 0x04,
+0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x70,
+0x72, 0x65, 0x76, 0x00, 0x04, 0x00, 0x31, 0x02, 0x02, 0x01, 0x00, 0x03,
+0x02, 0x00, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00,
+0x00, 0x02, 0x02, 0x00, 0x00, 0x00, 0x69, 0x74, 0x00, 0x04, 0x00, 0x32,
+0x02, 0x02, 0x01, 0x00, 0x03, 0x02, 0x00, 0x01, 0x02, 0x01, 0x00, 0x06,
+0x01, 0x00, 0x15, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x01, 0x03,
+0x01, 0x04, 0x02, 0x02, 0x01, 0x04, 0x03, 0x01, 0x01, 0x04, 0x04, 0x00,
+0x01, 0x01, 0x04, 0x04, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00,
+0x02, 0x03, 0x00, 0x00, 0x00, 0x6c, 0x65, 0x74, 0x00, 0x04, 0x00, 0x34,
+0x02, 0x02, 0x01, 0x00, 0x03, 0x02, 0x00, 0x01, 0x02, 0x01, 0x00, 0x04,
+0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x0e, 0x00, 0x00, 0x00, 0x6d,
+0x61, 0x6b, 0x65, 0x2d, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74,
+0x65, 0x00, 0x04, 0x00, 0x35, 0x02, 0x02, 0x01, 0x00, 0x03, 0x02, 0x00,
 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x02,
 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00,
-0x02, 0x01, 0x00, 0x04, 0x02, 0x0d, 0x03, 0x0b, 0x03, 0x01, 0x03, 0x01,
-0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00,
+0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x0b, 0x03, 0x01, 0x03, 0x01,
+0x00, 0x05, 0x01, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00,
 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
-0x04, 0x02, 0x0e, 0x02, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00,
-0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00,
-0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
-0x02, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05,
-0x01, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63,
-0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
-0x00, 0x01, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10,
-0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73,
-0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x05, 0x01, 0x04,
-0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00,
-0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00,
-0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x37, 0x0b, 0x04, 0x03,
-0x16, 0x02, 0x01, 0x03, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00,
-0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x6c, 0x65, 0x74, 0x00, 0x04, 0x00,
-0x47, 0x02, 0x02, 0x01, 0x00, 0x03, 0x02, 0x00, 0x01, 0x02, 0x01, 0x00,
-0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00,
+0x04, 0x02, 0x00, 0x01, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01,
+0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f,
+0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x04,
+0x02, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x01, 0x01,
+0x0c, 0x00, 0x00, 0x00, 0x02, 0x1b, 0x00, 0x00, 0x00, 0x63, 0x75, 0x72,
+0x72, 0x65, 0x6e, 0x74, 0x2d, 0x64, 0x79, 0x6e, 0x61, 0x6d, 0x69, 0x63,
+0x2d, 0x65, 0x6e, 0x76, 0x69, 0x72, 0x6f, 0x6e, 0x6d, 0x65, 0x6e, 0x74,
+0x00, 0x04, 0x00, 0x39, 0x02, 0x02, 0x01, 0x00, 0x03, 0x02, 0x00, 0x01,
+0x02, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x04,
+0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02,
+0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00,
+0x05, 0x01, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00,
 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
-0x02, 0x39, 0x0b, 0x04, 0x03, 0x18, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05,
-0x01, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63,
-0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
-0x00, 0x01, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10,
+0x02, 0x00, 0x01, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01,
+0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e,
+0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x08, 0x03,
+0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0e,
 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73,
-0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x16, 0x04, 0x04,
-0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00,
-0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00,
-0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x0b, 0x03,
+0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x0b,
+0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00,
+0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00,
+0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x05, 0x01, 0x04, 0x03, 0x00, 0x01,
 0x01, 0x03, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02,
 0x1b, 0x00, 0x00, 0x00, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x2d,
 0x64, 0x79, 0x6e, 0x61, 0x6d, 0x69, 0x63, 0x2d, 0x65, 0x6e, 0x76, 0x69,
-0x72, 0x6f, 0x6e, 0x6d, 0x65, 0x6e, 0x74, 0x00, 0x04, 0x00, 0x4c, 0x02,
-0x02, 0x01, 0x00, 0x03, 0x02, 0x00, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01,
-0x01, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f,
-0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x19,
-0x03, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00,
-0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00,
-0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x01, 0x01, 0x04, 0x03,
-0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00, 0x00,
-0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06,
-0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x1b, 0x04, 0x0b, 0x03, 0x01,
-0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04,
-0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02,
-0x01, 0x00, 0x04, 0x02, 0x01, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03,
+0x72, 0x6f, 0x6e, 0x6d, 0x65, 0x6e, 0x74, 0x00, 0x04, 0x00, 0x3f, 0x02,
+0x02, 0x01, 0x00, 0x03, 0x02, 0x00, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01,
+0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f,
+0x6e, 0x73, 0x00, 0x04, 0x00, 0x40, 0x02, 0x02, 0x01, 0x00, 0x03, 0x02,
+0x00, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00, 0x00, 0x00,
+0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00,
+0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x0d, 0x03, 0x0b, 0x03, 0x01, 0x03,
 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00,
 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
-0x00, 0x04, 0x02, 0x05, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01,
+0x00, 0x04, 0x02, 0x0e, 0x02, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01,
 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00,
 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
-0x04, 0x02, 0x0a, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00,
+0x04, 0x02, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00,
 0x05, 0x01, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00,
 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
 0x02, 0x00, 0x01, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01,
 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e,
-0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x0d, 0x01,
+0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x05, 0x01,
 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10,
 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73,
-0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x0f, 0x01, 0x04,
-0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00,
-0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00,
-0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x17, 0x01, 0x04, 0x03,
-0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x00, 0x01, 0x11, 0x00, 0x00,
-0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06,
-0x00, 0x00, 0x04, 0x01, 0x23, 0x01, 0x04, 0x02, 0x22, 0x01, 0x04, 0x03,
-0x00, 0x01, 0x01, 0x03, 0x03, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00,
-0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x64, 0x72, 0x00, 0x06, 0x00,
-0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x01, 0x02, 0x01, 0x00,
-0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00,
-0x63, 0x61, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
-0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00,
-0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x64, 0x72, 0x00, 0x06, 0x00,
-0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x02, 0x02, 0x01, 0x02, 0x01, 0x00,
-0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00,
-0x63, 0x64, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
-0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x00, 0x11, 0x00, 0x00,
-0x00, 0x02, 0x00, 0x00, 0x04, 0x01, 0x04, 0x01, 0x04, 0x02, 0x02, 0x01,
-0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x03, 0x00, 0x05, 0x01, 0x02, 0x0f,
-0x00, 0x00, 0x00, 0x02, 0x0f, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x6b, 0x65,
-0x2d, 0x69, 0x64, 0x65, 0x6e, 0x74, 0x69, 0x66, 0x69, 0x65, 0x72, 0x00,
-0x02, 0x03, 0x00, 0x00, 0x00, 0x6b, 0x65, 0x79, 0x00, 0x06, 0x00, 0x00,
-0x02, 0x01, 0x00, 0x03, 0x02, 0x01, 0x04, 0x03, 0x05, 0x03, 0x01, 0x03,
-0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
-0x04, 0x01, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x02, 0x00,
-0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00,
-0x6c, 0x65, 0x74, 0x00, 0x04, 0x00, 0x31, 0x02, 0x02, 0x01, 0x00, 0x03,
-0x02, 0x00, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00, 0x00,
-0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06,
-0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x03, 0x02, 0x0b, 0x03, 0x01,
-0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04,
-0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02,
-0x01, 0x00, 0x04, 0x02, 0x02, 0x02, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03,
-0x01, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00,
-0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
-0x00, 0x04, 0x02, 0x00, 0x01, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x03,
-0x02, 0x00, 0x08, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x01, 0x01,
-0x01, 0x01, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x02,
-0x00, 0x00, 0x04, 0x01, 0x00, 0x01, 0x0a, 0x02, 0x01, 0x02, 0x02, 0x00,
-0x04, 0x01, 0x00, 0x15, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x05, 0x00,
-0x00, 0x02, 0x04, 0x00, 0x00, 0x02, 0x04, 0x01, 0x00, 0x01, 0x04, 0x02,
-0x08, 0x03, 0x01, 0x02, 0x02, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00,
-0x00, 0x02, 0x05, 0x00, 0x00, 0x00, 0x6e, 0x75, 0x6c, 0x6c, 0x3f, 0x00,
-0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x01, 0x02,
-0x01, 0x00, 0x04, 0x01, 0x01, 0x1c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00,
-0x00, 0x00, 0x63, 0x61, 0x72, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00,
-0x0c, 0x00, 0x04, 0x00, 0x01, 0x01, 0x0c, 0x01, 0x01, 0x01, 0x06, 0x00,
-0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x00,
-0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x01,
-0x02, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x02, 0x00, 0x03, 0x02,
-0x00, 0x08, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x01, 0x01, 0x01,
-0x01, 0x01, 0x00, 0x03, 0x02, 0x00, 0x08, 0x00, 0x00, 0x00, 0x02, 0x00,
-0x00, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c,
-0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x61, 0x72, 0x00,
-0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x02, 0x02, 0x01, 0x02,
-0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x0b, 0x00,
-0x00, 0x00, 0x69, 0x64, 0x65, 0x6e, 0x74, 0x69, 0x66, 0x69, 0x65, 0x72,
-0x3f, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01,
-0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x1c, 0x00, 0x00, 0x00, 0x02,
-0x04, 0x00, 0x00, 0x00, 0x65, 0x6c, 0x73, 0x65, 0x00, 0x04, 0x00, 0x00,
-0x01, 0x08, 0x00, 0x10, 0x00, 0x04, 0x00, 0x3f, 0x02, 0x02, 0x01, 0x00,
-0x03, 0x02, 0x00, 0x01, 0x02, 0x04, 0x00, 0x02, 0x01, 0x0a, 0x01, 0x01,
-0x01, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03,
-0x00, 0x00, 0x00, 0x63, 0x61, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
-0x00, 0x04, 0x02, 0x05, 0x02, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x01,
-0x10, 0x00, 0x00, 0x00, 0x02, 0x0f, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x6b,
-0x65, 0x2d, 0x69, 0x64, 0x65, 0x6e, 0x74, 0x69, 0x66, 0x69, 0x65, 0x72,
-0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x04,
-0x03, 0x17, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x00, 0x01, 0x11, 0x00,
-0x00, 0x00, 0x02, 0x0c, 0x00, 0x00, 0x00, 0x69, 0x64, 0x65, 0x6e, 0x74,
-0x69, 0x66, 0x69, 0x65, 0x72, 0x3d, 0x3f, 0x00, 0x06, 0x00, 0x00, 0x04,
-0x01, 0x05, 0x01, 0x04, 0x02, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01,
-0x03, 0x01, 0x00, 0x04, 0x01, 0x01, 0x1c, 0x00, 0x00, 0x00, 0x02, 0x02,
-0x00, 0x00, 0x00, 0x6f, 0x72, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00,
-0x0c, 0x00, 0x04, 0x00, 0x01, 0x01, 0x09, 0x01, 0x01, 0x01, 0x04, 0x00,
-0x3d, 0x02, 0x02, 0x01, 0x00, 0x03, 0x02, 0x00, 0x01, 0x02, 0x01, 0x00,
-0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00,
-0x63, 0x61, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
-0x03, 0x02, 0x01, 0x02, 0x01, 0x00, 0x05, 0x02, 0x01, 0x0f, 0x00, 0x00,
-0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x70, 0x00, 0x06, 0x00,
-0x00, 0x02, 0x01, 0x00, 0x02, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01,
-0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x06,
-0x00, 0x00, 0x00, 0x61, 0x70, 0x70, 0x65, 0x6e, 0x64, 0x00, 0x06, 0x00,
-0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x0b, 0x03, 0x01, 0x03,
-0x01, 0x00, 0x05, 0x00, 0x01, 0x11, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00,
-0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01,
-0x05, 0x01, 0x04, 0x02, 0x03, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03,
-0x02, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00,
-0x00, 0x00, 0x65, 0x71, 0x76, 0x3f, 0x00, 0x04, 0x00, 0x40, 0x02, 0x02,
-0x01, 0x00, 0x03, 0x02, 0x00, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x01,
-0x0e, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e,
-0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x01, 0x02,
-0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00,
-0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06,
-0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x33, 0x0c, 0x04, 0x03, 0x00,
-0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00, 0x00, 0x00,
-0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00,
-0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x0b, 0x03, 0x01, 0x03,
-0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00,
-0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
-0x00, 0x04, 0x02, 0x13, 0x02, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01,
-0x00, 0x05, 0x00, 0x01, 0x11, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00,
-0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x05,
-0x01, 0x04, 0x02, 0x04, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01,
-0x00, 0x03, 0x02, 0x00, 0x08, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02,
-0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x03, 0x02, 0x00, 0x08, 0x00, 0x00,
-0x00, 0x02, 0x00, 0x00, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x04,
-0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63,
-0x61, 0x64, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
-0x03, 0x02, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00,
-0x00, 0x02, 0x0b, 0x00, 0x00, 0x00, 0x69, 0x64, 0x65, 0x6e, 0x74, 0x69,
-0x66, 0x69, 0x65, 0x72, 0x3f, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
-0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x1c,
-0x00, 0x00, 0x00, 0x02, 0x02, 0x00, 0x00, 0x00, 0x3d, 0x3e, 0x00, 0x04,
-0x00, 0x00, 0x01, 0x08, 0x00, 0x10, 0x00, 0x04, 0x00, 0x40, 0x02, 0x02,
-0x01, 0x00, 0x03, 0x02, 0x00, 0x01, 0x02, 0x04, 0x00, 0x02, 0x01, 0x0a,
-0x01, 0x01, 0x01, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00,
-0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x61, 0x64, 0x72, 0x00, 0x06, 0x00,
-0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x06, 0x02, 0x01, 0x02, 0x01, 0x00,
-0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x0f, 0x00, 0x00, 0x00,
-0x6d, 0x61, 0x6b, 0x65, 0x2d, 0x69, 0x64, 0x65, 0x6e, 0x74, 0x69, 0x66,
-0x69, 0x65, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
-0x00, 0x01, 0x04, 0x03, 0x18, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x00,
-0x01, 0x11, 0x00, 0x00, 0x00, 0x02, 0x0c, 0x00, 0x00, 0x00, 0x69, 0x64,
-0x65, 0x6e, 0x74, 0x69, 0x66, 0x69, 0x65, 0x72, 0x3d, 0x3f, 0x00, 0x06,
-0x00, 0x00, 0x04, 0x01, 0x05, 0x01, 0x04, 0x02, 0x02, 0x01, 0x04, 0x03,
-0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x02, 0x02, 0x20, 0x00, 0x00,
-0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x64, 0x72, 0x00, 0x02, 0x03,
-0x00, 0x00, 0x00, 0x63, 0x64, 0x72, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08,
-0x00, 0x10, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x03,
-0x02, 0x01, 0x02, 0x06, 0x00, 0x01, 0x02, 0x01, 0x01, 0x04, 0x02, 0x03,
-0x02, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00,
-0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x64, 0x72, 0x00, 0x06, 0x00, 0x00,
-0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x04,
-0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63,
-0x61, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00,
-0x01, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00, 0x00, 0x00,
-0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00,
-0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x10, 0x02, 0x0b, 0x03, 0x01, 0x03,
-0x01, 0x00, 0x05, 0x00, 0x01, 0x11, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00,
-0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01,
-0x05, 0x01, 0x04, 0x02, 0x01, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03,
-0x01, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x06, 0x00,
-0x00, 0x00, 0x61, 0x70, 0x70, 0x65, 0x6e, 0x64, 0x00, 0x06, 0x00, 0x00,
-0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x0b, 0x03, 0x01, 0x03, 0x01,
-0x00, 0x05, 0x00, 0x01, 0x11, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00,
-0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x03,
-0x01, 0x04, 0x02, 0x31, 0x0b, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01,
-0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00,
-0x00, 0x63, 0x64, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
-0x02, 0x05, 0x02, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00,
-0x00, 0x00, 0x04, 0x00, 0x07, 0x02, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00,
-0x01, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00, 0x00, 0x00,
-0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00,
-0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x0b, 0x03, 0x01, 0x03,
-0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00,
-0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
-0x00, 0x04, 0x02, 0x03, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01,
+0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x37, 0x0b, 0x04,
+0x03, 0x16, 0x02, 0x01, 0x03, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00,
+0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x6c, 0x65, 0x74, 0x00, 0x04,
+0x00, 0x47, 0x02, 0x02, 0x01, 0x00, 0x03, 0x02, 0x00, 0x01, 0x02, 0x01,
 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00,
 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
-0x04, 0x02, 0x05, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00,
-0x05, 0x00, 0x01, 0x11, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00,
-0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x07, 0x01,
-0x04, 0x02, 0x33, 0x0e, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00,
+0x04, 0x02, 0x39, 0x0b, 0x04, 0x03, 0x18, 0x03, 0x01, 0x03, 0x01, 0x00,
 0x05, 0x01, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00,
 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
 0x02, 0x00, 0x01, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01,
 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e,
-0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x02, 0x01,
-0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x00, 0x01, 0x11,
-0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73,
-0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x07, 0x01, 0x04, 0x02, 0x06, 0x01,
-0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x03, 0x00, 0x04, 0x01, 0x01, 0x0c,
-0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x64, 0x72, 0x00,
-0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x01, 0x02,
-0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00,
-0x00, 0x00, 0x63, 0x61, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
-0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c,
-0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x64, 0x72, 0x00,
-0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x02, 0x02, 0x01, 0x02,
-0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00,
-0x00, 0x00, 0x63, 0x64, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
-0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x00, 0x11,
-0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x01, 0x04, 0x01, 0x04, 0x02,
-0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x03, 0x00, 0x05, 0x01,
-0x01, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x06, 0x00, 0x00, 0x00, 0x61, 0x70,
-0x70, 0x65, 0x6e, 0x64, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
-0x02, 0x00, 0x03, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01,
-0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e,
-0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x20, 0x0b,
-0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0e,
+0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x16, 0x04,
+0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0e,
 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73,
 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x0b,
-0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00, 0x00, 0x00,
-0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00,
-0x00, 0x02, 0x01, 0x00, 0x0c, 0x02, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03,
+0x03, 0x01, 0x03, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00,
+0x02, 0x1b, 0x00, 0x00, 0x00, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74,
+0x2d, 0x64, 0x79, 0x6e, 0x61, 0x6d, 0x69, 0x63, 0x2d, 0x65, 0x6e, 0x76,
+0x69, 0x72, 0x6f, 0x6e, 0x6d, 0x65, 0x6e, 0x74, 0x00, 0x04, 0x00, 0x4c,
+0x02, 0x02, 0x01, 0x00, 0x03, 0x02, 0x00, 0x01, 0x02, 0x01, 0x00, 0x05,
+0x01, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63,
+0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
+0x19, 0x03, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10,
+0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73,
+0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x01, 0x01, 0x04,
+0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00,
+0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00,
+0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x1b, 0x04, 0x0b, 0x03,
+0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02,
+0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00,
+0x02, 0x01, 0x00, 0x04, 0x02, 0x01, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01,
+0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04,
+0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02,
+0x01, 0x00, 0x04, 0x02, 0x05, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03,
 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00,
 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
-0x00, 0x04, 0x02, 0x04, 0x02, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01,
-0x00, 0x05, 0x00, 0x01, 0x11, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00,
-0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x05,
-0x01, 0x04, 0x02, 0x24, 0x0e, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x03,
+0x00, 0x04, 0x02, 0x0a, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01,
+0x00, 0x05, 0x01, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00,
+0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
+0x04, 0x02, 0x00, 0x01, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01,
+0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f,
+0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x0d,
+0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01,
+0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e,
+0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x0f, 0x01,
+0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10,
+0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73,
+0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x17, 0x01, 0x04,
+0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x00, 0x01, 0x11, 0x00,
+0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00,
+0x06, 0x00, 0x00, 0x04, 0x01, 0x23, 0x01, 0x04, 0x02, 0x22, 0x01, 0x04,
+0x03, 0x00, 0x01, 0x01, 0x03, 0x03, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00,
+0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x64, 0x72, 0x00, 0x06,
+0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x01, 0x02, 0x01,
 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00,
-0x00, 0x63, 0x64, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
-0x02, 0x00, 0x02, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00,
-0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x61, 0x72, 0x00, 0x06,
-0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01,
+0x00, 0x63, 0x61, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
+0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00,
+0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x64, 0x72, 0x00, 0x06,
+0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x02, 0x02, 0x01, 0x02, 0x01,
 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00,
 0x00, 0x63, 0x64, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
-0x02, 0x02, 0x02, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00,
-0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x64, 0x72, 0x00, 0x06,
-0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01,
-0x00, 0x05, 0x01, 0x00, 0x11, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04,
-0x01, 0x04, 0x01, 0x04, 0x02, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01,
-0x03, 0x03, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x06,
-0x00, 0x00, 0x00, 0x61, 0x70, 0x70, 0x65, 0x6e, 0x64, 0x00, 0x06, 0x00,
-0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x03, 0x0b, 0x03, 0x01, 0x03,
-0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00,
-0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
-0x00, 0x04, 0x02, 0x1f, 0x0b, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01,
-0x00, 0x05, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00,
-0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
-0x0c, 0x02, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10,
-0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73,
-0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x01, 0x01, 0x04,
-0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00,
+0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x00, 0x11, 0x00,
+0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x01, 0x04, 0x01, 0x04, 0x02, 0x02,
+0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x03, 0x00, 0x05, 0x01, 0x02,
+0x0f, 0x00, 0x00, 0x00, 0x02, 0x0f, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x6b,
+0x65, 0x2d, 0x69, 0x64, 0x65, 0x6e, 0x74, 0x69, 0x66, 0x69, 0x65, 0x72,
+0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x6b, 0x65, 0x79, 0x00, 0x06, 0x00,
+0x00, 0x02, 0x01, 0x00, 0x03, 0x02, 0x01, 0x04, 0x03, 0x05, 0x03, 0x01,
+0x03, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x02, 0x00,
+0x00, 0x04, 0x01, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x02,
+0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00,
+0x00, 0x6c, 0x65, 0x74, 0x00, 0x04, 0x00, 0x31, 0x02, 0x02, 0x01, 0x00,
+0x03, 0x02, 0x00, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00,
 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00,
-0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x04, 0x02, 0x04, 0x03,
-0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x00, 0x01, 0x11, 0x00, 0x00,
+0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x03, 0x02, 0x0b, 0x03,
+0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02,
+0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00,
+0x02, 0x01, 0x00, 0x04, 0x02, 0x02, 0x02, 0x04, 0x03, 0x00, 0x01, 0x01,
+0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x04,
+0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02,
+0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00,
+0x03, 0x02, 0x00, 0x08, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0b, 0x00, 0x00, 0x00,
+0x02, 0x00, 0x00, 0x04, 0x01, 0x00, 0x01, 0x0a, 0x02, 0x01, 0x02, 0x02,
+0x00, 0x04, 0x01, 0x00, 0x15, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x05,
+0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x02, 0x04, 0x01, 0x00, 0x01, 0x04,
+0x02, 0x08, 0x03, 0x01, 0x02, 0x02, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00,
+0x00, 0x00, 0x02, 0x05, 0x00, 0x00, 0x00, 0x6e, 0x75, 0x6c, 0x6c, 0x3f,
+0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x01,
+0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x1c, 0x00, 0x00, 0x00, 0x02, 0x03,
+0x00, 0x00, 0x00, 0x63, 0x61, 0x72, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08,
+0x00, 0x0c, 0x00, 0x04, 0x00, 0x01, 0x01, 0x0c, 0x01, 0x01, 0x01, 0x06,
+0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01,
+0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04,
+0x01, 0x02, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x02, 0x00, 0x03,
+0x02, 0x00, 0x08, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x00, 0x03, 0x02, 0x00, 0x08, 0x00, 0x00, 0x00, 0x02,
+0x00, 0x00, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x04, 0x01, 0x01,
+0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x61, 0x72,
+0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x02, 0x02, 0x01,
+0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x0b,
+0x00, 0x00, 0x00, 0x69, 0x64, 0x65, 0x6e, 0x74, 0x69, 0x66, 0x69, 0x65,
+0x72, 0x3f, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00,
+0x01, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x1c, 0x00, 0x00, 0x00,
+0x02, 0x04, 0x00, 0x00, 0x00, 0x65, 0x6c, 0x73, 0x65, 0x00, 0x04, 0x00,
+0x00, 0x01, 0x08, 0x00, 0x10, 0x00, 0x04, 0x00, 0x3f, 0x02, 0x02, 0x01,
+0x00, 0x03, 0x02, 0x00, 0x01, 0x02, 0x04, 0x00, 0x02, 0x01, 0x0a, 0x01,
+0x01, 0x01, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02,
+0x03, 0x00, 0x00, 0x00, 0x63, 0x61, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02,
+0x01, 0x00, 0x04, 0x02, 0x05, 0x02, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01,
+0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x0f, 0x00, 0x00, 0x00, 0x6d, 0x61,
+0x6b, 0x65, 0x2d, 0x69, 0x64, 0x65, 0x6e, 0x74, 0x69, 0x66, 0x69, 0x65,
+0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01,
+0x04, 0x03, 0x17, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x00, 0x01, 0x11,
+0x00, 0x00, 0x00, 0x02, 0x0c, 0x00, 0x00, 0x00, 0x69, 0x64, 0x65, 0x6e,
+0x74, 0x69, 0x66, 0x69, 0x65, 0x72, 0x3d, 0x3f, 0x00, 0x06, 0x00, 0x00,
+0x04, 0x01, 0x05, 0x01, 0x04, 0x02, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01,
+0x01, 0x03, 0x01, 0x00, 0x04, 0x01, 0x01, 0x1c, 0x00, 0x00, 0x00, 0x02,
+0x02, 0x00, 0x00, 0x00, 0x6f, 0x72, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08,
+0x00, 0x0c, 0x00, 0x04, 0x00, 0x01, 0x01, 0x09, 0x01, 0x01, 0x01, 0x04,
+0x00, 0x3d, 0x02, 0x02, 0x01, 0x00, 0x03, 0x02, 0x00, 0x01, 0x02, 0x01,
+0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00,
+0x00, 0x63, 0x61, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
+0x02, 0x03, 0x02, 0x01, 0x02, 0x01, 0x00, 0x05, 0x02, 0x01, 0x0f, 0x00,
+0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x70, 0x00, 0x06,
+0x00, 0x00, 0x02, 0x01, 0x00, 0x02, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01,
+0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x02,
+0x06, 0x00, 0x00, 0x00, 0x61, 0x70, 0x70, 0x65, 0x6e, 0x64, 0x00, 0x06,
+0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x0b, 0x03, 0x01,
+0x03, 0x01, 0x00, 0x05, 0x00, 0x01, 0x11, 0x00, 0x00, 0x00, 0x02, 0x04,
+0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x04,
+0x01, 0x05, 0x01, 0x04, 0x02, 0x03, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01,
+0x03, 0x02, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x04,
+0x00, 0x00, 0x00, 0x65, 0x71, 0x76, 0x3f, 0x00, 0x04, 0x00, 0x40, 0x02,
+0x02, 0x01, 0x00, 0x03, 0x02, 0x00, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01,
+0x01, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f,
+0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x01,
+0x02, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00,
+0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00,
+0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x33, 0x0c, 0x04, 0x03,
+0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00, 0x00,
 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06,
-0x00, 0x00, 0x04, 0x01, 0x05, 0x01, 0x04, 0x02, 0x23, 0x0e, 0x04, 0x03,
-0x00, 0x01, 0x01, 0x03, 0x03, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00,
-0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x64, 0x72, 0x00, 0x06, 0x00,
-0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x01, 0x02, 0x01, 0x00,
-0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00,
-0x63, 0x61, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
-0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00,
+0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x0b, 0x03, 0x01,
+0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04,
+0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02,
+0x01, 0x00, 0x04, 0x02, 0x13, 0x02, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03,
+0x01, 0x00, 0x05, 0x00, 0x01, 0x11, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00,
+0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01,
+0x05, 0x01, 0x04, 0x02, 0x04, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03,
+0x01, 0x00, 0x03, 0x02, 0x00, 0x08, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x03, 0x02, 0x00, 0x08, 0x00,
+0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,
+0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00,
+0x63, 0x61, 0x64, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
+0x02, 0x03, 0x02, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00,
+0x00, 0x00, 0x02, 0x0b, 0x00, 0x00, 0x00, 0x69, 0x64, 0x65, 0x6e, 0x74,
+0x69, 0x66, 0x69, 0x65, 0x72, 0x3f, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
+0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01,
+0x1c, 0x00, 0x00, 0x00, 0x02, 0x02, 0x00, 0x00, 0x00, 0x3d, 0x3e, 0x00,
+0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x10, 0x00, 0x04, 0x00, 0x40, 0x02,
+0x02, 0x01, 0x00, 0x03, 0x02, 0x00, 0x01, 0x02, 0x04, 0x00, 0x02, 0x01,
+0x0a, 0x01, 0x01, 0x01, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00,
+0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x61, 0x64, 0x72, 0x00, 0x06,
+0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x06, 0x02, 0x01, 0x02, 0x01,
+0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x0f, 0x00, 0x00,
+0x00, 0x6d, 0x61, 0x6b, 0x65, 0x2d, 0x69, 0x64, 0x65, 0x6e, 0x74, 0x69,
+0x66, 0x69, 0x65, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
+0x02, 0x00, 0x01, 0x04, 0x03, 0x18, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05,
+0x00, 0x01, 0x11, 0x00, 0x00, 0x00, 0x02, 0x0c, 0x00, 0x00, 0x00, 0x69,
+0x64, 0x65, 0x6e, 0x74, 0x69, 0x66, 0x69, 0x65, 0x72, 0x3d, 0x3f, 0x00,
+0x06, 0x00, 0x00, 0x04, 0x01, 0x05, 0x01, 0x04, 0x02, 0x02, 0x01, 0x04,
+0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x02, 0x02, 0x20, 0x00,
+0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x64, 0x72, 0x00, 0x02,
+0x03, 0x00, 0x00, 0x00, 0x63, 0x64, 0x72, 0x00, 0x04, 0x00, 0x00, 0x01,
+0x08, 0x00, 0x10, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
+0x03, 0x02, 0x01, 0x02, 0x06, 0x00, 0x01, 0x02, 0x01, 0x01, 0x04, 0x02,
+0x03, 0x02, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00,
 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x64, 0x72, 0x00, 0x06, 0x00,
-0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x02, 0x02, 0x01, 0x02, 0x01, 0x00,
-0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00,
-0x63, 0x64, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
-0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00,
-0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x61, 0x72, 0x00, 0x06, 0x00,
 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00,
 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00,
 0x63, 0x61, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
-0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00,
-0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x64, 0x72, 0x00, 0x06, 0x00,
-0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x06, 0x02, 0x01, 0x02, 0x01, 0x00,
-0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00,
-0x63, 0x64, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
-0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00,
-0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x61, 0x72, 0x00, 0x06, 0x00,
-0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00,
-0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00,
-0x63, 0x64, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
-0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00,
-0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x64, 0x72, 0x00, 0x06, 0x00,
-0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x0a, 0x02, 0x01, 0x02, 0x01, 0x00,
-0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00,
-0x63, 0x64, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
-0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00,
-0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x64, 0x72, 0x00, 0x06, 0x00,
-0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00,
-0x07, 0x01, 0x00, 0x19, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x01,
-0x0d, 0x01, 0x04, 0x02, 0x0b, 0x01, 0x04, 0x03, 0x07, 0x01, 0x04, 0x04,
-0x03, 0x01, 0x04, 0x05, 0x00, 0x01, 0x01, 0x05, 0x05, 0x00, 0x05, 0x01,
-0x02, 0x0f, 0x00, 0x00, 0x00, 0x02, 0x0f, 0x00, 0x00, 0x00, 0x6d, 0x61,
-0x6b, 0x65, 0x2d, 0x69, 0x64, 0x65, 0x6e, 0x74, 0x69, 0x66, 0x69, 0x65,
-0x72, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x6c, 0x6f, 0x6f, 0x70, 0x00,
-0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x03, 0x02, 0x01, 0x04, 0x03, 0x0e,
-0x03, 0x01, 0x03, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00,
-0x02, 0x00, 0x00, 0x04, 0x01, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01,
-0x02, 0x02, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03,
-0x00, 0x00, 0x00, 0x6c, 0x65, 0x74, 0x00, 0x04, 0x00, 0x37, 0x02, 0x02,
-0x01, 0x00, 0x03, 0x02, 0x00, 0x01, 0x02, 0x01, 0x00, 0x05, 0x02, 0x01,
-0x0f, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x70,
-0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x02, 0x02, 0x01, 0x04, 0x03,
-0x03, 0x02, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00,
+0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00, 0x00,
+0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06,
+0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x10, 0x02, 0x0b, 0x03, 0x01,
+0x03, 0x01, 0x00, 0x05, 0x00, 0x01, 0x11, 0x00, 0x00, 0x00, 0x02, 0x04,
+0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x04,
+0x01, 0x05, 0x01, 0x04, 0x02, 0x01, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01,
+0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x06,
+0x00, 0x00, 0x00, 0x61, 0x70, 0x70, 0x65, 0x6e, 0x64, 0x00, 0x06, 0x00,
+0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x0b, 0x03, 0x01, 0x03,
+0x01, 0x00, 0x05, 0x00, 0x01, 0x11, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00,
+0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01,
+0x03, 0x01, 0x04, 0x02, 0x31, 0x0b, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03,
+0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00,
+0x00, 0x00, 0x63, 0x64, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
+0x04, 0x02, 0x05, 0x02, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d,
+0x00, 0x00, 0x00, 0x04, 0x00, 0x07, 0x02, 0x02, 0x01, 0x00, 0x04, 0x02,
+0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00, 0x00,
 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06,
-0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x2a, 0x0b, 0x04, 0x03, 0x04,
-0x04, 0x01, 0x03, 0x01, 0x00, 0x05, 0x02, 0x01, 0x0f, 0x00, 0x00, 0x00,
-0x02, 0x03, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x70, 0x00, 0x06, 0x00, 0x00,
-0x02, 0x01, 0x00, 0x02, 0x02, 0x01, 0x04, 0x03, 0x05, 0x02, 0x01, 0x03,
+0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x0b, 0x03, 0x01,
+0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04,
+0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02,
+0x01, 0x00, 0x04, 0x02, 0x03, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03,
 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00,
 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
-0x00, 0x04, 0x02, 0x04, 0x02, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01,
+0x00, 0x04, 0x02, 0x05, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01,
+0x00, 0x05, 0x00, 0x01, 0x11, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00,
+0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x07,
+0x01, 0x04, 0x02, 0x33, 0x0e, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01,
 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00,
 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
 0x04, 0x02, 0x00, 0x01, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01,
-0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x06, 0x00, 0x00, 0x00, 0x61, 0x70,
-0x70, 0x65, 0x6e, 0x64, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
-0x02, 0x08, 0x05, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05,
-0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63,
-0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
-0x2f, 0x0b, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01,
-0x01, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f,
-0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00,
-0x01, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00,
-0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00,
-0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x06, 0x01, 0x04, 0x03,
-0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00,
-0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06,
-0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x0c, 0x03, 0x04, 0x03, 0x00,
-0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00,
-0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00,
-0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x33, 0x0e, 0x04, 0x03, 0x00, 0x01,
-0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x02,
-0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00,
-0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x0b, 0x03, 0x01, 0x03, 0x01,
-0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00,
-0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
-0x04, 0x02, 0x0b, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00,
-0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00,
-0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
-0x02, 0x0e, 0x02, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05,
-0x00, 0x01, 0x11, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63,
-0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x0f, 0x01, 0x04,
-0x02, 0x0e, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x02, 0x00, 0x04,
-0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63,
-0x64, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00,
-0x02, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00,
-0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x64, 0x72, 0x00, 0x06, 0x00, 0x00,
-0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x04,
-0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x05, 0x00, 0x00, 0x00, 0x6e,
-0x75, 0x6c, 0x6c, 0x3f, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
-0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x02, 0x21, 0x00,
-0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x61, 0x72, 0x00, 0x02,
-0x03, 0x00, 0x00, 0x00, 0x63, 0x64, 0x72, 0x00, 0x04, 0x00, 0x00, 0x01,
-0x08, 0x00, 0x11, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x03, 0x01, 0x04,
-0x02, 0x03, 0x02, 0x01, 0x02, 0x06, 0x00, 0x01, 0x02, 0x01, 0x00, 0x04,
-0x02, 0x03, 0x02, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00,
-0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x64, 0x72, 0x00, 0x06,
-0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01,
-0x00, 0x04, 0x00, 0x01, 0x0d, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00,
-0x00, 0x63, 0x61, 0x72, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x05, 0x01,
-0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x02, 0x00, 0x04, 0x01, 0x01, 0x0c,
-0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x61, 0x72, 0x00,
-0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x01, 0x02,
-0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00,
-0x00, 0x00, 0x63, 0x61, 0x64, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
-0x00, 0x04, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x01,
+0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f,
+0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x02,
+0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x00, 0x01,
+0x11, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e,
+0x73, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x07, 0x01, 0x04, 0x02, 0x06,
+0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x03, 0x00, 0x04, 0x01, 0x01,
+0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x64, 0x72,
+0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x01,
+0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03,
+0x00, 0x00, 0x00, 0x63, 0x61, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
+0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01,
+0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x64, 0x72,
+0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x02, 0x02, 0x01,
+0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03,
+0x00, 0x00, 0x00, 0x63, 0x64, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
+0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x00,
+0x11, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x01, 0x04, 0x01, 0x04,
+0x02, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x03, 0x00, 0x05,
+0x01, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x06, 0x00, 0x00, 0x00, 0x61,
+0x70, 0x70, 0x65, 0x6e, 0x64, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
+0x04, 0x02, 0x00, 0x03, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01,
+0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f,
+0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x20,
+0x0b, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01,
 0x0e, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e,
 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01,
-0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x00, 0x01, 0x11, 0x00, 0x00,
+0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00, 0x00,
 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06,
-0x00, 0x00, 0x04, 0x01, 0x03, 0x01, 0x04, 0x02, 0x02, 0x01, 0x04, 0x03,
-0x00, 0x01, 0x01, 0x03, 0x03, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00,
-0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x61, 0x64, 0x72, 0x00, 0x06,
+0x00, 0x00, 0x02, 0x01, 0x00, 0x0c, 0x02, 0x04, 0x03, 0x00, 0x01, 0x01,
+0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04,
+0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02,
+0x01, 0x00, 0x04, 0x02, 0x04, 0x02, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03,
+0x01, 0x00, 0x05, 0x00, 0x01, 0x11, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00,
+0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01,
+0x05, 0x01, 0x04, 0x02, 0x24, 0x0e, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03,
+0x03, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00,
+0x00, 0x00, 0x63, 0x64, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
+0x04, 0x02, 0x00, 0x02, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c,
+0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x61, 0x72, 0x00,
+0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02,
+0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00,
+0x00, 0x00, 0x63, 0x64, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
+0x04, 0x02, 0x02, 0x02, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c,
+0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x64, 0x72, 0x00,
+0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02,
+0x01, 0x00, 0x05, 0x01, 0x00, 0x11, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+0x04, 0x01, 0x04, 0x01, 0x04, 0x02, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01,
+0x01, 0x03, 0x03, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x02,
+0x06, 0x00, 0x00, 0x00, 0x61, 0x70, 0x70, 0x65, 0x6e, 0x64, 0x00, 0x06,
+0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x03, 0x0b, 0x03, 0x01,
+0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04,
+0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02,
+0x01, 0x00, 0x04, 0x02, 0x1f, 0x0b, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03,
+0x01, 0x00, 0x05, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00,
+0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
+0x00, 0x0c, 0x02, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01,
+0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e,
+0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x01, 0x01,
+0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10,
+0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73,
+0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x04, 0x02, 0x04,
+0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x00, 0x01, 0x11, 0x00,
+0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00,
+0x06, 0x00, 0x00, 0x04, 0x01, 0x05, 0x01, 0x04, 0x02, 0x23, 0x0e, 0x04,
+0x03, 0x00, 0x01, 0x01, 0x03, 0x03, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00,
+0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x64, 0x72, 0x00, 0x06,
 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x01, 0x02, 0x01,
-0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00,
-0x00, 0x63, 0x64, 0x64, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
-0x04, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x00, 0x11,
-0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x01, 0x02, 0x01, 0x04, 0x02,
-0x01, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x03, 0x00, 0x03, 0x02,
-0x00, 0x08, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x01, 0x01, 0x01,
-0x01, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x02, 0x00,
-0x00, 0x04, 0x01, 0x00, 0x01, 0x0a, 0x02, 0x01, 0x02, 0x02, 0x00, 0x04,
-0x01, 0x00, 0x15, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x05, 0x00, 0x00,
-0x02, 0x04, 0x00, 0x00, 0x02, 0x04, 0x01, 0x00, 0x01, 0x04, 0x02, 0x02,
-0x02, 0x01, 0x02, 0x02, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00,
-0x02, 0x0b, 0x00, 0x00, 0x00, 0x69, 0x64, 0x65, 0x6e, 0x74, 0x69, 0x66,
-0x69, 0x65, 0x72, 0x3f, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
-0x02, 0x00, 0x02, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x02, 0x25, 0x00,
-0x00, 0x00, 0x02, 0x0f, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x6b, 0x65, 0x2d,
-0x69, 0x64, 0x65, 0x6e, 0x74, 0x69, 0x66, 0x69, 0x65, 0x72, 0x00, 0x02,
-0x05, 0x00, 0x00, 0x00, 0x70, 0x61, 0x69, 0x72, 0x3f, 0x00, 0x04, 0x00,
-0x00, 0x01, 0x08, 0x00, 0x15, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x01,
-0x01, 0x04, 0x02, 0x01, 0x02, 0x04, 0x03, 0x07, 0x03, 0x01, 0x03, 0x06,
-0x00, 0x01, 0x02, 0x01, 0x00, 0x04, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01,
-0x00, 0x04, 0x01, 0x01, 0x1c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00,
-0x00, 0x63, 0x61, 0x72, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x10,
-0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x02, 0x02, 0x01,
-0x02, 0x04, 0x00, 0x02, 0x01, 0x0b, 0x01, 0x01, 0x01, 0x01, 0x00, 0x05,
-0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x0f, 0x00, 0x00, 0x00, 0x6d,
-0x61, 0x6b, 0x65, 0x2d, 0x69, 0x64, 0x65, 0x6e, 0x74, 0x69, 0x66, 0x69,
-0x65, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00,
-0x01, 0x04, 0x03, 0x09, 0x03, 0x01, 0x03, 0x01, 0x00, 0x04, 0x01, 0x01,
-0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x64, 0x72,
-0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x04, 0x02, 0x01,
-0x02, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x04, 0x00,
-0x06, 0x02, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01,
-0x00, 0x05, 0x00, 0x01, 0x11, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00,
-0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x06,
-0x01, 0x04, 0x02, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01,
-0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04,
-0x01, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x02, 0x00, 0x03,
+0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00,
+0x00, 0x63, 0x61, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
+0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00,
+0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x64, 0x72, 0x00, 0x06,
+0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x02, 0x02, 0x01, 0x02, 0x01,
+0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00,
+0x00, 0x63, 0x64, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
+0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00,
+0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x61, 0x72, 0x00, 0x06,
+0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01,
+0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00,
+0x00, 0x63, 0x61, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
+0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00,
+0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x64, 0x72, 0x00, 0x06,
+0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x06, 0x02, 0x01, 0x02, 0x01,
+0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00,
+0x00, 0x63, 0x64, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
+0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00,
+0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x61, 0x72, 0x00, 0x06,
+0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01,
+0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00,
+0x00, 0x63, 0x64, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
+0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00,
+0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x64, 0x72, 0x00, 0x06,
+0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x0a, 0x02, 0x01, 0x02, 0x01,
+0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00,
+0x00, 0x63, 0x64, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
+0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00,
+0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x64, 0x72, 0x00, 0x06,
+0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01,
+0x00, 0x07, 0x01, 0x00, 0x19, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04,
+0x01, 0x0d, 0x01, 0x04, 0x02, 0x0b, 0x01, 0x04, 0x03, 0x07, 0x01, 0x04,
+0x04, 0x03, 0x01, 0x04, 0x05, 0x00, 0x01, 0x01, 0x05, 0x05, 0x00, 0x05,
+0x01, 0x02, 0x0f, 0x00, 0x00, 0x00, 0x02, 0x0f, 0x00, 0x00, 0x00, 0x6d,
+0x61, 0x6b, 0x65, 0x2d, 0x69, 0x64, 0x65, 0x6e, 0x74, 0x69, 0x66, 0x69,
+0x65, 0x72, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x6c, 0x6f, 0x6f, 0x70,
+0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x03, 0x02, 0x01, 0x04, 0x03,
+0x0e, 0x03, 0x01, 0x03, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00,
+0x00, 0x02, 0x00, 0x00, 0x04, 0x01, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01,
+0x01, 0x02, 0x02, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02,
+0x03, 0x00, 0x00, 0x00, 0x6c, 0x65, 0x74, 0x00, 0x04, 0x00, 0x37, 0x02,
+0x02, 0x01, 0x00, 0x03, 0x02, 0x00, 0x01, 0x02, 0x01, 0x00, 0x05, 0x02,
+0x01, 0x0f, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x6d, 0x61,
+0x70, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x02, 0x02, 0x01, 0x04,
+0x03, 0x03, 0x02, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00,
+0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00,
+0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x2a, 0x0b, 0x04, 0x03,
+0x04, 0x04, 0x01, 0x03, 0x01, 0x00, 0x05, 0x02, 0x01, 0x0f, 0x00, 0x00,
+0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x70, 0x00, 0x06, 0x00,
+0x00, 0x02, 0x01, 0x00, 0x02, 0x02, 0x01, 0x04, 0x03, 0x05, 0x02, 0x01,
+0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04,
+0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02,
+0x01, 0x00, 0x04, 0x02, 0x04, 0x02, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03,
+0x01, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00,
+0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
+0x00, 0x04, 0x02, 0x00, 0x01, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05,
+0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x06, 0x00, 0x00, 0x00, 0x61,
+0x70, 0x70, 0x65, 0x6e, 0x64, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
+0x04, 0x02, 0x08, 0x05, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00,
+0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00,
+0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
+0x02, 0x2f, 0x0b, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05,
+0x01, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63,
+0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
+0x00, 0x01, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10,
+0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73,
+0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x06, 0x01, 0x04,
+0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00,
+0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00,
+0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x0c, 0x03, 0x04, 0x03,
+0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00,
+0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06,
+0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x33, 0x0e, 0x04, 0x03, 0x00,
+0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00, 0x00, 0x00,
+0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00,
+0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x0b, 0x03, 0x01, 0x03,
+0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00,
+0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
+0x00, 0x04, 0x02, 0x0b, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01,
+0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00,
+0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
+0x04, 0x02, 0x0e, 0x02, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00,
+0x05, 0x00, 0x01, 0x11, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00,
+0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x0f, 0x01,
+0x04, 0x02, 0x0e, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x02, 0x00,
+0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00,
+0x63, 0x64, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
+0x00, 0x02, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00,
+0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x64, 0x72, 0x00, 0x06, 0x00,
+0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00,
+0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x05, 0x00, 0x00, 0x00,
+0x6e, 0x75, 0x6c, 0x6c, 0x3f, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
+0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x02, 0x21,
+0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x61, 0x72, 0x00,
+0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x64, 0x72, 0x00, 0x04, 0x00, 0x00,
+0x01, 0x08, 0x00, 0x11, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x03, 0x01,
+0x04, 0x02, 0x03, 0x02, 0x01, 0x02, 0x06, 0x00, 0x01, 0x02, 0x01, 0x00,
+0x04, 0x02, 0x03, 0x02, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c,
+0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x64, 0x72, 0x00,
+0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02,
+0x01, 0x00, 0x04, 0x00, 0x01, 0x0d, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00,
+0x00, 0x00, 0x63, 0x61, 0x72, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x05,
+0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x02, 0x00, 0x04, 0x01, 0x01,
+0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x61, 0x72,
+0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x01,
+0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x04,
+0x00, 0x00, 0x00, 0x63, 0x61, 0x64, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02,
+0x01, 0x00, 0x04, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01,
+0x01, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f,
+0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00,
+0x01, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x00, 0x01, 0x11, 0x00,
+0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00,
+0x06, 0x00, 0x00, 0x04, 0x01, 0x03, 0x01, 0x04, 0x02, 0x02, 0x01, 0x04,
+0x03, 0x00, 0x01, 0x01, 0x03, 0x03, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00,
+0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x61, 0x64, 0x72, 0x00,
+0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x01, 0x02,
+0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00,
+0x00, 0x00, 0x63, 0x64, 0x64, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
+0x00, 0x04, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x00,
+0x11, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x01, 0x02, 0x01, 0x04,
+0x02, 0x01, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x03, 0x00, 0x03,
 0x02, 0x00, 0x08, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x01, 0x01,
 0x01, 0x01, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x02,
 0x00, 0x00, 0x04, 0x01, 0x00, 0x01, 0x0a, 0x02, 0x01, 0x02, 0x02, 0x00,
 0x04, 0x01, 0x00, 0x15, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x05, 0x00,
 0x00, 0x02, 0x04, 0x00, 0x00, 0x02, 0x04, 0x01, 0x00, 0x01, 0x04, 0x02,
-0x04, 0x02, 0x01, 0x02, 0x02, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00,
+0x02, 0x02, 0x01, 0x02, 0x02, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00,
 0x00, 0x02, 0x0b, 0x00, 0x00, 0x00, 0x69, 0x64, 0x65, 0x6e, 0x74, 0x69,
 0x66, 0x69, 0x65, 0x72, 0x3f, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
-0x04, 0x02, 0x00, 0x02, 0x01, 0x02, 0x01, 0x00, 0x05, 0x02, 0x02, 0x20,
-0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73,
-0x00, 0x02, 0x05, 0x00, 0x00, 0x00, 0x70, 0x61, 0x69, 0x72, 0x3f, 0x00,
-0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x10, 0x00, 0x06, 0x00, 0x00, 0x02,
-0x01, 0x00, 0x0c, 0x02, 0x0b, 0x03, 0x01, 0x03, 0x06, 0x00, 0x01, 0x02,
+0x04, 0x02, 0x00, 0x02, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x02, 0x25,
+0x00, 0x00, 0x00, 0x02, 0x0f, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x6b, 0x65,
+0x2d, 0x69, 0x64, 0x65, 0x6e, 0x74, 0x69, 0x66, 0x69, 0x65, 0x72, 0x00,
+0x02, 0x05, 0x00, 0x00, 0x00, 0x70, 0x61, 0x69, 0x72, 0x3f, 0x00, 0x04,
+0x00, 0x00, 0x01, 0x08, 0x00, 0x15, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01,
+0x01, 0x01, 0x04, 0x02, 0x01, 0x02, 0x04, 0x03, 0x07, 0x03, 0x01, 0x03,
+0x06, 0x00, 0x01, 0x02, 0x01, 0x00, 0x04, 0x02, 0x01, 0x02, 0x01, 0x02,
+0x01, 0x00, 0x04, 0x01, 0x01, 0x1c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00,
+0x00, 0x00, 0x63, 0x61, 0x72, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00,
+0x10, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x02, 0x02,
+0x01, 0x02, 0x04, 0x00, 0x02, 0x01, 0x0b, 0x01, 0x01, 0x01, 0x01, 0x00,
+0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x0f, 0x00, 0x00, 0x00,
+0x6d, 0x61, 0x6b, 0x65, 0x2d, 0x69, 0x64, 0x65, 0x6e, 0x74, 0x69, 0x66,
+0x69, 0x65, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
+0x00, 0x01, 0x04, 0x03, 0x09, 0x03, 0x01, 0x03, 0x01, 0x00, 0x04, 0x01,
+0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x64,
+0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x04, 0x02,
+0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x04,
+0x00, 0x06, 0x02, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02,
+0x01, 0x00, 0x05, 0x00, 0x01, 0x11, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00,
+0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01,
+0x06, 0x01, 0x04, 0x02, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03,
+0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+0x04, 0x01, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x02, 0x00,
+0x03, 0x02, 0x00, 0x08, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0b, 0x00, 0x00, 0x00,
+0x02, 0x00, 0x00, 0x04, 0x01, 0x00, 0x01, 0x0a, 0x02, 0x01, 0x02, 0x02,
+0x00, 0x04, 0x01, 0x00, 0x15, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x05,
+0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x02, 0x04, 0x01, 0x00, 0x01, 0x04,
+0x02, 0x04, 0x02, 0x01, 0x02, 0x02, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00,
+0x00, 0x00, 0x02, 0x0b, 0x00, 0x00, 0x00, 0x69, 0x64, 0x65, 0x6e, 0x74,
+0x69, 0x66, 0x69, 0x65, 0x72, 0x3f, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
+0x00, 0x04, 0x02, 0x00, 0x02, 0x01, 0x02, 0x01, 0x00, 0x05, 0x02, 0x02,
+0x20, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e,
+0x73, 0x00, 0x02, 0x05, 0x00, 0x00, 0x00, 0x70, 0x61, 0x69, 0x72, 0x3f,
+0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x10, 0x00, 0x06, 0x00, 0x00,
+0x02, 0x01, 0x00, 0x0c, 0x02, 0x0b, 0x03, 0x01, 0x03, 0x06, 0x00, 0x01,
+0x02, 0x01, 0x01, 0x04, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x00, 0x05,
+0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63,
+0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
+0x02, 0x02, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01,
+0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f,
+0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x22,
+0x09, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x00, 0x01,
+0x0f, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e,
+0x73, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x04, 0x01, 0x04, 0x02, 0x00,
+0x01, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x04, 0x01, 0x01, 0x1c, 0x00,
+0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x61, 0x72, 0x00, 0x04,
+0x00, 0x00, 0x01, 0x08, 0x00, 0x10, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
+0x00, 0x04, 0x02, 0x02, 0x02, 0x01, 0x02, 0x04, 0x00, 0x02, 0x01, 0x0b,
+0x01, 0x01, 0x01, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00,
+0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00,
+0x00, 0x02, 0x01, 0x00, 0x0c, 0x02, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00,
+0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00,
+0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
+0x02, 0x01, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05,
+0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63,
+0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
+0x24, 0x09, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x01,
+0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x64,
+0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x06, 0x02,
+0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x04,
+0x00, 0x08, 0x02, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02,
+0x01, 0x00, 0x05, 0x00, 0x01, 0x11, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00,
+0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01,
+0x08, 0x01, 0x04, 0x02, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03,
+0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00,
+0x00, 0x00, 0x63, 0x61, 0x6c, 0x6c, 0x2d, 0x77, 0x69, 0x74, 0x68, 0x2d,
+0x76, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x00, 0x04, 0x00, 0x2c, 0x02, 0x02,
+0x01, 0x00, 0x03, 0x02, 0x00, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x01,
+0x0e, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e,
+0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x0b, 0x02, 0x04, 0x03,
+0x04, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00,
+0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06,
+0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x1f, 0x0a, 0x04, 0x03, 0x00,
+0x01, 0x01, 0x03, 0x01, 0x00, 0x03, 0x02, 0x00, 0x08, 0x00, 0x00, 0x00,
+0x02, 0x00, 0x00, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x04, 0x01,
+0x00, 0x0b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x01, 0x00, 0x01,
+0x0a, 0x02, 0x01, 0x02, 0x02, 0x00, 0x05, 0x01, 0x00, 0x19, 0x00, 0x00,
+0x00, 0x02, 0x00, 0x00, 0x05, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x02,
+0x04, 0x01, 0x00, 0x01, 0x04, 0x02, 0x08, 0x02, 0x04, 0x03, 0x06, 0x02,
+0x01, 0x03, 0x03, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02,
+0x0b, 0x00, 0x00, 0x00, 0x69, 0x64, 0x65, 0x6e, 0x74, 0x69, 0x66, 0x69,
+0x65, 0x72, 0x3f, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
+0x00, 0x02, 0x01, 0x02, 0x01, 0x00, 0x05, 0x02, 0x02, 0x22, 0x00, 0x00,
+0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x02,
+0x05, 0x00, 0x00, 0x00, 0x70, 0x61, 0x69, 0x72, 0x3f, 0x00, 0x04, 0x00,
+0x00, 0x01, 0x08, 0x00, 0x12, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
+0x04, 0x02, 0x01, 0x03, 0x0b, 0x03, 0x01, 0x03, 0x06, 0x00, 0x01, 0x02,
 0x01, 0x01, 0x04, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01,
 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f,
 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x02,
 0x02, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01,
 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e,
-0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x22, 0x09,
+0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x26, 0x0d,
 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x00, 0x01, 0x0f,
 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73,
 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x04, 0x01, 0x04, 0x02, 0x00, 0x01,
@@ -1185,338 +1236,262 @@ static const unsigned char eval_rom[] = {
 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x61, 0x72, 0x00, 0x04, 0x00,
 0x00, 0x01, 0x08, 0x00, 0x10, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
 0x04, 0x02, 0x02, 0x02, 0x01, 0x02, 0x04, 0x00, 0x02, 0x01, 0x0b, 0x01,
-0x01, 0x01, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02,
+0x01, 0x01, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02,
+0x03, 0x00, 0x00, 0x00, 0x63, 0x61, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02,
+0x01, 0x00, 0x04, 0x02, 0x03, 0x03, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01,
+0x01, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f,
+0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00,
+0x01, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00,
+0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00,
+0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x02, 0x01, 0x04, 0x03,
+0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00,
+0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06,
+0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x29, 0x0d, 0x04, 0x03, 0x00,
+0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00,
+0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x64, 0x72, 0x00, 0x06, 0x00, 0x00,
+0x02, 0x01, 0x00, 0x04, 0x02, 0x07, 0x02, 0x01, 0x02, 0x01, 0x00, 0x04,
+0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63,
+0x64, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x08,
+0x03, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x00, 0x11, 0x00, 0x00, 0x00,
+0x04, 0x00, 0x0a, 0x02, 0x02, 0x01, 0x00, 0x04, 0x02, 0x01, 0x01, 0x04,
+0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x00, 0x01, 0x11, 0x00,
+0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00,
+0x06, 0x00, 0x00, 0x04, 0x01, 0x0a, 0x01, 0x04, 0x02, 0x03, 0x01, 0x04,
+0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00,
+0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00,
+0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x05, 0x02, 0x04, 0x03,
+0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00,
+0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06,
+0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x22, 0x0a, 0x04, 0x03, 0x00,
+0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00, 0x00, 0x00,
+0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00,
+0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x0b, 0x03, 0x01, 0x03,
+0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00,
+0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
+0x00, 0x04, 0x02, 0x04, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01,
+0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00,
+0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
+0x04, 0x02, 0x07, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00,
+0x05, 0x01, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00,
+0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
+0x02, 0x00, 0x01, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01,
+0x10, 0x00, 0x00, 0x00, 0x02, 0x06, 0x00, 0x00, 0x00, 0x61, 0x70, 0x70,
+0x65, 0x6e, 0x64, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
+0x0a, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x00,
+0x01, 0x11, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f,
+0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x0c, 0x01, 0x04, 0x02,
+0x28, 0x0b, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x03, 0x00, 0x04, 0x01,
+0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x61,
+0x64, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00,
+0x02, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00,
+0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x64, 0x64, 0x72, 0x00, 0x06, 0x00,
+0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x00,
+0x05, 0x01, 0x00, 0x11, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x01,
+0x02, 0x01, 0x04, 0x02, 0x01, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03,
+0x03, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x05, 0x00,
+0x00, 0x00, 0x6e, 0x75, 0x6c, 0x6c, 0x3f, 0x00, 0x06, 0x00, 0x00, 0x02,
+0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x01, 0x02, 0x01, 0x00, 0x04, 0x02,
+0x02, 0x20, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x6c, 0x65,
+0x74, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x61, 0x72, 0x00, 0x04,
+0x00, 0x00, 0x01, 0x08, 0x00, 0x10, 0x00, 0x04, 0x00, 0x29, 0x02, 0x02,
+0x01, 0x00, 0x03, 0x02, 0x00, 0x01, 0x02, 0x06, 0x00, 0x01, 0x02, 0x01,
+0x01, 0x04, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x01,
+0x0e, 0x00, 0x00, 0x00, 0x02, 0x06, 0x00, 0x00, 0x00, 0x61, 0x70, 0x70,
+0x65, 0x6e, 0x64, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
+0x02, 0x03, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0e,
+0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73,
+0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x0b, 0x02, 0x04, 0x03, 0x00,
+0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x00, 0x01, 0x11, 0x00, 0x00, 0x00,
+0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00,
+0x00, 0x04, 0x01, 0x04, 0x01, 0x04, 0x02, 0x02, 0x01, 0x04, 0x03, 0x00,
+0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00,
+0x02, 0x00, 0x00, 0x04, 0x01, 0x02, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01,
+0x02, 0x02, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x10,
+0x00, 0x00, 0x00, 0x63, 0x61, 0x6c, 0x6c, 0x2d, 0x77, 0x69, 0x74, 0x68,
+0x2d, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x00, 0x04, 0x00, 0x2b, 0x02,
+0x02, 0x01, 0x00, 0x03, 0x02, 0x00, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01,
+0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x64,
+0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x01, 0x02,
+0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x02,
 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00,
-0x02, 0x01, 0x00, 0x0c, 0x02, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05,
+0x02, 0x01, 0x00, 0x0b, 0x02, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01,
+0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00,
+0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
+0x04, 0x02, 0x1f, 0x0a, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00,
+0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x06, 0x00, 0x00, 0x00,
+0x6c, 0x61, 0x6d, 0x62, 0x64, 0x61, 0x00, 0x04, 0x00, 0x2f, 0x02, 0x02,
+0x01, 0x00, 0x03, 0x02, 0x00, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01,
+0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x61, 0x72,
+0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x05, 0x02, 0x01,
+0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x0b,
+0x00, 0x00, 0x00, 0x6c, 0x65, 0x74, 0x2a, 0x2d, 0x76, 0x61, 0x6c, 0x75,
+0x65, 0x73, 0x00, 0x04, 0x00, 0x31, 0x02, 0x02, 0x01, 0x00, 0x03, 0x02,
+0x00, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00,
+0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x64, 0x72, 0x00, 0x06, 0x00, 0x00,
+0x02, 0x01, 0x00, 0x04, 0x02, 0x0a, 0x02, 0x01, 0x02, 0x01, 0x00, 0x05,
 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63,
 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
-0x01, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01,
+0x00, 0x01, 0x04, 0x03, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01,
 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f,
-0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x24,
-0x09, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x01, 0x01,
-0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x64, 0x72,
-0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x06, 0x02, 0x01,
-0x02, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x04, 0x00,
-0x08, 0x02, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01,
-0x00, 0x05, 0x00, 0x01, 0x11, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00,
-0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x08,
-0x01, 0x04, 0x02, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01,
-0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x00,
-0x00, 0x63, 0x61, 0x6c, 0x6c, 0x2d, 0x77, 0x69, 0x74, 0x68, 0x2d, 0x76,
-0x61, 0x6c, 0x75, 0x65, 0x73, 0x00, 0x04, 0x00, 0x2c, 0x02, 0x02, 0x01,
-0x00, 0x03, 0x02, 0x00, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0e,
-0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73,
-0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x0b, 0x02, 0x04, 0x03, 0x04,
-0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00,
-0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00,
-0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x1f, 0x0a, 0x04, 0x03, 0x00, 0x01,
-0x01, 0x03, 0x01, 0x00, 0x03, 0x02, 0x00, 0x08, 0x00, 0x00, 0x00, 0x02,
-0x00, 0x00, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x04, 0x01, 0x00,
-0x0b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x01, 0x00, 0x01, 0x0a,
-0x02, 0x01, 0x02, 0x02, 0x00, 0x05, 0x01, 0x00, 0x19, 0x00, 0x00, 0x00,
-0x02, 0x00, 0x00, 0x05, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x02, 0x04,
-0x01, 0x00, 0x01, 0x04, 0x02, 0x08, 0x02, 0x04, 0x03, 0x06, 0x02, 0x01,
-0x03, 0x03, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x0b,
-0x00, 0x00, 0x00, 0x69, 0x64, 0x65, 0x6e, 0x74, 0x69, 0x66, 0x69, 0x65,
-0x72, 0x3f, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00,
-0x02, 0x01, 0x02, 0x01, 0x00, 0x05, 0x02, 0x02, 0x22, 0x00, 0x00, 0x00,
-0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x02, 0x05,
-0x00, 0x00, 0x00, 0x70, 0x61, 0x69, 0x72, 0x3f, 0x00, 0x04, 0x00, 0x00,
-0x01, 0x08, 0x00, 0x12, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
-0x02, 0x01, 0x03, 0x0b, 0x03, 0x01, 0x03, 0x06, 0x00, 0x01, 0x02, 0x01,
-0x01, 0x04, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x01,
-0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e,
-0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x02, 0x02,
-0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10,
-0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73,
-0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x26, 0x0d, 0x04,
-0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x00, 0x01, 0x0f, 0x00,
-0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00,
-0x06, 0x00, 0x00, 0x04, 0x01, 0x04, 0x01, 0x04, 0x02, 0x00, 0x01, 0x0b,
-0x03, 0x01, 0x03, 0x01, 0x00, 0x04, 0x01, 0x01, 0x1c, 0x00, 0x00, 0x00,
-0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x61, 0x72, 0x00, 0x04, 0x00, 0x00,
-0x01, 0x08, 0x00, 0x10, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
-0x02, 0x02, 0x02, 0x01, 0x02, 0x04, 0x00, 0x02, 0x01, 0x0b, 0x01, 0x01,
-0x01, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03,
-0x00, 0x00, 0x00, 0x63, 0x61, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
-0x00, 0x04, 0x02, 0x03, 0x03, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x01,
+0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x02,
+0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01,
 0x0e, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e,
 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01,
 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00,
 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06,
-0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x02, 0x01, 0x04, 0x03, 0x00,
-0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00,
-0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00,
-0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x29, 0x0d, 0x04, 0x03, 0x00, 0x01,
-0x01, 0x03, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02,
-0x03, 0x00, 0x00, 0x00, 0x63, 0x64, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02,
-0x01, 0x00, 0x04, 0x02, 0x07, 0x02, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01,
-0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x64,
-0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x08, 0x03,
-0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x00, 0x11, 0x00, 0x00, 0x00, 0x04,
-0x00, 0x0a, 0x02, 0x02, 0x01, 0x00, 0x04, 0x02, 0x01, 0x01, 0x04, 0x03,
-0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x00, 0x01, 0x11, 0x00, 0x00,
-0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06,
-0x00, 0x00, 0x04, 0x01, 0x0a, 0x01, 0x04, 0x02, 0x03, 0x01, 0x04, 0x03,
-0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00,
-0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06,
-0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x05, 0x02, 0x04, 0x03, 0x00,
+0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x05, 0x01, 0x04, 0x03, 0x00,
 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00,
 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00,
-0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x22, 0x0a, 0x04, 0x03, 0x00, 0x01,
+0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x07, 0x01, 0x04, 0x03, 0x00, 0x01,
 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x02,
 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00,
 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x0b, 0x03, 0x01, 0x03, 0x01,
 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00,
 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
-0x04, 0x02, 0x04, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00,
-0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00,
-0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
-0x02, 0x07, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05,
-0x01, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63,
-0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
-0x00, 0x01, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10,
-0x00, 0x00, 0x00, 0x02, 0x06, 0x00, 0x00, 0x00, 0x61, 0x70, 0x70, 0x65,
-0x6e, 0x64, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x0a,
-0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x00, 0x01,
-0x11, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e,
-0x73, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x0c, 0x01, 0x04, 0x02, 0x28,
-0x0b, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x03, 0x00, 0x04, 0x01, 0x01,
-0x0c, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x61, 0x64,
-0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02,
-0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02,
-0x04, 0x00, 0x00, 0x00, 0x63, 0x64, 0x64, 0x72, 0x00, 0x06, 0x00, 0x00,
-0x02, 0x01, 0x00, 0x04, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x00, 0x05,
-0x01, 0x00, 0x11, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x01, 0x02,
-0x01, 0x04, 0x02, 0x01, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x03,
-0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x05, 0x00, 0x00,
-0x00, 0x6e, 0x75, 0x6c, 0x6c, 0x3f, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
-0x00, 0x04, 0x02, 0x00, 0x02, 0x01, 0x02, 0x01, 0x00, 0x04, 0x02, 0x02,
-0x20, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x6c, 0x65, 0x74,
-0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x61, 0x72, 0x00, 0x04, 0x00,
-0x00, 0x01, 0x08, 0x00, 0x10, 0x00, 0x04, 0x00, 0x29, 0x02, 0x02, 0x01,
-0x00, 0x03, 0x02, 0x00, 0x01, 0x02, 0x06, 0x00, 0x01, 0x02, 0x01, 0x01,
+0x04, 0x02, 0x0a, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00,
+0x05, 0x00, 0x01, 0x11, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00,
+0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x0f, 0x01,
+0x04, 0x02, 0x0e, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x03, 0x00,
+0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x0b, 0x00, 0x00, 0x00,
+0x6c, 0x65, 0x74, 0x2a, 0x2d, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x00,
+0x04, 0x00, 0x24, 0x02, 0x02, 0x01, 0x00, 0x03, 0x02, 0x00, 0x01, 0x02,
+0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00,
+0x00, 0x00, 0x63, 0x64, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
 0x04, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0e,
 0x00, 0x00, 0x00, 0x02, 0x06, 0x00, 0x00, 0x00, 0x61, 0x70, 0x70, 0x65,
-0x6e, 0x64, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x02,
-0x03, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00,
+0x6e, 0x64, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00,
+0x01, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x00, 0x01, 0x11, 0x00,
 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00,
-0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x0b, 0x02, 0x04, 0x03, 0x00, 0x01,
-0x01, 0x03, 0x01, 0x00, 0x05, 0x00, 0x01, 0x11, 0x00, 0x00, 0x00, 0x02,
-0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00,
-0x04, 0x01, 0x04, 0x01, 0x04, 0x02, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01,
-0x01, 0x03, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x02,
-0x00, 0x00, 0x04, 0x01, 0x02, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02,
-0x02, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00,
-0x00, 0x00, 0x63, 0x61, 0x6c, 0x6c, 0x2d, 0x77, 0x69, 0x74, 0x68, 0x2d,
-0x76, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x00, 0x04, 0x00, 0x2b, 0x02, 0x02,
-0x01, 0x00, 0x03, 0x02, 0x00, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01,
-0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x64, 0x72,
-0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x01, 0x02, 0x01,
-0x02, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x04,
-0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02,
-0x01, 0x00, 0x0b, 0x02, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00,
-0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00,
-0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
-0x02, 0x1f, 0x0a, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04,
-0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x06, 0x00, 0x00, 0x00, 0x6c,
-0x61, 0x6d, 0x62, 0x64, 0x61, 0x00, 0x04, 0x00, 0x2f, 0x02, 0x02, 0x01,
-0x00, 0x03, 0x02, 0x00, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c,
-0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x61, 0x72, 0x00,
-0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x05, 0x02, 0x01, 0x02,
-0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x0b, 0x00,
-0x00, 0x00, 0x6c, 0x65, 0x74, 0x2a, 0x2d, 0x76, 0x61, 0x6c, 0x75, 0x65,
-0x73, 0x00, 0x04, 0x00, 0x31, 0x02, 0x02, 0x01, 0x00, 0x03, 0x02, 0x00,
-0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02,
-0x03, 0x00, 0x00, 0x00, 0x63, 0x64, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02,
-0x01, 0x00, 0x04, 0x02, 0x0a, 0x02, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01,
-0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f,
-0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00,
-0x01, 0x04, 0x03, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01,
-0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e,
-0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x02, 0x01,
-0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0e,
-0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73,
-0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x0b,
-0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00,
-0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00,
-0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x05, 0x01, 0x04, 0x03, 0x00, 0x01,
-0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02,
-0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00,
-0x02, 0x01, 0x00, 0x04, 0x02, 0x07, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01,
-0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x04,
-0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02,
-0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00,
-0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00,
-0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
-0x02, 0x0a, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05,
-0x00, 0x01, 0x11, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63,
-0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x0f, 0x01, 0x04,
-0x02, 0x0e, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x03, 0x00, 0x04,
-0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x0b, 0x00, 0x00, 0x00, 0x6c,
-0x65, 0x74, 0x2a, 0x2d, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x00, 0x04,
-0x00, 0x24, 0x02, 0x02, 0x01, 0x00, 0x03, 0x02, 0x00, 0x01, 0x02, 0x01,
+0x06, 0x00, 0x00, 0x04, 0x01, 0x03, 0x01, 0x04, 0x02, 0x02, 0x01, 0x04,
+0x03, 0x00, 0x01, 0x01, 0x03, 0x03, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00,
+0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x64, 0x72, 0x00, 0x06,
+0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x01, 0x02, 0x01,
+0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00,
+0x00, 0x63, 0x61, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
+0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00,
+0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x64, 0x72, 0x00, 0x06,
+0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x02, 0x02, 0x01, 0x02, 0x01,
 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00,
 0x00, 0x63, 0x64, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
-0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00,
-0x00, 0x00, 0x02, 0x06, 0x00, 0x00, 0x00, 0x61, 0x70, 0x70, 0x65, 0x6e,
-0x64, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01,
-0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x00, 0x01, 0x11, 0x00, 0x00,
-0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06,
-0x00, 0x00, 0x04, 0x01, 0x03, 0x01, 0x04, 0x02, 0x02, 0x01, 0x04, 0x03,
-0x00, 0x01, 0x01, 0x03, 0x03, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00,
-0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x64, 0x72, 0x00, 0x06, 0x00,
-0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x01, 0x02, 0x01, 0x00,
-0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00,
-0x63, 0x61, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
-0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00,
-0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x64, 0x72, 0x00, 0x06, 0x00,
-0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x02, 0x02, 0x01, 0x02, 0x01, 0x00,
-0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00,
-0x63, 0x64, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
-0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x00, 0x11, 0x00, 0x00,
-0x00, 0x02, 0x00, 0x00, 0x04, 0x01, 0x04, 0x01, 0x04, 0x02, 0x02, 0x01,
-0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x03, 0x00, 0x05, 0x01, 0x02, 0x0f,
-0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x70, 0x00,
-0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x61, 0x72, 0x00, 0x06, 0x00, 0x00,
-0x02, 0x01, 0x00, 0x06, 0x02, 0x01, 0x04, 0x03, 0x00, 0x02, 0x01, 0x03,
-0x01, 0x00, 0x05, 0x02, 0x01, 0x0f, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00,
-0x00, 0x00, 0x6d, 0x61, 0x70, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
-0x02, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05,
-0x02, 0x01, 0x0f, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x6d,
-0x61, 0x70, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x02, 0x02, 0x01,
-0x04, 0x03, 0x02, 0x02, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x00, 0x11,
-0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x01, 0x03, 0x01, 0x04, 0x02,
-0x01, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x03, 0x00, 0x04, 0x01,
-0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x6c, 0x65,
-0x74, 0x00, 0x04, 0x00, 0x2c, 0x02, 0x02, 0x01, 0x00, 0x03, 0x02, 0x00,
-0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x02,
-0x06, 0x00, 0x00, 0x00, 0x61, 0x70, 0x70, 0x65, 0x6e, 0x64, 0x00, 0x06,
-0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x05, 0x03, 0x0b, 0x03, 0x01,
-0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x06,
-0x00, 0x00, 0x00, 0x61, 0x70, 0x70, 0x65, 0x6e, 0x64, 0x00, 0x06, 0x00,
-0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x02, 0x03, 0x04, 0x03, 0x00, 0x01,
+0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x00, 0x11, 0x00,
+0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x01, 0x04, 0x01, 0x04, 0x02, 0x02,
+0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x03, 0x00, 0x05, 0x01, 0x02,
+0x0f, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x70,
+0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x61, 0x72, 0x00, 0x06, 0x00,
+0x00, 0x02, 0x01, 0x00, 0x06, 0x02, 0x01, 0x04, 0x03, 0x00, 0x02, 0x01,
+0x03, 0x01, 0x00, 0x05, 0x02, 0x01, 0x0f, 0x00, 0x00, 0x00, 0x02, 0x03,
+0x00, 0x00, 0x00, 0x6d, 0x61, 0x70, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
+0x00, 0x02, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00,
+0x05, 0x02, 0x01, 0x0f, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00,
+0x6d, 0x61, 0x70, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x02, 0x02,
+0x01, 0x04, 0x03, 0x02, 0x02, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x00,
+0x11, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x01, 0x03, 0x01, 0x04,
+0x02, 0x01, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x03, 0x00, 0x04,
+0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x6c,
+0x65, 0x74, 0x00, 0x04, 0x00, 0x2c, 0x02, 0x02, 0x01, 0x00, 0x03, 0x02,
+0x00, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00, 0x00, 0x00,
+0x02, 0x06, 0x00, 0x00, 0x00, 0x61, 0x70, 0x70, 0x65, 0x6e, 0x64, 0x00,
+0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x05, 0x03, 0x0b, 0x03,
 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02,
-0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00,
-0x02, 0x01, 0x00, 0x04, 0x02, 0x03, 0x02, 0x04, 0x03, 0x00, 0x01, 0x01,
-0x03, 0x01, 0x00, 0x05, 0x00, 0x01, 0x11, 0x00, 0x00, 0x00, 0x02, 0x04,
-0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x04,
-0x01, 0x04, 0x01, 0x04, 0x02, 0x03, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01,
-0x03, 0x02, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x04,
-0x00, 0x00, 0x00, 0x73, 0x65, 0x74, 0x21, 0x00, 0x04, 0x00, 0x2b, 0x02,
-0x02, 0x01, 0x00, 0x03, 0x02, 0x00, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01,
-0x01, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x06, 0x00, 0x00, 0x00, 0x61, 0x70,
-0x70, 0x65, 0x6e, 0x64, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
-0x02, 0x01, 0x02, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x00, 0x01,
-0x11, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e,
-0x73, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x02, 0x01, 0x04, 0x02, 0x01,
-0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x02, 0x00, 0x05, 0x01, 0x01,
-0x0c, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e,
-0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x0c, 0x02, 0x0b, 0x03,
+0x06, 0x00, 0x00, 0x00, 0x61, 0x70, 0x70, 0x65, 0x6e, 0x64, 0x00, 0x06,
+0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x02, 0x03, 0x04, 0x03, 0x00,
+0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00,
+0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00,
+0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x03, 0x02, 0x04, 0x03, 0x00, 0x01,
 0x01, 0x03, 0x01, 0x00, 0x05, 0x00, 0x01, 0x11, 0x00, 0x00, 0x00, 0x02,
 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00,
-0x04, 0x01, 0x01, 0x01, 0x04, 0x02, 0x01, 0x02, 0x04, 0x03, 0x00, 0x01,
-0x01, 0x03, 0x03, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02,
-0x07, 0x00, 0x00, 0x00, 0x6c, 0x65, 0x74, 0x72, 0x65, 0x63, 0x2a, 0x00,
-0x04, 0x00, 0x22, 0x02, 0x02, 0x01, 0x00, 0x03, 0x02, 0x00, 0x01, 0x02,
-0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00,
-0x00, 0x00, 0x63, 0x64, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
-0x04, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x00, 0x05, 0x00, 0x01, 0x11,
-0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73,
-0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x02, 0x01, 0x04, 0x02, 0x01, 0x01,
-0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x03, 0x00, 0x04, 0x01, 0x01, 0x0c,
-0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x64, 0x72, 0x00,
-0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x01, 0x02,
-0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00,
-0x00, 0x00, 0x63, 0x61, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
-0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c,
-0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x64, 0x72, 0x00,
-0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x02, 0x02, 0x01, 0x02,
-0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00,
-0x00, 0x00, 0x63, 0x64, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
-0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x00, 0x11,
-0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x01, 0x04, 0x01, 0x04, 0x02,
-0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x03, 0x00, 0x04, 0x01,
-0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x05, 0x00, 0x00, 0x00, 0x6e, 0x75,
-0x6c, 0x6c, 0x3f, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
-0x00, 0x02, 0x01, 0x02, 0x01, 0x00, 0x04, 0x02, 0x02, 0x20, 0x00, 0x00,
-0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x6c, 0x65, 0x74, 0x00, 0x02, 0x03,
-0x00, 0x00, 0x00, 0x6c, 0x65, 0x74, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08,
-0x00, 0x10, 0x00, 0x04, 0x00, 0x27, 0x02, 0x02, 0x01, 0x00, 0x03, 0x02,
-0x00, 0x01, 0x02, 0x04, 0x00, 0x27, 0x02, 0x02, 0x01, 0x01, 0x03, 0x02,
-0x01, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00, 0x00, 0x00,
+0x04, 0x01, 0x04, 0x01, 0x04, 0x02, 0x03, 0x01, 0x04, 0x03, 0x00, 0x01,
+0x01, 0x03, 0x02, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02,
+0x04, 0x00, 0x00, 0x00, 0x73, 0x65, 0x74, 0x21, 0x00, 0x04, 0x00, 0x2b,
+0x02, 0x02, 0x01, 0x00, 0x03, 0x02, 0x00, 0x01, 0x02, 0x01, 0x00, 0x05,
+0x01, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x06, 0x00, 0x00, 0x00, 0x61,
+0x70, 0x70, 0x65, 0x6e, 0x64, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
+0x04, 0x02, 0x01, 0x02, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x00,
+0x01, 0x11, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f,
+0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x02, 0x01, 0x04, 0x02,
+0x01, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x02, 0x00, 0x05, 0x01,
+0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f,
+0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x0c, 0x02, 0x0b,
+0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x00, 0x01, 0x11, 0x00, 0x00, 0x00,
 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00,
-0x00, 0x02, 0x01, 0x00, 0x0b, 0x02, 0x04, 0x03, 0x02, 0x03, 0x01, 0x03,
-0x01, 0x00, 0x05, 0x00, 0x01, 0x11, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00,
-0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01,
-0x03, 0x01, 0x04, 0x02, 0x01, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03,
-0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00,
-0x00, 0x00, 0x63, 0x61, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
-0x04, 0x02, 0x02, 0x02, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c,
-0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x61, 0x72, 0x00,
-0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02,
-0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00,
-0x00, 0x00, 0x63, 0x61, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
-0x04, 0x02, 0x04, 0x02, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c,
-0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x64, 0x72, 0x00,
-0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02,
-0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00,
+0x00, 0x04, 0x01, 0x01, 0x01, 0x04, 0x02, 0x01, 0x02, 0x04, 0x03, 0x00,
+0x01, 0x01, 0x03, 0x03, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00,
+0x02, 0x07, 0x00, 0x00, 0x00, 0x6c, 0x65, 0x74, 0x72, 0x65, 0x63, 0x2a,
+0x00, 0x04, 0x00, 0x22, 0x02, 0x02, 0x01, 0x00, 0x03, 0x02, 0x00, 0x01,
+0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03,
+0x00, 0x00, 0x00, 0x63, 0x64, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
+0x00, 0x04, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x00, 0x05, 0x00, 0x01,
+0x11, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e,
+0x73, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x02, 0x01, 0x04, 0x02, 0x01,
+0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x03, 0x00, 0x04, 0x01, 0x01,
+0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x64, 0x72,
+0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x01,
+0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03,
+0x00, 0x00, 0x00, 0x63, 0x61, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
+0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01,
+0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x64, 0x72,
+0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x02, 0x02, 0x01,
+0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03,
+0x00, 0x00, 0x00, 0x63, 0x64, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
+0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x00,
+0x11, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x01, 0x04, 0x01, 0x04,
+0x02, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x03, 0x00, 0x04,
+0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x05, 0x00, 0x00, 0x00, 0x6e,
+0x75, 0x6c, 0x6c, 0x3f, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
+0x02, 0x00, 0x02, 0x01, 0x02, 0x01, 0x00, 0x04, 0x02, 0x02, 0x20, 0x00,
+0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x6c, 0x65, 0x74, 0x00, 0x02,
+0x03, 0x00, 0x00, 0x00, 0x6c, 0x65, 0x74, 0x00, 0x04, 0x00, 0x00, 0x01,
+0x08, 0x00, 0x10, 0x00, 0x04, 0x00, 0x27, 0x02, 0x02, 0x01, 0x00, 0x03,
+0x02, 0x00, 0x01, 0x02, 0x04, 0x00, 0x27, 0x02, 0x02, 0x01, 0x01, 0x03,
+0x02, 0x01, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00, 0x00,
+0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06,
+0x00, 0x00, 0x02, 0x01, 0x00, 0x0b, 0x02, 0x04, 0x03, 0x02, 0x03, 0x01,
+0x03, 0x01, 0x00, 0x05, 0x00, 0x01, 0x11, 0x00, 0x00, 0x00, 0x02, 0x04,
+0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x04,
+0x01, 0x03, 0x01, 0x04, 0x02, 0x01, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01,
+0x03, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03,
+0x00, 0x00, 0x00, 0x63, 0x61, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
+0x00, 0x04, 0x02, 0x02, 0x02, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01,
+0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x61, 0x72,
+0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01,
+0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03,
+0x00, 0x00, 0x00, 0x63, 0x61, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
+0x00, 0x04, 0x02, 0x04, 0x02, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01,
+0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x64, 0x72,
+0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01,
+0x02, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04,
+0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02,
+0x01, 0x00, 0x04, 0x02, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03,
+0x01, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00,
 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
-0x00, 0x04, 0x02, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01,
-0x00, 0x05, 0x01, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00,
-0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
-0x04, 0x02, 0x00, 0x01, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x04, 0x01,
-0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x6c, 0x65,
-0x74, 0x2a, 0x00, 0x04, 0x00, 0x2e, 0x02, 0x02, 0x01, 0x00, 0x03, 0x02,
-0x00, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00,
-0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x64, 0x72, 0x00, 0x06, 0x00, 0x00,
-0x02, 0x01, 0x00, 0x04, 0x02, 0x09, 0x02, 0x01, 0x02, 0x01, 0x00, 0x05,
+0x00, 0x04, 0x02, 0x00, 0x01, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x04,
+0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x6c,
+0x65, 0x74, 0x2a, 0x00, 0x04, 0x00, 0x2e, 0x02, 0x02, 0x01, 0x00, 0x03,
+0x02, 0x00, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00,
+0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x64, 0x72, 0x00, 0x06, 0x00,
+0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x09, 0x02, 0x01, 0x02, 0x01, 0x00,
+0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00,
+0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
+0x02, 0x00, 0x01, 0x04, 0x03, 0x0a, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05,
 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63,
 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
-0x00, 0x01, 0x04, 0x03, 0x0a, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01,
-0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f,
-0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x02,
-0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01,
-0x0e, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e,
-0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01,
-0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00,
+0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01,
+0x01, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f,
+0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00,
+0x01, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00,
+0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00,
+0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x05, 0x01, 0x04, 0x03,
+0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x00, 0x01, 0x11, 0x00, 0x00,
 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06,
-0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x05, 0x01, 0x04, 0x03, 0x00,
-0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x00, 0x01, 0x11, 0x00, 0x00, 0x00,
-0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00,
-0x00, 0x04, 0x01, 0x0e, 0x01, 0x04, 0x02, 0x0c, 0x01, 0x04, 0x03, 0x00,
-0x01, 0x01, 0x03, 0x03, 0x00, 0x07, 0x01, 0x00, 0x11, 0x00, 0x00, 0x00,
-0x02, 0x00, 0x00, 0x04, 0x01, 0x00, 0x01, 0x0a, 0x02, 0x0a, 0x03, 0x0a,
-0x04, 0x0a, 0x05, 0x01, 0x05, 0x05, 0x00, 0x04, 0x05, 0x01, 0x28, 0x00,
-0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x61, 0x64, 0x72, 0x00,
-0x02, 0x00, 0x00, 0x05, 0x00, 0x00, 0x05, 0x02, 0x00, 0x01, 0x05, 0x00,
-0x00, 0x04, 0x02, 0x00, 0x02, 0x05, 0x00, 0x00, 0x03, 0x02, 0x00, 0x03,
-0x05, 0x00, 0x00, 0x02, 0x06, 0x00, 0x00, 0x02, 0x01, 0x04, 0x04, 0x02,
-0x01, 0x02, 0x01, 0x02, 0x02, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00,
-0x00, 0x02, 0x05, 0x00, 0x00, 0x00, 0x70, 0x61, 0x69, 0x72, 0x3f, 0x00,
-0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x01, 0x02,
-0x01, 0x00, 0x04, 0x01, 0x01, 0x1c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00,
-0x00, 0x00, 0x63, 0x61, 0x72, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00,
-0x10, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x01, 0x02,
-0x01, 0x02, 0x04, 0x00, 0x01, 0x01, 0x0a, 0x01, 0x01, 0x01, 0x01, 0x00,
-0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x0b, 0x00, 0x00, 0x00,
-0x69, 0x64, 0x65, 0x6e, 0x74, 0x69, 0x66, 0x69, 0x65, 0x72, 0x3f, 0x00,
-0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02,
-0x01, 0x00, 0x04, 0x01, 0x01, 0x1c, 0x00, 0x00, 0x00, 0x02, 0x0a, 0x00,
-0x00, 0x00, 0x71, 0x75, 0x61, 0x73, 0x69, 0x71, 0x75, 0x6f, 0x74, 0x65,
-0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x10, 0x00, 0x04, 0x00, 0x25,
-0x02, 0x02, 0x01, 0x00, 0x03, 0x02, 0x00, 0x01, 0x02, 0x04, 0x00, 0x03,
-0x01, 0x0a, 0x01, 0x01, 0x01, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00,
-0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x61, 0x72, 0x00, 0x06,
-0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x04, 0x02, 0x01, 0x02, 0x01,
-0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x0f, 0x00, 0x00,
-0x00, 0x6d, 0x61, 0x6b, 0x65, 0x2d, 0x69, 0x64, 0x65, 0x6e, 0x74, 0x69,
-0x66, 0x69, 0x65, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
-0x02, 0x00, 0x01, 0x04, 0x03, 0x07, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05,
-0x00, 0x01, 0x11, 0x00, 0x00, 0x00, 0x02, 0x0c, 0x00, 0x00, 0x00, 0x69,
-0x64, 0x65, 0x6e, 0x74, 0x69, 0x66, 0x69, 0x65, 0x72, 0x3d, 0x3f, 0x00,
-0x06, 0x00, 0x00, 0x04, 0x01, 0x06, 0x01, 0x04, 0x02, 0x02, 0x01, 0x04,
-0x03, 0x00, 0x01, 0x01, 0x03, 0x02, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00,
+0x00, 0x00, 0x04, 0x01, 0x0e, 0x01, 0x04, 0x02, 0x0c, 0x01, 0x04, 0x03,
+0x00, 0x01, 0x01, 0x03, 0x03, 0x00, 0x07, 0x01, 0x00, 0x11, 0x00, 0x00,
+0x00, 0x02, 0x00, 0x00, 0x04, 0x01, 0x00, 0x01, 0x0a, 0x02, 0x0a, 0x03,
+0x0a, 0x04, 0x0a, 0x05, 0x01, 0x05, 0x05, 0x00, 0x04, 0x05, 0x01, 0x28,
+0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x61, 0x64, 0x72,
+0x00, 0x02, 0x00, 0x00, 0x05, 0x00, 0x00, 0x05, 0x02, 0x00, 0x01, 0x05,
+0x00, 0x00, 0x04, 0x02, 0x00, 0x02, 0x05, 0x00, 0x00, 0x03, 0x02, 0x00,
+0x03, 0x05, 0x00, 0x00, 0x02, 0x06, 0x00, 0x00, 0x02, 0x01, 0x04, 0x04,
+0x02, 0x01, 0x02, 0x01, 0x02, 0x02, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00,
 0x00, 0x00, 0x02, 0x05, 0x00, 0x00, 0x00, 0x70, 0x61, 0x69, 0x72, 0x3f,
 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x01,
 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x1c, 0x00, 0x00, 0x00, 0x02, 0x03,
@@ -1526,976 +1501,1039 @@ static const unsigned char eval_rom[] = {
 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x0b, 0x00, 0x00,
 0x00, 0x69, 0x64, 0x65, 0x6e, 0x74, 0x69, 0x66, 0x69, 0x65, 0x72, 0x3f,
 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01,
-0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x1c, 0x00, 0x00, 0x00, 0x02, 0x07,
-0x00, 0x00, 0x00, 0x75, 0x6e, 0x71, 0x75, 0x6f, 0x74, 0x65, 0x00, 0x04,
-0x00, 0x00, 0x01, 0x08, 0x00, 0x10, 0x00, 0x04, 0x00, 0x25, 0x02, 0x02,
-0x01, 0x00, 0x03, 0x02, 0x00, 0x01, 0x02, 0x04, 0x00, 0x03, 0x01, 0x0a,
-0x01, 0x01, 0x01, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00,
-0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x61, 0x72, 0x00, 0x06, 0x00, 0x00,
-0x02, 0x01, 0x00, 0x04, 0x02, 0x04, 0x02, 0x01, 0x02, 0x01, 0x00, 0x05,
-0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x0f, 0x00, 0x00, 0x00, 0x6d,
-0x61, 0x6b, 0x65, 0x2d, 0x69, 0x64, 0x65, 0x6e, 0x74, 0x69, 0x66, 0x69,
-0x65, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00,
-0x01, 0x04, 0x03, 0x07, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x00, 0x01,
-0x11, 0x00, 0x00, 0x00, 0x02, 0x0c, 0x00, 0x00, 0x00, 0x69, 0x64, 0x65,
-0x6e, 0x74, 0x69, 0x66, 0x69, 0x65, 0x72, 0x3d, 0x3f, 0x00, 0x06, 0x00,
-0x00, 0x04, 0x01, 0x06, 0x01, 0x04, 0x02, 0x02, 0x01, 0x04, 0x03, 0x00,
-0x01, 0x01, 0x03, 0x02, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00,
-0x02, 0x05, 0x00, 0x00, 0x00, 0x70, 0x61, 0x69, 0x72, 0x3f, 0x00, 0x06,
-0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x01, 0x02, 0x01,
-0x00, 0x04, 0x01, 0x01, 0x1c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00,
-0x00, 0x63, 0x61, 0x72, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x10,
-0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x01, 0x02, 0x01,
-0x02, 0x04, 0x00, 0x01, 0x01, 0x0a, 0x01, 0x01, 0x01, 0x01, 0x00, 0x04,
-0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x05, 0x00, 0x00, 0x00, 0x70,
-0x61, 0x69, 0x72, 0x3f, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
-0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x1c, 0x00,
-0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x61, 0x61, 0x72, 0x00,
-0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x10, 0x00, 0x06, 0x00, 0x00, 0x02,
-0x01, 0x00, 0x04, 0x02, 0x03, 0x02, 0x01, 0x02, 0x04, 0x00, 0x03, 0x01,
-0x0a, 0x01, 0x01, 0x01, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00,
-0x00, 0x02, 0x0b, 0x00, 0x00, 0x00, 0x69, 0x64, 0x65, 0x6e, 0x74, 0x69,
-0x66, 0x69, 0x65, 0x72, 0x3f, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
-0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x1c,
-0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x00, 0x00, 0x75, 0x6e, 0x71, 0x75,
-0x6f, 0x74, 0x65, 0x2d, 0x73, 0x70, 0x6c, 0x69, 0x63, 0x69, 0x6e, 0x67,
-0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x10, 0x00, 0x04, 0x00, 0x27,
-0x02, 0x02, 0x01, 0x00, 0x03, 0x02, 0x00, 0x01, 0x02, 0x04, 0x00, 0x05,
-0x01, 0x0a, 0x01, 0x01, 0x01, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00,
-0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x61, 0x61, 0x72, 0x00,
-0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x06, 0x02, 0x01, 0x02,
+0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x1c, 0x00, 0x00, 0x00, 0x02, 0x0a,
+0x00, 0x00, 0x00, 0x71, 0x75, 0x61, 0x73, 0x69, 0x71, 0x75, 0x6f, 0x74,
+0x65, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x10, 0x00, 0x04, 0x00,
+0x25, 0x02, 0x02, 0x01, 0x00, 0x03, 0x02, 0x00, 0x01, 0x02, 0x04, 0x00,
+0x03, 0x01, 0x0a, 0x01, 0x01, 0x01, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c,
+0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x61, 0x72, 0x00,
+0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x04, 0x02, 0x01, 0x02,
 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x0f, 0x00,
 0x00, 0x00, 0x6d, 0x61, 0x6b, 0x65, 0x2d, 0x69, 0x64, 0x65, 0x6e, 0x74,
 0x69, 0x66, 0x69, 0x65, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
-0x04, 0x02, 0x00, 0x01, 0x04, 0x03, 0x09, 0x03, 0x01, 0x03, 0x01, 0x00,
+0x04, 0x02, 0x00, 0x01, 0x04, 0x03, 0x07, 0x03, 0x01, 0x03, 0x01, 0x00,
 0x05, 0x00, 0x01, 0x11, 0x00, 0x00, 0x00, 0x02, 0x0c, 0x00, 0x00, 0x00,
 0x69, 0x64, 0x65, 0x6e, 0x74, 0x69, 0x66, 0x69, 0x65, 0x72, 0x3d, 0x3f,
-0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x08, 0x01, 0x04, 0x02, 0x02, 0x01,
-0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x03, 0x00, 0x04, 0x01, 0x00, 0x0d,
-0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x04, 0x02, 0x01, 0x00, 0x04, 0x02,
-0x00, 0x03, 0x01, 0x02, 0x01, 0x00, 0x05, 0x02, 0x01, 0x24, 0x00, 0x00,
-0x00, 0x02, 0x01, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x00, 0x01,
-0x08, 0x00, 0x13, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
-0x01, 0x02, 0x0d, 0x03, 0x01, 0x01, 0x03, 0x04, 0x00, 0x02, 0x03, 0x02,
-0x01, 0x01, 0x04, 0x02, 0x01, 0x03, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01,
-0x02, 0x21, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x61,
-0x64, 0x72, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x6c, 0x69, 0x73, 0x74,
-0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x11, 0x00, 0x06, 0x00, 0x00,
-0x04, 0x01, 0x02, 0x01, 0x04, 0x02, 0x02, 0x03, 0x01, 0x02, 0x04, 0x00,
-0x24, 0x02, 0x02, 0x01, 0x00, 0x03, 0x02, 0x01, 0x01, 0x02, 0x01, 0x00,
+0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x06, 0x01, 0x04, 0x02, 0x02, 0x01,
+0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x02, 0x00, 0x04, 0x01, 0x01, 0x0c,
+0x00, 0x00, 0x00, 0x02, 0x05, 0x00, 0x00, 0x00, 0x70, 0x61, 0x69, 0x72,
+0x3f, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02,
+0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x1c, 0x00, 0x00, 0x00, 0x02,
+0x03, 0x00, 0x00, 0x00, 0x63, 0x61, 0x72, 0x00, 0x04, 0x00, 0x00, 0x01,
+0x08, 0x00, 0x10, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
+0x01, 0x02, 0x01, 0x02, 0x04, 0x00, 0x01, 0x01, 0x0a, 0x01, 0x01, 0x01,
+0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x0b, 0x00,
+0x00, 0x00, 0x69, 0x64, 0x65, 0x6e, 0x74, 0x69, 0x66, 0x69, 0x65, 0x72,
+0x3f, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01,
+0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x1c, 0x00, 0x00, 0x00, 0x02,
+0x07, 0x00, 0x00, 0x00, 0x75, 0x6e, 0x71, 0x75, 0x6f, 0x74, 0x65, 0x00,
+0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x10, 0x00, 0x04, 0x00, 0x25, 0x02,
+0x02, 0x01, 0x00, 0x03, 0x02, 0x00, 0x01, 0x02, 0x04, 0x00, 0x03, 0x01,
+0x0a, 0x01, 0x01, 0x01, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00,
+0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x61, 0x72, 0x00, 0x06, 0x00,
+0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x04, 0x02, 0x01, 0x02, 0x01, 0x00,
+0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x0f, 0x00, 0x00, 0x00,
+0x6d, 0x61, 0x6b, 0x65, 0x2d, 0x69, 0x64, 0x65, 0x6e, 0x74, 0x69, 0x66,
+0x69, 0x65, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
+0x00, 0x01, 0x04, 0x03, 0x07, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x00,
+0x01, 0x11, 0x00, 0x00, 0x00, 0x02, 0x0c, 0x00, 0x00, 0x00, 0x69, 0x64,
+0x65, 0x6e, 0x74, 0x69, 0x66, 0x69, 0x65, 0x72, 0x3d, 0x3f, 0x00, 0x06,
+0x00, 0x00, 0x04, 0x01, 0x06, 0x01, 0x04, 0x02, 0x02, 0x01, 0x04, 0x03,
+0x00, 0x01, 0x01, 0x03, 0x02, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00,
+0x00, 0x02, 0x05, 0x00, 0x00, 0x00, 0x70, 0x61, 0x69, 0x72, 0x3f, 0x00,
+0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x01, 0x02,
+0x01, 0x00, 0x04, 0x01, 0x01, 0x1c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00,
+0x00, 0x00, 0x63, 0x61, 0x72, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00,
+0x10, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x01, 0x02,
+0x01, 0x02, 0x04, 0x00, 0x01, 0x01, 0x0a, 0x01, 0x01, 0x01, 0x01, 0x00,
 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x05, 0x00, 0x00, 0x00,
-0x71, 0x75, 0x6f, 0x74, 0x65, 0x00, 0x04, 0x00, 0x25, 0x02, 0x02, 0x01,
-0x00, 0x03, 0x02, 0x00, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c,
-0x00, 0x00, 0x00, 0x02, 0x07, 0x00, 0x00, 0x00, 0x75, 0x6e, 0x71, 0x75,
-0x6f, 0x74, 0x65, 0x00, 0x04, 0x00, 0x26, 0x02, 0x02, 0x01, 0x00, 0x03,
+0x70, 0x61, 0x69, 0x72, 0x3f, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
+0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x1c,
+0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x61, 0x61, 0x72,
+0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x10, 0x00, 0x06, 0x00, 0x00,
+0x02, 0x01, 0x00, 0x04, 0x02, 0x03, 0x02, 0x01, 0x02, 0x04, 0x00, 0x03,
+0x01, 0x0a, 0x01, 0x01, 0x01, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00,
+0x00, 0x00, 0x02, 0x0b, 0x00, 0x00, 0x00, 0x69, 0x64, 0x65, 0x6e, 0x74,
+0x69, 0x66, 0x69, 0x65, 0x72, 0x3f, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
+0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01,
+0x1c, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x00, 0x00, 0x75, 0x6e, 0x71,
+0x75, 0x6f, 0x74, 0x65, 0x2d, 0x73, 0x70, 0x6c, 0x69, 0x63, 0x69, 0x6e,
+0x67, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x10, 0x00, 0x04, 0x00,
+0x27, 0x02, 0x02, 0x01, 0x00, 0x03, 0x02, 0x00, 0x01, 0x02, 0x04, 0x00,
+0x05, 0x01, 0x0a, 0x01, 0x01, 0x01, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c,
+0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x61, 0x61, 0x72,
+0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x06, 0x02, 0x01,
+0x02, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x0f,
+0x00, 0x00, 0x00, 0x6d, 0x61, 0x6b, 0x65, 0x2d, 0x69, 0x64, 0x65, 0x6e,
+0x74, 0x69, 0x66, 0x69, 0x65, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
+0x00, 0x04, 0x02, 0x00, 0x01, 0x04, 0x03, 0x09, 0x03, 0x01, 0x03, 0x01,
+0x00, 0x05, 0x00, 0x01, 0x11, 0x00, 0x00, 0x00, 0x02, 0x0c, 0x00, 0x00,
+0x00, 0x69, 0x64, 0x65, 0x6e, 0x74, 0x69, 0x66, 0x69, 0x65, 0x72, 0x3d,
+0x3f, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x08, 0x01, 0x04, 0x02, 0x02,
+0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x03, 0x00, 0x04, 0x01, 0x00,
+0x0d, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x04, 0x02, 0x01, 0x00, 0x04,
+0x02, 0x00, 0x03, 0x01, 0x02, 0x01, 0x00, 0x05, 0x02, 0x01, 0x24, 0x00,
+0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x00,
+0x01, 0x08, 0x00, 0x13, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
+0x02, 0x01, 0x02, 0x0d, 0x03, 0x01, 0x01, 0x03, 0x04, 0x00, 0x02, 0x03,
+0x02, 0x01, 0x01, 0x04, 0x02, 0x01, 0x03, 0x01, 0x02, 0x01, 0x00, 0x04,
+0x01, 0x02, 0x21, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63,
+0x61, 0x64, 0x72, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x6c, 0x69, 0x73,
+0x74, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x11, 0x00, 0x06, 0x00,
+0x00, 0x04, 0x01, 0x02, 0x01, 0x04, 0x02, 0x02, 0x03, 0x01, 0x02, 0x04,
+0x00, 0x24, 0x02, 0x02, 0x01, 0x00, 0x03, 0x02, 0x01, 0x01, 0x02, 0x01,
+0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x05, 0x00, 0x00,
+0x00, 0x71, 0x75, 0x6f, 0x74, 0x65, 0x00, 0x04, 0x00, 0x25, 0x02, 0x02,
+0x01, 0x00, 0x03, 0x02, 0x00, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01,
+0x0c, 0x00, 0x00, 0x00, 0x02, 0x07, 0x00, 0x00, 0x00, 0x75, 0x6e, 0x71,
+0x75, 0x6f, 0x74, 0x65, 0x00, 0x04, 0x00, 0x26, 0x02, 0x02, 0x01, 0x00,
+0x03, 0x02, 0x00, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00,
+0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x6c, 0x69, 0x73, 0x74, 0x00,
+0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x01, 0x01, 0x04, 0x03,
+0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0f, 0x00, 0x00,
+0x00, 0x02, 0x01, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x06, 0x00, 0x00, 0x02,
+0x01, 0x00, 0x04, 0x02, 0x06, 0x02, 0x0d, 0x03, 0x01, 0x01, 0x03, 0x01,
+0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00,
+0x00, 0x63, 0x64, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
+0x02, 0x07, 0x03, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00,
+0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x61, 0x72, 0x00, 0x06,
+0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01,
+0x00, 0x05, 0x01, 0x00, 0x11, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0a, 0x02,
+0x02, 0x01, 0x00, 0x04, 0x02, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01,
+0x03, 0x01, 0x00, 0x06, 0x00, 0x01, 0x15, 0x00, 0x00, 0x00, 0x02, 0x04,
+0x00, 0x00, 0x00, 0x6c, 0x69, 0x73, 0x74, 0x00, 0x06, 0x00, 0x00, 0x04,
+0x01, 0x0a, 0x01, 0x04, 0x02, 0x07, 0x01, 0x04, 0x03, 0x04, 0x01, 0x04,
+0x04, 0x00, 0x01, 0x01, 0x04, 0x01, 0x00, 0x05, 0x02, 0x01, 0x24, 0x00,
+0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x00,
+0x01, 0x08, 0x00, 0x13, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
+0x02, 0x02, 0x02, 0x0d, 0x03, 0x01, 0x01, 0x03, 0x04, 0x00, 0x03, 0x05,
+0x02, 0x01, 0x01, 0x04, 0x02, 0x02, 0x03, 0x01, 0x02, 0x01, 0x00, 0x04,
+0x02, 0x02, 0x20, 0x00, 0x00, 0x00, 0x02, 0x06, 0x00, 0x00, 0x00, 0x61,
+0x70, 0x70, 0x65, 0x6e, 0x64, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63,
+0x6f, 0x6e, 0x73, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x10, 0x00,
+0x04, 0x00, 0x25, 0x02, 0x02, 0x01, 0x00, 0x03, 0x02, 0x00, 0x01, 0x02,
+0x04, 0x00, 0x25, 0x02, 0x02, 0x01, 0x01, 0x03, 0x02, 0x01, 0x01, 0x02,
+0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00,
+0x00, 0x00, 0x63, 0x61, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
+0x04, 0x02, 0x04, 0x03, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c,
+0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x64, 0x72, 0x00,
+0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02,
+0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00,
+0x00, 0x00, 0x63, 0x61, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
+0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c,
+0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x64, 0x72, 0x00,
+0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x07, 0x03, 0x01, 0x02,
+0x01, 0x00, 0x05, 0x01, 0x00, 0x11, 0x00, 0x00, 0x00, 0x04, 0x00, 0x09,
+0x02, 0x02, 0x01, 0x00, 0x04, 0x02, 0x08, 0x02, 0x04, 0x03, 0x00, 0x01,
+0x01, 0x03, 0x01, 0x00, 0x06, 0x00, 0x01, 0x15, 0x00, 0x00, 0x00, 0x02,
+0x04, 0x00, 0x00, 0x00, 0x6c, 0x69, 0x73, 0x74, 0x00, 0x06, 0x00, 0x00,
+0x04, 0x01, 0x09, 0x01, 0x04, 0x02, 0x05, 0x01, 0x04, 0x03, 0x02, 0x01,
+0x04, 0x04, 0x00, 0x01, 0x01, 0x04, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c,
+0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x6c, 0x69, 0x73, 0x74,
+0x00, 0x04, 0x00, 0x26, 0x02, 0x02, 0x01, 0x00, 0x03, 0x02, 0x00, 0x01,
+0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x05,
+0x00, 0x00, 0x00, 0x71, 0x75, 0x6f, 0x74, 0x65, 0x00, 0x04, 0x00, 0x27,
+0x02, 0x02, 0x01, 0x00, 0x03, 0x02, 0x00, 0x01, 0x02, 0x01, 0x00, 0x04,
+0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x00, 0x00, 0x75,
+0x6e, 0x71, 0x75, 0x6f, 0x74, 0x65, 0x2d, 0x73, 0x70, 0x6c, 0x69, 0x63,
+0x69, 0x6e, 0x67, 0x00, 0x04, 0x00, 0x28, 0x02, 0x02, 0x01, 0x00, 0x03,
 0x02, 0x00, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00,
 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x6c, 0x69, 0x73, 0x74, 0x00, 0x06,
 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x01, 0x01, 0x04, 0x03, 0x00,
 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0f, 0x00, 0x00, 0x00,
 0x02, 0x01, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
-0x00, 0x04, 0x02, 0x06, 0x02, 0x0d, 0x03, 0x01, 0x01, 0x03, 0x01, 0x00,
+0x00, 0x04, 0x02, 0x08, 0x02, 0x0d, 0x03, 0x01, 0x01, 0x03, 0x01, 0x00,
 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00,
-0x63, 0x64, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
-0x07, 0x03, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00,
-0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x61, 0x72, 0x00, 0x06, 0x00,
+0x63, 0x61, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
+0x09, 0x03, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00,
+0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x64, 0x72, 0x00, 0x06, 0x00,
 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00,
-0x05, 0x01, 0x00, 0x11, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0a, 0x02, 0x02,
-0x01, 0x00, 0x04, 0x02, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03,
-0x01, 0x00, 0x06, 0x00, 0x01, 0x15, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00,
-0x00, 0x00, 0x6c, 0x69, 0x73, 0x74, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01,
-0x0a, 0x01, 0x04, 0x02, 0x07, 0x01, 0x04, 0x03, 0x04, 0x01, 0x04, 0x04,
-0x00, 0x01, 0x01, 0x04, 0x01, 0x00, 0x05, 0x02, 0x01, 0x24, 0x00, 0x00,
-0x00, 0x02, 0x01, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x00, 0x01,
-0x08, 0x00, 0x13, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
-0x02, 0x02, 0x0d, 0x03, 0x01, 0x01, 0x03, 0x04, 0x00, 0x03, 0x05, 0x02,
-0x01, 0x01, 0x04, 0x02, 0x02, 0x03, 0x01, 0x02, 0x01, 0x00, 0x04, 0x02,
-0x02, 0x20, 0x00, 0x00, 0x00, 0x02, 0x06, 0x00, 0x00, 0x00, 0x61, 0x70,
-0x70, 0x65, 0x6e, 0x64, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f,
-0x6e, 0x73, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x10, 0x00, 0x04,
-0x00, 0x25, 0x02, 0x02, 0x01, 0x00, 0x03, 0x02, 0x00, 0x01, 0x02, 0x04,
-0x00, 0x25, 0x02, 0x02, 0x01, 0x01, 0x03, 0x02, 0x01, 0x01, 0x02, 0x01,
-0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00,
-0x00, 0x63, 0x61, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
-0x02, 0x04, 0x03, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00,
-0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x64, 0x72, 0x00, 0x06,
-0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01,
-0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00,
-0x00, 0x63, 0x61, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
-0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00,
-0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x64, 0x72, 0x00, 0x06,
-0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x07, 0x03, 0x01, 0x02, 0x01,
-0x00, 0x05, 0x01, 0x00, 0x11, 0x00, 0x00, 0x00, 0x04, 0x00, 0x09, 0x02,
-0x02, 0x01, 0x00, 0x04, 0x02, 0x08, 0x02, 0x04, 0x03, 0x00, 0x01, 0x01,
-0x03, 0x01, 0x00, 0x06, 0x00, 0x01, 0x15, 0x00, 0x00, 0x00, 0x02, 0x04,
-0x00, 0x00, 0x00, 0x6c, 0x69, 0x73, 0x74, 0x00, 0x06, 0x00, 0x00, 0x04,
-0x01, 0x09, 0x01, 0x04, 0x02, 0x05, 0x01, 0x04, 0x03, 0x02, 0x01, 0x04,
-0x04, 0x00, 0x01, 0x01, 0x04, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00,
-0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x6c, 0x69, 0x73, 0x74, 0x00,
-0x04, 0x00, 0x26, 0x02, 0x02, 0x01, 0x00, 0x03, 0x02, 0x00, 0x01, 0x02,
-0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x05, 0x00,
-0x00, 0x00, 0x71, 0x75, 0x6f, 0x74, 0x65, 0x00, 0x04, 0x00, 0x27, 0x02,
-0x02, 0x01, 0x00, 0x03, 0x02, 0x00, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01,
-0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x00, 0x00, 0x75, 0x6e,
-0x71, 0x75, 0x6f, 0x74, 0x65, 0x2d, 0x73, 0x70, 0x6c, 0x69, 0x63, 0x69,
-0x6e, 0x67, 0x00, 0x04, 0x00, 0x28, 0x02, 0x02, 0x01, 0x00, 0x03, 0x02,
-0x00, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00,
-0x02, 0x04, 0x00, 0x00, 0x00, 0x6c, 0x69, 0x73, 0x74, 0x00, 0x06, 0x00,
-0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x01, 0x01, 0x04, 0x03, 0x00, 0x01,
-0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0f, 0x00, 0x00, 0x00, 0x02,
-0x01, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
-0x04, 0x02, 0x08, 0x02, 0x0d, 0x03, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04,
-0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63,
-0x61, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x09,
-0x03, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00,
-0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x64, 0x72, 0x00, 0x06, 0x00, 0x00,
-0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x04,
+0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00,
+0x63, 0x61, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
+0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x00, 0x11, 0x00, 0x00,
+0x00, 0x04, 0x00, 0x0d, 0x02, 0x02, 0x01, 0x00, 0x04, 0x02, 0x03, 0x01,
+0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x06, 0x01, 0x01, 0x14,
+0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x6c, 0x69, 0x73, 0x74,
+0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x08, 0x01, 0x04,
+0x03, 0x05, 0x01, 0x04, 0x04, 0x00, 0x01, 0x01, 0x04, 0x01, 0x00, 0x04,
 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63,
-0x61, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00,
-0x01, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x00, 0x11, 0x00, 0x00, 0x00,
-0x04, 0x00, 0x0d, 0x02, 0x02, 0x01, 0x00, 0x04, 0x02, 0x03, 0x01, 0x04,
-0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x06, 0x01, 0x01, 0x14, 0x00,
+0x64, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x0e,
+0x03, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x00, 0x11, 0x00, 0x00, 0x00,
+0x04, 0x00, 0x10, 0x02, 0x02, 0x01, 0x00, 0x04, 0x02, 0x0f, 0x02, 0x04,
+0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x06, 0x00, 0x01, 0x15, 0x00,
 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x6c, 0x69, 0x73, 0x74, 0x00,
-0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x08, 0x01, 0x04, 0x03,
-0x05, 0x01, 0x04, 0x04, 0x00, 0x01, 0x01, 0x04, 0x01, 0x00, 0x04, 0x01,
+0x06, 0x00, 0x00, 0x04, 0x01, 0x10, 0x01, 0x04, 0x02, 0x0c, 0x01, 0x04,
+0x03, 0x02, 0x01, 0x04, 0x04, 0x00, 0x01, 0x01, 0x04, 0x01, 0x00, 0x04,
+0x02, 0x02, 0x20, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x6c,
+0x69, 0x73, 0x74, 0x00, 0x02, 0x05, 0x00, 0x00, 0x00, 0x70, 0x61, 0x69,
+0x72, 0x3f, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x10, 0x00, 0x04,
+0x00, 0x25, 0x02, 0x02, 0x01, 0x00, 0x03, 0x02, 0x00, 0x01, 0x02, 0x06,
+0x00, 0x01, 0x02, 0x01, 0x01, 0x04, 0x02, 0x03, 0x03, 0x01, 0x02, 0x01,
+0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x05, 0x00, 0x00,
+0x00, 0x71, 0x75, 0x6f, 0x74, 0x65, 0x00, 0x04, 0x00, 0x26, 0x02, 0x02,
+0x01, 0x00, 0x03, 0x02, 0x00, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01,
+0x0c, 0x00, 0x00, 0x00, 0x02, 0x0a, 0x00, 0x00, 0x00, 0x71, 0x75, 0x61,
+0x73, 0x69, 0x71, 0x75, 0x6f, 0x74, 0x65, 0x00, 0x04, 0x00, 0x27, 0x02,
+0x02, 0x01, 0x00, 0x03, 0x02, 0x00, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01,
+0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x6c, 0x69,
+0x73, 0x74, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x01,
+0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01,
+0x0f, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x06,
+0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x07, 0x02, 0x0d, 0x03, 0x01,
+0x01, 0x03, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02,
+0x03, 0x00, 0x00, 0x00, 0x63, 0x64, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02,
+0x01, 0x00, 0x04, 0x02, 0x08, 0x03, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01,
+0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x61,
+0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01,
+0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x00, 0x11, 0x00, 0x00, 0x00, 0x04,
+0x00, 0x0b, 0x02, 0x02, 0x01, 0x00, 0x04, 0x02, 0x02, 0x01, 0x04, 0x03,
+0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x06, 0x00, 0x01, 0x15, 0x00, 0x00,
+0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x6c, 0x69, 0x73, 0x74, 0x00, 0x06,
+0x00, 0x00, 0x04, 0x01, 0x0b, 0x01, 0x04, 0x02, 0x07, 0x01, 0x04, 0x03,
+0x04, 0x01, 0x04, 0x04, 0x00, 0x01, 0x01, 0x04, 0x01, 0x00, 0x04, 0x02,
+0x02, 0x20, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f,
+0x6e, 0x73, 0x00, 0x02, 0x07, 0x00, 0x00, 0x00, 0x76, 0x65, 0x63, 0x74,
+0x6f, 0x72, 0x3f, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x10, 0x00,
+0x04, 0x00, 0x26, 0x02, 0x02, 0x01, 0x00, 0x03, 0x02, 0x00, 0x01, 0x02,
+0x06, 0x00, 0x01, 0x02, 0x01, 0x01, 0x04, 0x02, 0x04, 0x03, 0x01, 0x02,
+0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00,
+0x00, 0x00, 0x63, 0x61, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
+0x04, 0x02, 0x05, 0x03, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x00, 0x11,
+0x00, 0x00, 0x00, 0x04, 0x00, 0x07, 0x02, 0x02, 0x01, 0x00, 0x04, 0x02,
+0x06, 0x02, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x01,
 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x64,
-0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x0e, 0x03,
+0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x07, 0x03,
 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x00, 0x11, 0x00, 0x00, 0x00, 0x04,
-0x00, 0x10, 0x02, 0x02, 0x01, 0x00, 0x04, 0x02, 0x0f, 0x02, 0x04, 0x03,
+0x00, 0x09, 0x02, 0x02, 0x01, 0x00, 0x04, 0x02, 0x08, 0x02, 0x04, 0x03,
 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x06, 0x00, 0x01, 0x15, 0x00, 0x00,
 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x6c, 0x69, 0x73, 0x74, 0x00, 0x06,
-0x00, 0x00, 0x04, 0x01, 0x10, 0x01, 0x04, 0x02, 0x0c, 0x01, 0x04, 0x03,
+0x00, 0x00, 0x04, 0x01, 0x09, 0x01, 0x04, 0x02, 0x04, 0x01, 0x04, 0x03,
 0x02, 0x01, 0x04, 0x04, 0x00, 0x01, 0x01, 0x04, 0x01, 0x00, 0x04, 0x02,
-0x02, 0x20, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x6c, 0x69,
-0x73, 0x74, 0x00, 0x02, 0x05, 0x00, 0x00, 0x00, 0x70, 0x61, 0x69, 0x72,
-0x3f, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x10, 0x00, 0x04, 0x00,
-0x25, 0x02, 0x02, 0x01, 0x00, 0x03, 0x02, 0x00, 0x01, 0x02, 0x06, 0x00,
-0x01, 0x02, 0x01, 0x01, 0x04, 0x02, 0x03, 0x03, 0x01, 0x02, 0x01, 0x00,
-0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x05, 0x00, 0x00, 0x00,
-0x71, 0x75, 0x6f, 0x74, 0x65, 0x00, 0x04, 0x00, 0x26, 0x02, 0x02, 0x01,
-0x00, 0x03, 0x02, 0x00, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c,
-0x00, 0x00, 0x00, 0x02, 0x0a, 0x00, 0x00, 0x00, 0x71, 0x75, 0x61, 0x73,
-0x69, 0x71, 0x75, 0x6f, 0x74, 0x65, 0x00, 0x04, 0x00, 0x27, 0x02, 0x02,
-0x01, 0x00, 0x03, 0x02, 0x00, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x01,
-0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x6c, 0x69, 0x73,
-0x74, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x01, 0x01,
-0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0f,
-0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x06, 0x00,
-0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x07, 0x02, 0x0d, 0x03, 0x01, 0x01,
-0x03, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03,
-0x00, 0x00, 0x00, 0x63, 0x64, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
-0x00, 0x04, 0x02, 0x08, 0x03, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01,
-0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x61, 0x72,
-0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01,
-0x02, 0x01, 0x00, 0x05, 0x01, 0x00, 0x11, 0x00, 0x00, 0x00, 0x04, 0x00,
-0x0b, 0x02, 0x02, 0x01, 0x00, 0x04, 0x02, 0x02, 0x01, 0x04, 0x03, 0x00,
-0x01, 0x01, 0x03, 0x01, 0x00, 0x06, 0x00, 0x01, 0x15, 0x00, 0x00, 0x00,
-0x02, 0x04, 0x00, 0x00, 0x00, 0x6c, 0x69, 0x73, 0x74, 0x00, 0x06, 0x00,
-0x00, 0x04, 0x01, 0x0b, 0x01, 0x04, 0x02, 0x07, 0x01, 0x04, 0x03, 0x04,
-0x01, 0x04, 0x04, 0x00, 0x01, 0x01, 0x04, 0x01, 0x00, 0x04, 0x02, 0x02,
-0x20, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e,
-0x73, 0x00, 0x02, 0x07, 0x00, 0x00, 0x00, 0x76, 0x65, 0x63, 0x74, 0x6f,
-0x72, 0x3f, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x10, 0x00, 0x04,
-0x00, 0x26, 0x02, 0x02, 0x01, 0x00, 0x03, 0x02, 0x00, 0x01, 0x02, 0x06,
-0x00, 0x01, 0x02, 0x01, 0x01, 0x04, 0x02, 0x04, 0x03, 0x01, 0x02, 0x01,
-0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00,
-0x00, 0x63, 0x61, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
-0x02, 0x05, 0x03, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x00, 0x11, 0x00,
-0x00, 0x00, 0x04, 0x00, 0x07, 0x02, 0x02, 0x01, 0x00, 0x04, 0x02, 0x06,
-0x02, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x01, 0x01,
-0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x64, 0x72,
-0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x07, 0x03, 0x01,
-0x02, 0x01, 0x00, 0x05, 0x01, 0x00, 0x11, 0x00, 0x00, 0x00, 0x04, 0x00,
-0x09, 0x02, 0x02, 0x01, 0x00, 0x04, 0x02, 0x08, 0x02, 0x04, 0x03, 0x00,
-0x01, 0x01, 0x03, 0x01, 0x00, 0x06, 0x00, 0x01, 0x15, 0x00, 0x00, 0x00,
-0x02, 0x04, 0x00, 0x00, 0x00, 0x6c, 0x69, 0x73, 0x74, 0x00, 0x06, 0x00,
-0x00, 0x04, 0x01, 0x09, 0x01, 0x04, 0x02, 0x04, 0x01, 0x04, 0x03, 0x02,
-0x01, 0x04, 0x04, 0x00, 0x01, 0x01, 0x04, 0x01, 0x00, 0x04, 0x02, 0x02,
-0x20, 0x00, 0x00, 0x00, 0x02, 0x0c, 0x00, 0x00, 0x00, 0x6c, 0x69, 0x73,
-0x74, 0x2d, 0x3e, 0x76, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x00, 0x02, 0x05,
-0x00, 0x00, 0x00, 0x71, 0x75, 0x6f, 0x74, 0x65, 0x00, 0x04, 0x00, 0x00,
-0x01, 0x08, 0x00, 0x10, 0x00, 0x04, 0x00, 0x27, 0x02, 0x02, 0x01, 0x00,
-0x03, 0x02, 0x00, 0x01, 0x02, 0x04, 0x00, 0x27, 0x02, 0x02, 0x01, 0x01,
-0x03, 0x02, 0x01, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00,
-0x00, 0x00, 0x02, 0x0c, 0x00, 0x00, 0x00, 0x76, 0x65, 0x63, 0x74, 0x6f,
-0x72, 0x2d, 0x3e, 0x6c, 0x69, 0x73, 0x74, 0x00, 0x06, 0x00, 0x00, 0x02,
-0x01, 0x00, 0x04, 0x02, 0x06, 0x03, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01,
-0x00, 0x11, 0x00, 0x00, 0x00, 0x04, 0x00, 0x08, 0x02, 0x02, 0x01, 0x00,
-0x04, 0x02, 0x07, 0x02, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00,
-0x05, 0x00, 0x01, 0x11, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00,
-0x6c, 0x69, 0x73, 0x74, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x08, 0x01,
-0x04, 0x02, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00,
-0x05, 0x00, 0x01, 0x11, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00,
-0x6c, 0x69, 0x73, 0x74, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x06, 0x01,
-0x04, 0x02, 0x00, 0x01, 0x04, 0x03, 0x06, 0x03, 0x01, 0x03, 0x01, 0x00,
-0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x01,
-0x01, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x02, 0x00, 0x05, 0x00,
-0x00, 0x11, 0x00, 0x00, 0x00, 0x04, 0x00, 0x02, 0x02, 0x04, 0x01, 0x00,
-0x01, 0x0d, 0x02, 0x01, 0x04, 0x03, 0x00, 0x02, 0x01, 0x03, 0x03, 0x00,
-0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00,
-0x63, 0x64, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
-0x00, 0x02, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00,
-0x00, 0x02, 0x00, 0x00, 0x04, 0x01, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01,
-0x01, 0x02, 0x02, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02,
-0x05, 0x00, 0x00, 0x00, 0x6e, 0x75, 0x6c, 0x6c, 0x3f, 0x00, 0x06, 0x00,
-0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x01, 0x02, 0x01, 0x00,
-0x04, 0x01, 0x01, 0x1c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00,
-0x63, 0x61, 0x72, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x0c, 0x00,
-0x04, 0x00, 0x01, 0x01, 0x0c, 0x01, 0x01, 0x01, 0x06, 0x00, 0x00, 0x02,
-0x01, 0x00, 0x04, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01,
-0x00, 0x0d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x01, 0x02, 0x01,
-0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x02, 0x00, 0x03, 0x02, 0x00, 0x08,
-0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01,
-0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00,
-0x00, 0x63, 0x61, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
-0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00,
-0x00, 0x00, 0x02, 0x0b, 0x00, 0x00, 0x00, 0x69, 0x64, 0x65, 0x6e, 0x74,
-0x69, 0x66, 0x69, 0x65, 0x72, 0x3f, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
-0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01,
-0x1c, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x65, 0x6c, 0x73,
-0x65, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x10, 0x00, 0x04, 0x00,
-0x27, 0x02, 0x02, 0x01, 0x00, 0x03, 0x02, 0x00, 0x01, 0x02, 0x04, 0x00,
-0x02, 0x01, 0x0a, 0x01, 0x01, 0x01, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c,
-0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x61, 0x72, 0x00,
-0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x04, 0x02, 0x01, 0x02,
-0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x0f, 0x00,
-0x00, 0x00, 0x6d, 0x61, 0x6b, 0x65, 0x2d, 0x69, 0x64, 0x65, 0x6e, 0x74,
-0x69, 0x66, 0x69, 0x65, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
-0x04, 0x02, 0x00, 0x01, 0x04, 0x03, 0x0a, 0x03, 0x01, 0x03, 0x01, 0x00,
-0x05, 0x00, 0x01, 0x11, 0x00, 0x00, 0x00, 0x02, 0x0c, 0x00, 0x00, 0x00,
-0x69, 0x64, 0x65, 0x6e, 0x74, 0x69, 0x66, 0x69, 0x65, 0x72, 0x3d, 0x3f,
-0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x05, 0x01, 0x04, 0x02, 0x02, 0x01,
-0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x02, 0x02, 0x20,
-0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x64, 0x72, 0x00,
-0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x64, 0x72, 0x00, 0x04, 0x00, 0x00,
-0x01, 0x08, 0x00, 0x10, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
-0x02, 0x01, 0x02, 0x01, 0x02, 0x06, 0x00, 0x01, 0x02, 0x01, 0x01, 0x04,
-0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x00, 0x05, 0x00, 0x01, 0x11, 0x00,
-0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00,
-0x06, 0x00, 0x00, 0x04, 0x01, 0x02, 0x01, 0x04, 0x02, 0x17, 0x0b, 0x04,
-0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00,
-0x00, 0x00, 0x02, 0x05, 0x00, 0x00, 0x00, 0x6e, 0x75, 0x6c, 0x6c, 0x3f,
-0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01,
-0x02, 0x01, 0x00, 0x04, 0x03, 0x01, 0x1c, 0x00, 0x00, 0x00, 0x02, 0x02,
-0x00, 0x00, 0x00, 0x6f, 0x72, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00,
-0x10, 0x00, 0x04, 0x00, 0x27, 0x02, 0x02, 0x01, 0x00, 0x03, 0x02, 0x00,
-0x01, 0x02, 0x02, 0x00, 0x01, 0x02, 0x01, 0x02, 0x01, 0x01, 0x01, 0x00,
-0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00,
-0x63, 0x61, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
-0x04, 0x02, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00,
-0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x64, 0x00, 0x04,
-0x00, 0x29, 0x02, 0x02, 0x01, 0x00, 0x03, 0x02, 0x00, 0x01, 0x02, 0x01,
+0x02, 0x20, 0x00, 0x00, 0x00, 0x02, 0x0c, 0x00, 0x00, 0x00, 0x6c, 0x69,
+0x73, 0x74, 0x2d, 0x3e, 0x76, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x00, 0x02,
+0x05, 0x00, 0x00, 0x00, 0x71, 0x75, 0x6f, 0x74, 0x65, 0x00, 0x04, 0x00,
+0x00, 0x01, 0x08, 0x00, 0x10, 0x00, 0x04, 0x00, 0x27, 0x02, 0x02, 0x01,
+0x00, 0x03, 0x02, 0x00, 0x01, 0x02, 0x04, 0x00, 0x27, 0x02, 0x02, 0x01,
+0x01, 0x03, 0x02, 0x01, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c,
+0x00, 0x00, 0x00, 0x02, 0x0c, 0x00, 0x00, 0x00, 0x76, 0x65, 0x63, 0x74,
+0x6f, 0x72, 0x2d, 0x3e, 0x6c, 0x69, 0x73, 0x74, 0x00, 0x06, 0x00, 0x00,
+0x02, 0x01, 0x00, 0x04, 0x02, 0x06, 0x03, 0x01, 0x02, 0x01, 0x00, 0x05,
+0x01, 0x00, 0x11, 0x00, 0x00, 0x00, 0x04, 0x00, 0x08, 0x02, 0x02, 0x01,
+0x00, 0x04, 0x02, 0x07, 0x02, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01,
+0x00, 0x05, 0x00, 0x01, 0x11, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00,
+0x00, 0x6c, 0x69, 0x73, 0x74, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x08,
+0x01, 0x04, 0x02, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01,
+0x00, 0x05, 0x00, 0x01, 0x11, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00,
+0x00, 0x6c, 0x69, 0x73, 0x74, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x06,
+0x01, 0x04, 0x02, 0x00, 0x01, 0x04, 0x03, 0x06, 0x03, 0x01, 0x03, 0x01,
+0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04,
+0x01, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x02, 0x00, 0x05,
+0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x04, 0x00, 0x02, 0x02, 0x04, 0x01,
+0x00, 0x01, 0x0d, 0x02, 0x01, 0x04, 0x03, 0x00, 0x02, 0x01, 0x03, 0x03,
 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00,
 0x00, 0x63, 0x64, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
-0x02, 0x09, 0x02, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00,
-0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00,
-0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x01, 0x01, 0x04, 0x03,
-0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00, 0x00,
-0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06,
-0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x0b, 0x03, 0x01,
-0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04,
-0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02,
-0x01, 0x00, 0x04, 0x02, 0x04, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03,
-0x01, 0x00, 0x05, 0x00, 0x01, 0x11, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00,
-0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01,
-0x0a, 0x01, 0x04, 0x02, 0x06, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03,
-0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00,
-0x00, 0x00, 0x63, 0x61, 0x64, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
-0x00, 0x04, 0x02, 0x04, 0x02, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01,
-0x0c, 0x00, 0x00, 0x00, 0x02, 0x0b, 0x00, 0x00, 0x00, 0x69, 0x64, 0x65,
-0x6e, 0x74, 0x69, 0x66, 0x69, 0x65, 0x72, 0x3f, 0x00, 0x06, 0x00, 0x00,
-0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x04,
-0x01, 0x01, 0x1c, 0x00, 0x00, 0x00, 0x02, 0x02, 0x00, 0x00, 0x00, 0x3d,
-0x3e, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x10, 0x00, 0x04, 0x00,
-0x2a, 0x02, 0x02, 0x01, 0x00, 0x03, 0x02, 0x00, 0x01, 0x02, 0x04, 0x00,
-0x02, 0x01, 0x0a, 0x01, 0x01, 0x01, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c,
-0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x61, 0x64, 0x72,
-0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x07, 0x02, 0x01,
+0x02, 0x00, 0x02, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00,
+0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x01, 0x01, 0x01, 0x04, 0x02, 0x00,
+0x01, 0x01, 0x02, 0x02, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00,
+0x02, 0x05, 0x00, 0x00, 0x00, 0x6e, 0x75, 0x6c, 0x6c, 0x3f, 0x00, 0x06,
+0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x01, 0x02, 0x01,
+0x00, 0x04, 0x01, 0x01, 0x1c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00,
+0x00, 0x63, 0x61, 0x72, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x0c,
+0x00, 0x04, 0x00, 0x01, 0x01, 0x0c, 0x01, 0x01, 0x01, 0x06, 0x00, 0x00,
+0x02, 0x01, 0x00, 0x04, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x00, 0x04,
+0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x01, 0x02,
+0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x02, 0x00, 0x03, 0x02, 0x00,
+0x08, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00,
+0x00, 0x00, 0x63, 0x61, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
+0x04, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c,
+0x00, 0x00, 0x00, 0x02, 0x0b, 0x00, 0x00, 0x00, 0x69, 0x64, 0x65, 0x6e,
+0x74, 0x69, 0x66, 0x69, 0x65, 0x72, 0x3f, 0x00, 0x06, 0x00, 0x00, 0x02,
+0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01,
+0x01, 0x1c, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x65, 0x6c,
+0x73, 0x65, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x10, 0x00, 0x04,
+0x00, 0x27, 0x02, 0x02, 0x01, 0x00, 0x03, 0x02, 0x00, 0x01, 0x02, 0x04,
+0x00, 0x02, 0x01, 0x0a, 0x01, 0x01, 0x01, 0x01, 0x00, 0x04, 0x01, 0x01,
+0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x61, 0x72,
+0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x04, 0x02, 0x01,
 0x02, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x0f,
 0x00, 0x00, 0x00, 0x6d, 0x61, 0x6b, 0x65, 0x2d, 0x69, 0x64, 0x65, 0x6e,
 0x74, 0x69, 0x66, 0x69, 0x65, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
-0x00, 0x04, 0x02, 0x00, 0x01, 0x04, 0x03, 0x0d, 0x03, 0x01, 0x03, 0x01,
+0x00, 0x04, 0x02, 0x00, 0x01, 0x04, 0x03, 0x0a, 0x03, 0x01, 0x03, 0x01,
 0x00, 0x05, 0x00, 0x01, 0x11, 0x00, 0x00, 0x00, 0x02, 0x0c, 0x00, 0x00,
 0x00, 0x69, 0x64, 0x65, 0x6e, 0x74, 0x69, 0x66, 0x69, 0x65, 0x72, 0x3d,
 0x3f, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x05, 0x01, 0x04, 0x02, 0x02,
-0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x02, 0x03,
-0x23, 0x00, 0x00, 0x00, 0x02, 0x0f, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x6b,
-0x65, 0x2d, 0x69, 0x64, 0x65, 0x6e, 0x74, 0x69, 0x66, 0x69, 0x65, 0x72,
-0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x74, 0x6d, 0x70, 0x00, 0x02, 0x03,
-0x00, 0x00, 0x00, 0x63, 0x61, 0x72, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08,
-0x00, 0x13, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x03, 0x02, 0x01,
-0x04, 0x03, 0x09, 0x03, 0x01, 0x03, 0x06, 0x00, 0x02, 0x02, 0x01, 0x01,
-0x04, 0x02, 0x04, 0x02, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d,
-0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x01, 0x05, 0x01, 0x04, 0x02,
-0x00, 0x01, 0x01, 0x02, 0x02, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00,
-0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x6c, 0x65, 0x74, 0x00, 0x04, 0x00,
-0x2a, 0x02, 0x02, 0x01, 0x00, 0x03, 0x02, 0x00, 0x01, 0x02, 0x01, 0x00,
-0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00,
-0x63, 0x61, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
-0x07, 0x02, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00, 0x00,
-0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06,
-0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x0b, 0x03, 0x01,
-0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04,
-0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02,
-0x01, 0x00, 0x04, 0x02, 0x03, 0x02, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03,
-0x01, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00,
-0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
-0x00, 0x04, 0x02, 0x00, 0x01, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x04,
-0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63,
-0x64, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x0b,
-0x02, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00,
-0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x61, 0x64, 0x72, 0x00, 0x06, 0x00,
-0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00,
-0x05, 0x01, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00,
-0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
-0x02, 0x07, 0x02, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01,
-0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e,
-0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x01, 0x01,
+0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x02, 0x02,
+0x20, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x64, 0x72,
+0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x64, 0x72, 0x00, 0x04, 0x00,
+0x00, 0x01, 0x08, 0x00, 0x10, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
+0x04, 0x02, 0x01, 0x02, 0x01, 0x02, 0x06, 0x00, 0x01, 0x02, 0x01, 0x01,
+0x04, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x00, 0x05, 0x00, 0x01, 0x11,
+0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73,
+0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x02, 0x01, 0x04, 0x02, 0x17, 0x0b,
 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c,
-0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x64,
-0x00, 0x04, 0x00, 0x33, 0x02, 0x02, 0x01, 0x00, 0x03, 0x02, 0x00, 0x01,
-0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x04,
-0x00, 0x00, 0x00, 0x63, 0x64, 0x64, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02,
-0x01, 0x00, 0x04, 0x02, 0x15, 0x02, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01,
-0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f,
-0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x01,
-0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01,
-0x0e, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e,
-0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01,
-0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00,
-0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06,
-0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x04, 0x01, 0x04, 0x03, 0x00,
-0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00,
-0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00,
-0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x0e, 0x02, 0x04, 0x03, 0x00, 0x01,
+0x00, 0x00, 0x00, 0x02, 0x05, 0x00, 0x00, 0x00, 0x6e, 0x75, 0x6c, 0x6c,
+0x3f, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01,
+0x01, 0x02, 0x01, 0x00, 0x04, 0x03, 0x01, 0x1c, 0x00, 0x00, 0x00, 0x02,
+0x02, 0x00, 0x00, 0x00, 0x6f, 0x72, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08,
+0x00, 0x10, 0x00, 0x04, 0x00, 0x27, 0x02, 0x02, 0x01, 0x00, 0x03, 0x02,
+0x00, 0x01, 0x02, 0x02, 0x00, 0x01, 0x02, 0x01, 0x02, 0x01, 0x01, 0x01,
+0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00,
+0x00, 0x63, 0x61, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
+0x02, 0x04, 0x02, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00,
+0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x64, 0x00,
+0x04, 0x00, 0x29, 0x02, 0x02, 0x01, 0x00, 0x03, 0x02, 0x00, 0x01, 0x02,
+0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00,
+0x00, 0x00, 0x63, 0x64, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
+0x04, 0x02, 0x09, 0x02, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10,
+0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73,
+0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x01, 0x01, 0x04,
+0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00,
+0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00,
+0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x0b, 0x03,
+0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02,
+0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00,
+0x02, 0x01, 0x00, 0x04, 0x02, 0x04, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01,
+0x03, 0x01, 0x00, 0x05, 0x00, 0x01, 0x11, 0x00, 0x00, 0x00, 0x02, 0x04,
+0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x04,
+0x01, 0x0a, 0x01, 0x04, 0x02, 0x06, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01,
+0x03, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x04,
+0x00, 0x00, 0x00, 0x63, 0x61, 0x64, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02,
+0x01, 0x00, 0x04, 0x02, 0x04, 0x02, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01,
+0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x0b, 0x00, 0x00, 0x00, 0x69, 0x64,
+0x65, 0x6e, 0x74, 0x69, 0x66, 0x69, 0x65, 0x72, 0x3f, 0x00, 0x06, 0x00,
+0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00,
+0x04, 0x01, 0x01, 0x1c, 0x00, 0x00, 0x00, 0x02, 0x02, 0x00, 0x00, 0x00,
+0x3d, 0x3e, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x10, 0x00, 0x04,
+0x00, 0x2a, 0x02, 0x02, 0x01, 0x00, 0x03, 0x02, 0x00, 0x01, 0x02, 0x04,
+0x00, 0x02, 0x01, 0x0a, 0x01, 0x01, 0x01, 0x01, 0x00, 0x04, 0x01, 0x01,
+0x0c, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x61, 0x64,
+0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x07, 0x02,
+0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02,
+0x0f, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x6b, 0x65, 0x2d, 0x69, 0x64, 0x65,
+0x6e, 0x74, 0x69, 0x66, 0x69, 0x65, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02,
+0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x04, 0x03, 0x0d, 0x03, 0x01, 0x03,
+0x01, 0x00, 0x05, 0x00, 0x01, 0x11, 0x00, 0x00, 0x00, 0x02, 0x0c, 0x00,
+0x00, 0x00, 0x69, 0x64, 0x65, 0x6e, 0x74, 0x69, 0x66, 0x69, 0x65, 0x72,
+0x3d, 0x3f, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x05, 0x01, 0x04, 0x02,
+0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x02,
+0x03, 0x23, 0x00, 0x00, 0x00, 0x02, 0x0f, 0x00, 0x00, 0x00, 0x6d, 0x61,
+0x6b, 0x65, 0x2d, 0x69, 0x64, 0x65, 0x6e, 0x74, 0x69, 0x66, 0x69, 0x65,
+0x72, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x74, 0x6d, 0x70, 0x00, 0x02,
+0x03, 0x00, 0x00, 0x00, 0x63, 0x61, 0x72, 0x00, 0x04, 0x00, 0x00, 0x01,
+0x08, 0x00, 0x13, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x03, 0x02,
+0x01, 0x04, 0x03, 0x09, 0x03, 0x01, 0x03, 0x06, 0x00, 0x02, 0x02, 0x01,
+0x01, 0x04, 0x02, 0x04, 0x02, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x00,
+0x0d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x01, 0x05, 0x01, 0x04,
+0x02, 0x00, 0x01, 0x01, 0x02, 0x02, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00,
+0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x6c, 0x65, 0x74, 0x00, 0x04,
+0x00, 0x2a, 0x02, 0x02, 0x01, 0x00, 0x03, 0x02, 0x00, 0x01, 0x02, 0x01,
+0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00,
+0x00, 0x63, 0x61, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
+0x02, 0x07, 0x02, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00,
+0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00,
+0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x0b, 0x03,
 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02,
 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00,
-0x02, 0x01, 0x00, 0x04, 0x02, 0x2a, 0x0e, 0x04, 0x03, 0x00, 0x01, 0x01,
+0x02, 0x01, 0x00, 0x04, 0x02, 0x03, 0x02, 0x04, 0x03, 0x00, 0x01, 0x01,
 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x04,
 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02,
 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00,
-0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00,
-0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
-0x02, 0x0c, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05,
-0x00, 0x01, 0x11, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63,
-0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x12, 0x01, 0x04,
-0x02, 0x11, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04,
-0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63,
-0x64, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x05,
-0x02, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00,
-0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00,
-0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x1b, 0x0b, 0x04, 0x03, 0x00, 0x01,
-0x01, 0x03, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02,
-0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x64, 0x00, 0x04, 0x00, 0x2b,
-0x02, 0x02, 0x01, 0x00, 0x03, 0x02, 0x00, 0x01, 0x02, 0x01, 0x00, 0x04,
-0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63,
-0x64, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x0b,
-0x02, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00,
+0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00,
+0x63, 0x64, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
+0x0b, 0x02, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00,
+0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x61, 0x64, 0x72, 0x00, 0x06,
+0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01,
+0x00, 0x05, 0x01, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00,
+0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
+0x04, 0x02, 0x07, 0x02, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01,
+0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f,
+0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x01,
+0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x01, 0x01,
+0x0c, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e,
+0x64, 0x00, 0x04, 0x00, 0x33, 0x02, 0x02, 0x01, 0x00, 0x03, 0x02, 0x00,
+0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02,
+0x04, 0x00, 0x00, 0x00, 0x63, 0x64, 0x64, 0x72, 0x00, 0x06, 0x00, 0x00,
+0x02, 0x01, 0x00, 0x04, 0x02, 0x15, 0x02, 0x01, 0x02, 0x01, 0x00, 0x05,
+0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63,
+0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
+0x01, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01,
+0x01, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f,
+0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00,
+0x01, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00,
+0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00,
+0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x04, 0x01, 0x04, 0x03,
+0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00,
+0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06,
+0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x0e, 0x02, 0x04, 0x03, 0x00,
+0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00,
 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00,
-0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x01, 0x01, 0x04, 0x03, 0x00, 0x01,
+0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x2a, 0x0e, 0x04, 0x03, 0x00, 0x01,
 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x02,
 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00,
 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x0b, 0x03, 0x01, 0x03, 0x01,
 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00,
 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
-0x04, 0x02, 0x04, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00,
-0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00,
-0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
-0x02, 0x07, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05,
-0x00, 0x01, 0x11, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63,
-0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x0d, 0x01, 0x04,
-0x02, 0x22, 0x0e, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x03, 0x00, 0x04,
-0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63,
-0x64, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00,
-0x02, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00,
-0x02, 0x05, 0x00, 0x00, 0x00, 0x6e, 0x75, 0x6c, 0x6c, 0x3f, 0x00, 0x06,
-0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01,
-0x00, 0x05, 0x01, 0x02, 0x1f, 0x00, 0x00, 0x00, 0x02, 0x0f, 0x00, 0x00,
-0x00, 0x6d, 0x61, 0x6b, 0x65, 0x2d, 0x69, 0x64, 0x65, 0x6e, 0x74, 0x69,
-0x66, 0x69, 0x65, 0x72, 0x00, 0x02, 0x02, 0x00, 0x00, 0x00, 0x69, 0x74,
-0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x0c, 0x00, 0x04, 0x00, 0x02,
-0x01, 0x0a, 0x01, 0x01, 0x01, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x03,
-0x02, 0x01, 0x04, 0x03, 0x02, 0x03, 0x01, 0x03, 0x01, 0x00, 0x04, 0x01,
-0x00, 0x0d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x01, 0x03, 0x01,
-0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x02, 0x00, 0x04, 0x01, 0x01, 0x0c,
-0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x6c, 0x65, 0x74, 0x00,
-0x04, 0x00, 0x22, 0x02, 0x02, 0x01, 0x00, 0x03, 0x02, 0x00, 0x01, 0x02,
-0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00,
-0x00, 0x00, 0x63, 0x61, 0x64, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
-0x00, 0x04, 0x02, 0x05, 0x02, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x01,
-0x0e, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e,
-0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01,
-0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00,
+0x04, 0x02, 0x0c, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00,
+0x05, 0x00, 0x01, 0x11, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00,
+0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x12, 0x01,
+0x04, 0x02, 0x11, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00,
+0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00,
+0x63, 0x64, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
+0x05, 0x02, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00,
 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06,
-0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x03, 0x02, 0x04, 0x03, 0x00,
+0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x1b, 0x0b, 0x04, 0x03, 0x00,
+0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00,
+0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x64, 0x00, 0x04, 0x00,
+0x2b, 0x02, 0x02, 0x01, 0x00, 0x03, 0x02, 0x00, 0x01, 0x02, 0x01, 0x00,
+0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00,
+0x63, 0x64, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
+0x0b, 0x02, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00,
+0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06,
+0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x01, 0x01, 0x04, 0x03, 0x00,
 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00, 0x00, 0x00,
 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00,
 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x0b, 0x03, 0x01, 0x03,
-0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x02, 0x00,
-0x00, 0x00, 0x6f, 0x72, 0x00, 0x04, 0x00, 0x27, 0x02, 0x02, 0x01, 0x00,
-0x03, 0x02, 0x00, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00,
-0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x64, 0x64, 0x72, 0x00,
-0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x0a, 0x02, 0x01, 0x02,
 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00,
 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
-0x00, 0x04, 0x02, 0x01, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01,
-0x00, 0x05, 0x01, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00,
+0x00, 0x04, 0x02, 0x04, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01,
+0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00,
 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
-0x04, 0x02, 0x00, 0x01, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01,
-0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f,
-0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x09,
-0x02, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01,
-0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e,
-0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x0a, 0x02,
-0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10,
-0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73,
-0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x1e, 0x0e, 0x04,
-0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00,
+0x04, 0x02, 0x07, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00,
+0x05, 0x00, 0x01, 0x11, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00,
+0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x0d, 0x01,
+0x04, 0x02, 0x22, 0x0e, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x03, 0x00,
+0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00,
+0x63, 0x64, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
+0x00, 0x02, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00,
+0x00, 0x02, 0x05, 0x00, 0x00, 0x00, 0x6e, 0x75, 0x6c, 0x6c, 0x3f, 0x00,
+0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02,
+0x01, 0x00, 0x05, 0x01, 0x02, 0x1f, 0x00, 0x00, 0x00, 0x02, 0x0f, 0x00,
+0x00, 0x00, 0x6d, 0x61, 0x6b, 0x65, 0x2d, 0x69, 0x64, 0x65, 0x6e, 0x74,
+0x69, 0x66, 0x69, 0x65, 0x72, 0x00, 0x02, 0x02, 0x00, 0x00, 0x00, 0x69,
+0x74, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x0c, 0x00, 0x04, 0x00,
+0x02, 0x01, 0x0a, 0x01, 0x01, 0x01, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
+0x03, 0x02, 0x01, 0x04, 0x03, 0x02, 0x03, 0x01, 0x03, 0x01, 0x00, 0x04,
+0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x01, 0x03,
+0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x02, 0x00, 0x04, 0x01, 0x01,
+0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x6c, 0x65, 0x74,
+0x00, 0x04, 0x00, 0x22, 0x02, 0x02, 0x01, 0x00, 0x03, 0x02, 0x00, 0x01,
+0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x04,
+0x00, 0x00, 0x00, 0x63, 0x61, 0x64, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02,
+0x01, 0x00, 0x04, 0x02, 0x05, 0x02, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01,
+0x01, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f,
+0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00,
+0x01, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00,
 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00,
-0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x0b, 0x03,
-0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02,
-0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00,
-0x02, 0x01, 0x00, 0x04, 0x02, 0x08, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01,
-0x03, 0x01, 0x00, 0x05, 0x00, 0x01, 0x11, 0x00, 0x00, 0x00, 0x02, 0x04,
-0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x04,
-0x01, 0x0e, 0x01, 0x04, 0x02, 0x0d, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01,
-0x03, 0x03, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03,
-0x00, 0x00, 0x00, 0x63, 0x64, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
-0x00, 0x04, 0x02, 0x00, 0x02, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01,
-0x0c, 0x00, 0x00, 0x00, 0x02, 0x05, 0x00, 0x00, 0x00, 0x6e, 0x75, 0x6c,
-0x6c, 0x3f, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00,
-0x01, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x1c, 0x00, 0x00, 0x00,
-0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x64, 0x64, 0x72, 0x00, 0x04, 0x00,
-0x00, 0x01, 0x08, 0x00, 0x0c, 0x00, 0x04, 0x00, 0x02, 0x01, 0x09, 0x01,
-0x01, 0x01, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x02, 0x02,
-0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02,
-0x05, 0x00, 0x00, 0x00, 0x6e, 0x75, 0x6c, 0x6c, 0x3f, 0x00, 0x06, 0x00,
-0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00,
-0x04, 0x01, 0x02, 0x21, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00,
-0x63, 0x61, 0x64, 0x72, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x61,
-0x64, 0x72, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x11, 0x00, 0x06,
-0x00, 0x00, 0x04, 0x01, 0x04, 0x01, 0x04, 0x02, 0x04, 0x02, 0x01, 0x02,
-0x06, 0x00, 0x01, 0x02, 0x01, 0x00, 0x04, 0x02, 0x04, 0x02, 0x01, 0x02,
-0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00,
-0x00, 0x00, 0x61, 0x6e, 0x64, 0x00, 0x04, 0x00, 0x22, 0x02, 0x02, 0x01,
+0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x03, 0x02, 0x04, 0x03,
+0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00, 0x00,
+0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06,
+0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x0b, 0x03, 0x01,
+0x03, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x02,
+0x00, 0x00, 0x00, 0x6f, 0x72, 0x00, 0x04, 0x00, 0x27, 0x02, 0x02, 0x01,
 0x00, 0x03, 0x02, 0x00, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c,
 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x64, 0x64, 0x72,
-0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x06, 0x02, 0x01,
+0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x0a, 0x02, 0x01,
 0x02, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04,
 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02,
 0x01, 0x00, 0x04, 0x02, 0x01, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03,
-0x01, 0x00, 0x05, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00,
+0x01, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00,
 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
-0x00, 0x0a, 0x02, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01,
+0x00, 0x04, 0x02, 0x00, 0x01, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05,
+0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63,
+0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
+0x09, 0x02, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01,
+0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f,
+0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x0a,
+0x02, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01,
 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e,
-0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x01, 0x01,
-0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10,
+0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x1e, 0x0e,
+0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0e,
 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73,
-0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x05, 0x01, 0x04,
-0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x00, 0x01, 0x11, 0x00,
-0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00,
-0x06, 0x00, 0x00, 0x04, 0x01, 0x0b, 0x01, 0x04, 0x02, 0x19, 0x0e, 0x04,
-0x03, 0x00, 0x01, 0x01, 0x03, 0x03, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00,
-0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x61, 0x64, 0x72, 0x00,
-0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x01, 0x02,
-0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x0b, 0x00,
-0x00, 0x00, 0x69, 0x64, 0x65, 0x6e, 0x74, 0x69, 0x66, 0x69, 0x65, 0x72,
-0x3f, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01,
-0x01, 0x02, 0x01, 0x00, 0x04, 0x02, 0x02, 0x20, 0x00, 0x00, 0x00, 0x02,
-0x03, 0x00, 0x00, 0x00, 0x63, 0x64, 0x72, 0x00, 0x02, 0x03, 0x00, 0x00,
-0x00, 0x63, 0x64, 0x72, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x10,
-0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x02, 0x02, 0x01,
-0x02, 0x06, 0x00, 0x01, 0x02, 0x01, 0x01, 0x04, 0x02, 0x02, 0x02, 0x01,
+0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x0b,
+0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00,
+0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00,
+0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x08, 0x01, 0x04, 0x03, 0x00, 0x01,
+0x01, 0x03, 0x01, 0x00, 0x05, 0x00, 0x01, 0x11, 0x00, 0x00, 0x00, 0x02,
+0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00,
+0x04, 0x01, 0x0e, 0x01, 0x04, 0x02, 0x0d, 0x01, 0x04, 0x03, 0x00, 0x01,
+0x01, 0x03, 0x03, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02,
+0x03, 0x00, 0x00, 0x00, 0x63, 0x64, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02,
+0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01,
+0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x05, 0x00, 0x00, 0x00, 0x6e, 0x75,
+0x6c, 0x6c, 0x3f, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
+0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x1c, 0x00, 0x00,
+0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x64, 0x64, 0x72, 0x00, 0x04,
+0x00, 0x00, 0x01, 0x08, 0x00, 0x0c, 0x00, 0x04, 0x00, 0x02, 0x01, 0x09,
+0x01, 0x01, 0x01, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x02,
+0x02, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00,
+0x02, 0x05, 0x00, 0x00, 0x00, 0x6e, 0x75, 0x6c, 0x6c, 0x3f, 0x00, 0x06,
+0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01,
+0x00, 0x04, 0x01, 0x02, 0x21, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00,
+0x00, 0x63, 0x61, 0x64, 0x72, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63,
+0x61, 0x64, 0x72, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x11, 0x00,
+0x06, 0x00, 0x00, 0x04, 0x01, 0x04, 0x01, 0x04, 0x02, 0x04, 0x02, 0x01,
+0x02, 0x06, 0x00, 0x01, 0x02, 0x01, 0x00, 0x04, 0x02, 0x04, 0x02, 0x01,
 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03,
+0x00, 0x00, 0x00, 0x61, 0x6e, 0x64, 0x00, 0x04, 0x00, 0x22, 0x02, 0x02,
+0x01, 0x00, 0x03, 0x02, 0x00, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01,
+0x0c, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x64, 0x64,
+0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x06, 0x02,
+0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02,
+0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00,
+0x02, 0x01, 0x00, 0x04, 0x02, 0x01, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01,
+0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x04,
+0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02,
+0x01, 0x00, 0x0a, 0x02, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01,
+0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f,
+0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x01,
+0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01,
+0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e,
+0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x05, 0x01,
+0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x00, 0x01, 0x11,
+0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73,
+0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x0b, 0x01, 0x04, 0x02, 0x19, 0x0e,
+0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x03, 0x00, 0x04, 0x01, 0x01, 0x0c,
+0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x61, 0x64, 0x72,
+0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x01,
+0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x0b,
+0x00, 0x00, 0x00, 0x69, 0x64, 0x65, 0x6e, 0x74, 0x69, 0x66, 0x69, 0x65,
+0x72, 0x3f, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00,
+0x01, 0x01, 0x02, 0x01, 0x00, 0x04, 0x02, 0x02, 0x20, 0x00, 0x00, 0x00,
+0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x64, 0x72, 0x00, 0x02, 0x03, 0x00,
+0x00, 0x00, 0x63, 0x64, 0x72, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00,
+0x10, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x02, 0x02,
+0x01, 0x02, 0x06, 0x00, 0x01, 0x02, 0x01, 0x01, 0x04, 0x02, 0x02, 0x02,
+0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02,
+0x03, 0x00, 0x00, 0x00, 0x63, 0x61, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02,
+0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01,
+0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x64,
+0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x04, 0x02,
+0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02,
+0x03, 0x00, 0x00, 0x00, 0x63, 0x64, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02,
+0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01,
+0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x61,
+0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01,
+0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02,
+0x03, 0x00, 0x00, 0x00, 0x63, 0x64, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02,
+0x01, 0x00, 0x04, 0x02, 0x07, 0x02, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01,
+0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x64,
+0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01,
+0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02,
+0x03, 0x00, 0x00, 0x00, 0x63, 0x64, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02,
+0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x06, 0x01,
+0x00, 0x15, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x01, 0x0a, 0x01,
+0x04, 0x02, 0x06, 0x01, 0x04, 0x03, 0x03, 0x01, 0x04, 0x04, 0x00, 0x01,
+0x01, 0x04, 0x04, 0x00, 0x05, 0x01, 0x02, 0x0f, 0x00, 0x00, 0x00, 0x02,
+0x03, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x70, 0x00, 0x02, 0x03, 0x00, 0x00,
+0x00, 0x63, 0x61, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x06,
+0x02, 0x01, 0x04, 0x03, 0x00, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01,
+0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f,
+0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x01,
+0x02, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01,
+0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e,
+0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01,
+0x04, 0x03, 0x02, 0x04, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10,
+0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73,
+0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x1b, 0x09, 0x04,
+0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x02, 0x0f, 0x00,
+0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x70, 0x00, 0x02,
+0x04, 0x00, 0x00, 0x00, 0x63, 0x61, 0x64, 0x72, 0x00, 0x06, 0x00, 0x00,
+0x02, 0x01, 0x00, 0x06, 0x02, 0x01, 0x04, 0x03, 0x04, 0x03, 0x01, 0x03,
+0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00,
+0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
+0x00, 0x04, 0x02, 0x05, 0x02, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01,
+0x00, 0x05, 0x01, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00,
+0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
+0x04, 0x02, 0x00, 0x01, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01,
+0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f,
+0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x03,
+0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01,
+0x0e, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e,
+0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x0b, 0x02, 0x04, 0x03,
+0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00,
+0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06,
+0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x21, 0x0a, 0x04, 0x03, 0x00,
+0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x00, 0x01, 0x0f, 0x00, 0x00, 0x00,
+0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00,
+0x00, 0x04, 0x01, 0x0a, 0x01, 0x04, 0x02, 0x00, 0x01, 0x0b, 0x03, 0x01,
+0x03, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03,
 0x00, 0x00, 0x00, 0x63, 0x61, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
 0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01,
 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x64, 0x72,
 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x04, 0x02, 0x01,
 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03,
 0x00, 0x00, 0x00, 0x63, 0x64, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
-0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01,
-0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x61, 0x72,
-0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01,
-0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03,
-0x00, 0x00, 0x00, 0x63, 0x64, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
-0x00, 0x04, 0x02, 0x07, 0x02, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01,
-0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x64, 0x72,
-0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01,
-0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03,
-0x00, 0x00, 0x00, 0x63, 0x64, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
-0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x06, 0x01, 0x00,
-0x15, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x01, 0x0a, 0x01, 0x04,
-0x02, 0x06, 0x01, 0x04, 0x03, 0x03, 0x01, 0x04, 0x04, 0x00, 0x01, 0x01,
-0x04, 0x04, 0x00, 0x05, 0x01, 0x02, 0x0f, 0x00, 0x00, 0x00, 0x02, 0x03,
-0x00, 0x00, 0x00, 0x6d, 0x61, 0x70, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00,
-0x63, 0x61, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x06, 0x02,
-0x01, 0x04, 0x03, 0x00, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01,
-0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e,
-0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x01, 0x02,
-0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10,
-0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73,
-0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x04,
-0x03, 0x02, 0x04, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00,
-0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00,
-0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x1b, 0x09, 0x04, 0x03,
-0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x02, 0x0f, 0x00, 0x00,
-0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x70, 0x00, 0x02, 0x04,
-0x00, 0x00, 0x00, 0x63, 0x61, 0x64, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02,
-0x01, 0x00, 0x06, 0x02, 0x01, 0x04, 0x03, 0x04, 0x03, 0x01, 0x03, 0x01,
-0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00,
-0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
-0x04, 0x02, 0x05, 0x02, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00,
-0x05, 0x01, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00,
-0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
-0x02, 0x00, 0x01, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01,
-0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e,
-0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x03, 0x01,
-0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0e,
-0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73,
-0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x0b, 0x02, 0x04, 0x03, 0x00,
-0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00,
+0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x00,
+0x11, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x01, 0x06, 0x01, 0x04,
+0x02, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x03, 0x00, 0x05,
+0x01, 0x02, 0x0f, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x6d,
+0x61, 0x70, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x61, 0x72, 0x00,
+0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x06, 0x02, 0x01, 0x04, 0x03, 0x00,
+0x02, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00,
 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00,
-0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x21, 0x0a, 0x04, 0x03, 0x00, 0x01,
-0x01, 0x03, 0x01, 0x00, 0x05, 0x00, 0x01, 0x0f, 0x00, 0x00, 0x00, 0x02,
-0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00,
-0x04, 0x01, 0x0a, 0x01, 0x04, 0x02, 0x00, 0x01, 0x0b, 0x03, 0x01, 0x03,
-0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00,
-0x00, 0x00, 0x63, 0x61, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
-0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c,
-0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x64, 0x72, 0x00,
-0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x04, 0x02, 0x01, 0x02,
-0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00,
-0x00, 0x00, 0x63, 0x64, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
-0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x00, 0x11,
-0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x01, 0x06, 0x01, 0x04, 0x02,
-0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x03, 0x00, 0x05, 0x01,
-0x02, 0x0f, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x6d, 0x61,
-0x70, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x61, 0x72, 0x00, 0x06,
-0x00, 0x00, 0x02, 0x01, 0x00, 0x06, 0x02, 0x01, 0x04, 0x03, 0x00, 0x02,
+0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x04, 0x03, 0x01, 0x03,
 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02,
 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00,
-0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x04, 0x03, 0x01, 0x03, 0x01,
-0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04,
-0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02,
-0x01, 0x00, 0x04, 0x02, 0x16, 0x0a, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03,
-0x01, 0x00, 0x05, 0x01, 0x02, 0x0f, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00,
-0x00, 0x00, 0x6d, 0x61, 0x70, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63,
-0x61, 0x64, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x06, 0x02,
-0x01, 0x04, 0x03, 0x03, 0x02, 0x01, 0x03, 0x01, 0x00, 0x05, 0x00, 0x01,
-0x11, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e,
-0x73, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x04, 0x01, 0x04, 0x02, 0x01,
-0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x01, 0x05, 0x00, 0x03,
-0x0f, 0x00, 0x00, 0x00, 0x02, 0x05, 0x00, 0x00, 0x00, 0x65, 0x72, 0x72,
-0x6f, 0x72, 0x00, 0x01, 0x1f, 0x00, 0x00, 0x00, 0x69, 0x6e, 0x76, 0x61,
-0x6c, 0x69, 0x64, 0x20, 0x75, 0x73, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x61,
-0x75, 0x78, 0x69, 0x6c, 0x69, 0x61, 0x72, 0x79, 0x20, 0x73, 0x79, 0x6e,
-0x74, 0x61, 0x78, 0x00, 0x02, 0x10, 0x00, 0x00, 0x00, 0x75, 0x6e, 0x71,
-0x75, 0x6f, 0x74, 0x65, 0x2d, 0x73, 0x70, 0x6c, 0x69, 0x63, 0x69, 0x6e,
-0x67, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x00, 0x01, 0x03, 0x02, 0x01,
-0x03, 0x03, 0x02, 0x01, 0x03, 0x01, 0x01, 0x05, 0x00, 0x03, 0x0f, 0x00,
-0x00, 0x00, 0x02, 0x05, 0x00, 0x00, 0x00, 0x65, 0x72, 0x72, 0x6f, 0x72,
-0x00, 0x01, 0x1f, 0x00, 0x00, 0x00, 0x69, 0x6e, 0x76, 0x61, 0x6c, 0x69,
-0x64, 0x20, 0x75, 0x73, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x61, 0x75, 0x78,
-0x69, 0x6c, 0x69, 0x61, 0x72, 0x79, 0x20, 0x73, 0x79, 0x6e, 0x74, 0x61,
-0x78, 0x00, 0x02, 0x07, 0x00, 0x00, 0x00, 0x75, 0x6e, 0x71, 0x75, 0x6f,
-0x74, 0x65, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x00, 0x01, 0x03, 0x02,
+0x02, 0x01, 0x00, 0x04, 0x02, 0x16, 0x0a, 0x04, 0x03, 0x00, 0x01, 0x01,
+0x03, 0x01, 0x00, 0x05, 0x01, 0x02, 0x0f, 0x00, 0x00, 0x00, 0x02, 0x03,
+0x00, 0x00, 0x00, 0x6d, 0x61, 0x70, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00,
+0x63, 0x61, 0x64, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x06,
+0x02, 0x01, 0x04, 0x03, 0x03, 0x02, 0x01, 0x03, 0x01, 0x00, 0x05, 0x00,
+0x01, 0x11, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f,
+0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x04, 0x01, 0x04, 0x02,
+0x01, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x01, 0x05, 0x00,
+0x03, 0x0f, 0x00, 0x00, 0x00, 0x02, 0x05, 0x00, 0x00, 0x00, 0x65, 0x72,
+0x72, 0x6f, 0x72, 0x00, 0x01, 0x1f, 0x00, 0x00, 0x00, 0x69, 0x6e, 0x76,
+0x61, 0x6c, 0x69, 0x64, 0x20, 0x75, 0x73, 0x65, 0x20, 0x6f, 0x66, 0x20,
+0x61, 0x75, 0x78, 0x69, 0x6c, 0x69, 0x61, 0x72, 0x79, 0x20, 0x73, 0x79,
+0x6e, 0x74, 0x61, 0x78, 0x00, 0x02, 0x10, 0x00, 0x00, 0x00, 0x75, 0x6e,
+0x71, 0x75, 0x6f, 0x74, 0x65, 0x2d, 0x73, 0x70, 0x6c, 0x69, 0x63, 0x69,
+0x6e, 0x67, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x00, 0x01, 0x03, 0x02,
 0x01, 0x03, 0x03, 0x02, 0x01, 0x03, 0x01, 0x01, 0x05, 0x00, 0x03, 0x0f,
 0x00, 0x00, 0x00, 0x02, 0x05, 0x00, 0x00, 0x00, 0x65, 0x72, 0x72, 0x6f,
 0x72, 0x00, 0x01, 0x1f, 0x00, 0x00, 0x00, 0x69, 0x6e, 0x76, 0x61, 0x6c,
 0x69, 0x64, 0x20, 0x75, 0x73, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x61, 0x75,
 0x78, 0x69, 0x6c, 0x69, 0x61, 0x72, 0x79, 0x20, 0x73, 0x79, 0x6e, 0x74,
-0x61, 0x78, 0x00, 0x02, 0x02, 0x00, 0x00, 0x00, 0x3d, 0x3e, 0x00, 0x06,
-0x00, 0x00, 0x04, 0x01, 0x00, 0x01, 0x03, 0x02, 0x01, 0x03, 0x03, 0x02,
-0x01, 0x03, 0x01, 0x01, 0x05, 0x00, 0x03, 0x0f, 0x00, 0x00, 0x00, 0x02,
-0x05, 0x00, 0x00, 0x00, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x00, 0x01, 0x1f,
-0x00, 0x00, 0x00, 0x69, 0x6e, 0x76, 0x61, 0x6c, 0x69, 0x64, 0x20, 0x75,
-0x73, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x61, 0x75, 0x78, 0x69, 0x6c, 0x69,
-0x61, 0x72, 0x79, 0x20, 0x73, 0x79, 0x6e, 0x74, 0x61, 0x78, 0x00, 0x02,
-0x04, 0x00, 0x00, 0x00, 0x65, 0x6c, 0x73, 0x65, 0x00, 0x06, 0x00, 0x00,
-0x04, 0x01, 0x00, 0x01, 0x03, 0x02, 0x01, 0x03, 0x03, 0x02, 0x01, 0x03,
+0x61, 0x78, 0x00, 0x02, 0x07, 0x00, 0x00, 0x00, 0x75, 0x6e, 0x71, 0x75,
+0x6f, 0x74, 0x65, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x00, 0x01, 0x03,
+0x02, 0x01, 0x03, 0x03, 0x02, 0x01, 0x03, 0x01, 0x01, 0x05, 0x00, 0x03,
+0x0f, 0x00, 0x00, 0x00, 0x02, 0x05, 0x00, 0x00, 0x00, 0x65, 0x72, 0x72,
+0x6f, 0x72, 0x00, 0x01, 0x1f, 0x00, 0x00, 0x00, 0x69, 0x6e, 0x76, 0x61,
+0x6c, 0x69, 0x64, 0x20, 0x75, 0x73, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x61,
+0x75, 0x78, 0x69, 0x6c, 0x69, 0x61, 0x72, 0x79, 0x20, 0x73, 0x79, 0x6e,
+0x74, 0x61, 0x78, 0x00, 0x02, 0x02, 0x00, 0x00, 0x00, 0x3d, 0x3e, 0x00,
+0x06, 0x00, 0x00, 0x04, 0x01, 0x00, 0x01, 0x03, 0x02, 0x01, 0x03, 0x03,
+0x02, 0x01, 0x03, 0x01, 0x01, 0x05, 0x00, 0x03, 0x0f, 0x00, 0x00, 0x00,
+0x02, 0x05, 0x00, 0x00, 0x00, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x00, 0x01,
+0x1f, 0x00, 0x00, 0x00, 0x69, 0x6e, 0x76, 0x61, 0x6c, 0x69, 0x64, 0x20,
+0x75, 0x73, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x61, 0x75, 0x78, 0x69, 0x6c,
+0x69, 0x61, 0x72, 0x79, 0x20, 0x73, 0x79, 0x6e, 0x74, 0x61, 0x78, 0x00,
+0x02, 0x04, 0x00, 0x00, 0x00, 0x65, 0x6c, 0x73, 0x65, 0x00, 0x06, 0x00,
+0x00, 0x04, 0x01, 0x00, 0x01, 0x03, 0x02, 0x01, 0x03, 0x03, 0x02, 0x01,
+0x03, 0x03, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x06,
+0x00, 0x00, 0x00, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x00, 0x06, 0x00,
+0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x01, 0x02, 0x01, 0x00,
+0x05, 0x01, 0x01, 0x0f, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0x00,
+0x3d, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01,
+0x0d, 0x03, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x03, 0x24, 0x00,
+0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x61, 0x64, 0x72, 0x00,
+0x02, 0x05, 0x00, 0x00, 0x00, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x00, 0x01,
+0x16, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x6c, 0x66, 0x6f, 0x72, 0x6d, 0x65,
+0x64, 0x20, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x2d, 0x6d, 0x61, 0x63,
+0x72, 0x6f, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x10, 0x00, 0x06,
+0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x02, 0x02, 0x01, 0x02, 0x06,
+0x00, 0x01, 0x04, 0x01, 0x02, 0x01, 0x03, 0x02, 0x02, 0x04, 0x03, 0x02,
+0x02, 0x01, 0x03, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00,
+0x02, 0x0b, 0x00, 0x00, 0x00, 0x69, 0x64, 0x65, 0x6e, 0x74, 0x69, 0x66,
+0x69, 0x65, 0x72, 0x3f, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
+0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x03, 0x24, 0x00,
+0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x64, 0x72, 0x00, 0x02,
+0x05, 0x00, 0x00, 0x00, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x00, 0x01, 0x2c,
+0x00, 0x00, 0x00, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x2d, 0x6d, 0x61,
+0x63, 0x72, 0x6f, 0x3a, 0x20, 0x62, 0x69, 0x6e, 0x64, 0x69, 0x6e, 0x67,
+0x20, 0x74, 0x6f, 0x20, 0x6e, 0x6f, 0x6e, 0x2d, 0x76, 0x61, 0x72, 0x69,
+0x61, 0x62, 0x6c, 0x65, 0x20, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x00,
+0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x10, 0x00, 0x06, 0x00, 0x00, 0x02,
+0x01, 0x00, 0x04, 0x02, 0x04, 0x02, 0x01, 0x02, 0x06, 0x00, 0x01, 0x04,
+0x01, 0x04, 0x01, 0x03, 0x02, 0x02, 0x04, 0x03, 0x04, 0x02, 0x01, 0x03,
+0x01, 0x00, 0x05, 0x00, 0x01, 0x11, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00,
+0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01,
+0x05, 0x01, 0x04, 0x02, 0x0d, 0x08, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03,
 0x03, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x06, 0x00,
 0x00, 0x00, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x00, 0x06, 0x00, 0x00,
-0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x01, 0x02, 0x01, 0x00, 0x05,
-0x01, 0x01, 0x0f, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0x00, 0x3d,
-0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x0d,
-0x03, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x03, 0x24, 0x00, 0x00,
-0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x61, 0x64, 0x72, 0x00, 0x02,
-0x05, 0x00, 0x00, 0x00, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x00, 0x01, 0x16,
+0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x01, 0x02, 0x01, 0x00, 0x04,
+0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x01, 0x01,
+0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x02, 0x00, 0x05, 0x01, 0x01,
+0x0f, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x06,
+0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x0d, 0x03, 0x01,
+0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x03, 0x24, 0x00, 0x00, 0x00, 0x02,
+0x05, 0x00, 0x00, 0x00, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x00, 0x01, 0x10,
 0x00, 0x00, 0x00, 0x6d, 0x61, 0x6c, 0x66, 0x6f, 0x72, 0x6d, 0x65, 0x64,
-0x20, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x2d, 0x6d, 0x61, 0x63, 0x72,
-0x6f, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x10, 0x00, 0x06, 0x00,
-0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x02, 0x02, 0x01, 0x02, 0x06, 0x00,
-0x01, 0x04, 0x01, 0x02, 0x01, 0x03, 0x02, 0x02, 0x04, 0x03, 0x02, 0x02,
-0x01, 0x03, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02,
-0x0b, 0x00, 0x00, 0x00, 0x69, 0x64, 0x65, 0x6e, 0x74, 0x69, 0x66, 0x69,
-0x65, 0x72, 0x3f, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
-0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x03, 0x24, 0x00, 0x00,
-0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x64, 0x72, 0x00, 0x02, 0x05,
-0x00, 0x00, 0x00, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x00, 0x01, 0x2c, 0x00,
-0x00, 0x00, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x2d, 0x6d, 0x61, 0x63,
-0x72, 0x6f, 0x3a, 0x20, 0x62, 0x69, 0x6e, 0x64, 0x69, 0x6e, 0x67, 0x20,
-0x74, 0x6f, 0x20, 0x6e, 0x6f, 0x6e, 0x2d, 0x76, 0x61, 0x72, 0x69, 0x61,
-0x62, 0x6c, 0x65, 0x20, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x00, 0x04,
-0x00, 0x00, 0x01, 0x08, 0x00, 0x10, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
-0x00, 0x04, 0x02, 0x04, 0x02, 0x01, 0x02, 0x06, 0x00, 0x01, 0x04, 0x01,
-0x04, 0x01, 0x03, 0x02, 0x02, 0x04, 0x03, 0x04, 0x02, 0x01, 0x03, 0x01,
-0x00, 0x05, 0x00, 0x01, 0x11, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00,
-0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x05,
-0x01, 0x04, 0x02, 0x0d, 0x08, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x03,
-0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x06, 0x00, 0x00,
-0x00, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x00, 0x06, 0x00, 0x00, 0x02,
-0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01,
-0x00, 0x0d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x01, 0x01, 0x01,
-0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x02, 0x00, 0x05, 0x01, 0x01, 0x0f,
-0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x06, 0x00,
-0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x0d, 0x03, 0x01, 0x01,
-0x03, 0x01, 0x00, 0x05, 0x01, 0x03, 0x24, 0x00, 0x00, 0x00, 0x02, 0x05,
-0x00, 0x00, 0x00, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x00, 0x01, 0x10, 0x00,
-0x00, 0x00, 0x6d, 0x61, 0x6c, 0x66, 0x6f, 0x72, 0x6d, 0x65, 0x64, 0x20,
-0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00,
-0x63, 0x61, 0x64, 0x72, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x14,
-0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x01, 0x01, 0x03, 0x02, 0x01, 0x04,
-0x03, 0x03, 0x02, 0x01, 0x03, 0x06, 0x00, 0x02, 0x02, 0x01, 0x00, 0x04,
-0x02, 0x03, 0x02, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00,
-0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x01, 0x02, 0x01, 0x04, 0x02, 0x00,
-0x01, 0x01, 0x02, 0x02, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00,
-0x02, 0x0b, 0x00, 0x00, 0x00, 0x69, 0x64, 0x65, 0x6e, 0x74, 0x69, 0x66,
-0x69, 0x65, 0x72, 0x3f, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
-0x02, 0x00, 0x02, 0x01, 0x02, 0x01, 0x00, 0x05, 0x02, 0x02, 0x23, 0x00,
-0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x02, 0x05, 0x00,
-0x00, 0x00, 0x70, 0x61, 0x69, 0x72, 0x3f, 0x00, 0x04, 0x00, 0x00, 0x01,
-0x08, 0x00, 0x13, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
-0x04, 0x02, 0x0d, 0x03, 0x03, 0x01, 0x03, 0x06, 0x00, 0x01, 0x02, 0x01,
-0x01, 0x04, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x03,
-0x24, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x64, 0x72,
-0x00, 0x02, 0x05, 0x00, 0x00, 0x00, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x00,
-0x01, 0x10, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x6c, 0x66, 0x6f, 0x72, 0x6d,
-0x65, 0x64, 0x20, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x00, 0x04, 0x00,
-0x00, 0x01, 0x08, 0x00, 0x10, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
-0x04, 0x02, 0x07, 0x02, 0x01, 0x02, 0x06, 0x00, 0x01, 0x04, 0x01, 0x02,
-0x01, 0x03, 0x02, 0x02, 0x04, 0x03, 0x07, 0x02, 0x01, 0x03, 0x01, 0x00,
-0x05, 0x00, 0x01, 0x11, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00,
-0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x03, 0x01,
-0x04, 0x02, 0x0f, 0x02, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00,
-0x05, 0x01, 0x03, 0x24, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00,
-0x63, 0x61, 0x72, 0x00, 0x02, 0x05, 0x00, 0x00, 0x00, 0x65, 0x72, 0x72,
-0x6f, 0x72, 0x00, 0x01, 0x26, 0x00, 0x00, 0x00, 0x64, 0x65, 0x66, 0x69,
-0x6e, 0x65, 0x3a, 0x20, 0x62, 0x69, 0x6e, 0x64, 0x69, 0x6e, 0x67, 0x20,
-0x74, 0x6f, 0x20, 0x6e, 0x6f, 0x6e, 0x2d, 0x76, 0x61, 0x72, 0x61, 0x69,
-0x62, 0x6c, 0x65, 0x20, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x00, 0x04,
+0x20, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x00, 0x02, 0x04, 0x00, 0x00,
+0x00, 0x63, 0x61, 0x64, 0x72, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00,
+0x14, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x01, 0x01, 0x03, 0x02, 0x01,
+0x04, 0x03, 0x03, 0x02, 0x01, 0x03, 0x06, 0x00, 0x02, 0x02, 0x01, 0x00,
+0x04, 0x02, 0x03, 0x02, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d,
+0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x01, 0x02, 0x01, 0x04, 0x02,
+0x00, 0x01, 0x01, 0x02, 0x02, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00,
+0x00, 0x02, 0x0b, 0x00, 0x00, 0x00, 0x69, 0x64, 0x65, 0x6e, 0x74, 0x69,
+0x66, 0x69, 0x65, 0x72, 0x3f, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
+0x04, 0x02, 0x00, 0x02, 0x01, 0x02, 0x01, 0x00, 0x05, 0x02, 0x02, 0x23,
+0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x02, 0x05,
+0x00, 0x00, 0x00, 0x70, 0x61, 0x69, 0x72, 0x3f, 0x00, 0x04, 0x00, 0x00,
+0x01, 0x08, 0x00, 0x13, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
+0x02, 0x04, 0x02, 0x0d, 0x03, 0x03, 0x01, 0x03, 0x06, 0x00, 0x01, 0x02,
+0x01, 0x01, 0x04, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01,
+0x03, 0x24, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x64,
+0x72, 0x00, 0x02, 0x05, 0x00, 0x00, 0x00, 0x65, 0x72, 0x72, 0x6f, 0x72,
+0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x6c, 0x66, 0x6f, 0x72,
+0x6d, 0x65, 0x64, 0x20, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x00, 0x04,
 0x00, 0x00, 0x01, 0x08, 0x00, 0x10, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
-0x00, 0x04, 0x02, 0x02, 0x02, 0x01, 0x02, 0x06, 0x00, 0x01, 0x04, 0x01,
+0x00, 0x04, 0x02, 0x07, 0x02, 0x01, 0x02, 0x06, 0x00, 0x01, 0x04, 0x01,
 0x02, 0x01, 0x03, 0x02, 0x02, 0x04, 0x03, 0x07, 0x02, 0x01, 0x03, 0x01,
-0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00,
-0x00, 0x63, 0x64, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
-0x02, 0x03, 0x02, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00,
-0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x64, 0x64, 0x72, 0x00,
-0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x09, 0x02, 0x01, 0x02,
+0x00, 0x05, 0x00, 0x01, 0x11, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00,
+0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x03,
+0x01, 0x04, 0x02, 0x0f, 0x02, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01,
+0x00, 0x05, 0x01, 0x03, 0x24, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00,
+0x00, 0x63, 0x61, 0x72, 0x00, 0x02, 0x05, 0x00, 0x00, 0x00, 0x65, 0x72,
+0x72, 0x6f, 0x72, 0x00, 0x01, 0x26, 0x00, 0x00, 0x00, 0x64, 0x65, 0x66,
+0x69, 0x6e, 0x65, 0x3a, 0x20, 0x62, 0x69, 0x6e, 0x64, 0x69, 0x6e, 0x67,
+0x20, 0x74, 0x6f, 0x20, 0x6e, 0x6f, 0x6e, 0x2d, 0x76, 0x61, 0x72, 0x61,
+0x69, 0x62, 0x6c, 0x65, 0x20, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x00,
+0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x10, 0x00, 0x06, 0x00, 0x00, 0x02,
+0x01, 0x00, 0x04, 0x02, 0x02, 0x02, 0x01, 0x02, 0x06, 0x00, 0x01, 0x04,
+0x01, 0x02, 0x01, 0x03, 0x02, 0x02, 0x04, 0x03, 0x07, 0x02, 0x01, 0x03,
+0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00,
+0x00, 0x00, 0x63, 0x64, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
+0x04, 0x02, 0x03, 0x02, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c,
+0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x64, 0x64, 0x72,
+0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x09, 0x02, 0x01,
+0x02, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04,
+0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02,
+0x01, 0x00, 0x04, 0x02, 0x01, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03,
 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00,
 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
-0x00, 0x04, 0x02, 0x01, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01,
-0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00,
-0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
-0x04, 0x02, 0x12, 0x0a, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00,
-0x05, 0x01, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00,
-0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
-0x02, 0x00, 0x01, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01,
-0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e,
-0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x05, 0x01,
-0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x00, 0x01, 0x11,
-0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73,
-0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x09, 0x01, 0x04, 0x02, 0x15, 0x09,
-0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x03, 0x00, 0x04, 0x01, 0x01, 0x0c,
-0x00, 0x00, 0x00, 0x02, 0x06, 0x00, 0x00, 0x00, 0x6c, 0x65, 0x6e, 0x67,
-0x74, 0x68, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00,
-0x02, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0f, 0x00, 0x00, 0x00,
-0x02, 0x01, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
-0x00, 0x04, 0x02, 0x00, 0x01, 0x0d, 0x03, 0x01, 0x01, 0x03, 0x01, 0x00,
-0x05, 0x01, 0x03, 0x24, 0x00, 0x00, 0x00, 0x02, 0x05, 0x00, 0x00, 0x00,
-0x65, 0x72, 0x72, 0x6f, 0x72, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x6d,
-0x61, 0x6c, 0x66, 0x6f, 0x72, 0x6d, 0x65, 0x64, 0x20, 0x6c, 0x61, 0x6d,
-0x62, 0x64, 0x61, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x61, 0x64,
-0x72, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x14, 0x00, 0x06, 0x00,
-0x00, 0x04, 0x01, 0x02, 0x01, 0x03, 0x02, 0x01, 0x04, 0x03, 0x02, 0x02,
-0x01, 0x03, 0x06, 0x00, 0x02, 0x02, 0x01, 0x00, 0x04, 0x02, 0x02, 0x02,
-0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x04,
-0x00, 0x08, 0x02, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02,
-0x01, 0x00, 0x05, 0x01, 0x03, 0x24, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00,
-0x00, 0x00, 0x63, 0x61, 0x64, 0x72, 0x00, 0x02, 0x05, 0x00, 0x00, 0x00,
-0x65, 0x72, 0x72, 0x6f, 0x72, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x6d,
-0x61, 0x6c, 0x66, 0x6f, 0x72, 0x6d, 0x65, 0x64, 0x20, 0x6c, 0x61, 0x6d,
-0x62, 0x64, 0x61, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x10, 0x00,
-0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x04, 0x02, 0x01, 0x02,
-0x06, 0x00, 0x01, 0x04, 0x01, 0x04, 0x01, 0x03, 0x02, 0x02, 0x04, 0x03,
-0x04, 0x02, 0x01, 0x03, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00,
-0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x64, 0x64, 0x72, 0x00, 0x06,
-0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x05, 0x02, 0x01, 0x02, 0x01,
-0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00,
+0x00, 0x04, 0x02, 0x12, 0x0a, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01,
+0x00, 0x05, 0x01, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00,
 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
-0x04, 0x02, 0x0c, 0x0b, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00,
-0x05, 0x01, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00,
-0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
-0x02, 0x00, 0x01, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01,
-0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e,
-0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x03, 0x01,
-0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x00, 0x01, 0x11,
-0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73,
-0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x09, 0x01, 0x04, 0x02, 0x0f, 0x03,
-0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x03, 0x00, 0x03, 0x02, 0x00, 0x08,
-0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01,
-0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x06, 0x00, 0x00,
-0x00, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x00, 0x06, 0x00, 0x00, 0x02,
-0x01, 0x00, 0x04, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01,
-0x01, 0x0f, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0x00, 0x3d, 0x00,
-0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x0d, 0x03,
-0x03, 0x01, 0x03, 0x01, 0x00, 0x04, 0x01, 0x01, 0x1c, 0x00, 0x00, 0x00,
-0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x61, 0x64, 0x72, 0x00, 0x04, 0x00,
-0x00, 0x01, 0x08, 0x00, 0x10, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
-0x04, 0x02, 0x03, 0x02, 0x01, 0x02, 0x04, 0x00, 0x02, 0x01, 0x0a, 0x01,
-0x01, 0x01, 0x01, 0x00, 0x04, 0x00, 0x01, 0x0d, 0x00, 0x00, 0x00, 0x02,
-0x0b, 0x00, 0x00, 0x00, 0x69, 0x64, 0x65, 0x6e, 0x74, 0x69, 0x66, 0x69,
-0x65, 0x72, 0x3f, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x03, 0x01, 0x04,
-0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x03, 0x24, 0x00,
-0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x64, 0x72, 0x00, 0x02,
-0x05, 0x00, 0x00, 0x00, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x00, 0x01, 0x0e,
-0x00, 0x00, 0x00, 0x6d, 0x61, 0x6c, 0x66, 0x6f, 0x72, 0x6d, 0x65, 0x64,
-0x20, 0x73, 0x65, 0x74, 0x21, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00,
-0x10, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x01, 0x02,
-0x01, 0x02, 0x06, 0x00, 0x01, 0x04, 0x01, 0x01, 0x01, 0x03, 0x02, 0x02,
-0x04, 0x03, 0x01, 0x02, 0x01, 0x03, 0x01, 0x00, 0x05, 0x00, 0x01, 0x11,
-0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73,
-0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x02, 0x01, 0x04, 0x02, 0x07, 0x06,
-0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x03, 0x00, 0x04, 0x01, 0x01, 0x0c,
-0x00, 0x00, 0x00, 0x02, 0x06, 0x00, 0x00, 0x00, 0x6c, 0x65, 0x6e, 0x67,
-0x74, 0x68, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00,
+0x04, 0x02, 0x00, 0x01, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01,
+0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f,
+0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x05,
+0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x00, 0x01,
+0x11, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e,
+0x73, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x09, 0x01, 0x04, 0x02, 0x15,
+0x09, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x03, 0x00, 0x04, 0x01, 0x01,
+0x0c, 0x00, 0x00, 0x00, 0x02, 0x06, 0x00, 0x00, 0x00, 0x6c, 0x65, 0x6e,
+0x67, 0x74, 0x68, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
+0x00, 0x02, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0f, 0x00, 0x00,
+0x00, 0x02, 0x01, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x06, 0x00, 0x00, 0x02,
+0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x0d, 0x03, 0x01, 0x01, 0x03, 0x01,
+0x00, 0x05, 0x01, 0x03, 0x24, 0x00, 0x00, 0x00, 0x02, 0x05, 0x00, 0x00,
+0x00, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00,
+0x6d, 0x61, 0x6c, 0x66, 0x6f, 0x72, 0x6d, 0x65, 0x64, 0x20, 0x6c, 0x61,
+0x6d, 0x62, 0x64, 0x61, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x61,
+0x64, 0x72, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x14, 0x00, 0x06,
+0x00, 0x00, 0x04, 0x01, 0x02, 0x01, 0x03, 0x02, 0x01, 0x04, 0x03, 0x02,
+0x02, 0x01, 0x03, 0x06, 0x00, 0x02, 0x02, 0x01, 0x00, 0x04, 0x02, 0x02,
 0x02, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00,
-0x02, 0x00, 0x00, 0x04, 0x01, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01,
-0x02, 0x02, 0x00, 0x05, 0x01, 0x01, 0x0f, 0x00, 0x00, 0x00, 0x02, 0x01,
-0x00, 0x00, 0x00, 0x3d, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
-0x02, 0x00, 0x02, 0x0d, 0x03, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01,
-0x01, 0x1f, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0x00, 0x3d, 0x00,
-0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x0c, 0x00, 0x04, 0x00, 0x01, 0x01,
-0x0c, 0x01, 0x01, 0x01, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
-0x01, 0x02, 0x0d, 0x03, 0x02, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x02,
-0x24, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x61, 0x64,
-0x72, 0x00, 0x02, 0x01, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x00,
-0x01, 0x08, 0x00, 0x11, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x02, 0x01,
-0x04, 0x02, 0x04, 0x02, 0x01, 0x02, 0x06, 0x00, 0x01, 0x02, 0x01, 0x00,
-0x04, 0x02, 0x02, 0x02, 0x0d, 0x03, 0x03, 0x01, 0x03, 0x01, 0x00, 0x04,
-0x02, 0x02, 0x20, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63,
-0x64, 0x72, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x61, 0x64, 0x72,
-0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x10, 0x00, 0x06, 0x00, 0x00,
-0x02, 0x01, 0x00, 0x04, 0x02, 0x05, 0x02, 0x01, 0x02, 0x06, 0x00, 0x01,
-0x02, 0x01, 0x01, 0x04, 0x02, 0x05, 0x02, 0x01, 0x02, 0x01, 0x00, 0x05,
-0x00, 0x01, 0x11, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63,
-0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x04, 0x01, 0x04,
-0x02, 0x0a, 0x04, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04,
-0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63,
-0x64, 0x64, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
-0x06, 0x02, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00,
-0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06,
-0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x0b, 0x0b, 0x04, 0x03, 0x00,
-0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00, 0x00, 0x00,
-0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00,
-0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x0b, 0x03, 0x01, 0x03,
+0x04, 0x00, 0x08, 0x02, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01,
+0x02, 0x01, 0x00, 0x05, 0x01, 0x03, 0x24, 0x00, 0x00, 0x00, 0x02, 0x04,
+0x00, 0x00, 0x00, 0x63, 0x61, 0x64, 0x72, 0x00, 0x02, 0x05, 0x00, 0x00,
+0x00, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00,
+0x6d, 0x61, 0x6c, 0x66, 0x6f, 0x72, 0x6d, 0x65, 0x64, 0x20, 0x6c, 0x61,
+0x6d, 0x62, 0x64, 0x61, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x10,
+0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x04, 0x02, 0x01,
+0x02, 0x06, 0x00, 0x01, 0x04, 0x01, 0x04, 0x01, 0x03, 0x02, 0x02, 0x04,
+0x03, 0x04, 0x02, 0x01, 0x03, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00,
+0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x64, 0x64, 0x72, 0x00,
+0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x05, 0x02, 0x01, 0x02,
 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00,
 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
-0x00, 0x04, 0x02, 0x03, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01,
-0x00, 0x05, 0x00, 0x01, 0x11, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00,
-0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x08,
-0x01, 0x04, 0x02, 0x0e, 0x04, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x03,
-0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x06, 0x00, 0x00,
-0x00, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x00, 0x06, 0x00, 0x00, 0x02,
-0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01,
-0x00, 0x0d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x01, 0x01, 0x01,
-0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x02, 0x00, 0x05, 0x01, 0x01, 0x0f,
-0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x06, 0x00,
-0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x0d, 0x03, 0x03, 0x01,
-0x03, 0x01, 0x00, 0x05, 0x02, 0x02, 0x23, 0x00, 0x00, 0x00, 0x02, 0x04,
-0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x02, 0x01, 0x00, 0x00,
-0x00, 0x3d, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x10, 0x00, 0x06,
-0x00, 0x00, 0x02, 0x01, 0x00, 0x0c, 0x02, 0x0b, 0x03, 0x01, 0x03, 0x06,
-0x00, 0x01, 0x02, 0x01, 0x01, 0x04, 0x02, 0x01, 0x02, 0x0d, 0x03, 0x04,
-0x01, 0x03, 0x01, 0x00, 0x05, 0x00, 0x01, 0x11, 0x00, 0x00, 0x00, 0x02,
-0x06, 0x00, 0x00, 0x00, 0x61, 0x70, 0x70, 0x65, 0x6e, 0x64, 0x00, 0x06,
-0x00, 0x00, 0x04, 0x01, 0x02, 0x01, 0x04, 0x02, 0x04, 0x02, 0x04, 0x03,
-0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x03, 0x24, 0x00, 0x00,
-0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x64, 0x72, 0x00, 0x02, 0x05,
-0x00, 0x00, 0x00, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x00, 0x01, 0x0c, 0x00,
-0x00, 0x00, 0x6d, 0x61, 0x6c, 0x66, 0x6f, 0x72, 0x6d, 0x65, 0x64, 0x20,
-0x69, 0x66, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x10, 0x00, 0x06,
-0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x04, 0x02, 0x01, 0x02, 0x06,
-0x00, 0x01, 0x04, 0x01, 0x02, 0x01, 0x03, 0x02, 0x02, 0x04, 0x03, 0x04,
-0x02, 0x01, 0x03, 0x01, 0x00, 0x05, 0x00, 0x01, 0x11, 0x00, 0x00, 0x00,
-0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00,
-0x00, 0x04, 0x01, 0x03, 0x01, 0x04, 0x02, 0x08, 0x07, 0x04, 0x03, 0x00,
-0x01, 0x01, 0x03, 0x03, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00,
-0x02, 0x06, 0x00, 0x00, 0x00, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x00,
-0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x01, 0x02,
-0x01, 0x00, 0x05, 0x01, 0x01, 0x0f, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00,
-0x00, 0x00, 0x3d, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
-0x00, 0x01, 0x0d, 0x03, 0x02, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x03,
-0x24, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x61, 0x64,
-0x72, 0x00, 0x02, 0x05, 0x00, 0x00, 0x00, 0x65, 0x72, 0x72, 0x6f, 0x72,
-0x00, 0x01, 0x0f, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x6c, 0x66, 0x6f, 0x72,
-0x6d, 0x65, 0x64, 0x20, 0x71, 0x75, 0x6f, 0x74, 0x65, 0x00, 0x04, 0x00,
-0x00, 0x01, 0x08, 0x00, 0x10, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
-0x04, 0x02, 0x02, 0x02, 0x01, 0x02, 0x06, 0x00, 0x01, 0x04, 0x01, 0x02,
-0x01, 0x03, 0x02, 0x02, 0x04, 0x03, 0x02, 0x02, 0x01, 0x03, 0x01, 0x00,
-0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x01,
-0x03, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x02, 0x00, 0x04, 0x01,
-0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x05, 0x00, 0x00, 0x00, 0x70, 0x61,
-0x69, 0x72, 0x3f, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
-0x00, 0x02, 0x01, 0x02, 0x01, 0x00, 0x04, 0x02, 0x02, 0x20, 0x00, 0x00,
-0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x02,
-0x07, 0x00, 0x00, 0x00, 0x76, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x3f, 0x00,
-0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x10, 0x00, 0x04, 0x00, 0x16, 0x02,
-0x02, 0x01, 0x00, 0x03, 0x02, 0x00, 0x01, 0x02, 0x06, 0x00, 0x01, 0x02,
-0x01, 0x01, 0x04, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01,
-0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x61,
-0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x02, 0x02,
-0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x02,
-0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00,
-0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x0b, 0x03, 0x01, 0x03, 0x01,
-0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00,
+0x00, 0x04, 0x02, 0x0c, 0x0b, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01,
+0x00, 0x05, 0x01, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00,
 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
-0x04, 0x02, 0x0a, 0x0c, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00,
-0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00,
-0x63, 0x64, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
-0x05, 0x02, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00, 0x00,
+0x04, 0x02, 0x00, 0x01, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01,
+0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f,
+0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x03,
+0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x00, 0x01,
+0x11, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e,
+0x73, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x09, 0x01, 0x04, 0x02, 0x0f,
+0x03, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x03, 0x00, 0x03, 0x02, 0x00,
+0x08, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x06, 0x00,
+0x00, 0x00, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x00, 0x06, 0x00, 0x00,
+0x02, 0x01, 0x00, 0x04, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x00, 0x05,
+0x01, 0x01, 0x0f, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0x00, 0x3d,
+0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x0d,
+0x03, 0x03, 0x01, 0x03, 0x01, 0x00, 0x04, 0x01, 0x01, 0x1c, 0x00, 0x00,
+0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x61, 0x64, 0x72, 0x00, 0x04,
+0x00, 0x00, 0x01, 0x08, 0x00, 0x10, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
+0x00, 0x04, 0x02, 0x03, 0x02, 0x01, 0x02, 0x04, 0x00, 0x02, 0x01, 0x0a,
+0x01, 0x01, 0x01, 0x01, 0x00, 0x04, 0x00, 0x01, 0x0d, 0x00, 0x00, 0x00,
+0x02, 0x0b, 0x00, 0x00, 0x00, 0x69, 0x64, 0x65, 0x6e, 0x74, 0x69, 0x66,
+0x69, 0x65, 0x72, 0x3f, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x03, 0x01,
+0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x03, 0x24,
+0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x64, 0x72, 0x00,
+0x02, 0x05, 0x00, 0x00, 0x00, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x00, 0x01,
+0x0e, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x6c, 0x66, 0x6f, 0x72, 0x6d, 0x65,
+0x64, 0x20, 0x73, 0x65, 0x74, 0x21, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08,
+0x00, 0x10, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x01,
+0x02, 0x01, 0x02, 0x06, 0x00, 0x01, 0x04, 0x01, 0x01, 0x01, 0x03, 0x02,
+0x02, 0x04, 0x03, 0x01, 0x02, 0x01, 0x03, 0x01, 0x00, 0x05, 0x00, 0x01,
+0x11, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e,
+0x73, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x02, 0x01, 0x04, 0x02, 0x07,
+0x06, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x03, 0x00, 0x04, 0x01, 0x01,
+0x0c, 0x00, 0x00, 0x00, 0x02, 0x06, 0x00, 0x00, 0x00, 0x6c, 0x65, 0x6e,
+0x67, 0x74, 0x68, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
+0x00, 0x02, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00,
+0x00, 0x02, 0x00, 0x00, 0x04, 0x01, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01,
+0x01, 0x02, 0x02, 0x00, 0x05, 0x01, 0x01, 0x0f, 0x00, 0x00, 0x00, 0x02,
+0x01, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
+0x04, 0x02, 0x00, 0x02, 0x0d, 0x03, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05,
+0x01, 0x01, 0x1f, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0x00, 0x3d,
+0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x0c, 0x00, 0x04, 0x00, 0x01,
+0x01, 0x0c, 0x01, 0x01, 0x01, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
+0x02, 0x01, 0x02, 0x0d, 0x03, 0x02, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01,
+0x02, 0x24, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x61,
+0x64, 0x72, 0x00, 0x02, 0x01, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+0x00, 0x01, 0x08, 0x00, 0x11, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x02,
+0x01, 0x04, 0x02, 0x04, 0x02, 0x01, 0x02, 0x06, 0x00, 0x01, 0x02, 0x01,
+0x00, 0x04, 0x02, 0x02, 0x02, 0x0d, 0x03, 0x03, 0x01, 0x03, 0x01, 0x00,
+0x04, 0x02, 0x02, 0x20, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00,
+0x63, 0x64, 0x72, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x61, 0x64,
+0x72, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x10, 0x00, 0x06, 0x00,
+0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x05, 0x02, 0x01, 0x02, 0x06, 0x00,
+0x01, 0x02, 0x01, 0x01, 0x04, 0x02, 0x05, 0x02, 0x01, 0x02, 0x01, 0x00,
+0x05, 0x00, 0x01, 0x11, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00,
+0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x04, 0x01,
+0x04, 0x02, 0x0a, 0x04, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00,
+0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00,
+0x63, 0x64, 0x64, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
+0x02, 0x06, 0x02, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00,
+0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00,
+0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x0b, 0x0b, 0x04, 0x03,
+0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00, 0x00,
 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06,
 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x0b, 0x03, 0x01,
 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04,
 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02,
-0x01, 0x00, 0x04, 0x02, 0x0d, 0x0c, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03,
-0x01, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00,
-0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
-0x00, 0x04, 0x02, 0x00, 0x01, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05,
-0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63,
-0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
-0x04, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x00,
-0x01, 0x11, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f,
-0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x0a, 0x01, 0x04, 0x02,
-0x08, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x02,
-0x02, 0x22, 0x00, 0x00, 0x00, 0x02, 0x06, 0x00, 0x00, 0x00, 0x76, 0x65,
-0x63, 0x74, 0x6f, 0x72, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f,
-0x6e, 0x73, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x10, 0x00, 0x04,
-0x00, 0x17, 0x02, 0x02, 0x01, 0x00, 0x03, 0x02, 0x00, 0x01, 0x02, 0x06,
-0x00, 0x01, 0x02, 0x01, 0x01, 0x04, 0x02, 0x02, 0x02, 0x0b, 0x03, 0x01,
-0x03, 0x01, 0x00, 0x05, 0x02, 0x01, 0x0f, 0x00, 0x00, 0x00, 0x02, 0x0a,
-0x00, 0x00, 0x00, 0x76, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x2d, 0x6d, 0x61,
-0x70, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x02, 0x02, 0x01, 0x04,
-0x03, 0x03, 0x02, 0x01, 0x03, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00,
-0x00, 0x00, 0x02, 0x0c, 0x00, 0x00, 0x00, 0x76, 0x65, 0x63, 0x74, 0x6f,
-0x72, 0x2d, 0x3e, 0x6c, 0x69, 0x73, 0x74, 0x00, 0x06, 0x00, 0x00, 0x02,
-0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x05, 0x00,
-0x01, 0x11, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f,
-0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x05, 0x01, 0x04, 0x02,
-0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x02, 0x00, 0x05, 0x01,
-0x01, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f,
-0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00,
-0x02, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x00, 0x01, 0x11, 0x00,
+0x01, 0x00, 0x04, 0x02, 0x03, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03,
+0x01, 0x00, 0x05, 0x00, 0x01, 0x11, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00,
+0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01,
+0x08, 0x01, 0x04, 0x02, 0x0e, 0x04, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03,
+0x03, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x06, 0x00,
+0x00, 0x00, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x00, 0x06, 0x00, 0x00,
+0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x01, 0x02, 0x01, 0x00, 0x04,
+0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x01, 0x01,
+0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x02, 0x00, 0x05, 0x01, 0x01,
+0x0f, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x06,
+0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x0d, 0x03, 0x03,
+0x01, 0x03, 0x01, 0x00, 0x05, 0x02, 0x02, 0x23, 0x00, 0x00, 0x00, 0x02,
+0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x02, 0x01, 0x00,
+0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x10, 0x00,
+0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x0c, 0x02, 0x0b, 0x03, 0x01, 0x03,
+0x06, 0x00, 0x01, 0x02, 0x01, 0x01, 0x04, 0x02, 0x01, 0x02, 0x0d, 0x03,
+0x04, 0x01, 0x03, 0x01, 0x00, 0x05, 0x00, 0x01, 0x11, 0x00, 0x00, 0x00,
+0x02, 0x06, 0x00, 0x00, 0x00, 0x61, 0x70, 0x70, 0x65, 0x6e, 0x64, 0x00,
+0x06, 0x00, 0x00, 0x04, 0x01, 0x02, 0x01, 0x04, 0x02, 0x04, 0x02, 0x04,
+0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x03, 0x24, 0x00,
+0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x64, 0x72, 0x00, 0x02,
+0x05, 0x00, 0x00, 0x00, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x00, 0x01, 0x0c,
+0x00, 0x00, 0x00, 0x6d, 0x61, 0x6c, 0x66, 0x6f, 0x72, 0x6d, 0x65, 0x64,
+0x20, 0x69, 0x66, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x10, 0x00,
+0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x04, 0x02, 0x01, 0x02,
+0x06, 0x00, 0x01, 0x04, 0x01, 0x02, 0x01, 0x03, 0x02, 0x02, 0x04, 0x03,
+0x04, 0x02, 0x01, 0x03, 0x01, 0x00, 0x05, 0x00, 0x01, 0x11, 0x00, 0x00,
+0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06,
+0x00, 0x00, 0x04, 0x01, 0x03, 0x01, 0x04, 0x02, 0x08, 0x07, 0x04, 0x03,
+0x00, 0x01, 0x01, 0x03, 0x03, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00,
+0x00, 0x02, 0x06, 0x00, 0x00, 0x00, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68,
+0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x01,
+0x02, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0f, 0x00, 0x00, 0x00, 0x02, 0x01,
+0x00, 0x00, 0x00, 0x3d, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
+0x02, 0x00, 0x01, 0x0d, 0x03, 0x02, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01,
+0x03, 0x24, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x61,
+0x64, 0x72, 0x00, 0x02, 0x05, 0x00, 0x00, 0x00, 0x65, 0x72, 0x72, 0x6f,
+0x72, 0x00, 0x01, 0x0f, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x6c, 0x66, 0x6f,
+0x72, 0x6d, 0x65, 0x64, 0x20, 0x71, 0x75, 0x6f, 0x74, 0x65, 0x00, 0x04,
+0x00, 0x00, 0x01, 0x08, 0x00, 0x10, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
+0x00, 0x04, 0x02, 0x02, 0x02, 0x01, 0x02, 0x06, 0x00, 0x01, 0x04, 0x01,
+0x02, 0x01, 0x03, 0x02, 0x02, 0x04, 0x03, 0x02, 0x02, 0x01, 0x03, 0x01,
+0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04,
+0x01, 0x03, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x02, 0x00, 0x04,
+0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x05, 0x00, 0x00, 0x00, 0x70,
+0x61, 0x69, 0x72, 0x3f, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
+0x02, 0x00, 0x02, 0x01, 0x02, 0x01, 0x00, 0x04, 0x02, 0x02, 0x20, 0x00,
 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00,
-0x06, 0x00, 0x00, 0x04, 0x01, 0x01, 0x01, 0x04, 0x02, 0x0b, 0x0c, 0x04,
-0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x00, 0x01, 0x11, 0x00,
+0x02, 0x07, 0x00, 0x00, 0x00, 0x76, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x3f,
+0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x10, 0x00, 0x04, 0x00, 0x16,
+0x02, 0x02, 0x01, 0x00, 0x03, 0x02, 0x00, 0x01, 0x02, 0x06, 0x00, 0x01,
+0x02, 0x01, 0x01, 0x04, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x00, 0x04,
+0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63,
+0x61, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x02,
+0x02, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00, 0x00, 0x00,
+0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00,
+0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x0b, 0x03, 0x01, 0x03,
+0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00,
+0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
+0x00, 0x04, 0x02, 0x0a, 0x0c, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01,
+0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00,
+0x00, 0x63, 0x64, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
+0x02, 0x05, 0x02, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00,
 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00,
-0x06, 0x00, 0x00, 0x04, 0x01, 0x03, 0x01, 0x04, 0x02, 0x09, 0x05, 0x04,
-0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x03, 0x02, 0x13, 0x00,
-0x00, 0x00, 0x02, 0x07, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6d, 0x70, 0x69,
-0x6c, 0x65, 0x00, 0x02, 0x10, 0x00, 0x00, 0x00, 0x63, 0x61, 0x6c, 0x6c,
-0x2d, 0x77, 0x69, 0x74, 0x68, 0x2d, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x73,
-0x00, 0x0c, 0x00, 0x07, 0x00, 0x00, 0x06, 0x00, 0x01, 0x02, 0x01, 0x00,
-0x02, 0x02, 0x01, 0x02, 0x03, 0x02, 0x01, 0x03, 0x01, 0x00, 0x03, 0x01,
-0x01, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x65, 0x76,
-0x61, 0x6c, 0x00, 0x02, 0x00, 0x00, 0x07, 0x00, 0x00, 0x04, 0x00, 0x03,
-0x01, 0x0c, 0x01, 0x01, 0x01, 0x02, 0x01, 0x06, 0x01, 0x02, 0x13, 0x00,
-0x00, 0x00, 0x02, 0x05, 0x00, 0x00, 0x00, 0x61, 0x70, 0x70, 0x6c, 0x79,
-0x00, 0x02, 0x07, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6d, 0x70, 0x69, 0x6c,
-0x65, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x06, 0x02, 0x01, 0x04,
-0x03, 0x00, 0x02, 0x04, 0x04, 0x00, 0x03, 0x01, 0x04, 0x01, 0x00, 0x03,
-0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x04, 0x01,
-0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x03, 0x01, 0x00, 0x09, 0x00, 0x00,
-0x00, 0x02, 0x00, 0x00, 0x04, 0x01, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00,
-0x0a, 0x01, 0x00, 0x17, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x01,
-0x00, 0x01, 0x0a, 0x02, 0x0a, 0x03, 0x0a, 0x04, 0x0a, 0x05, 0x0a, 0x06,
-0x0a, 0x07, 0x0a, 0x08, 0x01, 0x08, 0x08, 0x00, 0x04, 0x05, 0x01, 0x26,
-0x00, 0x00, 0x00, 0x02, 0x0e, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x6b, 0x65,
-0x2d, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x65, 0x74, 0x65, 0x72, 0x00, 0x02,
-0x00, 0x00, 0x05, 0x00, 0x00, 0x08, 0x02, 0x00, 0x01, 0x05, 0x00, 0x00,
-0x07, 0x02, 0x00, 0x02, 0x05, 0x00, 0x00, 0x06, 0x02, 0x00, 0x03, 0x05,
-0x00, 0x00, 0x05, 0x06, 0x00, 0x00, 0x02, 0x01, 0x04, 0x0b, 0x02, 0x01,
+0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x0b, 0x03,
+0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02,
+0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00,
+0x02, 0x01, 0x00, 0x04, 0x02, 0x0d, 0x0c, 0x04, 0x03, 0x00, 0x01, 0x01,
+0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x04,
+0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02,
+0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00,
+0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00,
+0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
+0x02, 0x04, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05,
+0x00, 0x01, 0x11, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63,
+0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x0a, 0x01, 0x04,
+0x02, 0x08, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05,
+0x02, 0x02, 0x22, 0x00, 0x00, 0x00, 0x02, 0x06, 0x00, 0x00, 0x00, 0x76,
+0x65, 0x63, 0x74, 0x6f, 0x72, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63,
+0x6f, 0x6e, 0x73, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x10, 0x00,
+0x04, 0x00, 0x17, 0x02, 0x02, 0x01, 0x00, 0x03, 0x02, 0x00, 0x01, 0x02,
+0x06, 0x00, 0x01, 0x02, 0x01, 0x01, 0x04, 0x02, 0x02, 0x02, 0x0b, 0x03,
+0x01, 0x03, 0x01, 0x00, 0x05, 0x02, 0x01, 0x0f, 0x00, 0x00, 0x00, 0x02,
+0x0a, 0x00, 0x00, 0x00, 0x76, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x2d, 0x6d,
+0x61, 0x70, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x02, 0x02, 0x01,
+0x04, 0x03, 0x03, 0x02, 0x01, 0x03, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c,
+0x00, 0x00, 0x00, 0x02, 0x0c, 0x00, 0x00, 0x00, 0x76, 0x65, 0x63, 0x74,
+0x6f, 0x72, 0x2d, 0x3e, 0x6c, 0x69, 0x73, 0x74, 0x00, 0x06, 0x00, 0x00,
+0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x05,
+0x00, 0x01, 0x11, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63,
+0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x05, 0x01, 0x04,
+0x02, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x02, 0x00, 0x05,
+0x01, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63,
+0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
+0x00, 0x02, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x00, 0x01, 0x11,
+0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73,
+0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x01, 0x01, 0x04, 0x02, 0x0b, 0x0c,
+0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x00, 0x01, 0x11,
+0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73,
+0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x03, 0x01, 0x04, 0x02, 0x09, 0x05,
+0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x03, 0x02, 0x13,
+0x00, 0x00, 0x00, 0x02, 0x07, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6d, 0x70,
+0x69, 0x6c, 0x65, 0x00, 0x02, 0x10, 0x00, 0x00, 0x00, 0x63, 0x61, 0x6c,
+0x6c, 0x2d, 0x77, 0x69, 0x74, 0x68, 0x2d, 0x76, 0x61, 0x6c, 0x75, 0x65,
+0x73, 0x00, 0x0c, 0x00, 0x07, 0x00, 0x00, 0x06, 0x00, 0x01, 0x02, 0x01,
+0x00, 0x02, 0x02, 0x01, 0x02, 0x03, 0x02, 0x01, 0x03, 0x01, 0x00, 0x03,
+0x01, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x65,
+0x76, 0x61, 0x6c, 0x00, 0x02, 0x00, 0x00, 0x07, 0x00, 0x00, 0x04, 0x00,
+0x03, 0x01, 0x0c, 0x01, 0x01, 0x01, 0x02, 0x01, 0x06, 0x01, 0x02, 0x13,
+0x00, 0x00, 0x00, 0x02, 0x05, 0x00, 0x00, 0x00, 0x61, 0x70, 0x70, 0x6c,
+0x79, 0x00, 0x02, 0x07, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6d, 0x70, 0x69,
+0x6c, 0x65, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x06, 0x02, 0x01,
+0x04, 0x03, 0x00, 0x02, 0x04, 0x04, 0x00, 0x03, 0x01, 0x04, 0x01, 0x00,
+0x03, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x04,
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x03, 0x01, 0x00, 0x09, 0x00,
+0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x01, 0x00, 0x01, 0x01, 0x01, 0x01,
+0x00, 0x0b, 0x01, 0x00, 0x19, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04,
+0x01, 0x00, 0x01, 0x0a, 0x02, 0x0a, 0x03, 0x0a, 0x04, 0x0a, 0x05, 0x0a,
+0x06, 0x0a, 0x07, 0x0a, 0x08, 0x0a, 0x09, 0x01, 0x09, 0x09, 0x00, 0x04,
+0x06, 0x01, 0x2d, 0x00, 0x00, 0x00, 0x02, 0x0e, 0x00, 0x00, 0x00, 0x6d,
+0x61, 0x6b, 0x65, 0x2d, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x65, 0x74, 0x65,
+0x72, 0x00, 0x02, 0x00, 0x00, 0x05, 0x00, 0x00, 0x09, 0x02, 0x00, 0x01,
+0x05, 0x00, 0x00, 0x08, 0x02, 0x00, 0x02, 0x05, 0x00, 0x00, 0x07, 0x02,
+0x00, 0x03, 0x05, 0x00, 0x00, 0x06, 0x02, 0x00, 0x04, 0x05, 0x00, 0x00,
+0x05, 0x06, 0x00, 0x00, 0x02, 0x01, 0x05, 0x0b, 0x02, 0x01, 0x02, 0x02,
+0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00,
+0x00, 0x63, 0x64, 0x64, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
+0x04, 0x02, 0x00, 0x02, 0x01, 0x02, 0x01, 0x00, 0x04, 0x00, 0x01, 0x0d,
+0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x61, 0x72, 0x00,
+0x06, 0x00, 0x00, 0x04, 0x01, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01,
 0x02, 0x02, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x04,
 0x00, 0x00, 0x00, 0x63, 0x64, 0x64, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02,
 0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x01, 0x02, 0x01, 0x00, 0x04, 0x00,
-0x01, 0x0d, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x61,
-0x72, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x01, 0x01, 0x04, 0x02, 0x00,
-0x01, 0x01, 0x02, 0x02, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00,
-0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x64, 0x64, 0x72, 0x00, 0x06, 0x00,
-0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x01, 0x02, 0x01, 0x00,
-0x04, 0x00, 0x01, 0x0d, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00,
-0x63, 0x61, 0x64, 0x72, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x01, 0x01,
-0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x03, 0x00, 0x05, 0x01, 0x01, 0x10,
-0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x06, 0x00,
-0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x04, 0x03, 0x00, 0x03,
-0x01, 0x03, 0x01, 0x00, 0x03, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x04,
-0x00, 0x00, 0x01, 0x08, 0x00, 0x0e, 0x00, 0x04, 0x00, 0x01, 0x01, 0x04,
-0x01, 0x01, 0x03, 0x01, 0x01, 0x04, 0x00, 0x01, 0x01, 0x04, 0x01, 0x01,
-0x02, 0x01, 0x01, 0x02, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00,
-0x02, 0x07, 0x00, 0x00, 0x00, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x3f,
-0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x01,
-0x02, 0x01, 0x00, 0x04, 0x00, 0x01, 0x1d, 0x00, 0x00, 0x00, 0x02, 0x06,
-0x00, 0x00, 0x00, 0x65, 0x78, 0x61, 0x63, 0x74, 0x3f, 0x00, 0x04, 0x00,
-0x00, 0x01, 0x08, 0x00, 0x11, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x01,
-0x01, 0x04, 0x02, 0x01, 0x02, 0x01, 0x02, 0x04, 0x00, 0x01, 0x01, 0x0a,
-0x01, 0x01, 0x01, 0x01, 0x00, 0x04, 0x02, 0x00, 0x0c, 0x00, 0x00, 0x00,
+0x01, 0x0d, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x61,
+0x64, 0x72, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x01, 0x01, 0x04, 0x02,
+0x00, 0x01, 0x01, 0x02, 0x02, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00,
+0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x64, 0x64, 0x72, 0x00, 0x06,
+0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x01, 0x02, 0x01,
+0x00, 0x04, 0x00, 0x01, 0x0d, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00,
+0x00, 0x63, 0x64, 0x64, 0x72, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x01,
+0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x03, 0x00, 0x05, 0x01, 0x01,
+0x10, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x06,
+0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x04, 0x03, 0x00,
+0x03, 0x01, 0x03, 0x01, 0x00, 0x03, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
+0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x0e, 0x00, 0x04, 0x00, 0x01, 0x01,
+0x04, 0x01, 0x01, 0x03, 0x01, 0x01, 0x04, 0x00, 0x01, 0x01, 0x04, 0x01,
+0x01, 0x02, 0x01, 0x01, 0x02, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00,
+0x00, 0x02, 0x07, 0x00, 0x00, 0x00, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72,
+0x3f, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02,
+0x01, 0x02, 0x01, 0x00, 0x04, 0x00, 0x01, 0x1d, 0x00, 0x00, 0x00, 0x02,
+0x06, 0x00, 0x00, 0x00, 0x65, 0x78, 0x61, 0x63, 0x74, 0x3f, 0x00, 0x04,
+0x00, 0x00, 0x01, 0x08, 0x00, 0x11, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01,
+0x01, 0x01, 0x04, 0x02, 0x01, 0x02, 0x01, 0x02, 0x04, 0x00, 0x01, 0x01,
+0x0a, 0x01, 0x01, 0x01, 0x01, 0x00, 0x04, 0x02, 0x00, 0x0c, 0x00, 0x00,
+0x00, 0x02, 0x00, 0x00, 0x02, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01,
+0x02, 0x02, 0x00, 0x04, 0x01, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x02, 0x00,
+0x00, 0x04, 0x01, 0x00, 0x01, 0x0a, 0x02, 0x01, 0x02, 0x02, 0x00, 0x03,
+0x01, 0x00, 0x11, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x05, 0x00, 0x00,
+0x02, 0x04, 0x00, 0x00, 0x01, 0x04, 0x01, 0x00, 0x02, 0x01, 0x01, 0x02,
+0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x07, 0x00, 0x00,
+0x00, 0x73, 0x79, 0x6d, 0x62, 0x6f, 0x6c, 0x3f, 0x00, 0x06, 0x00, 0x00,
+0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x01, 0x02, 0x01, 0x00, 0x05,
+0x02, 0x02, 0x22, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63,
+0x6f, 0x6e, 0x73, 0x00, 0x02, 0x05, 0x00, 0x00, 0x00, 0x70, 0x61, 0x69,
+0x72, 0x3f, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x12, 0x00, 0x06,
+0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x01, 0x02, 0x0b, 0x03, 0x01,
+0x03, 0x06, 0x00, 0x01, 0x02, 0x01, 0x01, 0x04, 0x02, 0x01, 0x02, 0x01,
+0x02, 0x01, 0x00, 0x05, 0x00, 0x02, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04,
+0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x02, 0x03, 0x00, 0x00,
+0x00, 0x72, 0x65, 0x66, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x02, 0x01,
+0x03, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04,
+0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x6e,
+0x6f, 0x74, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00,
+0x01, 0x01, 0x02, 0x01, 0x00, 0x05, 0x02, 0x02, 0x22, 0x00, 0x00, 0x00,
+0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x02, 0x03,
+0x00, 0x00, 0x00, 0x63, 0x61, 0x72, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08,
+0x00, 0x12, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x03,
+0x02, 0x0b, 0x03, 0x01, 0x03, 0x06, 0x00, 0x01, 0x02, 0x01, 0x01, 0x04,
+0x02, 0x03, 0x02, 0x01, 0x02, 0x01, 0x00, 0x05, 0x00, 0x02, 0x10, 0x00,
+0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00,
+0x02, 0x05, 0x00, 0x00, 0x00, 0x71, 0x75, 0x6f, 0x74, 0x65, 0x00, 0x06,
+0x00, 0x00, 0x04, 0x01, 0x04, 0x01, 0x03, 0x02, 0x01, 0x04, 0x03, 0x00,
+0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00,
+0x02, 0x00, 0x00, 0x04, 0x01, 0x04, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01,
+0x02, 0x02, 0x00, 0x05, 0x01, 0x02, 0x0f, 0x00, 0x00, 0x00, 0x02, 0x04,
+0x00, 0x00, 0x00, 0x65, 0x71, 0x76, 0x3f, 0x00, 0x02, 0x0a, 0x00, 0x00,
+0x00, 0x63, 0x6f, 0x72, 0x65, 0x23, 0x71, 0x75, 0x6f, 0x74, 0x65, 0x00,
+0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x03, 0x03,
+0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x02, 0x00, 0x0c, 0x00, 0x00, 0x00,
 0x02, 0x00, 0x00, 0x02, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02,
-0x02, 0x00, 0x04, 0x01, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
-0x04, 0x01, 0x00, 0x01, 0x0a, 0x02, 0x01, 0x02, 0x02, 0x00, 0x03, 0x01,
-0x00, 0x11, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x05, 0x00, 0x00, 0x02,
-0x04, 0x00, 0x00, 0x01, 0x04, 0x01, 0x00, 0x02, 0x01, 0x01, 0x02, 0x00,
-0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x07, 0x00, 0x00, 0x00,
-0x73, 0x79, 0x6d, 0x62, 0x6f, 0x6c, 0x3f, 0x00, 0x06, 0x00, 0x00, 0x02,
-0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x01, 0x02, 0x01, 0x00, 0x05, 0x02,
-0x02, 0x22, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f,
-0x6e, 0x73, 0x00, 0x02, 0x05, 0x00, 0x00, 0x00, 0x70, 0x61, 0x69, 0x72,
-0x3f, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x12, 0x00, 0x06, 0x00,
-0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x01, 0x02, 0x0b, 0x03, 0x01, 0x03,
-0x06, 0x00, 0x01, 0x02, 0x01, 0x01, 0x04, 0x02, 0x01, 0x02, 0x01, 0x02,
-0x01, 0x00, 0x05, 0x00, 0x02, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00,
-0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00,
-0x72, 0x65, 0x66, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x02, 0x01, 0x03,
-0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x01,
-0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x6e, 0x6f,
-0x74, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01,
-0x01, 0x02, 0x01, 0x00, 0x05, 0x02, 0x02, 0x22, 0x00, 0x00, 0x00, 0x02,
-0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x02, 0x03, 0x00,
-0x00, 0x00, 0x63, 0x61, 0x72, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00,
-0x12, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x03, 0x02,
-0x0b, 0x03, 0x01, 0x03, 0x06, 0x00, 0x01, 0x02, 0x01, 0x01, 0x04, 0x02,
-0x03, 0x02, 0x01, 0x02, 0x01, 0x00, 0x05, 0x00, 0x02, 0x10, 0x00, 0x00,
-0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x02,
-0x05, 0x00, 0x00, 0x00, 0x71, 0x75, 0x6f, 0x74, 0x65, 0x00, 0x06, 0x00,
-0x00, 0x04, 0x01, 0x04, 0x01, 0x03, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01,
-0x01, 0x03, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x02,
-0x00, 0x00, 0x04, 0x01, 0x04, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02,
-0x02, 0x00, 0x05, 0x01, 0x02, 0x0f, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00,
-0x00, 0x00, 0x65, 0x71, 0x76, 0x3f, 0x00, 0x02, 0x0a, 0x00, 0x00, 0x00,
-0x63, 0x6f, 0x72, 0x65, 0x23, 0x71, 0x75, 0x6f, 0x74, 0x65, 0x00, 0x06,
-0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x03, 0x03, 0x01,
-0x01, 0x03, 0x01, 0x00, 0x04, 0x02, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x02,
-0x00, 0x00, 0x02, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x02,
-0x00, 0x03, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x02,
-0x08, 0x00, 0x0e, 0x00, 0x04, 0x00, 0x00, 0x01, 0x04, 0x01, 0x00, 0x02,
-0x01, 0x01, 0x04, 0x00, 0x00, 0x01, 0x0a, 0x01, 0x01, 0x01, 0x01, 0x00,
-0x05, 0x02, 0x03, 0x23, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00,
-0x63, 0x64, 0x72, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x65, 0x71, 0x76,
-0x3f, 0x00, 0x02, 0x0b, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x72, 0x65, 0x23,
-0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08,
-0x00, 0x10, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x07,
-0x02, 0x01, 0x02, 0x06, 0x00, 0x01, 0x02, 0x01, 0x01, 0x04, 0x02, 0x02,
-0x02, 0x03, 0x03, 0x02, 0x01, 0x03, 0x01, 0x00, 0x05, 0x00, 0x02, 0x10,
-0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73,
-0x00, 0x02, 0x05, 0x00, 0x00, 0x00, 0x71, 0x75, 0x6f, 0x74, 0x65, 0x00,
-0x06, 0x00, 0x00, 0x04, 0x01, 0x03, 0x01, 0x03, 0x02, 0x01, 0x04, 0x03,
+0x02, 0x00, 0x03, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
+0x02, 0x08, 0x00, 0x0e, 0x00, 0x04, 0x00, 0x00, 0x01, 0x04, 0x01, 0x00,
+0x02, 0x01, 0x01, 0x04, 0x00, 0x00, 0x01, 0x0a, 0x01, 0x01, 0x01, 0x01,
+0x00, 0x05, 0x02, 0x03, 0x23, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00,
+0x00, 0x63, 0x64, 0x72, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x65, 0x71,
+0x76, 0x3f, 0x00, 0x02, 0x0b, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x72, 0x65,
+0x23, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x00, 0x04, 0x00, 0x00, 0x01,
+0x08, 0x00, 0x10, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
+0x07, 0x02, 0x01, 0x02, 0x06, 0x00, 0x01, 0x02, 0x01, 0x01, 0x04, 0x02,
+0x02, 0x02, 0x03, 0x03, 0x02, 0x01, 0x03, 0x01, 0x00, 0x05, 0x00, 0x02,
+0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e,
+0x73, 0x00, 0x02, 0x05, 0x00, 0x00, 0x00, 0x71, 0x75, 0x6f, 0x74, 0x65,
+0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x03, 0x01, 0x03, 0x02, 0x01, 0x04,
+0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x02, 0x00, 0x0c, 0x00,
+0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01,
+0x01, 0x02, 0x02, 0x00, 0x03, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x04,
+0x00, 0x00, 0x02, 0x08, 0x00, 0x0e, 0x00, 0x04, 0x00, 0x00, 0x01, 0x04,
+0x01, 0x00, 0x02, 0x01, 0x01, 0x04, 0x00, 0x00, 0x01, 0x0a, 0x01, 0x01,
+0x01, 0x01, 0x00, 0x05, 0x02, 0x03, 0x23, 0x00, 0x00, 0x00, 0x02, 0x04,
+0x00, 0x00, 0x00, 0x63, 0x61, 0x64, 0x72, 0x00, 0x02, 0x04, 0x00, 0x00,
+0x00, 0x65, 0x71, 0x76, 0x3f, 0x00, 0x02, 0x0b, 0x00, 0x00, 0x00, 0x63,
+0x6f, 0x72, 0x65, 0x23, 0x6c, 0x61, 0x6d, 0x62, 0x64, 0x61, 0x00, 0x04,
+0x00, 0x00, 0x01, 0x08, 0x00, 0x10, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
+0x00, 0x04, 0x02, 0x09, 0x02, 0x01, 0x02, 0x06, 0x00, 0x01, 0x02, 0x01,
+0x01, 0x04, 0x02, 0x04, 0x02, 0x03, 0x03, 0x02, 0x01, 0x03, 0x01, 0x00,
+0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0e, 0x09, 0x02,
+0x01, 0x00, 0x04, 0x02, 0x0a, 0x02, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01,
+0x00, 0x11, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x01, 0x06, 0x01,
+0x04, 0x02, 0x01, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x03, 0x00,
+0x03, 0x01, 0x00, 0x09, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0e, 0x02, 0x02,
+0x01, 0x00, 0x01, 0x01, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00,
+0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06,
+0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x01, 0x02, 0x04, 0x03, 0x00,
+0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00,
+0x04, 0x00, 0x10, 0x02, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01,
+0x02, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x04, 0x00,
+0x10, 0x02, 0x02, 0x01, 0x00, 0x04, 0x02, 0x03, 0x03, 0x01, 0x02, 0x01,
+0x00, 0x05, 0x01, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00,
+0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
+0x04, 0x02, 0x00, 0x01, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01,
+0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f,
+0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x05,
+0x02, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x00, 0x02,
+0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e,
+0x73, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x73, 0x65, 0x74, 0x21, 0x00,
+0x06, 0x00, 0x00, 0x04, 0x01, 0x06, 0x01, 0x03, 0x02, 0x01, 0x04, 0x03,
 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x02, 0x00, 0x0c, 0x00, 0x00,
 0x00, 0x02, 0x00, 0x00, 0x02, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01,
 0x02, 0x02, 0x00, 0x03, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x04, 0x00,
@@ -2503,487 +2541,655 @@ static const unsigned char eval_rom[] = {
 0x00, 0x02, 0x01, 0x01, 0x04, 0x00, 0x00, 0x01, 0x0a, 0x01, 0x01, 0x01,
 0x01, 0x00, 0x05, 0x02, 0x03, 0x23, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00,
 0x00, 0x00, 0x63, 0x61, 0x64, 0x72, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00,
-0x65, 0x71, 0x76, 0x3f, 0x00, 0x02, 0x0b, 0x00, 0x00, 0x00, 0x63, 0x6f,
-0x72, 0x65, 0x23, 0x6c, 0x61, 0x6d, 0x62, 0x64, 0x61, 0x00, 0x04, 0x00,
-0x00, 0x01, 0x08, 0x00, 0x10, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
-0x04, 0x02, 0x09, 0x02, 0x01, 0x02, 0x06, 0x00, 0x01, 0x02, 0x01, 0x01,
-0x04, 0x02, 0x04, 0x02, 0x03, 0x03, 0x02, 0x01, 0x03, 0x01, 0x00, 0x04,
-0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0e, 0x08, 0x02, 0x01,
-0x00, 0x04, 0x02, 0x0a, 0x02, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x00,
-0x11, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x01, 0x06, 0x01, 0x04,
-0x02, 0x01, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x03, 0x00, 0x03,
-0x01, 0x00, 0x09, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0e, 0x02, 0x02, 0x01,
-0x00, 0x01, 0x01, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00,
-0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00,
-0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x01, 0x02, 0x04, 0x03, 0x00, 0x01,
-0x01, 0x03, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x04,
-0x00, 0x10, 0x02, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02,
-0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x04, 0x00, 0x10,
-0x02, 0x02, 0x01, 0x00, 0x04, 0x02, 0x03, 0x03, 0x01, 0x02, 0x01, 0x00,
+0x65, 0x71, 0x76, 0x3f, 0x00, 0x02, 0x09, 0x00, 0x00, 0x00, 0x63, 0x6f,
+0x72, 0x65, 0x23, 0x73, 0x65, 0x74, 0x21, 0x00, 0x04, 0x00, 0x00, 0x01,
+0x08, 0x00, 0x10, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
+0x0b, 0x02, 0x01, 0x02, 0x06, 0x00, 0x01, 0x02, 0x01, 0x01, 0x04, 0x02,
+0x06, 0x02, 0x03, 0x03, 0x02, 0x01, 0x03, 0x01, 0x00, 0x04, 0x01, 0x00,
+0x0d, 0x00, 0x00, 0x00, 0x04, 0x00, 0x10, 0x09, 0x02, 0x01, 0x00, 0x04,
+0x02, 0x0c, 0x02, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x00, 0x11, 0x00,
+0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x01, 0x08, 0x01, 0x04, 0x02, 0x01,
+0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x03, 0x00, 0x03, 0x01, 0x01,
+0x08, 0x00, 0x00, 0x00, 0x02, 0x0e, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x6b,
+0x65, 0x2d, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x00,
+0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x01, 0x01, 0x01, 0x00, 0x03, 0x01,
+0x01, 0x08, 0x00, 0x00, 0x00, 0x02, 0x1b, 0x00, 0x00, 0x00, 0x63, 0x75,
+0x72, 0x72, 0x65, 0x6e, 0x74, 0x2d, 0x64, 0x79, 0x6e, 0x61, 0x6d, 0x69,
+0x63, 0x2d, 0x65, 0x6e, 0x76, 0x69, 0x72, 0x6f, 0x6e, 0x6d, 0x65, 0x6e,
+0x74, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x01, 0x01, 0x01, 0x00,
+0x05, 0x01, 0x00, 0x11, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x01,
+0x02, 0x01, 0x04, 0x02, 0x01, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03,
+0x03, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00,
+0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
+0x00, 0x04, 0x02, 0x00, 0x02, 0x04, 0x03, 0x00, 0x03, 0x01, 0x03, 0x01,
+0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x1b, 0x00, 0x00,
+0x00, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x2d, 0x64, 0x79, 0x6e,
+0x61, 0x6d, 0x69, 0x63, 0x2d, 0x65, 0x6e, 0x76, 0x69, 0x72, 0x6f, 0x6e,
+0x6d, 0x65, 0x6e, 0x74, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
+0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0b, 0x00,
+0x00, 0x00, 0x04, 0x00, 0x15, 0x02, 0x02, 0x01, 0x00, 0x0b, 0x02, 0x01,
+0x02, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x04, 0x00,
+0x15, 0x02, 0x02, 0x01, 0x00, 0x04, 0x02, 0x06, 0x03, 0x01, 0x02, 0x01,
+0x00, 0x04, 0x02, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02,
+0x01, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x02, 0x00, 0x03, 0x01,
+0x00, 0x09, 0x00, 0x00, 0x00, 0x04, 0x00, 0x18, 0x02, 0x02, 0x01, 0x00,
+0x01, 0x01, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02,
+0x05, 0x00, 0x00, 0x00, 0x6e, 0x75, 0x6c, 0x6c, 0x3f, 0x00, 0x06, 0x00,
+0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00,
+0x05, 0x02, 0x01, 0x1f, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00,
+0x63, 0x6f, 0x6e, 0x73, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x12,
+0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x02, 0x02, 0x0b,
+0x03, 0x01, 0x03, 0x04, 0x00, 0x1a, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00,
+0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
+0x00, 0x04, 0x02, 0x0b, 0x02, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01,
+0x00, 0x05, 0x00, 0x02, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00,
+0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x02, 0x06, 0x00, 0x00, 0x00, 0x6c,
+0x61, 0x6d, 0x62, 0x64, 0x61, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x04,
+0x01, 0x03, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00,
 0x05, 0x01, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00,
 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
-0x02, 0x00, 0x01, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01,
+0x02, 0x03, 0x02, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01,
 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e,
-0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x05, 0x02,
-0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x00, 0x02, 0x10,
+0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x01, 0x01,
+0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x02, 0x0f,
 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73,
-0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x73, 0x65, 0x74, 0x21, 0x00, 0x06,
-0x00, 0x00, 0x04, 0x01, 0x06, 0x01, 0x03, 0x02, 0x01, 0x04, 0x03, 0x00,
-0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x02, 0x00, 0x0c, 0x00, 0x00, 0x00,
-0x02, 0x00, 0x00, 0x02, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02,
-0x02, 0x00, 0x03, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-0x02, 0x08, 0x00, 0x0e, 0x00, 0x04, 0x00, 0x00, 0x01, 0x04, 0x01, 0x00,
-0x02, 0x01, 0x01, 0x04, 0x00, 0x00, 0x01, 0x0a, 0x01, 0x01, 0x01, 0x01,
-0x00, 0x05, 0x02, 0x03, 0x23, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00,
-0x00, 0x63, 0x61, 0x64, 0x72, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x65,
-0x71, 0x76, 0x3f, 0x00, 0x02, 0x09, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x72,
-0x65, 0x23, 0x73, 0x65, 0x74, 0x21, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08,
-0x00, 0x10, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x0b,
-0x02, 0x01, 0x02, 0x06, 0x00, 0x01, 0x02, 0x01, 0x01, 0x04, 0x02, 0x06,
-0x02, 0x03, 0x03, 0x02, 0x01, 0x03, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d,
-0x00, 0x00, 0x00, 0x04, 0x00, 0x10, 0x08, 0x02, 0x01, 0x00, 0x04, 0x02,
-0x0c, 0x02, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x00, 0x11, 0x00, 0x00,
-0x00, 0x02, 0x00, 0x00, 0x04, 0x01, 0x08, 0x01, 0x04, 0x02, 0x01, 0x01,
-0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x03, 0x00, 0x03, 0x01, 0x01, 0x08,
-0x00, 0x00, 0x00, 0x02, 0x0e, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x6b, 0x65,
-0x2d, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x00, 0x06,
-0x00, 0x00, 0x02, 0x01, 0x00, 0x01, 0x01, 0x01, 0x00, 0x03, 0x01, 0x01,
-0x08, 0x00, 0x00, 0x00, 0x02, 0x1b, 0x00, 0x00, 0x00, 0x63, 0x75, 0x72,
-0x72, 0x65, 0x6e, 0x74, 0x2d, 0x64, 0x79, 0x6e, 0x61, 0x6d, 0x69, 0x63,
-0x2d, 0x65, 0x6e, 0x76, 0x69, 0x72, 0x6f, 0x6e, 0x6d, 0x65, 0x6e, 0x74,
-0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x01, 0x01, 0x01, 0x00, 0x05,
-0x01, 0x00, 0x11, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x01, 0x02,
-0x01, 0x04, 0x02, 0x01, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x03,
-0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00,
-0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
-0x04, 0x02, 0x00, 0x02, 0x04, 0x03, 0x00, 0x03, 0x01, 0x03, 0x01, 0x00,
-0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x1b, 0x00, 0x00, 0x00,
-0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x2d, 0x64, 0x79, 0x6e, 0x61,
-0x6d, 0x69, 0x63, 0x2d, 0x65, 0x6e, 0x76, 0x69, 0x72, 0x6f, 0x6e, 0x6d,
-0x65, 0x6e, 0x74, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
-0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0b, 0x00, 0x00,
-0x00, 0x04, 0x00, 0x15, 0x02, 0x02, 0x01, 0x00, 0x0b, 0x02, 0x01, 0x02,
-0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x04, 0x00, 0x15,
-0x02, 0x02, 0x01, 0x00, 0x04, 0x02, 0x06, 0x03, 0x01, 0x02, 0x01, 0x00,
-0x04, 0x02, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x01,
-0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x02, 0x00, 0x03, 0x01, 0x00,
-0x09, 0x00, 0x00, 0x00, 0x04, 0x00, 0x18, 0x02, 0x02, 0x01, 0x00, 0x01,
-0x01, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x05,
-0x00, 0x00, 0x00, 0x6e, 0x75, 0x6c, 0x6c, 0x3f, 0x00, 0x06, 0x00, 0x00,
-0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x05,
-0x02, 0x01, 0x1f, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63,
-0x6f, 0x6e, 0x73, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x12, 0x00,
-0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x02, 0x02, 0x0b, 0x03,
-0x01, 0x03, 0x04, 0x00, 0x1a, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01,
-0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00,
-0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
-0x04, 0x02, 0x0b, 0x02, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00,
-0x05, 0x00, 0x02, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00,
-0x63, 0x6f, 0x6e, 0x73, 0x00, 0x02, 0x06, 0x00, 0x00, 0x00, 0x6c, 0x61,
-0x6d, 0x62, 0x64, 0x61, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x04, 0x01,
-0x03, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05,
-0x01, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63,
-0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
-0x03, 0x02, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10,
+0x00, 0x02, 0x06, 0x00, 0x00, 0x00, 0x6c, 0x61, 0x6d, 0x62, 0x64, 0x61,
+0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x03, 0x02, 0x01, 0x04, 0x03,
+0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x09, 0x00, 0x00,
+0x00, 0x04, 0x00, 0x1e, 0x02, 0x02, 0x01, 0x00, 0x01, 0x01, 0x01, 0x00,
+0x05, 0x02, 0x01, 0x0f, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00,
+0x6d, 0x61, 0x70, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x02, 0x02,
+0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01,
+0x0e, 0x00, 0x00, 0x00, 0x02, 0x06, 0x00, 0x00, 0x00, 0x61, 0x70, 0x70,
+0x65, 0x6e, 0x64, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
+0x00, 0x01, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10,
 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73,
-0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x01, 0x01, 0x04,
-0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x02, 0x0f, 0x00,
-0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00,
-0x02, 0x06, 0x00, 0x00, 0x00, 0x6c, 0x61, 0x6d, 0x62, 0x64, 0x61, 0x00,
-0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x03, 0x02, 0x01, 0x04, 0x03, 0x00,
-0x01, 0x01, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x09, 0x00, 0x00, 0x00,
-0x04, 0x00, 0x1e, 0x02, 0x02, 0x01, 0x00, 0x01, 0x01, 0x01, 0x00, 0x05,
-0x02, 0x01, 0x0f, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x6d,
-0x61, 0x70, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x02, 0x02, 0x01,
-0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0e,
-0x00, 0x00, 0x00, 0x02, 0x06, 0x00, 0x00, 0x00, 0x61, 0x70, 0x70, 0x65,
-0x6e, 0x64, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00,
-0x01, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00,
+0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x03, 0x01, 0x04,
+0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00,
 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00,
-0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x03, 0x01, 0x04, 0x03,
-0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00, 0x00,
-0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06,
-0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x0b, 0x03, 0x01,
-0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04,
-0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02,
-0x01, 0x00, 0x04, 0x02, 0x13, 0x02, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03,
-0x01, 0x00, 0x05, 0x00, 0x02, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00,
-0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x02, 0x06, 0x00, 0x00, 0x00,
-0x6c, 0x61, 0x6d, 0x62, 0x64, 0x61, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01,
-0x0c, 0x01, 0x03, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x02,
-0x00, 0x05, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00,
-0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
-0x0a, 0x02, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x00, 0x02, 0x10,
-0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73,
-0x00, 0x02, 0x05, 0x00, 0x00, 0x00, 0x71, 0x75, 0x6f, 0x74, 0x65, 0x00,
-0x06, 0x00, 0x00, 0x04, 0x01, 0x01, 0x01, 0x03, 0x02, 0x01, 0x04, 0x03,
-0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00,
-0x00, 0x02, 0x00, 0x00, 0x04, 0x01, 0x05, 0x01, 0x04, 0x02, 0x00, 0x01,
-0x01, 0x02, 0x02, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02,
-0x1b, 0x00, 0x00, 0x00, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x2d,
-0x64, 0x79, 0x6e, 0x61, 0x6d, 0x69, 0x63, 0x2d, 0x65, 0x6e, 0x76, 0x69,
-0x72, 0x6f, 0x6e, 0x6d, 0x65, 0x6e, 0x74, 0x00, 0x06, 0x00, 0x00, 0x02,
-0x01, 0x00, 0x04, 0x02, 0x06, 0x03, 0x01, 0x02, 0x01, 0x00, 0x03, 0x00,
-0x00, 0x0a, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x01, 0x04, 0x01, 0x01,
-0x02, 0x01, 0x01, 0x01, 0x00, 0x04, 0x02, 0x00, 0x0c, 0x00, 0x00, 0x00,
-0x02, 0x00, 0x00, 0x02, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02,
-0x02, 0x00, 0x03, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-0x02, 0x08, 0x00, 0x0e, 0x00, 0x04, 0x00, 0x00, 0x01, 0x04, 0x01, 0x00,
-0x02, 0x01, 0x01, 0x04, 0x00, 0x00, 0x01, 0x0a, 0x01, 0x01, 0x01, 0x01,
-0x00, 0x05, 0x02, 0x03, 0x23, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00,
-0x00, 0x63, 0x61, 0x64, 0x72, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x65,
-0x71, 0x76, 0x3f, 0x00, 0x02, 0x07, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x72,
-0x65, 0x23, 0x69, 0x66, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x10,
-0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x0d, 0x02, 0x01,
-0x02, 0x06, 0x00, 0x01, 0x02, 0x01, 0x01, 0x04, 0x02, 0x08, 0x02, 0x03,
-0x03, 0x02, 0x01, 0x03, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00,
-0x00, 0x04, 0x00, 0x12, 0x08, 0x02, 0x01, 0x00, 0x04, 0x02, 0x0e, 0x02,
-0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x04,
-0x00, 0x10, 0x02, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02,
-0x01, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00,
-0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
-0x00, 0x04, 0x02, 0x00, 0x01, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05,
-0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63,
-0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
-0x03, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x00,
-0x02, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f,
-0x6e, 0x73, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x73, 0x65, 0x74, 0x21,
-0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x0d, 0x01, 0x03, 0x02, 0x01, 0x04,
-0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x02, 0x00, 0x0c, 0x00,
-0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01,
-0x01, 0x02, 0x02, 0x00, 0x03, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x04,
-0x00, 0x00, 0x02, 0x08, 0x00, 0x0e, 0x00, 0x04, 0x00, 0x00, 0x01, 0x04,
-0x01, 0x00, 0x02, 0x01, 0x01, 0x04, 0x00, 0x00, 0x01, 0x0a, 0x01, 0x01,
-0x01, 0x01, 0x00, 0x05, 0x02, 0x03, 0x23, 0x00, 0x00, 0x00, 0x02, 0x03,
-0x00, 0x00, 0x00, 0x63, 0x64, 0x72, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00,
-0x65, 0x71, 0x76, 0x3f, 0x00, 0x02, 0x0a, 0x00, 0x00, 0x00, 0x63, 0x6f,
-0x72, 0x65, 0x23, 0x62, 0x65, 0x67, 0x69, 0x6e, 0x00, 0x04, 0x00, 0x00,
-0x01, 0x08, 0x00, 0x10, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
-0x02, 0x0f, 0x02, 0x01, 0x02, 0x06, 0x00, 0x01, 0x02, 0x01, 0x01, 0x04,
-0x02, 0x0a, 0x02, 0x03, 0x03, 0x02, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01,
-0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x6d, 0x61,
-0x70, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x11, 0x02,
-0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x00, 0x02, 0x10,
-0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73,
-0x00, 0x02, 0x02, 0x00, 0x00, 0x00, 0x69, 0x66, 0x00, 0x06, 0x00, 0x00,
-0x04, 0x01, 0x0c, 0x01, 0x03, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01,
-0x03, 0x01, 0x00, 0x04, 0x02, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x00,
-0x00, 0x02, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x02, 0x00,
-0x03, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x02, 0x08,
-0x00, 0x0e, 0x00, 0x04, 0x00, 0x00, 0x01, 0x04, 0x01, 0x00, 0x02, 0x01,
-0x01, 0x04, 0x00, 0x00, 0x01, 0x0a, 0x01, 0x01, 0x01, 0x01, 0x00, 0x05,
-0x01, 0x02, 0x33, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63,
-0x64, 0x72, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x70, 0x00,
-0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x10, 0x00, 0x06, 0x00, 0x00, 0x02,
-0x01, 0x00, 0x04, 0x02, 0x11, 0x02, 0x01, 0x02, 0x09, 0x00, 0x08, 0x00,
-0x15, 0x00, 0x06, 0x00, 0x01, 0x04, 0x01, 0x0c, 0x01, 0x04, 0x02, 0x12,
-0x02, 0x04, 0x03, 0x11, 0x02, 0x01, 0x03, 0x04, 0x00, 0x0c, 0x01, 0x0c,
-0x01, 0x01, 0x01, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00,
-0x02, 0x03, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x70, 0x00, 0x06, 0x00, 0x00,
+0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x0b, 0x03,
+0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02,
+0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00,
 0x02, 0x01, 0x00, 0x04, 0x02, 0x13, 0x02, 0x04, 0x03, 0x00, 0x01, 0x01,
 0x03, 0x01, 0x00, 0x05, 0x00, 0x02, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04,
-0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x02, 0x05, 0x00, 0x00,
-0x00, 0x62, 0x65, 0x67, 0x69, 0x6e, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01,
-0x0e, 0x01, 0x03, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01,
-0x00, 0x03, 0x02, 0x00, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01,
-0x05, 0x00, 0x02, 0x04, 0x02, 0x00, 0x00, 0x02, 0x01, 0x01, 0x01, 0x01,
-0x01, 0x00, 0x08, 0x01, 0x00, 0x13, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
-0x04, 0x01, 0x00, 0x01, 0x0a, 0x02, 0x0a, 0x03, 0x0a, 0x04, 0x0a, 0x05,
-0x0a, 0x06, 0x01, 0x06, 0x06, 0x00, 0x04, 0x02, 0x00, 0x0b, 0x00, 0x00,
-0x00, 0x02, 0x00, 0x00, 0x02, 0x01, 0x01, 0x0d, 0x02, 0x00, 0x01, 0x02,
-0x02, 0x00, 0x03, 0x01, 0x00, 0x09, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-0x01, 0x02, 0x01, 0x00, 0x01, 0x01, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0f,
-0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x06, 0x00,
-0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x01, 0x02, 0x0d, 0x03, 0x01, 0x01,
-0x03, 0x01, 0x00, 0x04, 0x01, 0x01, 0x14, 0x00, 0x00, 0x00, 0x02, 0x0e,
-0x00, 0x00, 0x00, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x2d, 0x3e, 0x73,
-0x74, 0x72, 0x69, 0x6e, 0x67, 0x00, 0x04, 0x00, 0x00, 0x01, 0x05, 0x00,
-0x02, 0x02, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x02, 0x02,
-0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x02, 0x0f, 0x00, 0x00, 0x00, 0x02,
-0x0d, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x2d, 0x61,
-0x70, 0x70, 0x65, 0x6e, 0x64, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x24,
-0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x03, 0x02, 0x01, 0x04, 0x03,
-0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x00, 0x01, 0x0d, 0x00, 0x00,
-0x00, 0x02, 0x0e, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67,
-0x2d, 0x3e, 0x73, 0x79, 0x6d, 0x62, 0x6f, 0x6c, 0x00, 0x06, 0x00, 0x00,
-0x04, 0x01, 0x03, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00,
-0x03, 0x05, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x05,
-0x00, 0x01, 0x06, 0x02, 0x00, 0x00, 0x05, 0x00, 0x01, 0x05, 0x02, 0x00,
-0x01, 0x05, 0x00, 0x01, 0x04, 0x02, 0x00, 0x02, 0x05, 0x00, 0x01, 0x03,
-0x02, 0x00, 0x03, 0x05, 0x00, 0x01, 0x02, 0x04, 0x00, 0x01, 0x01, 0x02,
-0x01, 0x04, 0x01, 0x01, 0x03, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00,
-0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x61, 0x72, 0x00, 0x06, 0x00,
-0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x01, 0x02, 0x01, 0x00,
-0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x01,
-0x01, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x02, 0x00, 0x05, 0x01,
-0x02, 0x0f, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x65, 0x71,
-0x76, 0x3f, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x72, 0x65, 0x66, 0x00,
-0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x03, 0x03,
-0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x02, 0x00, 0x0c, 0x00, 0x00, 0x00,
-0x02, 0x00, 0x00, 0x02, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02,
-0x02, 0x00, 0x05, 0x01, 0x02, 0x21, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00,
-0x00, 0x00, 0x65, 0x71, 0x76, 0x3f, 0x00, 0x02, 0x06, 0x00, 0x00, 0x00,
-0x6c, 0x61, 0x6d, 0x62, 0x64, 0x61, 0x00, 0x04, 0x00, 0x00, 0x02, 0x08,
-0x00, 0x0e, 0x00, 0x04, 0x00, 0x00, 0x01, 0x04, 0x01, 0x00, 0x02, 0x01,
-0x01, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x02, 0x02, 0x03,
-0x03, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00,
-0x00, 0x02, 0x00, 0x00, 0x04, 0x01, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01,
-0x01, 0x02, 0x02, 0x00, 0x05, 0x01, 0x02, 0x21, 0x00, 0x00, 0x00, 0x02,
-0x04, 0x00, 0x00, 0x00, 0x65, 0x71, 0x76, 0x3f, 0x00, 0x02, 0x05, 0x00,
-0x00, 0x00, 0x71, 0x75, 0x6f, 0x74, 0x65, 0x00, 0x04, 0x00, 0x00, 0x02,
+0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x02, 0x06, 0x00, 0x00,
+0x00, 0x6c, 0x61, 0x6d, 0x62, 0x64, 0x61, 0x00, 0x06, 0x00, 0x00, 0x04,
+0x01, 0x0c, 0x01, 0x03, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03,
+0x02, 0x00, 0x05, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00,
+0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
+0x00, 0x0a, 0x02, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x00, 0x02,
+0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e,
+0x73, 0x00, 0x02, 0x05, 0x00, 0x00, 0x00, 0x71, 0x75, 0x6f, 0x74, 0x65,
+0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x01, 0x01, 0x03, 0x02, 0x01, 0x04,
+0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00,
+0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x01, 0x05, 0x01, 0x04, 0x02, 0x00,
+0x01, 0x01, 0x02, 0x02, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00,
+0x02, 0x1b, 0x00, 0x00, 0x00, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74,
+0x2d, 0x64, 0x79, 0x6e, 0x61, 0x6d, 0x69, 0x63, 0x2d, 0x65, 0x6e, 0x76,
+0x69, 0x72, 0x6f, 0x6e, 0x6d, 0x65, 0x6e, 0x74, 0x00, 0x06, 0x00, 0x00,
+0x02, 0x01, 0x00, 0x04, 0x02, 0x06, 0x03, 0x01, 0x02, 0x01, 0x00, 0x03,
+0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x01, 0x04, 0x01,
+0x01, 0x02, 0x01, 0x01, 0x01, 0x00, 0x04, 0x02, 0x00, 0x0c, 0x00, 0x00,
+0x00, 0x02, 0x00, 0x00, 0x02, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01,
+0x02, 0x02, 0x00, 0x03, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x04, 0x00,
+0x00, 0x02, 0x08, 0x00, 0x0e, 0x00, 0x04, 0x00, 0x00, 0x01, 0x04, 0x01,
+0x00, 0x02, 0x01, 0x01, 0x04, 0x00, 0x00, 0x01, 0x0a, 0x01, 0x01, 0x01,
+0x01, 0x00, 0x05, 0x02, 0x03, 0x23, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00,
+0x00, 0x00, 0x63, 0x61, 0x64, 0x72, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00,
+0x65, 0x71, 0x76, 0x3f, 0x00, 0x02, 0x07, 0x00, 0x00, 0x00, 0x63, 0x6f,
+0x72, 0x65, 0x23, 0x69, 0x66, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00,
+0x10, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x0d, 0x02,
+0x01, 0x02, 0x06, 0x00, 0x01, 0x02, 0x01, 0x01, 0x04, 0x02, 0x08, 0x02,
+0x03, 0x03, 0x02, 0x01, 0x03, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00,
+0x00, 0x00, 0x04, 0x00, 0x12, 0x09, 0x02, 0x01, 0x00, 0x04, 0x02, 0x0e,
+0x02, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00,
+0x04, 0x00, 0x10, 0x02, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01,
+0x02, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x04,
+0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02,
+0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00,
+0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00,
+0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
+0x02, 0x03, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05,
+0x00, 0x02, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63,
+0x6f, 0x6e, 0x73, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x73, 0x65, 0x74,
+0x21, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x0d, 0x01, 0x03, 0x02, 0x01,
+0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x02, 0x00, 0x0c,
+0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x01, 0x01, 0x04, 0x02, 0x00,
+0x01, 0x01, 0x02, 0x02, 0x00, 0x03, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00,
+0x04, 0x00, 0x00, 0x02, 0x08, 0x00, 0x0e, 0x00, 0x04, 0x00, 0x00, 0x01,
+0x04, 0x01, 0x00, 0x02, 0x01, 0x01, 0x04, 0x00, 0x00, 0x01, 0x0a, 0x01,
+0x01, 0x01, 0x01, 0x00, 0x05, 0x02, 0x03, 0x23, 0x00, 0x00, 0x00, 0x02,
+0x03, 0x00, 0x00, 0x00, 0x63, 0x64, 0x72, 0x00, 0x02, 0x04, 0x00, 0x00,
+0x00, 0x65, 0x71, 0x76, 0x3f, 0x00, 0x02, 0x0a, 0x00, 0x00, 0x00, 0x63,
+0x6f, 0x72, 0x65, 0x23, 0x62, 0x65, 0x67, 0x69, 0x6e, 0x00, 0x04, 0x00,
+0x00, 0x01, 0x08, 0x00, 0x10, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
+0x04, 0x02, 0x0f, 0x02, 0x01, 0x02, 0x06, 0x00, 0x01, 0x02, 0x01, 0x01,
+0x04, 0x02, 0x0a, 0x02, 0x03, 0x03, 0x02, 0x01, 0x03, 0x01, 0x00, 0x05,
+0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x6d,
+0x61, 0x70, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x11,
+0x02, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x00, 0x02,
+0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e,
+0x73, 0x00, 0x02, 0x02, 0x00, 0x00, 0x00, 0x69, 0x66, 0x00, 0x06, 0x00,
+0x00, 0x04, 0x01, 0x0c, 0x01, 0x03, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01,
+0x01, 0x03, 0x01, 0x00, 0x04, 0x02, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x02,
+0x00, 0x00, 0x02, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x02,
+0x00, 0x03, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x02,
 0x08, 0x00, 0x0e, 0x00, 0x04, 0x00, 0x00, 0x01, 0x04, 0x01, 0x00, 0x02,
-0x01, 0x01, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x04, 0x02,
-0x03, 0x03, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00,
-0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x01, 0x01, 0x01, 0x04, 0x02, 0x00,
+0x01, 0x01, 0x04, 0x00, 0x00, 0x01, 0x0a, 0x01, 0x01, 0x01, 0x01, 0x00,
+0x05, 0x02, 0x03, 0x23, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00,
+0x63, 0x64, 0x72, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x65, 0x71, 0x76,
+0x3f, 0x00, 0x02, 0x0f, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x72, 0x65, 0x23,
+0x72, 0x65, 0x63, 0x6f, 0x72, 0x64, 0x2d, 0x72, 0x65, 0x66, 0x00, 0x04,
+0x00, 0x00, 0x01, 0x08, 0x00, 0x10, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
+0x00, 0x04, 0x02, 0x11, 0x02, 0x01, 0x02, 0x06, 0x00, 0x01, 0x02, 0x01,
+0x01, 0x04, 0x02, 0x0c, 0x02, 0x03, 0x03, 0x02, 0x01, 0x03, 0x01, 0x00,
+0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00,
+0x6d, 0x61, 0x70, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
+0x13, 0x02, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x00,
+0x02, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f,
+0x6e, 0x73, 0x00, 0x02, 0x05, 0x00, 0x00, 0x00, 0x62, 0x65, 0x67, 0x69,
+0x6e, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x0e, 0x01, 0x03, 0x02, 0x01,
+0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x02, 0x00, 0x0c,
+0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x01, 0x01, 0x04, 0x02, 0x00,
 0x01, 0x01, 0x02, 0x02, 0x00, 0x03, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00,
 0x04, 0x00, 0x00, 0x02, 0x08, 0x00, 0x0e, 0x00, 0x04, 0x00, 0x00, 0x01,
 0x04, 0x01, 0x00, 0x02, 0x01, 0x01, 0x04, 0x00, 0x00, 0x01, 0x0a, 0x01,
 0x01, 0x01, 0x01, 0x00, 0x05, 0x02, 0x02, 0x24, 0x00, 0x00, 0x00, 0x02,
-0x04, 0x00, 0x00, 0x00, 0x65, 0x71, 0x76, 0x3f, 0x00, 0x02, 0x05, 0x00,
-0x00, 0x00, 0x62, 0x65, 0x67, 0x69, 0x6e, 0x00, 0x04, 0x00, 0x00, 0x01,
-0x08, 0x00, 0x11, 0x00, 0x04, 0x00, 0x06, 0x02, 0x02, 0x01, 0x00, 0x04,
-0x02, 0x04, 0x02, 0x01, 0x02, 0x06, 0x00, 0x00, 0x02, 0x01, 0x01, 0x04,
-0x02, 0x02, 0x02, 0x03, 0x03, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x00,
-0x00, 0x0e, 0x00, 0x00, 0x00, 0x04, 0x00, 0x05, 0x03, 0x04, 0x01, 0x03,
-0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00,
-0x0c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x01, 0x01, 0x04, 0x02,
-0x00, 0x01, 0x01, 0x02, 0x02, 0x00, 0x03, 0x00, 0x00, 0x1a, 0x00, 0x00,
-0x00, 0x04, 0x00, 0x00, 0x02, 0x08, 0x00, 0x0e, 0x00, 0x04, 0x00, 0x00,
-0x01, 0x04, 0x01, 0x00, 0x02, 0x01, 0x01, 0x04, 0x00, 0x00, 0x01, 0x0a,
-0x01, 0x01, 0x01, 0x01, 0x00, 0x05, 0x02, 0x03, 0x23, 0x00, 0x00, 0x00,
-0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x61, 0x64, 0x72, 0x00, 0x02, 0x04,
-0x00, 0x00, 0x00, 0x65, 0x71, 0x76, 0x3f, 0x00, 0x02, 0x04, 0x00, 0x00,
-0x00, 0x73, 0x65, 0x74, 0x21, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00,
-0x10, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x06, 0x02,
-0x01, 0x02, 0x06, 0x00, 0x01, 0x02, 0x01, 0x01, 0x04, 0x02, 0x04, 0x02,
-0x03, 0x03, 0x02, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x00, 0x11, 0x00,
-0x00, 0x00, 0x04, 0x00, 0x09, 0x05, 0x04, 0x01, 0x05, 0x01, 0x04, 0x02,
-0x00, 0x01, 0x02, 0x03, 0x00, 0x01, 0x03, 0x02, 0x00, 0x04, 0x01, 0x00,
-0x0d, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0e, 0x08, 0x02, 0x01, 0x00, 0x04,
-0x02, 0x08, 0x02, 0x01, 0x02, 0x01, 0x00, 0x05, 0x00, 0x00, 0x12, 0x00,
-0x00, 0x00, 0x04, 0x00, 0x0b, 0x05, 0x04, 0x01, 0x01, 0x01, 0x04, 0x02,
-0x00, 0x01, 0x04, 0x03, 0x09, 0x03, 0x01, 0x03, 0x01, 0x00, 0x04, 0x02,
-0x00, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x01, 0x01, 0x04,
+0x04, 0x00, 0x00, 0x00, 0x65, 0x71, 0x76, 0x3f, 0x00, 0x02, 0x10, 0x00,
+0x00, 0x00, 0x63, 0x6f, 0x72, 0x65, 0x23, 0x72, 0x65, 0x63, 0x6f, 0x72,
+0x64, 0x2d, 0x73, 0x65, 0x74, 0x21, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08,
+0x00, 0x11, 0x00, 0x04, 0x00, 0x17, 0x08, 0x02, 0x01, 0x00, 0x04, 0x02,
+0x13, 0x02, 0x01, 0x02, 0x06, 0x00, 0x00, 0x02, 0x01, 0x01, 0x04, 0x02,
+0x0e, 0x02, 0x03, 0x03, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x01, 0x01,
+0x0c, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x61, 0x64,
+0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x14, 0x02,
+0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x04,
+0x00, 0x16, 0x02, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02,
+0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x04, 0x00, 0x1a,
+0x09, 0x02, 0x01, 0x00, 0x04, 0x02, 0x16, 0x02, 0x01, 0x02, 0x01, 0x00,
+0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x04, 0x00, 0x18, 0x02, 0x02,
+0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01,
+0x01, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f,
+0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00,
+0x01, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00,
+0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00,
+0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x03, 0x01, 0x04, 0x03,
+0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00,
+0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06,
+0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x06, 0x01, 0x04, 0x03, 0x00,
+0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x00, 0x02, 0x10, 0x00, 0x00, 0x00,
+0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x02, 0x0a,
+0x00, 0x00, 0x00, 0x72, 0x65, 0x63, 0x6f, 0x72, 0x64, 0x2d, 0x72, 0x65,
+0x66, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x16, 0x01, 0x03, 0x02, 0x01,
+0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x02, 0x00, 0x0c,
+0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x01, 0x01, 0x04, 0x02, 0x00,
+0x01, 0x01, 0x02, 0x02, 0x00, 0x03, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00,
+0x04, 0x00, 0x00, 0x02, 0x08, 0x00, 0x0e, 0x00, 0x04, 0x00, 0x00, 0x01,
+0x04, 0x01, 0x00, 0x02, 0x01, 0x01, 0x04, 0x00, 0x00, 0x01, 0x0a, 0x01,
+0x01, 0x01, 0x01, 0x00, 0x05, 0x01, 0x01, 0x34, 0x00, 0x00, 0x00, 0x02,
+0x03, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x70, 0x00, 0x04, 0x00, 0x00, 0x01,
+0x08, 0x00, 0x11, 0x00, 0x04, 0x00, 0x19, 0x08, 0x02, 0x01, 0x00, 0x04,
+0x02, 0x15, 0x02, 0x01, 0x02, 0x09, 0x00, 0x08, 0x00, 0x15, 0x00, 0x06,
+0x00, 0x00, 0x04, 0x01, 0x10, 0x01, 0x04, 0x02, 0x16, 0x02, 0x04, 0x03,
+0x15, 0x02, 0x01, 0x03, 0x04, 0x00, 0x10, 0x01, 0x0c, 0x01, 0x01, 0x01,
+0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00,
+0x00, 0x00, 0x63, 0x61, 0x64, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
+0x00, 0x04, 0x02, 0x16, 0x02, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x00,
+0x0d, 0x00, 0x00, 0x00, 0x04, 0x00, 0x18, 0x02, 0x02, 0x01, 0x00, 0x04,
+0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00,
+0x00, 0x00, 0x04, 0x00, 0x1c, 0x09, 0x02, 0x01, 0x00, 0x04, 0x02, 0x18,
+0x02, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00,
+0x04, 0x00, 0x1a, 0x02, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01,
+0x02, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x04, 0x00,
+0x1e, 0x07, 0x02, 0x01, 0x00, 0x04, 0x02, 0x1a, 0x02, 0x01, 0x02, 0x01,
+0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00,
+0x00, 0x63, 0x61, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
+0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00,
+0x00, 0x00, 0x04, 0x00, 0x1d, 0x02, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00,
+0x01, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00, 0x00, 0x00,
+0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00,
+0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x0b, 0x03, 0x01, 0x03,
+0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00,
+0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
+0x00, 0x04, 0x02, 0x04, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01,
+0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00,
+0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
+0x04, 0x02, 0x07, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00,
+0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00,
+0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
+0x02, 0x0a, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05,
+0x00, 0x02, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63,
+0x6f, 0x6e, 0x73, 0x00, 0x02, 0x0b, 0x00, 0x00, 0x00, 0x72, 0x65, 0x63,
+0x6f, 0x72, 0x64, 0x2d, 0x73, 0x65, 0x74, 0x21, 0x00, 0x06, 0x00, 0x00,
+0x04, 0x01, 0x1c, 0x01, 0x03, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01,
+0x03, 0x01, 0x00, 0x03, 0x02, 0x00, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00,
+0x00, 0x01, 0x05, 0x00, 0x02, 0x04, 0x02, 0x00, 0x00, 0x02, 0x01, 0x01,
+0x01, 0x01, 0x01, 0x00, 0x08, 0x01, 0x00, 0x13, 0x00, 0x00, 0x00, 0x02,
+0x00, 0x00, 0x04, 0x01, 0x00, 0x01, 0x0a, 0x02, 0x0a, 0x03, 0x0a, 0x04,
+0x0a, 0x05, 0x0a, 0x06, 0x01, 0x06, 0x06, 0x00, 0x04, 0x02, 0x00, 0x0b,
+0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x01, 0x01, 0x0d, 0x02, 0x00,
+0x01, 0x02, 0x02, 0x00, 0x03, 0x01, 0x00, 0x09, 0x00, 0x00, 0x00, 0x04,
+0x00, 0x00, 0x01, 0x02, 0x01, 0x00, 0x01, 0x01, 0x01, 0x00, 0x05, 0x01,
+0x01, 0x0f, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0x00, 0x2b, 0x00,
+0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x01, 0x02, 0x0d, 0x03,
+0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x01, 0x01, 0x14, 0x00, 0x00, 0x00,
+0x02, 0x0e, 0x00, 0x00, 0x00, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x2d,
+0x3e, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x00, 0x04, 0x00, 0x00, 0x01,
+0x05, 0x00, 0x02, 0x02, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
+0x02, 0x02, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x02, 0x0f, 0x00, 0x00,
+0x00, 0x02, 0x0d, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67,
+0x2d, 0x61, 0x70, 0x70, 0x65, 0x6e, 0x64, 0x00, 0x01, 0x01, 0x00, 0x00,
+0x00, 0x24, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x03, 0x02, 0x01,
+0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x00, 0x01, 0x0d,
+0x00, 0x00, 0x00, 0x02, 0x0e, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x69,
+0x6e, 0x67, 0x2d, 0x3e, 0x73, 0x79, 0x6d, 0x62, 0x6f, 0x6c, 0x00, 0x06,
+0x00, 0x00, 0x04, 0x01, 0x03, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02,
+0x01, 0x00, 0x03, 0x05, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
+0x01, 0x05, 0x00, 0x01, 0x06, 0x02, 0x00, 0x00, 0x05, 0x00, 0x01, 0x05,
+0x02, 0x00, 0x01, 0x05, 0x00, 0x01, 0x04, 0x02, 0x00, 0x02, 0x05, 0x00,
+0x01, 0x03, 0x02, 0x00, 0x03, 0x05, 0x00, 0x01, 0x02, 0x04, 0x00, 0x01,
+0x01, 0x02, 0x01, 0x04, 0x01, 0x01, 0x03, 0x00, 0x04, 0x01, 0x01, 0x0c,
+0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x61, 0x72, 0x00,
+0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x01, 0x02,
+0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+0x04, 0x01, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x02, 0x00,
+0x05, 0x01, 0x02, 0x0f, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00,
+0x65, 0x71, 0x76, 0x3f, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x72, 0x65,
+0x66, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02,
+0x03, 0x03, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x02, 0x00, 0x0c, 0x00,
+0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01,
+0x01, 0x02, 0x02, 0x00, 0x05, 0x01, 0x02, 0x21, 0x00, 0x00, 0x00, 0x02,
+0x04, 0x00, 0x00, 0x00, 0x65, 0x71, 0x76, 0x3f, 0x00, 0x02, 0x06, 0x00,
+0x00, 0x00, 0x6c, 0x61, 0x6d, 0x62, 0x64, 0x61, 0x00, 0x04, 0x00, 0x00,
+0x02, 0x08, 0x00, 0x0e, 0x00, 0x04, 0x00, 0x00, 0x01, 0x04, 0x01, 0x00,
+0x02, 0x01, 0x01, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x02,
+0x02, 0x03, 0x03, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d,
+0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x01, 0x01, 0x01, 0x04, 0x02,
+0x00, 0x01, 0x01, 0x02, 0x02, 0x00, 0x05, 0x01, 0x02, 0x21, 0x00, 0x00,
+0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x65, 0x71, 0x76, 0x3f, 0x00, 0x02,
+0x05, 0x00, 0x00, 0x00, 0x71, 0x75, 0x6f, 0x74, 0x65, 0x00, 0x04, 0x00,
+0x00, 0x02, 0x08, 0x00, 0x0e, 0x00, 0x04, 0x00, 0x00, 0x01, 0x04, 0x01,
+0x00, 0x02, 0x01, 0x01, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
+0x04, 0x02, 0x03, 0x03, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x01, 0x00,
+0x0d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x01, 0x01, 0x01, 0x04,
 0x02, 0x00, 0x01, 0x01, 0x02, 0x02, 0x00, 0x03, 0x00, 0x00, 0x1a, 0x00,
 0x00, 0x00, 0x04, 0x00, 0x00, 0x02, 0x08, 0x00, 0x0e, 0x00, 0x04, 0x00,
 0x00, 0x01, 0x04, 0x01, 0x00, 0x02, 0x01, 0x01, 0x04, 0x00, 0x00, 0x01,
 0x0a, 0x01, 0x01, 0x01, 0x01, 0x00, 0x05, 0x02, 0x02, 0x24, 0x00, 0x00,
 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x65, 0x71, 0x76, 0x3f, 0x00, 0x02,
-0x02, 0x00, 0x00, 0x00, 0x69, 0x66, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08,
-0x00, 0x11, 0x00, 0x04, 0x00, 0x0e, 0x08, 0x02, 0x01, 0x00, 0x04, 0x02,
-0x08, 0x02, 0x01, 0x02, 0x06, 0x00, 0x00, 0x02, 0x01, 0x01, 0x04, 0x02,
-0x06, 0x02, 0x03, 0x03, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x00,
-0x11, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0b, 0x05, 0x04, 0x01, 0x07, 0x01,
+0x0a, 0x00, 0x00, 0x00, 0x72, 0x65, 0x63, 0x6f, 0x72, 0x64, 0x2d, 0x72,
+0x65, 0x66, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x11, 0x00, 0x04,
+0x00, 0x06, 0x02, 0x02, 0x01, 0x00, 0x04, 0x02, 0x04, 0x02, 0x01, 0x02,
+0x06, 0x00, 0x00, 0x02, 0x01, 0x01, 0x04, 0x02, 0x02, 0x02, 0x03, 0x03,
+0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00,
+0x04, 0x00, 0x05, 0x03, 0x04, 0x01, 0x03, 0x01, 0x04, 0x02, 0x00, 0x01,
+0x01, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x02,
+0x00, 0x00, 0x02, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x02,
+0x00, 0x03, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x02,
+0x08, 0x00, 0x0e, 0x00, 0x04, 0x00, 0x00, 0x01, 0x04, 0x01, 0x00, 0x02,
+0x01, 0x01, 0x04, 0x00, 0x00, 0x01, 0x0a, 0x01, 0x01, 0x01, 0x01, 0x00,
+0x05, 0x02, 0x03, 0x23, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00,
+0x63, 0x64, 0x64, 0x72, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x65, 0x71,
+0x76, 0x3f, 0x00, 0x02, 0x0b, 0x00, 0x00, 0x00, 0x72, 0x65, 0x63, 0x6f,
+0x72, 0x64, 0x2d, 0x73, 0x65, 0x74, 0x21, 0x00, 0x04, 0x00, 0x00, 0x01,
+0x08, 0x00, 0x10, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
+0x06, 0x02, 0x01, 0x02, 0x06, 0x00, 0x01, 0x02, 0x01, 0x01, 0x04, 0x02,
+0x04, 0x02, 0x03, 0x03, 0x02, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x00,
+0x11, 0x00, 0x00, 0x00, 0x04, 0x00, 0x09, 0x04, 0x04, 0x01, 0x05, 0x01,
 0x04, 0x02, 0x00, 0x01, 0x02, 0x03, 0x00, 0x01, 0x03, 0x02, 0x00, 0x04,
 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63,
 0x61, 0x64, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
-0x0a, 0x02, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x02, 0x0d, 0x00, 0x00,
-0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x02,
-0x09, 0x00, 0x00, 0x00, 0x75, 0x6e, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65,
-0x64, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x03, 0x02, 0x01, 0x0b,
-0x03, 0x01, 0x03, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00,
-0x04, 0x00, 0x0c, 0x03, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01,
-0x02, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x04,
-0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02,
-0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00,
-0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00,
-0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
-0x02, 0x04, 0x02, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05,
-0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63,
+0x08, 0x02, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00,
+0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06,
+0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x04, 0x03, 0x01,
+0x02, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x02, 0x0f, 0x00, 0x00, 0x00,
+0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x02, 0x0a,
+0x00, 0x00, 0x00, 0x72, 0x65, 0x63, 0x6f, 0x72, 0x64, 0x2d, 0x72, 0x65,
+0x66, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x03, 0x02, 0x01, 0x04,
+0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x00, 0x00, 0x0e, 0x00,
+0x00, 0x00, 0x04, 0x00, 0x0b, 0x03, 0x04, 0x01, 0x03, 0x01, 0x04, 0x02,
+0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x0c, 0x00, 0x00,
+0x00, 0x02, 0x00, 0x00, 0x02, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01,
+0x02, 0x02, 0x00, 0x03, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x04, 0x00,
+0x00, 0x02, 0x08, 0x00, 0x0e, 0x00, 0x04, 0x00, 0x00, 0x01, 0x04, 0x01,
+0x00, 0x02, 0x01, 0x01, 0x04, 0x00, 0x00, 0x01, 0x0a, 0x01, 0x01, 0x01,
+0x01, 0x00, 0x05, 0x02, 0x03, 0x23, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00,
+0x00, 0x00, 0x63, 0x64, 0x64, 0x72, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00,
+0x65, 0x71, 0x76, 0x3f, 0x00, 0x02, 0x05, 0x00, 0x00, 0x00, 0x62, 0x65,
+0x67, 0x69, 0x6e, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x10, 0x00,
+0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x08, 0x02, 0x01, 0x02,
+0x06, 0x00, 0x01, 0x02, 0x01, 0x01, 0x04, 0x02, 0x06, 0x02, 0x03, 0x03,
+0x02, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x00, 0x11, 0x00, 0x00, 0x00,
+0x04, 0x00, 0x0b, 0x04, 0x04, 0x01, 0x07, 0x01, 0x04, 0x02, 0x00, 0x01,
+0x02, 0x03, 0x00, 0x01, 0x03, 0x02, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00,
+0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x61, 0x64, 0x72, 0x00,
+0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x0a, 0x02, 0x01, 0x02,
+0x01, 0x00, 0x05, 0x01, 0x02, 0x0d, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00,
+0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x02, 0x09, 0x00, 0x00, 0x00,
+0x75, 0x6e, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x64, 0x00, 0x06, 0x00,
+0x00, 0x02, 0x01, 0x00, 0x03, 0x02, 0x01, 0x0b, 0x03, 0x01, 0x03, 0x01,
+0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0c, 0x03,
+0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x05,
+0x01, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63,
 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
-0x04, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x00,
-0x02, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f,
-0x6e, 0x73, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x73, 0x65, 0x74, 0x21,
-0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x06, 0x01, 0x03, 0x02, 0x01, 0x04,
-0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x02, 0x00, 0x0c, 0x00,
-0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01,
-0x01, 0x02, 0x02, 0x00, 0x03, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x04,
-0x00, 0x00, 0x02, 0x08, 0x00, 0x0e, 0x00, 0x04, 0x00, 0x00, 0x01, 0x04,
-0x01, 0x00, 0x02, 0x01, 0x01, 0x04, 0x00, 0x00, 0x01, 0x0a, 0x01, 0x01,
-0x01, 0x01, 0x00, 0x03, 0x02, 0x00, 0x28, 0x00, 0x00, 0x00, 0x04, 0x00,
-0x00, 0x01, 0x08, 0x00, 0x0d, 0x00, 0x04, 0x00, 0x0c, 0x06, 0x02, 0x01,
-0x00, 0x01, 0x01, 0x09, 0x00, 0x08, 0x00, 0x0d, 0x00, 0x04, 0x00, 0x0c,
-0x06, 0x02, 0x01, 0x01, 0x01, 0x01, 0x04, 0x00, 0x08, 0x01, 0x0c, 0x01,
-0x01, 0x01, 0x01, 0x00, 0x03, 0x01, 0x00, 0x09, 0x00, 0x00, 0x00, 0x04,
-0x00, 0x0d, 0x06, 0x02, 0x01, 0x00, 0x01, 0x01, 0x01, 0x00, 0x05, 0x01,
-0x00, 0x11, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x01, 0x0a, 0x01,
-0x04, 0x02, 0x01, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x03, 0x00,
-0x05, 0x01, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00,
-0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
-0x02, 0x00, 0x03, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x04, 0x01, 0x01,
-0x0c, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x61, 0x64,
-0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x0e, 0x02,
-0x01, 0x02, 0x01, 0x00, 0x05, 0x02, 0x00, 0x10, 0x00, 0x00, 0x00, 0x04,
-0x00, 0x11, 0x05, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x02, 0x03,
-0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00, 0x00, 0x00,
-0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00,
-0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x0b, 0x03, 0x01, 0x03,
+0x00, 0x01, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10,
+0x00, 0x00, 0x00, 0x02, 0x06, 0x00, 0x00, 0x00, 0x61, 0x70, 0x70, 0x65,
+0x6e, 0x64, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x04,
+0x02, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01,
+0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e,
+0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x04, 0x01,
+0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x00, 0x02, 0x10,
+0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73,
+0x00, 0x02, 0x0b, 0x00, 0x00, 0x00, 0x72, 0x65, 0x63, 0x6f, 0x72, 0x64,
+0x2d, 0x73, 0x65, 0x74, 0x21, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x06,
+0x01, 0x03, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00,
+0x04, 0x02, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x01,
+0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x02, 0x00, 0x03, 0x00, 0x00,
+0x1a, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x02, 0x08, 0x00, 0x0e, 0x00,
+0x04, 0x00, 0x00, 0x01, 0x04, 0x01, 0x00, 0x02, 0x01, 0x01, 0x04, 0x00,
+0x00, 0x01, 0x0a, 0x01, 0x01, 0x01, 0x01, 0x00, 0x05, 0x02, 0x03, 0x23,
+0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x61, 0x64, 0x72,
+0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x65, 0x71, 0x76, 0x3f, 0x00, 0x02,
+0x04, 0x00, 0x00, 0x00, 0x73, 0x65, 0x74, 0x21, 0x00, 0x04, 0x00, 0x00,
+0x01, 0x08, 0x00, 0x10, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
+0x02, 0x0a, 0x02, 0x01, 0x02, 0x06, 0x00, 0x01, 0x02, 0x01, 0x01, 0x04,
+0x02, 0x08, 0x02, 0x03, 0x03, 0x02, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01,
+0x00, 0x11, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0d, 0x05, 0x04, 0x01, 0x09,
+0x01, 0x04, 0x02, 0x00, 0x01, 0x02, 0x03, 0x00, 0x01, 0x03, 0x02, 0x00,
+0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x04, 0x00, 0x12, 0x09, 0x02,
+0x01, 0x00, 0x04, 0x02, 0x0c, 0x02, 0x01, 0x02, 0x01, 0x00, 0x05, 0x00,
+0x00, 0x12, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0f, 0x05, 0x04, 0x01, 0x01,
+0x01, 0x04, 0x02, 0x00, 0x01, 0x04, 0x03, 0x0d, 0x03, 0x01, 0x03, 0x01,
+0x00, 0x04, 0x02, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02,
+0x01, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x02, 0x00, 0x03, 0x00,
+0x00, 0x1a, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x02, 0x08, 0x00, 0x0e,
+0x00, 0x04, 0x00, 0x00, 0x01, 0x04, 0x01, 0x00, 0x02, 0x01, 0x01, 0x04,
+0x00, 0x00, 0x01, 0x0a, 0x01, 0x01, 0x01, 0x01, 0x00, 0x05, 0x02, 0x02,
+0x24, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x65, 0x71, 0x76,
+0x3f, 0x00, 0x02, 0x02, 0x00, 0x00, 0x00, 0x69, 0x66, 0x00, 0x04, 0x00,
+0x00, 0x01, 0x08, 0x00, 0x11, 0x00, 0x04, 0x00, 0x12, 0x09, 0x02, 0x01,
+0x00, 0x04, 0x02, 0x0c, 0x02, 0x01, 0x02, 0x06, 0x00, 0x00, 0x02, 0x01,
+0x01, 0x04, 0x02, 0x0a, 0x02, 0x03, 0x03, 0x01, 0x01, 0x03, 0x01, 0x00,
+0x05, 0x01, 0x00, 0x11, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0f, 0x05, 0x04,
+0x01, 0x0b, 0x01, 0x04, 0x02, 0x00, 0x01, 0x02, 0x03, 0x00, 0x01, 0x03,
+0x02, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00,
+0x00, 0x00, 0x63, 0x61, 0x64, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
+0x00, 0x04, 0x02, 0x0e, 0x02, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x02,
+0x0d, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e,
+0x73, 0x00, 0x02, 0x09, 0x00, 0x00, 0x00, 0x75, 0x6e, 0x64, 0x65, 0x66,
+0x69, 0x6e, 0x65, 0x64, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x03,
+0x02, 0x01, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d,
+0x00, 0x00, 0x00, 0x04, 0x00, 0x10, 0x03, 0x02, 0x01, 0x00, 0x04, 0x02,
+0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00, 0x00,
+0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06,
+0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x0b, 0x03, 0x01,
+0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04,
+0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02,
+0x01, 0x00, 0x04, 0x02, 0x04, 0x02, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03,
 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00,
 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
-0x00, 0x04, 0x02, 0x03, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01,
-0x00, 0x05, 0x01, 0x02, 0x0f, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00,
-0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x02, 0x06, 0x00, 0x00, 0x00, 0x6c,
-0x61, 0x6d, 0x62, 0x64, 0x61, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
-0x03, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05,
-0x01, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63,
-0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
-0x06, 0x02, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0e,
+0x00, 0x04, 0x02, 0x04, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01,
+0x00, 0x05, 0x00, 0x02, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00,
+0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x73,
+0x65, 0x74, 0x21, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x06, 0x01, 0x03,
+0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x02,
+0x00, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x01, 0x01, 0x04,
+0x02, 0x00, 0x01, 0x01, 0x02, 0x02, 0x00, 0x03, 0x00, 0x00, 0x1a, 0x00,
+0x00, 0x00, 0x04, 0x00, 0x00, 0x02, 0x08, 0x00, 0x0e, 0x00, 0x04, 0x00,
+0x00, 0x01, 0x04, 0x01, 0x00, 0x02, 0x01, 0x01, 0x04, 0x00, 0x00, 0x01,
+0x0a, 0x01, 0x01, 0x01, 0x01, 0x00, 0x03, 0x02, 0x00, 0x28, 0x00, 0x00,
+0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x0d, 0x00, 0x04, 0x00, 0x10,
+0x06, 0x02, 0x01, 0x00, 0x01, 0x01, 0x09, 0x00, 0x08, 0x00, 0x0d, 0x00,
+0x04, 0x00, 0x10, 0x06, 0x02, 0x01, 0x01, 0x01, 0x01, 0x04, 0x00, 0x0c,
+0x01, 0x0c, 0x01, 0x01, 0x01, 0x01, 0x00, 0x03, 0x01, 0x00, 0x09, 0x00,
+0x00, 0x00, 0x04, 0x00, 0x11, 0x06, 0x02, 0x01, 0x00, 0x01, 0x01, 0x01,
+0x00, 0x05, 0x01, 0x00, 0x11, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04,
+0x01, 0x0e, 0x01, 0x04, 0x02, 0x01, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01,
+0x03, 0x03, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x04,
+0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02,
+0x01, 0x00, 0x04, 0x02, 0x00, 0x03, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00,
+0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00,
+0x63, 0x61, 0x64, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
+0x02, 0x12, 0x02, 0x01, 0x02, 0x01, 0x00, 0x05, 0x02, 0x00, 0x10, 0x00,
+0x00, 0x00, 0x04, 0x00, 0x15, 0x05, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00,
+0x01, 0x02, 0x03, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0e,
 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73,
-0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x07, 0x02, 0x0b,
-0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x02, 0x0f, 0x00, 0x00, 0x00,
-0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x02, 0x03,
-0x00, 0x00, 0x00, 0x72, 0x65, 0x66, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
-0x00, 0x03, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00,
-0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x04, 0x00, 0x16, 0x03, 0x02,
-0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01,
-0x01, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f,
-0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00,
-0x01, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00,
-0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00,
-0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x04, 0x01, 0x04, 0x03,
-0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x02, 0x0f, 0x00, 0x00,
-0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x02,
-0x06, 0x00, 0x00, 0x00, 0x6c, 0x61, 0x6d, 0x62, 0x64, 0x61, 0x00, 0x06,
-0x00, 0x00, 0x02, 0x01, 0x00, 0x03, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01,
-0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x02,
-0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00,
-0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x0b, 0x03, 0x01, 0x03, 0x01,
-0x00, 0x05, 0x00, 0x01, 0x11, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00,
-0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x0e,
-0x01, 0x04, 0x02, 0x08, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x02,
-0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x04, 0x00, 0x16, 0x08,
-0x02, 0x01, 0x00, 0x04, 0x02, 0x10, 0x02, 0x01, 0x02, 0x01, 0x00, 0x05,
+0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x0b,
+0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00,
+0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00,
+0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x03, 0x01, 0x04, 0x03, 0x00, 0x01,
+0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x02, 0x0f, 0x00, 0x00, 0x00, 0x02,
+0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x02, 0x06, 0x00,
+0x00, 0x00, 0x6c, 0x61, 0x6d, 0x62, 0x64, 0x61, 0x00, 0x06, 0x00, 0x00,
+0x02, 0x01, 0x00, 0x03, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03,
+0x01, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00,
+0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
+0x00, 0x04, 0x02, 0x06, 0x02, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05,
 0x01, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63,
 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
-0x04, 0x03, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x02, 0x0f,
+0x07, 0x02, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x02, 0x0f,
 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73,
 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x72, 0x65, 0x66, 0x00, 0x06, 0x00,
 0x00, 0x02, 0x01, 0x00, 0x03, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01,
-0x03, 0x01, 0x00, 0x05, 0x01, 0x00, 0x11, 0x00, 0x00, 0x00, 0x04, 0x00,
-0x15, 0x03, 0x02, 0x01, 0x00, 0x04, 0x02, 0x02, 0x01, 0x04, 0x03, 0x00,
-0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00,
-0x04, 0x00, 0x1a, 0x07, 0x02, 0x01, 0x00, 0x04, 0x02, 0x14, 0x02, 0x01,
-0x02, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x04,
-0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02,
-0x01, 0x00, 0x04, 0x02, 0x08, 0x03, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00,
-0x05, 0x01, 0x02, 0x0f, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00,
-0x63, 0x6f, 0x6e, 0x73, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x72, 0x65,
-0x66, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x03, 0x02, 0x01, 0x04,
-0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x00, 0x11, 0x00,
-0x00, 0x00, 0x04, 0x00, 0x19, 0x03, 0x02, 0x01, 0x00, 0x04, 0x02, 0x02,
-0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01,
-0x0e, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e,
-0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01,
-0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00,
-0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06,
-0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x05, 0x01, 0x04, 0x03, 0x00,
-0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00,
-0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00,
-0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x0a, 0x02, 0x04, 0x03, 0x00, 0x01,
-0x01, 0x03, 0x01, 0x00, 0x05, 0x00, 0x02, 0x10, 0x00, 0x00, 0x00, 0x02,
-0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x02, 0x02, 0x00,
-0x00, 0x00, 0x69, 0x66, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x0b, 0x01,
-0x03, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04,
-0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x01, 0x09,
-0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x02, 0x00, 0x05, 0x01, 0x01,
-0x0e, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e,
-0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02,
-0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00, 0x00,
+0x03, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x04, 0x00,
+0x1a, 0x03, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01,
+0x00, 0x05, 0x01, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00,
+0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
+0x04, 0x02, 0x00, 0x01, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01,
+0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f,
+0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x04,
+0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x02,
+0x0f, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e,
+0x73, 0x00, 0x02, 0x06, 0x00, 0x00, 0x00, 0x6c, 0x61, 0x6d, 0x62, 0x64,
+0x61, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x03, 0x02, 0x01, 0x04,
+0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00,
+0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00,
+0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x0b, 0x03,
+0x01, 0x03, 0x01, 0x00, 0x05, 0x00, 0x01, 0x11, 0x00, 0x00, 0x00, 0x02,
+0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00,
+0x04, 0x01, 0x0e, 0x01, 0x04, 0x02, 0x08, 0x01, 0x04, 0x03, 0x00, 0x01,
+0x01, 0x03, 0x02, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x04,
+0x00, 0x1a, 0x09, 0x02, 0x01, 0x00, 0x04, 0x02, 0x14, 0x02, 0x01, 0x02,
+0x01, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00,
+0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
+0x00, 0x04, 0x02, 0x04, 0x03, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05,
+0x01, 0x02, 0x0f, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63,
+0x6f, 0x6e, 0x73, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x72, 0x65, 0x66,
+0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x03, 0x02, 0x01, 0x04, 0x03,
+0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x00, 0x11, 0x00, 0x00,
+0x00, 0x04, 0x00, 0x19, 0x03, 0x02, 0x01, 0x00, 0x04, 0x02, 0x02, 0x01,
+0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d,
+0x00, 0x00, 0x00, 0x04, 0x00, 0x1e, 0x08, 0x02, 0x01, 0x00, 0x04, 0x02,
+0x18, 0x02, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00, 0x00,
 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06,
-0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x01, 0x02, 0x0b, 0x03, 0x01,
+0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x08, 0x03, 0x0b, 0x03, 0x01,
 0x03, 0x01, 0x00, 0x05, 0x01, 0x02, 0x0f, 0x00, 0x00, 0x00, 0x02, 0x04,
 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x02, 0x03, 0x00, 0x00,
 0x00, 0x72, 0x65, 0x66, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x03,
-0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x01,
-0x00, 0x0d, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0f, 0x03, 0x02, 0x01, 0x00,
-0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0e,
+0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01,
+0x00, 0x11, 0x00, 0x00, 0x00, 0x04, 0x00, 0x1d, 0x03, 0x02, 0x01, 0x00,
+0x04, 0x02, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00,
+0x05, 0x01, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00,
+0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
+0x02, 0x00, 0x01, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01,
+0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e,
+0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x05, 0x01,
+0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10,
 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73,
-0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x0b,
-0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00,
-0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00,
-0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x04, 0x01, 0x04, 0x03, 0x00, 0x01,
-0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x02, 0x0f, 0x00, 0x00, 0x00, 0x02,
-0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x02, 0x06, 0x00,
-0x00, 0x00, 0x6c, 0x61, 0x6d, 0x62, 0x64, 0x61, 0x00, 0x06, 0x00, 0x00,
+0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x0a, 0x02, 0x04,
+0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x00, 0x02, 0x10, 0x00,
+0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00,
+0x02, 0x02, 0x00, 0x00, 0x00, 0x69, 0x66, 0x00, 0x06, 0x00, 0x00, 0x04,
+0x01, 0x0b, 0x01, 0x03, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03,
+0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+0x04, 0x01, 0x0d, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x02, 0x00,
+0x05, 0x01, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00,
+0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
+0x02, 0x00, 0x02, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01,
+0x0e, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e,
+0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x01, 0x02,
+0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x02, 0x0f, 0x00, 0x00,
+0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x02,
+0x03, 0x00, 0x00, 0x00, 0x72, 0x65, 0x66, 0x00, 0x06, 0x00, 0x00, 0x02,
+0x01, 0x00, 0x03, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01,
+0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x04, 0x00, 0x13, 0x03,
+0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x05,
+0x01, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63,
+0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
+0x00, 0x01, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10,
+0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73,
+0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x04, 0x01, 0x04,
+0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x02, 0x0f, 0x00,
+0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00,
+0x02, 0x06, 0x00, 0x00, 0x00, 0x6c, 0x61, 0x6d, 0x62, 0x64, 0x61, 0x00,
+0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x03, 0x02, 0x01, 0x04, 0x03, 0x00,
+0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00,
+0x02, 0x00, 0x00, 0x04, 0x01, 0x07, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01,
+0x02, 0x02, 0x00, 0x03, 0x01, 0x00, 0x09, 0x00, 0x00, 0x00, 0x02, 0x00,
+0x00, 0x04, 0x01, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x04, 0x01, 0x01,
+0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x61, 0x72,
+0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x19, 0x02, 0x01,
+0x02, 0x01, 0x00, 0x05, 0x01, 0x00, 0x11, 0x00, 0x00, 0x00, 0x04, 0x00,
+0x1c, 0x05, 0x04, 0x01, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01, 0x02, 0x03,
+0x00, 0x01, 0x03, 0x02, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00,
+0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x64, 0x72, 0x00, 0x06, 0x00, 0x00,
+0x02, 0x01, 0x00, 0x04, 0x02, 0x1b, 0x02, 0x01, 0x02, 0x01, 0x00, 0x05,
+0x01, 0x00, 0x11, 0x00, 0x00, 0x00, 0x04, 0x00, 0x1e, 0x04, 0x04, 0x01,
+0x01, 0x01, 0x04, 0x02, 0x00, 0x01, 0x02, 0x03, 0x00, 0x01, 0x03, 0x02,
+0x00, 0x05, 0x01, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x06, 0x00, 0x00,
+0x00, 0x61, 0x70, 0x70, 0x65, 0x6e, 0x64, 0x00, 0x06, 0x00, 0x00, 0x02,
+0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00,
+0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00,
+0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
+0x02, 0x06, 0x02, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05,
+0x00, 0x01, 0x11, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63,
+0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x02, 0x01, 0x04,
+0x02, 0x04, 0x02, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x03, 0x00, 0x04,
+0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x05, 0x00, 0x00, 0x00, 0x6e,
+0x75, 0x6c, 0x6c, 0x3f, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
+0x02, 0x00, 0x02, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x20, 0x00,
+0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x61, 0x72, 0x00, 0x04,
+0x00, 0x00, 0x01, 0x08, 0x00, 0x10, 0x00, 0x04, 0x00, 0x01, 0x03, 0x04,
+0x01, 0x01, 0x01, 0x0b, 0x02, 0x01, 0x02, 0x06, 0x00, 0x00, 0x02, 0x01,
+0x00, 0x04, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x00,
+0x11, 0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x05, 0x04, 0x01, 0x02, 0x01,
+0x04, 0x02, 0x00, 0x01, 0x02, 0x03, 0x00, 0x01, 0x03, 0x02, 0x00, 0x04,
+0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63,
+0x64, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x03,
+0x02, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x00, 0x11, 0x00, 0x00, 0x00,
+0x04, 0x00, 0x06, 0x04, 0x04, 0x01, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01,
+0x02, 0x03, 0x00, 0x01, 0x03, 0x02, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00,
+0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00,
+0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x02, 0x02, 0x04, 0x03,
+0x00, 0x02, 0x01, 0x03, 0x01, 0x00, 0x04, 0x00, 0x00, 0x0e, 0x00, 0x00,
+0x00, 0x04, 0x00, 0x06, 0x03, 0x04, 0x01, 0x01, 0x01, 0x04, 0x02, 0x00,
+0x01, 0x01, 0x02, 0x03, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00,
+0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x61, 0x72, 0x00, 0x06, 0x00, 0x00,
+0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x01, 0x02, 0x01, 0x00, 0x04,
+0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x01, 0x01,
+0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x02, 0x00, 0x05, 0x01, 0x02,
+0x0f, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x65, 0x71, 0x76,
+0x3f, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x72, 0x65, 0x66, 0x00, 0x06,
+0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x03, 0x03, 0x01,
+0x01, 0x03, 0x01, 0x00, 0x04, 0x02, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x02,
+0x00, 0x00, 0x02, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x02,
+0x00, 0x05, 0x01, 0x02, 0x21, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00,
+0x00, 0x65, 0x71, 0x76, 0x3f, 0x00, 0x02, 0x06, 0x00, 0x00, 0x00, 0x6c,
+0x61, 0x6d, 0x62, 0x64, 0x61, 0x00, 0x04, 0x00, 0x00, 0x02, 0x08, 0x00,
+0x0e, 0x00, 0x04, 0x00, 0x00, 0x01, 0x04, 0x01, 0x00, 0x02, 0x01, 0x01,
+0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x02, 0x02, 0x03, 0x03,
+0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00,
+0x02, 0x00, 0x00, 0x04, 0x01, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01,
+0x02, 0x02, 0x00, 0x05, 0x01, 0x02, 0x21, 0x00, 0x00, 0x00, 0x02, 0x04,
+0x00, 0x00, 0x00, 0x65, 0x71, 0x76, 0x3f, 0x00, 0x02, 0x05, 0x00, 0x00,
+0x00, 0x71, 0x75, 0x6f, 0x74, 0x65, 0x00, 0x04, 0x00, 0x00, 0x02, 0x08,
+0x00, 0x0e, 0x00, 0x04, 0x00, 0x00, 0x01, 0x04, 0x01, 0x00, 0x02, 0x01,
+0x01, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x04, 0x02, 0x03,
+0x03, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00,
+0x00, 0x02, 0x00, 0x00, 0x04, 0x01, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01,
+0x01, 0x02, 0x02, 0x00, 0x03, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x04,
+0x00, 0x00, 0x02, 0x08, 0x00, 0x0e, 0x00, 0x04, 0x00, 0x00, 0x01, 0x04,
+0x01, 0x00, 0x02, 0x01, 0x01, 0x04, 0x00, 0x00, 0x01, 0x0a, 0x01, 0x01,
+0x01, 0x01, 0x00, 0x05, 0x02, 0x02, 0x24, 0x00, 0x00, 0x00, 0x02, 0x04,
+0x00, 0x00, 0x00, 0x65, 0x71, 0x76, 0x3f, 0x00, 0x02, 0x0a, 0x00, 0x00,
+0x00, 0x72, 0x65, 0x63, 0x6f, 0x72, 0x64, 0x2d, 0x72, 0x65, 0x66, 0x00,
+0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x11, 0x00, 0x04, 0x00, 0x06, 0x02,
+0x02, 0x01, 0x00, 0x04, 0x02, 0x04, 0x02, 0x01, 0x02, 0x06, 0x00, 0x00,
+0x02, 0x01, 0x01, 0x04, 0x02, 0x02, 0x02, 0x03, 0x03, 0x01, 0x01, 0x03,
+0x01, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00,
+0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
+0x00, 0x04, 0x02, 0x00, 0x01, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05,
+0x00, 0x01, 0x11, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63,
+0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x04, 0x01, 0x04,
+0x02, 0x06, 0x03, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04,
+0x02, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x01, 0x01,
+0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x02, 0x00, 0x03, 0x00, 0x00, 0x1a,
+0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x02, 0x08, 0x00, 0x0e, 0x00, 0x04,
+0x00, 0x00, 0x01, 0x04, 0x01, 0x00, 0x02, 0x01, 0x01, 0x04, 0x00, 0x00,
+0x01, 0x0a, 0x01, 0x01, 0x01, 0x01, 0x00, 0x05, 0x02, 0x03, 0x23, 0x00,
+0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x64, 0x64, 0x72, 0x00,
+0x02, 0x04, 0x00, 0x00, 0x00, 0x65, 0x71, 0x76, 0x3f, 0x00, 0x02, 0x0b,
+0x00, 0x00, 0x00, 0x72, 0x65, 0x63, 0x6f, 0x72, 0x64, 0x2d, 0x73, 0x65,
+0x74, 0x21, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x10, 0x00, 0x06,
+0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x06, 0x02, 0x01, 0x02, 0x06,
+0x00, 0x01, 0x02, 0x01, 0x01, 0x04, 0x02, 0x04, 0x02, 0x03, 0x03, 0x02,
+0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x00, 0x11, 0x00, 0x00, 0x00, 0x04,
+0x00, 0x09, 0x04, 0x04, 0x01, 0x05, 0x01, 0x04, 0x02, 0x00, 0x01, 0x02,
+0x03, 0x00, 0x01, 0x03, 0x02, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00,
+0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x61, 0x64, 0x72, 0x00, 0x06,
+0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x08, 0x02, 0x01, 0x02, 0x01,
+0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00,
+0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
+0x04, 0x02, 0x00, 0x01, 0x04, 0x03, 0x01, 0x02, 0x01, 0x03, 0x01, 0x00,
+0x05, 0x01, 0x02, 0x0f, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00,
+0x63, 0x6f, 0x6e, 0x73, 0x00, 0x02, 0x0a, 0x00, 0x00, 0x00, 0x72, 0x65,
+0x63, 0x6f, 0x72, 0x64, 0x2d, 0x72, 0x65, 0x66, 0x00, 0x06, 0x00, 0x00,
 0x02, 0x01, 0x00, 0x03, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03,
-0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
-0x04, 0x01, 0x07, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x02, 0x00,
-0x03, 0x01, 0x00, 0x09, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x01,
-0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00,
-0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x61, 0x72, 0x00, 0x06, 0x00,
-0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x15, 0x02, 0x01, 0x02, 0x01, 0x00,
-0x05, 0x01, 0x00, 0x11, 0x00, 0x00, 0x00, 0x04, 0x00, 0x18, 0x05, 0x04,
-0x01, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01, 0x02, 0x03, 0x00, 0x01, 0x03,
-0x02, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00,
-0x00, 0x00, 0x63, 0x64, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
-0x04, 0x02, 0x17, 0x02, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x00, 0x11,
-0x00, 0x00, 0x00, 0x04, 0x00, 0x1a, 0x04, 0x04, 0x01, 0x01, 0x01, 0x04,
-0x02, 0x00, 0x01, 0x02, 0x03, 0x00, 0x01, 0x03, 0x02, 0x00, 0x05, 0x01,
-0x01, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x06, 0x00, 0x00, 0x00, 0x61, 0x70,
-0x70, 0x65, 0x6e, 0x64, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
-0x02, 0x00, 0x02, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01,
-0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e,
-0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x06, 0x02,
-0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x00, 0x01, 0x11,
-0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73,
-0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x02, 0x01, 0x04, 0x02, 0x04, 0x02,
-0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x03, 0x00, 0x04, 0x01, 0x01, 0x0c,
-0x00, 0x00, 0x00, 0x02, 0x05, 0x00, 0x00, 0x00, 0x6e, 0x75, 0x6c, 0x6c,
-0x3f, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02,
-0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x20, 0x00, 0x00, 0x00, 0x02,
-0x03, 0x00, 0x00, 0x00, 0x63, 0x61, 0x72, 0x00, 0x04, 0x00, 0x00, 0x01,
-0x08, 0x00, 0x10, 0x00, 0x04, 0x00, 0x01, 0x03, 0x04, 0x01, 0x01, 0x01,
-0x0b, 0x02, 0x01, 0x02, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
-0x01, 0x02, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x00, 0x11, 0x00, 0x00,
-0x00, 0x04, 0x00, 0x04, 0x05, 0x04, 0x01, 0x02, 0x01, 0x04, 0x02, 0x00,
-0x01, 0x02, 0x03, 0x00, 0x01, 0x03, 0x02, 0x00, 0x04, 0x01, 0x01, 0x0c,
-0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x64, 0x72, 0x00,
-0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x03, 0x02, 0x01, 0x02,
-0x01, 0x00, 0x05, 0x01, 0x00, 0x11, 0x00, 0x00, 0x00, 0x04, 0x00, 0x06,
-0x04, 0x04, 0x01, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01, 0x02, 0x03, 0x00,
-0x01, 0x03, 0x02, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02,
-0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00,
-0x02, 0x01, 0x00, 0x04, 0x02, 0x02, 0x02, 0x04, 0x03, 0x00, 0x02, 0x01,
-0x03, 0x01, 0x00, 0x04, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x04, 0x00,
-0x06, 0x03, 0x04, 0x01, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02,
-0x03, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00,
-0x00, 0x00, 0x63, 0x61, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
-0x04, 0x02, 0x00, 0x02, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d,
-0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x01, 0x01, 0x01, 0x04, 0x02,
-0x00, 0x01, 0x01, 0x02, 0x02, 0x00, 0x05, 0x01, 0x02, 0x0f, 0x00, 0x00,
-0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x65, 0x71, 0x76, 0x3f, 0x00, 0x02,
-0x03, 0x00, 0x00, 0x00, 0x72, 0x65, 0x66, 0x00, 0x06, 0x00, 0x00, 0x02,
-0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x03, 0x03, 0x01, 0x01, 0x03, 0x01,
-0x00, 0x04, 0x02, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02,
-0x01, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x02, 0x00, 0x05, 0x01,
-0x02, 0x21, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x65, 0x71,
-0x76, 0x3f, 0x00, 0x02, 0x06, 0x00, 0x00, 0x00, 0x6c, 0x61, 0x6d, 0x62,
-0x64, 0x61, 0x00, 0x04, 0x00, 0x00, 0x02, 0x08, 0x00, 0x0e, 0x00, 0x04,
-0x00, 0x00, 0x01, 0x04, 0x01, 0x00, 0x02, 0x01, 0x01, 0x06, 0x00, 0x00,
-0x02, 0x01, 0x00, 0x04, 0x02, 0x02, 0x02, 0x03, 0x03, 0x01, 0x01, 0x03,
-0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
-0x04, 0x01, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x02, 0x00,
-0x05, 0x01, 0x02, 0x21, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00,
-0x65, 0x71, 0x76, 0x3f, 0x00, 0x02, 0x05, 0x00, 0x00, 0x00, 0x71, 0x75,
-0x6f, 0x74, 0x65, 0x00, 0x04, 0x00, 0x00, 0x02, 0x08, 0x00, 0x0e, 0x00,
-0x04, 0x00, 0x00, 0x01, 0x04, 0x01, 0x00, 0x02, 0x01, 0x01, 0x06, 0x00,
-0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x04, 0x02, 0x03, 0x03, 0x01, 0x01,
-0x03, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x02, 0x00,
-0x00, 0x04, 0x01, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x02,
-0x00, 0x03, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x02,
-0x08, 0x00, 0x0e, 0x00, 0x04, 0x00, 0x00, 0x01, 0x04, 0x01, 0x00, 0x02,
-0x01, 0x01, 0x04, 0x00, 0x00, 0x01, 0x0a, 0x01, 0x01, 0x01, 0x01, 0x00,
-0x05, 0x02, 0x02, 0x24, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00,
-0x65, 0x71, 0x76, 0x3f, 0x00, 0x02, 0x05, 0x00, 0x00, 0x00, 0x62, 0x65,
-0x67, 0x69, 0x6e, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x11, 0x00,
-0x04, 0x00, 0x06, 0x02, 0x02, 0x01, 0x00, 0x04, 0x02, 0x04, 0x02, 0x01,
-0x02, 0x06, 0x00, 0x00, 0x02, 0x01, 0x01, 0x04, 0x02, 0x02, 0x02, 0x03,
-0x03, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00, 0x00,
+0x01, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00,
+0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
+0x00, 0x04, 0x02, 0x00, 0x01, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05,
+0x00, 0x01, 0x11, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63,
+0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x04, 0x01, 0x04,
+0x02, 0x0c, 0x03, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04,
+0x02, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x01, 0x01,
+0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x02, 0x00, 0x03, 0x00, 0x00, 0x1a,
+0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x02, 0x08, 0x00, 0x0e, 0x00, 0x04,
+0x00, 0x00, 0x01, 0x04, 0x01, 0x00, 0x02, 0x01, 0x01, 0x04, 0x00, 0x00,
+0x01, 0x0a, 0x01, 0x01, 0x01, 0x01, 0x00, 0x05, 0x02, 0x03, 0x23, 0x00,
+0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x64, 0x64, 0x72, 0x00,
+0x02, 0x04, 0x00, 0x00, 0x00, 0x65, 0x71, 0x76, 0x3f, 0x00, 0x02, 0x05,
+0x00, 0x00, 0x00, 0x62, 0x65, 0x67, 0x69, 0x6e, 0x00, 0x04, 0x00, 0x00,
+0x01, 0x08, 0x00, 0x10, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
+0x02, 0x08, 0x02, 0x01, 0x02, 0x06, 0x00, 0x01, 0x02, 0x01, 0x01, 0x04,
+0x02, 0x06, 0x02, 0x03, 0x03, 0x02, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01,
+0x00, 0x11, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0b, 0x04, 0x04, 0x01, 0x07,
+0x01, 0x04, 0x02, 0x00, 0x01, 0x02, 0x03, 0x00, 0x01, 0x03, 0x02, 0x00,
+0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00,
+0x63, 0x61, 0x64, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
+0x02, 0x0a, 0x02, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x02, 0x0d, 0x00,
+0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00,
+0x02, 0x09, 0x00, 0x00, 0x00, 0x75, 0x6e, 0x64, 0x65, 0x66, 0x69, 0x6e,
+0x65, 0x64, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x03, 0x02, 0x01,
+0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00, 0x00,
 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06,
 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x0b, 0x03, 0x01,
-0x03, 0x01, 0x00, 0x05, 0x00, 0x01, 0x11, 0x00, 0x00, 0x00, 0x02, 0x04,
-0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x04,
-0x01, 0x04, 0x01, 0x04, 0x02, 0x06, 0x03, 0x04, 0x03, 0x00, 0x01, 0x01,
+0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04,
+0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02,
+0x01, 0x00, 0x04, 0x02, 0x0d, 0x03, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03,
+0x01, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00,
+0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
+0x00, 0x04, 0x02, 0x00, 0x01, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05,
+0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x06, 0x00, 0x00, 0x00, 0x61,
+0x70, 0x70, 0x65, 0x6e, 0x64, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
+0x04, 0x02, 0x05, 0x02, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00,
+0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00,
+0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
+0x02, 0x05, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05,
+0x00, 0x02, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63,
+0x6f, 0x6e, 0x73, 0x00, 0x02, 0x0b, 0x00, 0x00, 0x00, 0x72, 0x65, 0x63,
+0x6f, 0x72, 0x64, 0x2d, 0x73, 0x65, 0x74, 0x21, 0x00, 0x06, 0x00, 0x00,
+0x04, 0x01, 0x07, 0x01, 0x03, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01,
 0x03, 0x01, 0x00, 0x04, 0x02, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x00,
 0x00, 0x02, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x02, 0x00,
 0x03, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x02, 0x08,
@@ -2993,14 +3199,14 @@ static const unsigned char eval_rom[] = {
 0x61, 0x64, 0x72, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x65, 0x71, 0x76,
 0x3f, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x73, 0x65, 0x74, 0x21, 0x00,
 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x10, 0x00, 0x06, 0x00, 0x00, 0x02,
-0x01, 0x00, 0x04, 0x02, 0x06, 0x02, 0x01, 0x02, 0x06, 0x00, 0x01, 0x02,
-0x01, 0x01, 0x04, 0x02, 0x04, 0x02, 0x03, 0x03, 0x02, 0x01, 0x03, 0x01,
-0x00, 0x05, 0x01, 0x00, 0x11, 0x00, 0x00, 0x00, 0x04, 0x00, 0x09, 0x05,
-0x04, 0x01, 0x05, 0x01, 0x04, 0x02, 0x00, 0x01, 0x02, 0x03, 0x00, 0x01,
+0x01, 0x00, 0x04, 0x02, 0x0a, 0x02, 0x01, 0x02, 0x06, 0x00, 0x01, 0x02,
+0x01, 0x01, 0x04, 0x02, 0x08, 0x02, 0x03, 0x03, 0x02, 0x01, 0x03, 0x01,
+0x00, 0x05, 0x01, 0x00, 0x11, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0d, 0x05,
+0x04, 0x01, 0x09, 0x01, 0x04, 0x02, 0x00, 0x01, 0x02, 0x03, 0x00, 0x01,
 0x03, 0x02, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x04, 0x00,
-0x0e, 0x08, 0x02, 0x01, 0x00, 0x04, 0x02, 0x08, 0x02, 0x01, 0x02, 0x01,
-0x00, 0x05, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0b, 0x03,
-0x04, 0x01, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01, 0x04, 0x03, 0x09, 0x03,
+0x12, 0x09, 0x02, 0x01, 0x00, 0x04, 0x02, 0x0c, 0x02, 0x01, 0x02, 0x01,
+0x00, 0x05, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0f, 0x03,
+0x04, 0x01, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01, 0x04, 0x03, 0x0d, 0x03,
 0x01, 0x03, 0x01, 0x00, 0x04, 0x02, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x02,
 0x00, 0x00, 0x02, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x02,
 0x00, 0x03, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x02,
@@ -3008,14 +3214,14 @@ static const unsigned char eval_rom[] = {
 0x01, 0x01, 0x04, 0x00, 0x00, 0x01, 0x0a, 0x01, 0x01, 0x01, 0x01, 0x00,
 0x05, 0x02, 0x02, 0x24, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00,
 0x65, 0x71, 0x76, 0x3f, 0x00, 0x02, 0x02, 0x00, 0x00, 0x00, 0x69, 0x66,
-0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x11, 0x00, 0x04, 0x00, 0x0e,
-0x08, 0x02, 0x01, 0x00, 0x04, 0x02, 0x08, 0x02, 0x01, 0x02, 0x06, 0x00,
-0x00, 0x02, 0x01, 0x01, 0x04, 0x02, 0x06, 0x02, 0x03, 0x03, 0x01, 0x01,
+0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x11, 0x00, 0x04, 0x00, 0x12,
+0x09, 0x02, 0x01, 0x00, 0x04, 0x02, 0x0c, 0x02, 0x01, 0x02, 0x06, 0x00,
+0x00, 0x02, 0x01, 0x01, 0x04, 0x02, 0x0a, 0x02, 0x03, 0x03, 0x01, 0x01,
 0x03, 0x01, 0x00, 0x05, 0x01, 0x00, 0x11, 0x00, 0x00, 0x00, 0x04, 0x00,
-0x0b, 0x05, 0x04, 0x01, 0x07, 0x01, 0x04, 0x02, 0x00, 0x01, 0x02, 0x03,
+0x0f, 0x05, 0x04, 0x01, 0x0b, 0x01, 0x04, 0x02, 0x00, 0x01, 0x02, 0x03,
 0x00, 0x01, 0x03, 0x02, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00,
 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x61, 0x64, 0x72, 0x00, 0x06, 0x00,
-0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x0a, 0x02, 0x01, 0x02, 0x01, 0x00,
+0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x0e, 0x02, 0x01, 0x02, 0x01, 0x00,
 0x05, 0x01, 0x02, 0x0d, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00,
 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x02, 0x09, 0x00, 0x00, 0x00, 0x75, 0x6e,
 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x64, 0x00, 0x06, 0x00, 0x00, 0x02,
@@ -3024,7 +3230,7 @@ static const unsigned char eval_rom[] = {
 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
 0x00, 0x01, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10,
 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73,
-0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x0d, 0x03, 0x04,
+0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x11, 0x03, 0x04,
 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00,
 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00,
 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x0b, 0x03,
@@ -3046,13 +3252,13 @@ static const unsigned char eval_rom[] = {
 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x61, 0x72, 0x00, 0x04,
 0x00, 0x00, 0x01, 0x08, 0x00, 0x0c, 0x00, 0x02, 0x00, 0x00, 0x02, 0x01,
 0x01, 0x01, 0x01, 0x09, 0x00, 0x08, 0x00, 0x10, 0x00, 0x06, 0x00, 0x00,
-0x02, 0x01, 0x02, 0x04, 0x02, 0x0a, 0x02, 0x01, 0x02, 0x04, 0x00, 0x08,
+0x02, 0x01, 0x02, 0x04, 0x02, 0x0e, 0x02, 0x01, 0x02, 0x04, 0x00, 0x0c,
 0x01, 0x0c, 0x01, 0x01, 0x01, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00,
 0x00, 0x00, 0x02, 0x05, 0x00, 0x00, 0x00, 0x70, 0x61, 0x69, 0x72, 0x3f,
-0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x0b, 0x03, 0x01,
+0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x0f, 0x03, 0x01,
 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x1c, 0x00, 0x00, 0x00, 0x02, 0x03,
 0x00, 0x00, 0x00, 0x63, 0x61, 0x72, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08,
-0x00, 0x10, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x0c,
+0x00, 0x10, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x10,
 0x03, 0x01, 0x02, 0x04, 0x00, 0x01, 0x01, 0x0a, 0x01, 0x01, 0x01, 0x01,
 0x00, 0x05, 0x00, 0x02, 0x10, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00,
 0x00, 0x65, 0x71, 0x3f, 0x00, 0x02, 0x06, 0x00, 0x00, 0x00, 0x6c, 0x61,
@@ -3060,16 +3266,16 @@ static const unsigned char eval_rom[] = {
 0x03, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04,
 0x02, 0x01, 0x1d, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63,
 0x61, 0x64, 0x72, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x0d, 0x00,
-0x04, 0x00, 0x0d, 0x06, 0x02, 0x01, 0x00, 0x01, 0x01, 0x06, 0x00, 0x00,
-0x02, 0x01, 0x01, 0x04, 0x02, 0x0b, 0x02, 0x01, 0x02, 0x01, 0x00, 0x04,
-0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x01, 0x0a,
+0x04, 0x00, 0x11, 0x06, 0x02, 0x01, 0x00, 0x01, 0x01, 0x06, 0x00, 0x00,
+0x02, 0x01, 0x01, 0x04, 0x02, 0x0f, 0x02, 0x01, 0x02, 0x01, 0x00, 0x04,
+0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x01, 0x0e,
 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x02, 0x00, 0x05, 0x01, 0x01,
 0x0e, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e,
 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02,
 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00,
 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x61, 0x64, 0x72, 0x00, 0x06,
-0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x0e, 0x02, 0x01, 0x02, 0x01,
-0x00, 0x05, 0x02, 0x00, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x11, 0x05,
+0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x12, 0x02, 0x01, 0x02, 0x01,
+0x00, 0x05, 0x02, 0x00, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x15, 0x05,
 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x02, 0x03, 0x01, 0x01, 0x03,
 0x01, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00,
 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
@@ -3082,12 +3288,12 @@ static const unsigned char eval_rom[] = {
 0x64, 0x61, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x03, 0x02, 0x01,
 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0e,
 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73,
-0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x13, 0x03, 0x0b,
+0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x17, 0x03, 0x0b,
 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x00, 0x01, 0x11, 0x00, 0x00, 0x00,
 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00,
 0x00, 0x04, 0x01, 0x07, 0x01, 0x04, 0x02, 0x01, 0x01, 0x04, 0x03, 0x00,
 0x01, 0x01, 0x03, 0x02, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00,
-0x04, 0x00, 0x16, 0x08, 0x02, 0x01, 0x00, 0x04, 0x02, 0x10, 0x02, 0x01,
+0x04, 0x00, 0x1a, 0x09, 0x02, 0x01, 0x00, 0x04, 0x02, 0x14, 0x02, 0x01,
 0x02, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x04,
 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02,
 0x01, 0x00, 0x04, 0x02, 0x04, 0x02, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00,
@@ -3095,17 +3301,17 @@ static const unsigned char eval_rom[] = {
 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x72, 0x65,
 0x66, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x03, 0x02, 0x01, 0x04,
 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x00, 0x11, 0x00,
-0x00, 0x00, 0x04, 0x00, 0x15, 0x03, 0x02, 0x01, 0x00, 0x04, 0x02, 0x02,
+0x00, 0x00, 0x04, 0x00, 0x19, 0x03, 0x02, 0x01, 0x00, 0x04, 0x02, 0x02,
 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x01, 0x00,
-0x0d, 0x00, 0x00, 0x00, 0x04, 0x00, 0x1a, 0x07, 0x02, 0x01, 0x00, 0x04,
-0x02, 0x14, 0x02, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00,
+0x0d, 0x00, 0x00, 0x00, 0x04, 0x00, 0x1e, 0x08, 0x02, 0x01, 0x00, 0x04,
+0x02, 0x18, 0x02, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00,
 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00,
 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x08, 0x02, 0x0b, 0x03,
 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x02, 0x0f, 0x00, 0x00, 0x00, 0x02,
 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x02, 0x03, 0x00,
 0x00, 0x00, 0x72, 0x65, 0x66, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
 0x03, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05,
-0x01, 0x00, 0x11, 0x00, 0x00, 0x00, 0x04, 0x00, 0x19, 0x03, 0x02, 0x01,
+0x01, 0x00, 0x11, 0x00, 0x00, 0x00, 0x04, 0x00, 0x1d, 0x03, 0x02, 0x01,
 0x00, 0x04, 0x02, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01,
 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00,
 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
@@ -3120,15 +3326,15 @@ static const unsigned char eval_rom[] = {
 0x00, 0x02, 0x02, 0x00, 0x00, 0x00, 0x69, 0x66, 0x00, 0x06, 0x00, 0x00,
 0x04, 0x01, 0x0b, 0x01, 0x03, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01,
 0x03, 0x01, 0x00, 0x05, 0x01, 0x00, 0x11, 0x00, 0x00, 0x00, 0x04, 0x00,
-0x0e, 0x05, 0x04, 0x01, 0x0a, 0x01, 0x04, 0x02, 0x00, 0x01, 0x02, 0x03,
+0x12, 0x05, 0x04, 0x01, 0x0e, 0x01, 0x04, 0x02, 0x00, 0x01, 0x02, 0x03,
 0x00, 0x01, 0x03, 0x02, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00,
-0x04, 0x00, 0x13, 0x08, 0x02, 0x01, 0x00, 0x04, 0x02, 0x0d, 0x02, 0x01,
+0x04, 0x00, 0x17, 0x09, 0x02, 0x01, 0x00, 0x04, 0x02, 0x11, 0x02, 0x01,
 0x02, 0x01, 0x00, 0x05, 0x01, 0x00, 0x11, 0x00, 0x00, 0x00, 0x04, 0x00,
-0x10, 0x03, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x04, 0x03, 0x0e,
+0x14, 0x03, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x04, 0x03, 0x12,
 0x03, 0x01, 0x03, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00,
-0x04, 0x00, 0x15, 0x07, 0x02, 0x01, 0x00, 0x04, 0x02, 0x0f, 0x02, 0x01,
+0x04, 0x00, 0x19, 0x08, 0x02, 0x01, 0x00, 0x04, 0x02, 0x13, 0x02, 0x01,
 0x02, 0x01, 0x00, 0x05, 0x01, 0x00, 0x11, 0x00, 0x00, 0x00, 0x04, 0x00,
-0x12, 0x03, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x04, 0x03, 0x10,
+0x16, 0x03, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x04, 0x03, 0x14,
 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00, 0x00, 0x00,
 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00,
 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x0b, 0x03, 0x01, 0x03,
@@ -3142,18 +3348,18 @@ static const unsigned char eval_rom[] = {
 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x02, 0x02, 0x00, 0x00, 0x00, 0x69, 0x66,
 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x07, 0x01, 0x03, 0x02, 0x01, 0x04,
 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x00, 0x11, 0x00,
-0x00, 0x00, 0x04, 0x00, 0x0d, 0x05, 0x04, 0x01, 0x09, 0x01, 0x04, 0x02,
+0x00, 0x00, 0x04, 0x00, 0x11, 0x05, 0x04, 0x01, 0x0d, 0x01, 0x04, 0x02,
 0x00, 0x01, 0x02, 0x03, 0x00, 0x01, 0x03, 0x02, 0x00, 0x04, 0x01, 0x01,
 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x64, 0x72,
-0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x0c, 0x02, 0x01,
+0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x10, 0x02, 0x01,
 0x02, 0x01, 0x00, 0x05, 0x01, 0x00, 0x11, 0x00, 0x00, 0x00, 0x04, 0x00,
-0x0f, 0x04, 0x04, 0x01, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01, 0x02, 0x03,
+0x13, 0x04, 0x04, 0x01, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01, 0x02, 0x03,
 0x00, 0x01, 0x03, 0x02, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00, 0x00, 0x00,
 0x02, 0x06, 0x00, 0x00, 0x00, 0x61, 0x70, 0x70, 0x65, 0x6e, 0x64, 0x00,
 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x0b, 0x03,
 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02,
 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00,
-0x02, 0x01, 0x00, 0x04, 0x02, 0x0f, 0x03, 0x04, 0x03, 0x00, 0x01, 0x01,
+0x02, 0x01, 0x00, 0x04, 0x02, 0x13, 0x03, 0x04, 0x03, 0x00, 0x01, 0x01,
 0x03, 0x01, 0x00, 0x05, 0x00, 0x01, 0x11, 0x00, 0x00, 0x00, 0x02, 0x04,
 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x04,
 0x01, 0x02, 0x01, 0x04, 0x02, 0x04, 0x02, 0x04, 0x03, 0x00, 0x01, 0x01,
@@ -3197,7 +3403,7 @@ static const unsigned char eval_rom[] = {
 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00,
 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
 0x00, 0x04, 0x02, 0x01, 0x02, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01,
-0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x04, 0x00, 0x10, 0x08,
+0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x04, 0x00, 0x10, 0x09,
 0x02, 0x01, 0x00, 0x04, 0x02, 0x0a, 0x02, 0x01, 0x02, 0x01, 0x00, 0x05,
 0x01, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63,
 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
@@ -3243,328 +3449,202 @@ static const unsigned char eval_rom[] = {
 0x01, 0x06, 0x01, 0x03, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03,
 0x01, 0x00, 0x03, 0x02, 0x00, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
 0x01, 0x05, 0x00, 0x03, 0x03, 0x02, 0x00, 0x00, 0x02, 0x01, 0x01, 0x01,
-0x01, 0x01, 0x00, 0x0f, 0x01, 0x00, 0x21, 0x00, 0x00, 0x00, 0x02, 0x00,
+0x01, 0x01, 0x00, 0x11, 0x01, 0x00, 0x25, 0x00, 0x00, 0x00, 0x02, 0x00,
 0x00, 0x04, 0x01, 0x00, 0x01, 0x0a, 0x02, 0x0a, 0x03, 0x0a, 0x04, 0x0a,
 0x05, 0x0a, 0x06, 0x0a, 0x07, 0x0a, 0x08, 0x0a, 0x09, 0x0a, 0x0a, 0x0a,
-0x0b, 0x0a, 0x0c, 0x0a, 0x0d, 0x01, 0x0d, 0x0d, 0x00, 0x04, 0x02, 0x01,
-0x11, 0x00, 0x00, 0x00, 0x02, 0x0e, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x6b,
-0x65, 0x2d, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x65, 0x74, 0x65, 0x72, 0x00,
-0x02, 0x00, 0x00, 0x05, 0x00, 0x00, 0x0d, 0x06, 0x00, 0x00, 0x02, 0x01,
-0x01, 0x0b, 0x02, 0x01, 0x02, 0x03, 0x00, 0x03, 0x01, 0x00, 0x09, 0x00,
-0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x01, 0x00, 0x01, 0x01, 0x01, 0x01,
-0x00, 0x04, 0x01, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04,
-0x01, 0x00, 0x01, 0x0a, 0x02, 0x01, 0x02, 0x02, 0x00, 0x05, 0x01, 0x00,
-0x18, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x05, 0x00, 0x00, 0x02, 0x04,
-0x00, 0x00, 0x02, 0x04, 0x01, 0x00, 0x01, 0x0d, 0x02, 0x00, 0x04, 0x03,
-0x02, 0x03, 0x01, 0x03, 0x03, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00,
-0x00, 0x02, 0x05, 0x00, 0x00, 0x00, 0x6e, 0x75, 0x6c, 0x6c, 0x3f, 0x00,
+0x0b, 0x0a, 0x0c, 0x0a, 0x0d, 0x0a, 0x0e, 0x0a, 0x0f, 0x01, 0x0f, 0x0f,
+0x00, 0x04, 0x02, 0x01, 0x11, 0x00, 0x00, 0x00, 0x02, 0x0e, 0x00, 0x00,
+0x00, 0x6d, 0x61, 0x6b, 0x65, 0x2d, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x65,
+0x74, 0x65, 0x72, 0x00, 0x02, 0x00, 0x00, 0x05, 0x00, 0x00, 0x0f, 0x06,
+0x00, 0x00, 0x02, 0x01, 0x01, 0x0b, 0x02, 0x01, 0x02, 0x03, 0x00, 0x03,
+0x01, 0x00, 0x09, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x01, 0x00,
+0x01, 0x01, 0x01, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0b, 0x00, 0x00, 0x00,
+0x02, 0x00, 0x00, 0x04, 0x01, 0x00, 0x01, 0x0a, 0x02, 0x01, 0x02, 0x02,
+0x00, 0x05, 0x01, 0x00, 0x18, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x05,
+0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x02, 0x04, 0x01, 0x00, 0x01, 0x0d,
+0x02, 0x00, 0x04, 0x03, 0x02, 0x03, 0x01, 0x03, 0x03, 0x00, 0x04, 0x01,
+0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x05, 0x00, 0x00, 0x00, 0x6e, 0x75,
+0x6c, 0x6c, 0x3f, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
+0x00, 0x03, 0x01, 0x02, 0x01, 0x00, 0x05, 0x02, 0x01, 0x1f, 0x00, 0x00,
+0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x04,
+0x00, 0x00, 0x01, 0x08, 0x00, 0x12, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
+0x00, 0x04, 0x02, 0x04, 0x02, 0x0b, 0x03, 0x01, 0x03, 0x02, 0x00, 0x01,
+0x04, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x05, 0x00, 0x02, 0x10,
+0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73,
+0x00, 0x02, 0x06, 0x00, 0x00, 0x00, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c,
+0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x02, 0x01, 0x03, 0x02, 0x01, 0x04,
+0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0b, 0x00,
+0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x01, 0x00, 0x01, 0x0a, 0x02, 0x01,
+0x02, 0x02, 0x00, 0x04, 0x02, 0x01, 0x13, 0x00, 0x00, 0x00, 0x02, 0x03,
+0x00, 0x00, 0x00, 0x63, 0x61, 0x72, 0x00, 0x02, 0x00, 0x00, 0x05, 0x00,
+0x00, 0x02, 0x06, 0x00, 0x00, 0x02, 0x01, 0x01, 0x04, 0x02, 0x03, 0x03,
+0x01, 0x02, 0x03, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02,
+0x07, 0x00, 0x00, 0x00, 0x73, 0x79, 0x6d, 0x62, 0x6f, 0x6c, 0x3f, 0x00,
 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x03, 0x01, 0x02,
-0x01, 0x00, 0x05, 0x02, 0x01, 0x1f, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00,
-0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08,
-0x00, 0x12, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x04,
-0x02, 0x0b, 0x03, 0x01, 0x03, 0x02, 0x00, 0x01, 0x04, 0x01, 0x01, 0x01,
-0x01, 0x01, 0x01, 0x00, 0x05, 0x00, 0x02, 0x10, 0x00, 0x00, 0x00, 0x02,
-0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x02, 0x06, 0x00,
-0x00, 0x00, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x00, 0x06, 0x00, 0x00,
-0x04, 0x01, 0x02, 0x01, 0x03, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01,
-0x03, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x02, 0x00,
-0x00, 0x04, 0x01, 0x00, 0x01, 0x0a, 0x02, 0x01, 0x02, 0x02, 0x00, 0x04,
-0x02, 0x01, 0x13, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63,
-0x61, 0x72, 0x00, 0x02, 0x00, 0x00, 0x05, 0x00, 0x00, 0x02, 0x06, 0x00,
-0x00, 0x02, 0x01, 0x01, 0x04, 0x02, 0x03, 0x03, 0x01, 0x02, 0x03, 0x00,
-0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x07, 0x00, 0x00, 0x00,
-0x73, 0x79, 0x6d, 0x62, 0x6f, 0x6c, 0x3f, 0x00, 0x06, 0x00, 0x00, 0x02,
-0x01, 0x00, 0x04, 0x02, 0x00, 0x03, 0x01, 0x02, 0x01, 0x00, 0x05, 0x02,
-0x02, 0x24, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x65, 0x71,
-0x3f, 0x00, 0x02, 0x05, 0x00, 0x00, 0x00, 0x6e, 0x75, 0x6c, 0x6c, 0x3f,
-0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x14, 0x00, 0x06, 0x00, 0x00,
-0x02, 0x01, 0x00, 0x04, 0x02, 0x08, 0x02, 0x04, 0x03, 0x01, 0x03, 0x01,
-0x03, 0x06, 0x00, 0x01, 0x02, 0x01, 0x01, 0x04, 0x02, 0x01, 0x03, 0x01,
-0x02, 0x01, 0x00, 0x05, 0x02, 0x02, 0x25, 0x00, 0x00, 0x00, 0x02, 0x04,
-0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x02, 0x01, 0x00, 0x00,
-0x00, 0x2b, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x12, 0x00, 0x06,
-0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x02, 0x02, 0x0b, 0x03, 0x01,
-0x03, 0x06, 0x00, 0x01, 0x02, 0x01, 0x01, 0x04, 0x02, 0x06, 0x02, 0x0d,
-0x03, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00,
-0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06,
-0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x07, 0x02, 0x04, 0x03, 0x00,
-0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x00, 0x02, 0x10, 0x00, 0x00, 0x00,
-0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x02, 0x05,
-0x00, 0x00, 0x00, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x00, 0x06, 0x00, 0x00,
-0x04, 0x01, 0x04, 0x01, 0x03, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01,
-0x03, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03,
-0x00, 0x00, 0x00, 0x63, 0x64, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
-0x00, 0x04, 0x02, 0x07, 0x03, 0x01, 0x02, 0x01, 0x00, 0x05, 0x00, 0x00,
-0x12, 0x00, 0x00, 0x00, 0x04, 0x00, 0x09, 0x02, 0x04, 0x01, 0x04, 0x01,
-0x04, 0x02, 0x01, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00,
-0x05, 0x02, 0x02, 0x23, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0x00,
-0x2b, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x61, 0x72, 0x00, 0x04,
-0x00, 0x00, 0x01, 0x08, 0x00, 0x13, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
-0x00, 0x04, 0x02, 0x06, 0x02, 0x0d, 0x03, 0x01, 0x01, 0x03, 0x06, 0x00,
-0x01, 0x02, 0x01, 0x01, 0x04, 0x02, 0x02, 0x03, 0x01, 0x02, 0x01, 0x00,
-0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00,
-0x63, 0x64, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
-0x07, 0x03, 0x01, 0x02, 0x01, 0x00, 0x05, 0x00, 0x00, 0x12, 0x00, 0x00,
-0x00, 0x04, 0x00, 0x09, 0x02, 0x04, 0x01, 0x04, 0x01, 0x04, 0x02, 0x01,
-0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01,
-0x10, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x65, 0x71, 0x3f,
-0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x0a, 0x02, 0x04,
-0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x02, 0x02, 0x25, 0x00,
+0x01, 0x00, 0x05, 0x02, 0x02, 0x24, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00,
+0x00, 0x00, 0x65, 0x71, 0x3f, 0x00, 0x02, 0x05, 0x00, 0x00, 0x00, 0x6e,
+0x75, 0x6c, 0x6c, 0x3f, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x14,
+0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x08, 0x02, 0x04,
+0x03, 0x01, 0x03, 0x01, 0x03, 0x06, 0x00, 0x01, 0x02, 0x01, 0x01, 0x04,
+0x02, 0x01, 0x03, 0x01, 0x02, 0x01, 0x00, 0x05, 0x02, 0x02, 0x25, 0x00,
 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00,
 0x02, 0x01, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08,
-0x00, 0x12, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x04,
+0x00, 0x12, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x02,
 0x02, 0x0b, 0x03, 0x01, 0x03, 0x06, 0x00, 0x01, 0x02, 0x01, 0x01, 0x04,
-0x02, 0x04, 0x02, 0x0d, 0x03, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01,
+0x02, 0x06, 0x02, 0x0d, 0x03, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01,
 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f,
-0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x09,
+0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x07,
 0x02, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x00, 0x02,
 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e,
 0x73, 0x00, 0x02, 0x05, 0x00, 0x00, 0x00, 0x6c, 0x6f, 0x63, 0x61, 0x6c,
-0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x06, 0x01, 0x03, 0x02, 0x01, 0x04,
+0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x04, 0x01, 0x03, 0x02, 0x01, 0x04,
 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00,
 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x64, 0x72, 0x00, 0x06,
-0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x05, 0x03, 0x01, 0x02, 0x01,
-0x00, 0x05, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x04, 0x00, 0x07, 0x02,
-0x04, 0x01, 0x06, 0x01, 0x04, 0x02, 0x01, 0x01, 0x04, 0x03, 0x00, 0x01,
-0x01, 0x03, 0x01, 0x00, 0x05, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x04,
-0x00, 0x01, 0x02, 0x04, 0x01, 0x01, 0x01, 0x0d, 0x02, 0x01, 0x04, 0x03,
-0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x01, 0x01, 0x12, 0x00, 0x00,
-0x00, 0x02, 0x0e, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x6b, 0x65, 0x2d, 0x70,
-0x61, 0x72, 0x61, 0x6d, 0x65, 0x74, 0x65, 0x72, 0x00, 0x04, 0x00, 0x00,
-0x01, 0x05, 0x00, 0x01, 0x0c, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x0b,
-0x02, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x12, 0x00, 0x00, 0x00,
-0x02, 0x0e, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x6b, 0x65, 0x2d, 0x70, 0x61,
-0x72, 0x61, 0x6d, 0x65, 0x74, 0x65, 0x72, 0x00, 0x04, 0x00, 0x00, 0x01,
-0x05, 0x00, 0x02, 0x0b, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x0b, 0x02,
-0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x12, 0x00, 0x00, 0x00, 0x02,
-0x0e, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x6b, 0x65, 0x2d, 0x70, 0x61, 0x72,
-0x61, 0x6d, 0x65, 0x74, 0x65, 0x72, 0x00, 0x04, 0x00, 0x00, 0x01, 0x05,
-0x00, 0x03, 0x0a, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x0b, 0x02, 0x01,
-0x02, 0x01, 0x00, 0x04, 0x05, 0x00, 0x28, 0x00, 0x00, 0x00, 0x04, 0x00,
-0x00, 0x01, 0x05, 0x00, 0x04, 0x09, 0x02, 0x00, 0x00, 0x05, 0x00, 0x04,
-0x08, 0x02, 0x00, 0x01, 0x05, 0x00, 0x04, 0x07, 0x02, 0x00, 0x02, 0x05,
-0x00, 0x04, 0x06, 0x02, 0x00, 0x03, 0x02, 0x01, 0x04, 0x0d, 0x02, 0x00,
-0x01, 0x02, 0x02, 0x00, 0x03, 0x01, 0x00, 0x09, 0x00, 0x00, 0x00, 0x04,
-0x00, 0x05, 0x0b, 0x02, 0x01, 0x00, 0x01, 0x01, 0x01, 0x00, 0x05, 0x01,
-0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f,
-0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x01,
-0x02, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x00, 0x00,
-0x0e, 0x00, 0x00, 0x00, 0x04, 0x00, 0x07, 0x0b, 0x04, 0x01, 0x02, 0x01,
-0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x02, 0x00, 0x03, 0x01, 0x00, 0x09,
-0x00, 0x00, 0x00, 0x04, 0x00, 0x05, 0x0a, 0x02, 0x01, 0x00, 0x01, 0x01,
-0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x06, 0x00,
-0x00, 0x00, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x00, 0x06, 0x00, 0x00,
-0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x04,
-0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x01, 0x02,
-0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x02, 0x00, 0x03, 0x01, 0x00,
-0x09, 0x00, 0x00, 0x00, 0x04, 0x00, 0x08, 0x0a, 0x02, 0x01, 0x00, 0x01,
-0x01, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04,
-0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02,
-0x01, 0x00, 0x04, 0x02, 0x04, 0x02, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03,
-0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0a,
-0x0a, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00,
-0x03, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x04, 0x00, 0x03, 0x01, 0x04,
-0x01, 0x03, 0x02, 0x01, 0x01, 0x02, 0x00, 0x03, 0x01, 0x00, 0x09, 0x00,
-0x00, 0x00, 0x04, 0x00, 0x05, 0x09, 0x02, 0x01, 0x00, 0x01, 0x01, 0x01,
-0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x06, 0x00, 0x00,
-0x00, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x00, 0x06, 0x00, 0x00, 0x02,
-0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01,
-0x00, 0x0d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x01, 0x02, 0x01,
-0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x02, 0x00, 0x03, 0x01, 0x00, 0x09,
-0x00, 0x00, 0x00, 0x04, 0x00, 0x08, 0x09, 0x02, 0x01, 0x00, 0x01, 0x01,
+0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x07, 0x03, 0x01, 0x02, 0x01,
+0x00, 0x05, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x04, 0x00, 0x09, 0x02,
+0x04, 0x01, 0x04, 0x01, 0x04, 0x02, 0x01, 0x01, 0x04, 0x03, 0x00, 0x01,
+0x01, 0x03, 0x01, 0x00, 0x05, 0x02, 0x02, 0x23, 0x00, 0x00, 0x00, 0x02,
+0x01, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63,
+0x61, 0x72, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x13, 0x00, 0x06,
+0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x06, 0x02, 0x0d, 0x03, 0x01,
+0x01, 0x03, 0x06, 0x00, 0x01, 0x02, 0x01, 0x01, 0x04, 0x02, 0x02, 0x03,
+0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02,
+0x03, 0x00, 0x00, 0x00, 0x63, 0x64, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02,
+0x01, 0x00, 0x04, 0x02, 0x07, 0x03, 0x01, 0x02, 0x01, 0x00, 0x05, 0x00,
+0x00, 0x12, 0x00, 0x00, 0x00, 0x04, 0x00, 0x09, 0x02, 0x04, 0x01, 0x04,
+0x01, 0x04, 0x02, 0x01, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01,
+0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00,
+0x00, 0x65, 0x71, 0x3f, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
+0x02, 0x0a, 0x02, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05,
+0x02, 0x02, 0x25, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63,
+0x6f, 0x6e, 0x73, 0x00, 0x02, 0x01, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04,
+0x00, 0x00, 0x01, 0x08, 0x00, 0x12, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
+0x00, 0x04, 0x02, 0x04, 0x02, 0x0b, 0x03, 0x01, 0x03, 0x06, 0x00, 0x01,
+0x02, 0x01, 0x01, 0x04, 0x02, 0x04, 0x02, 0x0d, 0x03, 0x01, 0x01, 0x03,
 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00,
 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
-0x00, 0x04, 0x02, 0x04, 0x02, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01,
-0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0a, 0x09,
-0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x03,
-0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x04, 0x00, 0x03, 0x01, 0x04, 0x01,
-0x03, 0x02, 0x01, 0x01, 0x02, 0x00, 0x03, 0x01, 0x00, 0x09, 0x00, 0x00,
-0x00, 0x04, 0x00, 0x00, 0x01, 0x02, 0x01, 0x00, 0x01, 0x01, 0x01, 0x00,
-0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x01,
-0x00, 0x01, 0x04, 0x02, 0x01, 0x02, 0x01, 0x02, 0x02, 0x00, 0x05, 0x01,
-0x01, 0x0f, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0x00, 0x2b, 0x00,
-0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x02, 0x02, 0x0d, 0x03,
-0x01, 0x01, 0x03, 0x01, 0x00, 0x03, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00,
-0x04, 0x00, 0x00, 0x01, 0x05, 0x00, 0x03, 0x02, 0x04, 0x00, 0x01, 0x01,
-0x04, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x00, 0x03, 0x04, 0x00, 0x26,
-0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x05, 0x00, 0x05, 0x05, 0x02,
-0x00, 0x00, 0x05, 0x00, 0x05, 0x04, 0x02, 0x00, 0x01, 0x05, 0x00, 0x05,
-0x03, 0x02, 0x00, 0x02, 0x05, 0x00, 0x05, 0x02, 0x04, 0x00, 0x05, 0x01,
-0x02, 0x01, 0x03, 0x01, 0x01, 0x02, 0x00, 0x03, 0x01, 0x00, 0x09, 0x00,
-0x00, 0x00, 0x04, 0x00, 0x06, 0x0b, 0x02, 0x01, 0x00, 0x01, 0x01, 0x01,
-0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00,
-0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
-0x04, 0x02, 0x01, 0x02, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00,
-0x04, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x04, 0x00, 0x08, 0x0b, 0x04,
-0x01, 0x02, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x02, 0x00, 0x04,
+0x00, 0x04, 0x02, 0x09, 0x02, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01,
+0x00, 0x05, 0x00, 0x02, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00,
+0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x02, 0x05, 0x00, 0x00, 0x00, 0x6c,
+0x6f, 0x63, 0x61, 0x6c, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x06, 0x01,
+0x03, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04,
 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63,
-0x61, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00,
-0x02, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00,
-0x02, 0x00, 0x00, 0x04, 0x01, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01,
-0x02, 0x02, 0x00, 0x05, 0x01, 0x02, 0x0f, 0x00, 0x00, 0x00, 0x02, 0x04,
-0x00, 0x00, 0x00, 0x65, 0x71, 0x76, 0x3f, 0x00, 0x02, 0x03, 0x00, 0x00,
-0x00, 0x72, 0x65, 0x66, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
-0x02, 0x00, 0x02, 0x03, 0x03, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x02,
-0x00, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x01, 0x01, 0x04,
-0x02, 0x00, 0x01, 0x01, 0x02, 0x02, 0x00, 0x05, 0x01, 0x02, 0x21, 0x00,
-0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x65, 0x71, 0x76, 0x3f, 0x00,
-0x02, 0x06, 0x00, 0x00, 0x00, 0x6c, 0x61, 0x6d, 0x62, 0x64, 0x61, 0x00,
-0x04, 0x00, 0x00, 0x02, 0x08, 0x00, 0x0e, 0x00, 0x04, 0x00, 0x00, 0x01,
-0x04, 0x01, 0x00, 0x02, 0x01, 0x01, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
-0x04, 0x02, 0x02, 0x02, 0x03, 0x03, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04,
-0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x01, 0x01,
-0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x02, 0x00, 0x05, 0x01, 0x02,
-0x21, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x65, 0x71, 0x76,
-0x3f, 0x00, 0x02, 0x05, 0x00, 0x00, 0x00, 0x71, 0x75, 0x6f, 0x74, 0x65,
-0x00, 0x04, 0x00, 0x00, 0x02, 0x08, 0x00, 0x0e, 0x00, 0x04, 0x00, 0x00,
-0x01, 0x04, 0x01, 0x00, 0x02, 0x01, 0x01, 0x06, 0x00, 0x00, 0x02, 0x01,
-0x00, 0x04, 0x02, 0x04, 0x02, 0x03, 0x03, 0x01, 0x01, 0x03, 0x01, 0x00,
-0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x01,
-0x01, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x02, 0x00, 0x05, 0x01,
-0x02, 0x21, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x65, 0x71,
-0x76, 0x3f, 0x00, 0x02, 0x09, 0x00, 0x00, 0x00, 0x75, 0x6e, 0x64, 0x65,
-0x66, 0x69, 0x6e, 0x65, 0x64, 0x00, 0x04, 0x00, 0x00, 0x02, 0x08, 0x00,
-0x0e, 0x00, 0x04, 0x00, 0x00, 0x01, 0x04, 0x01, 0x00, 0x02, 0x01, 0x01,
-0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x06, 0x02, 0x03, 0x03,
+0x64, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x05,
+0x03, 0x01, 0x02, 0x01, 0x00, 0x05, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00,
+0x04, 0x00, 0x07, 0x02, 0x04, 0x01, 0x06, 0x01, 0x04, 0x02, 0x01, 0x01,
+0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x00, 0x00, 0x11,
+0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x02, 0x04, 0x01, 0x01, 0x01, 0x0d,
+0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x01,
+0x01, 0x12, 0x00, 0x00, 0x00, 0x02, 0x0e, 0x00, 0x00, 0x00, 0x6d, 0x61,
+0x6b, 0x65, 0x2d, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x65, 0x74, 0x65, 0x72,
+0x00, 0x04, 0x00, 0x00, 0x01, 0x05, 0x00, 0x01, 0x0e, 0x06, 0x00, 0x00,
+0x02, 0x01, 0x00, 0x0b, 0x02, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01,
+0x12, 0x00, 0x00, 0x00, 0x02, 0x0e, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x6b,
+0x65, 0x2d, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x65, 0x74, 0x65, 0x72, 0x00,
+0x04, 0x00, 0x00, 0x01, 0x05, 0x00, 0x02, 0x0d, 0x06, 0x00, 0x00, 0x02,
+0x01, 0x00, 0x0b, 0x02, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x12,
+0x00, 0x00, 0x00, 0x02, 0x0e, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x6b, 0x65,
+0x2d, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x65, 0x74, 0x65, 0x72, 0x00, 0x04,
+0x00, 0x00, 0x01, 0x05, 0x00, 0x03, 0x0c, 0x06, 0x00, 0x00, 0x02, 0x01,
+0x00, 0x0b, 0x02, 0x01, 0x02, 0x01, 0x00, 0x04, 0x05, 0x00, 0x28, 0x00,
+0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x05, 0x00, 0x04, 0x0b, 0x02, 0x00,
+0x00, 0x05, 0x00, 0x04, 0x0a, 0x02, 0x00, 0x01, 0x05, 0x00, 0x04, 0x09,
+0x02, 0x00, 0x02, 0x05, 0x00, 0x04, 0x08, 0x02, 0x00, 0x03, 0x02, 0x01,
+0x04, 0x0d, 0x02, 0x00, 0x01, 0x02, 0x02, 0x00, 0x03, 0x01, 0x00, 0x09,
+0x00, 0x00, 0x00, 0x04, 0x00, 0x05, 0x0d, 0x02, 0x01, 0x00, 0x01, 0x01,
+0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00,
+0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
+0x00, 0x04, 0x02, 0x01, 0x02, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01,
+0x00, 0x04, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x04, 0x00, 0x07, 0x0d,
+0x04, 0x01, 0x02, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x02, 0x00,
+0x03, 0x01, 0x00, 0x09, 0x00, 0x00, 0x00, 0x04, 0x00, 0x05, 0x0c, 0x02,
+0x01, 0x00, 0x01, 0x01, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00,
+0x00, 0x02, 0x06, 0x00, 0x00, 0x00, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68,
+0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01,
+0x02, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x02, 0x00,
+0x00, 0x04, 0x01, 0x02, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x02,
+0x00, 0x03, 0x01, 0x00, 0x09, 0x00, 0x00, 0x00, 0x04, 0x00, 0x08, 0x0c,
+0x02, 0x01, 0x00, 0x01, 0x01, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00,
+0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00,
+0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x04, 0x02, 0x04, 0x03,
+0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00,
+0x00, 0x04, 0x00, 0x0a, 0x0c, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01,
+0x01, 0x02, 0x01, 0x00, 0x03, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x04,
+0x00, 0x03, 0x01, 0x04, 0x01, 0x03, 0x02, 0x01, 0x01, 0x02, 0x00, 0x03,
+0x01, 0x00, 0x09, 0x00, 0x00, 0x00, 0x04, 0x00, 0x05, 0x0b, 0x02, 0x01,
+0x00, 0x01, 0x01, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00,
+0x02, 0x06, 0x00, 0x00, 0x00, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x00,
+0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02,
+0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+0x04, 0x01, 0x02, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x02, 0x00,
+0x03, 0x01, 0x00, 0x09, 0x00, 0x00, 0x00, 0x04, 0x00, 0x08, 0x0b, 0x02,
+0x01, 0x00, 0x01, 0x01, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00,
+0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06,
+0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x04, 0x02, 0x04, 0x03, 0x00,
 0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00,
-0x02, 0x00, 0x00, 0x04, 0x01, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01,
-0x02, 0x02, 0x00, 0x03, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x04, 0x00,
-0x00, 0x02, 0x08, 0x00, 0x0e, 0x00, 0x04, 0x00, 0x00, 0x01, 0x04, 0x01,
-0x00, 0x02, 0x01, 0x01, 0x04, 0x00, 0x00, 0x01, 0x0a, 0x01, 0x01, 0x01,
-0x01, 0x00, 0x05, 0x01, 0x02, 0x28, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00,
-0x00, 0x00, 0x65, 0x71, 0x76, 0x3f, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00,
-0x73, 0x65, 0x74, 0x21, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x15,
-0x00, 0x04, 0x00, 0x0a, 0x02, 0x04, 0x01, 0x02, 0x01, 0x04, 0x02, 0x04,
-0x02, 0x0d, 0x03, 0x00, 0x01, 0x03, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
-0x04, 0x02, 0x02, 0x02, 0x03, 0x03, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04,
-0x02, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x01, 0x01,
-0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x02, 0x00, 0x03, 0x00, 0x00, 0x1a,
-0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x02, 0x08, 0x00, 0x0e, 0x00, 0x04,
-0x00, 0x00, 0x01, 0x04, 0x01, 0x00, 0x02, 0x01, 0x01, 0x04, 0x00, 0x00,
-0x01, 0x0a, 0x01, 0x01, 0x01, 0x01, 0x00, 0x05, 0x02, 0x02, 0x24, 0x00,
-0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x65, 0x71, 0x76, 0x3f, 0x00,
-0x02, 0x02, 0x00, 0x00, 0x00, 0x69, 0x66, 0x00, 0x04, 0x00, 0x00, 0x01,
-0x08, 0x00, 0x11, 0x00, 0x04, 0x00, 0x11, 0x08, 0x02, 0x01, 0x00, 0x04,
-0x02, 0x06, 0x02, 0x01, 0x02, 0x06, 0x00, 0x00, 0x02, 0x01, 0x01, 0x04,
-0x02, 0x04, 0x02, 0x03, 0x03, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01,
-0x00, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0d, 0x02, 0x02, 0x01, 0x00,
-0x04, 0x02, 0x00, 0x01, 0x0d, 0x03, 0x00, 0x01, 0x03, 0x01, 0x00, 0x04,
-0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63,
-0x61, 0x64, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
-0x08, 0x02, 0x01, 0x02, 0x01, 0x00, 0x03, 0x01, 0x00, 0x09, 0x00, 0x00,
-0x00, 0x04, 0x00, 0x0f, 0x0c, 0x02, 0x01, 0x00, 0x01, 0x01, 0x01, 0x00,
-0x05, 0x01, 0x00, 0x11, 0x00, 0x00, 0x00, 0x04, 0x00, 0x10, 0x0d, 0x02,
-0x01, 0x00, 0x04, 0x02, 0x01, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03,
-0x01, 0x00, 0x04, 0x02, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
-0x02, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x02, 0x00, 0x04,
-0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63,
-0x61, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00,
-0x02, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x02, 0x0f, 0x00, 0x00, 0x00,
-0x02, 0x03, 0x00, 0x00, 0x00, 0x65, 0x71, 0x3f, 0x00, 0x02, 0x06, 0x00,
-0x00, 0x00, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x00, 0x06, 0x00, 0x00,
-0x02, 0x01, 0x00, 0x03, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03,
-0x01, 0x00, 0x04, 0x02, 0x02, 0x20, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00,
-0x00, 0x00, 0x63, 0x61, 0x64, 0x72, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00,
-0x63, 0x64, 0x72, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x10, 0x00,
-0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x02, 0x02, 0x01, 0x02,
-0x06, 0x00, 0x01, 0x02, 0x01, 0x01, 0x04, 0x02, 0x02, 0x02, 0x01, 0x02,
-0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x04, 0x00, 0x15,
-0x06, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00,
-0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x01,
-0x04, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x02, 0x00, 0x05, 0x01,
-0x01, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f,
-0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00,
-0x02, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0f, 0x00,
+0x04, 0x00, 0x0a, 0x0b, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01,
+0x02, 0x01, 0x00, 0x03, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x04, 0x00,
+0x03, 0x01, 0x04, 0x01, 0x03, 0x02, 0x01, 0x01, 0x02, 0x00, 0x03, 0x01,
+0x00, 0x09, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x02, 0x01, 0x00,
+0x01, 0x01, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x02,
+0x00, 0x00, 0x04, 0x01, 0x00, 0x01, 0x04, 0x02, 0x01, 0x02, 0x01, 0x02,
+0x02, 0x00, 0x05, 0x01, 0x01, 0x0f, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00,
+0x00, 0x00, 0x2b, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
+0x02, 0x02, 0x0d, 0x03, 0x01, 0x01, 0x03, 0x01, 0x00, 0x03, 0x00, 0x00,
+0x12, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x05, 0x00, 0x03, 0x02,
+0x04, 0x00, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x00,
+0x03, 0x06, 0x00, 0x34, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x05,
+0x00, 0x05, 0x07, 0x02, 0x00, 0x00, 0x05, 0x00, 0x05, 0x06, 0x02, 0x00,
+0x01, 0x05, 0x00, 0x05, 0x05, 0x02, 0x00, 0x02, 0x05, 0x00, 0x05, 0x04,
+0x02, 0x00, 0x03, 0x05, 0x00, 0x05, 0x03, 0x02, 0x00, 0x04, 0x05, 0x00,
+0x05, 0x02, 0x04, 0x00, 0x05, 0x01, 0x02, 0x01, 0x05, 0x01, 0x01, 0x02,
+0x00, 0x03, 0x01, 0x00, 0x09, 0x00, 0x00, 0x00, 0x04, 0x00, 0x06, 0x0d,
+0x02, 0x01, 0x00, 0x01, 0x01, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00,
 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00,
-0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x0d, 0x02, 0x00, 0x04, 0x03, 0x00,
-0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x02, 0x0f, 0x00, 0x00, 0x00,
-0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x02, 0x04,
-0x00, 0x00, 0x00, 0x47, 0x53, 0x45, 0x54, 0x00, 0x06, 0x00, 0x00, 0x02,
-0x01, 0x00, 0x03, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01,
-0x00, 0x04, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x04, 0x00, 0x1a, 0x08,
-0x04, 0x01, 0x03, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00,
-0x05, 0x01, 0x01, 0x0f, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00,
-0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x0d,
-0x02, 0x00, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01,
-0x02, 0x0f, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f,
-0x6e, 0x73, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x4c, 0x53, 0x45, 0x54,
-0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x03, 0x02, 0x01, 0x04, 0x03,
+0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x01, 0x02, 0x04, 0x03,
 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x00, 0x00, 0x0e, 0x00, 0x00,
-0x00, 0x04, 0x00, 0x17, 0x08, 0x04, 0x01, 0x05, 0x01, 0x04, 0x02, 0x00,
-0x01, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00,
-0x04, 0x00, 0x17, 0x07, 0x02, 0x01, 0x00, 0x04, 0x02, 0x0c, 0x02, 0x01,
-0x02, 0x01, 0x00, 0x04, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x04, 0x00,
-0x13, 0x03, 0x04, 0x01, 0x0b, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02,
-0x01, 0x00, 0x04, 0x02, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
-0x02, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x02, 0x00, 0x03,
-0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x02, 0x08, 0x00,
-0x0e, 0x00, 0x04, 0x00, 0x00, 0x01, 0x04, 0x01, 0x00, 0x02, 0x01, 0x01,
-0x04, 0x00, 0x00, 0x01, 0x0a, 0x01, 0x01, 0x01, 0x01, 0x00, 0x04, 0x03,
-0x01, 0x2a, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x61,
-0x64, 0x72, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x10, 0x00, 0x06,
-0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x08, 0x02, 0x01, 0x02, 0x09,
-0x00, 0x08, 0x00, 0x0c, 0x00, 0x02, 0x00, 0x01, 0x02, 0x01, 0x02, 0x01,
-0x01, 0x04, 0x00, 0x06, 0x01, 0x0c, 0x01, 0x01, 0x01, 0x01, 0x00, 0x05,
-0x01, 0x00, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0f, 0x02, 0x02, 0x01,
-0x00, 0x04, 0x02, 0x00, 0x01, 0x0d, 0x03, 0x00, 0x01, 0x03, 0x01, 0x00,
-0x03, 0x01, 0x00, 0x09, 0x00, 0x00, 0x00, 0x04, 0x00, 0x10, 0x05, 0x02,
-0x01, 0x00, 0x01, 0x01, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00,
-0x00, 0x02, 0x00, 0x00, 0x04, 0x01, 0x09, 0x01, 0x04, 0x02, 0x00, 0x01,
-0x01, 0x02, 0x02, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x02,
-0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00,
-0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x0b, 0x03, 0x01, 0x03, 0x01,
-0x00, 0x05, 0x01, 0x01, 0x0f, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00,
-0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
-0x0d, 0x02, 0x00, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05,
-0x01, 0x02, 0x0f, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63,
-0x6f, 0x6e, 0x73, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x43, 0x4f, 0x4e,
-0x44, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x03, 0x02, 0x01, 0x04,
-0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00,
-0x00, 0x00, 0x04, 0x00, 0x15, 0x08, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00,
-0x01, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00,
-0x04, 0x00, 0x1b, 0x08, 0x02, 0x01, 0x00, 0x04, 0x02, 0x10, 0x02, 0x01,
-0x02, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x04, 0x00,
-0x17, 0x03, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01,
-0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x04, 0x00, 0x18, 0x04,
-0x02, 0x01, 0x00, 0x04, 0x02, 0x06, 0x02, 0x01, 0x02, 0x01, 0x00, 0x04,
-0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x04, 0x00, 0x1e, 0x07, 0x02, 0x01,
-0x00, 0x04, 0x02, 0x13, 0x02, 0x01, 0x02, 0x01, 0x00, 0x04, 0x00, 0x00,
-0x0e, 0x00, 0x00, 0x00, 0x04, 0x00, 0x1a, 0x03, 0x04, 0x01, 0x08, 0x01,
-0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0b,
-0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x01, 0x00, 0x01, 0x0a, 0x02,
-0x01, 0x02, 0x02, 0x00, 0x05, 0x01, 0x00, 0x18, 0x00, 0x00, 0x00, 0x02,
-0x00, 0x00, 0x05, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x02, 0x04, 0x01,
-0x00, 0x01, 0x0d, 0x02, 0x00, 0x04, 0x03, 0x0a, 0x02, 0x01, 0x03, 0x03,
-0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x05, 0x00, 0x00,
-0x00, 0x6e, 0x75, 0x6c, 0x6c, 0x3f, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
-0x00, 0x04, 0x02, 0x00, 0x03, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01,
-0x1c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x61, 0x72,
-0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x0c, 0x00, 0x04, 0x00, 0x01,
-0x01, 0x0c, 0x01, 0x01, 0x01, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
-0x02, 0x01, 0x03, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x00, 0x11, 0x00,
-0x00, 0x00, 0x04, 0x00, 0x13, 0x02, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00,
-0x01, 0x04, 0x03, 0x02, 0x02, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01,
+0x00, 0x04, 0x00, 0x08, 0x0d, 0x04, 0x01, 0x02, 0x01, 0x04, 0x02, 0x00,
+0x01, 0x01, 0x02, 0x03, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00,
+0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x61, 0x72, 0x00, 0x06, 0x00, 0x00,
+0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x01, 0x02, 0x01, 0x00, 0x05,
+0x01, 0x02, 0x0f, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x65,
+0x71, 0x3f, 0x00, 0x02, 0x0a, 0x00, 0x00, 0x00, 0x72, 0x65, 0x63, 0x6f,
+0x72, 0x64, 0x2d, 0x72, 0x65, 0x66, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
+0x00, 0x03, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00,
+0x05, 0x01, 0x01, 0x25, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0x00,
+0x2b, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x11, 0x00, 0x04, 0x00,
+0x0d, 0x09, 0x02, 0x01, 0x00, 0x04, 0x02, 0x02, 0x02, 0x01, 0x02, 0x06,
+0x00, 0x00, 0x04, 0x01, 0x02, 0x01, 0x04, 0x02, 0x02, 0x03, 0x0d, 0x03,
+0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x00, 0x11, 0x00, 0x00, 0x00,
+0x04, 0x00, 0x09, 0x05, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x04,
+0x03, 0x03, 0x03, 0x01, 0x03, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00,
+0x00, 0x00, 0x04, 0x00, 0x0f, 0x08, 0x02, 0x01, 0x00, 0x04, 0x02, 0x04,
+0x02, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0f, 0x00, 0x00, 0x00,
+0x02, 0x01, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
+0x00, 0x04, 0x02, 0x05, 0x03, 0x0d, 0x03, 0x01, 0x01, 0x03, 0x01, 0x00,
+0x05, 0x01, 0x00, 0x11, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0c, 0x05, 0x02,
+0x01, 0x00, 0x04, 0x02, 0x01, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03,
+0x01, 0x00, 0x05, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x04, 0x00, 0x12,
+0x06, 0x04, 0x01, 0x07, 0x01, 0x04, 0x02, 0x03, 0x01, 0x04, 0x03, 0x00,
+0x01, 0x01, 0x03, 0x03, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00,
+0x02, 0x05, 0x00, 0x00, 0x00, 0x6e, 0x75, 0x6c, 0x6c, 0x3f, 0x00, 0x06,
+0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x01, 0x02, 0x01,
+0x00, 0x04, 0x01, 0x01, 0x1e, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00,
+0x00, 0x63, 0x61, 0x72, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x0e,
+0x00, 0x04, 0x00, 0x01, 0x01, 0x04, 0x01, 0x01, 0x03, 0x01, 0x01, 0x06,
+0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01,
+0x00, 0x05, 0x01, 0x00, 0x11, 0x00, 0x00, 0x00, 0x04, 0x00, 0x08, 0x05,
+0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x04, 0x03, 0x02, 0x03, 0x01,
+0x03, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03,
+0x00, 0x00, 0x00, 0x63, 0x64, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
+0x00, 0x04, 0x02, 0x03, 0x02, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x01,
 0x0f, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x06,
-0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x03, 0x02, 0x0d, 0x03, 0x01,
-0x01, 0x03, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02,
-0x03, 0x00, 0x00, 0x00, 0x63, 0x64, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02,
-0x01, 0x00, 0x04, 0x02, 0x04, 0x03, 0x01, 0x02, 0x01, 0x00, 0x05, 0x00,
-0x00, 0x12, 0x00, 0x00, 0x00, 0x04, 0x00, 0x06, 0x02, 0x04, 0x01, 0x05,
-0x01, 0x04, 0x02, 0x01, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01,
-0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x06, 0x00, 0x00,
-0x00, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x00, 0x06, 0x00, 0x00, 0x02,
-0x01, 0x00, 0x04, 0x02, 0x09, 0x02, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01,
-0x01, 0x0f, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0x00, 0x2d, 0x00,
-0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x0d, 0x03,
-0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00, 0x00, 0x00,
-0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00,
-0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x0b, 0x03, 0x01, 0x03,
-0x01, 0x00, 0x05, 0x01, 0x02, 0x0f, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00,
-0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00,
-0x43, 0x41, 0x4c, 0x4c, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x03,
-0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x00,
-0x00, 0x0e, 0x00, 0x00, 0x00, 0x04, 0x00, 0x13, 0x08, 0x04, 0x01, 0x0b,
-0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x03, 0x00, 0x04, 0x01, 0x01,
+0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x04, 0x03, 0x0d, 0x03, 0x01,
+0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x00, 0x11, 0x00, 0x00, 0x00, 0x04,
+0x00, 0x0b, 0x04, 0x02, 0x01, 0x00, 0x04, 0x02, 0x01, 0x01, 0x04, 0x03,
+0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x00, 0x00, 0x12, 0x00, 0x00,
+0x00, 0x04, 0x00, 0x11, 0x06, 0x04, 0x01, 0x06, 0x01, 0x04, 0x02, 0x03,
+0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x02, 0x00, 0x04, 0x01, 0x01,
 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x61, 0x72,
 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x01,
 0x02, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x02, 0x00,
@@ -3574,21 +3654,108 @@ static const unsigned char eval_rom[] = {
 0x65, 0x66, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00,
 0x02, 0x03, 0x03, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x02, 0x00, 0x0c,
 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x01, 0x01, 0x04, 0x02, 0x00,
-0x01, 0x01, 0x02, 0x02, 0x00, 0x03, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00,
-0x04, 0x00, 0x00, 0x02, 0x08, 0x00, 0x0e, 0x00, 0x04, 0x00, 0x00, 0x01,
-0x04, 0x01, 0x00, 0x02, 0x01, 0x01, 0x04, 0x00, 0x00, 0x01, 0x0a, 0x01,
-0x01, 0x01, 0x01, 0x00, 0x05, 0x02, 0x03, 0x23, 0x00, 0x00, 0x00, 0x02,
-0x04, 0x00, 0x00, 0x00, 0x63, 0x61, 0x64, 0x72, 0x00, 0x02, 0x04, 0x00,
-0x00, 0x00, 0x65, 0x71, 0x76, 0x3f, 0x00, 0x02, 0x05, 0x00, 0x00, 0x00,
-0x71, 0x75, 0x6f, 0x74, 0x65, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00,
-0x10, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x04, 0x02,
-0x01, 0x02, 0x06, 0x00, 0x01, 0x02, 0x01, 0x01, 0x04, 0x02, 0x02, 0x02,
-0x03, 0x03, 0x02, 0x01, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00, 0x09, 0x00,
-0x00, 0x00, 0x04, 0x00, 0x0b, 0x0c, 0x02, 0x01, 0x00, 0x01, 0x01, 0x01,
-0x00, 0x05, 0x01, 0x00, 0x11, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0c, 0x0d,
-0x02, 0x01, 0x00, 0x04, 0x02, 0x01, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01,
+0x01, 0x01, 0x02, 0x02, 0x00, 0x05, 0x01, 0x02, 0x21, 0x00, 0x00, 0x00,
+0x02, 0x04, 0x00, 0x00, 0x00, 0x65, 0x71, 0x76, 0x3f, 0x00, 0x02, 0x06,
+0x00, 0x00, 0x00, 0x6c, 0x61, 0x6d, 0x62, 0x64, 0x61, 0x00, 0x04, 0x00,
+0x00, 0x02, 0x08, 0x00, 0x0e, 0x00, 0x04, 0x00, 0x00, 0x01, 0x04, 0x01,
+0x00, 0x02, 0x01, 0x01, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
+0x02, 0x02, 0x03, 0x03, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x01, 0x00,
+0x0d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x01, 0x01, 0x01, 0x04,
+0x02, 0x00, 0x01, 0x01, 0x02, 0x02, 0x00, 0x05, 0x01, 0x02, 0x21, 0x00,
+0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x65, 0x71, 0x76, 0x3f, 0x00,
+0x02, 0x05, 0x00, 0x00, 0x00, 0x71, 0x75, 0x6f, 0x74, 0x65, 0x00, 0x04,
+0x00, 0x00, 0x02, 0x08, 0x00, 0x0e, 0x00, 0x04, 0x00, 0x00, 0x01, 0x04,
+0x01, 0x00, 0x02, 0x01, 0x01, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
+0x02, 0x04, 0x02, 0x03, 0x03, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x01,
+0x00, 0x0d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x01, 0x01, 0x01,
+0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x02, 0x00, 0x05, 0x01, 0x02, 0x21,
+0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x65, 0x71, 0x76, 0x3f,
+0x00, 0x02, 0x09, 0x00, 0x00, 0x00, 0x75, 0x6e, 0x64, 0x65, 0x66, 0x69,
+0x6e, 0x65, 0x64, 0x00, 0x04, 0x00, 0x00, 0x02, 0x08, 0x00, 0x0e, 0x00,
+0x04, 0x00, 0x00, 0x01, 0x04, 0x01, 0x00, 0x02, 0x01, 0x01, 0x06, 0x00,
+0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x06, 0x02, 0x03, 0x03, 0x01, 0x01,
 0x03, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x02, 0x00,
-0x00, 0x04, 0x01, 0x05, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x02,
+0x00, 0x04, 0x01, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x02,
+0x00, 0x05, 0x01, 0x02, 0x21, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00,
+0x00, 0x65, 0x71, 0x76, 0x3f, 0x00, 0x02, 0x0a, 0x00, 0x00, 0x00, 0x72,
+0x65, 0x63, 0x6f, 0x72, 0x64, 0x2d, 0x72, 0x65, 0x66, 0x00, 0x04, 0x00,
+0x00, 0x02, 0x08, 0x00, 0x0e, 0x00, 0x04, 0x00, 0x00, 0x01, 0x04, 0x01,
+0x00, 0x02, 0x01, 0x01, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
+0x08, 0x02, 0x03, 0x03, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x01, 0x00,
+0x0d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x01, 0x01, 0x01, 0x04,
+0x02, 0x00, 0x01, 0x01, 0x02, 0x02, 0x00, 0x03, 0x00, 0x00, 0x1a, 0x00,
+0x00, 0x00, 0x04, 0x00, 0x00, 0x02, 0x08, 0x00, 0x0e, 0x00, 0x04, 0x00,
+0x00, 0x01, 0x04, 0x01, 0x00, 0x02, 0x01, 0x01, 0x04, 0x00, 0x00, 0x01,
+0x0a, 0x01, 0x01, 0x01, 0x01, 0x00, 0x05, 0x01, 0x02, 0x28, 0x00, 0x00,
+0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x65, 0x71, 0x76, 0x3f, 0x00, 0x02,
+0x0b, 0x00, 0x00, 0x00, 0x72, 0x65, 0x63, 0x6f, 0x72, 0x64, 0x2d, 0x73,
+0x65, 0x74, 0x21, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x15, 0x00,
+0x04, 0x00, 0x0a, 0x02, 0x04, 0x01, 0x02, 0x01, 0x04, 0x02, 0x04, 0x02,
+0x0d, 0x03, 0x00, 0x01, 0x03, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
+0x02, 0x02, 0x02, 0x03, 0x03, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x02,
+0x00, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x01, 0x01, 0x04,
+0x02, 0x00, 0x01, 0x01, 0x02, 0x02, 0x00, 0x03, 0x00, 0x00, 0x1a, 0x00,
+0x00, 0x00, 0x04, 0x00, 0x00, 0x02, 0x08, 0x00, 0x0e, 0x00, 0x04, 0x00,
+0x00, 0x01, 0x04, 0x01, 0x00, 0x02, 0x01, 0x01, 0x04, 0x00, 0x00, 0x01,
+0x0a, 0x01, 0x01, 0x01, 0x01, 0x00, 0x05, 0x02, 0x03, 0x23, 0x00, 0x00,
+0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x64, 0x64, 0x72, 0x00, 0x02,
+0x04, 0x00, 0x00, 0x00, 0x65, 0x71, 0x76, 0x3f, 0x00, 0x02, 0x04, 0x00,
+0x00, 0x00, 0x73, 0x65, 0x74, 0x21, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08,
+0x00, 0x10, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x06,
+0x02, 0x01, 0x02, 0x06, 0x00, 0x01, 0x02, 0x01, 0x01, 0x04, 0x02, 0x04,
+0x02, 0x03, 0x03, 0x02, 0x01, 0x03, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d,
+0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x01, 0x05, 0x01, 0x04, 0x02,
+0x00, 0x01, 0x01, 0x02, 0x02, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00,
+0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x61, 0x72, 0x00, 0x06, 0x00,
+0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x01, 0x02, 0x01, 0x00,
+0x05, 0x01, 0x00, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0f, 0x02, 0x02,
+0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x0d, 0x03, 0x00, 0x01, 0x03, 0x01,
+0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00,
+0x00, 0x63, 0x61, 0x64, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
+0x04, 0x02, 0x02, 0x02, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x00, 0x10,
+0x00, 0x00, 0x00, 0x04, 0x00, 0x11, 0x02, 0x02, 0x01, 0x00, 0x04, 0x02,
+0x00, 0x01, 0x0d, 0x03, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x01, 0x00,
+0x0d, 0x00, 0x00, 0x00, 0x04, 0x00, 0x17, 0x09, 0x02, 0x01, 0x00, 0x04,
+0x02, 0x04, 0x02, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x00, 0x10, 0x00,
+0x00, 0x00, 0x04, 0x00, 0x13, 0x02, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00,
+0x01, 0x0d, 0x03, 0x02, 0x01, 0x03, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c,
+0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x61, 0x64, 0x72,
+0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x0e, 0x02, 0x01,
+0x02, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x04,
+0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02,
+0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00,
+0x05, 0x01, 0x01, 0x0f, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00,
+0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x0d,
+0x02, 0x00, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01,
+0x02, 0x0f, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f,
+0x6e, 0x73, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x52, 0x53, 0x45, 0x54,
+0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x03, 0x02, 0x01, 0x04, 0x03,
+0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00,
+0x00, 0x04, 0x00, 0x18, 0x0a, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01,
+0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x04,
+0x00, 0x1e, 0x08, 0x02, 0x01, 0x00, 0x04, 0x02, 0x0b, 0x02, 0x01, 0x02,
+0x01, 0x00, 0x04, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x04, 0x00, 0x1a,
+0x03, 0x04, 0x01, 0x0c, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01,
+0x00, 0x04, 0x02, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02,
+0x01, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x02, 0x00, 0x03, 0x00,
+0x00, 0x1a, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x02, 0x08, 0x00, 0x0e,
+0x00, 0x04, 0x00, 0x00, 0x01, 0x04, 0x01, 0x00, 0x02, 0x01, 0x01, 0x04,
+0x00, 0x00, 0x01, 0x0a, 0x01, 0x01, 0x01, 0x01, 0x00, 0x05, 0x02, 0x02,
+0x24, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x65, 0x71, 0x76,
+0x3f, 0x00, 0x02, 0x02, 0x00, 0x00, 0x00, 0x69, 0x66, 0x00, 0x04, 0x00,
+0x00, 0x01, 0x08, 0x00, 0x11, 0x00, 0x04, 0x00, 0x13, 0x09, 0x02, 0x01,
+0x00, 0x04, 0x02, 0x08, 0x02, 0x01, 0x02, 0x06, 0x00, 0x00, 0x02, 0x01,
+0x01, 0x04, 0x02, 0x06, 0x02, 0x03, 0x03, 0x01, 0x01, 0x03, 0x01, 0x00,
+0x05, 0x01, 0x00, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0f, 0x02, 0x02,
+0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x0d, 0x03, 0x00, 0x01, 0x03, 0x01,
+0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00,
+0x00, 0x63, 0x61, 0x64, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
+0x04, 0x02, 0x0a, 0x02, 0x01, 0x02, 0x01, 0x00, 0x03, 0x01, 0x00, 0x09,
+0x00, 0x00, 0x00, 0x04, 0x00, 0x11, 0x0e, 0x02, 0x01, 0x00, 0x01, 0x01,
+0x01, 0x00, 0x05, 0x01, 0x00, 0x11, 0x00, 0x00, 0x00, 0x04, 0x00, 0x12,
+0x0f, 0x02, 0x01, 0x00, 0x04, 0x02, 0x01, 0x01, 0x04, 0x03, 0x00, 0x01,
+0x01, 0x03, 0x01, 0x00, 0x04, 0x02, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x02,
+0x00, 0x00, 0x02, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x02,
 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00,
 0x00, 0x63, 0x61, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
 0x02, 0x00, 0x02, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x02, 0x0f, 0x00,
@@ -3601,148 +3768,102 @@ static const unsigned char eval_rom[] = {
 0x10, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x02, 0x02,
 0x01, 0x02, 0x06, 0x00, 0x01, 0x02, 0x01, 0x01, 0x04, 0x02, 0x02, 0x02,
 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x04,
-0x00, 0x11, 0x06, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02,
+0x00, 0x17, 0x08, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02,
 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
 0x04, 0x01, 0x04, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x02, 0x00,
 0x05, 0x01, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00,
 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
 0x02, 0x00, 0x02, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01,
-0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e,
-0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x0e, 0x03,
-0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x02, 0x0f,
-0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73,
-0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x47, 0x52, 0x45, 0x46, 0x00, 0x06,
-0x00, 0x00, 0x02, 0x01, 0x00, 0x03, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01,
-0x01, 0x03, 0x01, 0x00, 0x04, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x04,
-0x00, 0x16, 0x08, 0x04, 0x01, 0x03, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01,
-0x02, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04,
-0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02,
-0x01, 0x00, 0x04, 0x02, 0x0b, 0x03, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03,
-0x01, 0x00, 0x05, 0x01, 0x02, 0x0f, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00,
-0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00,
-0x4c, 0x52, 0x45, 0x46, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x03,
-0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x00,
-0x00, 0x0e, 0x00, 0x00, 0x00, 0x04, 0x00, 0x13, 0x08, 0x04, 0x01, 0x05,
-0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00,
-0x0c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x01, 0x01, 0x04, 0x02,
-0x00, 0x01, 0x01, 0x02, 0x02, 0x00, 0x03, 0x00, 0x00, 0x1a, 0x00, 0x00,
-0x00, 0x04, 0x00, 0x00, 0x02, 0x08, 0x00, 0x0e, 0x00, 0x04, 0x00, 0x00,
-0x01, 0x04, 0x01, 0x00, 0x02, 0x01, 0x01, 0x04, 0x00, 0x00, 0x01, 0x0a,
-0x01, 0x01, 0x01, 0x01, 0x00, 0x05, 0x02, 0x03, 0x23, 0x00, 0x00, 0x00,
-0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x61, 0x64, 0x72, 0x00, 0x02, 0x04,
-0x00, 0x00, 0x00, 0x65, 0x71, 0x76, 0x3f, 0x00, 0x02, 0x09, 0x00, 0x00,
-0x00, 0x75, 0x6e, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x64, 0x00, 0x04,
-0x00, 0x00, 0x01, 0x08, 0x00, 0x10, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
-0x00, 0x04, 0x02, 0x06, 0x02, 0x01, 0x02, 0x06, 0x00, 0x01, 0x02, 0x01,
-0x01, 0x04, 0x02, 0x04, 0x02, 0x03, 0x03, 0x02, 0x01, 0x03, 0x01, 0x00,
-0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x01,
-0x05, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x02, 0x00, 0x05, 0x01,
-0x01, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x65, 0x71,
-0x3f, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x09, 0x02, 0x04, 0x03,
-0x00, 0x02, 0x01, 0x03, 0x01, 0x00, 0x05, 0x02, 0x02, 0x24, 0x00, 0x00,
-0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x02,
-0x03, 0x00, 0x00, 0x00, 0x65, 0x71, 0x3f, 0x00, 0x04, 0x00, 0x00, 0x01,
-0x08, 0x00, 0x12, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
-0x09, 0x03, 0x0b, 0x03, 0x01, 0x03, 0x06, 0x00, 0x01, 0x02, 0x01, 0x01,
-0x0a, 0x02, 0x04, 0x03, 0x01, 0x02, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01,
-0x02, 0x0f, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f,
-0x6e, 0x73, 0x00, 0x02, 0x05, 0x00, 0x00, 0x00, 0x4c, 0x4f, 0x41, 0x44,
-0x54, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x03, 0x02, 0x01, 0x04,
-0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x00, 0x00, 0x0e, 0x00,
-0x00, 0x00, 0x04, 0x00, 0x11, 0x08, 0x04, 0x01, 0x03, 0x01, 0x04, 0x02,
-0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x05, 0x02, 0x02, 0x22, 0x00, 0x00,
-0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x02,
-0x05, 0x00, 0x00, 0x00, 0x6e, 0x75, 0x6c, 0x6c, 0x3f, 0x00, 0x04, 0x00,
-0x00, 0x01, 0x08, 0x00, 0x12, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
-0x04, 0x02, 0x0a, 0x03, 0x0b, 0x03, 0x01, 0x03, 0x06, 0x00, 0x01, 0x02,
-0x01, 0x01, 0x04, 0x02, 0x02, 0x02, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01,
-0x02, 0x0f, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f,
-0x6e, 0x73, 0x00, 0x02, 0x05, 0x00, 0x00, 0x00, 0x4c, 0x4f, 0x41, 0x44,
-0x46, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x03, 0x02, 0x01, 0x04,
-0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x00, 0x00, 0x0e, 0x00,
-0x00, 0x00, 0x04, 0x00, 0x12, 0x08, 0x04, 0x01, 0x04, 0x01, 0x04, 0x02,
-0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x05, 0x02, 0x02, 0x24, 0x00, 0x00,
-0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x02,
-0x03, 0x00, 0x00, 0x00, 0x65, 0x71, 0x3f, 0x00, 0x04, 0x00, 0x00, 0x01,
-0x08, 0x00, 0x12, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
-0x0b, 0x03, 0x0b, 0x03, 0x01, 0x03, 0x06, 0x00, 0x01, 0x02, 0x01, 0x01,
-0x0c, 0x02, 0x04, 0x03, 0x03, 0x02, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01,
-0x02, 0x0f, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f,
-0x6e, 0x73, 0x00, 0x02, 0x05, 0x00, 0x00, 0x00, 0x4c, 0x4f, 0x41, 0x44,
-0x4e, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x03, 0x02, 0x01, 0x04,
-0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x00, 0x00, 0x0e, 0x00,
-0x00, 0x00, 0x04, 0x00, 0x13, 0x08, 0x04, 0x01, 0x05, 0x01, 0x04, 0x02,
-0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x05, 0x03, 0x01, 0x1e, 0x00, 0x00,
-0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x04,
-0x00, 0x00, 0x01, 0x08, 0x00, 0x12, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
-0x00, 0x04, 0x02, 0x0c, 0x03, 0x0b, 0x03, 0x01, 0x03, 0x02, 0x00, 0x01,
-0x02, 0x01, 0x02, 0x01, 0x01, 0x01, 0x00, 0x05, 0x01, 0x02, 0x0f, 0x00,
+0x0f, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e,
+0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x0d, 0x02, 0x00, 0x04,
+0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x02, 0x0f, 0x00,
 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00,
-0x02, 0x05, 0x00, 0x00, 0x00, 0x4c, 0x4f, 0x41, 0x44, 0x55, 0x00, 0x06,
-0x00, 0x00, 0x02, 0x01, 0x00, 0x03, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01,
-0x01, 0x03, 0x01, 0x00, 0x04, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x04,
-0x00, 0x14, 0x08, 0x04, 0x01, 0x06, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01,
-0x02, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x04, 0x00,
-0x18, 0x05, 0x02, 0x01, 0x00, 0x04, 0x02, 0x05, 0x02, 0x01, 0x02, 0x01,
-0x00, 0x06, 0x00, 0x01, 0x23, 0x00, 0x00, 0x00, 0x02, 0x02, 0x00, 0x00,
-0x00, 0x3c, 0x3d, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x17, 0x00,
-0x06, 0x00, 0x00, 0x04, 0x01, 0x01, 0x01, 0x0d, 0x02, 0x81, 0x04, 0x03,
-0x06, 0x02, 0x0d, 0x04, 0x7f, 0x01, 0x04, 0x04, 0x00, 0x01, 0x01, 0x0a,
-0x01, 0x01, 0x01, 0x01, 0x00, 0x05, 0x02, 0x01, 0x23, 0x00, 0x00, 0x00,
-0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x04, 0x00,
-0x00, 0x01, 0x08, 0x00, 0x12, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
-0x04, 0x02, 0x05, 0x02, 0x0b, 0x03, 0x01, 0x03, 0x04, 0x00, 0x13, 0x06,
-0x02, 0x01, 0x01, 0x04, 0x02, 0x05, 0x02, 0x01, 0x02, 0x01, 0x00, 0x05,
-0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63,
-0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
-0x0e, 0x03, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01,
-0x02, 0x0f, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f,
-0x6e, 0x73, 0x00, 0x02, 0x05, 0x00, 0x00, 0x00, 0x4c, 0x4f, 0x41, 0x44,
-0x49, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x03, 0x02, 0x01, 0x04,
-0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x00, 0x00, 0x0e, 0x00,
-0x00, 0x00, 0x04, 0x00, 0x16, 0x08, 0x04, 0x01, 0x08, 0x01, 0x04, 0x02,
-0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00,
-0x00, 0x02, 0x00, 0x00, 0x04, 0x01, 0x06, 0x01, 0x04, 0x02, 0x00, 0x01,
-0x01, 0x02, 0x02, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x02,
-0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00,
-0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x0b, 0x03, 0x01, 0x03, 0x01,
-0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00,
-0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
-0x04, 0x02, 0x10, 0x03, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00,
+0x02, 0x04, 0x00, 0x00, 0x00, 0x47, 0x53, 0x45, 0x54, 0x00, 0x06, 0x00,
+0x00, 0x02, 0x01, 0x00, 0x03, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01,
+0x03, 0x01, 0x00, 0x04, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x04, 0x00,
+0x1c, 0x0a, 0x04, 0x01, 0x03, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02,
+0x01, 0x00, 0x05, 0x01, 0x01, 0x0f, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00,
+0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
+0x00, 0x0d, 0x02, 0x00, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00,
 0x05, 0x01, 0x02, 0x0f, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00,
-0x63, 0x6f, 0x6e, 0x73, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x4c, 0x4f,
-0x41, 0x44, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x03, 0x02, 0x01,
+0x63, 0x6f, 0x6e, 0x73, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x4c, 0x53,
+0x45, 0x54, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x03, 0x02, 0x01,
 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x00, 0x00, 0x0e,
-0x00, 0x00, 0x00, 0x04, 0x00, 0x18, 0x08, 0x04, 0x01, 0x03, 0x01, 0x04,
-0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x0c, 0x00,
-0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01,
-0x01, 0x02, 0x02, 0x00, 0x03, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x04,
-0x00, 0x00, 0x02, 0x08, 0x00, 0x0e, 0x00, 0x04, 0x00, 0x00, 0x01, 0x04,
-0x01, 0x00, 0x02, 0x01, 0x01, 0x04, 0x00, 0x00, 0x01, 0x0a, 0x01, 0x01,
-0x01, 0x01, 0x00, 0x05, 0x02, 0x03, 0x25, 0x00, 0x00, 0x00, 0x02, 0x04,
-0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x02, 0x04, 0x00, 0x00,
-0x00, 0x65, 0x71, 0x76, 0x3f, 0x00, 0x02, 0x06, 0x00, 0x00, 0x00, 0x6c,
-0x61, 0x6d, 0x62, 0x64, 0x61, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00,
-0x12, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x08, 0x03,
-0x0b, 0x03, 0x01, 0x03, 0x06, 0x00, 0x01, 0x02, 0x01, 0x01, 0x04, 0x02,
-0x06, 0x02, 0x03, 0x03, 0x02, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x02,
-0x0f, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e,
-0x73, 0x00, 0x02, 0x05, 0x00, 0x00, 0x00, 0x4c, 0x4f, 0x41, 0x44, 0x55,
-0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x03, 0x02, 0x01, 0x04, 0x03,
-0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x00, 0x00, 0x0e, 0x00, 0x00,
-0x00, 0x04, 0x00, 0x10, 0x08, 0x04, 0x01, 0x08, 0x01, 0x04, 0x02, 0x00,
-0x01, 0x01, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x0c, 0x00, 0x00, 0x00,
-0x02, 0x00, 0x00, 0x02, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02,
-0x02, 0x00, 0x03, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-0x02, 0x08, 0x00, 0x0e, 0x00, 0x04, 0x00, 0x00, 0x01, 0x04, 0x01, 0x00,
-0x02, 0x01, 0x01, 0x04, 0x00, 0x00, 0x01, 0x0a, 0x01, 0x01, 0x01, 0x01,
-0x00, 0x03, 0x02, 0x00, 0x18, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01,
-0x08, 0x00, 0x0c, 0x00, 0x02, 0x00, 0x00, 0x02, 0x01, 0x01, 0x01, 0x01,
-0x04, 0x00, 0x08, 0x01, 0x0c, 0x01, 0x01, 0x01, 0x01, 0x00, 0x04, 0x01,
+0x00, 0x00, 0x00, 0x04, 0x00, 0x19, 0x0a, 0x04, 0x01, 0x05, 0x01, 0x04,
+0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00,
+0x00, 0x00, 0x04, 0x00, 0x19, 0x08, 0x02, 0x01, 0x00, 0x04, 0x02, 0x0e,
+0x02, 0x01, 0x02, 0x01, 0x00, 0x04, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00,
+0x04, 0x00, 0x15, 0x03, 0x04, 0x01, 0x0d, 0x01, 0x04, 0x02, 0x00, 0x01,
+0x01, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x02,
+0x00, 0x00, 0x02, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x02,
+0x00, 0x03, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x02,
+0x08, 0x00, 0x0e, 0x00, 0x04, 0x00, 0x00, 0x01, 0x04, 0x01, 0x00, 0x02,
+0x01, 0x01, 0x04, 0x00, 0x00, 0x01, 0x0a, 0x01, 0x01, 0x01, 0x01, 0x00,
+0x04, 0x03, 0x01, 0x2a, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00,
+0x63, 0x61, 0x64, 0x72, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x10,
+0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x0a, 0x02, 0x01,
+0x02, 0x09, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x02, 0x00, 0x01, 0x02, 0x01,
+0x02, 0x01, 0x01, 0x04, 0x00, 0x08, 0x01, 0x0c, 0x01, 0x01, 0x01, 0x01,
+0x00, 0x05, 0x01, 0x00, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x11, 0x02,
+0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x0d, 0x03, 0x00, 0x01, 0x03,
+0x01, 0x00, 0x03, 0x01, 0x00, 0x09, 0x00, 0x00, 0x00, 0x04, 0x00, 0x12,
+0x07, 0x02, 0x01, 0x00, 0x01, 0x01, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d,
+0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x01, 0x0b, 0x01, 0x04, 0x02,
+0x00, 0x01, 0x01, 0x02, 0x02, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00, 0x00,
+0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06,
+0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x0b, 0x03, 0x01,
+0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0f, 0x00, 0x00, 0x00, 0x02, 0x04,
+0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02,
+0x01, 0x00, 0x0d, 0x02, 0x00, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01,
+0x00, 0x05, 0x01, 0x02, 0x0f, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00,
+0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x43,
+0x4f, 0x4e, 0x44, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x03, 0x02,
+0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x01, 0x00,
+0x0d, 0x00, 0x00, 0x00, 0x04, 0x00, 0x17, 0x0a, 0x02, 0x01, 0x00, 0x04,
+0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00,
+0x00, 0x00, 0x04, 0x00, 0x1d, 0x09, 0x02, 0x01, 0x00, 0x04, 0x02, 0x12,
+0x02, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00,
+0x04, 0x00, 0x19, 0x03, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01,
+0x02, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x04, 0x00,
+0x1a, 0x06, 0x02, 0x01, 0x00, 0x04, 0x02, 0x06, 0x02, 0x01, 0x02, 0x01,
+0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x04, 0x00, 0x20, 0x08,
+0x02, 0x01, 0x00, 0x04, 0x02, 0x15, 0x02, 0x01, 0x02, 0x01, 0x00, 0x04,
+0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x04, 0x00, 0x1c, 0x03, 0x04, 0x01,
+0x08, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01,
 0x00, 0x0b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x01, 0x00, 0x01,
-0x0a, 0x02, 0x01, 0x02, 0x02, 0x00, 0x04, 0x02, 0x00, 0x14, 0x00, 0x00,
-0x00, 0x02, 0x00, 0x00, 0x05, 0x00, 0x00, 0x02, 0x04, 0x00, 0x17, 0x08,
-0x02, 0x01, 0x01, 0x04, 0x02, 0x0c, 0x02, 0x01, 0x02, 0x02, 0x00, 0x04,
+0x0a, 0x02, 0x01, 0x02, 0x02, 0x00, 0x05, 0x01, 0x00, 0x18, 0x00, 0x00,
+0x00, 0x02, 0x00, 0x00, 0x05, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x02,
+0x04, 0x01, 0x00, 0x01, 0x0d, 0x02, 0x00, 0x04, 0x03, 0x0c, 0x02, 0x01,
+0x03, 0x03, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x05,
+0x00, 0x00, 0x00, 0x6e, 0x75, 0x6c, 0x6c, 0x3f, 0x00, 0x06, 0x00, 0x00,
+0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x03, 0x01, 0x02, 0x01, 0x00, 0x04,
+0x01, 0x01, 0x1c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63,
+0x61, 0x72, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x0c, 0x00, 0x04,
+0x00, 0x01, 0x01, 0x0c, 0x01, 0x01, 0x01, 0x06, 0x00, 0x00, 0x02, 0x01,
+0x00, 0x04, 0x02, 0x01, 0x03, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x00,
+0x11, 0x00, 0x00, 0x00, 0x04, 0x00, 0x15, 0x02, 0x02, 0x01, 0x00, 0x04,
+0x02, 0x00, 0x01, 0x04, 0x03, 0x02, 0x02, 0x01, 0x03, 0x01, 0x00, 0x05,
+0x01, 0x01, 0x0f, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0x00, 0x2b,
+0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x03, 0x02, 0x0d,
+0x03, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00,
+0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x64, 0x72, 0x00, 0x06, 0x00,
+0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x04, 0x03, 0x01, 0x02, 0x01, 0x00,
+0x05, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x04, 0x00, 0x06, 0x02, 0x04,
+0x01, 0x05, 0x01, 0x04, 0x02, 0x01, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01,
+0x03, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x06,
+0x00, 0x00, 0x00, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x00, 0x06, 0x00,
+0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x0b, 0x02, 0x01, 0x02, 0x01, 0x00,
+0x05, 0x01, 0x01, 0x0f, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0x00,
+0x2d, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01,
+0x0d, 0x03, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00,
+0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00,
+0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x0b, 0x03,
+0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x02, 0x0f, 0x00, 0x00, 0x00, 0x02,
+0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x02, 0x04, 0x00,
+0x00, 0x00, 0x43, 0x41, 0x4c, 0x4c, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
+0x00, 0x03, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00,
+0x04, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x04, 0x00, 0x15, 0x0a, 0x04,
+0x01, 0x0d, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x03, 0x00, 0x04,
 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63,
 0x61, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00,
 0x02, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00,
@@ -3752,108 +3873,452 @@ static const unsigned char eval_rom[] = {
 0x00, 0x72, 0x65, 0x66, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
 0x02, 0x00, 0x02, 0x03, 0x03, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x02,
 0x00, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x01, 0x01, 0x04,
-0x02, 0x00, 0x01, 0x01, 0x02, 0x02, 0x00, 0x05, 0x01, 0x02, 0x21, 0x00,
+0x02, 0x00, 0x01, 0x01, 0x02, 0x02, 0x00, 0x03, 0x00, 0x00, 0x1a, 0x00,
+0x00, 0x00, 0x04, 0x00, 0x00, 0x02, 0x08, 0x00, 0x0e, 0x00, 0x04, 0x00,
+0x00, 0x01, 0x04, 0x01, 0x00, 0x02, 0x01, 0x01, 0x04, 0x00, 0x00, 0x01,
+0x0a, 0x01, 0x01, 0x01, 0x01, 0x00, 0x05, 0x02, 0x03, 0x23, 0x00, 0x00,
+0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x61, 0x64, 0x72, 0x00, 0x02,
+0x04, 0x00, 0x00, 0x00, 0x65, 0x71, 0x76, 0x3f, 0x00, 0x02, 0x05, 0x00,
+0x00, 0x00, 0x71, 0x75, 0x6f, 0x74, 0x65, 0x00, 0x04, 0x00, 0x00, 0x01,
+0x08, 0x00, 0x10, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
+0x04, 0x02, 0x01, 0x02, 0x06, 0x00, 0x01, 0x02, 0x01, 0x01, 0x04, 0x02,
+0x02, 0x02, 0x03, 0x03, 0x02, 0x01, 0x03, 0x01, 0x00, 0x03, 0x01, 0x00,
+0x09, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0b, 0x0e, 0x02, 0x01, 0x00, 0x01,
+0x01, 0x01, 0x00, 0x05, 0x01, 0x00, 0x11, 0x00, 0x00, 0x00, 0x04, 0x00,
+0x0c, 0x0f, 0x02, 0x01, 0x00, 0x04, 0x02, 0x01, 0x01, 0x04, 0x03, 0x00,
+0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00,
+0x02, 0x00, 0x00, 0x04, 0x01, 0x05, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01,
+0x02, 0x02, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03,
+0x00, 0x00, 0x00, 0x63, 0x61, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
+0x00, 0x04, 0x02, 0x00, 0x02, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x02,
+0x0f, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x65, 0x71, 0x3f,
+0x00, 0x02, 0x06, 0x00, 0x00, 0x00, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c,
+0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x03, 0x02, 0x01, 0x04, 0x03,
+0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x02, 0x02, 0x20, 0x00, 0x00,
+0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x61, 0x64, 0x72, 0x00, 0x02,
+0x03, 0x00, 0x00, 0x00, 0x63, 0x64, 0x72, 0x00, 0x04, 0x00, 0x00, 0x01,
+0x08, 0x00, 0x10, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
+0x02, 0x02, 0x01, 0x02, 0x06, 0x00, 0x01, 0x02, 0x01, 0x01, 0x04, 0x02,
+0x02, 0x02, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00,
+0x00, 0x04, 0x00, 0x11, 0x08, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01,
+0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x02,
+0x00, 0x00, 0x04, 0x01, 0x04, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02,
+0x02, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00,
+0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
+0x00, 0x04, 0x02, 0x00, 0x02, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05,
+0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63,
+0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
+0x0e, 0x03, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01,
+0x02, 0x0f, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f,
+0x6e, 0x73, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x47, 0x52, 0x45, 0x46,
+0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x03, 0x02, 0x01, 0x04, 0x03,
+0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x00, 0x00, 0x0e, 0x00, 0x00,
+0x00, 0x04, 0x00, 0x16, 0x0a, 0x04, 0x01, 0x03, 0x01, 0x04, 0x02, 0x00,
+0x01, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00,
+0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00,
+0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x0b, 0x03, 0x04, 0x03, 0x00, 0x01,
+0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x02, 0x0f, 0x00, 0x00, 0x00, 0x02,
+0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x02, 0x04, 0x00,
+0x00, 0x00, 0x4c, 0x52, 0x45, 0x46, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
+0x00, 0x03, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00,
+0x04, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x04, 0x00, 0x13, 0x0a, 0x04,
+0x01, 0x05, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x04,
+0x02, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x01, 0x01,
+0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x02, 0x00, 0x03, 0x00, 0x00, 0x1a,
+0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x02, 0x08, 0x00, 0x0e, 0x00, 0x04,
+0x00, 0x00, 0x01, 0x04, 0x01, 0x00, 0x02, 0x01, 0x01, 0x04, 0x00, 0x00,
+0x01, 0x0a, 0x01, 0x01, 0x01, 0x01, 0x00, 0x05, 0x02, 0x03, 0x23, 0x00,
+0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x61, 0x64, 0x72, 0x00,
+0x02, 0x04, 0x00, 0x00, 0x00, 0x65, 0x71, 0x76, 0x3f, 0x00, 0x02, 0x09,
+0x00, 0x00, 0x00, 0x75, 0x6e, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x64,
+0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x10, 0x00, 0x06, 0x00, 0x00,
+0x02, 0x01, 0x00, 0x04, 0x02, 0x06, 0x02, 0x01, 0x02, 0x06, 0x00, 0x01,
+0x02, 0x01, 0x01, 0x04, 0x02, 0x04, 0x02, 0x03, 0x03, 0x02, 0x01, 0x03,
+0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+0x04, 0x01, 0x05, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x02, 0x00,
+0x05, 0x01, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00,
+0x65, 0x71, 0x3f, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x09, 0x02,
+0x04, 0x03, 0x00, 0x02, 0x01, 0x03, 0x01, 0x00, 0x05, 0x02, 0x02, 0x24,
+0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73,
+0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x65, 0x71, 0x3f, 0x00, 0x04, 0x00,
+0x00, 0x01, 0x08, 0x00, 0x12, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
+0x04, 0x02, 0x09, 0x03, 0x0b, 0x03, 0x01, 0x03, 0x06, 0x00, 0x01, 0x02,
+0x01, 0x01, 0x0a, 0x02, 0x04, 0x03, 0x01, 0x02, 0x01, 0x03, 0x01, 0x00,
+0x05, 0x01, 0x02, 0x0f, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00,
+0x63, 0x6f, 0x6e, 0x73, 0x00, 0x02, 0x05, 0x00, 0x00, 0x00, 0x4c, 0x4f,
+0x41, 0x44, 0x54, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x03, 0x02,
+0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x00, 0x00,
+0x0e, 0x00, 0x00, 0x00, 0x04, 0x00, 0x11, 0x0a, 0x04, 0x01, 0x03, 0x01,
+0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x05, 0x02, 0x02, 0x22,
+0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73,
+0x00, 0x02, 0x05, 0x00, 0x00, 0x00, 0x6e, 0x75, 0x6c, 0x6c, 0x3f, 0x00,
+0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x12, 0x00, 0x06, 0x00, 0x00, 0x02,
+0x01, 0x00, 0x04, 0x02, 0x0a, 0x03, 0x0b, 0x03, 0x01, 0x03, 0x06, 0x00,
+0x01, 0x02, 0x01, 0x01, 0x04, 0x02, 0x02, 0x02, 0x01, 0x02, 0x01, 0x00,
+0x05, 0x01, 0x02, 0x0f, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00,
+0x63, 0x6f, 0x6e, 0x73, 0x00, 0x02, 0x05, 0x00, 0x00, 0x00, 0x4c, 0x4f,
+0x41, 0x44, 0x46, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x03, 0x02,
+0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x00, 0x00,
+0x0e, 0x00, 0x00, 0x00, 0x04, 0x00, 0x12, 0x0a, 0x04, 0x01, 0x04, 0x01,
+0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x05, 0x02, 0x02, 0x24,
+0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73,
+0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x65, 0x71, 0x3f, 0x00, 0x04, 0x00,
+0x00, 0x01, 0x08, 0x00, 0x12, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
+0x04, 0x02, 0x0b, 0x03, 0x0b, 0x03, 0x01, 0x03, 0x06, 0x00, 0x01, 0x02,
+0x01, 0x01, 0x0c, 0x02, 0x04, 0x03, 0x03, 0x02, 0x01, 0x03, 0x01, 0x00,
+0x05, 0x01, 0x02, 0x0f, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00,
+0x63, 0x6f, 0x6e, 0x73, 0x00, 0x02, 0x05, 0x00, 0x00, 0x00, 0x4c, 0x4f,
+0x41, 0x44, 0x4e, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x03, 0x02,
+0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x00, 0x00,
+0x0e, 0x00, 0x00, 0x00, 0x04, 0x00, 0x13, 0x0a, 0x04, 0x01, 0x05, 0x01,
+0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x05, 0x03, 0x01, 0x1e,
+0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73,
+0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x12, 0x00, 0x06, 0x00, 0x00,
+0x02, 0x01, 0x00, 0x04, 0x02, 0x0c, 0x03, 0x0b, 0x03, 0x01, 0x03, 0x02,
+0x00, 0x01, 0x02, 0x01, 0x02, 0x01, 0x01, 0x01, 0x00, 0x05, 0x01, 0x02,
+0x0f, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e,
+0x73, 0x00, 0x02, 0x05, 0x00, 0x00, 0x00, 0x4c, 0x4f, 0x41, 0x44, 0x55,
+0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x03, 0x02, 0x01, 0x04, 0x03,
+0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x00, 0x00, 0x0e, 0x00, 0x00,
+0x00, 0x04, 0x00, 0x14, 0x0a, 0x04, 0x01, 0x06, 0x01, 0x04, 0x02, 0x00,
+0x01, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00,
+0x04, 0x00, 0x18, 0x05, 0x02, 0x01, 0x00, 0x04, 0x02, 0x05, 0x02, 0x01,
+0x02, 0x01, 0x00, 0x06, 0x00, 0x01, 0x23, 0x00, 0x00, 0x00, 0x02, 0x02,
+0x00, 0x00, 0x00, 0x3c, 0x3d, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00,
+0x17, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x01, 0x01, 0x0d, 0x02, 0x81,
+0x04, 0x03, 0x06, 0x02, 0x0d, 0x04, 0x7f, 0x01, 0x04, 0x04, 0x00, 0x01,
+0x01, 0x0a, 0x01, 0x01, 0x01, 0x01, 0x00, 0x05, 0x02, 0x01, 0x23, 0x00,
+0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00,
+0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x12, 0x00, 0x06, 0x00, 0x00, 0x02,
+0x01, 0x00, 0x04, 0x02, 0x05, 0x02, 0x0b, 0x03, 0x01, 0x03, 0x04, 0x00,
+0x13, 0x08, 0x02, 0x01, 0x01, 0x04, 0x02, 0x05, 0x02, 0x01, 0x02, 0x01,
+0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00,
+0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
+0x04, 0x02, 0x0e, 0x03, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00,
+0x05, 0x01, 0x02, 0x0f, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00,
+0x63, 0x6f, 0x6e, 0x73, 0x00, 0x02, 0x05, 0x00, 0x00, 0x00, 0x4c, 0x4f,
+0x41, 0x44, 0x49, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x03, 0x02,
+0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x00, 0x00,
+0x0e, 0x00, 0x00, 0x00, 0x04, 0x00, 0x16, 0x0a, 0x04, 0x01, 0x08, 0x01,
+0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d,
+0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x01, 0x06, 0x01, 0x04, 0x02,
+0x00, 0x01, 0x01, 0x02, 0x02, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00, 0x00,
+0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06,
+0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x0b, 0x03, 0x01,
+0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04,
+0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02,
+0x01, 0x00, 0x04, 0x02, 0x10, 0x03, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03,
+0x01, 0x00, 0x05, 0x01, 0x02, 0x0f, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00,
+0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00,
+0x4c, 0x4f, 0x41, 0x44, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x03,
+0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x00,
+0x00, 0x0e, 0x00, 0x00, 0x00, 0x04, 0x00, 0x18, 0x0a, 0x04, 0x01, 0x03,
+0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00,
+0x0c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x01, 0x01, 0x04, 0x02,
+0x00, 0x01, 0x01, 0x02, 0x02, 0x00, 0x03, 0x00, 0x00, 0x1a, 0x00, 0x00,
+0x00, 0x04, 0x00, 0x00, 0x02, 0x08, 0x00, 0x0e, 0x00, 0x04, 0x00, 0x00,
+0x01, 0x04, 0x01, 0x00, 0x02, 0x01, 0x01, 0x04, 0x00, 0x00, 0x01, 0x0a,
+0x01, 0x01, 0x01, 0x01, 0x00, 0x05, 0x02, 0x03, 0x25, 0x00, 0x00, 0x00,
+0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x02, 0x04,
+0x00, 0x00, 0x00, 0x65, 0x71, 0x76, 0x3f, 0x00, 0x02, 0x0a, 0x00, 0x00,
+0x00, 0x72, 0x65, 0x63, 0x6f, 0x72, 0x64, 0x2d, 0x72, 0x65, 0x66, 0x00,
+0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x12, 0x00, 0x06, 0x00, 0x00, 0x02,
+0x01, 0x00, 0x04, 0x02, 0x08, 0x03, 0x0b, 0x03, 0x01, 0x03, 0x06, 0x00,
+0x01, 0x02, 0x01, 0x01, 0x04, 0x02, 0x06, 0x02, 0x03, 0x03, 0x02, 0x01,
+0x03, 0x01, 0x00, 0x05, 0x01, 0x02, 0x0f, 0x00, 0x00, 0x00, 0x02, 0x04,
+0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x02, 0x05, 0x00, 0x00,
+0x00, 0x4c, 0x4f, 0x41, 0x44, 0x55, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
+0x00, 0x03, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00,
+0x04, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x04, 0x00, 0x10, 0x0a, 0x04,
+0x01, 0x08, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x04,
+0x02, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x01, 0x01,
+0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x02, 0x00, 0x03, 0x00, 0x00, 0x1a,
+0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x02, 0x08, 0x00, 0x0e, 0x00, 0x04,
+0x00, 0x00, 0x01, 0x04, 0x01, 0x00, 0x02, 0x01, 0x01, 0x04, 0x00, 0x00,
+0x01, 0x0a, 0x01, 0x01, 0x01, 0x01, 0x00, 0x05, 0x02, 0x02, 0x24, 0x00,
 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x65, 0x71, 0x76, 0x3f, 0x00,
 0x02, 0x06, 0x00, 0x00, 0x00, 0x6c, 0x61, 0x6d, 0x62, 0x64, 0x61, 0x00,
-0x04, 0x00, 0x00, 0x02, 0x08, 0x00, 0x0e, 0x00, 0x04, 0x00, 0x00, 0x01,
-0x04, 0x01, 0x00, 0x02, 0x01, 0x01, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
-0x04, 0x02, 0x02, 0x02, 0x03, 0x03, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04,
-0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x01, 0x01,
-0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x02, 0x00, 0x05, 0x01, 0x02,
-0x21, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x65, 0x71, 0x76,
-0x3f, 0x00, 0x02, 0x05, 0x00, 0x00, 0x00, 0x71, 0x75, 0x6f, 0x74, 0x65,
+0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x11, 0x00, 0x04, 0x00, 0x15, 0x09,
+0x02, 0x01, 0x00, 0x04, 0x02, 0x0a, 0x02, 0x01, 0x02, 0x06, 0x00, 0x00,
+0x02, 0x01, 0x01, 0x04, 0x02, 0x08, 0x02, 0x03, 0x03, 0x01, 0x01, 0x03,
+0x01, 0x00, 0x05, 0x01, 0x00, 0x11, 0x00, 0x00, 0x00, 0x04, 0x00, 0x11,
+0x02, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x04, 0x03, 0x0b, 0x03,
+0x01, 0x03, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x04,
+0x00, 0x17, 0x08, 0x02, 0x01, 0x00, 0x04, 0x02, 0x0c, 0x02, 0x01, 0x02,
+0x01, 0x00, 0x05, 0x01, 0x01, 0x0f, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00,
+0x00, 0x00, 0x2b, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
+0x0d, 0x03, 0x0d, 0x03, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x00,
+0x11, 0x00, 0x00, 0x00, 0x04, 0x00, 0x14, 0x02, 0x02, 0x01, 0x00, 0x04,
+0x02, 0x01, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04,
+0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63,
+0x61, 0x64, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
+0x0f, 0x02, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00, 0x00,
+0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06,
+0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x0b, 0x03, 0x01,
+0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04,
+0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02,
+0x01, 0x00, 0x04, 0x02, 0x11, 0x03, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03,
+0x01, 0x00, 0x05, 0x01, 0x02, 0x0f, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00,
+0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00,
+0x52, 0x52, 0x45, 0x46, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x03,
+0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x00,
+0x00, 0x0e, 0x00, 0x00, 0x00, 0x04, 0x00, 0x19, 0x0a, 0x04, 0x01, 0x11,
+0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00,
+0x0c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x01, 0x01, 0x04, 0x02,
+0x00, 0x01, 0x01, 0x02, 0x02, 0x00, 0x03, 0x00, 0x00, 0x1a, 0x00, 0x00,
 0x00, 0x04, 0x00, 0x00, 0x02, 0x08, 0x00, 0x0e, 0x00, 0x04, 0x00, 0x00,
-0x01, 0x04, 0x01, 0x00, 0x02, 0x01, 0x01, 0x06, 0x00, 0x00, 0x02, 0x01,
-0x00, 0x04, 0x02, 0x04, 0x02, 0x03, 0x03, 0x01, 0x01, 0x03, 0x01, 0x00,
-0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x01,
-0x01, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x02, 0x00, 0x05, 0x01,
-0x02, 0x21, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x65, 0x71,
-0x76, 0x3f, 0x00, 0x02, 0x09, 0x00, 0x00, 0x00, 0x75, 0x6e, 0x64, 0x65,
-0x66, 0x69, 0x6e, 0x65, 0x64, 0x00, 0x04, 0x00, 0x00, 0x02, 0x08, 0x00,
-0x0e, 0x00, 0x04, 0x00, 0x00, 0x01, 0x04, 0x01, 0x00, 0x02, 0x01, 0x01,
-0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x06, 0x02, 0x03, 0x03,
-0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00,
-0x02, 0x00, 0x00, 0x04, 0x01, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01,
-0x02, 0x02, 0x00, 0x03, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x04, 0x00,
-0x00, 0x02, 0x08, 0x00, 0x0e, 0x00, 0x04, 0x00, 0x00, 0x01, 0x04, 0x01,
-0x00, 0x02, 0x01, 0x01, 0x04, 0x00, 0x00, 0x01, 0x0a, 0x01, 0x01, 0x01,
-0x01, 0x00, 0x05, 0x01, 0x02, 0x20, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00,
-0x00, 0x00, 0x65, 0x71, 0x76, 0x3f, 0x00, 0x02, 0x02, 0x00, 0x00, 0x00,
-0x69, 0x66, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x0d, 0x00, 0x04,
-0x00, 0x02, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x06, 0x00, 0x00, 0x02,
-0x01, 0x00, 0x04, 0x02, 0x02, 0x02, 0x03, 0x03, 0x01, 0x01, 0x03, 0x01,
-0x00, 0x04, 0x02, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02,
-0x01, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x02, 0x00, 0x03, 0x00,
-0x00, 0x1a, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x02, 0x08, 0x00, 0x0e,
-0x00, 0x04, 0x00, 0x00, 0x01, 0x04, 0x01, 0x00, 0x02, 0x01, 0x01, 0x04,
-0x00, 0x00, 0x01, 0x0a, 0x01, 0x01, 0x01, 0x01, 0x00, 0x05, 0x02, 0x02,
-0x24, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x65, 0x71, 0x76,
-0x3f, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x73, 0x65, 0x74, 0x21, 0x00,
-0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x11, 0x00, 0x04, 0x00, 0x1e, 0x08,
-0x02, 0x01, 0x00, 0x04, 0x02, 0x06, 0x02, 0x01, 0x02, 0x06, 0x00, 0x00,
-0x02, 0x01, 0x01, 0x04, 0x02, 0x04, 0x02, 0x03, 0x03, 0x01, 0x01, 0x03,
-0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x04, 0x00, 0x08,
-0x02, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00,
-0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x04, 0x00, 0x20, 0x07, 0x02,
-0x01, 0x00, 0x04, 0x02, 0x08, 0x02, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01,
-0x00, 0x0d, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0a, 0x02, 0x02, 0x01, 0x00,
+0x01, 0x04, 0x01, 0x00, 0x02, 0x01, 0x01, 0x04, 0x00, 0x00, 0x01, 0x0a,
+0x01, 0x01, 0x01, 0x01, 0x00, 0x03, 0x02, 0x00, 0x18, 0x00, 0x00, 0x00,
+0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x0c, 0x00, 0x02, 0x00, 0x00, 0x02,
+0x01, 0x01, 0x01, 0x01, 0x04, 0x00, 0x0a, 0x01, 0x0c, 0x01, 0x01, 0x01,
+0x01, 0x00, 0x04, 0x01, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+0x04, 0x01, 0x00, 0x01, 0x0a, 0x02, 0x01, 0x02, 0x02, 0x00, 0x04, 0x02,
+0x00, 0x14, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x05, 0x00, 0x00, 0x02,
+0x04, 0x00, 0x19, 0x09, 0x02, 0x01, 0x01, 0x04, 0x02, 0x0e, 0x02, 0x01,
+0x02, 0x02, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03,
+0x00, 0x00, 0x00, 0x63, 0x61, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
+0x00, 0x04, 0x02, 0x00, 0x02, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x00,
+0x0d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x01, 0x01, 0x01, 0x04,
+0x02, 0x00, 0x01, 0x01, 0x02, 0x02, 0x00, 0x05, 0x01, 0x02, 0x0f, 0x00,
+0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x65, 0x71, 0x76, 0x3f, 0x00,
+0x02, 0x03, 0x00, 0x00, 0x00, 0x72, 0x65, 0x66, 0x00, 0x06, 0x00, 0x00,
+0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x03, 0x03, 0x01, 0x01, 0x03,
+0x01, 0x00, 0x04, 0x02, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+0x02, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x02, 0x00, 0x05,
+0x01, 0x02, 0x21, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x65,
+0x71, 0x76, 0x3f, 0x00, 0x02, 0x06, 0x00, 0x00, 0x00, 0x6c, 0x61, 0x6d,
+0x62, 0x64, 0x61, 0x00, 0x04, 0x00, 0x00, 0x02, 0x08, 0x00, 0x0e, 0x00,
+0x04, 0x00, 0x00, 0x01, 0x04, 0x01, 0x00, 0x02, 0x01, 0x01, 0x06, 0x00,
+0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x02, 0x02, 0x03, 0x03, 0x01, 0x01,
+0x03, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x02, 0x00,
+0x00, 0x04, 0x01, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x02,
+0x00, 0x05, 0x01, 0x02, 0x21, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00,
+0x00, 0x65, 0x71, 0x76, 0x3f, 0x00, 0x02, 0x05, 0x00, 0x00, 0x00, 0x71,
+0x75, 0x6f, 0x74, 0x65, 0x00, 0x04, 0x00, 0x00, 0x02, 0x08, 0x00, 0x0e,
+0x00, 0x04, 0x00, 0x00, 0x01, 0x04, 0x01, 0x00, 0x02, 0x01, 0x01, 0x06,
+0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x04, 0x02, 0x03, 0x03, 0x01,
+0x01, 0x03, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x02,
+0x00, 0x00, 0x04, 0x01, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02,
+0x02, 0x00, 0x05, 0x01, 0x02, 0x21, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00,
+0x00, 0x00, 0x65, 0x71, 0x76, 0x3f, 0x00, 0x02, 0x09, 0x00, 0x00, 0x00,
+0x75, 0x6e, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x64, 0x00, 0x04, 0x00,
+0x00, 0x02, 0x08, 0x00, 0x0e, 0x00, 0x04, 0x00, 0x00, 0x01, 0x04, 0x01,
+0x00, 0x02, 0x01, 0x01, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
+0x06, 0x02, 0x03, 0x03, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x01, 0x00,
+0x0d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x01, 0x01, 0x01, 0x04,
+0x02, 0x00, 0x01, 0x01, 0x02, 0x02, 0x00, 0x05, 0x01, 0x02, 0x21, 0x00,
+0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x65, 0x71, 0x76, 0x3f, 0x00,
+0x02, 0x0a, 0x00, 0x00, 0x00, 0x72, 0x65, 0x63, 0x6f, 0x72, 0x64, 0x2d,
+0x72, 0x65, 0x66, 0x00, 0x04, 0x00, 0x00, 0x02, 0x08, 0x00, 0x0e, 0x00,
+0x04, 0x00, 0x00, 0x01, 0x04, 0x01, 0x00, 0x02, 0x01, 0x01, 0x06, 0x00,
+0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x08, 0x02, 0x03, 0x03, 0x01, 0x01,
+0x03, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x02, 0x00,
+0x00, 0x04, 0x01, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x02,
+0x00, 0x03, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x02,
+0x08, 0x00, 0x0e, 0x00, 0x04, 0x00, 0x00, 0x01, 0x04, 0x01, 0x00, 0x02,
+0x01, 0x01, 0x04, 0x00, 0x00, 0x01, 0x0a, 0x01, 0x01, 0x01, 0x01, 0x00,
+0x05, 0x01, 0x02, 0x28, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00,
+0x65, 0x71, 0x76, 0x3f, 0x00, 0x02, 0x02, 0x00, 0x00, 0x00, 0x69, 0x66,
+0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x15, 0x00, 0x04, 0x00, 0x19,
+0x05, 0x04, 0x01, 0x02, 0x01, 0x04, 0x02, 0x04, 0x02, 0x0d, 0x03, 0x00,
+0x01, 0x03, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x02, 0x02,
+0x03, 0x03, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x02, 0x00, 0x0c, 0x00,
+0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01,
+0x01, 0x02, 0x02, 0x00, 0x03, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x04,
+0x00, 0x00, 0x02, 0x08, 0x00, 0x0e, 0x00, 0x04, 0x00, 0x00, 0x01, 0x04,
+0x01, 0x00, 0x02, 0x01, 0x01, 0x04, 0x00, 0x00, 0x01, 0x0a, 0x01, 0x01,
+0x01, 0x01, 0x00, 0x05, 0x02, 0x03, 0x23, 0x00, 0x00, 0x00, 0x02, 0x04,
+0x00, 0x00, 0x00, 0x63, 0x61, 0x64, 0x72, 0x00, 0x02, 0x04, 0x00, 0x00,
+0x00, 0x65, 0x71, 0x76, 0x3f, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x73,
+0x65, 0x74, 0x21, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x10, 0x00,
+0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x06, 0x02, 0x01, 0x02,
+0x06, 0x00, 0x01, 0x02, 0x01, 0x01, 0x04, 0x02, 0x04, 0x02, 0x03, 0x03,
+0x02, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x00, 0x10, 0x00, 0x00, 0x00,
+0x04, 0x00, 0x1c, 0x05, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x0d,
+0x03, 0x00, 0x01, 0x03, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00,
+0x00, 0x04, 0x00, 0x22, 0x09, 0x02, 0x01, 0x00, 0x04, 0x02, 0x08, 0x02,
+0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x04,
+0x00, 0x0a, 0x02, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02,
+0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x04, 0x00, 0x24,
+0x08, 0x02, 0x01, 0x00, 0x04, 0x02, 0x0a, 0x02, 0x01, 0x02, 0x01, 0x00,
+0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0c, 0x02, 0x02,
+0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01,
+0x00, 0x11, 0x00, 0x00, 0x00, 0x04, 0x00, 0x26, 0x06, 0x02, 0x01, 0x00,
+0x04, 0x02, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00,
+0x05, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x04, 0x00, 0x27, 0x06, 0x04,
+0x01, 0x0b, 0x01, 0x04, 0x02, 0x05, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01,
+0x03, 0x01, 0x00, 0x04, 0x02, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x00,
+0x00, 0x02, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x02, 0x00,
+0x03, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x02, 0x08,
+0x00, 0x0e, 0x00, 0x04, 0x00, 0x00, 0x01, 0x04, 0x01, 0x00, 0x02, 0x01,
+0x01, 0x04, 0x00, 0x00, 0x01, 0x0a, 0x01, 0x01, 0x01, 0x01, 0x00, 0x05,
+0x02, 0x02, 0x24, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x65,
+0x71, 0x76, 0x3f, 0x00, 0x02, 0x0b, 0x00, 0x00, 0x00, 0x72, 0x65, 0x63,
+0x6f, 0x72, 0x64, 0x2d, 0x73, 0x65, 0x74, 0x21, 0x00, 0x04, 0x00, 0x00,
+0x01, 0x08, 0x00, 0x11, 0x00, 0x04, 0x00, 0x22, 0x09, 0x02, 0x01, 0x00,
+0x04, 0x02, 0x08, 0x02, 0x01, 0x02, 0x06, 0x00, 0x00, 0x02, 0x01, 0x01,
+0x04, 0x02, 0x06, 0x02, 0x03, 0x03, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05,
+0x01, 0x00, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x1e, 0x05, 0x02, 0x01,
+0x00, 0x04, 0x02, 0x00, 0x01, 0x0d, 0x03, 0x00, 0x01, 0x03, 0x01, 0x00,
+0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x04, 0x00, 0x24, 0x08, 0x02,
+0x01, 0x00, 0x04, 0x02, 0x0a, 0x02, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01,
+0x00, 0x0d, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0c, 0x02, 0x02, 0x01, 0x00,
 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x05, 0x00, 0x00, 0x12,
-0x00, 0x00, 0x00, 0x04, 0x00, 0x22, 0x06, 0x04, 0x01, 0x08, 0x01, 0x04,
+0x00, 0x00, 0x00, 0x04, 0x00, 0x26, 0x06, 0x04, 0x01, 0x0a, 0x01, 0x04,
 0x02, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04,
 0x02, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x01, 0x01,
 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x02, 0x00, 0x03, 0x00, 0x00, 0x1a,
 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x02, 0x08, 0x00, 0x0e, 0x00, 0x04,
 0x00, 0x00, 0x01, 0x04, 0x01, 0x00, 0x02, 0x01, 0x01, 0x04, 0x00, 0x00,
-0x01, 0x0a, 0x01, 0x01, 0x01, 0x01, 0x00, 0x04, 0x02, 0x01, 0x2f, 0x00,
-0x00, 0x00, 0x02, 0x06, 0x00, 0x00, 0x00, 0x6c, 0x65, 0x6e, 0x67, 0x74,
-0x68, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x11, 0x00, 0x04, 0x00,
-0x20, 0x07, 0x02, 0x01, 0x00, 0x04, 0x02, 0x08, 0x02, 0x01, 0x02, 0x09,
-0x00, 0x08, 0x00, 0x10, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x01, 0x04,
-0x02, 0x08, 0x02, 0x01, 0x02, 0x04, 0x00, 0x06, 0x01, 0x0c, 0x01, 0x01,
-0x01, 0x01, 0x00, 0x04, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x04, 0x00,
-0x0a, 0x02, 0x04, 0x01, 0x07, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02,
-0x01, 0x00, 0x05, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00,
-0x00, 0x00, 0x2b, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x07, 0x01, 0x0d,
-0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x00,
-0x00, 0x0e, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x02, 0x04, 0x01, 0x01,
-0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x03, 0x02, 0x00,
-0x08, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x01, 0x01, 0x01, 0x01,
-0x01, 0x00, 0x04, 0x01, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
-0x04, 0x01, 0x00, 0x01, 0x0a, 0x02, 0x01, 0x02, 0x02, 0x00, 0x04, 0x02,
-0x01, 0x13, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x61,
-0x64, 0x72, 0x00, 0x02, 0x00, 0x00, 0x05, 0x00, 0x00, 0x02, 0x06, 0x00,
-0x00, 0x02, 0x01, 0x01, 0x04, 0x02, 0x0d, 0x02, 0x01, 0x02, 0x03, 0x00,
-0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x07, 0x00, 0x00, 0x00,
-0x73, 0x79, 0x6d, 0x62, 0x6f, 0x6c, 0x3f, 0x00, 0x06, 0x00, 0x00, 0x02,
-0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01,
-0x02, 0x23, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f,
-0x6e, 0x73, 0x00, 0x02, 0x05, 0x00, 0x00, 0x00, 0x6e, 0x75, 0x6c, 0x6c,
-0x3f, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x13, 0x00, 0x06, 0x00,
-0x00, 0x04, 0x01, 0x01, 0x01, 0x04, 0x02, 0x01, 0x03, 0x09, 0x03, 0x01,
-0x03, 0x06, 0x00, 0x01, 0x02, 0x01, 0x00, 0x04, 0x02, 0x01, 0x02, 0x01,
-0x02, 0x01, 0x00, 0x05, 0x01, 0x02, 0x23, 0x00, 0x00, 0x00, 0x02, 0x04,
-0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x02, 0x03, 0x00, 0x00,
-0x00, 0x63, 0x64, 0x72, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x13,
-0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x02, 0x01, 0x04, 0x02, 0x02, 0x03,
-0x0a, 0x03, 0x01, 0x03, 0x06, 0x00, 0x01, 0x02, 0x01, 0x00, 0x04, 0x02,
-0x02, 0x02, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0f, 0x00, 0x00,
-0x00, 0x02, 0x01, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x06, 0x00, 0x00, 0x02,
-0x01, 0x00, 0x0d, 0x02, 0x01, 0x04, 0x03, 0x03, 0x03, 0x01, 0x03, 0x01,
-0x00, 0x05, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x04, 0x00, 0x05, 0x02,
-0x04, 0x01, 0x04, 0x01, 0x04, 0x02, 0x01, 0x01, 0x04, 0x03, 0x00, 0x01,
-0x01, 0x03, 0x01, 0x00, 0x05, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x04,
-0x00, 0x01, 0x02, 0x04, 0x01, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01, 0x0d,
-0x03, 0x00, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x00, 0x11, 0x00, 0x00,
-0x00, 0x02, 0x00, 0x00, 0x04, 0x01, 0x0a, 0x01, 0x04, 0x02, 0x01, 0x01,
-0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x03, 0x00, 0x03, 0x01, 0x01, 0x08,
-0x00, 0x00, 0x00, 0x02, 0x0e, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x6b, 0x65,
-0x2d, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x00, 0x06,
-0x00, 0x00, 0x02, 0x01, 0x00, 0x01, 0x01, 0x01, 0x00, 0x03, 0x01, 0x01,
-0x08, 0x00, 0x00, 0x00, 0x02, 0x1b, 0x00, 0x00, 0x00, 0x63, 0x75, 0x72,
+0x01, 0x0a, 0x01, 0x01, 0x01, 0x01, 0x00, 0x04, 0x02, 0x02, 0x2e, 0x00,
+0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x64, 0x64, 0x72, 0x00,
+0x02, 0x06, 0x00, 0x00, 0x00, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x00,
+0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x10, 0x00, 0x06, 0x00, 0x00, 0x02,
+0x01, 0x00, 0x04, 0x02, 0x0a, 0x02, 0x01, 0x02, 0x09, 0x00, 0x08, 0x00,
+0x10, 0x00, 0x06, 0x00, 0x01, 0x02, 0x01, 0x01, 0x04, 0x02, 0x0a, 0x02,
+0x01, 0x02, 0x04, 0x00, 0x08, 0x01, 0x0c, 0x01, 0x01, 0x01, 0x01, 0x00,
+0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x01,
+0x09, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x02, 0x00, 0x04, 0x01,
+0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x61,
+0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02,
+0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02,
+0x04, 0x00, 0x00, 0x00, 0x63, 0x61, 0x64, 0x72, 0x00, 0x06, 0x00, 0x00,
+0x02, 0x01, 0x00, 0x04, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x00, 0x04,
+0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x04, 0x00, 0x28, 0x09, 0x02, 0x01,
+0x00, 0x04, 0x02, 0x02, 0x02, 0x01, 0x02, 0x01, 0x00, 0x06, 0x01, 0x01,
+0x14, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x6c, 0x69, 0x73,
+0x74, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x02, 0x01,
+0x04, 0x03, 0x01, 0x01, 0x04, 0x04, 0x00, 0x01, 0x01, 0x04, 0x01, 0x00,
+0x05, 0x01, 0x00, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x25, 0x04, 0x02,
+0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x0d, 0x03, 0x00, 0x01, 0x03, 0x01,
+0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x04, 0x00, 0x2b, 0x08,
+0x02, 0x01, 0x00, 0x04, 0x02, 0x05, 0x02, 0x01, 0x02, 0x01, 0x00, 0x04,
+0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x04, 0x00, 0x13, 0x02, 0x02, 0x01,
+0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x05, 0x00, 0x00,
+0x12, 0x00, 0x00, 0x00, 0x04, 0x00, 0x2d, 0x06, 0x04, 0x01, 0x07, 0x01,
+0x04, 0x02, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00,
+0x05, 0x01, 0x01, 0x0f, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0x00,
+0x2b, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x0d, 0x02, 0x01, 0x04,
+0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x00, 0x10, 0x00,
+0x00, 0x00, 0x04, 0x00, 0x21, 0x04, 0x02, 0x01, 0x00, 0x04, 0x02, 0x0c,
+0x02, 0x0d, 0x03, 0x00, 0x01, 0x03, 0x01, 0x00, 0x05, 0x00, 0x00, 0x12,
+0x00, 0x00, 0x00, 0x04, 0x00, 0x27, 0x06, 0x04, 0x01, 0x0b, 0x01, 0x04,
+0x02, 0x01, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04,
+0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x02, 0x04, 0x01,
+0x01, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x03, 0x02,
+0x00, 0x08, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x01, 0x01, 0x01,
+0x01, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x02, 0x00,
+0x00, 0x04, 0x01, 0x00, 0x01, 0x0a, 0x02, 0x01, 0x02, 0x02, 0x00, 0x04,
+0x02, 0x01, 0x13, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63,
+0x61, 0x64, 0x72, 0x00, 0x02, 0x00, 0x00, 0x05, 0x00, 0x00, 0x02, 0x06,
+0x00, 0x00, 0x02, 0x01, 0x01, 0x04, 0x02, 0x0f, 0x02, 0x01, 0x02, 0x03,
+0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x07, 0x00, 0x00,
+0x00, 0x73, 0x79, 0x6d, 0x62, 0x6f, 0x6c, 0x3f, 0x00, 0x06, 0x00, 0x00,
+0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x01, 0x02, 0x01, 0x00, 0x05,
+0x01, 0x02, 0x23, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63,
+0x6f, 0x6e, 0x73, 0x00, 0x02, 0x05, 0x00, 0x00, 0x00, 0x6e, 0x75, 0x6c,
+0x6c, 0x3f, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x13, 0x00, 0x06,
+0x00, 0x00, 0x04, 0x01, 0x01, 0x01, 0x04, 0x02, 0x01, 0x03, 0x09, 0x03,
+0x01, 0x03, 0x06, 0x00, 0x01, 0x02, 0x01, 0x00, 0x04, 0x02, 0x01, 0x02,
+0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x02, 0x23, 0x00, 0x00, 0x00, 0x02,
+0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x02, 0x03, 0x00,
+0x00, 0x00, 0x63, 0x64, 0x72, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00,
+0x13, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x02, 0x01, 0x04, 0x02, 0x02,
+0x03, 0x0a, 0x03, 0x01, 0x03, 0x06, 0x00, 0x01, 0x02, 0x01, 0x00, 0x04,
+0x02, 0x02, 0x02, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0f, 0x00,
+0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x06, 0x00, 0x00,
+0x02, 0x01, 0x00, 0x0d, 0x02, 0x01, 0x04, 0x03, 0x03, 0x03, 0x01, 0x03,
+0x01, 0x00, 0x05, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x04, 0x00, 0x05,
+0x02, 0x04, 0x01, 0x04, 0x01, 0x04, 0x02, 0x01, 0x01, 0x04, 0x03, 0x00,
+0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00,
+0x04, 0x00, 0x01, 0x02, 0x04, 0x01, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01,
+0x0d, 0x03, 0x00, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x00, 0x11, 0x00,
+0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x01, 0x0c, 0x01, 0x04, 0x02, 0x01,
+0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x03, 0x00, 0x03, 0x01, 0x01,
+0x08, 0x00, 0x00, 0x00, 0x02, 0x0e, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x6b,
+0x65, 0x2d, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x00,
+0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x01, 0x01, 0x01, 0x00, 0x03, 0x01,
+0x01, 0x08, 0x00, 0x00, 0x00, 0x02, 0x1b, 0x00, 0x00, 0x00, 0x63, 0x75,
+0x72, 0x72, 0x65, 0x6e, 0x74, 0x2d, 0x64, 0x79, 0x6e, 0x61, 0x6d, 0x69,
+0x63, 0x2d, 0x65, 0x6e, 0x76, 0x69, 0x72, 0x6f, 0x6e, 0x6d, 0x65, 0x6e,
+0x74, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x01, 0x01, 0x01, 0x00,
+0x05, 0x02, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x01,
+0x01, 0x04, 0x02, 0x01, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x03,
+0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00,
+0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
+0x04, 0x02, 0x00, 0x02, 0x04, 0x03, 0x00, 0x03, 0x01, 0x03, 0x01, 0x00,
+0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x1b, 0x00, 0x00, 0x00,
+0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x2d, 0x64, 0x79, 0x6e, 0x61,
+0x6d, 0x69, 0x63, 0x2d, 0x65, 0x6e, 0x76, 0x69, 0x72, 0x6f, 0x6e, 0x6d,
+0x65, 0x6e, 0x74, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
+0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0b, 0x00, 0x00,
+0x00, 0x04, 0x00, 0x1a, 0x0d, 0x02, 0x01, 0x00, 0x0b, 0x02, 0x01, 0x02,
+0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00,
+0x00, 0x00, 0x63, 0x61, 0x64, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
+0x00, 0x04, 0x02, 0x15, 0x02, 0x01, 0x02, 0x01, 0x00, 0x03, 0x01, 0x00,
+0x09, 0x00, 0x00, 0x00, 0x04, 0x00, 0x1c, 0x0e, 0x02, 0x01, 0x00, 0x01,
+0x01, 0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04,
+0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02,
+0x01, 0x00, 0x04, 0x02, 0x01, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03,
+0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x04, 0x00, 0x1e,
+0x0e, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00,
+0x04, 0x01, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x04, 0x00, 0x1f, 0x0c, 0x02,
+0x01, 0x00, 0x0b, 0x02, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0b,
+0x00, 0x00, 0x00, 0x04, 0x00, 0x20, 0x0b, 0x02, 0x01, 0x00, 0x0b, 0x02,
+0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x04,
+0x00, 0x26, 0x09, 0x02, 0x01, 0x00, 0x04, 0x02, 0x1b, 0x02, 0x01, 0x02,
+0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x04, 0x00, 0x22,
+0x03, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00,
+0x03, 0x01, 0x00, 0x09, 0x00, 0x00, 0x00, 0x04, 0x00, 0x23, 0x0d, 0x02,
+0x01, 0x00, 0x01, 0x01, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00,
+0x00, 0x02, 0x07, 0x00, 0x00, 0x00, 0x72, 0x65, 0x76, 0x65, 0x72, 0x73,
+0x65, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01,
+0x01, 0x02, 0x01, 0x00, 0x03, 0x01, 0x00, 0x09, 0x00, 0x00, 0x00, 0x04,
+0x00, 0x25, 0x0c, 0x02, 0x01, 0x00, 0x01, 0x01, 0x01, 0x00, 0x04, 0x01,
+0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x07, 0x00, 0x00, 0x00, 0x72, 0x65,
+0x76, 0x65, 0x72, 0x73, 0x65, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
+0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x03, 0x01, 0x00, 0x09,
+0x00, 0x00, 0x00, 0x04, 0x00, 0x27, 0x0b, 0x02, 0x01, 0x00, 0x01, 0x01,
+0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x07, 0x00,
+0x00, 0x00, 0x72, 0x65, 0x76, 0x65, 0x72, 0x73, 0x65, 0x00, 0x06, 0x00,
+0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00,
+0x08, 0x01, 0x01, 0x1c, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00,
+0x6c, 0x69, 0x73, 0x74, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
+0x02, 0x04, 0x01, 0x04, 0x03, 0x02, 0x01, 0x04, 0x04, 0x00, 0x01, 0x04,
+0x05, 0x14, 0x03, 0x04, 0x06, 0x14, 0x02, 0x01, 0x06, 0x01, 0x00, 0x04,
+0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x01, 0x12,
+0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x02, 0x00, 0x04, 0x01, 0x01,
+0x0c, 0x00, 0x00, 0x00, 0x02, 0x1b, 0x00, 0x00, 0x00, 0x63, 0x75, 0x72,
 0x72, 0x65, 0x6e, 0x74, 0x2d, 0x64, 0x79, 0x6e, 0x61, 0x6d, 0x69, 0x63,
 0x2d, 0x65, 0x6e, 0x76, 0x69, 0x72, 0x6f, 0x6e, 0x6d, 0x65, 0x6e, 0x74,
-0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x01, 0x01, 0x01, 0x00, 0x05,
-0x02, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x01, 0x01,
+0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x13, 0x03, 0x01,
+0x02, 0x01, 0x00, 0x03, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x04, 0x00,
+0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x00, 0x04, 0x01,
+0x00, 0x0d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x01, 0x03, 0x01,
+0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x02, 0x00, 0x04, 0x01, 0x00, 0x0d,
+0x00, 0x00, 0x00, 0x04, 0x00, 0x19, 0x09, 0x02, 0x01, 0x00, 0x04, 0x02,
+0x00, 0x02, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00,
+0x00, 0x02, 0x00, 0x00, 0x04, 0x01, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01,
+0x01, 0x02, 0x02, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x02,
+0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00,
+0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x0b, 0x03, 0x01, 0x03, 0x01,
+0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00,
+0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
+0x04, 0x02, 0x16, 0x03, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00,
+0x05, 0x01, 0x02, 0x0f, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00,
+0x63, 0x6f, 0x6e, 0x73, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x50, 0x52,
+0x4f, 0x43, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x03, 0x02, 0x01,
+0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x00, 0x00, 0x0e,
+0x00, 0x00, 0x00, 0x04, 0x00, 0x1e, 0x0a, 0x04, 0x01, 0x03, 0x01, 0x04,
+0x02, 0x00, 0x01, 0x01, 0x02, 0x02, 0x00, 0x03, 0x01, 0x01, 0x08, 0x00,
+0x00, 0x00, 0x02, 0x0e, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x6b, 0x65, 0x2d,
+0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x00, 0x06, 0x00,
+0x00, 0x02, 0x01, 0x00, 0x01, 0x01, 0x01, 0x00, 0x03, 0x01, 0x01, 0x08,
+0x00, 0x00, 0x00, 0x02, 0x1b, 0x00, 0x00, 0x00, 0x63, 0x75, 0x72, 0x72,
+0x65, 0x6e, 0x74, 0x2d, 0x64, 0x79, 0x6e, 0x61, 0x6d, 0x69, 0x63, 0x2d,
+0x65, 0x6e, 0x76, 0x69, 0x72, 0x6f, 0x6e, 0x6d, 0x65, 0x6e, 0x74, 0x00,
+0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x01, 0x01, 0x01, 0x00, 0x05, 0x01,
+0x00, 0x11, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x01, 0x02, 0x01,
 0x04, 0x02, 0x01, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x03, 0x00,
 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00,
 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
@@ -3863,449 +4328,353 @@ static const unsigned char eval_rom[] = {
 0x69, 0x63, 0x2d, 0x65, 0x6e, 0x76, 0x69, 0x72, 0x6f, 0x6e, 0x6d, 0x65,
 0x6e, 0x74, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00,
 0x01, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0b, 0x00, 0x00, 0x00,
-0x04, 0x00, 0x18, 0x0b, 0x02, 0x01, 0x00, 0x0b, 0x02, 0x01, 0x02, 0x01,
-0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00,
-0x00, 0x63, 0x61, 0x64, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
-0x04, 0x02, 0x13, 0x02, 0x01, 0x02, 0x01, 0x00, 0x03, 0x01, 0x00, 0x09,
-0x00, 0x00, 0x00, 0x04, 0x00, 0x1a, 0x0c, 0x02, 0x01, 0x00, 0x01, 0x01,
-0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00,
-0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
-0x00, 0x04, 0x02, 0x01, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01,
-0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x04, 0x00, 0x1c, 0x0c,
-0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x04,
-0x01, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x04, 0x00, 0x1d, 0x0a, 0x02, 0x01,
-0x00, 0x0b, 0x02, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0b, 0x00,
-0x00, 0x00, 0x04, 0x00, 0x1e, 0x09, 0x02, 0x01, 0x00, 0x0b, 0x02, 0x01,
-0x02, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x04, 0x00,
-0x24, 0x08, 0x02, 0x01, 0x00, 0x04, 0x02, 0x19, 0x02, 0x01, 0x02, 0x01,
-0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x04, 0x00, 0x20, 0x03,
-0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x03,
-0x01, 0x00, 0x09, 0x00, 0x00, 0x00, 0x04, 0x00, 0x21, 0x0b, 0x02, 0x01,
+0x04, 0x00, 0x0b, 0x0d, 0x02, 0x01, 0x00, 0x0b, 0x02, 0x01, 0x02, 0x01,
+0x00, 0x04, 0x01, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0c, 0x0e,
+0x02, 0x01, 0x00, 0x0b, 0x02, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x00,
+0x0b, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0d, 0x0c, 0x02, 0x01, 0x00, 0x0b,
+0x02, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0b, 0x00, 0x00, 0x00,
+0x04, 0x00, 0x0e, 0x0b, 0x02, 0x01, 0x00, 0x0b, 0x02, 0x01, 0x02, 0x01,
+0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0f, 0x03,
+0x02, 0x01, 0x00, 0x04, 0x02, 0x09, 0x02, 0x01, 0x02, 0x01, 0x00, 0x03,
+0x01, 0x00, 0x09, 0x00, 0x00, 0x00, 0x04, 0x00, 0x10, 0x0c, 0x02, 0x01,
 0x00, 0x01, 0x01, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00,
-0x02, 0x07, 0x00, 0x00, 0x00, 0x72, 0x65, 0x76, 0x65, 0x72, 0x73, 0x65,
-0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01,
-0x02, 0x01, 0x00, 0x03, 0x01, 0x00, 0x09, 0x00, 0x00, 0x00, 0x04, 0x00,
-0x23, 0x0a, 0x02, 0x01, 0x00, 0x01, 0x01, 0x01, 0x00, 0x04, 0x01, 0x01,
-0x0c, 0x00, 0x00, 0x00, 0x02, 0x07, 0x00, 0x00, 0x00, 0x72, 0x65, 0x76,
-0x65, 0x72, 0x73, 0x65, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
-0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x03, 0x01, 0x00, 0x09, 0x00,
-0x00, 0x00, 0x04, 0x00, 0x25, 0x09, 0x02, 0x01, 0x00, 0x01, 0x01, 0x01,
-0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x07, 0x00, 0x00,
-0x00, 0x72, 0x65, 0x76, 0x65, 0x72, 0x73, 0x65, 0x00, 0x06, 0x00, 0x00,
-0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x08,
-0x01, 0x01, 0x1c, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x6c,
-0x69, 0x73, 0x74, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
-0x04, 0x01, 0x04, 0x03, 0x02, 0x01, 0x04, 0x04, 0x00, 0x01, 0x04, 0x05,
-0x14, 0x03, 0x04, 0x06, 0x14, 0x02, 0x01, 0x06, 0x01, 0x00, 0x04, 0x01,
-0x00, 0x0d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x01, 0x12, 0x01,
-0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x02, 0x00, 0x04, 0x01, 0x01, 0x0c,
-0x00, 0x00, 0x00, 0x02, 0x1b, 0x00, 0x00, 0x00, 0x63, 0x75, 0x72, 0x72,
-0x65, 0x6e, 0x74, 0x2d, 0x64, 0x79, 0x6e, 0x61, 0x6d, 0x69, 0x63, 0x2d,
-0x65, 0x6e, 0x76, 0x69, 0x72, 0x6f, 0x6e, 0x6d, 0x65, 0x6e, 0x74, 0x00,
-0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x13, 0x03, 0x01, 0x02,
-0x01, 0x00, 0x03, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01,
-0x01, 0x04, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x00, 0x04, 0x01, 0x00,
-0x0d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x01, 0x03, 0x01, 0x04,
-0x02, 0x00, 0x01, 0x01, 0x02, 0x02, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00,
-0x00, 0x00, 0x04, 0x00, 0x17, 0x07, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00,
+0x02, 0x03, 0x00, 0x00, 0x00, 0x63, 0x61, 0x72, 0x00, 0x06, 0x00, 0x00,
+0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x04,
+0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x01, 0x09,
+0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x02, 0x00, 0x04, 0x01, 0x01,
+0x0c, 0x00, 0x00, 0x00, 0x02, 0x1b, 0x00, 0x00, 0x00, 0x63, 0x75, 0x72,
+0x72, 0x65, 0x6e, 0x74, 0x2d, 0x64, 0x79, 0x6e, 0x61, 0x6d, 0x69, 0x63,
+0x2d, 0x65, 0x6e, 0x76, 0x69, 0x72, 0x6f, 0x6e, 0x6d, 0x65, 0x6e, 0x74,
+0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x0a, 0x03, 0x01,
+0x02, 0x01, 0x00, 0x03, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x04, 0x00,
+0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x00, 0x03, 0x01,
+0x00, 0x11, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x05, 0x00, 0x04,
+0x02, 0x04, 0x00, 0x04, 0x01, 0x02, 0x01, 0x00, 0x01, 0x01, 0x02, 0x01,
+0x06, 0x01, 0x02, 0x13, 0x00, 0x00, 0x00, 0x02, 0x05, 0x00, 0x00, 0x00,
+0x61, 0x70, 0x70, 0x6c, 0x79, 0x00, 0x02, 0x06, 0x00, 0x00, 0x00, 0x65,
+0x78, 0x70, 0x61, 0x6e, 0x64, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
+0x06, 0x02, 0x01, 0x04, 0x03, 0x00, 0x02, 0x04, 0x04, 0x00, 0x03, 0x01,
+0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x04, 0x00,
+0x06, 0x04, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01,
+0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x04, 0x00, 0x07, 0x03,
+0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x04,
+0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x04, 0x00, 0x08, 0x02, 0x02, 0x01,
+0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x04, 0x00, 0x01,
+0x0d, 0x00, 0x00, 0x00, 0x02, 0x0e, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x6b,
+0x65, 0x2d, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x75, 0x72, 0x65, 0x00,
+0x06, 0x00, 0x00, 0x04, 0x01, 0x04, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01,
+0x02, 0x02, 0x00, 0x03, 0x00, 0x01, 0x0f, 0x00, 0x00, 0x00, 0x02, 0x07,
+0x00, 0x00, 0x00, 0x63, 0x6f, 0x6d, 0x70, 0x69, 0x6c, 0x65, 0x00, 0x04,
+0x00, 0x00, 0x02, 0x07, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x0c, 0x01,
+0x01, 0x01, 0x01, 0x00, 0x03, 0x01, 0x00, 0x09, 0x00, 0x00, 0x00, 0x02,
+0x00, 0x00, 0x04, 0x01, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x1d, 0x01,
+0x00, 0x3d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x01, 0x00, 0x01,
+0x0a, 0x02, 0x0a, 0x03, 0x0a, 0x04, 0x0a, 0x05, 0x0a, 0x06, 0x0a, 0x07,
+0x0a, 0x08, 0x0a, 0x09, 0x0a, 0x0a, 0x0a, 0x0b, 0x0a, 0x0c, 0x0a, 0x0d,
+0x0a, 0x0e, 0x0a, 0x0f, 0x0a, 0x10, 0x0a, 0x11, 0x0a, 0x12, 0x0a, 0x13,
+0x0a, 0x14, 0x0a, 0x15, 0x0a, 0x16, 0x0a, 0x17, 0x0a, 0x18, 0x0a, 0x19,
+0x0a, 0x1a, 0x0a, 0x1b, 0x01, 0x1b, 0x1b, 0x00, 0x05, 0x01, 0x02, 0x0d,
+0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73,
+0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x65, 0x6e, 0x76, 0x00, 0x06, 0x00,
+0x00, 0x02, 0x01, 0x00, 0x03, 0x02, 0x01, 0x0b, 0x03, 0x01, 0x03, 0x01,
+0x00, 0x05, 0x01, 0x02, 0x0f, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00,
+0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x6e,
+0x61, 0x6d, 0x65, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x03, 0x02,
+0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x02,
+0x0f, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x6b,
+0x65, 0x2d, 0x72, 0x65, 0x63, 0x6f, 0x72, 0x64, 0x2d, 0x74, 0x79, 0x70,
+0x65, 0x00, 0x02, 0x0a, 0x00, 0x00, 0x00, 0x69, 0x64, 0x65, 0x6e, 0x74,
+0x69, 0x66, 0x69, 0x65, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
+0x03, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04,
+0x02, 0x00, 0x14, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x05, 0x00,
+0x03, 0x1b, 0x02, 0x00, 0x00, 0x02, 0x01, 0x01, 0x04, 0x02, 0x03, 0x1b,
+0x01, 0x02, 0x02, 0x00, 0x03, 0x01, 0x00, 0x09, 0x00, 0x00, 0x00, 0x04,
+0x00, 0x00, 0x01, 0x02, 0x01, 0x00, 0x01, 0x01, 0x02, 0x00, 0x05, 0x00,
+0x01, 0x11, 0x00, 0x00, 0x00, 0x02, 0x07, 0x00, 0x00, 0x00, 0x72, 0x65,
+0x63, 0x6f, 0x72, 0x64, 0x3f, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x00,
+0x01, 0x04, 0x02, 0x00, 0x02, 0x04, 0x03, 0x01, 0x02, 0x01, 0x03, 0x01,
+0x00, 0x04, 0x02, 0x00, 0x14, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01,
+0x05, 0x00, 0x04, 0x1a, 0x02, 0x00, 0x00, 0x02, 0x01, 0x01, 0x04, 0x02,
+0x04, 0x1b, 0x01, 0x02, 0x02, 0x00, 0x03, 0x01, 0x00, 0x09, 0x00, 0x00,
+0x00, 0x04, 0x00, 0x00, 0x01, 0x02, 0x01, 0x00, 0x01, 0x01, 0x02, 0x00,
+0x03, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x04,
+0x01, 0x00, 0x02, 0x04, 0x02, 0x01, 0x02, 0x0e, 0x01, 0x01, 0x01, 0x01,
+0x01, 0x00, 0x04, 0x02, 0x00, 0x14, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
+0x01, 0x05, 0x00, 0x05, 0x19, 0x02, 0x00, 0x00, 0x02, 0x01, 0x01, 0x04,
+0x02, 0x05, 0x1b, 0x01, 0x02, 0x02, 0x00, 0x03, 0x01, 0x00, 0x09, 0x00,
+0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x02, 0x01, 0x00, 0x01, 0x01, 0x02,
+0x00, 0x03, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01,
+0x04, 0x01, 0x00, 0x02, 0x04, 0x02, 0x01, 0x02, 0x0e, 0x01, 0x00, 0x01,
+0x01, 0x01, 0x00, 0x04, 0x02, 0x00, 0x14, 0x00, 0x00, 0x00, 0x04, 0x00,
+0x00, 0x01, 0x05, 0x00, 0x06, 0x18, 0x02, 0x00, 0x00, 0x02, 0x01, 0x01,
+0x04, 0x02, 0x06, 0x1b, 0x01, 0x02, 0x02, 0x00, 0x03, 0x01, 0x00, 0x09,
+0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x02, 0x01, 0x00, 0x01, 0x01,
+0x03, 0x00, 0x06, 0x00, 0x01, 0x15, 0x00, 0x00, 0x00, 0x02, 0x0b, 0x00,
+0x00, 0x00, 0x6d, 0x61, 0x6b, 0x65, 0x2d, 0x72, 0x65, 0x63, 0x6f, 0x72,
+0x64, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x00, 0x01, 0x04, 0x02, 0x01,
+0x02, 0x04, 0x03, 0x00, 0x02, 0x04, 0x04, 0x00, 0x03, 0x01, 0x04, 0x01,
+0x00, 0x04, 0x04, 0x01, 0x21, 0x00, 0x00, 0x00, 0x02, 0x06, 0x00, 0x00,
+0x00, 0x65, 0x71, 0x75, 0x61, 0x6c, 0x3f, 0x00, 0x04, 0x00, 0x00, 0x01,
+0x05, 0x00, 0x07, 0x17, 0x02, 0x00, 0x00, 0x05, 0x00, 0x07, 0x16, 0x02,
+0x00, 0x01, 0x05, 0x00, 0x07, 0x15, 0x02, 0x00, 0x02, 0x02, 0x01, 0x03,
+0x06, 0x02, 0x00, 0x01, 0x02, 0x02, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00,
+0x00, 0x00, 0x02, 0x07, 0x00, 0x00, 0x00, 0x73, 0x79, 0x6d, 0x62, 0x6f,
+0x6c, 0x3f, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00,
 0x02, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00,
 0x02, 0x00, 0x00, 0x04, 0x01, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01,
-0x02, 0x02, 0x00, 0x05, 0x01, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x04,
-0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02,
-0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00,
-0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00,
-0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
-0x02, 0x14, 0x03, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05,
-0x01, 0x02, 0x0f, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63,
-0x6f, 0x6e, 0x73, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x50, 0x52, 0x4f,
-0x43, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x03, 0x02, 0x01, 0x04,
-0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x00, 0x00, 0x0e, 0x00,
-0x00, 0x00, 0x04, 0x00, 0x1c, 0x08, 0x04, 0x01, 0x03, 0x01, 0x04, 0x02,
-0x00, 0x01, 0x01, 0x02, 0x02, 0x00, 0x03, 0x01, 0x01, 0x08, 0x00, 0x00,
-0x00, 0x02, 0x0e, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x6b, 0x65, 0x2d, 0x61,
-0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x00, 0x06, 0x00, 0x00,
-0x02, 0x01, 0x00, 0x01, 0x01, 0x01, 0x00, 0x03, 0x01, 0x01, 0x08, 0x00,
-0x00, 0x00, 0x02, 0x1b, 0x00, 0x00, 0x00, 0x63, 0x75, 0x72, 0x72, 0x65,
-0x6e, 0x74, 0x2d, 0x64, 0x79, 0x6e, 0x61, 0x6d, 0x69, 0x63, 0x2d, 0x65,
-0x6e, 0x76, 0x69, 0x72, 0x6f, 0x6e, 0x6d, 0x65, 0x6e, 0x74, 0x00, 0x06,
-0x00, 0x00, 0x02, 0x01, 0x00, 0x01, 0x01, 0x01, 0x00, 0x05, 0x01, 0x00,
-0x11, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x01, 0x02, 0x01, 0x04,
-0x02, 0x01, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x03, 0x00, 0x05,
-0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63,
-0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
-0x00, 0x02, 0x04, 0x03, 0x00, 0x03, 0x01, 0x03, 0x01, 0x00, 0x04, 0x01,
-0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x1b, 0x00, 0x00, 0x00, 0x63, 0x75,
-0x72, 0x72, 0x65, 0x6e, 0x74, 0x2d, 0x64, 0x79, 0x6e, 0x61, 0x6d, 0x69,
-0x63, 0x2d, 0x65, 0x6e, 0x76, 0x69, 0x72, 0x6f, 0x6e, 0x6d, 0x65, 0x6e,
-0x74, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01,
-0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x04,
-0x00, 0x0b, 0x0b, 0x02, 0x01, 0x00, 0x0b, 0x02, 0x01, 0x02, 0x01, 0x00,
-0x04, 0x01, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0c, 0x0c, 0x02,
-0x01, 0x00, 0x0b, 0x02, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0b,
-0x00, 0x00, 0x00, 0x04, 0x00, 0x0d, 0x0a, 0x02, 0x01, 0x00, 0x0b, 0x02,
-0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x04,
-0x00, 0x0e, 0x09, 0x02, 0x01, 0x00, 0x0b, 0x02, 0x01, 0x02, 0x01, 0x00,
-0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0f, 0x03, 0x02,
-0x01, 0x00, 0x04, 0x02, 0x09, 0x02, 0x01, 0x02, 0x01, 0x00, 0x03, 0x01,
-0x00, 0x09, 0x00, 0x00, 0x00, 0x04, 0x00, 0x10, 0x0a, 0x02, 0x01, 0x00,
-0x01, 0x01, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02,
-0x03, 0x00, 0x00, 0x00, 0x63, 0x61, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02,
-0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01,
-0x00, 0x0d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x01, 0x09, 0x01,
-0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x02, 0x00, 0x04, 0x01, 0x01, 0x0c,
-0x00, 0x00, 0x00, 0x02, 0x1b, 0x00, 0x00, 0x00, 0x63, 0x75, 0x72, 0x72,
-0x65, 0x6e, 0x74, 0x2d, 0x64, 0x79, 0x6e, 0x61, 0x6d, 0x69, 0x63, 0x2d,
-0x65, 0x6e, 0x76, 0x69, 0x72, 0x6f, 0x6e, 0x6d, 0x65, 0x6e, 0x74, 0x00,
-0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x0a, 0x03, 0x01, 0x02,
-0x01, 0x00, 0x03, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01,
-0x01, 0x04, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x00, 0x03, 0x01, 0x00,
-0x11, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x05, 0x00, 0x04, 0x02,
-0x04, 0x00, 0x04, 0x01, 0x02, 0x01, 0x00, 0x01, 0x01, 0x02, 0x01, 0x06,
-0x01, 0x02, 0x13, 0x00, 0x00, 0x00, 0x02, 0x05, 0x00, 0x00, 0x00, 0x61,
-0x70, 0x70, 0x6c, 0x79, 0x00, 0x02, 0x06, 0x00, 0x00, 0x00, 0x65, 0x78,
-0x70, 0x61, 0x6e, 0x64, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x06,
-0x02, 0x01, 0x04, 0x03, 0x00, 0x02, 0x04, 0x04, 0x00, 0x03, 0x01, 0x04,
-0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x04, 0x00, 0x06,
-0x04, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00,
-0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x04, 0x00, 0x07, 0x03, 0x02,
-0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01,
-0x00, 0x0d, 0x00, 0x00, 0x00, 0x04, 0x00, 0x08, 0x02, 0x02, 0x01, 0x00,
-0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x04, 0x00, 0x01, 0x0d,
-0x00, 0x00, 0x00, 0x02, 0x0e, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x6b, 0x65,
-0x2d, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x75, 0x72, 0x65, 0x00, 0x06,
-0x00, 0x00, 0x04, 0x01, 0x04, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02,
-0x02, 0x00, 0x03, 0x00, 0x01, 0x0f, 0x00, 0x00, 0x00, 0x02, 0x07, 0x00,
-0x00, 0x00, 0x63, 0x6f, 0x6d, 0x70, 0x69, 0x6c, 0x65, 0x00, 0x04, 0x00,
-0x00, 0x02, 0x07, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x0c, 0x01, 0x01,
-0x01, 0x01, 0x00, 0x03, 0x01, 0x00, 0x09, 0x00, 0x00, 0x00, 0x02, 0x00,
-0x00, 0x04, 0x01, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x1b, 0x01, 0x00,
-0x39, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x01, 0x00, 0x01, 0x0a,
-0x02, 0x0a, 0x03, 0x0a, 0x04, 0x0a, 0x05, 0x0a, 0x06, 0x0a, 0x07, 0x0a,
-0x08, 0x0a, 0x09, 0x0a, 0x0a, 0x0a, 0x0b, 0x0a, 0x0c, 0x0a, 0x0d, 0x0a,
-0x0e, 0x0a, 0x0f, 0x0a, 0x10, 0x0a, 0x11, 0x0a, 0x12, 0x0a, 0x13, 0x0a,
-0x14, 0x0a, 0x15, 0x0a, 0x16, 0x0a, 0x17, 0x0a, 0x18, 0x0a, 0x19, 0x01,
-0x19, 0x19, 0x00, 0x04, 0x08, 0x01, 0x35, 0x00, 0x00, 0x00, 0x02, 0x06,
-0x00, 0x00, 0x00, 0x65, 0x71, 0x75, 0x61, 0x6c, 0x3f, 0x00, 0x02, 0x00,
-0x00, 0x05, 0x00, 0x00, 0x19, 0x02, 0x00, 0x01, 0x05, 0x00, 0x00, 0x18,
-0x02, 0x00, 0x02, 0x05, 0x00, 0x00, 0x17, 0x02, 0x00, 0x03, 0x05, 0x00,
-0x00, 0x16, 0x02, 0x00, 0x04, 0x05, 0x00, 0x00, 0x15, 0x02, 0x00, 0x05,
-0x05, 0x00, 0x00, 0x14, 0x02, 0x00, 0x06, 0x02, 0x01, 0x07, 0x06, 0x02,
-0x00, 0x01, 0x02, 0x03, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00,
-0x02, 0x06, 0x00, 0x00, 0x00, 0x76, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x00,
-0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x04, 0x03,
-0x00, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x00, 0x02, 0x10, 0x00, 0x00,
-0x00, 0x02, 0x0b, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x6b, 0x65, 0x2d, 0x72,
-0x65, 0x63, 0x6f, 0x72, 0x64, 0x00, 0x02, 0x0a, 0x00, 0x00, 0x00, 0x69,
-0x64, 0x65, 0x6e, 0x74, 0x69, 0x66, 0x69, 0x65, 0x72, 0x00, 0x06, 0x00,
-0x00, 0x04, 0x01, 0x01, 0x01, 0x03, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01,
-0x01, 0x03, 0x02, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02,
-0x07, 0x00, 0x00, 0x00, 0x72, 0x65, 0x63, 0x6f, 0x72, 0x64, 0x3f, 0x00,
-0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x01, 0x02,
-0x01, 0x00, 0x04, 0x01, 0x01, 0x1c, 0x00, 0x00, 0x00, 0x02, 0x0b, 0x00,
-0x00, 0x00, 0x72, 0x65, 0x63, 0x6f, 0x72, 0x64, 0x2d, 0x74, 0x79, 0x70,
-0x65, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x10, 0x00, 0x06, 0x00,
-0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x01, 0x02, 0x01, 0x02, 0x04, 0x00,
-0x01, 0x01, 0x0a, 0x01, 0x01, 0x01, 0x01, 0x00, 0x05, 0x00, 0x02, 0x10,
-0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x65, 0x71, 0x3f, 0x00,
-0x02, 0x0a, 0x00, 0x00, 0x00, 0x69, 0x64, 0x65, 0x6e, 0x74, 0x69, 0x66,
-0x69, 0x65, 0x72, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x02, 0x01, 0x04,
-0x02, 0x00, 0x01, 0x03, 0x03, 0x01, 0x01, 0x03, 0x02, 0x00, 0x04, 0x01,
-0x00, 0x0d, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x18, 0x02, 0x01, 0x00,
-0x04, 0x02, 0x00, 0x02, 0x01, 0x02, 0x01, 0x00, 0x06, 0x01, 0x04, 0x27,
-0x00, 0x00, 0x00, 0x02, 0x0c, 0x00, 0x00, 0x00, 0x72, 0x65, 0x63, 0x6f,
-0x72, 0x64, 0x2d, 0x64, 0x61, 0x74, 0x75, 0x6d, 0x00, 0x02, 0x05, 0x00,
-0x00, 0x00, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x00, 0x01, 0x14, 0x00, 0x00,
-0x00, 0x72, 0x65, 0x63, 0x6f, 0x72, 0x64, 0x20, 0x74, 0x79, 0x70, 0x65,
-0x20, 0x6d, 0x69, 0x73, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x00, 0x02, 0x0a,
-0x00, 0x00, 0x00, 0x69, 0x64, 0x65, 0x6e, 0x74, 0x69, 0x66, 0x69, 0x65,
-0x72, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x10, 0x00, 0x06, 0x00,
-0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x01, 0x02, 0x01, 0x02, 0x06, 0x00,
-0x01, 0x04, 0x01, 0x01, 0x01, 0x03, 0x02, 0x02, 0x04, 0x03, 0x01, 0x02,
-0x03, 0x04, 0x03, 0x01, 0x04, 0x01, 0x00, 0x05, 0x00, 0x01, 0x10, 0x00,
-0x00, 0x00, 0x02, 0x0a, 0x00, 0x00, 0x00, 0x76, 0x65, 0x63, 0x74, 0x6f,
-0x72, 0x2d, 0x72, 0x65, 0x66, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x02,
-0x01, 0x04, 0x02, 0x00, 0x01, 0x0d, 0x03, 0x01, 0x01, 0x03, 0x02, 0x00,
-0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x18, 0x02,
-0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x01, 0x02, 0x01, 0x00, 0x06, 0x01,
-0x04, 0x27, 0x00, 0x00, 0x00, 0x02, 0x0c, 0x00, 0x00, 0x00, 0x72, 0x65,
-0x63, 0x6f, 0x72, 0x64, 0x2d, 0x64, 0x61, 0x74, 0x75, 0x6d, 0x00, 0x02,
-0x05, 0x00, 0x00, 0x00, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x00, 0x01, 0x14,
-0x00, 0x00, 0x00, 0x72, 0x65, 0x63, 0x6f, 0x72, 0x64, 0x20, 0x74, 0x79,
-0x70, 0x65, 0x20, 0x6d, 0x69, 0x73, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x00,
-0x02, 0x0a, 0x00, 0x00, 0x00, 0x69, 0x64, 0x65, 0x6e, 0x74, 0x69, 0x66,
-0x69, 0x65, 0x72, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x10, 0x00,
-0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x01, 0x02, 0x01, 0x02,
-0x06, 0x00, 0x01, 0x04, 0x01, 0x01, 0x01, 0x03, 0x02, 0x02, 0x04, 0x03,
-0x01, 0x02, 0x03, 0x04, 0x03, 0x01, 0x04, 0x01, 0x00, 0x05, 0x00, 0x01,
-0x10, 0x00, 0x00, 0x00, 0x02, 0x0a, 0x00, 0x00, 0x00, 0x76, 0x65, 0x63,
-0x74, 0x6f, 0x72, 0x2d, 0x72, 0x65, 0x66, 0x00, 0x06, 0x00, 0x00, 0x04,
-0x01, 0x02, 0x01, 0x04, 0x02, 0x00, 0x01, 0x0d, 0x03, 0x00, 0x01, 0x03,
-0x02, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x07, 0x00,
-0x00, 0x00, 0x73, 0x79, 0x6d, 0x62, 0x6f, 0x6c, 0x3f, 0x00, 0x06, 0x00,
-0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x01, 0x02, 0x01, 0x00,
-0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x01,
-0x01, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x02, 0x00, 0x04, 0x01,
-0x00, 0x1f, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x02, 0x08, 0x00, 0x0e,
-0x00, 0x04, 0x00, 0x00, 0x01, 0x04, 0x01, 0x00, 0x02, 0x01, 0x01, 0x04,
-0x00, 0x03, 0x18, 0x02, 0x01, 0x00, 0x04, 0x02, 0x02, 0x02, 0x01, 0x02,
+0x02, 0x02, 0x00, 0x04, 0x01, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x04, 0x00,
+0x00, 0x02, 0x08, 0x00, 0x0e, 0x00, 0x04, 0x00, 0x00, 0x01, 0x04, 0x01,
+0x00, 0x02, 0x01, 0x01, 0x04, 0x00, 0x0a, 0x1a, 0x02, 0x01, 0x00, 0x04,
+0x02, 0x02, 0x02, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00,
+0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x01, 0x01, 0x01, 0x04, 0x02, 0x00,
+0x01, 0x01, 0x02, 0x02, 0x00, 0x03, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00,
+0x04, 0x00, 0x00, 0x02, 0x08, 0x00, 0x0e, 0x00, 0x04, 0x00, 0x00, 0x01,
+0x04, 0x01, 0x00, 0x02, 0x01, 0x01, 0x04, 0x00, 0x00, 0x01, 0x0a, 0x01,
+0x01, 0x01, 0x03, 0x00, 0x03, 0x02, 0x00, 0x08, 0x00, 0x00, 0x00, 0x02,
+0x00, 0x00, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x04, 0x01, 0x01,
+0x0c, 0x00, 0x00, 0x00, 0x02, 0x07, 0x00, 0x00, 0x00, 0x73, 0x79, 0x6d,
+0x62, 0x6f, 0x6c, 0x3f, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
+0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x00, 0x04, 0x00, 0x01, 0x1d, 0x00,
+0x00, 0x00, 0x02, 0x07, 0x00, 0x00, 0x00, 0x73, 0x79, 0x6d, 0x62, 0x6f,
+0x6c, 0x3f, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x11, 0x00, 0x06,
+0x00, 0x00, 0x04, 0x01, 0x01, 0x01, 0x04, 0x02, 0x02, 0x03, 0x01, 0x02,
+0x04, 0x00, 0x01, 0x01, 0x0a, 0x01, 0x01, 0x01, 0x01, 0x00, 0x05, 0x02,
+0x01, 0x21, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x65, 0x71,
+0x3f, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x15, 0x00, 0x06, 0x00,
+0x00, 0x04, 0x01, 0x01, 0x01, 0x04, 0x02, 0x01, 0x02, 0x04, 0x03, 0x01,
+0x03, 0x01, 0x03, 0x02, 0x00, 0x00, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0a, 0x1a,
+0x02, 0x01, 0x00, 0x04, 0x02, 0x02, 0x02, 0x01, 0x02, 0x01, 0x00, 0x04,
+0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00,
+0x12, 0x00, 0x04, 0x00, 0x0b, 0x1a, 0x04, 0x01, 0x01, 0x01, 0x04, 0x02,
+0x03, 0x03, 0x01, 0x02, 0x04, 0x00, 0x01, 0x01, 0x0a, 0x01, 0x01, 0x01,
+0x01, 0x00, 0x04, 0x01, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
+0x01, 0x08, 0x00, 0x11, 0x00, 0x04, 0x00, 0x0a, 0x18, 0x02, 0x01, 0x00,
+0x04, 0x02, 0x02, 0x02, 0x01, 0x02, 0x04, 0x00, 0x02, 0x01, 0x0a, 0x01,
+0x01, 0x01, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x04,
+0x00, 0x0b, 0x19, 0x02, 0x01, 0x00, 0x04, 0x02, 0x03, 0x02, 0x01, 0x02,
+0x01, 0x00, 0x05, 0x01, 0x00, 0x11, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0c,
+0x0d, 0x02, 0x01, 0x00, 0x04, 0x02, 0x01, 0x01, 0x04, 0x03, 0x00, 0x01,
+0x01, 0x03, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x04,
+0x00, 0x0d, 0x18, 0x02, 0x01, 0x00, 0x04, 0x02, 0x05, 0x03, 0x01, 0x02,
+0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0e,
+0x19, 0x02, 0x01, 0x00, 0x04, 0x02, 0x06, 0x03, 0x01, 0x02, 0x01, 0x00,
+0x05, 0x01, 0x00, 0x11, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0f, 0x0d, 0x02,
+0x01, 0x00, 0x04, 0x02, 0x01, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03,
+0x01, 0x00, 0x05, 0x00, 0x01, 0x11, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00,
+0x00, 0x00, 0x65, 0x71, 0x3f, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x08,
+0x01, 0x04, 0x02, 0x03, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x02,
+0x00, 0x03, 0x01, 0x00, 0x09, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01,
+0x02, 0x01, 0x00, 0x01, 0x01, 0x03, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00,
+0x00, 0x00, 0x04, 0x00, 0x09, 0x1a, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00,
+0x02, 0x01, 0x02, 0x01, 0x00, 0x05, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00,
+0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x16, 0x00, 0x04, 0x00, 0x0a, 0x15,
+0x04, 0x01, 0x01, 0x01, 0x04, 0x02, 0x01, 0x02, 0x04, 0x03, 0x01, 0x03,
+0x01, 0x03, 0x04, 0x00, 0x02, 0x02, 0x04, 0x01, 0x01, 0x01, 0x04, 0x02,
+0x01, 0x02, 0x04, 0x03, 0x01, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01,
+0x03, 0x14, 0x00, 0x00, 0x00, 0x02, 0x06, 0x00, 0x00, 0x00, 0x65, 0x71,
+0x75, 0x61, 0x6c, 0x3f, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f,
+0x6e, 0x73, 0x00, 0x02, 0x07, 0x00, 0x00, 0x00, 0x62, 0x69, 0x6e, 0x64,
+0x69, 0x6e, 0x67, 0x00, 0x04, 0x00, 0x00, 0x01, 0x07, 0x00, 0x00, 0x06,
+0x00, 0x01, 0x02, 0x01, 0x00, 0x03, 0x02, 0x02, 0x0b, 0x03, 0x01, 0x03,
+0x01, 0x00, 0x05, 0x01, 0x02, 0x0f, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00,
+0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x02, 0x06, 0x00, 0x00, 0x00,
+0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
+0x00, 0x03, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00,
+0x05, 0x01, 0x02, 0x0f, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00,
+0x63, 0x6f, 0x6e, 0x73, 0x00, 0x02, 0x06, 0x00, 0x00, 0x00, 0x70, 0x61,
+0x72, 0x65, 0x6e, 0x74, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x03,
+0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01,
+0x02, 0x0f, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x00, 0x00, 0x6d, 0x61,
+0x6b, 0x65, 0x2d, 0x72, 0x65, 0x63, 0x6f, 0x72, 0x64, 0x2d, 0x74, 0x79,
+0x70, 0x65, 0x00, 0x02, 0x0b, 0x00, 0x00, 0x00, 0x65, 0x6e, 0x76, 0x69,
+0x72, 0x6f, 0x6e, 0x6d, 0x65, 0x6e, 0x74, 0x00, 0x06, 0x00, 0x00, 0x02,
+0x01, 0x00, 0x03, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01,
+0x00, 0x04, 0x02, 0x00, 0x14, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01,
+0x05, 0x00, 0x0c, 0x14, 0x02, 0x00, 0x00, 0x02, 0x01, 0x01, 0x04, 0x02,
+0x0c, 0x14, 0x01, 0x02, 0x02, 0x00, 0x03, 0x01, 0x00, 0x09, 0x00, 0x00,
+0x00, 0x04, 0x00, 0x00, 0x01, 0x02, 0x01, 0x00, 0x01, 0x01, 0x02, 0x00,
+0x05, 0x00, 0x01, 0x11, 0x00, 0x00, 0x00, 0x02, 0x07, 0x00, 0x00, 0x00,
+0x72, 0x65, 0x63, 0x6f, 0x72, 0x64, 0x3f, 0x00, 0x06, 0x00, 0x00, 0x04,
+0x01, 0x00, 0x01, 0x04, 0x02, 0x00, 0x02, 0x04, 0x03, 0x01, 0x02, 0x01,
+0x03, 0x01, 0x00, 0x04, 0x02, 0x00, 0x14, 0x00, 0x00, 0x00, 0x04, 0x00,
+0x00, 0x01, 0x05, 0x00, 0x0d, 0x13, 0x02, 0x00, 0x00, 0x02, 0x01, 0x01,
+0x04, 0x02, 0x0d, 0x14, 0x01, 0x02, 0x02, 0x00, 0x03, 0x01, 0x00, 0x09,
+0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x02, 0x01, 0x00, 0x01, 0x01,
+0x02, 0x00, 0x03, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
+0x01, 0x04, 0x01, 0x00, 0x02, 0x04, 0x02, 0x01, 0x02, 0x0e, 0x01, 0x02,
+0x01, 0x01, 0x01, 0x00, 0x04, 0x02, 0x00, 0x14, 0x00, 0x00, 0x00, 0x04,
+0x00, 0x00, 0x01, 0x05, 0x00, 0x0e, 0x12, 0x02, 0x00, 0x00, 0x02, 0x01,
+0x01, 0x04, 0x02, 0x0e, 0x14, 0x01, 0x02, 0x02, 0x00, 0x03, 0x01, 0x00,
+0x09, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x02, 0x01, 0x00, 0x01,
+0x01, 0x02, 0x00, 0x03, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x04, 0x00,
+0x00, 0x01, 0x04, 0x01, 0x00, 0x02, 0x04, 0x02, 0x01, 0x02, 0x0e, 0x01,
+0x01, 0x01, 0x01, 0x01, 0x00, 0x04, 0x02, 0x00, 0x14, 0x00, 0x00, 0x00,
+0x04, 0x00, 0x00, 0x01, 0x05, 0x00, 0x0f, 0x11, 0x02, 0x00, 0x00, 0x02,
+0x01, 0x01, 0x04, 0x02, 0x0f, 0x14, 0x01, 0x02, 0x02, 0x00, 0x03, 0x01,
+0x00, 0x09, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x02, 0x01, 0x00,
+0x01, 0x01, 0x02, 0x00, 0x03, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x04,
+0x00, 0x00, 0x01, 0x04, 0x01, 0x00, 0x02, 0x04, 0x02, 0x01, 0x02, 0x0e,
+0x01, 0x00, 0x01, 0x01, 0x01, 0x00, 0x04, 0x02, 0x00, 0x14, 0x00, 0x00,
+0x00, 0x04, 0x00, 0x00, 0x01, 0x05, 0x00, 0x10, 0x10, 0x02, 0x00, 0x00,
+0x02, 0x01, 0x01, 0x04, 0x02, 0x10, 0x14, 0x01, 0x02, 0x02, 0x00, 0x03,
+0x01, 0x00, 0x09, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x02, 0x01,
+0x00, 0x01, 0x01, 0x04, 0x00, 0x07, 0x00, 0x01, 0x19, 0x00, 0x00, 0x00,
+0x02, 0x0b, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x6b, 0x65, 0x2d, 0x72, 0x65,
+0x63, 0x6f, 0x72, 0x64, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x00, 0x01,
+0x04, 0x02, 0x01, 0x02, 0x04, 0x03, 0x00, 0x02, 0x04, 0x04, 0x00, 0x03,
+0x04, 0x05, 0x00, 0x04, 0x01, 0x05, 0x01, 0x00, 0x04, 0x04, 0x00, 0x21,
+0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x05, 0x00, 0x11, 0x0f, 0x02,
+0x00, 0x00, 0x05, 0x00, 0x11, 0x0e, 0x02, 0x00, 0x01, 0x05, 0x00, 0x11,
+0x0d, 0x02, 0x00, 0x02, 0x02, 0x01, 0x03, 0x0d, 0x02, 0x00, 0x01, 0x02,
+0x03, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x04, 0x00, 0x12,
+0x12, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x03, 0x01, 0x02, 0x01, 0x00,
+0x04, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x04,
+0x01, 0x01, 0x01, 0x04, 0x02, 0x01, 0x02, 0x01, 0x02, 0x03, 0x00, 0x05,
+0x01, 0x00, 0x11, 0x00, 0x00, 0x00, 0x04, 0x00, 0x12, 0x0e, 0x02, 0x01,
+0x00, 0x04, 0x02, 0x00, 0x02, 0x04, 0x03, 0x00, 0x03, 0x01, 0x03, 0x01,
+0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04,
+0x01, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x02, 0x00, 0x04,
+0x01, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x02, 0x08, 0x00,
+0x0e, 0x00, 0x04, 0x00, 0x00, 0x01, 0x04, 0x01, 0x00, 0x02, 0x01, 0x01,
+0x04, 0x00, 0x14, 0x10, 0x02, 0x01, 0x00, 0x04, 0x02, 0x02, 0x03, 0x01,
+0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x00,
+0x00, 0x02, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x02, 0x00,
+0x05, 0x01, 0x01, 0x26, 0x00, 0x00, 0x00, 0x02, 0x07, 0x00, 0x00, 0x00,
+0x73, 0x79, 0x6d, 0x62, 0x6f, 0x6c, 0x3f, 0x00, 0x04, 0x00, 0x00, 0x02,
+0x08, 0x00, 0x16, 0x00, 0x04, 0x00, 0x16, 0x0d, 0x04, 0x01, 0x00, 0x01,
+0x04, 0x02, 0x04, 0x02, 0x04, 0x03, 0x00, 0x02, 0x01, 0x03, 0x06, 0x00,
+0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x04, 0x02, 0x01, 0x02, 0x01, 0x00,
+0x05, 0x01, 0x00, 0x27, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08,
+0x00, 0x16, 0x00, 0x04, 0x00, 0x17, 0x0c, 0x04, 0x01, 0x01, 0x01, 0x04,
+0x02, 0x05, 0x02, 0x04, 0x03, 0x05, 0x03, 0x01, 0x03, 0x04, 0x00, 0x17,
+0x18, 0x02, 0x01, 0x00, 0x04, 0x02, 0x05, 0x02, 0x01, 0x02, 0x01, 0x00,
+0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x04, 0x00, 0x18, 0x19, 0x02,
+0x01, 0x00, 0x04, 0x02, 0x06, 0x02, 0x01, 0x02, 0x01, 0x00, 0x05, 0x00,
+0x00, 0x12, 0x00, 0x00, 0x00, 0x04, 0x00, 0x19, 0x0d, 0x04, 0x01, 0x03,
+0x01, 0x04, 0x02, 0x01, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01,
+0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04,
+0x01, 0x02, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x02, 0x00, 0x03,
+0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x02, 0x08, 0x00,
+0x0e, 0x00, 0x04, 0x00, 0x00, 0x01, 0x04, 0x01, 0x00, 0x02, 0x01, 0x01,
+0x04, 0x00, 0x00, 0x01, 0x0a, 0x01, 0x01, 0x01, 0x02, 0x00, 0x03, 0x01,
+0x00, 0x09, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x02, 0x01, 0x00,
+0x01, 0x01, 0x02, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x02,
+0x00, 0x00, 0x04, 0x01, 0x00, 0x01, 0x04, 0x02, 0x01, 0x02, 0x01, 0x02,
+0x02, 0x00, 0x05, 0x01, 0x01, 0x0f, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00,
+0x00, 0x00, 0x2b, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
+0x02, 0x02, 0x0d, 0x03, 0x01, 0x01, 0x03, 0x01, 0x00, 0x03, 0x02, 0x00,
+0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x05, 0x00, 0x03, 0x02,
+0x02, 0x00, 0x00, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x04, 0x01,
+0x00, 0x0b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x01, 0x00, 0x01,
+0x0a, 0x02, 0x01, 0x02, 0x02, 0x00, 0x04, 0x01, 0x00, 0x15, 0x00, 0x00,
+0x00, 0x02, 0x00, 0x00, 0x05, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x02,
+0x04, 0x01, 0x00, 0x01, 0x04, 0x02, 0x04, 0x02, 0x01, 0x02, 0x02, 0x00,
+0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x07, 0x00, 0x00, 0x00,
+0x73, 0x79, 0x6d, 0x62, 0x6f, 0x6c, 0x3f, 0x00, 0x06, 0x00, 0x00, 0x02,
+0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01,
+0x00, 0x1f, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x0e,
+0x00, 0x04, 0x00, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x01, 0x01, 0x04,
+0x00, 0x19, 0x18, 0x02, 0x01, 0x00, 0x04, 0x02, 0x01, 0x02, 0x01, 0x02,
+0x01, 0x00, 0x04, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x04, 0x00, 0x03,
+0x02, 0x04, 0x01, 0x02, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01,
+0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x0e, 0x00, 0x00,
+0x00, 0x73, 0x79, 0x6d, 0x62, 0x6f, 0x6c, 0x2d, 0x3e, 0x73, 0x74, 0x72,
+0x69, 0x6e, 0x67, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
+0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00,
+0x00, 0x02, 0x0e, 0x00, 0x00, 0x00, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72,
+0x2d, 0x3e, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x00, 0x06, 0x00, 0x00,
+0x02, 0x01, 0x00, 0x04, 0x02, 0x03, 0x02, 0x01, 0x02, 0x01, 0x00, 0x07,
+0x01, 0x03, 0x16, 0x00, 0x00, 0x00, 0x02, 0x0d, 0x00, 0x00, 0x00, 0x73,
+0x74, 0x72, 0x69, 0x6e, 0x67, 0x2d, 0x61, 0x70, 0x70, 0x65, 0x6e, 0x64,
+0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x01, 0x01, 0x00, 0x00,
+0x00, 0x2e, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x03, 0x02, 0x01,
+0x04, 0x03, 0x01, 0x01, 0x03, 0x04, 0x02, 0x04, 0x05, 0x00, 0x01, 0x01,
+0x05, 0x01, 0x00, 0x04, 0x00, 0x01, 0x0d, 0x00, 0x00, 0x00, 0x02, 0x0e,
+0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x2d, 0x3e, 0x73,
+0x79, 0x6d, 0x62, 0x6f, 0x6c, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x05,
+0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00,
+0x0c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x01, 0x01, 0x04, 0x02,
+0x00, 0x01, 0x01, 0x02, 0x02, 0x00, 0x03, 0x01, 0x00, 0x09, 0x00, 0x00,
+0x00, 0x04, 0x00, 0x00, 0x01, 0x02, 0x01, 0x00, 0x01, 0x01, 0x03, 0x00,
+0x05, 0x01, 0x00, 0x11, 0x00, 0x00, 0x00, 0x04, 0x00, 0x14, 0x0e, 0x02,
+0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x04, 0x03, 0x00, 0x03, 0x01, 0x03,
 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
 0x04, 0x01, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x02, 0x00,
-0x03, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x02, 0x08,
+0x03, 0x02, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x02, 0x08,
 0x00, 0x0e, 0x00, 0x04, 0x00, 0x00, 0x01, 0x04, 0x01, 0x00, 0x02, 0x01,
-0x01, 0x04, 0x00, 0x00, 0x01, 0x0a, 0x01, 0x01, 0x01, 0x03, 0x00, 0x03,
+0x01, 0x02, 0x00, 0x00, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x03,
 0x02, 0x00, 0x08, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x01, 0x01,
-0x01, 0x01, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02,
-0x07, 0x00, 0x00, 0x00, 0x73, 0x79, 0x6d, 0x62, 0x6f, 0x6c, 0x3f, 0x00,
-0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x01, 0x02, 0x01, 0x02,
-0x01, 0x00, 0x04, 0x00, 0x01, 0x1d, 0x00, 0x00, 0x00, 0x02, 0x07, 0x00,
-0x00, 0x00, 0x73, 0x79, 0x6d, 0x62, 0x6f, 0x6c, 0x3f, 0x00, 0x04, 0x00,
-0x00, 0x01, 0x08, 0x00, 0x11, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x01,
-0x01, 0x04, 0x02, 0x02, 0x03, 0x01, 0x02, 0x04, 0x00, 0x01, 0x01, 0x0a,
-0x01, 0x01, 0x01, 0x01, 0x00, 0x05, 0x02, 0x01, 0x21, 0x00, 0x00, 0x00,
-0x02, 0x03, 0x00, 0x00, 0x00, 0x65, 0x71, 0x3f, 0x00, 0x04, 0x00, 0x00,
-0x01, 0x08, 0x00, 0x15, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x01, 0x01,
-0x04, 0x02, 0x01, 0x02, 0x04, 0x03, 0x01, 0x03, 0x01, 0x03, 0x02, 0x00,
-0x00, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d,
-0x00, 0x00, 0x00, 0x04, 0x00, 0x03, 0x18, 0x02, 0x01, 0x00, 0x04, 0x02,
-0x02, 0x02, 0x01, 0x02, 0x01, 0x00, 0x04, 0x00, 0x00, 0x1e, 0x00, 0x00,
-0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x12, 0x00, 0x04, 0x00, 0x04,
-0x18, 0x04, 0x01, 0x01, 0x01, 0x04, 0x02, 0x03, 0x03, 0x01, 0x02, 0x04,
-0x00, 0x01, 0x01, 0x0a, 0x01, 0x01, 0x01, 0x01, 0x00, 0x04, 0x01, 0x00,
-0x1d, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x11, 0x00,
-0x04, 0x00, 0x03, 0x16, 0x02, 0x01, 0x00, 0x04, 0x02, 0x02, 0x02, 0x01,
+0x01, 0x01, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x04,
+0x00, 0x18, 0x10, 0x02, 0x01, 0x00, 0x04, 0x02, 0x04, 0x03, 0x01, 0x02,
+0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00,
+0x00, 0x00, 0x6e, 0x6f, 0x74, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
+0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x04, 0x00, 0x01, 0x1d,
+0x00, 0x00, 0x00, 0x02, 0x07, 0x00, 0x00, 0x00, 0x73, 0x79, 0x6d, 0x62,
+0x6f, 0x6c, 0x3f, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x11, 0x00,
+0x06, 0x00, 0x00, 0x04, 0x01, 0x02, 0x01, 0x04, 0x02, 0x06, 0x02, 0x01,
 0x02, 0x04, 0x00, 0x02, 0x01, 0x0a, 0x01, 0x01, 0x01, 0x01, 0x00, 0x04,
-0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x17, 0x02, 0x01,
-0x00, 0x04, 0x02, 0x03, 0x02, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x00,
-0x11, 0x00, 0x00, 0x00, 0x04, 0x00, 0x05, 0x0d, 0x02, 0x01, 0x00, 0x04,
-0x02, 0x01, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04,
-0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x04, 0x00, 0x06, 0x16, 0x02, 0x01,
-0x00, 0x04, 0x02, 0x05, 0x03, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x00,
-0x0d, 0x00, 0x00, 0x00, 0x04, 0x00, 0x07, 0x17, 0x02, 0x01, 0x00, 0x04,
-0x02, 0x06, 0x03, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x00, 0x11, 0x00,
-0x00, 0x00, 0x04, 0x00, 0x08, 0x0d, 0x02, 0x01, 0x00, 0x04, 0x02, 0x01,
-0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x00, 0x01,
-0x11, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x65, 0x71, 0x3f,
-0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x08, 0x01, 0x04, 0x02, 0x03, 0x01,
-0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x02, 0x00, 0x03, 0x01, 0x00, 0x09,
-0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x02, 0x01, 0x00, 0x01, 0x01,
-0x03, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x04, 0x00, 0x02,
-0x18, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x01, 0x02, 0x01, 0x00,
-0x05, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08,
-0x00, 0x16, 0x00, 0x04, 0x00, 0x03, 0x14, 0x04, 0x01, 0x01, 0x01, 0x04,
-0x02, 0x01, 0x02, 0x04, 0x03, 0x01, 0x03, 0x01, 0x03, 0x04, 0x00, 0x02,
-0x02, 0x04, 0x01, 0x01, 0x01, 0x04, 0x02, 0x01, 0x02, 0x04, 0x03, 0x01,
-0x03, 0x01, 0x03, 0x01, 0x00, 0x04, 0x09, 0x01, 0x43, 0x00, 0x00, 0x00,
-0x02, 0x06, 0x00, 0x00, 0x00, 0x65, 0x71, 0x75, 0x61, 0x6c, 0x3f, 0x00,
-0x04, 0x00, 0x00, 0x01, 0x07, 0x00, 0x00, 0x02, 0x00, 0x00, 0x05, 0x00,
-0x01, 0x13, 0x02, 0x00, 0x01, 0x05, 0x00, 0x01, 0x12, 0x02, 0x00, 0x02,
-0x05, 0x00, 0x01, 0x11, 0x02, 0x00, 0x03, 0x05, 0x00, 0x01, 0x10, 0x02,
-0x00, 0x04, 0x05, 0x00, 0x01, 0x0f, 0x02, 0x00, 0x05, 0x05, 0x00, 0x01,
-0x0e, 0x02, 0x00, 0x06, 0x05, 0x00, 0x01, 0x0d, 0x02, 0x00, 0x07, 0x02,
-0x01, 0x08, 0x0d, 0x02, 0x00, 0x01, 0x02, 0x04, 0x00, 0x06, 0x01, 0x01,
-0x14, 0x00, 0x00, 0x00, 0x02, 0x06, 0x00, 0x00, 0x00, 0x76, 0x65, 0x63,
-0x74, 0x6f, 0x72, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
-0x00, 0x02, 0x04, 0x03, 0x00, 0x03, 0x04, 0x04, 0x00, 0x04, 0x01, 0x04,
-0x01, 0x00, 0x05, 0x00, 0x02, 0x10, 0x00, 0x00, 0x00, 0x02, 0x0b, 0x00,
-0x00, 0x00, 0x6d, 0x61, 0x6b, 0x65, 0x2d, 0x72, 0x65, 0x63, 0x6f, 0x72,
-0x64, 0x00, 0x02, 0x0b, 0x00, 0x00, 0x00, 0x65, 0x6e, 0x76, 0x69, 0x72,
-0x6f, 0x6e, 0x6d, 0x65, 0x6e, 0x74, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01,
-0x01, 0x01, 0x03, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x02,
-0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x07, 0x00, 0x00,
-0x00, 0x72, 0x65, 0x63, 0x6f, 0x72, 0x64, 0x3f, 0x00, 0x06, 0x00, 0x00,
-0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x01, 0x02, 0x01, 0x00, 0x04,
-0x01, 0x01, 0x1c, 0x00, 0x00, 0x00, 0x02, 0x0b, 0x00, 0x00, 0x00, 0x72,
-0x65, 0x63, 0x6f, 0x72, 0x64, 0x2d, 0x74, 0x79, 0x70, 0x65, 0x00, 0x04,
-0x00, 0x00, 0x01, 0x08, 0x00, 0x10, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
-0x00, 0x04, 0x02, 0x01, 0x02, 0x01, 0x02, 0x04, 0x00, 0x01, 0x01, 0x0a,
-0x01, 0x01, 0x01, 0x01, 0x00, 0x05, 0x00, 0x02, 0x10, 0x00, 0x00, 0x00,
-0x02, 0x03, 0x00, 0x00, 0x00, 0x65, 0x71, 0x3f, 0x00, 0x02, 0x0b, 0x00,
-0x00, 0x00, 0x65, 0x6e, 0x76, 0x69, 0x72, 0x6f, 0x6e, 0x6d, 0x65, 0x6e,
-0x74, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x02, 0x01, 0x04, 0x02, 0x00,
-0x01, 0x03, 0x03, 0x01, 0x01, 0x03, 0x02, 0x00, 0x04, 0x01, 0x00, 0x0d,
-0x00, 0x00, 0x00, 0x04, 0x00, 0x02, 0x12, 0x02, 0x01, 0x00, 0x04, 0x02,
-0x00, 0x02, 0x01, 0x02, 0x01, 0x00, 0x06, 0x01, 0x04, 0x27, 0x00, 0x00,
-0x00, 0x02, 0x0c, 0x00, 0x00, 0x00, 0x72, 0x65, 0x63, 0x6f, 0x72, 0x64,
-0x2d, 0x64, 0x61, 0x74, 0x75, 0x6d, 0x00, 0x02, 0x05, 0x00, 0x00, 0x00,
-0x65, 0x72, 0x72, 0x6f, 0x72, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x72,
-0x65, 0x63, 0x6f, 0x72, 0x64, 0x20, 0x74, 0x79, 0x70, 0x65, 0x20, 0x6d,
-0x69, 0x73, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x00, 0x02, 0x0b, 0x00, 0x00,
-0x00, 0x65, 0x6e, 0x76, 0x69, 0x72, 0x6f, 0x6e, 0x6d, 0x65, 0x6e, 0x74,
-0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x10, 0x00, 0x06, 0x00, 0x00,
-0x02, 0x01, 0x00, 0x04, 0x02, 0x01, 0x02, 0x01, 0x02, 0x06, 0x00, 0x01,
-0x04, 0x01, 0x01, 0x01, 0x03, 0x02, 0x02, 0x04, 0x03, 0x01, 0x02, 0x03,
-0x04, 0x03, 0x01, 0x04, 0x01, 0x00, 0x05, 0x00, 0x01, 0x10, 0x00, 0x00,
-0x00, 0x02, 0x0a, 0x00, 0x00, 0x00, 0x76, 0x65, 0x63, 0x74, 0x6f, 0x72,
-0x2d, 0x72, 0x65, 0x66, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x02, 0x01,
-0x04, 0x02, 0x00, 0x01, 0x0d, 0x03, 0x02, 0x01, 0x03, 0x02, 0x00, 0x04,
-0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x04, 0x00, 0x02, 0x12, 0x02, 0x01,
-0x00, 0x04, 0x02, 0x00, 0x02, 0x01, 0x02, 0x01, 0x00, 0x06, 0x01, 0x04,
-0x27, 0x00, 0x00, 0x00, 0x02, 0x0c, 0x00, 0x00, 0x00, 0x72, 0x65, 0x63,
-0x6f, 0x72, 0x64, 0x2d, 0x64, 0x61, 0x74, 0x75, 0x6d, 0x00, 0x02, 0x05,
-0x00, 0x00, 0x00, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x00, 0x01, 0x14, 0x00,
-0x00, 0x00, 0x72, 0x65, 0x63, 0x6f, 0x72, 0x64, 0x20, 0x74, 0x79, 0x70,
-0x65, 0x20, 0x6d, 0x69, 0x73, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x00, 0x02,
-0x0b, 0x00, 0x00, 0x00, 0x65, 0x6e, 0x76, 0x69, 0x72, 0x6f, 0x6e, 0x6d,
-0x65, 0x6e, 0x74, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x10, 0x00,
-0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x01, 0x02, 0x01, 0x02,
-0x06, 0x00, 0x01, 0x04, 0x01, 0x01, 0x01, 0x03, 0x02, 0x02, 0x04, 0x03,
-0x01, 0x02, 0x03, 0x04, 0x03, 0x01, 0x04, 0x01, 0x00, 0x05, 0x00, 0x01,
-0x10, 0x00, 0x00, 0x00, 0x02, 0x0a, 0x00, 0x00, 0x00, 0x76, 0x65, 0x63,
-0x74, 0x6f, 0x72, 0x2d, 0x72, 0x65, 0x66, 0x00, 0x06, 0x00, 0x00, 0x04,
-0x01, 0x02, 0x01, 0x04, 0x02, 0x00, 0x01, 0x0d, 0x03, 0x01, 0x01, 0x03,
-0x02, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x04, 0x00, 0x02,
-0x12, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x01, 0x02, 0x01, 0x00,
-0x06, 0x01, 0x04, 0x27, 0x00, 0x00, 0x00, 0x02, 0x0c, 0x00, 0x00, 0x00,
-0x72, 0x65, 0x63, 0x6f, 0x72, 0x64, 0x2d, 0x64, 0x61, 0x74, 0x75, 0x6d,
-0x00, 0x02, 0x05, 0x00, 0x00, 0x00, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x00,
-0x01, 0x14, 0x00, 0x00, 0x00, 0x72, 0x65, 0x63, 0x6f, 0x72, 0x64, 0x20,
-0x74, 0x79, 0x70, 0x65, 0x20, 0x6d, 0x69, 0x73, 0x6d, 0x61, 0x74, 0x63,
-0x68, 0x00, 0x02, 0x0b, 0x00, 0x00, 0x00, 0x65, 0x6e, 0x76, 0x69, 0x72,
-0x6f, 0x6e, 0x6d, 0x65, 0x6e, 0x74, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08,
-0x00, 0x10, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x01,
-0x02, 0x01, 0x02, 0x06, 0x00, 0x01, 0x04, 0x01, 0x01, 0x01, 0x03, 0x02,
-0x02, 0x04, 0x03, 0x01, 0x02, 0x03, 0x04, 0x03, 0x01, 0x04, 0x01, 0x00,
-0x05, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x0a, 0x00, 0x00, 0x00,
-0x76, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x2d, 0x72, 0x65, 0x66, 0x00, 0x06,
-0x00, 0x00, 0x04, 0x01, 0x02, 0x01, 0x04, 0x02, 0x00, 0x01, 0x0d, 0x03,
-0x00, 0x01, 0x03, 0x03, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00,
-0x04, 0x00, 0x02, 0x11, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x03, 0x01,
-0x02, 0x01, 0x00, 0x04, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x04, 0x00,
-0x00, 0x01, 0x04, 0x01, 0x01, 0x01, 0x04, 0x02, 0x01, 0x02, 0x01, 0x02,
-0x03, 0x00, 0x05, 0x01, 0x00, 0x11, 0x00, 0x00, 0x00, 0x04, 0x00, 0x02,
-0x0e, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x04, 0x03, 0x00, 0x03,
-0x01, 0x03, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x02,
-0x00, 0x00, 0x04, 0x01, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02,
-0x02, 0x00, 0x04, 0x01, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-0x02, 0x08, 0x00, 0x0e, 0x00, 0x04, 0x00, 0x00, 0x01, 0x04, 0x01, 0x00,
-0x02, 0x01, 0x01, 0x04, 0x00, 0x04, 0x0f, 0x02, 0x01, 0x00, 0x04, 0x02,
-0x02, 0x03, 0x01, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x0c, 0x00, 0x00,
-0x00, 0x02, 0x00, 0x00, 0x02, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01,
-0x02, 0x02, 0x00, 0x05, 0x01, 0x01, 0x26, 0x00, 0x00, 0x00, 0x02, 0x07,
-0x00, 0x00, 0x00, 0x73, 0x79, 0x6d, 0x62, 0x6f, 0x6c, 0x3f, 0x00, 0x04,
-0x00, 0x00, 0x02, 0x08, 0x00, 0x16, 0x00, 0x04, 0x00, 0x06, 0x0d, 0x04,
-0x01, 0x00, 0x01, 0x04, 0x02, 0x04, 0x02, 0x04, 0x03, 0x00, 0x02, 0x01,
-0x03, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x04, 0x02, 0x01,
-0x02, 0x01, 0x00, 0x05, 0x01, 0x00, 0x27, 0x00, 0x00, 0x00, 0x04, 0x00,
-0x00, 0x01, 0x08, 0x00, 0x16, 0x00, 0x04, 0x00, 0x07, 0x0c, 0x04, 0x01,
-0x01, 0x01, 0x04, 0x02, 0x05, 0x02, 0x04, 0x03, 0x05, 0x03, 0x01, 0x03,
-0x04, 0x00, 0x07, 0x16, 0x02, 0x01, 0x00, 0x04, 0x02, 0x05, 0x02, 0x01,
-0x02, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x04, 0x00,
-0x08, 0x17, 0x02, 0x01, 0x00, 0x04, 0x02, 0x06, 0x02, 0x01, 0x02, 0x01,
-0x00, 0x05, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x04, 0x00, 0x09, 0x0d,
-0x04, 0x01, 0x03, 0x01, 0x04, 0x02, 0x01, 0x01, 0x04, 0x03, 0x00, 0x01,
-0x01, 0x03, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x02,
-0x00, 0x00, 0x04, 0x01, 0x02, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02,
-0x02, 0x00, 0x03, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-0x02, 0x08, 0x00, 0x0e, 0x00, 0x04, 0x00, 0x00, 0x01, 0x04, 0x01, 0x00,
-0x02, 0x01, 0x01, 0x04, 0x00, 0x00, 0x01, 0x0a, 0x01, 0x01, 0x01, 0x02,
-0x00, 0x03, 0x01, 0x00, 0x09, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01,
-0x02, 0x01, 0x00, 0x01, 0x01, 0x02, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00,
-0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x01, 0x00, 0x01, 0x04, 0x02, 0x01,
-0x02, 0x01, 0x02, 0x02, 0x00, 0x05, 0x01, 0x01, 0x0f, 0x00, 0x00, 0x00,
-0x02, 0x01, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
-0x00, 0x04, 0x02, 0x02, 0x02, 0x0d, 0x03, 0x01, 0x01, 0x03, 0x01, 0x00,
-0x03, 0x02, 0x00, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x05,
-0x00, 0x03, 0x02, 0x02, 0x00, 0x00, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01,
-0x00, 0x04, 0x01, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04,
-0x01, 0x00, 0x01, 0x0a, 0x02, 0x01, 0x02, 0x02, 0x00, 0x04, 0x01, 0x00,
-0x15, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x05, 0x00, 0x00, 0x02, 0x04,
-0x00, 0x00, 0x02, 0x04, 0x01, 0x00, 0x01, 0x04, 0x02, 0x04, 0x02, 0x01,
-0x02, 0x02, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x07,
-0x00, 0x00, 0x00, 0x73, 0x79, 0x6d, 0x62, 0x6f, 0x6c, 0x3f, 0x00, 0x06,
-0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x01, 0x02, 0x01,
-0x00, 0x04, 0x01, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01,
-0x08, 0x00, 0x0e, 0x00, 0x04, 0x00, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02,
-0x01, 0x01, 0x04, 0x00, 0x09, 0x16, 0x02, 0x01, 0x00, 0x04, 0x02, 0x01,
-0x02, 0x01, 0x02, 0x01, 0x00, 0x04, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00,
-0x04, 0x00, 0x03, 0x02, 0x04, 0x01, 0x02, 0x01, 0x04, 0x02, 0x00, 0x01,
-0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x02,
-0x0e, 0x00, 0x00, 0x00, 0x73, 0x79, 0x6d, 0x62, 0x6f, 0x6c, 0x2d, 0x3e,
-0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
-0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01,
-0x0c, 0x00, 0x00, 0x00, 0x02, 0x0e, 0x00, 0x00, 0x00, 0x6e, 0x75, 0x6d,
-0x62, 0x65, 0x72, 0x2d, 0x3e, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x00,
-0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x03, 0x02, 0x01, 0x02,
-0x01, 0x00, 0x07, 0x01, 0x03, 0x16, 0x00, 0x00, 0x00, 0x02, 0x0d, 0x00,
-0x00, 0x00, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x2d, 0x61, 0x70, 0x70,
-0x65, 0x6e, 0x64, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x01,
-0x01, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00,
-0x03, 0x02, 0x01, 0x04, 0x03, 0x01, 0x01, 0x03, 0x04, 0x02, 0x04, 0x05,
-0x00, 0x01, 0x01, 0x05, 0x01, 0x00, 0x04, 0x00, 0x01, 0x0d, 0x00, 0x00,
-0x00, 0x02, 0x0e, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67,
-0x2d, 0x3e, 0x73, 0x79, 0x6d, 0x62, 0x6f, 0x6c, 0x00, 0x06, 0x00, 0x00,
-0x04, 0x01, 0x05, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00,
-0x04, 0x02, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x01,
-0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x02, 0x00, 0x03, 0x01, 0x00,
-0x09, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x02, 0x01, 0x00, 0x01,
-0x01, 0x03, 0x00, 0x05, 0x01, 0x00, 0x11, 0x00, 0x00, 0x00, 0x04, 0x00,
-0x04, 0x0e, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x04, 0x03, 0x00,
-0x03, 0x01, 0x03, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00,
-0x02, 0x00, 0x00, 0x04, 0x01, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01,
-0x02, 0x02, 0x00, 0x03, 0x02, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x04, 0x00,
-0x00, 0x02, 0x08, 0x00, 0x0e, 0x00, 0x04, 0x00, 0x00, 0x01, 0x04, 0x01,
-0x00, 0x02, 0x01, 0x01, 0x02, 0x00, 0x00, 0x02, 0x01, 0x01, 0x01, 0x01,
-0x01, 0x00, 0x03, 0x02, 0x00, 0x08, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
-0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00,
-0x00, 0x00, 0x04, 0x00, 0x08, 0x0f, 0x02, 0x01, 0x00, 0x04, 0x02, 0x04,
-0x03, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00,
-0x02, 0x03, 0x00, 0x00, 0x00, 0x6e, 0x6f, 0x74, 0x00, 0x06, 0x00, 0x00,
-0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x04,
-0x00, 0x01, 0x1d, 0x00, 0x00, 0x00, 0x02, 0x07, 0x00, 0x00, 0x00, 0x73,
-0x79, 0x6d, 0x62, 0x6f, 0x6c, 0x3f, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08,
-0x00, 0x11, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x02, 0x01, 0x04, 0x02,
-0x06, 0x02, 0x01, 0x02, 0x04, 0x00, 0x02, 0x01, 0x0a, 0x01, 0x01, 0x01,
-0x01, 0x00, 0x04, 0x02, 0x00, 0x22, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-0x01, 0x08, 0x00, 0x11, 0x00, 0x04, 0x00, 0x08, 0x10, 0x02, 0x01, 0x00,
-0x04, 0x02, 0x04, 0x03, 0x01, 0x02, 0x04, 0x00, 0x05, 0x02, 0x02, 0x01,
-0x01, 0x04, 0x02, 0x04, 0x02, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01,
-0x0c, 0x00, 0x00, 0x00, 0x02, 0x0e, 0x00, 0x00, 0x00, 0x73, 0x79, 0x6d,
-0x62, 0x6f, 0x6c, 0x2d, 0x3e, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x00,
-0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x05, 0x02, 0x01, 0x02,
-0x01, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x0d, 0x00,
-0x00, 0x00, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x2d, 0x61, 0x70, 0x70,
-0x65, 0x6e, 0x64, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
-0x01, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x00,
-0x01, 0x0d, 0x00, 0x00, 0x00, 0x02, 0x0e, 0x00, 0x00, 0x00, 0x73, 0x74,
-0x72, 0x69, 0x6e, 0x67, 0x2d, 0x3e, 0x73, 0x79, 0x6d, 0x62, 0x6f, 0x6c,
-0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x04, 0x01, 0x04, 0x02, 0x00, 0x01,
-0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x02,
-0x00, 0x00, 0x04, 0x01, 0x02, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02,
-0x02, 0x00, 0x06, 0x01, 0x00, 0x15, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0a,
-0x0b, 0x02, 0x01, 0x00, 0x04, 0x02, 0x06, 0x02, 0x04, 0x03, 0x00, 0x02,
-0x04, 0x04, 0x06, 0x03, 0x01, 0x04, 0x01, 0x00, 0x03, 0x00, 0x00, 0x0a,
-0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x01,
-0x01, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x02, 0x00,
-0x00, 0x04, 0x01, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x02,
-0x00, 0x03, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x02,
-0x08, 0x00, 0x0e, 0x00, 0x04, 0x00, 0x00, 0x01, 0x04, 0x01, 0x00, 0x02,
-0x01, 0x01, 0x04, 0x00, 0x00, 0x01, 0x0a, 0x01, 0x01, 0x01, 0x01, 0x00,
-0x04, 0x03, 0x02, 0x21, 0x00, 0x00, 0x00, 0x02, 0x0e, 0x00, 0x00, 0x00,
-0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x2d, 0x3e, 0x73, 0x79, 0x6d, 0x62,
-0x6f, 0x6c, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-0x01, 0x05, 0x00, 0x03, 0x0c, 0x02, 0x00, 0x00, 0x05, 0x00, 0x03, 0x0b,
-0x02, 0x00, 0x01, 0x05, 0x00, 0x03, 0x0a, 0x06, 0x00, 0x00, 0x02, 0x01,
-0x02, 0x03, 0x02, 0x01, 0x01, 0x02, 0x04, 0x00, 0x04, 0x01, 0x00, 0x0d,
-0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x11, 0x02, 0x01, 0x00, 0x04, 0x02,
-0x00, 0x04, 0x01, 0x02, 0x01, 0x00, 0x05, 0x00, 0x00, 0x12, 0x00, 0x00,
-0x00, 0x04, 0x00, 0x00, 0x01, 0x04, 0x01, 0x01, 0x01, 0x04, 0x02, 0x01,
-0x02, 0x04, 0x03, 0x01, 0x03, 0x01, 0x03, 0x02, 0x00, 0x04, 0x01, 0x01,
-0x0c, 0x00, 0x00, 0x00, 0x02, 0x0e, 0x00, 0x00, 0x00, 0x73, 0x79, 0x6d,
-0x62, 0x6f, 0x6c, 0x2d, 0x3e, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x00,
-0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x01, 0x02,
-0x01, 0x00, 0x03, 0x01, 0x01, 0x08, 0x00, 0x00, 0x00, 0x02, 0x0e, 0x00,
-0x00, 0x00, 0x6d, 0x61, 0x6b, 0x65, 0x2d, 0x61, 0x74, 0x74, 0x72, 0x69,
-0x62, 0x75, 0x74, 0x65, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x01,
-0x01, 0x01, 0x00, 0x06, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x04, 0x00,
-0x06, 0x13, 0x04, 0x01, 0x02, 0x01, 0x0a, 0x02, 0x04, 0x03, 0x01, 0x01,
-0x04, 0x04, 0x00, 0x01, 0x01, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d,
-0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x0a, 0x02, 0x01, 0x00, 0x04, 0x02,
-0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x0c, 0x00, 0x00,
-0x00, 0x02, 0x00, 0x00, 0x02, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01,
-0x02, 0x02, 0x00, 0x05, 0x01, 0x02, 0x0d, 0x00, 0x00, 0x00, 0x02, 0x04,
-0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x02, 0x11, 0x00, 0x00,
-0x00, 0x63, 0x6f, 0x72, 0x65, 0x23, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65,
-0x2d, 0x6d, 0x61, 0x63, 0x72, 0x6f, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
-0x00, 0x03, 0x02, 0x01, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01,
+0x02, 0x00, 0x22, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00,
+0x11, 0x00, 0x04, 0x00, 0x18, 0x11, 0x02, 0x01, 0x00, 0x04, 0x02, 0x04,
+0x03, 0x01, 0x02, 0x04, 0x00, 0x05, 0x02, 0x02, 0x01, 0x01, 0x04, 0x02,
+0x04, 0x02, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00,
+0x00, 0x02, 0x0e, 0x00, 0x00, 0x00, 0x73, 0x79, 0x6d, 0x62, 0x6f, 0x6c,
+0x2d, 0x3e, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x00, 0x06, 0x00, 0x00,
+0x02, 0x01, 0x00, 0x04, 0x02, 0x05, 0x02, 0x01, 0x02, 0x01, 0x00, 0x05,
+0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x0d, 0x00, 0x00, 0x00, 0x73,
+0x74, 0x72, 0x69, 0x6e, 0x67, 0x2d, 0x61, 0x70, 0x70, 0x65, 0x6e, 0x64,
+0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x01, 0x01, 0x04,
+0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x00, 0x01, 0x0d, 0x00,
+0x00, 0x00, 0x02, 0x0e, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x69, 0x6e,
+0x67, 0x2d, 0x3e, 0x73, 0x79, 0x6d, 0x62, 0x6f, 0x6c, 0x00, 0x06, 0x00,
+0x00, 0x04, 0x01, 0x04, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x01,
+0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04,
+0x01, 0x02, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x02, 0x00, 0x06,
+0x01, 0x00, 0x15, 0x00, 0x00, 0x00, 0x04, 0x00, 0x1a, 0x0b, 0x02, 0x01,
+0x00, 0x04, 0x02, 0x06, 0x02, 0x04, 0x03, 0x00, 0x02, 0x04, 0x04, 0x06,
+0x03, 0x01, 0x04, 0x01, 0x00, 0x03, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+0x04, 0x00, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x00,
+0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x01,
+0x01, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x02, 0x00, 0x03, 0x00,
+0x00, 0x1a, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x02, 0x08, 0x00, 0x0e,
+0x00, 0x04, 0x00, 0x00, 0x01, 0x04, 0x01, 0x00, 0x02, 0x01, 0x01, 0x04,
+0x00, 0x00, 0x01, 0x0a, 0x01, 0x01, 0x01, 0x01, 0x00, 0x04, 0x03, 0x02,
+0x21, 0x00, 0x00, 0x00, 0x02, 0x0e, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72,
+0x69, 0x6e, 0x67, 0x2d, 0x3e, 0x73, 0x79, 0x6d, 0x62, 0x6f, 0x6c, 0x00,
+0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x05, 0x00,
+0x13, 0x0c, 0x02, 0x00, 0x00, 0x05, 0x00, 0x13, 0x0b, 0x02, 0x00, 0x01,
+0x05, 0x00, 0x13, 0x0a, 0x06, 0x00, 0x00, 0x02, 0x01, 0x02, 0x03, 0x02,
+0x01, 0x01, 0x02, 0x04, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00,
+0x04, 0x00, 0x14, 0x12, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x04, 0x01,
+0x02, 0x01, 0x00, 0x05, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x04, 0x00,
+0x00, 0x01, 0x04, 0x01, 0x01, 0x01, 0x04, 0x02, 0x01, 0x02, 0x04, 0x03,
+0x01, 0x03, 0x01, 0x03, 0x02, 0x00, 0x04, 0x01, 0x01, 0x0c, 0x00, 0x00,
+0x00, 0x02, 0x0e, 0x00, 0x00, 0x00, 0x73, 0x79, 0x6d, 0x62, 0x6f, 0x6c,
+0x2d, 0x3e, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x00, 0x06, 0x00, 0x00,
+0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x01, 0x02, 0x01, 0x00, 0x03,
+0x01, 0x01, 0x08, 0x00, 0x00, 0x00, 0x02, 0x0e, 0x00, 0x00, 0x00, 0x6d,
+0x61, 0x6b, 0x65, 0x2d, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74,
+0x65, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x01, 0x01, 0x01, 0x00,
+0x06, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x04, 0x00, 0x16, 0x0f, 0x04,
+0x01, 0x02, 0x01, 0x0a, 0x02, 0x04, 0x03, 0x01, 0x01, 0x04, 0x04, 0x00,
+0x01, 0x01, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00,
+0x04, 0x00, 0x14, 0x0a, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x01, 0x01,
+0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x00,
+0x00, 0x02, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x02, 0x00,
+0x05, 0x01, 0x02, 0x0d, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00,
+0x63, 0x6f, 0x6e, 0x73, 0x00, 0x02, 0x10, 0x00, 0x00, 0x00, 0x63, 0x6f,
+0x72, 0x65, 0x23, 0x72, 0x65, 0x63, 0x6f, 0x72, 0x64, 0x2d, 0x73, 0x65,
+0x74, 0x21, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x03, 0x02, 0x01,
+0x0b, 0x03, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x02, 0x0f, 0x00, 0x00,
+0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x02,
+0x0f, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x72, 0x65, 0x23, 0x72, 0x65, 0x63,
+0x6f, 0x72, 0x64, 0x2d, 0x72, 0x65, 0x66, 0x00, 0x06, 0x00, 0x00, 0x02,
+0x01, 0x00, 0x03, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01,
+0x00, 0x05, 0x01, 0x02, 0x0f, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00,
+0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x02, 0x11, 0x00, 0x00, 0x00, 0x63,
+0x6f, 0x72, 0x65, 0x23, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x2d, 0x6d,
+0x61, 0x63, 0x72, 0x6f, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x03,
+0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01,
 0x02, 0x0f, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63, 0x6f,
 0x6e, 0x73, 0x00, 0x02, 0x0a, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x72, 0x65,
 0x23, 0x62, 0x65, 0x67, 0x69, 0x6e, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01,
@@ -4334,52 +4703,52 @@ static const unsigned char eval_rom[] = {
 0x00, 0x00, 0x00, 0x02, 0x08, 0x00, 0x00, 0x00, 0x66, 0x6f, 0x72, 0x2d,
 0x65, 0x61, 0x63, 0x68, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x02,
 0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x03, 0x01,
-0x00, 0x09, 0x00, 0x00, 0x00, 0x04, 0x00, 0x08, 0x01, 0x02, 0x01, 0x00,
+0x00, 0x09, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0a, 0x01, 0x02, 0x01, 0x00,
 0x01, 0x01, 0x01, 0x00, 0x03, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x04,
-0x00, 0x00, 0x01, 0x04, 0x01, 0x09, 0x02, 0x01, 0x01, 0x02, 0x00, 0x06,
-0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0e, 0x0b, 0x04, 0x01,
+0x00, 0x00, 0x01, 0x04, 0x01, 0x0b, 0x02, 0x01, 0x01, 0x02, 0x00, 0x06,
+0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x04, 0x00, 0x20, 0x0b, 0x04, 0x01,
 0x00, 0x01, 0x04, 0x02, 0x00, 0x02, 0x04, 0x03, 0x00, 0x02, 0x04, 0x04,
-0x08, 0x02, 0x01, 0x04, 0x01, 0x00, 0x03, 0x02, 0x01, 0x17, 0x00, 0x00,
+0x0a, 0x02, 0x01, 0x04, 0x01, 0x00, 0x03, 0x02, 0x01, 0x17, 0x00, 0x00,
 0x00, 0x02, 0x0f, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x6b, 0x65, 0x2d, 0x64,
 0x69, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x72, 0x79, 0x00, 0x04, 0x00,
-0x00, 0x01, 0x05, 0x00, 0x06, 0x09, 0x02, 0x00, 0x00, 0x05, 0x00, 0x06,
+0x00, 0x01, 0x05, 0x00, 0x16, 0x09, 0x02, 0x00, 0x00, 0x05, 0x00, 0x16,
 0x08, 0x06, 0x00, 0x00, 0x02, 0x01, 0x01, 0x01, 0x01, 0x02, 0x00, 0x03,
 0x01, 0x01, 0x08, 0x00, 0x00, 0x00, 0x02, 0x0e, 0x00, 0x00, 0x00, 0x6d,
 0x61, 0x6b, 0x65, 0x2d, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74,
 0x65, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x01, 0x01, 0x01, 0x00,
-0x06, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x04, 0x00, 0x08, 0x13, 0x04,
+0x06, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x04, 0x00, 0x18, 0x0f, 0x04,
 0x01, 0x01, 0x01, 0x04, 0x02, 0x01, 0x02, 0x0a, 0x03, 0x04, 0x04, 0x00,
 0x01, 0x01, 0x04, 0x01, 0x00, 0x04, 0x05, 0x01, 0x2e, 0x00, 0x00, 0x00,
 0x02, 0x0e, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x6b, 0x65, 0x2d, 0x70, 0x61,
 0x72, 0x61, 0x6d, 0x65, 0x74, 0x65, 0x72, 0x00, 0x04, 0x00, 0x00, 0x01,
-0x05, 0x00, 0x07, 0x07, 0x02, 0x00, 0x00, 0x05, 0x00, 0x07, 0x06, 0x02,
-0x00, 0x01, 0x05, 0x00, 0x07, 0x05, 0x02, 0x00, 0x02, 0x05, 0x00, 0x07,
-0x04, 0x02, 0x00, 0x03, 0x05, 0x00, 0x07, 0x03, 0x06, 0x00, 0x00, 0x02,
+0x05, 0x00, 0x17, 0x07, 0x02, 0x00, 0x00, 0x05, 0x00, 0x17, 0x06, 0x02,
+0x00, 0x01, 0x05, 0x00, 0x17, 0x05, 0x02, 0x00, 0x02, 0x05, 0x00, 0x17,
+0x04, 0x02, 0x00, 0x03, 0x05, 0x00, 0x17, 0x03, 0x06, 0x00, 0x00, 0x02,
 0x01, 0x04, 0x0b, 0x02, 0x01, 0x02, 0x02, 0x00, 0x05, 0x01, 0x01, 0x10,
 0x00, 0x00, 0x00, 0x02, 0x0f, 0x00, 0x00, 0x00, 0x64, 0x69, 0x63, 0x74,
 0x69, 0x6f, 0x6e, 0x61, 0x72, 0x79, 0x2d, 0x68, 0x61, 0x73, 0x3f, 0x00,
-0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x08, 0x07, 0x04, 0x03,
+0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x18, 0x07, 0x04, 0x03,
 0x00, 0x02, 0x01, 0x03, 0x01, 0x00, 0x05, 0x00, 0x01, 0x21, 0x00, 0x00,
 0x00, 0x02, 0x0e, 0x00, 0x00, 0x00, 0x64, 0x69, 0x63, 0x74, 0x69, 0x6f,
 0x6e, 0x61, 0x72, 0x79, 0x2d, 0x72, 0x65, 0x66, 0x00, 0x04, 0x00, 0x00,
 0x01, 0x08, 0x00, 0x15, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x01, 0x01,
-0x04, 0x02, 0x09, 0x07, 0x04, 0x03, 0x01, 0x02, 0x01, 0x03, 0x04, 0x00,
+0x04, 0x02, 0x19, 0x07, 0x04, 0x03, 0x01, 0x02, 0x01, 0x03, 0x04, 0x00,
 0x01, 0x01, 0x0a, 0x01, 0x01, 0x01, 0x03, 0x00, 0x06, 0x00, 0x01, 0x15,
 0x00, 0x00, 0x00, 0x02, 0x0f, 0x00, 0x00, 0x00, 0x64, 0x69, 0x63, 0x74,
 0x69, 0x6f, 0x6e, 0x61, 0x72, 0x79, 0x2d, 0x73, 0x65, 0x74, 0x21, 0x00,
-0x06, 0x00, 0x00, 0x04, 0x01, 0x00, 0x01, 0x04, 0x02, 0x08, 0x07, 0x04,
+0x06, 0x00, 0x00, 0x04, 0x01, 0x00, 0x01, 0x04, 0x02, 0x18, 0x07, 0x04,
 0x03, 0x00, 0x02, 0x04, 0x04, 0x00, 0x03, 0x01, 0x04, 0x02, 0x00, 0x05,
 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x0f, 0x00, 0x00, 0x00, 0x64,
 0x69, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x72, 0x79, 0x2d, 0x68, 0x61,
-0x73, 0x3f, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x08,
+0x73, 0x3f, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x18,
 0x07, 0x04, 0x03, 0x00, 0x02, 0x01, 0x03, 0x01, 0x00, 0x05, 0x00, 0x01,
 0x21, 0x00, 0x00, 0x00, 0x02, 0x12, 0x00, 0x00, 0x00, 0x64, 0x69, 0x63,
 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x72, 0x79, 0x2d, 0x64, 0x65, 0x6c, 0x65,
 0x74, 0x65, 0x21, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x15, 0x00,
-0x06, 0x00, 0x00, 0x04, 0x01, 0x01, 0x01, 0x04, 0x02, 0x09, 0x07, 0x04,
+0x06, 0x00, 0x00, 0x04, 0x01, 0x01, 0x01, 0x04, 0x02, 0x19, 0x07, 0x04,
 0x03, 0x01, 0x02, 0x01, 0x03, 0x04, 0x00, 0x01, 0x01, 0x0c, 0x01, 0x01,
 0x01, 0x01, 0x00, 0x03, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x04, 0x00,
-0x00, 0x01, 0x04, 0x01, 0x08, 0x07, 0x01, 0x01, 0x01, 0x00, 0x04, 0x02,
+0x00, 0x01, 0x04, 0x01, 0x18, 0x07, 0x01, 0x01, 0x01, 0x00, 0x04, 0x02,
 0x00, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x01, 0x01, 0x04,
 0x02, 0x00, 0x01, 0x01, 0x02, 0x02, 0x00, 0x10, 0x01, 0x00, 0x23, 0x00,
 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x01, 0x00, 0x01, 0x0a, 0x02, 0x0a,
@@ -4465,7 +4834,7 @@ static const unsigned char eval_rom[] = {
 0x00, 0x05, 0x00, 0x01, 0x11, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00,
 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x06,
 0x01, 0x04, 0x02, 0x02, 0x01, 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x02,
-0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0b, 0x15,
+0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x04, 0x00, 0x1b, 0x16,
 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x01, 0x02, 0x01, 0x00, 0x04,
 0x02, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x01, 0x01,
 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x02, 0x00, 0x04, 0x01, 0x01, 0x1e,
@@ -4493,13 +4862,13 @@ static const unsigned char eval_rom[] = {
 0x03, 0x00, 0x00, 0x00, 0x63, 0x61, 0x72, 0x00, 0x04, 0x00, 0x00, 0x01,
 0x08, 0x00, 0x10, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
 0x03, 0x02, 0x01, 0x02, 0x04, 0x00, 0x03, 0x01, 0x0a, 0x01, 0x01, 0x01,
-0x01, 0x00, 0x04, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0f,
-0x15, 0x04, 0x01, 0x04, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x03,
-0x00, 0x05, 0x01, 0x00, 0x11, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0b, 0x0d,
+0x01, 0x00, 0x04, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x04, 0x00, 0x1f,
+0x16, 0x04, 0x01, 0x04, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x03,
+0x00, 0x05, 0x01, 0x00, 0x11, 0x00, 0x00, 0x00, 0x04, 0x00, 0x1b, 0x0d,
 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x04, 0x03, 0x00, 0x03, 0x01,
 0x03, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x02, 0x00,
 0x00, 0x04, 0x01, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x02,
-0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0d, 0x06,
+0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x04, 0x00, 0x1d, 0x06,
 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x01, 0x02, 0x01, 0x00, 0x04,
 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x01, 0x01,
 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x02, 0x00, 0x05, 0x01, 0x00,
@@ -4516,11 +4885,11 @@ static const unsigned char eval_rom[] = {
 0x00, 0x00, 0x00, 0x63, 0x6f, 0x72, 0x65, 0x23, 0x71, 0x75, 0x6f, 0x74,
 0x65, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x01, 0x01, 0x03, 0x02, 0x01,
 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x04, 0x00, 0x05, 0x01, 0x00, 0x11,
-0x00, 0x00, 0x00, 0x04, 0x00, 0x0b, 0x0c, 0x02, 0x01, 0x00, 0x04, 0x02,
+0x00, 0x00, 0x00, 0x04, 0x00, 0x1b, 0x0c, 0x02, 0x01, 0x00, 0x04, 0x02,
 0x00, 0x02, 0x04, 0x03, 0x00, 0x04, 0x01, 0x03, 0x01, 0x00, 0x04, 0x01,
 0x00, 0x0d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x01, 0x01, 0x01,
 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x02, 0x00, 0x04, 0x01, 0x00, 0x0d,
-0x00, 0x00, 0x00, 0x04, 0x00, 0x0d, 0x04, 0x02, 0x01, 0x00, 0x04, 0x02,
+0x00, 0x00, 0x00, 0x04, 0x00, 0x1d, 0x04, 0x02, 0x01, 0x00, 0x04, 0x02,
 0x00, 0x02, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x00, 0x11, 0x00, 0x00,
 0x00, 0x04, 0x00, 0x04, 0x03, 0x02, 0x01, 0x00, 0x04, 0x02, 0x03, 0x03,
 0x04, 0x03, 0x03, 0x04, 0x01, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x0e,
@@ -4534,7 +4903,7 @@ static const unsigned char eval_rom[] = {
 0x00, 0x00, 0x63, 0x6f, 0x72, 0x65, 0x23, 0x64, 0x65, 0x66, 0x69, 0x6e,
 0x65, 0x00, 0x06, 0x00, 0x00, 0x04, 0x01, 0x04, 0x01, 0x03, 0x02, 0x01,
 0x04, 0x03, 0x00, 0x01, 0x01, 0x03, 0x04, 0x00, 0x04, 0x01, 0x00, 0x0d,
-0x00, 0x00, 0x00, 0x04, 0x00, 0x0b, 0x08, 0x02, 0x01, 0x00, 0x04, 0x02,
+0x00, 0x00, 0x00, 0x04, 0x00, 0x1b, 0x08, 0x02, 0x01, 0x00, 0x04, 0x02,
 0x00, 0x04, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00,
 0x00, 0x02, 0x00, 0x00, 0x04, 0x01, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01,
 0x01, 0x02, 0x02, 0x00, 0x05, 0x02, 0x00, 0x10, 0x00, 0x00, 0x00, 0x04,
@@ -4583,10 +4952,10 @@ static const unsigned char eval_rom[] = {
 0x65, 0x6e, 0x74, 0x00, 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02,
 0x06, 0x03, 0x01, 0x02, 0x01, 0x00, 0x03, 0x00, 0x00, 0x0a, 0x00, 0x00,
 0x00, 0x04, 0x00, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02, 0x01, 0x01, 0x02,
-0x00, 0x05, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0e, 0x0c,
+0x00, 0x05, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x04, 0x00, 0x1e, 0x0c,
 0x04, 0x01, 0x00, 0x01, 0x04, 0x02, 0x00, 0x02, 0x04, 0x03, 0x01, 0x02,
 0x01, 0x03, 0x04, 0x00, 0x05, 0x01, 0x00, 0x11, 0x00, 0x00, 0x00, 0x04,
-0x00, 0x0b, 0x0c, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x04, 0x03,
+0x00, 0x1b, 0x0c, 0x02, 0x01, 0x00, 0x04, 0x02, 0x00, 0x02, 0x04, 0x03,
 0x00, 0x04, 0x01, 0x03, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00,
 0x00, 0x02, 0x00, 0x00, 0x04, 0x01, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01,
 0x01, 0x02, 0x02, 0x00, 0x05, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02,
@@ -4594,14 +4963,14 @@ static const unsigned char eval_rom[] = {
 0x02, 0x01, 0x00, 0x04, 0x02, 0x02, 0x03, 0x04, 0x03, 0x02, 0x04, 0x01,
 0x03, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x02, 0x00,
 0x00, 0x04, 0x01, 0x01, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x02,
-0x00, 0x05, 0x01, 0x00, 0x11, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0f, 0x05,
+0x00, 0x05, 0x01, 0x00, 0x11, 0x00, 0x00, 0x00, 0x04, 0x00, 0x1f, 0x05,
 0x02, 0x01, 0x00, 0x04, 0x02, 0x02, 0x02, 0x04, 0x03, 0x00, 0x02, 0x01,
 0x03, 0x01, 0x00, 0x03, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x04, 0x00,
 0x01, 0x01, 0x0c, 0x01, 0x01, 0x01, 0x03, 0x00, 0x04, 0x01, 0x00, 0x0d,
 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x0a, 0x02, 0x01, 0x00, 0x04, 0x02,
 0x00, 0x02, 0x01, 0x02, 0x01, 0x00, 0x04, 0x01, 0x00, 0x1f, 0x00, 0x00,
 0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x0e, 0x00, 0x04, 0x00, 0x01,
-0x01, 0x04, 0x01, 0x01, 0x02, 0x01, 0x01, 0x04, 0x00, 0x0c, 0x15, 0x02,
+0x01, 0x04, 0x01, 0x01, 0x02, 0x01, 0x01, 0x04, 0x00, 0x1c, 0x16, 0x02,
 0x01, 0x00, 0x04, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01,
 0x00, 0x27, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x16,
 0x00, 0x04, 0x00, 0x03, 0x08, 0x04, 0x01, 0x02, 0x01, 0x04, 0x02, 0x02,
@@ -4612,7 +4981,7 @@ static const unsigned char eval_rom[] = {
 0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x10, 0x00, 0x06, 0x00, 0x00,
 0x02, 0x01, 0x00, 0x04, 0x02, 0x03, 0x02, 0x01, 0x02, 0x06, 0x00, 0x01,
 0x02, 0x01, 0x01, 0x04, 0x02, 0x03, 0x02, 0x01, 0x02, 0x01, 0x00, 0x05,
-0x01, 0x00, 0x11, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0f, 0x0d, 0x02, 0x01,
+0x01, 0x00, 0x11, 0x00, 0x00, 0x00, 0x04, 0x00, 0x1f, 0x0d, 0x02, 0x01,
 0x00, 0x04, 0x02, 0x00, 0x01, 0x04, 0x03, 0x04, 0x03, 0x01, 0x03, 0x01,
 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04,
 0x01, 0x05, 0x01, 0x04, 0x02, 0x00, 0x01, 0x01, 0x02, 0x02, 0x00, 0x04,
@@ -4677,7 +5046,7 @@ static const unsigned char eval_rom[] = {
 0x02, 0x01, 0x2f, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x63,
 0x61, 0x64, 0x72, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00, 0x10, 0x00,
 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x0f, 0x02, 0x01, 0x02,
-0x09, 0x00, 0x08, 0x00, 0x11, 0x00, 0x04, 0x00, 0x1a, 0x06, 0x02, 0x01,
+0x09, 0x00, 0x08, 0x00, 0x11, 0x00, 0x04, 0x00, 0x2a, 0x06, 0x02, 0x01,
 0x01, 0x04, 0x02, 0x09, 0x02, 0x01, 0x02, 0x04, 0x00, 0x08, 0x01, 0x0c,
 0x01, 0x01, 0x01, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00,
 0x04, 0x00, 0x11, 0x0c, 0x02, 0x01, 0x00, 0x04, 0x02, 0x10, 0x02, 0x01,
@@ -4711,7 +5080,7 @@ static const unsigned char eval_rom[] = {
 0x06, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x02, 0x01, 0x03, 0x01, 0x02,
 0x01, 0x00, 0x04, 0x00, 0x01, 0x1f, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00,
 0x00, 0x00, 0x63, 0x61, 0x72, 0x00, 0x04, 0x00, 0x00, 0x01, 0x08, 0x00,
-0x0e, 0x00, 0x04, 0x00, 0x0d, 0x09, 0x04, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x0e, 0x00, 0x04, 0x00, 0x1d, 0x09, 0x04, 0x01, 0x01, 0x01, 0x01, 0x01,
 0x06, 0x00, 0x00, 0x04, 0x01, 0x01, 0x01, 0x04, 0x02, 0x02, 0x03, 0x01,
 0x02, 0x01, 0x00, 0x05, 0x01, 0x00, 0x11, 0x00, 0x00, 0x00, 0x04, 0x00,
 0x02, 0x03, 0x02, 0x01, 0x00, 0x04, 0x02, 0x01, 0x02, 0x04, 0x03, 0x00,
@@ -4722,12 +5091,12 @@ static const unsigned char eval_rom[] = {
 0x0a, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x01, 0x04, 0x01, 0x01, 0x02,
 0x01, 0x01, 0x01, 0x00, 0x10, 0x00, 0x01, 0x45, 0x00, 0x00, 0x00, 0x02,
 0x06, 0x00, 0x00, 0x00, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x00, 0x04,
-0x00, 0x00, 0x01, 0x05, 0x00, 0x09, 0x02, 0x06, 0x00, 0x00, 0x04, 0x01,
-0x09, 0x01, 0x04, 0x02, 0x09, 0x19, 0x04, 0x03, 0x09, 0x15, 0x04, 0x04,
-0x09, 0x14, 0x04, 0x05, 0x09, 0x16, 0x04, 0x06, 0x09, 0x17, 0x04, 0x07,
-0x09, 0x0a, 0x04, 0x08, 0x09, 0x09, 0x04, 0x09, 0x09, 0x12, 0x04, 0x0a,
-0x09, 0x0d, 0x04, 0x0b, 0x09, 0x0c, 0x04, 0x0c, 0x09, 0x0b, 0x04, 0x0d,
-0x09, 0x03, 0x04, 0x0e, 0x09, 0x02, 0x01, 0x0e, 0x0e, 0x00, 0x03, 0x00,
+0x00, 0x00, 0x01, 0x05, 0x00, 0x19, 0x02, 0x06, 0x00, 0x00, 0x04, 0x01,
+0x19, 0x01, 0x04, 0x02, 0x19, 0x17, 0x04, 0x03, 0x19, 0x16, 0x04, 0x04,
+0x19, 0x15, 0x04, 0x05, 0x19, 0x18, 0x04, 0x06, 0x19, 0x19, 0x04, 0x07,
+0x19, 0x0a, 0x04, 0x08, 0x19, 0x09, 0x04, 0x09, 0x19, 0x13, 0x04, 0x0a,
+0x19, 0x0d, 0x04, 0x0b, 0x19, 0x0c, 0x04, 0x0c, 0x19, 0x0b, 0x04, 0x0d,
+0x19, 0x03, 0x04, 0x0e, 0x19, 0x02, 0x01, 0x0e, 0x0e, 0x00, 0x03, 0x00,
 0x0d, 0x63, 0x00, 0x00, 0x00, 0x02, 0x0f, 0x00, 0x00, 0x00, 0x6d, 0x61,
 0x6b, 0x65, 0x2d, 0x69, 0x64, 0x65, 0x6e, 0x74, 0x69, 0x66, 0x69, 0x65,
 0x72, 0x00, 0x02, 0x0b, 0x00, 0x00, 0x00, 0x69, 0x64, 0x65, 0x6e, 0x74,
@@ -2,6 +2,10 @@
  * See Copyright Notice in picrin.h
  */
 
+#if ! defined(_POSIX_C_SOURCE) && ! defined(_WIN32)
+# define _POSIX_C_SOURCE 200112L /* for fileno, fstat and read */
+#endif
+
 #include <stdio.h>
 
 #include <picrin.h>
@@ -11,15 +15,35 @@
 
 #if PIC_USE_FILE
 
+#if _WIN32
+# include <io.h>
+# include <sys/stat.h>
+# define file_regular_p(file) file_mode_regular_p(_fileno(file))
 static int
-file_read(pic_state *PIC_UNUSED(pic), void *cookie, char *ptr, int size) {
-  FILE *file = cookie;
-  int r;
+file_mode_regular_p(int fd) {
+  struct _stat st;
 
-  size = 1;                     /* override size */
+  return _fstat(fd, &st) == 0 && (st.st_mode & _S_IFMT) == _S_IFREG;
+}
+#elif __unix__ || __APPLE__
+# include <errno.h>
+# include <sys/stat.h>
+# include <unistd.h>
+# define file_regular_p(file) file_mode_regular_p(fileno(file))
+# define FILE_READ_FD 1
+static int
+file_mode_regular_p(int fd) {
+  struct stat st;
 
-  r = (int)fread(ptr, 1, (size_t)size, file);
-  if (r < size && ferror(file)) {
+  return fstat(fd, &st) == 0 && S_ISREG(st.st_mode);
+}
+#else
+# define file_regular_p(file) 0 /* cannot tell, so never wait past a line */
+#endif
+
+static int
+file_read_end(FILE *file, int r) {
+  if (r == 0 && ferror(file)) {
     return -1;
   }
   if (r == 0 && feof(file)) {
@@ -28,6 +52,45 @@ file_read(pic_state *PIC_UNUSED(pic), void *cookie, char *ptr, int size) {
   return r;
 }
 
+static int
+file_read(pic_state *PIC_UNUSED(pic), void *cookie, char *ptr, int size) {
+  FILE *file = cookie;
+
+  return file_read_end(file, (int) fread(ptr, 1, (size_t) size, file));
+}
+
+#if FILE_READ_FD
+
+static int
+stream_read(pic_state *PIC_UNUSED(pic), void *cookie, char *ptr, int size) {
+  FILE *file = cookie;
+  ssize_t r;
+
+  /* pipes, sockets and terminals: take whatever is available right now */
+  do {
+    r = read(fileno(file), ptr, (size_t) size);
+  } while (r < 0 && errno == EINTR);
+  return r < 0 ? -1 : (int) r;
+}
+
+#else
+
+static int
+stream_read(pic_state *PIC_UNUSED(pic), void *cookie, char *ptr, int size) {
+  FILE *file = cookie;
+  int r = 0, c;
+
+  /* fill the buffer, but never wait for input past the end of a line */
+  while (r < size && (c = getc(file)) != EOF) {
+    ptr[r++] = (char) c;
+    if (c == '\n')
+      break;
+  }
+  return file_read_end(file, r);
+}
+
+#endif
+
 static int
 file_write(pic_state *PIC_UNUSED(pic), void *cookie, const char *ptr, int size) {
   FILE *file = cookie;
@@ -68,10 +131,11 @@ file_close(pic_state *PIC_UNUSED(pic), void *cookie) {
 pic_value
 pic_fopen(pic_state *pic, FILE *fp, const char *mode) {
   static const pic_port_type file_rd = { file_read, 0, file_seek, file_close };
+  static const pic_port_type stream_rd = { stream_read, 0, file_seek, file_close };
   static const pic_port_type file_wr = { 0, file_write, file_seek, file_close };
 
   if (*mode == 'r') {
-    return pic_funopen(pic, fp, &file_rd);
+    return pic_funopen(pic, fp, file_regular_p(fp) ? &file_rd : &stream_rd);
   } else {
     return pic_funopen(pic, fp, &file_wr);
   }
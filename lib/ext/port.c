@@ -4,6 +4,8 @@
 
 #include <picrin.h>
 #include <picrin/extra.h>
+#include "../value.h"
+#include "../object.h"
 
 #if PIC_USE_PORT
 
@@ -350,7 +352,8 @@ pic_fwrite(pic_state *pic, const void *ptr, size_t size, size_t count, pic_value
     fp->ptr += fp->cnt;
     bptr += fp->cnt;
     nbytes -= fp->cnt;
-    if (flushbuf(pic, EOF, fp) == EOF) {
+    /* flushbuf also returns EOF on success when given EOF */
+    if (flushbuf(pic, EOF, fp) == EOF && (fp->flag & (FILE_WRITE|FILE_ERR|FILE_UNBUF)) != FILE_WRITE) {
       return (size * count - nbytes) / size;
     }
   }
@@ -488,6 +491,36 @@ pic_fmemopen(pic_state *pic, const char *data, int size, const char *mode)
   }
 }
 
+/* reads a bytevector where it lies, holding on to its memory until closed */
+typedef struct { xbuf_t m; struct blob_buffer *owner; } blobbuf_t;
+
+static int
+blob_close(pic_state *pic, void *cookie)
+{
+  blobbuf_t *b = cookie;
+
+  pic_blob_release(pic, b->owner);
+  pic_free(pic, b);
+  return 0;
+}
+
+static pic_value
+pic_blob_open(pic_state *pic, pic_value blob)
+{
+  static const pic_port_type blob_rd = { string_read, 0, string_seek, blob_close };
+  blobbuf_t *b;
+  int len;
+
+  b = pic_malloc(pic, sizeof(blobbuf_t));
+  b->m.buf = (char *) pic_blob(pic, blob, &len);
+  b->m.pos = 0;
+  b->m.end = len;
+  b->m.capa = len;
+  b->owner = pic_blob_share(pic, blob);
+
+  return pic_funopen(pic, b, &blob_rd);
+}
+
 static int
 pic_fgetbuf(pic_state *pic, pic_value port, const char **buf, int *len)
 {
@@ -622,12 +655,13 @@ check_port_type(pic_state *pic, pic_value obj, int flags)
 static pic_value
 pic_port_open_input_bytevector(pic_state *pic)
 {
-  unsigned char *buf;
-  int len;
+  pic_value blob;
 
-  pic_get_args(pic, "b", &buf, &len);
+  pic_get_args(pic, "o", &blob);
 
-  return pic_fmemopen(pic, (char *)buf, len, "r");
+  TYPE_CHECK(pic, blob, blob);
+
+  return pic_blob_open(pic, blob);
 }
 
 static pic_value
@@ -728,6 +762,63 @@ pic_port_peek_u8(pic_state *pic)
   return pic_int_value(pic, c);
 }
 
+/*
+ * Chars are read as UTF-8. A malformed sequence reads as U+FFFD and
+ * only its maximal valid prefix is consumed.
+ */
+
+static int
+getch(pic_state *pic, struct port *fp)
+{
+  char buf[4];
+  int c, w, i;
+
+  if ((c = getc_(pic, fp)) == EOF || (w = pic_utf8_width(c)) == 1) {
+    return c;
+  }
+  buf[0] = (char) c;
+  for (i = 1; i < w; ++i) {
+    if ((c = getc_(pic, fp)) == EOF)
+      break;
+    if ((c & 0xc0) != 0x80) {
+      fp->ptr--;                /* push back the byte just read */
+      fp->cnt++;
+      break;
+    }
+    buf[i] = (char) c;
+  }
+  pic_utf8_decode(buf, w == 0 ? 1 : i, &c);
+  return c;
+}
+
+/* a char that straddles the end of the buffer is moved to its front and completed there */
+static int
+peekch(pic_state *pic, struct port *fp)
+{
+  int c, w, n;
+
+  if (fp->cnt <= 0) {
+    if (fillbuf(pic, fp) == EOF)
+      return EOF;
+    fp->ptr--;
+    fp->cnt++;
+  }
+  w = pic_utf8_width(*fp->ptr);
+  if (w > fp->cnt && (fp->flag & FILE_UNBUF) == 0) {
+    memmove(fp->base, fp->ptr, fp->cnt);
+    fp->ptr = fp->base;
+    while (fp->cnt < w && (fp->flag & (FILE_EOF|FILE_ERR)) == 0) {
+      if ((n = fp->vtable->read(pic, fp->cookie, fp->base + fp->cnt, PIC_BUFSIZ - fp->cnt)) <= 0) {
+        fp->flag |= n == 0 ? FILE_EOF : FILE_ERR;
+        break;
+      }
+      fp->cnt += n;
+    }
+  }
+  pic_utf8_decode(fp->ptr, fp->cnt, &c);
+  return c;
+}
+
 static pic_value
 pic_port_read_char(pic_state *pic)
 {
@@ -738,7 +829,7 @@ pic_port_read_char(pic_state *pic)
 
   check_port_type(pic, port, FILE_READ);
 
-  if ((c = pic_fgetc(pic, port)) == EOF) {
+  if ((c = getch(pic, pic_data(pic, port))) == EOF) {
     return pic_eof_object(pic);
   }
   return pic_char_value(pic, c);
@@ -754,11 +845,9 @@ pic_port_peek_char(pic_state *pic)
 
   check_port_type(pic, port, FILE_READ);
 
-  c = pic_fgetc(pic, port);
-  if (c == EOF) {
+  if ((c = peekch(pic, pic_data(pic, port))) == EOF) {
     return pic_eof_object(pic);
   }
-  pic_ungetc(pic, c, port);
   return pic_char_value(pic, c);
 }
 
@@ -814,53 +903,126 @@ pic_port_read_bytevector(pic_state *pic)
   return blob;
 }
 
+/*
+ * Copy bytes out of the port buffer up to (and consuming, but not
+ * copying) delim, or until limit UTF-8 chars have been read. Each buffer
+ * load is searched with memchr, or walked counting chars, and copied as
+ * one span. Chars are counted the way pic_utf8_decode splits them, so a
+ * truncated or malformed sequence counts as the one U+FFFD it becomes.
+ * Returns a buffer suitable for pic_make_str, or NULL if the port was
+ * already at EOF.
+ */
+static char *
+read_span(pic_state *pic, struct port *fp, int delim, long limit, int *len)
+{
+  char *buf = NULL, *end = NULL;
+  long n = 0, size = 0, span, i, k = 0;
+  int c, a, b, need = 0, lo = 0x80, hi = 0xbf;
+
+  while (k < limit || need > 0) {
+    if (fp->cnt <= 0) {
+      if ((c = fillbuf(pic, fp)) == EOF) {
+        if (buf == NULL)
+          return NULL;
+        break;
+      }
+      fp->ptr--;                /* push back the char fillbuf consumed */
+      fp->cnt++;
+    }
+    span = fp->cnt;
+    if (delim != EOF) {
+      if ((end = memchr(fp->ptr, delim, span)) != NULL) {
+        span = end - fp->ptr;
+      }
+    } else {
+      i = 0;
+      while (i < span) {
+        b = fp->ptr[i] & 0xff;
+        if (need > 0) {
+          if (lo <= b && b <= hi) {
+            need--;
+            lo = 0x80;
+            hi = 0xbf;
+            i++;
+            continue;
+          }
+          need = 0;             /* truncated; b starts the next char */
+        }
+        if (k >= limit)
+          break;
+        if ((a = pic_utf8_ascii_span(fp->ptr + i, (int) (span - i < limit - k ? span - i : limit - k))) > 0) {
+          i += a;
+          k += a;
+          continue;
+        }
+        k++;
+        need = pic_utf8_width(b) - 1;
+        lo = b == 0xe0 ? 0xa0 : b == 0xf0 ? 0x90 : 0x80;
+        hi = b == 0xed ? 0x9f : b == 0xf4 ? 0x8f : 0xbf;
+        i++;
+      }
+      span = i;
+    }
+    if (n + span + 1 > size) {
+      size = n + span + 1 > size * 2 ? n + span + 1 : size * 2;
+      buf = pic_realloc(pic, buf, size);
+    }
+    memcpy(buf + n, fp->ptr, span);
+    n += span;
+    fp->ptr += span;
+    fp->cnt -= span;
+    if (end != NULL) {
+      fp->ptr++;
+      fp->cnt--;
+      break;
+    }
+  }
+  *len = (int) n;
+  return buf;
+}
+
 static pic_value
 pic_port_read_string(pic_state *pic)
 {
-  pic_value port = pic_stdin(pic), blob;
-  int n, k, i;
+  pic_value port;
+  int k, len;
   char *buf;
 
-  n = pic_get_args(pic, "i|o", &k, &port);
+  if (pic_get_args(pic, "i|o", &k, &port) < 2) {
+    port = pic_stdin(pic);
+  }
 
   check_port_type(pic, port, FILE_READ);
 
-  buf = pic_malloc(pic, k);
-
-  i = pic_fread(pic, buf, 1, k, port);
-  if (i == 0) {
-    pic_free(pic, buf);
+  if (k < 0) {
+    pic_error(pic, "read-string: negative length given", 1, pic_int_value(pic, k));
+  }
+  if (k == 0) {
+    return pic_str_value(pic, "", 0);
+  }
+  if ((buf = read_span(pic, pic_data(pic, port), EOF, k, &len)) == NULL) {
     return pic_eof_object(pic);
   }
-  blob = pic_str_value(pic, buf, i);
-  pic_free(pic, buf);
-  return blob;
+  return pic_make_str(pic, buf, len);
 }
 
 static pic_value
 pic_port_read_line(pic_state *pic)
 {
-  pic_value port = pic_stdin(pic), str;
-  int c;
-  char s[1];
+  pic_value port;
+  int len;
+  char *buf;
 
-  pic_get_args(pic, "|o", &port);
+  if (pic_get_args(pic, "|o", &port) < 1) {
+    port = pic_stdin(pic);
+  }
 
   check_port_type(pic, port, FILE_READ);
 
-  if ((c = pic_fgetc(pic, port)) == EOF) {
+  if ((buf = read_span(pic, pic_data(pic, port), '\n', INT_MAX, &len)) == NULL) {
     return pic_eof_object(pic);
   }
-  s[0] = c;
-  str = pic_str_value(pic, s, 1);
-
-  while ((c = pic_fgetc(pic, port)) != EOF) {
-    if (c == '\n')
-      break;
-    s[0] = c;
-    str = pic_str_cat(pic, str, pic_str_value(pic, s, 1));
-  }
-  return str;
+  return pic_make_str(pic, buf, len);
 }
 
 static pic_value
@@ -880,14 +1042,15 @@ pic_port_write_u8(pic_state *pic)
 static pic_value
 pic_port_write_char(pic_state *pic)
 {
-  char c;
+  int c;
+  char buf[4];
   pic_value port = pic_stdout(pic);
 
   pic_get_args(pic, "c|o", &c, &port);
 
   check_port_type(pic, port, FILE_WRITE);
 
-  pic_fputc(pic, c, port);
+  pic_fwrite(pic, buf, pic_utf8_encode(c, buf), 1, port);
   return pic_undef_value(pic);
 }
 
@@ -934,16 +1097,28 @@ pic_port_write_bytevector(pic_state *pic)
   return pic_undef_value(pic);
 }
 
+static int
+utf8_offset(const char *s, int k)
+{
+  int off = 0;
+
+  while (k-- > 0) {
+    off += pic_utf8_width(s[off]);
+  }
+  return off;
+}
+
 static pic_value
 pic_port_write_string(pic_state *pic)
 {
   pic_value str, port;
-  int n, start, end, len, done;
+  int n, start, end, len, size, done;
   const char *buf;
 
   n = pic_get_args(pic, "s|oii", &str, &port, &start, &end);
 
-  buf = pic_str(pic, str, &len);
+  buf = pic_str(pic, str, &size);
+  len = pic_str_len(pic, str);
 
   switch (n) {
   case 1:
@@ -958,6 +1133,12 @@ pic_port_write_string(pic_state *pic)
 
   check_port_type(pic, port, FILE_WRITE);
 
+  if (len != size) {
+    /* not ASCII: turn char indices into byte offsets */
+    end = utf8_offset(buf, end);
+    start = utf8_offset(buf, start);
+  }
+
   done = 0;
   while (done < end - start) {
     done += pic_fwrite(pic, buf + start + done, 1, end - start - done, port);
@@ -217,41 +217,54 @@ read_syntax_unquote(pic_state *pic, pic_value port, int PIC_UNUSED(c), struct re
   return pic_list(pic, 2, tag, read_core(pic, port, next(pic, port), p));
 }
 
-static pic_value
-read_atom(pic_state *pic, pic_value port, int c, struct reader_control *p) {
-  int len;
+/* returns a buffer of *len bytes, which the caller frees */
+static char *
+read_atom(pic_state *pic, pic_value port, int c, struct reader_control *p, int *len)
+{
+  int n;
   char *buf;
-  pic_value str;
 
-  len = 1;
-  buf = pic_malloc(pic, len + 1);
+  n = 1;
+  buf = pic_malloc(pic, n + 1);
   buf[0] = case_fold(c, p);
   buf[1] = 0;
 
   while (! isdelim(peek(pic, port))) {
     c = next(pic, port);
-    len += 1;
-    buf = pic_realloc(pic, buf, len + 1);
-    buf[len - 1] = case_fold(c, p);
-    buf[len] = 0;
+    n += 1;
+    buf = pic_realloc(pic, buf, n + 1);
+    buf[n - 1] = case_fold(c, p);
+    buf[n] = 0;
   }
 
-  str = pic_str_value(pic, buf, len);
-  pic_free(pic, buf);
-
-  return str;
+  *len = n;
+  return buf;
 }
 
 static pic_value
 read_symbol(pic_state *pic, pic_value port, int c, struct reader_control *p)
 {
-  return pic_intern(pic, read_atom(pic, port, c, p));
+  pic_value sym;
+  char *buf;
+  int len;
+
+  buf = read_atom(pic, port, c, p, &len);
+  sym = pic_intern_str(pic, buf, len);
+  pic_free(pic, buf);
+
+  return sym;
 }
 
 static pic_value
 read_number(pic_state *pic, pic_value port, int c, struct reader_control *p)
 {
-  pic_value str = read_atom(pic, port, c, p), num;
+  pic_value str, num;
+  char *buf;
+  int len;
+
+  buf = read_atom(pic, port, c, p, &len);
+  str = pic_str_value(pic, buf, len);
+  pic_free(pic, buf);
 
   num = pic_funcall(pic, "string->number", 1, str);
   if (! pic_false_p(pic, num)) {
@@ -291,10 +304,16 @@ read_true(pic_state *pic, pic_value port, int c, struct reader_control *PIC_UNUS
   return pic_true_value(pic);
 }
 
+static int read_width(pic_state *, pic_value port);
+static pic_value read_uvector(pic_state *, pic_value port, int tag, int nbits, struct reader_control *);
+
 static pic_value
-read_false(pic_state *pic, pic_value port, int c, struct reader_control *PIC_UNUSED(p))
+read_false(pic_state *pic, pic_value port, int c, struct reader_control *p)
 {
-  if ((c = peek(pic, port)) == 'a') {
+  if (isdigit(c = peek(pic, port))) {
+    return read_uvector(pic, port, 'f', read_width(pic, port), p);
+  }
+  if (c == 'a') {
     if (! expect(pic, port, "alse")) {
       read_error(pic, "unexpected character while reading #false", 0);
     }
@@ -305,14 +324,76 @@ read_false(pic_state *pic, pic_value port, int c, struct reader_control *PIC_UNU
   return pic_false_value(pic);
 }
 
+static int
+read_utf8(pic_state *pic, pic_value port, int c)
+{
+  char buf[4];
+  int w, i;
+
+  if ((w = pic_utf8_width(c)) <= 1) {
+    return w == 1 ? c : 0xfffd;
+  }
+  buf[0] = (char) c;
+  for (i = 1; i < w && (peek(pic, port) & 0xc0) == 0x80; ++i) {
+    buf[i] = (char) next(pic, port);
+  }
+  pic_utf8_decode(buf, i, &c);
+  return c;
+}
+
+static int
+read_hex_escape(pic_state *pic, pic_value port)
+{
+  int c, n = 0, d;
+
+  while ((c = next(pic, port)) != ';') {
+    if (isdigit(c)) {
+      d = c - '0';
+    } else if ('a' <= tolower(c) && tolower(c) <= 'f') {
+      d = tolower(c) - 'a' + 10;
+    } else {
+      read_error(pic, "expected ';'", 1, pic_int_value(pic, c));
+    }
+    if (n > 0x10ffff) {
+      read_error(pic, "hex escape out of range", 0);
+    }
+    n = n * 16 + d;
+  }
+  if (n > 0x10ffff || (0xd800 <= n && n < 0xe000)) {
+    read_error(pic, "hex escape out of range", 1, pic_int_value(pic, n));
+  }
+  return n;
+}
+
 static pic_value
 read_char(pic_state *pic, pic_value port, int c, struct reader_control *PIC_UNUSED(p))
 {
-  c = next(pic, port);
+  int d;
+
+  c = read_utf8(pic, port, next(pic, port));
 
   if (! isdelim(peek(pic, port))) {
     switch (c) {
     default: read_error(pic, "unexpected character after char literal", 1, pic_char_value(pic, c));
+    case 'x':
+      c = 0;
+      while (! isdelim(d = peek(pic, port))) {
+        next(pic, port);
+        if (isdigit(d)) {
+          c = c * 16 + d - '0';
+        } else if ('a' <= tolower(d) && tolower(d) <= 'f') {
+          c = c * 16 + tolower(d) - 'a' + 10;
+        } else {
+          goto fail;
+        }
+        if (c > 0x10ffff) {
+          goto fail;
+        }
+      }
+      if (0xd800 <= c && c < 0xe000) {
+        read_error(pic, "surrogate code point in character literal", 1, pic_int_value(pic, c));
+      }
+      break;
     case 'a': c = '\a'; if (! expect(pic, port, "larm")) goto fail; break;
     case 'b': c = '\b'; if (! expect(pic, port, "ackspace")) goto fail; break;
     case 'd': c = 0x7F; if (! expect(pic, port, "elete")) goto fail; break;
@@ -334,7 +415,7 @@ read_char(pic_state *pic, pic_value port, int c, struct reader_control *PIC_UNUS
     }
   }
 
-  return pic_char_value(pic, (char)c);
+  return pic_char_value(pic, c);
 
  fail:
   read_error(pic, "unexpected character while reading character literal", 1, pic_char_value(pic, c));
@@ -361,10 +442,12 @@ read_string(pic_state *pic, pic_value port, int c, struct reader_control *PIC_UN
       case 't': c = '\t'; break;
       case 'n': c = '\n'; break;
       case 'r': c = '\r'; break;
+      case 'x': cnt += pic_utf8_encode(read_hex_escape(pic, port), buf + cnt); goto grow;
       }
     }
     buf[cnt++] = (char)c;
-    if (cnt >= size) {
+  grow:
+    if (cnt + 4 >= size) {
       buf = pic_realloc(pic, buf, size *= 2);
     }
   }
@@ -381,9 +464,6 @@ read_pipe(pic_state *pic, pic_value port, int c, struct reader_control *PIC_UNUS
   char *buf;
   int size, cnt;
   pic_value sym;
-  /* Currently supports only ascii chars */
-  char HEX_BUF[3];
-  size_t i = 0;
 
   size = 256;
   buf = pic_malloc(pic, size);
@@ -396,29 +476,73 @@ read_pipe(pic_state *pic, pic_value port, int c, struct reader_control *PIC_UNUS
       case 't': c = '\t'; break;
       case 'n': c = '\n'; break;
       case 'r': c = '\r'; break;
-      case 'x':
-        i = 0;
-        while ((HEX_BUF[i++] = (char)next(pic, port)) != ';') {
-          if (i >= sizeof HEX_BUF)
-            read_error(pic, "expected ';'", 1, pic_char_value(pic, HEX_BUF[sizeof(HEX_BUF) - 1]));
-        }
-        c = (char)strtol(HEX_BUF, NULL, 16);
-        break;
+      case 'x': cnt += pic_utf8_encode(read_hex_escape(pic, port), buf + cnt); goto grow;
       }
     }
     buf[cnt++] = (char)c;
-    if (cnt >= size) {
+  grow:
+    if (cnt + 4 >= size) {
       buf = pic_realloc(pic, buf, size *= 2);
     }
   }
   buf[cnt] = '\0';
 
-  sym = pic_intern_cstr(pic, buf);
+  sym = pic_intern_str(pic, buf, cnt);
   pic_free(pic, buf);
 
   return sym;
 }
 
+/* the bit width after #u, #s or #f, up to and including the '(' */
+static int
+read_width(pic_state *pic, pic_value port)
+{
+  int nbits = 0, c;
+
+  while (isdigit(c = next(pic, port))) {
+    nbits = 10 * nbits + c - '0';
+  }
+
+  if (c != '(') {
+    read_error(pic, "expected '(' character", 1, pic_char_value(pic, c));
+  }
+  return nbits;
+}
+
+/* #s8(...), #u16(...), #f64(...) and so on, but #u8(...) is read_blob */
+static pic_value
+read_uvector(pic_state *pic, pic_value port, int tag, int nbits, struct reader_control *p)
+{
+  static const struct {
+    char tag;
+    int nbits;
+  } kinds[] = {                 /* in the order of PIC_UVEC_U8 ... */
+    { 'u', 8 }, { 's', 8 }, { 'u', 16 }, { 's', 16 }, { 'u', 32 },
+    { 's', 32 }, { 'u', 64 }, { 's', 64 }, { 'f', 32 }, { 'f', 64 }
+  };
+  pic_value list, it, elem, uvec;
+  int kind, i = 0;
+
+  for (kind = 0; kind < (int) (sizeof kinds / sizeof kinds[0]); ++kind) {
+    if (kinds[kind].tag == tag && kinds[kind].nbits == nbits) {
+      break;
+    }
+  }
+  if (kind == (int) (sizeof kinds / sizeof kinds[0])) {
+    read_error(pic, "unsupported numeric vector bit width", 1, pic_int_value(pic, nbits));
+  }
+
+  list = read_core(pic, port, '(', p);
+
+  uvec = pic_make_uvec(pic, kind, pic_length(pic, list));
+
+  pic_for_each (elem, list, it) {
+    pic_uvec_set(pic, uvec, i++, elem);
+  }
+
+  return uvec;
+}
+
 static pic_value
 read_blob(pic_state *pic, pic_value port, int c, struct reader_control *p)
 {
@@ -427,18 +551,10 @@ read_blob(pic_state *pic, pic_value port, int c, struct reader_control *p)
   unsigned char *dat;
   pic_value blob;
 
-  nbits = 0;
-
-  while (isdigit(c = next(pic, port))) {
-    nbits = 10 * nbits + c - '0';
-  }
+  nbits = read_width(pic, port);
 
   if (nbits != 8) {
-    read_error(pic, "unsupported bytevector bit width", 1, pic_int_value(pic, nbits));
-  }
-
-  if (c != '(') {
-    read_error(pic, "expected '(' character", 1, pic_char_value(pic, c));
+    return read_uvector(pic, port, 'u', nbits, p);
   }
 
   len = 0;
@@ -476,6 +592,12 @@ read_undef_or_blob(pic_state *pic, pic_value port, int c, struct reader_control
   return read_blob(pic, port, 'u', p);
 }
 
+static pic_value
+read_svector(pic_state *pic, pic_value port, int PIC_UNUSED(c), struct reader_control *p)
+{
+  return read_uvector(pic, port, 's', read_width(pic, port), p);
+}
+
 static pic_value
 read_pair(pic_state *pic, pic_value port, int c, struct reader_control *p)
 {
@@ -714,6 +836,7 @@ reader_table_init(void)
   reader_dispatch['\\'] = read_char;
   reader_dispatch['('] = read_vector;
   reader_dispatch['u'] = read_undef_or_blob;
+  reader_dispatch['s'] = read_svector;
 
   /* read labels */
   for (c = '0'; c <= '9'; ++c) {
@@ -72,7 +72,11 @@ traverse(pic_state *pic, pic_value obj, struct writer_control *p)
         }
       } else {
         /* record */
-        traverse(pic, pic_record_datum(pic, obj), p);
+        struct record *rec = rec_ptr(pic, obj);
+        int i;
+        for (i = 0; i < rec->type->nfields; ++i) {
+          traverse(pic, rec->fields[i], p);
+        }
       }
 
       if (p->op == OP_WRITE) {
@@ -134,10 +138,16 @@ write_blob(pic_state *pic, pic_value blob, pic_value port)
 static void
 write_char(pic_state *pic, pic_value ch, pic_value port, struct writer_control *p)
 {
-  char c = pic_char(pic, ch);
+  int c = pic_char(pic, ch);
+  char buf[4];
 
   if (p->mode == DISPLAY_MODE) {
-    pic_fputc(pic, c, port);
+    pic_fwrite(pic, buf, pic_utf8_encode(c, buf), 1, port);
+    return;
+  }
+  if (c < 0x20 && strchr("\a\b\x1b\n\r\t", c) == NULL) {
+    static const char digits[] = "0123456789abcdef";
+    pic_fprintf(pic, port, "#\\x%c%c", digits[c / 16], digits[c % 16]);
     return;
   }
   switch (c) {
@@ -150,6 +160,7 @@ write_char(pic_state *pic, pic_value ch, pic_value port, struct writer_control *
   case '\r': pic_fprintf(pic, port, "#\\return"); break;
   case ' ': pic_fprintf(pic, port, "#\\space"); break;
   case '\t': pic_fprintf(pic, port, "#\\tab"); break;
+  case '\0': pic_fprintf(pic, port, "#\\null"); break;
   }
 }
 
@@ -281,6 +292,29 @@ write_vec(pic_state *pic, pic_value vec, pic_value port, struct writer_control *
   pic_fprintf(pic, port, ")");
 }
 
+static void
+write_uvec(pic_state *pic, pic_value uvec, pic_value port, struct writer_control *p)
+{
+  static const char *const tags[] = {
+    "u8", "s8", "u16", "s16", "u32", "s32", "u64", "s64", "f32", "f64"
+  };
+  size_t ai;
+  int kind, i, len;
+
+  pic_uvec(pic, uvec, &kind, &len);
+
+  pic_fprintf(pic, port, "#%s(", tags[kind]);
+  for (i = 0; i < len; ++i) {
+    ai = pic_enter(pic);
+    write_core(pic, pic_uvec_ref(pic, uvec, i), port, p);
+    pic_leave(pic, ai);
+    if (i + 1 < len) {
+      pic_fprintf(pic, port, " ");
+    }
+  }
+  pic_fprintf(pic, port, ")");
+}
+
 static void
 write_dict(pic_state *pic, pic_value dict, pic_value port, struct writer_control *p)
 {
@@ -300,10 +334,15 @@ write_dict(pic_state *pic, pic_value dict, pic_value port, struct writer_control
 static void
 write_record(pic_state *pic, pic_value obj, pic_value port, struct writer_control *p)
 {
+  struct record *rec = rec_ptr(pic, obj);
+  int i;
+
   pic_fprintf(pic, port, "#<");
-  write_core(pic, pic_record_type(pic, obj), port, p);
-  pic_fprintf(pic, port, " ");
-  write_core(pic, pic_record_datum(pic, obj), port, p);
+  write_core(pic, rec->type->name, port, p);
+  for (i = 0; i < rec->type->nfields; ++i) {
+    pic_fprintf(pic, port, " ");
+    write_core(pic, rec->fields[i], port, p);
+  }
   pic_fprintf(pic, port, ">");
 }
 
@@ -320,6 +359,8 @@ typename(pic_state *pic, pic_value obj)
     return "float";
   case PIC_TYPE_INT:
     return "int";
+  case PIC_TYPE_BIGNUM:
+    return "bignum";
   case PIC_TYPE_SYMBOL:
     return "symbol";
   case PIC_TYPE_CHAR:
@@ -349,10 +390,18 @@ typename(pic_state *pic, pic_value obj)
     return "data";
   case PIC_TYPE_DICT:
     return "dictionary";
+  case PIC_TYPE_TABLE:
+    return "hash-table";
+  case PIC_TYPE_ARRAY:
+    return "array";
+  case PIC_TYPE_UVECTOR:
+    return "numeric-vector";
   case PIC_TYPE_ATTR:
     return "attribute";
   case PIC_TYPE_RECORD:
     return "record";
+  case PIC_TYPE_RECORD_TYPE:
+    return "record-type";
   default:
     pic_error(pic, "typename: invalid type given", 1, obj);
   }
@@ -392,7 +441,10 @@ write_core(pic_state *pic, pic_value obj, pic_value port, struct writer_control
     pic_fprintf(pic, port, "#.(eof-object)");
     break;
   case PIC_TYPE_INT:
-    pic_fprintf(pic, port, "%d", pic_int(pic, obj));
+    pic_fprintf(pic, port, "%ld", pic_int(pic, obj));
+    break;
+  case PIC_TYPE_BIGNUM:
+    pic_fputs(pic, pic_cstr(pic, pic_funcall(pic, "number->string", 1, obj), NULL), port);
     break;
   case PIC_TYPE_SYMBOL:
     write_symbol(pic, obj, port);
@@ -415,6 +467,9 @@ write_core(pic_state *pic, pic_value obj, pic_value port, struct writer_control
   case PIC_TYPE_VECTOR:
     write_vec(pic, obj, port, p);
     break;
+  case PIC_TYPE_UVECTOR:
+    write_uvec(pic, obj, port, p);
+    break;
   case PIC_TYPE_DICT:
     write_dict(pic, obj, port, p);
     break;
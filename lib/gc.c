@@ -2,6 +2,10 @@
  * See Copyright Notice in picrin.h
  */
 
+#if ! defined(_POSIX_C_SOURCE)
+# define _POSIX_C_SOURCE 200112L /* for clock_gettime */
+#endif
+
 #include <picrin.h>
 #include "value.h"
 #include "object.h"
@@ -89,11 +93,33 @@ pic_alloca(pic_state *pic, size_t n)
 
 /* GC */
 
+#if PIC_USE_LIBC
+# include <time.h>
+#endif
+
+static double
+gc_clock(void)
+{
+#if PIC_USE_LIBC && defined(CLOCK_MONOTONIC)
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+#else
+  return 0;
+#endif
+}
+
+KHASH_DEFINE(ephemeron, struct object *, int, kh_ptr_hash_func, kh_ptr_hash_equal)
+
 #define is_alive(obj) ((obj)->tt & GC_MARK)
 #define mark(obj) ((obj)->tt |= GC_MARK)
 #define unmark(obj) ((obj)->tt &= ~GC_MARK)
 
 static void gc_mark_object(pic_state *, struct object *);
+static void gc_ephemeron_reached(pic_state *, struct object *);
+static size_t type2size(int);
+static size_t obj_size(struct object *);
 
 static void
 gc_mark(pic_state *pic, pic_value v)
@@ -114,6 +140,10 @@ gc_mark_object(pic_state *pic, struct object *obj)
 
   mark(obj);
 
+  if (pic->gc_eph.pending.size > 0) {
+    gc_ephemeron_reached(pic, obj);
+  }
+
 #define LOOP(o) obj = (struct object *)(o); goto loop
 
   switch (obj_type(obj)) {
@@ -170,6 +200,14 @@ gc_mark_object(pic_state *pic, struct object *obj)
     }
     break;
   }
+  case PIC_TYPE_ARRAY: {
+    struct array *ary = (struct array *) obj;
+    int i;
+    for (i = 0; i < ary->len; ++i) {
+      gc_mark(pic, ary->data[(ary->head + i) & (ary->cap - 1)]);
+    }
+    break;
+  }
   case PIC_TYPE_DICT: {
     struct dict *dict = (struct dict *) obj;
     khash_t(dict) *h = &dict->hash;
@@ -184,8 +222,40 @@ gc_mark_object(pic_state *pic, struct object *obj)
   }
   case PIC_TYPE_RECORD: {
     struct record *rec = (struct record *) obj;
-    gc_mark(pic, rec->datum);
-    LOOP(rec->type);
+    int i, n = rec->type->nfields;
+    gc_mark_object(pic, (struct object *) rec->type);
+    if (n == 0) {
+      break;
+    }
+    for (i = 0; i < n - 1; ++i) {
+      gc_mark(pic, rec->fields[i]);
+    }
+    if (pic_obj_p(pic, rec->fields[n - 1])) {
+      LOOP(pic_ptr(pic, rec->fields[n - 1])); /* records linked through their last field */
+    }
+    break;
+  }
+  case PIC_TYPE_RECORD_TYPE: {
+    struct record_type *type = (struct record_type *) obj;
+    gc_mark(pic, type->name);
+    gc_mark(pic, type->fields);
+    break;
+  }
+  case PIC_TYPE_TABLE: {
+    struct table *t = (struct table *) obj;
+    int i;
+    for (i = 0; i < t->cap; ++i) {
+      if (t->slots[i].hash > 1) {
+        gc_mark(pic, t->slots[i].key);
+        gc_mark(pic, t->slots[i].val);
+      }
+    }
+    for (i = t->moved; i < t->old_cap; ++i) {
+      if (t->old_slots[i].hash > 1) {
+        gc_mark(pic, t->old_slots[i].key);
+        gc_mark(pic, t->old_slots[i].val);
+      }
+    }
     break;
   }
   case PIC_TYPE_SYMBOL: {
@@ -210,10 +280,18 @@ gc_mark_object(pic_state *pic, struct object *obj)
     LOOP(node->s2);
     break;
   }
+  case PIC_TYPE_ROPE_LEAF: {
+    struct rope_leaf *leaf = (struct rope_leaf *) obj;
+    if (leaf->base) {
+      LOOP(leaf->base);
+    }
+    break;
+  }
 
-  case PIC_TYPE_ROPE_LEAF:
   case PIC_TYPE_BLOB:
+  case PIC_TYPE_UVECTOR:
   case PIC_TYPE_DATA:
+  case PIC_TYPE_BIGNUM:
     break;
 
   default:
@@ -230,9 +308,28 @@ gc_finalize_object(pic_state *pic, struct object *obj)
     pic_free(pic, vec->data);
     break;
   }
+  case PIC_TYPE_ARRAY: {
+    struct array *ary = (struct array *) obj;
+    pic_free(pic, ary->data);
+    break;
+  }
   case PIC_TYPE_BLOB: {
     struct blob *blob = (struct blob *) obj;
-    pic_free(pic, blob->data);
+    if (blob->buf) {
+      pic_blob_release(pic, blob->buf);
+    } else {
+      pic_free(pic, blob->data);
+    }
+    break;
+  }
+  case PIC_TYPE_UVECTOR: {
+    struct uvector *uvec = (struct uvector *) obj;
+    pic_free(pic, uvec->data);
+    break;
+  }
+  case PIC_TYPE_BIGNUM: {
+    struct bignum *big = (struct bignum *) obj;
+    pic_free(pic, big->digits);
     break;
   }
   case PIC_TYPE_DATA: {
@@ -247,6 +344,13 @@ gc_finalize_object(pic_state *pic, struct object *obj)
     kh_destroy(dict, &dict->hash);
     break;
   }
+  case PIC_TYPE_TABLE: {
+    struct table *t = (struct table *) obj;
+    pic_free(pic, t->slots);
+    pic_free(pic, t->old_slots);
+    pic_free(pic, t->next_slots);
+    break;
+  }
   case PIC_TYPE_SYMBOL: {
     /* TODO: remove this symbol's entry from pic->syms immediately */
     break;
@@ -272,7 +376,10 @@ gc_finalize_object(pic_state *pic, struct object *obj)
   }
   case PIC_TYPE_ROPE_LEAF: {
     struct rope_leaf *leaf = (struct rope_leaf *) obj;
-    pic_free(pic, (char *) leaf->str);
+    if (leaf->base == NULL) {
+      pic_free(pic, (char *) leaf->str);
+    }
+    pic_free(pic, leaf->crumbs);
     break;
   }
 
@@ -280,6 +387,7 @@ gc_finalize_object(pic_state *pic, struct object *obj)
   case PIC_TYPE_ROPE_NODE:
   case PIC_TYPE_PAIR:
   case PIC_TYPE_RECORD:
+  case PIC_TYPE_RECORD_TYPE:
   case PIC_TYPE_PROC_FUNC:
   case PIC_TYPE_PROC_IREP:
     break;
@@ -289,22 +397,102 @@ gc_finalize_object(pic_state *pic, struct object *obj)
   }
 }
 
-void
-pic_gc(pic_state *pic)
+/*
+ * Ephemerons
+ *
+ * An attr entry keeps its value alive only while its key is alive. Each
+ * reached attr is scanned once: values of reached keys are marked, and the
+ * others are parked in gc_eph.pending under their key. When gc_mark_object
+ * later reaches a parked key, its values are moved to gc_eph.ready and
+ * marked from the loop below, so every entry is visited a constant number
+ * of times and long key -> value -> key chains do not recurse.
+ */
+
+static void
+gc_ephemeron_reached(pic_state *pic, struct object *key)
 {
-  struct context *cxt;
-  size_t j;
-  khash_t(oblist) *s = &pic->oblist;
-  struct symbol *sym;
+  struct gc_ephemerons *eph = &pic->gc_eph;
+  int it, i;
+
+  it = kh_get(ephemeron, &eph->pending, key);
+  if (it == kh_end(&eph->pending))
+    return;
+
+  for (i = kh_val(&eph->pending, it); i >= 0; i = eph->chain[i].next) {
+    if (eph->nready == eph->ready_size) {
+      eph->ready_size = eph->ready_size * 2 + 16;
+      eph->ready = pic_realloc(pic, eph->ready, sizeof(pic_value) * eph->ready_size);
+    }
+    eph->ready[eph->nready++] = eph->chain[i].val;
+  }
+  kh_del(ephemeron, &eph->pending, it);
+}
+
+static void
+gc_ephemeron_park(pic_state *pic, struct object *key, pic_value val)
+{
+  struct gc_ephemerons *eph = &pic->gc_eph;
+  int it, ret;
+
+  if (eph->nchain == eph->chain_size) {
+    eph->chain_size = eph->chain_size * 2 + 16;
+    eph->chain = pic_realloc(pic, eph->chain, sizeof(*eph->chain) * eph->chain_size);
+  }
+  it = kh_put(ephemeron, &eph->pending, key, &ret);
+  eph->chain[eph->nchain].val = val;
+  eph->chain[eph->nchain].next = ret == 0 ? kh_val(&eph->pending, it) : -1;
+  kh_val(&eph->pending, it) = eph->nchain++;
+}
+
+static void
+gc_mark_ephemerons(pic_state *pic)
+{
+  struct gc_ephemerons *eph = &pic->gc_eph;
+  struct attr *attr, *done = NULL;
+  struct object *key;
+  pic_value val;
+  khash_t(attr) *h;
   int it;
-  struct object *obj, *prev, *next;
 
-  assert(pic->gc_attrs == NULL);
+  while (1) {
+    while (eph->nready > 0) {
+      gc_mark(pic, eph->ready[--eph->nready]);
+    }
+    if ((attr = pic->gc_attrs) == NULL)
+      break;
+    pic->gc_attrs = attr->prev;
+    attr->prev = done;
+    done = attr;
 
-  if (! pic->gc_enable) {
-    return;
+    h = &attr->hash;
+    for (it = kh_begin(h); it != kh_end(h); ++it) {
+      if (! kh_exist(h, it))
+        continue;
+      key = kh_key(h, it);
+      val = kh_val(h, it);
+      if (! pic_obj_p(pic, val))
+        continue;
+      if (is_alive(key)) {
+        gc_mark(pic, val);
+      } else {
+        gc_ephemeron_park(pic, key, val);
+      }
+    }
   }
 
+  /* whatever is still parked belongs to dead keys */
+  kh_clear(ephemeron, &eph->pending);
+  eph->nchain = 0;
+
+  pic->gc_attrs = done;
+}
+
+static void
+gc_mark_phase(pic_state *pic)
+{
+  struct context *cxt;
+  size_t j;
+
   /* scan objects */
 
   for (cxt = pic->cxt; cxt != NULL; cxt = cxt->prev) {
@@ -321,35 +509,648 @@ pic_gc(pic_state *pic)
   gc_mark(pic, pic->globals);
   gc_mark(pic, pic->halt);
 
-  /* scan weak references */
+  gc_mark_ephemerons(pic);
+}
+
+#if PIC_GC_THREADS
+
+/*
+ * Parallel marking
+ *
+ * The mutator is stopped while a pool of marker threads traces the heap.
+ * Mark bits are set with an atomic fetch-or so that each object is scanned
+ * by exactly one marker. Every marker owns a private mark stack and a
+ * shared deque; when some marker is idle, busy markers publish chunks of
+ * their stack to their deque, and idle markers steal from any deque.
+ *
+ * Markers collect the attrs they reach, and the parked ephemeron keys they
+ * mark, which they look up in gc_eph.pending without changing it. Between
+ * rounds the calling thread scans the new attrs, parks entries of unmarked
+ * keys, and pushes the values that became reachable on its own stack; the
+ * next round marks them in parallel. Small batches are drained on the
+ * calling thread alone, so a long key -> value -> key chain does not cost
+ * one round per link. Marking ends when a round leaves nothing behind.
+ */
+
+#include <pthread.h>
+
+#define GC_PAR_CHUNK 64
+#define GC_PAR_LOCAL 4096       /* objects scanned on the calling thread before it calls a round */
+
+#define par_type(obj) (__atomic_load_n(&(obj)->tt, __ATOMIC_RELAXED) & TYPE_MASK)
+#define par_mark(obj) ((__atomic_fetch_or(&(obj)->tt, GC_MARK, __ATOMIC_RELAXED) & GC_MARK) == 0)
+
+struct gc_worker {
+  int id;
+  pic_state *pic;
+  struct gc_pool *pool;
+  pthread_t thread;
+
+  /* private mark stack */
+  struct object **stack;
+  size_t sp, stack_size;
+
+  /* shared deque, guarded by lock */
+  pthread_mutex_t lock;
+  struct object **deque;
+  size_t dn, deque_size;
+
+  struct attr *attrs;           /* attrs reached by this marker */
+
+  /* parked ephemeron keys marked by this marker */
+  struct object **keys;
+  size_t nkeys, keys_size;
+  bool alone;                   /* no round is running, so gc_eph may be updated at once */
+};
+
+struct gc_pool {
+  int size;                     /* number of workers, including the caller */
+  int nthreads;                 /* workers taking part in the current round */
+  struct gc_worker workers[PIC_GC_THREADS];
+
+  pthread_mutex_t lock;
+  pthread_cond_t start, work, finish;
+  unsigned long round;
+  int running, idle;
+  size_t nshared;
+  bool done, quit;
+};
+
+static struct object **
+gc_par_grow(struct object **buf, size_t *size, size_t n)
+{
+  /* markers cannot unwind through panicf, so use libc directly */
+  if (*size >= n)
+    return buf;
+  while (*size < n) {
+    *size = *size * 2 + GC_PAR_CHUNK;
+  }
+  buf = realloc(buf, *size * sizeof(struct object *));
+  if (buf == NULL) {
+    abort();
+  }
+  return buf;
+}
+
+static void
+gc_par_mark_object(struct gc_worker *w, struct object *obj)
+{
+  pic_state *pic = w->pic;
+  khash_t(ephemeron) *pending = &pic->gc_eph.pending;
+
+  if (! par_mark(obj))
+    return;
+
+  /* pending is only written between rounds */
+  if (pending->size > 0) {
+    if (w->alone) {
+      gc_ephemeron_reached(pic, obj);
+    } else if (kh_get(ephemeron, pending, obj) != kh_end(pending)) {
+      if (w->nkeys == w->keys_size) {
+        w->keys = gc_par_grow(w->keys, &w->keys_size, w->nkeys + 1);
+      }
+      w->keys[w->nkeys++] = obj;
+    }
+  }
 
-  do {
-    struct object *key;
-    pic_value val;
+  if (w->sp == w->stack_size) {
+    w->stack = gc_par_grow(w->stack, &w->stack_size, w->sp + 1);
+  }
+  w->stack[w->sp++] = obj;
+}
+
+static void
+gc_par_mark(struct gc_worker *w, pic_value v)
+{
+  if (! pic_obj_p(w->pic, v))
+    return;
+
+  gc_par_mark_object(w, pic_ptr(w->pic, v));
+}
+
+static void
+gc_par_scan(struct gc_worker *w, struct object *obj)
+{
+  switch (par_type(obj)) {
+  case PIC_TYPE_PAIR: {
+    struct pair *pair = (struct pair *) obj;
+    gc_par_mark(w, pair->car);
+    gc_par_mark(w, pair->cdr);
+    break;
+  }
+  case PIC_TYPE_FRAME: {
+    struct frame *frame = (struct frame *) obj;
+    int i;
+    for (i = 0; i < frame->regc; ++i) {
+      gc_par_mark(w, frame->regs[i]);
+    }
+    if (frame->up) {
+      gc_par_mark_object(w, (struct object *) frame->up);
+    }
+    break;
+  }
+  case PIC_TYPE_PROC_FUNC: {
+    struct proc *proc = (struct proc *) obj;
+    if (proc->env) {
+      gc_par_mark_object(w, (struct object *) proc->env);
+    }
+    break;
+  }
+  case PIC_TYPE_PROC_IREP: {
+    struct proc *proc = (struct proc *) obj;
+    if (proc->env) {
+      gc_par_mark_object(w, (struct object *) proc->env);
+    }
+    gc_par_mark_object(w, (struct object *) proc->u.irep);
+    break;
+  }
+  case PIC_TYPE_IREP: {
+    struct irep *irep = (struct irep *) obj;
+    size_t i;
+    for (i = 0; i < irep->objc; ++i) {
+      gc_par_mark(w, irep->obj[i]);
+    }
+    for (i = 0; i < irep->irepc; ++i) {
+      gc_par_mark_object(w, (struct object *) irep->irep[i]);
+    }
+    break;
+  }
+  case PIC_TYPE_VECTOR: {
+    struct vector *vec = (struct vector *) obj;
+    int i;
+    for (i = 0; i < vec->len; ++i) {
+      gc_par_mark(w, vec->data[i]);
+    }
+    break;
+  }
+  case PIC_TYPE_ARRAY: {
+    struct array *ary = (struct array *) obj;
+    int i;
+    for (i = 0; i < ary->len; ++i) {
+      gc_par_mark(w, ary->data[(ary->head + i) & (ary->cap - 1)]);
+    }
+    break;
+  }
+  case PIC_TYPE_DICT: {
+    struct dict *dict = (struct dict *) obj;
+    khash_t(dict) *h = &dict->hash;
     int it;
-    khash_t(attr) *h;
-    struct attr *attr;
+    for (it = 0; it != kh_end(h); ++it) {
+      if (kh_exist(h, it)) {
+        gc_par_mark_object(w, (struct object *) kh_key(h, it));
+        gc_par_mark(w, kh_val(h, it));
+      }
+    }
+    break;
+  }
+  case PIC_TYPE_RECORD: {
+    struct record *rec = (struct record *) obj;
+    int i;
+    for (i = 0; i < rec->type->nfields; ++i) {
+      gc_par_mark(w, rec->fields[i]);
+    }
+    gc_par_mark_object(w, (struct object *) rec->type);
+    break;
+  }
+  case PIC_TYPE_RECORD_TYPE: {
+    struct record_type *type = (struct record_type *) obj;
+    gc_par_mark(w, type->name);
+    gc_par_mark(w, type->fields);
+    break;
+  }
+  case PIC_TYPE_TABLE: {
+    struct table *t = (struct table *) obj;
+    int i;
+    for (i = 0; i < t->cap; ++i) {
+      if (t->slots[i].hash > 1) {
+        gc_par_mark(w, t->slots[i].key);
+        gc_par_mark(w, t->slots[i].val);
+      }
+    }
+    for (i = t->moved; i < t->old_cap; ++i) {
+      if (t->old_slots[i].hash > 1) {
+        gc_par_mark(w, t->old_slots[i].key);
+        gc_par_mark(w, t->old_slots[i].val);
+      }
+    }
+    break;
+  }
+  case PIC_TYPE_SYMBOL: {
+    struct symbol *sym = (struct symbol *) obj;
+    gc_par_mark_object(w, (struct object *) sym->str);
+    break;
+  }
+  case PIC_TYPE_ATTR: {
+    struct attr *attr = (struct attr *) obj;
+    attr->prev = w->attrs;
+    w->attrs = attr;
+    break;
+  }
+  case PIC_TYPE_STRING: {
+    struct string *str = (struct string *) obj;
+    gc_par_mark_object(w, (struct object *) str->rope);
+    break;
+  }
+  case PIC_TYPE_ROPE_NODE: {
+    struct rope_node *node = (struct rope_node *) obj;
+    gc_par_mark_object(w, (struct object *) node->s1);
+    gc_par_mark_object(w, (struct object *) node->s2);
+    break;
+  }
+  case PIC_TYPE_ROPE_LEAF: {
+    struct rope_leaf *leaf = (struct rope_leaf *) obj;
+    if (leaf->base) {
+      gc_par_mark_object(w, (struct object *) leaf->base);
+    }
+    break;
+  }
 
-    j = 0;
-    attr = pic->gc_attrs;
+  case PIC_TYPE_BLOB:
+  case PIC_TYPE_UVECTOR:
+  case PIC_TYPE_DATA:
+  case PIC_TYPE_BIGNUM:
+    break;
+
+  default:
+    PIC_UNREACHABLE();
+  }
+}
+
+static void
+gc_par_share(struct gc_worker *w)
+{
+  struct gc_pool *pool = w->pool;
+  size_t n = GC_PAR_CHUNK;
+
+  pthread_mutex_lock(&w->lock);
+  w->deque = gc_par_grow(w->deque, &w->deque_size, w->dn + n);
+  memcpy(w->deque + w->dn, w->stack + w->sp - n, n * sizeof(struct object *));
+  __atomic_store_n(&w->dn, w->dn + n, __ATOMIC_RELAXED);
+  w->sp -= n;
+  pthread_mutex_unlock(&w->lock);
+
+  __atomic_add_fetch(&pool->nshared, n, __ATOMIC_SEQ_CST);
+
+  pthread_mutex_lock(&pool->lock);
+  pthread_cond_signal(&pool->work);
+  pthread_mutex_unlock(&pool->lock);
+}
+
+static bool
+gc_par_steal(struct gc_worker *w)
+{
+  struct gc_pool *pool = w->pool;
+  struct gc_worker *v;
+  size_t n;
+  int i;
+
+  for (i = 0; i < pool->nthreads; ++i) {
+    v = &pool->workers[(w->id + i) % pool->nthreads];
+    if (__atomic_load_n(&v->dn, __ATOMIC_RELAXED) == 0)
+      continue;
+
+    pthread_mutex_lock(&v->lock);
+    n = v->dn < GC_PAR_CHUNK ? v->dn : GC_PAR_CHUNK;
+    w->stack = gc_par_grow(w->stack, &w->stack_size, w->sp + n);
+    memcpy(w->stack + w->sp, v->deque + v->dn - n, n * sizeof(struct object *));
+    __atomic_store_n(&v->dn, v->dn - n, __ATOMIC_RELAXED);
+    w->sp += n;
+    pthread_mutex_unlock(&v->lock);
+
+    if (n > 0) {
+      __atomic_sub_fetch(&pool->nshared, n, __ATOMIC_SEQ_CST);
+      return true;
+    }
+  }
+  return false;
+}
+
+static void
+gc_par_drain(struct gc_worker *w)
+{
+  struct gc_pool *pool = w->pool;
+
+  while (1) {
+    while (w->sp > 0) {
+      gc_par_scan(w, w->stack[--w->sp]);
+      if (w->sp > GC_PAR_CHUNK && __atomic_load_n(&pool->idle, __ATOMIC_RELAXED) > 0) {
+        gc_par_share(w);
+      }
+    }
+    if (gc_par_steal(w)) {
+      continue;
+    }
+
+    /* out of work; terminate once every marker is idle and nothing is shared */
+    pthread_mutex_lock(&pool->lock);
+    __atomic_add_fetch(&pool->idle, 1, __ATOMIC_SEQ_CST);
+    while (! pool->done && __atomic_load_n(&pool->nshared, __ATOMIC_SEQ_CST) == 0) {
+      if (pool->idle == pool->nthreads) {
+        pool->done = true;
+        pthread_cond_broadcast(&pool->work);
+        break;
+      }
+      pthread_cond_wait(&pool->work, &pool->lock);
+    }
+    if (pool->done) {
+      pthread_mutex_unlock(&pool->lock);
+      return;
+    }
+    __atomic_sub_fetch(&pool->idle, 1, __ATOMIC_SEQ_CST);
+    pthread_mutex_unlock(&pool->lock);
+  }
+}
+
+static void *
+gc_par_thread(void *arg)
+{
+  struct gc_worker *w = arg;
+  struct gc_pool *pool = w->pool;
+  unsigned long round = 0;
+
+  pthread_mutex_lock(&pool->lock);
+  while (1) {
+    while (pool->round == round && ! pool->quit) {
+      pthread_cond_wait(&pool->start, &pool->lock);
+    }
+    if (pool->quit)
+      break;
+    round = pool->round;
+    if (w->id >= pool->nthreads)
+      continue;
+    pthread_mutex_unlock(&pool->lock);
+
+    gc_par_drain(w);
+
+    pthread_mutex_lock(&pool->lock);
+    if (--pool->running == 0) {
+      pthread_cond_signal(&pool->finish);
+    }
+  }
+  pthread_mutex_unlock(&pool->lock);
+  return NULL;
+}
+
+static void
+gc_par_destroy(pic_state *pic, struct gc_pool *pool)
+{
+  int i;
+
+  pthread_mutex_lock(&pool->lock);
+  pool->quit = true;
+  pthread_cond_broadcast(&pool->start);
+  pthread_mutex_unlock(&pool->lock);
+
+  for (i = 1; i < pool->size; ++i) {
+    pthread_join(pool->workers[i].thread, NULL);
+  }
+  for (i = 0; i < PIC_GC_THREADS; ++i) {
+    pthread_mutex_destroy(&pool->workers[i].lock);
+    free(pool->workers[i].stack);
+    free(pool->workers[i].deque);
+    free(pool->workers[i].keys);
+  }
+  pthread_cond_destroy(&pool->start);
+  pthread_cond_destroy(&pool->work);
+  pthread_cond_destroy(&pool->finish);
+  pthread_mutex_destroy(&pool->lock);
+  pic_free(pic, pool);
+}
+
+static struct gc_pool *
+gc_par_create(pic_state *pic)
+{
+  struct gc_pool *pool;
+  int i;
+
+  pool = pic_calloc(pic, 1, sizeof(struct gc_pool));
+  pthread_mutex_init(&pool->lock, NULL);
+  pthread_cond_init(&pool->start, NULL);
+  pthread_cond_init(&pool->work, NULL);
+  pthread_cond_init(&pool->finish, NULL);
+
+  for (i = 0; i < PIC_GC_THREADS; ++i) {
+    pool->workers[i].id = i;
+    pool->workers[i].pic = pic;
+    pool->workers[i].pool = pool;
+    pthread_mutex_init(&pool->workers[i].lock, NULL);
+  }
+
+  /* worker 0 is the collecting thread itself */
+  pool->workers[0].alone = true;
+  for (pool->size = 1; pool->size < PIC_GC_THREADS; ++pool->size) {
+    if (pthread_create(&pool->workers[pool->size].thread, NULL, gc_par_thread, &pool->workers[pool->size]) != 0)
+      break;
+  }
+  return pool;
+}
+
+void
+pic_gc_pool_close(pic_state *pic)
+{
+  if (pic->gc_pool != NULL) {
+    gc_par_destroy(pic, pic->gc_pool);
+    pic->gc_pool = NULL;
+  }
+}
+
+static void
+gc_par_round(struct gc_pool *pool)
+{
+  pthread_mutex_lock(&pool->lock);
+  pool->done = false;
+  pool->idle = 0;
+  pool->running = pool->nthreads - 1;
+  pool->round++;
+  pthread_cond_broadcast(&pool->start);
+  pthread_mutex_unlock(&pool->lock);
+
+  pool->workers[0].alone = false;
+  gc_par_drain(&pool->workers[0]);
+  pool->workers[0].alone = true;
+
+  pthread_mutex_lock(&pool->lock);
+  while (pool->running > 0) {
+    pthread_cond_wait(&pool->finish, &pool->lock);
+  }
+  pthread_mutex_unlock(&pool->lock);
+}
+
+/* the parallel counterpart of gc_mark_ephemerons */
+static void
+gc_par_ephemerons(pic_state *pic, struct gc_pool *pool)
+{
+  struct gc_ephemerons *eph = &pic->gc_eph;
+  struct gc_worker *w, *self = &pool->workers[0];
+  struct attr *attr, *done = NULL;
+  struct object *key;
+  pic_value val;
+  khash_t(attr) *h;
+  int i, it, n;
+
+  while (1) {
+    for (i = 0; i < pool->nthreads; ++i) {
+      w = &pool->workers[i];
+      while (w->nkeys > 0) {
+        gc_ephemeron_reached(pic, w->keys[--w->nkeys]);
+      }
+      while ((attr = w->attrs) != NULL) {
+        w->attrs = attr->prev;
+        attr->prev = pic->gc_attrs;
+        pic->gc_attrs = attr;
+      }
+    }
+    while (eph->nready > 0) {
+      gc_par_mark(self, eph->ready[--eph->nready]);
+    }
+    while ((attr = pic->gc_attrs) != NULL) {
+      pic->gc_attrs = attr->prev;
+      attr->prev = done;
+      done = attr;
 
-    while (attr != NULL) {
       h = &attr->hash;
       for (it = kh_begin(h); it != kh_end(h); ++it) {
         if (! kh_exist(h, it))
           continue;
         key = kh_key(h, it);
         val = kh_val(h, it);
+        if (! pic_obj_p(pic, val))
+          continue;
         if (is_alive(key)) {
-          if (pic_obj_p(pic, val) && ! is_alive((struct object *) pic_ptr(pic, val))) {
-            gc_mark(pic, val);
-            ++j;
-          }
+          gc_par_mark(self, val);
+        } else {
+          gc_ephemeron_park(pic, key, val);
         }
       }
-      attr = attr->prev;
     }
-  } while (j > 0);
+
+    if (self->sp == 0 && eph->nready == 0)
+      break;
+
+    if (self->sp < GC_PAR_CHUNK) {
+      for (n = 0; n < GC_PAR_LOCAL; ++n) {
+        if (self->sp > 0) {
+          gc_par_scan(self, self->stack[--self->sp]);
+        } else if (eph->nready > 0) {
+          gc_par_mark(self, eph->ready[--eph->nready]);
+        } else {
+          break;
+        }
+      }
+      if (self->sp == 0)
+        continue;
+    }
+    gc_par_round(pool);
+  }
+
+  /* whatever is still parked belongs to dead keys */
+  kh_clear(ephemeron, &eph->pending);
+  eph->nchain = 0;
+
+  pic->gc_attrs = done;
+}
+
+static void
+gc_par_mark_phase(pic_state *pic, struct gc_pool *pool)
+{
+  struct gc_worker *w = &pool->workers[0];
+  struct context *cxt;
+  size_t j;
+
+  pool->nthreads = pic->gc_threads < pool->size ? pic->gc_threads : pool->size;
+
+  /* scan objects */
+
+  for (cxt = pic->cxt; cxt != NULL; cxt = cxt->prev) {
+    if (cxt->fp) gc_par_mark_object(w, (struct object *)cxt->fp);
+    if (cxt->sp) gc_par_mark_object(w, (struct object *)cxt->sp);
+    if (cxt->irep) gc_par_mark_object(w, (struct object *)cxt->irep);
+    gc_par_mark(w, cxt->conts);
+  }
+
+  for (j = 0; j < pic->ai; ++j) {
+    gc_par_mark_object(w, (struct object *)pic->arena[j]);
+  }
+
+  gc_par_mark(w, pic->globals);
+  gc_par_mark(w, pic->halt);
+
+  gc_par_round(pool);
+
+  gc_par_ephemerons(pic, pool);
+}
+
+#endif
+
+int
+pic_gc_set_threads(pic_state *pic, int n)
+{
+#if PIC_GC_THREADS
+  if (n < 1)
+    n = 1;
+  if (n > PIC_GC_THREADS)
+    n = PIC_GC_THREADS;
+  pic->gc_threads = n;
+  return n;
+#else
+  (void)pic;
+  (void)n;
+  return 1;
+#endif
+}
+
+static void
+gc_update_threshold(pic_state *pic)
+{
+  double t = pic->gc_live * pic->gc_growth;
+
+  if (t < pic->gc_min) {
+    t = pic->gc_min;
+  }
+  if (pic->gc_max != 0 && t > pic->gc_max) {
+    t = pic->gc_max;
+  }
+  pic->gc_threshold = (size_t) t;
+}
+
+void
+pic_gc_tune(pic_state *pic, double growth, size_t min, size_t max)
+{
+  pic->gc_growth = growth;
+  pic->gc_min = min;
+  pic->gc_max = max;
+  gc_update_threshold(pic);
+}
+
+void
+pic_gc(pic_state *pic)
+{
+  khash_t(oblist) *s = &pic->oblist;
+  struct symbol *sym;
+  int it;
+  struct object *obj, *prev, *next;
+  struct pic_gc_stats *stats = &pic->gc_stats;
+  size_t live, size;
+  double start, pause;
+  int i;
+
+  assert(pic->gc_attrs == NULL);
+
+  if (! pic->gc_enable) {
+    return;
+  }
+
+  start = gc_clock();
+
+#if PIC_GC_THREADS
+  if (pic->gc_threads > 1) {
+    if (pic->gc_pool == NULL) {
+      pic->gc_pool = gc_par_create(pic);
+    }
+    gc_par_mark_phase(pic, pic->gc_pool);
+  } else
+#endif
+  gc_mark_phase(pic);
 
   /* reclaim dead weak references */
 
@@ -361,6 +1162,7 @@ pic_gc(pic_state *pic)
       obj = kh_key(h, it);
       if (! is_alive(obj)) {
         kh_del(attr, h, it);
+        stats->weak_cleared++;
       }
     }
     pic->gc_attrs = pic->gc_attrs->prev;
@@ -375,12 +1177,33 @@ pic_gc(pic_state *pic)
     }
   }
 
+  if (pic->prof != NULL) {
+    khash_t(prof_obj) *h = &pic->prof->objs;
+    for (it = kh_begin(h); it != kh_end(h); ++it) {
+      if (! kh_exist(h, it))
+        continue;
+      if (! is_alive(kh_key(h, it))) {
+        kh_del(prof_obj, h, it);
+      }
+    }
+  }
+
   /* reclaim dead objects */
 
+  for (i = 0; i < PIC_GC_NTYPES; ++i) {
+    stats->type[i].live_bytes = 0;
+    stats->type[i].live_objects = 0;
+  }
+
+  live = 0;
   for (prev = &pic->gc_head, obj = prev->next; obj != &pic->gc_head; prev = obj, obj = next) {
     next = obj->next;
     if (is_alive(obj)) {
       unmark(obj);
+      size = obj_size(obj);
+      stats->type[obj_type(obj)].live_bytes += size;
+      stats->type[obj_type(obj)].live_objects++;
+      live += size;
     } else {
       gc_finalize_object(pic, obj);
       pic_free(pic, obj);
@@ -388,6 +1211,59 @@ pic_gc(pic_state *pic)
       obj = prev;
     }
   }
+
+  pic->gc_live = live;
+  pic->gc_count = 0;
+  gc_update_threshold(pic);
+
+  pause = gc_clock() - start;
+  stats->collections++;
+  stats->total_pause += pause;
+  if (pause > stats->max_pause) {
+    stats->max_pause = pause;
+  }
+
+#if PIC_USE_FILE
+  if (pic->gc_log) {
+    fprintf(stderr, "gc: #%lu pause %.3fms live %lu bytes next %lu bytes weak-cleared %lu\n",
+            stats->collections, pause * 1e3, (unsigned long) live,
+            (unsigned long) pic->gc_threshold, (unsigned long) stats->weak_cleared);
+  }
+#endif
+}
+
+const struct pic_gc_stats *
+pic_gc_stats(pic_state *pic)
+{
+  return &pic->gc_stats;
+}
+
+const char *
+pic_gc_typename(int type)
+{
+  switch (type) {
+  case PIC_TYPE_SYMBOL: return "symbol";
+  case PIC_TYPE_STRING: return "string";
+  case PIC_TYPE_BLOB: return "bytevector";
+  case PIC_TYPE_UVECTOR: return "numeric-vector";
+  case PIC_TYPE_DATA: return "data";
+  case PIC_TYPE_PAIR: return "pair";
+  case PIC_TYPE_VECTOR: return "vector";
+  case PIC_TYPE_DICT: return "dictionary";
+  case PIC_TYPE_TABLE: return "hash-table";
+  case PIC_TYPE_ARRAY: return "array";
+  case PIC_TYPE_RECORD: return "record";
+  case PIC_TYPE_RECORD_TYPE: return "record-type";
+  case PIC_TYPE_ATTR: return "attribute";
+  case PIC_TYPE_IREP: return "irep";
+  case PIC_TYPE_FRAME: return "frame";
+  case PIC_TYPE_PROC_FUNC: return "procedure-func";
+  case PIC_TYPE_PROC_IREP: return "procedure-irep";
+  case PIC_TYPE_ROPE_LEAF: return "rope-leaf";
+  case PIC_TYPE_ROPE_NODE: return "rope-node";
+  case PIC_TYPE_BIGNUM: return "bignum";
+  default: return NULL;
+  }
 }
 
 static size_t
@@ -396,32 +1272,78 @@ type2size(int type)
   switch (type) {
     case PIC_TYPE_VECTOR: return sizeof(struct vector);
     case PIC_TYPE_BLOB: return sizeof(struct blob);
+    case PIC_TYPE_UVECTOR: return sizeof(struct uvector);
     case PIC_TYPE_STRING: return sizeof(struct string);
     case PIC_TYPE_DATA: return sizeof(struct data);
     case PIC_TYPE_DICT: return sizeof(struct dict);
+    case PIC_TYPE_TABLE: return sizeof(struct table);
+    case PIC_TYPE_ARRAY: return sizeof(struct array);
     case PIC_TYPE_SYMBOL: return sizeof(struct symbol);
     case PIC_TYPE_ATTR: return sizeof(struct attr);
     case PIC_TYPE_IREP: return sizeof(struct irep);
     case PIC_TYPE_PAIR: return sizeof(struct pair);
     case PIC_TYPE_FRAME: return sizeof(struct frame);
     case PIC_TYPE_RECORD: return sizeof(struct record);
+    case PIC_TYPE_RECORD_TYPE: return sizeof(struct record_type);
     case PIC_TYPE_PROC_FUNC: return sizeof(struct proc);
     case PIC_TYPE_PROC_IREP: return sizeof(struct proc);
     case PIC_TYPE_ROPE_LEAF: return sizeof(struct rope_leaf);
     case PIC_TYPE_ROPE_NODE: return sizeof(struct rope_node);
+    case PIC_TYPE_BIGNUM: return sizeof(struct bignum);
     default: PIC_UNREACHABLE();
   }
 }
 
-struct object *
-pic_obj_alloc_unsafe(pic_state *pic, int type)
+/* bytes an object holds outside its header, allocated apart from it */
+static size_t
+obj_payload(struct object *obj)
+{
+  switch (obj_type(obj)) {
+  case PIC_TYPE_VECTOR:
+    return sizeof(pic_value) * ((struct vector *) obj)->len;
+  case PIC_TYPE_ARRAY:
+    return sizeof(pic_value) * ((struct array *) obj)->cap;
+  case PIC_TYPE_BLOB: {
+    struct blob *blob = (struct blob *) obj;
+    return blob->view ? 0 : blob->len;
+  }
+  case PIC_TYPE_UVECTOR: {
+    struct uvector *uvec = (struct uvector *) obj;
+    return (size_t) pic_uvec_size(uvec->kind) * uvec->len;
+  }
+  case PIC_TYPE_BIGNUM:
+    return sizeof(bigit_t) * ((struct bignum *) obj)->len;
+  case PIC_TYPE_ROPE_LEAF: {
+    struct rope_leaf *leaf = (struct rope_leaf *) obj;
+    return leaf->base == NULL ? leaf->len + 1 : 0;
+  }
+  case PIC_TYPE_TABLE: {
+    struct table *t = (struct table *) obj;
+    return sizeof(struct table_slot) * (t->cap + (t->old_slots ? t->old_cap : 0) + (t->next_slots ? t->next_cap : 0));
+  }
+  case PIC_TYPE_FRAME:
+    return sizeof(pic_value) * ((struct frame *) obj)->regc;
+  default:
+    return 0;
+  }
+}
+
+static size_t
+obj_size(struct object *obj)
+{
+  if (obj_type(obj) == PIC_TYPE_RECORD) {
+    return pic_record_size(((struct record *) obj)->type->nfields);
+  }
+  return type2size(obj_type(obj)) + obj_payload(obj);
+}
+
+static struct object *
+obj_alloc(pic_state *pic, int type, size_t size)
 {
   struct object *obj;
-  size_t size = type2size(type);
 
-  if (pic->gc_count > PIC_GC_PERIOD) {
+  if (pic->gc_count > pic->gc_threshold) {
     pic_gc(pic);
-    pic->gc_count -= PIC_GC_PERIOD;
   }
 
   obj = pic_malloc(pic, size);
@@ -430,10 +1352,33 @@ pic_obj_alloc_unsafe(pic_state *pic, int type)
   pic->gc_head.next = obj;
 
   pic->gc_count += size;
+  pic->gc_stats.type[type].alloc_bytes += size;
+  pic->gc_stats.type[type].alloc_objects++;
+
+  if (pic->prof != NULL) {
+    pic_prof_sample(pic, obj, size);
+  }
 
   return obj;
 }
 
+void
+pic_obj_charge(pic_state *pic, struct object *obj, size_t size)
+{
+  pic->gc_count += size;
+  pic->gc_stats.type[obj_type(obj)].alloc_bytes += size;
+
+  if (pic->prof != NULL) {
+    pic_prof_sample(pic, obj, size);
+  }
+}
+
+struct object *
+pic_obj_alloc_unsafe(pic_state *pic, int type)
+{
+  return obj_alloc(pic, type, type2size(type));
+}
+
 struct object *
 pic_obj_alloc(pic_state *pic, int type)
 {
@@ -444,3 +1389,82 @@ pic_obj_alloc(pic_state *pic, int type)
   pic_protect(pic, obj_value(pic, obj));
   return obj;
 }
+
+struct object *
+pic_obj_alloc_var(pic_state *pic, int type, size_t size)
+{
+  struct object *obj;
+
+  obj = obj_alloc(pic, type, size);
+
+  pic_protect(pic, obj_value(pic, obj));
+  return obj;
+}
+
+static pic_value
+size_value(pic_state *pic, size_t n)
+{
+  return n <= (size_t) PIC_INT_MAX ? pic_int_value(pic, (long) n) : pic_float_value(pic, (double) n);
+}
+
+static pic_value
+pic_gc_gc_tune(pic_state *pic)
+{
+  double growth, min, max;
+  int argc;
+
+  argc = pic_get_args(pic, "|fff", &growth, &min, &max);
+
+  if (argc > 0) {
+    if (growth < 0 || (argc > 1 && min < 0) || (argc > 2 && max < 0)) {
+      pic_error(pic, "gc-tune: negative parameter given", 0);
+    }
+    pic_gc_tune(pic, growth, argc > 1 ? (size_t) min : pic->gc_min, argc > 2 ? (size_t) max : pic->gc_max);
+  }
+  return pic_list(pic, 3, pic_float_value(pic, pic->gc_growth), size_value(pic, pic->gc_min), size_value(pic, pic->gc_max));
+}
+
+#define pic_push_stat(pic, name, v, place) \
+  pic_push(pic, pic_cons(pic, pic_intern_lit(pic, name), v), place)
+
+static pic_value
+pic_gc_gc_stats(pic_state *pic)
+{
+  const struct pic_gc_stats *stats = &pic->gc_stats;
+  pic_value types = pic_nil_value(pic), type, result = pic_nil_value(pic);
+  const char *name;
+  int i;
+
+  pic_get_args(pic, "");
+
+  for (i = PIC_GC_NTYPES - 1; i >= 0; --i) {
+    if ((name = pic_gc_typename(i)) == NULL || stats->type[i].alloc_objects == 0)
+      continue;
+    type = pic_nil_value(pic);
+    pic_push_stat(pic, "live-objects", size_value(pic, stats->type[i].live_objects), type);
+    pic_push_stat(pic, "live-bytes", size_value(pic, stats->type[i].live_bytes), type);
+    pic_push_stat(pic, "allocated-objects", size_value(pic, stats->type[i].alloc_objects), type);
+    pic_push_stat(pic, "allocated-bytes", size_value(pic, stats->type[i].alloc_bytes), type);
+    pic_push(pic, pic_cons(pic, pic_intern_cstr(pic, name), type), types);
+  }
+
+  pic_push_stat(pic, "types", types, result);
+  pic_push_stat(pic, "weak-cleared", size_value(pic, stats->weak_cleared), result);
+  pic_push_stat(pic, "live-bytes", size_value(pic, pic->gc_live), result);
+  pic_push_stat(pic, "max-pause", pic_float_value(pic, stats->max_pause), result);
+  pic_push_stat(pic, "total-pause", pic_float_value(pic, stats->total_pause), result);
+  pic_push_stat(pic, "collections", size_value(pic, stats->collections), result);
+
+  return result;
+}
+
+void
+pic_init_gc(pic_state *pic)
+{
+#if PIC_USE_LIBC
+  pic->gc_log = getenv("PICRIN_GC_LOG") != NULL;
+#endif
+
+  pic_defun(pic, "gc-tune", pic_gc_gc_tune);
+  pic_defun(pic, "gc-stats", pic_gc_gc_stats);
+}
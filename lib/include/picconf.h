@@ -25,3 +25,16 @@
  */
 
 /* #define PIC_BUFSIZ 1024 */
+
+/**
+ * GC configuration
+ */
+
+/* the next collection runs after allocating PIC_GC_GROWTH times the live
+   heap, clamped to [PIC_GC_PERIOD, PIC_GC_PERIOD_MAX] bytes (0 = no limit) */
+/* #define PIC_GC_PERIOD (8 * 1024 * 1024) */
+/* #define PIC_GC_PERIOD_MAX 0 */
+/* #define PIC_GC_GROWTH 1.0 */
+
+/* number of marker threads (requires pthreads; 0 disables parallel marking) */
+/* #define PIC_GC_THREADS 4 */
@@ -43,13 +43,21 @@ typedef struct value {
   union {
     void *p;
     double f;
-    int i;
-    char c;
+    long i;
+    int c;
   } u;
   unsigned char type;
 #endif
 } pic_value;
 
+/* range of exact integers held in a pic_value (fixnums) */
+#if PIC_NAN_BOXING && LONG_MAX > 0x1fffffffffff
+# define PIC_INT_MAX 0x1fffffffffffL
+#else
+# define PIC_INT_MAX LONG_MAX
+#endif
+#define PIC_INT_MIN (-PIC_INT_MAX - 1)
+
 
 /*
  * state manipulation
@@ -75,6 +83,23 @@ void pic_leave(pic_state *, size_t);
 pic_value pic_protect(pic_state *, pic_value);
 void *pic_alloca(pic_state *, size_t);
 void pic_gc(pic_state *);
+void pic_gc_tune(pic_state *, double growth, size_t min, size_t max);
+/* collector statistics; per-type counters are indexed by internal type tag */
+#define PIC_GC_NTYPES 64
+struct pic_gc_stats {
+  unsigned long collections;
+  double total_pause, max_pause; /* in seconds */
+  size_t weak_cleared;
+  struct {
+    size_t alloc_bytes, alloc_objects; /* bytes include data allocated apart from the objects */
+    size_t live_bytes, live_objects; /* as of the last collection */
+  } type[PIC_GC_NTYPES];
+};
+const struct pic_gc_stats *pic_gc_stats(pic_state *);
+const char *pic_gc_typename(int type); /* NULL for unused tags */
+/* sample one allocation site every `interval` bytes; 0 stops sampling */
+void pic_heap_profile(pic_state *, size_t interval);
+int pic_gc_set_threads(pic_state *, int n);
 
 
 /*
@@ -103,16 +128,16 @@ bool pic_false_p(pic_state *, pic_value);
 bool pic_bool_p(pic_state *, pic_value);
 bool pic_data_p(pic_state *, pic_value, const pic_data_type *);
 pic_value pic_undef_value(pic_state *);
-pic_value pic_int_value(pic_state *, int);
+pic_value pic_int_value(pic_state *, long); /* PIC_INT_MIN <= i <= PIC_INT_MAX */
 pic_value pic_float_value(pic_state *, double);
-pic_value pic_char_value(pic_state *, char);
+pic_value pic_char_value(pic_state *, int); /* a unicode code point */
 pic_value pic_bool_value(pic_state *, bool);
 pic_value pic_true_value(pic_state *);
 pic_value pic_false_value(pic_state *);
 pic_value pic_data_value(pic_state *, void *ptr, const pic_data_type *type);
-int pic_int(pic_state *, pic_value i);
+long pic_int(pic_state *, pic_value i);
 double pic_float(pic_state *, pic_value f);
-char pic_char(pic_state *, pic_value c);
+int pic_char(pic_state *, pic_value c);
 #define pic_bool(pic,b) (! pic_false_p(pic, (b)))
 void *pic_data(pic_state *, pic_value data);
 
@@ -123,11 +148,37 @@ void *pic_data(pic_state *, pic_value data);
 
 bool pic_blob_p(pic_state *, pic_value);
 pic_value pic_blob_value(pic_state *, const unsigned char *buf, int len);
+pic_value pic_blob_value_external(pic_state *, unsigned char *ptr, int len, void (*dtor)(pic_state *, void *ptr, void *userdata), void *userdata); /* not copied; dtor, if any, runs once no bytevector uses ptr */
+pic_value pic_blob_slice(pic_state *, pic_value blob, int start, int end); /* shares the bytes of blob */
 unsigned char *pic_blob(pic_state *, pic_value blob, int *len);
 pic_value pic_serialize(pic_state *pic, pic_value obj);
 pic_value pic_deserialize(pic_state *pic, pic_value blob);
 
 
+/*
+ * homogeneous numeric vector (SRFI 4)
+ */
+
+enum {
+  PIC_UVEC_U8,                  /* bytevectors */
+  PIC_UVEC_S8,
+  PIC_UVEC_U16,
+  PIC_UVEC_S16,
+  PIC_UVEC_U32,
+  PIC_UVEC_S32,
+  PIC_UVEC_U64,
+  PIC_UVEC_S64,
+  PIC_UVEC_F32,
+  PIC_UVEC_F64
+};
+
+bool pic_uvec_p(pic_state *, pic_value); /* false for bytevectors */
+pic_value pic_make_uvec(pic_state *, int kind, int len); /* zero-filled */
+void *pic_uvec(pic_state *, pic_value uvec, int *kind, int *len); /* the unboxed elements */
+pic_value pic_uvec_ref(pic_state *, pic_value uvec, int i);
+void pic_uvec_set(pic_state *, pic_value uvec, int i, pic_value v); /* raises unless v fits */
+
+
 /*
  * string
  */
@@ -151,9 +202,9 @@ pic_value pic_str_sub(pic_state *, pic_value str, int i, int j);
 
 bool pic_sym_p(pic_state *, pic_value);
 pic_value pic_intern(pic_state *, pic_value str);
-#define pic_intern_str(pic,s,i) pic_intern(pic, pic_str_value(pic, (s), (i)))
-#define pic_intern_cstr(pic,s) pic_intern(pic, pic_cstr_value(pic, (s)))
-#define pic_intern_lit(pic,lit) pic_intern(pic, pic_lit_value(pic, lit))
+pic_value pic_intern_str(pic_state *, const char *str, int len); /* allocates nothing if the symbol exists */
+#define pic_intern_cstr(pic,s) pic_intern_str(pic, (s), strlen(s))
+#define pic_intern_lit(pic,lit) pic_intern_str(pic, "" lit, sizeof lit - 1)
 pic_value pic_sym_name(pic_state *, pic_value sym);
 
 
@@ -202,6 +253,21 @@ void pic_vec_set(pic_state *, pic_value vec, int i, pic_value v);
 int pic_vec_len(pic_state *, pic_value vec);
 
 
+/*
+ * array
+ */
+
+bool pic_array_p(pic_state *, pic_value);
+pic_value pic_make_array(pic_state *, int cap);
+pic_value pic_array_ref(pic_state *, pic_value ary, int i);
+void pic_array_set(pic_state *, pic_value ary, int i, pic_value v);
+int pic_array_len(pic_state *, pic_value ary);
+void pic_array_push(pic_state *, pic_value ary, pic_value v);
+pic_value pic_array_pop(pic_state *, pic_value ary); /* raises if ary is empty */
+void pic_array_unshift(pic_state *, pic_value ary, pic_value v);
+pic_value pic_array_shift(pic_state *, pic_value ary); /* raises if ary is empty */
+
+
 /*
  * dictionary
  */
@@ -216,6 +282,29 @@ int pic_dict_size(pic_state *, pic_value dict);
 bool pic_dict_next(pic_state *, pic_value dict, int *iter, pic_value *key, pic_value *val);
 
 
+/*
+ * hash table
+ */
+
+enum {
+  PIC_TABLE_EQ,
+  PIC_TABLE_EQV,
+  PIC_TABLE_EQUAL,
+  PIC_TABLE_STRING              /* string=? on string keys */
+};
+
+bool pic_table_p(pic_state *, pic_value);
+pic_value pic_make_table(pic_state *, int kind);
+pic_value pic_table_ref(pic_state *, pic_value table, pic_value key);
+bool pic_table_get(pic_state *, pic_value table, pic_value key, pic_value *val); /* false if absent */
+void pic_table_set(pic_state *, pic_value table, pic_value key, pic_value);
+bool pic_table_del(pic_state *, pic_value table, pic_value key); /* false if absent */
+bool pic_table_has(pic_state *, pic_value table, pic_value key);
+int pic_table_size(pic_state *, pic_value table);
+bool pic_table_next(pic_state *, pic_value table, int *iter, pic_value *key, pic_value *val);
+unsigned long pic_hash(pic_state *, int kind, pic_value key); /* agrees with the kind's equivalence */
+
+
 /*
  * attribute
  */
@@ -62,6 +62,8 @@ int pic_setvbuf(pic_state *, pic_value port, char *buf, int mode, size_t size);
 int pic_printf(pic_state *, const char *fmt, ...);
 int pic_fprintf(pic_state *, pic_value port, const char *fmt, ...);
 int pic_vfprintf(pic_state *, pic_value port, const char *fmt, va_list ap);
+/* heap census */
+void pic_heap_dump(pic_state *, pic_value port);
 #endif
 
 #if PIC_USE_FILE
@@ -76,6 +76,25 @@
 # define PIC_GC_PERIOD (8 * 1024 * 1024)
 #endif
 
+#ifndef PIC_GC_PERIOD_MAX
+# define PIC_GC_PERIOD_MAX 0    /* unbounded */
+#endif
+
+#ifndef PIC_GC_GROWTH
+# define PIC_GC_GROWTH 1.0
+#endif
+
+#ifndef PIC_GC_THREADS
+# define PIC_GC_THREADS 0
+#endif
+
+#if !PIC_USE_LIBC && PIC_GC_THREADS
+# error PIC_GC_THREADS requires PIC_USE_LIBC
+#endif
+#if PIC_GC_THREADS && ! (defined(__GNUC__) || defined(__clang__))
+# error PIC_GC_THREADS requires GCC-compatible __atomic builtins
+#endif
+
 /* check compatibility */
 
 #if __STDC_VERSION__ >= 199901L
@@ -104,6 +123,15 @@ typedef unsigned long uint32_t;
 # endif
 #endif
 
+/* 64-bit integers, where there are any */
+#if __STDC_VERSION__ >= 199901L
+# define PIC_INT64_T int64_t
+# define PIC_UINT64_T uint64_t
+#elif ULONG_MAX >> 31 >> 31 >= 3
+# define PIC_INT64_T long
+# define PIC_UINT64_T unsigned long
+#endif
+
 #if __STDC_VERSION__ >= 201112L
 # include <stdnoreturn.h>
 # define PIC_NORETURN noreturn
@@ -309,6 +337,19 @@ memmove(void *dst, const void *src, size_t n)
   return d;
 }
 
+PIC_STATIC_INLINE void *
+memchr(const void *s, int c, size_t n)
+{
+  const unsigned char *p = s;
+
+  while (n-- > 0) {
+    if (*p == (unsigned char) c)
+      return (void *)p;
+    p++;
+  }
+  return NULL;
+}
+
 PIC_STATIC_INLINE int
 memcmp(const void *b1, const void *b2, size_t n)
 {
@@ -474,6 +515,12 @@ pic_dtoa(double dval, char *buf)
 # define PIC_DIRECT_THREADED_VM 0
 #endif
 
+#if __SSE2__
+# define PIC_SSE2 1
+#else
+# define PIC_SSE2 0
+#endif
+
 #if __x86_64__ && (defined(__GNUC__) || defined(__clang__)) && ! defined(__STRICT_ANSI__)
 # include <stdint.h>
 # define PIC_NAN_BOXING 1
@@ -24,27 +24,122 @@
    SOFTWARE.
 */
 
+
 #ifndef PICRIN_KHASH_H
 #define PICRIN_KHASH_H
 
-#define ac_isempty(flag, i) ((flag[i>>4]>>((i&0xfU)<<1))&2)
-#define ac_isdel(flag, i) ((flag[i>>4]>>((i&0xfU)<<1))&1)
-#define ac_iseither(flag, i) ((flag[i>>4]>>((i&0xfU)<<1))&3)
-#define ac_set_isdel_false(flag, i) (flag[i>>4]&=~(1ul<<((i&0xfU)<<1)))
-#define ac_set_isempty_false(flag, i) (flag[i>>4]&=~(2ul<<((i&0xfU)<<1)))
-#define ac_set_isboth_false(flag, i) (flag[i>>4]&=~(3ul<<((i&0xfU)<<1)))
-#define ac_set_isdel_true(flag, i) (flag[i>>4]|=1ul<<((i&0xfU)<<1))
+/*
+ * Open addressing in the style of Swiss tables. Next to the keys and
+ * values each bucket has a control byte: KH_EMPTY, KH_DELETED, or the low
+ * 7 bits of the hash of its key. Buckets are probed a group of KH_GROUP
+ * control bytes at a time (with SSE2 in one compare), so a lookup rarely
+ * compares more than the key it is after, and it stops at the first group
+ * that has an empty bucket. Groups are aligned and visited in triangular
+ * order. Tables smaller than a group pad their control bytes with
+ * KH_SENTINEL, which matches nothing.
+ *
+ * Entries never move except on resize, so kh_del may be called while
+ * iterating from kh_begin to kh_end.
+ */
+
+#if PIC_SSE2
+# include <emmintrin.h>
+#endif
+
+#define KH_GROUP 16
+#define KH_EMPTY ((signed char) -128)
+#define KH_DELETED ((signed char) -2)
+#define KH_SENTINEL ((signed char) -1)
 
 #define ac_roundup32(x)                                                 \
   (--(x), (x)|=(x)>>1, (x)|=(x)>>2, (x)|=(x)>>4, (x)|=(x)>>8, (x)|=(x)>>16, ++(x))
 
-#define ac_fsize(m) ((m) < 16? 1 : (m)>>4)
-#define ac_hash_upper(x) ((((x) * 2) * 77 / 100 + 1) / 2)
+#define kh_isfull(c) ((c) >= 0)
+#define kh_csize(n) ((n) < KH_GROUP ? KH_GROUP : (n))
+#define kh_gmask(n) ((n) <= KH_GROUP ? 0 : (n) / KH_GROUP - 1)
+#define kh_upper(n) ((n) - ((n) < 8 ? 1 : (n) / 8)) /* leaves a bucket empty */
+#define kh_h1(k, gmask) ((int) (((k) >> 7) & (unsigned long) (gmask)))
+#define kh_h2(k) ((signed char) ((k) & 0x7f))
+
+/* the hash functions below need not spread their bits; this does */
+PIC_STATIC_INLINE unsigned long
+kh_mix(int hash)
+{
+  unsigned long k = (unsigned long) hash & 0xffffffffUL;
+
+  k ^= k >> 16;
+  k = (k * 0x85ebca6bUL) & 0xffffffffUL;
+  k ^= k >> 13;
+  k = (k * 0xc2b2ae35UL) & 0xffffffffUL;
+  k ^= k >> 16;
+  return k;
+}
+
+/* bit i is set when the i-th control byte of the group is c */
+#if PIC_SSE2
+PIC_STATIC_INLINE unsigned
+kh_match(const signed char *group, signed char c)
+{
+  __m128i ctrl = _mm_loadu_si128((const __m128i *) group);
+
+  return (unsigned) _mm_movemask_epi8(_mm_cmpeq_epi8(ctrl, _mm_set1_epi8(c)));
+}
+
+/* ... when it is KH_EMPTY or KH_DELETED */
+PIC_STATIC_INLINE unsigned
+kh_match_free(const signed char *group)
+{
+  __m128i ctrl = _mm_loadu_si128((const __m128i *) group);
+
+  return (unsigned) _mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(KH_SENTINEL), ctrl));
+}
+#else
+PIC_STATIC_INLINE unsigned
+kh_match(const signed char *group, signed char c)
+{
+  unsigned m = 0;
+  int i;
+
+  for (i = 0; i < KH_GROUP; ++i) {
+    if (group[i] == c) m |= 1u << i;
+  }
+  return m;
+}
+
+PIC_STATIC_INLINE unsigned
+kh_match_free(const signed char *group)
+{
+  unsigned m = 0;
+  int i;
+
+  for (i = 0; i < KH_GROUP; ++i) {
+    if (group[i] < KH_SENTINEL) m |= 1u << i;
+  }
+  return m;
+}
+#endif
+
+#if (defined(__GNUC__) && __GNUC__ >= 4) || defined(__clang__)
+# define kh_ctz(m) __builtin_ctz(m)
+#else
+/* m must not be zero */
+PIC_STATIC_INLINE int
+kh_ctz(unsigned m)
+{
+  int n = 0;
+
+  while ((m & 1) == 0) {
+    m >>= 1;
+    n++;
+  }
+  return n;
+}
+#endif
 
 #define KHASH_DECLARE(name, khkey_t, khval_t)                           \
   typedef struct {                                                      \
     int n_buckets, size, n_occupied, upper_bound;                       \
-    int *flags;                                                         \
+    signed char *ctrl;                                                  \
     khkey_t *keys;                                                      \
     khval_t *vals;                                                      \
   } kh_##name##_t;                                                      \
@@ -56,6 +151,24 @@
   int kh_put_##name(pic_state *, kh_##name##_t *h, khkey_t key, int *ret); \
   void kh_del_##name(kh_##name##_t *h, int x);
 
+/* body of kh_get and kh_lookup: the bucket of key, or n_buckets */
+#define KHASH_FIND(h, key, hash_func, hash_equal)                       \
+  if (h->n_buckets) {                                                   \
+    unsigned long k = kh_mix(hash_func(key));                           \
+    int g, gmask = kh_gmask(h->n_buckets), step = 0;                    \
+    unsigned m;                                                         \
+    g = kh_h1(k, gmask);                                                \
+    while (1) {                                                         \
+      const signed char *group = h->ctrl + g * KH_GROUP;                \
+      for (m = kh_match(group, kh_h2(k)); m != 0; m &= m - 1) {         \
+        int i = g * KH_GROUP + kh_ctz(m);                               \
+        if (hash_equal(h->keys[i], key)) return i;                      \
+      }                                                                 \
+      if (kh_match(group, KH_EMPTY)) return h->n_buckets;               \
+      g = (g + (++step)) & gmask;                                       \
+    }                                                                   \
+  } else return 0;
+
 #define KHASH_DEFINE(name, khkey_t, khval_t, hash_func, hash_equal)     \
   KHASH_DEFINE2(name, khkey_t, khval_t, 1, hash_func, hash_equal)
 #define KHASH_DEFINE2(name, khkey_t, khval_t, kh_is_map, hash_func, hash_equal) \
@@ -64,137 +177,126 @@
   }                                                                     \
   void kh_destroy_##name(pic_state *pic, kh_##name##_t *h)              \
   {                                                                     \
-    pic_free(pic, h->flags);                                            \
+    pic_free(pic, h->ctrl);                                             \
     pic_free(pic, (void *)h->keys);                                     \
     pic_free(pic, (void *)h->vals);                                     \
   }                                                                     \
   void kh_clear_##name(kh_##name##_t *h)                                \
   {                                                                     \
-    if (h->flags) {                                                     \
-      memset(h->flags, 0xaa, ac_fsize(h->n_buckets) * sizeof(int));     \
+    if (h->ctrl) {                                                      \
+      memset(h->ctrl, KH_EMPTY, h->n_buckets);                          \
       h->size = h->n_occupied = 0;                                      \
     }                                                                   \
   }                                                                     \
   int kh_get_##name(pic_state *pic, const kh_##name##_t *h, khkey_t key) \
   {                                                                     \
     (void)pic;                                                          \
-    if (h->n_buckets) {                                                 \
-      int k, i, last, mask, step = 0;                                   \
-      mask = h->n_buckets - 1;                                          \
-      k = hash_func(key); i = k & mask;                                 \
-      last = i;                                                         \
-      while (!ac_isempty(h->flags, i) && (ac_isdel(h->flags, i) || !hash_equal(h->keys[i], key))) { \
-        i = (i + (++step)) & mask;                                      \
-        if (i == last) return h->n_buckets;                             \
-      }                                                                 \
-      return ac_iseither(h->flags, i)? h->n_buckets : i;		\
-    } else return 0;                                                    \
+    KHASH_FIND(h, key, hash_func, hash_equal)                           \
   }                                                                     \
   void kh_resize_##name(pic_state *pic, kh_##name##_t *h, int new_n_buckets) \
-  { /* This function uses 0.25*n_buckets bytes of working space instead of [sizeof(key_t+val_t)+.25]*n_buckets. */ \
-    int *new_flags = 0;                                                 \
-    int j = 1;                                                          \
-    {                                                                   \
-      ac_roundup32(new_n_buckets);                                      \
-      if (new_n_buckets < 4) new_n_buckets = 4;                         \
-      if (h->size >= ac_hash_upper(new_n_buckets)) j = 0; /* requested size is too small */ \
-      else { /* hash table size to be changed (shrink or expand); rehash */ \
-        new_flags = pic_malloc(pic, ac_fsize(new_n_buckets) * sizeof(int)); \
-        memset(new_flags, 0xaa, ac_fsize(new_n_buckets) * sizeof(int)); \
-        if (h->n_buckets < new_n_buckets) {	/* expand */		\
-          h->keys = pic_realloc(pic, (void *)h->keys, new_n_buckets * sizeof(khkey_t)); \
-          if (kh_is_map) {                                              \
-            h->vals = pic_realloc(pic, (void *)h->vals, new_n_buckets * sizeof(khval_t)); \
-          }                                                             \
-        } /* otherwise shrink */                                        \
-      }                                                                 \
-    }                                                                   \
-    if (j) { /* rehashing is needed */                                  \
-      for (j = 0; j != h->n_buckets; ++j) {                             \
-        if (ac_iseither(h->flags, j) == 0) {                            \
-          khkey_t key = h->keys[j];                                     \
-          khval_t val;                                                  \
-          int new_mask;                                                 \
-          new_mask = new_n_buckets - 1;                                 \
-          if (kh_is_map) val = h->vals[j];                              \
-          ac_set_isdel_true(h->flags, j);                               \
-          while (1) { /* kick-out process; sort of like in Cuckoo hashing */ \
-            int k, i, step = 0;                                         \
-            k = hash_func(key);                                         \
-            i = k & new_mask;                                           \
-            while (!ac_isempty(new_flags, i)) i = (i + (++step)) & new_mask; \
-            ac_set_isempty_false(new_flags, i);                         \
-            if (i < h->n_buckets && ac_iseither(h->flags, i) == 0) { /* kick out the existing element */ \
-              { khkey_t tmp = h->keys[i]; h->keys[i] = key; key = tmp; } \
-              if (kh_is_map) { khval_t tmp = h->vals[i]; h->vals[i] = val; val = tmp; } \
-              ac_set_isdel_true(h->flags, i); /* mark it as deleted in the old hash table */ \
-            } else { /* write the element and jump out of the loop */   \
-              h->keys[i] = key;                                         \
-              if (kh_is_map) h->vals[i] = val;                          \
-              break;                                                    \
-            }                                                           \
-          }                                                             \
-        }                                                               \
-      }                                                                 \
-      if (h->n_buckets > new_n_buckets) { /* shrink the hash table */   \
-        h->keys = pic_realloc(pic, (void *)h->keys, new_n_buckets * sizeof(khkey_t)); \
-        if (kh_is_map) h->vals = pic_realloc(pic, (void *)h->vals, new_n_buckets * sizeof(khval_t)); \
+  { /* rehashes into fresh arrays, which also drops deleted buckets */  \
+    signed char *ctrl;                                                  \
+    khkey_t *keys;                                                      \
+    khval_t *vals = 0;                                                  \
+    unsigned long k;                                                    \
+    unsigned m;                                                         \
+    int i, j, g, gmask, step;                                           \
+    ac_roundup32(new_n_buckets);                                        \
+    if (new_n_buckets < 4) new_n_buckets = 4;                           \
+    if (h->size >= kh_upper(new_n_buckets)) return; /* requested size is too small */ \
+    ctrl = pic_malloc(pic, kh_csize(new_n_buckets));                    \
+    memset(ctrl, KH_EMPTY, new_n_buckets);                              \
+    memset(ctrl + new_n_buckets, KH_SENTINEL, kh_csize(new_n_buckets) - new_n_buckets); \
+    keys = pic_malloc(pic, new_n_buckets * sizeof(khkey_t));            \
+    if (kh_is_map) vals = pic_malloc(pic, new_n_buckets * sizeof(khval_t)); \
+    gmask = kh_gmask(new_n_buckets);                                    \
+    for (j = 0; j != h->n_buckets; ++j) {                               \
+      if (! kh_isfull(h->ctrl[j])) continue;                            \
+      k = kh_mix(hash_func(h->keys[j]));                                \
+      g = kh_h1(k, gmask);                                              \
+      step = 0;                                                         \
+      while ((m = kh_match(ctrl + g * KH_GROUP, KH_EMPTY)) == 0) {      \
+        g = (g + (++step)) & gmask;                                     \
       }                                                                 \
-      pic_free(pic, h->flags); /* free the working space */             \
-      h->flags = new_flags;                                             \
-      h->n_buckets = new_n_buckets;                                     \
-      h->n_occupied = h->size;                                          \
-      h->upper_bound = ac_hash_upper(h->n_buckets);                     \
+      i = g * KH_GROUP + kh_ctz(m);                                     \
+      ctrl[i] = kh_h2(k);                                               \
+      keys[i] = h->keys[j];                                             \
+      if (kh_is_map) vals[i] = h->vals[j];                              \
     }                                                                   \
+    kh_destroy_##name(pic, h);                                          \
+    h->ctrl = ctrl;                                                     \
+    h->keys = keys;                                                     \
+    h->vals = vals;                                                     \
+    h->n_buckets = new_n_buckets;                                       \
+    h->n_occupied = h->size;                                            \
+    h->upper_bound = kh_upper(new_n_buckets);                           \
   }                                                                     \
   int kh_put_##name(pic_state *pic, kh_##name##_t *h, khkey_t key, int *ret) \
   {                                                                     \
-    int x;                                                              \
+    unsigned long k;                                                    \
+    unsigned m;                                                         \
+    int g, gmask, step = 0, x = -1;                                     \
     if (h->n_occupied >= h->upper_bound) { /* update the hash table */  \
       if (h->n_buckets > (h->size<<1)) {                                \
-        kh_resize_##name(pic, h, h->n_buckets - 1); /* clear "deleted" elements */ \
+        kh_resize_##name(pic, h, h->n_buckets); /* clear "deleted" elements */ \
       } else {                                                          \
         kh_resize_##name(pic, h, h->n_buckets + 1); /* expand the hash table */ \
       }                                                                 \
-    } /* TODO: to implement automatically shrinking; resize() already support shrinking */ \
-    {                                                                   \
-      int k, i, site, last, mask = h->n_buckets - 1, step = 0;          \
-      x = site = h->n_buckets; k = hash_func(key); i = k & mask;        \
-      if (ac_isempty(h->flags, i)) x = i; /* for speed up */            \
-      else {                                                            \
-        last = i;                                                       \
-        while (!ac_isempty(h->flags, i) && (ac_isdel(h->flags, i) || !hash_equal(h->keys[i], key))) { \
-          if (ac_isdel(h->flags, i)) site = i;                          \
-          i = (i + (++step)) & mask;                                    \
-          if (i == last) { x = site; break; }                           \
-        }                                                               \
-        if (x == h->n_buckets) {                                        \
-          if (ac_isempty(h->flags, i) && site != h->n_buckets) x = site; \
-          else x = i;                                                   \
+    }                                                                   \
+    k = kh_mix(hash_func(key));                                         \
+    gmask = kh_gmask(h->n_buckets);                                     \
+    g = kh_h1(k, gmask);                                                \
+    while (1) {                                                         \
+      const signed char *group = h->ctrl + g * KH_GROUP;                \
+      for (m = kh_match(group, kh_h2(k)); m != 0; m &= m - 1) {         \
+        int i = g * KH_GROUP + kh_ctz(m);                               \
+        if (hash_equal(h->keys[i], key)) {                              \
+          *ret = 0; /* Don't touch h->keys[i] if present */             \
+          return i;                                                     \
         }                                                               \
       }                                                                 \
+      if (x < 0 && (m = kh_match_free(group)) != 0) {                   \
+        x = g * KH_GROUP + kh_ctz(m);                                   \
+      }                                                                 \
+      if (kh_match(group, KH_EMPTY)) break;                             \
+      g = (g + (++step)) & gmask;                                       \
     }                                                                   \
-    if (ac_isempty(h->flags, x)) { /* not present at all */		\
-      h->keys[x] = key;                                                 \
-      ac_set_isboth_false(h->flags, x);                                 \
-      ++h->size; ++h->n_occupied;                                       \
+    if (h->ctrl[x] == KH_EMPTY) { /* not present at all */              \
+      ++h->n_occupied;                                                  \
       *ret = 1;                                                         \
-    } else if (ac_isdel(h->flags, x)) { /* deleted */                   \
-      h->keys[x] = key;                                                 \
-      ac_set_isboth_false(h->flags, x);                                 \
-      ++h->size;                                                        \
+    } else { /* deleted */                                              \
       *ret = 2;                                                         \
-    } else *ret = 0; /* Don't touch h->keys[x] if present and not deleted */ \
+    }                                                                   \
+    h->ctrl[x] = kh_h2(k);                                              \
+    h->keys[x] = key;                                                   \
+    ++h->size;                                                          \
     return x;                                                           \
   }                                                                     \
   void kh_del_##name(kh_##name##_t *h, int x)                           \
   {                                                                     \
-    if (x != h->n_buckets && !ac_iseither(h->flags, x)) {               \
-      ac_set_isdel_true(h->flags, x);                                   \
+    if (x != h->n_buckets && kh_isfull(h->ctrl[x])) {                   \
+      /* no probe has gone past a group with an empty bucket, so       \
+         the bucket can be emptied instead of leaving a tombstone */   \
+      if (kh_match(h->ctrl + (x & ~(KH_GROUP - 1)), KH_EMPTY)) {        \
+        h->ctrl[x] = KH_EMPTY;                                          \
+        --h->n_occupied;                                                \
+      } else {                                                          \
+        h->ctrl[x] = KH_DELETED;                                        \
+      }                                                                 \
       --h->size;                                                        \
     }                                                                   \
   }
 
+/* kh_get for a key of another type, e.g. a borrowed buffer looked up in
+   a table of string objects. hash_func(key) must agree with the table's
+   hash of every stored key equal to it. */
+#define KHASH_DEFINE_LOOKUP(name, lookup_t, hash_func, hash_equal)       \
+  static int kh_lookup_##name(pic_state *pic, const kh_##name##_t *h, lookup_t key) \
+  {                                                                     \
+    (void)pic;                                                          \
+    KHASH_FIND(h, key, hash_func, hash_equal)                           \
+  }
+
 /* --- BEGIN OF HASH FUNCTIONS --- */
 
 #define kh_ptr_hash_func(key) (int)(long)(key)
@@ -220,9 +322,10 @@ PIC_STATIC_INLINE int kh_str_hash_func(const char *s) {
 #define kh_resize(name, h, s) kh_resize_##name(pic, h, s)
 #define kh_put(name, h, k, r) kh_put_##name(pic, h, k, r)
 #define kh_get(name, h, k) kh_get_##name(pic, h, k)
+#define kh_lookup(name, h, k) kh_lookup_##name(pic, h, k)
 #define kh_del(name, h, k) kh_del_##name(h, k)
 
-#define kh_exist(h, x) (!ac_iseither((h)->flags, (x)))
+#define kh_exist(h, x) (kh_isfull((h)->ctrl[x]))
 #define kh_key(h, x) ((h)->keys[x])
 #define kh_val(h, x) ((h)->vals[x])
 #define kh_value(h, x) ((h)->vals[x])
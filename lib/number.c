@@ -6,186 +6,1839 @@
 #include "value.h"
 #include "object.h"
 
+/*
+ * Exact integers are fixnums in PIC_INT_MIN..PIC_INT_MAX (46 bits under
+ * nan-boxing, a long otherwise) and bignums beyond that. Arithmetic on
+ * two fixnums is done in long with overflow checks and only goes through
+ * the bignum routines when the result does not fit in a fixnum.
+ */
+
+#define FIXNUM_P(i) (PIC_INT_MIN <= (i) && (i) <= PIC_INT_MAX)
+
+/* whether f is integral and within fixnum range */
+#define FLOAT_FIXNUM_P(f) ((double) PIC_INT_MIN <= (f) && (f) < -(double) PIC_INT_MIN && (f) == (double) (long) (f))
+
+#define EXACT_INT_P(pic, v) (pic_int_p(pic, v) || pic_big_p(pic, v))
+#define NUMBER_P(pic, v) (pic_float_p(pic, v) || EXACT_INT_P(pic, v))
+#define ZERO_P(pic, v) (pic_int_p(pic, v) && pic_int(pic, v) == 0)
+
+#if (defined(__GNUC__) && __GNUC__ >= 5) || defined(__clang__)
+# define long_add_overflow(a, b, r) __builtin_add_overflow(a, b, r)
+# define long_sub_overflow(a, b, r) __builtin_sub_overflow(a, b, r)
+# define long_mul_overflow(a, b, r) __builtin_mul_overflow(a, b, r)
+#else
+static bool
+long_add_overflow(long a, long b, long *r)
+{
+  if (b > 0 ? a > LONG_MAX - b : a < LONG_MIN - b)
+    return true;
+  *r = a + b;
+  return false;
+}
+
+static bool
+long_sub_overflow(long a, long b, long *r)
+{
+  if (b < 0 ? a > LONG_MAX + b : a < LONG_MIN + b)
+    return true;
+  *r = a - b;
+  return false;
+}
+
+static bool
+long_mul_overflow(long a, long b, long *r)
+{
+  if (a > 0 ? (b > 0 ? a > LONG_MAX / b : b < LONG_MIN / a)
+            : (b > 0 ? a < LONG_MIN / b : a != 0 && b < LONG_MAX / a))
+    return true;
+  *r = a * b;
+  return false;
+}
+#endif
+
+static bool
+int_add(long a, long b, long *r)
+{
+  return ! long_add_overflow(a, b, r) && FIXNUM_P(*r);
+}
+
+static bool
+int_sub(long a, long b, long *r)
+{
+  return ! long_sub_overflow(a, b, r) && FIXNUM_P(*r);
+}
+
+static bool
+int_mul(long a, long b, long *r)
+{
+  return ! long_mul_overflow(a, b, r) && FIXNUM_P(*r);
+}
+
+static bool
+int_div(long a, long b, long *r)
+{
+  if (b == -1) {
+    return int_sub(0, a, r);
+  }
+  if (b == 0 || a % b != 0) {
+    return false;
+  }
+  *r = a / b;
+  return true;
+}
+
+/*
+ * Magnitudes
+ *
+ * A magnitude is a little-endian array of bigits. Routines take their
+ * operands as (digits, length) pairs and write results into buffers the
+ * caller provides; lengths are trimmed of leading zeros where noted.
+ */
+
+#define BIGIT_MAX ((bigit2_t) (bigit_t) -1)
+#define BIGIT_BASE ((double) BIGIT_MAX + 1)
+#define LONG_BIGITS ((int) (sizeof(long) * CHAR_BIT / BIGIT_BITS))
+
+#define KARATSUBA_CUTOFF 32     /* in bigits, below which multiplication is schoolbook */
+#define RADIX_CUTOFF 32         /* in bigits, below which radix conversion is a bigit at a time */
+
+static bigit_t *
+mag_alloc(pic_state *pic, int n)
+{
+  return pic_malloc(pic, sizeof(bigit_t) * (n > 0 ? n : 1));
+}
+
+static int
+mag_trim(const bigit_t *d, int n)
+{
+  while (n > 0 && d[n - 1] == 0)
+    n--;
+  return n;
+}
+
+/* a and b must be trimmed */
+static int
+mag_cmp(const bigit_t *a, int an, const bigit_t *b, int bn)
+{
+  if (an != bn) {
+    return an < bn ? -1 : 1;
+  }
+  while (an-- > 0) {
+    if (a[an] != b[an])
+      return a[an] < b[an] ? -1 : 1;
+  }
+  return 0;
+}
+
+/* r = a + b for an >= bn, returning the carry out of r[an - 1] */
+static bigit_t
+mag_add(bigit_t *r, const bigit_t *a, int an, const bigit_t *b, int bn)
+{
+  bigit2_t t = 0;
+  int i;
+
+  for (i = 0; i < bn; ++i) {
+    t += (bigit2_t) a[i] + b[i];
+    r[i] = (bigit_t) t;
+    t >>= BIGIT_BITS;
+  }
+  for (; i < an; ++i) {
+    t += a[i];
+    r[i] = (bigit_t) t;
+    t >>= BIGIT_BITS;
+  }
+  return (bigit_t) t;
+}
+
+/* r = a - b for a >= b */
+static void
+mag_sub(bigit_t *r, const bigit_t *a, int an, const bigit_t *b, int bn)
+{
+  bigit2_t t, borrow = 0;
+  int i;
+
+  for (i = 0; i < bn; ++i) {
+    t = (bigit2_t) a[i] - b[i] - borrow;
+    r[i] = (bigit_t) t;
+    borrow = t >> BIGIT_BITS & 1;
+  }
+  for (; i < an; ++i) {
+    t = (bigit2_t) a[i] - borrow;
+    r[i] = (bigit_t) t;
+    borrow = t >> BIGIT_BITS & 1;
+  }
+}
+
+/* d = d * m + a in place, returning the carry out of d[n - 1] */
+static bigit_t
+mag_muladd1(bigit_t *d, int n, bigit_t m, bigit_t a)
+{
+  bigit2_t t = a;
+  int i;
+
+  for (i = 0; i < n; ++i) {
+    t += (bigit2_t) d[i] * m;
+    d[i] = (bigit_t) t;
+    t >>= BIGIT_BITS;
+  }
+  return (bigit_t) t;
+}
+
+/* q = a / m, returning the remainder; q may be a */
+static bigit_t
+mag_divmod1(bigit_t *q, const bigit_t *a, int n, bigit_t m)
+{
+  bigit2_t r = 0;
+  int i;
+
+  for (i = n - 1; i >= 0; --i) {
+    r = r << BIGIT_BITS | a[i];
+    q[i] = (bigit_t) (r / m);
+    r %= m;
+  }
+  return (bigit_t) r;
+}
+
+/* r = a << s for 0 <= s < BIGIT_BITS, returning the bits shifted out */
+static bigit_t
+mag_shl(bigit_t *r, const bigit_t *a, int n, int s)
+{
+  bigit2_t t = 0;
+  int i;
+
+  for (i = 0; i < n; ++i) {
+    t |= (bigit2_t) a[i] << s;
+    r[i] = (bigit_t) t;
+    t >>= BIGIT_BITS;
+  }
+  return (bigit_t) t;
+}
+
+/* r = a >> s for 0 <= s < BIGIT_BITS; r may be a */
+static void
+mag_shr(bigit_t *r, const bigit_t *a, int n, int s)
+{
+  int i;
+
+  for (i = 0; i < n; ++i) {
+    bigit2_t hi = i + 1 < n ? a[i + 1] : 0;
+    r[i] = (bigit_t) (((bigit2_t) a[i] | hi << BIGIT_BITS) >> s);
+  }
+}
+
+/* r += a * b, where r has an + bn digits */
+static void
+mag_mul_school(bigit_t *r, const bigit_t *a, int an, const bigit_t *b, int bn)
+{
+  bigit2_t t, x;
+  int i, j;
+
+  for (i = 0; i < an; ++i) {
+    if ((x = a[i]) == 0)
+      continue;
+    t = 0;
+    for (j = 0; j < bn; ++j) {
+      t += x * b[j] + r[i + j];
+      r[i + j] = (bigit_t) t;
+      t >>= BIGIT_BITS;
+    }
+    r[i + bn] = (bigit_t) t;
+  }
+}
+
+/*
+ * r = a * b, where r has an + bn digits and overlaps neither operand.
+ *
+ * Operands of KARATSUBA_CUTOFF digits or more are split in halves and
+ * multiplied with three recursive products instead of four:
+ *
+ *   a b = z2 B^2h + ((a0 + a1) (b0 + b1) - z2 - z0) B^h + z0
+ *
+ * where z0 = a0 b0 and z2 = a1 b1. A much longer a is cut into slices
+ * the length of b first so that the halves stay balanced.
+ */
+static void
+mag_mul(pic_state *pic, bigit_t *r, const bigit_t *a, int an, const bigit_t *b, int bn)
+{
+  bigit_t *t, *sa, *sb, *z1;
+  int h, i, m, n;
+
+  if (an < bn) {
+    const bigit_t *tmp = a;
+    a = b;
+    b = tmp;
+    i = an;
+    an = bn;
+    bn = i;
+  }
+
+  if (bn < KARATSUBA_CUTOFF) {
+    memset(r, 0, sizeof(bigit_t) * (an + bn));
+    mag_mul_school(r, a, an, b, bn);
+    return;
+  }
+
+  if (an >= 2 * bn) {
+    t = mag_alloc(pic, 2 * bn);
+    memset(r, 0, sizeof(bigit_t) * (an + bn));
+    for (i = 0; i < an; i += bn) {
+      m = an - i < bn ? an - i : bn;
+      mag_mul(pic, t, a + i, m, b, bn);
+      mag_add(r + i, r + i, an + bn - i, t, m + bn);
+    }
+    pic_free(pic, t);
+    return;
+  }
+
+  h = (an + 1) / 2;             /* bn >= h since an < 2 bn */
+
+  mag_mul(pic, r, a, h, b, h);
+  if (bn > h) {
+    mag_mul(pic, r + 2 * h, a + h, an - h, b + h, bn - h);
+  } else {
+    memset(r + 2 * h, 0, sizeof(bigit_t) * (an + bn - 2 * h));
+  }
+
+  t = mag_alloc(pic, 4 * h + 4);
+  sa = t;
+  sb = t + h + 1;
+  z1 = t + 2 * h + 2;
+
+  sa[h] = mag_add(sa, a, h, a + h, an - h);
+  if (bn > h) {
+    sb[h] = mag_add(sb, b, h, b + h, bn - h);
+  } else {
+    memcpy(sb, b, sizeof(bigit_t) * h);
+    sb[h] = 0;
+  }
+  mag_mul(pic, z1, sa, h + 1, sb, h + 1);
+  mag_sub(z1, z1, 2 * h + 2, r, 2 * h);
+  mag_sub(z1, z1, 2 * h + 2, r + 2 * h, an + bn - 2 * h);
+  n = mag_trim(z1, 2 * h + 2);
+  mag_add(r + h, r + h, an + bn - h, z1, n);
+
+  pic_free(pic, t);
+}
+
+/*
+ * q = a / b and r = a % b for an >= bn and b trimmed, where q has
+ * an - bn + 1 digits and r has bn. Knuth's algorithm D.
+ */
+static void
+mag_divmod(pic_state *pic, bigit_t *q, bigit_t *r, const bigit_t *a, int an, const bigit_t *b, int bn)
+{
+  bigit_t *u, *v;
+  bigit2_t qhat, rhat, p, t, carry, borrow;
+  int s, i, j;
+
+  if (bn == 1) {
+    r[0] = mag_divmod1(q, a, an, b[0]);
+    return;
+  }
+
+  /* normalize so that the top bit of the divisor is set */
+  for (s = 0, t = b[bn - 1]; t <= BIGIT_MAX >> 1; t <<= 1) {
+    s++;
+  }
+  u = mag_alloc(pic, an + 1);
+  v = mag_alloc(pic, bn);
+  mag_shl(v, b, bn, s);
+  u[an] = mag_shl(u, a, an, s);
+
+  for (j = an - bn; j >= 0; --j) {
+    t = (bigit2_t) u[j + bn] << BIGIT_BITS | u[j + bn - 1];
+    qhat = t / v[bn - 1];
+    rhat = t % v[bn - 1];
+    while (qhat > BIGIT_MAX || qhat * v[bn - 2] > (rhat << BIGIT_BITS | u[j + bn - 2])) {
+      qhat--;
+      rhat += v[bn - 1];
+      if (rhat > BIGIT_MAX)
+        break;
+    }
+
+    carry = borrow = 0;
+    for (i = 0; i < bn; ++i) {
+      p = qhat * v[i] + carry;
+      carry = p >> BIGIT_BITS;
+      t = (bigit2_t) u[i + j] - (bigit_t) p - borrow;
+      u[i + j] = (bigit_t) t;
+      borrow = t >> BIGIT_BITS & 1;
+    }
+    t = (bigit2_t) u[j + bn] - carry - borrow;
+    u[j + bn] = (bigit_t) t;
+
+    if (t >> BIGIT_BITS & 1) {  /* qhat was one too large */
+      qhat--;
+      carry = 0;
+      for (i = 0; i < bn; ++i) {
+        t = (bigit2_t) u[i + j] + v[i] + carry;
+        u[i + j] = (bigit_t) t;
+        carry = t >> BIGIT_BITS;
+      }
+      u[j + bn] += (bigit_t) carry;
+    }
+    q[j] = (bigit_t) qhat;
+  }
+  mag_shr(r, u, bn, s);
+
+  pic_free(pic, u);
+  pic_free(pic, v);
+}
+
+static double
+mag_float(const bigit_t *d, int n)
+{
+  double f = 0;
+  int i;
+
+  /* only the leading 64 bits or so can affect the result */
+  for (i = n - 1; i >= 0; --i) {
+    f = f * BIGIT_BASE + (n - i <= 64 / BIGIT_BITS + 1 ? d[i] : 0);
+  }
+  return f;
+}
+
+/*
+ * Exact integers
+ */
+
+struct intview {
+  const bigit_t *d;
+  int n;
+  bool neg;
+  bigit_t buf[LONG_BIGITS];
+};
+
+/* the magnitude of a fixnum or a bignum, valid while v is */
+static void
+int_view(pic_state *pic, pic_value v, struct intview *x)
+{
+  if (pic_int_p(pic, v)) {
+    long i = pic_int(pic, v);
+    unsigned long u = i < 0 ? 0ul - (unsigned long) i : (unsigned long) i;
+
+    x->neg = i < 0;
+    for (x->n = 0; u != 0; u >>= BIGIT_BITS) {
+      x->buf[x->n++] = (bigit_t) u;
+    }
+    x->d = x->buf;
+  } else {
+    struct bignum *big = big_ptr(pic, v);
+
+    x->neg = big->neg;
+    x->n = big->len;
+    x->d = big->digits;
+  }
+}
+
+/* takes d, which must come from mag_alloc */
+static pic_value
+int_value(pic_state *pic, bool neg, bigit_t *d, int n)
+{
+  struct bignum *big;
+
+  n = mag_trim(d, n);
+  if (n <= LONG_BIGITS) {
+    unsigned long u = 0;
+    int i;
+
+    for (i = n - 1; i >= 0; --i) {
+      u = u << BIGIT_BITS | d[i];
+    }
+    if (u <= (unsigned long) PIC_INT_MAX + neg) {
+      pic_free(pic, d);
+      return pic_int_value(pic, u == 0 ? 0 : neg ? -(long) (u - 1) - 1 : (long) u);
+    }
+  }
+  big = (struct bignum *) pic_obj_alloc(pic, PIC_TYPE_BIGNUM);
+  big->neg = neg;
+  big->len = n;
+  big->digits = d;
+  pic_obj_charge(pic, (struct object *) big, sizeof(bigit_t) * n);
+  return obj_value(pic, big);
+}
+
+static int
+int_sign(pic_state *pic, pic_value v)
+{
+  if (pic_int_p(pic, v)) {
+    return pic_int(pic, v) < 0 ? -1 : pic_int(pic, v) > 0;
+  }
+  return big_ptr(pic, v)->neg ? -1 : 1;
+}
+
+static int
+int_cmp(pic_state *pic, pic_value a, pic_value b)
+{
+  struct intview x, y;
+  int c;
+
+  if (pic_int_p(pic, a) && pic_int_p(pic, b)) {
+    return pic_int(pic, a) < pic_int(pic, b) ? -1 : pic_int(pic, a) > pic_int(pic, b);
+  }
+  int_view(pic, a, &x);
+  int_view(pic, b, &y);
+  if (x.neg != y.neg) {
+    return x.neg ? -1 : 1;
+  }
+  c = mag_cmp(x.d, x.n, y.d, y.n);
+  return x.neg ? -c : c;
+}
+
+static pic_value
+big_addsub(pic_state *pic, pic_value a, pic_value b, bool sub)
+{
+  struct intview x, y, *p, *q;
+  bigit_t *d;
+
+  int_view(pic, a, &x);
+  int_view(pic, b, &y);
+  y.neg = y.neg != sub;
+
+  if (x.neg == y.neg) {
+    p = x.n >= y.n ? &x : &y;
+    q = x.n >= y.n ? &y : &x;
+    d = mag_alloc(pic, p->n + 1);
+    d[p->n] = mag_add(d, p->d, p->n, q->d, q->n);
+    return int_value(pic, x.neg, d, p->n + 1);
+  }
+  if (mag_cmp(x.d, x.n, y.d, y.n) >= 0) {
+    p = &x;
+    q = &y;
+  } else {
+    p = &y;
+    q = &x;
+  }
+  d = mag_alloc(pic, p->n);
+  mag_sub(d, p->d, p->n, q->d, q->n);
+  return int_value(pic, p->neg, d, p->n);
+}
+
+static pic_value
+big_mul(pic_state *pic, pic_value a, pic_value b)
+{
+  struct intview x, y;
+  bigit_t *d;
+
+  int_view(pic, a, &x);
+  int_view(pic, b, &y);
+  if (x.n == 0 || y.n == 0) {
+    return pic_int_value(pic, 0);
+  }
+  d = mag_alloc(pic, x.n + y.n);
+  mag_mul(pic, d, x.d, x.n, y.d, y.n);
+  return int_value(pic, x.neg != y.neg, d, x.n + y.n);
+}
+
+static pic_value
+int_neg(pic_state *pic, pic_value v)
+{
+  if (pic_int_p(pic, v) && pic_int(pic, v) != PIC_INT_MIN) {
+    return pic_int_value(pic, -pic_int(pic, v));
+  }
+  return big_addsub(pic, pic_int_value(pic, 0), v, true);
+}
+
+static pic_value
+int_abs(pic_state *pic, pic_value v)
+{
+  return int_sign(pic, v) < 0 ? int_neg(pic, v) : v;
+}
+
+/* truncating division; b must not be zero */
+static void
+int_divmod(pic_state *pic, pic_value a, pic_value b, pic_value *q, pic_value *r)
+{
+  struct intview x, y;
+  bigit_t *qd, *rd;
+  bool neg;
+
+  if (pic_int_p(pic, a) && pic_int_p(pic, b) && pic_int(pic, b) != -1) {
+    *q = pic_int_value(pic, pic_int(pic, a) / pic_int(pic, b));
+    *r = pic_int_value(pic, pic_int(pic, a) % pic_int(pic, b));
+    return;
+  }
+
+  int_view(pic, a, &x);
+  int_view(pic, b, &y);
+  if (mag_cmp(x.d, x.n, y.d, y.n) < 0) {
+    *q = pic_int_value(pic, 0);
+    *r = a;
+    return;
+  }
+  qd = mag_alloc(pic, x.n - y.n + 1);
+  rd = mag_alloc(pic, y.n);
+  mag_divmod(pic, qd, rd, x.d, x.n, y.d, y.n);
+  neg = x.neg;
+  *q = int_value(pic, x.neg != y.neg, qd, x.n - y.n + 1);
+  *r = int_value(pic, neg, rd, y.n);
+}
+
+double
+pic_big_float(pic_state *pic, pic_value v)
+{
+  struct bignum *big = big_ptr(pic, v);
+  double f = mag_float(big->digits, big->len);
+
+  return big->neg ? -f : f;
+}
+
+static double
+num_float(pic_state *pic, pic_value v)
+{
+  switch (pic_type(pic, v)) {
+  case PIC_TYPE_FLOAT:
+    return pic_float(pic, v);
+  case PIC_TYPE_INT:
+    return pic_int(pic, v);
+  default:
+    return pic_big_float(pic, v);
+  }
+}
+
+static pic_value
+big_div(pic_state *pic, pic_value a, pic_value b)
+{
+  pic_value q, r;
+
+  if (! ZERO_P(pic, b)) {
+    int_divmod(pic, a, b, &q, &r);
+    if (ZERO_P(pic, r)) {
+      return q;
+    }
+  }
+  return pic_float_value(pic, num_float(pic, a) / num_float(pic, b));
+}
+
+/* v * 2^k, rounding toward negative infinity when k < 0 */
+static pic_value
+int_shift(pic_state *pic, pic_value v, int k)
+{
+  struct intview x;
+  bigit_t *d;
+  bool lost = false;
+  int n, q, r, i;
+
+  int_view(pic, v, &x);
+  if (x.n == 0 || k == 0) {
+    return v;
+  }
+  if (k > 0) {
+    q = k / BIGIT_BITS;
+    r = k % BIGIT_BITS;
+    n = x.n + q + 1;
+    d = mag_alloc(pic, n);
+    memset(d, 0, sizeof(bigit_t) * q);
+    d[n - 1] = mag_shl(d + q, x.d, x.n, r);
+    return int_value(pic, x.neg, d, n);
+  }
+
+  q = -(k / BIGIT_BITS);
+  r = -(k % BIGIT_BITS);
+  if (q >= x.n) {
+    return pic_int_value(pic, x.neg ? -1 : 0);
+  }
+  for (i = 0; i < q; ++i) {
+    lost = lost || x.d[i] != 0;
+  }
+  lost = lost || (x.d[q] & (((bigit2_t) 1 << r) - 1)) != 0;
+  n = x.n - q;
+  d = mag_alloc(pic, n + 1);
+  mag_shr(d, x.d + q, n, r);
+  d[n] = 0;
+  if (x.neg && lost) {
+    for (i = 0; ++d[i] == 0; ++i)
+      ;
+  }
+  return int_value(pic, x.neg, d, n + 1);
+}
+
+static int
+int_length(pic_state *pic, pic_value v)
+{
+  struct intview x;
+  bigit_t top;
+  int n;
+
+  int_view(pic, v, &x);
+  if (x.n == 0) {
+    return 0;
+  }
+  for (n = (x.n - 1) * BIGIT_BITS, top = x.d[x.n - 1]; top != 0; top >>= 1) {
+    n++;
+  }
+  return n;
+}
+
+int
+pic_big_bytes(pic_state *pic, pic_value v, unsigned char *buf)
+{
+  struct bignum *big = big_ptr(pic, v);
+  int i, j, n = 0;
+
+  for (i = 0; i < big->len; ++i) {
+    for (j = 0; j < BIGIT_BITS / 8; ++j, ++n) {
+      if (buf) {
+        buf[n] = (unsigned char) (big->digits[i] >> j * 8);
+      }
+    }
+  }
+  return n;
+}
+
+pic_value
+pic_big_value(pic_state *pic, bool neg, const unsigned char *buf, int len)
+{
+  int n = (len + BIGIT_BITS / 8 - 1) / (BIGIT_BITS / 8), i;
+  bigit_t *d = mag_alloc(pic, n);
+
+  memset(d, 0, sizeof(bigit_t) * n);
+  for (i = 0; i < len; ++i) {
+    d[i / (BIGIT_BITS / 8)] |= (bigit_t) ((bigit2_t) buf[i] << i % (BIGIT_BITS / 8) * 8);
+  }
+  return int_value(pic, neg, d, n);
+}
+
+/* the integer part of a finite f */
+static pic_value
+float_to_int(pic_state *pic, double f)
+{
+  double m, p;
+  bigit_t *d;
+  int i, n;
+
+  if ((double) PIC_INT_MIN <= f && f < -(double) PIC_INT_MIN) {
+    return pic_int_value(pic, (long) f);
+  }
+  m = f < 0 ? -f : f;
+  for (n = 1, p = 1; m >= p * BIGIT_BASE; ++n) {
+    p *= BIGIT_BASE;
+  }
+  d = mag_alloc(pic, n);
+  for (i = n - 1; i >= 0; --i) {
+    d[i] = (bigit_t) (m / p);
+    m -= d[i] * p;
+    p /= BIGIT_BASE;
+  }
+  return int_value(pic, f < 0, d, n);
+}
+
+/* flonum rounding without libm: above 2^52 every double is integral */
+static double
+flo_floor(double f)
+{
+  const double c = 4503599627370496.0;
+  double r;
+
+  if (! (-c < f && f < c)) {
+    return f;
+  }
+  r = f >= 0 ? (f + c) - c : (f - c) + c;
+  return r > f ? r - 1 : r;
+}
+
+static double
+flo_trunc(double f)
+{
+  return f < 0 ? -flo_floor(-f) : flo_floor(f);
+}
+
+static pic_value
+pic_number_number_p(pic_state *pic)
+{
+  pic_value v;
+
+  pic_get_args(pic, "o", &v);
+
+  return pic_bool_value(pic, NUMBER_P(pic, v));
+}
+
+static pic_value
+pic_number_exact_p(pic_state *pic)
+{
+  pic_value v;
+
+  pic_get_args(pic, "o", &v);
+
+  return pic_bool_value(pic, EXACT_INT_P(pic, v));
+}
+
+static pic_value
+pic_number_exact_integer_p(pic_state *pic)
+{
+  pic_value v;
+
+  pic_get_args(pic, "o", &v);
+
+  return pic_bool_value(pic, EXACT_INT_P(pic, v));
+}
+
+static pic_value
+pic_number_inexact_p(pic_state *pic)
+{
+  pic_value v;
+
+  pic_get_args(pic, "o", &v);
+
+  return pic_bool_value(pic, pic_float_p(pic, v));
+}
+
+static pic_value
+pic_number_inexact(pic_state *pic)
+{
+  double f;
+
+  pic_get_args(pic, "f", &f);
+
+  return pic_float_value(pic, f);
+}
+
+static pic_value
+pic_number_exact(pic_state *pic)
+{
+  pic_value v;
+  double f;
+
+  pic_get_args(pic, "o", &v);
+
+  if (EXACT_INT_P(pic, v)) {
+    return v;
+  }
+  if (! pic_float_p(pic, v)) {
+    pic_error(pic, "exact: number required", 1, v);
+  }
+  f = pic_float(pic, v);
+  if (f - f != 0) {
+    pic_error(pic, "exact: finite number required", 1, v);
+  }
+  return float_to_int(pic, f);
+}
+
+#define pic_define_aop(name, op, exact, big)                            \
+  pic_value                                                             \
+  name(pic_state *pic, pic_value a, pic_value b)                        \
+  {                                                                     \
+    long r;                                                             \
+    if (pic_int_p(pic, a) && pic_int_p(pic, b)) {                       \
+      if (exact(pic_int(pic, a), pic_int(pic, b), &r)) {                \
+        return pic_int_value(pic, r);                                   \
+      }                                                                 \
+      return big;                                                       \
+    } else if (pic_float_p(pic, a) && pic_float_p(pic, b)) {            \
+      return pic_float_value(pic, pic_float(pic, a) op pic_float(pic, b)); \
+    } else if (EXACT_INT_P(pic, a) && EXACT_INT_P(pic, b)) {            \
+      return big;                                                       \
+    } else if (NUMBER_P(pic, a) && NUMBER_P(pic, b)) {                  \
+      return pic_float_value(pic, num_float(pic, a) op num_float(pic, b)); \
+    } else {                                                            \
+      pic_error(pic, #name ": non-number operand given", 2, a, b);      \
+    }                                                                   \
+    PIC_UNREACHABLE();                                                  \
+  }
+
+pic_define_aop(pic_add, +, int_add, big_addsub(pic, a, b, false))
+pic_define_aop(pic_sub, -, int_sub, big_addsub(pic, a, b, true))
+pic_define_aop(pic_mul, *, int_mul, big_mul(pic, a, b))
+pic_define_aop(pic_div, /, int_div, big_div(pic, a, b))
+
+#define pic_define_cmp(name, op)                                        \
+  bool                                                                  \
+  name(pic_state *pic, pic_value a, pic_value b)                        \
+  {                                                                     \
+    if (pic_int_p(pic, a) && pic_int_p(pic, b)) {                       \
+      return pic_int(pic, a) op pic_int(pic, b);                        \
+    } else if (pic_float_p(pic, a) && pic_float_p(pic, b)) {            \
+      return pic_float(pic, a) op pic_float(pic, b);                    \
+    } else if (EXACT_INT_P(pic, a) && EXACT_INT_P(pic, b)) {            \
+      return int_cmp(pic, a, b) op 0;                                   \
+    } else if (NUMBER_P(pic, a) && NUMBER_P(pic, b)) {                  \
+      return num_float(pic, a) op num_float(pic, b);                    \
+    } else {                                                            \
+      pic_error(pic, #name ": non-number operand given", 2, a, b);      \
+    }                                                                   \
+    PIC_UNREACHABLE();                                                  \
+  }
+
+pic_define_cmp(pic_eq, ==)
+pic_define_cmp(pic_lt, <)
+pic_define_cmp(pic_le, <=)
+pic_define_cmp(pic_gt, >)
+pic_define_cmp(pic_ge, >=)
+
+#define DEFINE_CMP(op)                                  \
+  static pic_value                                      \
+  pic_number_##op(pic_state *pic)                       \
+  {                                                     \
+    int argc, i;                                        \
+    pic_value *argv;                                    \
+                                                        \
+    pic_get_args(pic, "*", &argc, &argv);               \
+                                                        \
+    if (argc < 2) {                                     \
+      return pic_true_value(pic);                          \
+    }                                                   \
+                                                        \
+    for (i = 1; i < argc; ++i) {                        \
+      if (! pic_##op(pic, argv[i - 1], argv[i])) {      \
+        return pic_false_value(pic);                       \
+      }                                                 \
+    }                                                   \
+    return pic_true_value(pic);                            \
+  }
+
+DEFINE_CMP(eq)
+DEFINE_CMP(lt)
+DEFINE_CMP(le)
+DEFINE_CMP(gt)
+DEFINE_CMP(ge)
+
+#define DEFINE_AOP(op, v1, c0)                  \
+  static pic_value                              \
+  pic_number_##op(pic_state *pic)               \
+  {                                             \
+    int argc, i;                                \
+    pic_value *argv, tmp;                       \
+                                                \
+    pic_get_args(pic, "*", &argc, &argv);       \
+                                                \
+    if (argc == 0) {                            \
+      c0;                                       \
+    }                                           \
+    else if (argc == 1) {                       \
+      return v1;                                \
+    }                                           \
+                                                \
+    tmp = argv[0];                              \
+    for (i = 1; i < argc; ++i) {                \
+      tmp = pic_##op(pic, tmp, argv[i]);        \
+    }                                           \
+    return tmp;                                 \
+  }
+
+DEFINE_AOP(add, argv[0], do {
+    return pic_int_value(pic, 0);
+  } while (0))
+DEFINE_AOP(mul, argv[0], do {
+    return pic_int_value(pic, 1);
+  } while (0))
+DEFINE_AOP(sub, pic_sub(pic, pic_int_value(pic, 0), argv[0]), do {
+    pic_error(pic, "-: at least one argument required", 0);
+  } while (0))
+DEFINE_AOP(div, pic_div(pic, pic_int_value(pic, 1), argv[0]), do {
+    pic_error(pic, "/: at least one argument required", 0);
+  } while (0))
+
+/* floor or truncating division of integers, or of flonums rounded the same way */
+static void
+number_divide(pic_state *pic, pic_value a, pic_value b, bool floor, pic_value *q, pic_value *r)
+{
+  if (EXACT_INT_P(pic, a) && EXACT_INT_P(pic, b)) {
+    if (ZERO_P(pic, b)) {
+      pic_error(pic, "integer division by zero", 2, a, b);
+    }
+    int_divmod(pic, a, b, q, r);
+    if (floor && ! ZERO_P(pic, *r) && int_sign(pic, *r) != int_sign(pic, b)) {
+      *q = pic_sub(pic, *q, pic_int_value(pic, 1));
+      *r = pic_add(pic, *r, b);
+    }
+  } else if (NUMBER_P(pic, a) && NUMBER_P(pic, b)) {
+    double f = num_float(pic, a), g = num_float(pic, b), k;
+
+    k = floor ? flo_floor(f / g) : flo_trunc(f / g);
+    *q = pic_float_value(pic, k);
+    *r = pic_float_value(pic, f - g * k);
+  } else {
+    pic_error(pic, "integer division: non-number operand given", 2, a, b);
+  }
+}
+
+#define DEFINE_DIV(name, floor, result)         \
+  static pic_value                              \
+  name(pic_state *pic)                          \
+  {                                             \
+    pic_value a, b, q, r;                       \
+                                                \
+    pic_get_args(pic, "oo", &a, &b);            \
+                                                \
+    number_divide(pic, a, b, floor, &q, &r);    \
+    return result;                              \
+  }
+
+DEFINE_DIV(pic_number_floor2, true, pic_values(pic, 2, q, r))
+DEFINE_DIV(pic_number_floor_quotient, true, q)
+DEFINE_DIV(pic_number_floor_remainder, true, r)
+DEFINE_DIV(pic_number_truncate2, false, pic_values(pic, 2, q, r))
+DEFINE_DIV(pic_number_truncate_quotient, false, q)
+DEFINE_DIV(pic_number_truncate_remainder, false, r)
+
+/* an exact integer argument, from an integral flonum if need be */
+static pic_value
+integer_arg(pic_state *pic, pic_value v, bool *inexact)
+{
+  if (EXACT_INT_P(pic, v)) {
+    return v;
+  }
+  if (pic_float_p(pic, v) && pic_float(pic, v) - pic_float(pic, v) == 0 && flo_floor(pic_float(pic, v)) == pic_float(pic, v)) {
+    *inexact = true;
+    return float_to_int(pic, pic_float(pic, v));
+  }
+  pic_error(pic, "integer required", 1, v);
+}
+
+static pic_value
+int_gcd(pic_state *pic, pic_value a, pic_value b)
+{
+  pic_value q, r;
+  size_t ai = pic_enter(pic);
+
+  a = int_abs(pic, a);
+  b = int_abs(pic, b);
+  while (! ZERO_P(pic, b)) {
+    if (pic_int_p(pic, a) && pic_int_p(pic, b)) {
+      long i = pic_int(pic, a), j = pic_int(pic, b), k;
+
+      while (j != 0) {
+        k = i % j;
+        i = j;
+        j = k;
+      }
+      a = pic_int_value(pic, i);
+      break;
+    }
+    int_divmod(pic, a, b, &q, &r);
+    a = b;
+    b = r;
+    pic_leave(pic, ai);
+    pic_protect(pic, a);
+    pic_protect(pic, b);
+  }
+  pic_leave(pic, ai);
+  return pic_protect(pic, a);
+}
+
+static pic_value
+pic_number_gcd(pic_state *pic)
+{
+  pic_value *argv, r = pic_int_value(pic, 0);
+  bool inexact = false;
+  int argc, i;
+
+  pic_get_args(pic, "*", &argc, &argv);
+
+  for (i = 0; i < argc; ++i) {
+    r = int_gcd(pic, r, integer_arg(pic, argv[i], &inexact));
+  }
+  return inexact ? pic_float_value(pic, num_float(pic, r)) : r;
+}
+
+static pic_value
+pic_number_lcm(pic_state *pic)
+{
+  pic_value *argv, r = pic_int_value(pic, 1), x, q, m;
+  bool inexact = false;
+  int argc, i;
+
+  pic_get_args(pic, "*", &argc, &argv);
+
+  for (i = 0; i < argc; ++i) {
+    x = int_abs(pic, integer_arg(pic, argv[i], &inexact));
+    if (ZERO_P(pic, x) || ZERO_P(pic, r)) {
+      r = pic_int_value(pic, 0);
+    } else {
+      int_divmod(pic, r, int_gcd(pic, r, x), &q, &m);
+      r = pic_mul(pic, q, x);
+    }
+  }
+  return inexact ? pic_float_value(pic, num_float(pic, r)) : r;
+}
+
+static unsigned long
+ulong_isqrt(unsigned long n)
+{
+  unsigned long x, y;
+  int bits = 0;
+
+  if (n < 2) {
+    return n;
+  }
+  for (x = n; x != 0; x >>= 1) {
+    bits++;
+  }
+  x = 1ul << (bits + 1) / 2;    /* >= sqrt(n) */
+  while ((y = (x + n / x) / 2) < x) {
+    x = y;
+  }
+  return x;
+}
+
+/*
+ * floor(sqrt(n)) for n >= 0. The square root of n's top half gives a
+ * starting point just above the answer, from which Newton's iteration
+ * descends in a couple of steps.
+ */
+static pic_value
+int_isqrt(pic_state *pic, pic_value n)
+{
+  pic_value x, y, q, r;
+  size_t ai;
+  int k;
+
+  if (pic_int_p(pic, n)) {
+    return pic_int_value(pic, (long) ulong_isqrt(pic_int(pic, n)));
+  }
+
+  ai = pic_enter(pic);
+
+  k = int_length(pic, n) / 4;
+  x = int_isqrt(pic, int_shift(pic, n, -2 * k));
+  x = int_shift(pic, pic_add(pic, x, pic_int_value(pic, 1)), k);
+  while (1) {
+    int_divmod(pic, n, x, &q, &r);
+    y = int_shift(pic, pic_add(pic, x, q), -1);
+    if (int_cmp(pic, y, x) >= 0)
+      break;
+    x = y;
+    pic_leave(pic, ai);
+    pic_protect(pic, x);
+  }
+  pic_leave(pic, ai);
+  return pic_protect(pic, x);
+}
+
+static pic_value
+pic_number_exact_integer_sqrt(pic_state *pic)
+{
+  pic_value n, s;
+
+  pic_get_args(pic, "o", &n);
+
+  if (! EXACT_INT_P(pic, n) || int_sign(pic, n) < 0) {
+    pic_error(pic, "exact-integer-sqrt: non-negative exact integer required", 1, n);
+  }
+  s = int_isqrt(pic, n);
+  return pic_values(pic, 2, s, pic_sub(pic, n, pic_mul(pic, s, s)));
+}
+
+/*
+ * Bitwise operations
+ *
+ * Integers act as two's complement numbers with infinitely many sign
+ * bits. Fixnum operands are combined directly in long; bignums are
+ * widened to two's complement one digit longer than the wider operand,
+ * combined digit by digit and converted back.
+ */
+
+#if (defined(__GNUC__) && __GNUC__ >= 4) || defined(__clang__)
+# define ulong_popcount(u) __builtin_popcountl(u)
+# define ulong_ctz(u) __builtin_ctzl(u)
+#else
+static int
+ulong_popcount(unsigned long u)
+{
+  int n;
+
+  for (n = 0; u != 0; u &= u - 1) {
+    n++;
+  }
+  return n;
+}
+
+/* u must not be zero */
+static int
+ulong_ctz(unsigned long u)
+{
+  int n;
+
+  for (n = 0; (u & 1) == 0; u >>= 1) {
+    n++;
+  }
+  return n;
+}
+#endif
+
+/* shifting a long this far or further leaves only its sign */
+#define LONG_SHIFT_MAX ((int) (sizeof(long) * CHAR_BIT - 1))
+
+static pic_value
+bit_arg(pic_state *pic, pic_value v)
+{
+  if (! EXACT_INT_P(pic, v)) {
+    pic_error(pic, "exact integer required", 1, v);
+  }
+  return v;
+}
+
+/* d = -d modulo BIGIT_BASE^n */
+static void
+mag_negate(bigit_t *d, int n)
+{
+  bigit2_t carry = 1;
+  int i;
+
+  for (i = 0; i < n; ++i) {
+    carry += (bigit_t) ~d[i];
+    d[i] = (bigit_t) carry;
+    carry >>= BIGIT_BITS;
+  }
+}
+
+/* the low n digits of v in two's complement */
+static void
+int_twos(pic_state *pic, pic_value v, bigit_t *d, int n)
+{
+  struct intview x;
+  int i;
+
+  int_view(pic, v, &x);
+  for (i = 0; i < n; ++i) {
+    d[i] = i < x.n ? x.d[i] : 0;
+  }
+  if (x.neg) {
+    mag_negate(d, n);
+  }
+}
+
+static pic_value
+int_bitop(pic_state *pic, int op, pic_value a, pic_value b)
+{
+  struct intview x, y;
+  bigit_t *d, *e;
+  bool neg;
+  int n, i;
+
+  if (pic_int_p(pic, a) && pic_int_p(pic, b)) {
+    long i = pic_int(pic, a), j = pic_int(pic, b);
+
+    return pic_int_value(pic, op == '&' ? i & j : op == '|' ? i | j : i ^ j);
+  }
+
+  int_view(pic, a, &x);
+  int_view(pic, b, &y);
+  n = (x.n > y.n ? x.n : y.n) + 1;
+  d = mag_alloc(pic, n);
+  e = mag_alloc(pic, n);
+  int_twos(pic, a, d, n);
+  int_twos(pic, b, e, n);
+  for (i = 0; i < n; ++i) {
+    d[i] = op == '&' ? d[i] & e[i] : op == '|' ? d[i] | e[i] : d[i] ^ e[i];
+  }
+  pic_free(pic, e);
+
+  if ((neg = (d[n - 1] >> (BIGIT_BITS - 1)) != 0)) {
+    mag_negate(d, n);
+  }
+  return int_value(pic, neg, d, n);
+}
+
+/* the number of bits other than sign bits */
+static int
+int_bit_length(pic_state *pic, pic_value v)
+{
+  struct intview x;
+  int n, i;
+
+  int_view(pic, v, &x);
+  n = int_length(pic, v);
+  if (x.neg) {
+    /* -2^k is k bits long, any other negative n is as long as |n| */
+    for (i = 0; i < x.n - 1 && x.d[i] == 0; ++i)
+      ;
+    if (i == x.n - 1 && (x.d[i] & (x.d[i] - 1)) == 0) {
+      n--;
+    }
+  }
+  return n;
+}
+
+/* the number of bits that differ from the sign */
+static int
+int_bit_count(pic_state *pic, pic_value v)
+{
+  struct intview x;
+  bigit_t w;
+  int i, borrow, c = 0;
+
+  if (pic_int_p(pic, v)) {
+    long i = pic_int(pic, v);
+
+    return ulong_popcount((unsigned long) (i < 0 ? ~i : i));
+  }
+
+  /* ~n = |n| - 1 for negative n */
+  int_view(pic, v, &x);
+  for (i = 0, borrow = x.neg; i < x.n; ++i) {
+    w = (bigit_t) (x.d[i] - borrow);
+    borrow = borrow && x.d[i] == 0;
+    c += ulong_popcount(w);
+  }
+  return c;
+}
+
+static bool
+int_bit_set_p(pic_state *pic, pic_value v, int k)
+{
+  struct intview x;
+  bigit_t w;
+  int q = k / BIGIT_BITS, i;
+
+  int_view(pic, v, &x);
+  if (q >= x.n) {
+    return x.neg;
+  }
+  w = x.d[q];
+  if (x.neg) {
+    for (i = 0; i < q && x.d[i] == 0; ++i)
+      ;
+    w = (bigit_t) ~(bigit_t) (w - (i == q));
+  }
+  return (w >> k % BIGIT_BITS & 1) != 0;
+}
+
+#define DEFINE_BITOP(name, op, unit)                    \
+  static pic_value                                      \
+  name(pic_state *pic)                                  \
+  {                                                     \
+    pic_value *argv, r = pic_int_value(pic, unit);      \
+    int argc, i;                                        \
+                                                        \
+    pic_get_args(pic, "*", &argc, &argv);               \
+                                                        \
+    for (i = 0; i < argc; ++i) {                        \
+      r = int_bitop(pic, op, r, bit_arg(pic, argv[i])); \
+    }                                                   \
+    return r;                                           \
+  }
+
+DEFINE_BITOP(pic_number_bitwise_and, '&', -1)
+DEFINE_BITOP(pic_number_bitwise_ior, '|', 0)
+DEFINE_BITOP(pic_number_bitwise_xor, '^', 0)
+
 static pic_value
-pic_number_number_p(pic_state *pic)
+pic_number_bitwise_not(pic_state *pic)
 {
-  pic_value v;
+  pic_value n;
 
-  pic_get_args(pic, "o", &v);
+  pic_get_args(pic, "o", &n);
 
-  return pic_bool_value(pic, pic_float_p(pic, v) || pic_int_p(pic, v));
+  return pic_sub(pic, pic_int_value(pic, -1), bit_arg(pic, n));
 }
 
 static pic_value
-pic_number_exact_p(pic_state *pic)
+pic_number_arithmetic_shift(pic_state *pic)
 {
-  pic_value v;
+  pic_value n;
+  int k;
 
-  pic_get_args(pic, "o", &v);
+  pic_get_args(pic, "oi", &n, &k);
+
+  bit_arg(pic, n);
 
-  return pic_bool_value(pic, pic_int_p(pic, v));
+  if (pic_int_p(pic, n)) {
+    long i = pic_int(pic, n), m;
+
+    if (k <= 0) {
+      k = k > -LONG_SHIFT_MAX ? -k : LONG_SHIFT_MAX;
+      return pic_int_value(pic, i < 0 ? ~(~i >> k) : i >> k);
+    }
+    if (k < LONG_SHIFT_MAX && -(m = PIC_INT_MAX >> k) <= i && i <= m) {
+      return pic_int_value(pic, i * (1L << k));
+    }
+  }
+  return int_shift(pic, n, k);
 }
 
 static pic_value
-pic_number_inexact_p(pic_state *pic)
+pic_number_bit_count(pic_state *pic)
 {
-  pic_value v;
+  pic_value n;
 
-  pic_get_args(pic, "o", &v);
+  pic_get_args(pic, "o", &n);
 
-  return pic_bool_value(pic, pic_float_p(pic, v));
+  return pic_int_value(pic, int_bit_count(pic, bit_arg(pic, n)));
 }
 
 static pic_value
-pic_number_inexact(pic_state *pic)
+pic_number_integer_length(pic_state *pic)
 {
-  double f;
+  pic_value n;
 
-  pic_get_args(pic, "f", &f);
+  pic_get_args(pic, "o", &n);
 
-  return pic_float_value(pic, f);
+  return pic_int_value(pic, int_bit_length(pic, bit_arg(pic, n)));
 }
 
 static pic_value
-pic_number_exact(pic_state *pic)
+pic_number_first_set_bit(pic_state *pic)
 {
-  double f;
+  struct intview x;
+  pic_value n;
+  int i;
 
-  pic_get_args(pic, "f", &f);
+  pic_get_args(pic, "o", &n);
 
-  return pic_int_value(pic, (int)f);
+  int_view(pic, bit_arg(pic, n), &x);
+  if (x.n == 0) {
+    return pic_int_value(pic, -1);
+  }
+  for (i = 0; x.d[i] == 0; ++i)
+    ;
+  return pic_int_value(pic, i * BIGIT_BITS + ulong_ctz(x.d[i]));
 }
 
-#define pic_define_aop(name, op, guard)                                 \
-  pic_value                                                             \
-  name(pic_state *pic, pic_value a, pic_value b)                        \
-  {                                                                     \
-    double f;                                                           \
-    if (pic_int_p(pic, a) && pic_int_p(pic, b)) {                       \
-      f = (double)pic_int(pic, a) op (double)pic_int(pic, b);           \
-      return (INT_MIN <= f && f <= INT_MAX && guard)                    \
-        ? pic_int_value(pic, (int)f)                                    \
-        : pic_float_value(pic, f);                                      \
-    } else if (pic_float_p(pic, a) && pic_float_p(pic, b)) {            \
-      return pic_float_value(pic, pic_float(pic, a) op pic_float(pic, b)); \
-    } else if (pic_int_p(pic, a) && pic_float_p(pic, b)) {              \
-      return pic_float_value(pic, pic_int(pic, a) op pic_float(pic, b)); \
-    } else if (pic_float_p(pic, a) && pic_int_p(pic, b)) {              \
-      return pic_float_value(pic, pic_float(pic, a) op pic_int(pic, b)); \
-    } else {                                                            \
-      pic_error(pic, #name ": non-number operand given", 2, a, b);      \
-    }                                                                   \
-    PIC_UNREACHABLE();                                                  \
+static pic_value
+pic_number_bit_set_p(pic_state *pic)
+{
+  pic_value n;
+  int k;
+
+  pic_get_args(pic, "io", &k, &n);
+
+  if (k < 0) {
+    pic_error(pic, "bit-set?: negative index given", 1, pic_int_value(pic, k));
   }
+  return pic_bool_value(pic, int_bit_set_p(pic, bit_arg(pic, n), k));
+}
 
-pic_define_aop(pic_add, +, true)
-pic_define_aop(pic_sub, -, true)
-pic_define_aop(pic_mul, *, true)
-pic_define_aop(pic_div, /, f == (int)f)
+static pic_value
+pic_number_bit_field(pic_state *pic)
+{
+  pic_value n, mask;
+  int start, end;
 
-#define pic_define_cmp(name, op)                                        \
-  bool                                                                  \
-  name(pic_state *pic, pic_value a, pic_value b)                        \
-  {                                                                     \
-    if (pic_int_p(pic, a) && pic_int_p(pic, b)) {                       \
-      return pic_int(pic, a) op pic_int(pic, b);                        \
-    } else if (pic_float_p(pic, a) && pic_float_p(pic, b)) {            \
-      return pic_float(pic, a) op pic_float(pic, b);                    \
-    } else if (pic_int_p(pic, a) && pic_float_p(pic, b)) {              \
-      return pic_int(pic, a) op pic_float(pic, b);                      \
-    } else if (pic_float_p(pic, a) && pic_int_p(pic, b)) {              \
-      return pic_float(pic, a) op pic_int(pic, b);                      \
-    } else {                                                            \
-      pic_error(pic, #name ": non-number operand given", 2, a, b);      \
-    }                                                                   \
-    PIC_UNREACHABLE();                                                  \
+  pic_get_args(pic, "oii", &n, &start, &end);
+
+  bit_arg(pic, n);
+
+  if (start < 0 || end < start) {
+    pic_error(pic, "bit-field: invalid range", 2, pic_int_value(pic, start), pic_int_value(pic, end));
   }
+  if (pic_int_p(pic, n) && end - start < LONG_SHIFT_MAX && (1L << (end - start)) - 1 <= PIC_INT_MAX) {
+    long i = pic_int(pic, n);
+    int k = start < LONG_SHIFT_MAX ? start : LONG_SHIFT_MAX;
 
-pic_define_cmp(pic_eq, ==)
-pic_define_cmp(pic_lt, <)
-pic_define_cmp(pic_le, <=)
-pic_define_cmp(pic_gt, >)
-pic_define_cmp(pic_ge, >=)
+    i = i < 0 ? ~(~i >> k) : i >> k;
+    return pic_int_value(pic, i & ((1L << (end - start)) - 1));
+  }
+  mask = pic_sub(pic, int_shift(pic, pic_int_value(pic, 1), end - start), pic_int_value(pic, 1));
+  return int_bitop(pic, '&', int_shift(pic, n, -start), mask);
+}
 
-#define DEFINE_CMP(op)                                  \
-  static pic_value                                      \
-  pic_number_##op(pic_state *pic)                       \
-  {                                                     \
-    int argc, i;                                        \
-    pic_value *argv;                                    \
-                                                        \
-    pic_get_args(pic, "*", &argc, &argv);               \
-                                                        \
-    if (argc < 2) {                                     \
-      return pic_true_value(pic);                          \
-    }                                                   \
-                                                        \
-    for (i = 1; i < argc; ++i) {                        \
-      if (! pic_##op(pic, argv[i - 1], argv[i])) {      \
-        return pic_false_value(pic);                       \
-      }                                                 \
-    }                                                   \
-    return pic_true_value(pic);                            \
+/*
+ * Radix conversion
+ *
+ * Short magnitudes are converted a bigit's worth of characters at a time.
+ * Longer ones are split in two around a power radix^(width 2^i), taken
+ * from a table built by repeated squaring, and each half is converted
+ * recursively. Parsing combines the halves with mag_mul. Printing divides
+ * by the power with Barrett reduction, using a reciprocal computed once
+ * per power by Newton's iteration, so both directions run in
+ * O(M(n) log n).
+ */
+
+static const char digit_chars[] = "0123456789abcdefghijklmnopqrstuvwxyz";
+
+struct radix {
+  int radix;
+  int width;                    /* characters per bigit */
+  bigit_t unit;                 /* radix^width */
+  int npows;
+  bigit_t *pow[sizeof(int) * CHAR_BIT]; /* pow[i] = unit^(2^i) */
+  int pown[sizeof(int) * CHAR_BIT];
+  bigit_t *norm[sizeof(int) * CHAR_BIT]; /* pow[i] shifted until its top bit is set */
+  bigit_t *inv[sizeof(int) * CHAR_BIT]; /* floor(B^(2 pown[i]) / norm[i]), NULL until needed */
+  int shift[sizeof(int) * CHAR_BIT];
+};
+
+static void
+radix_init(struct radix *rx, int radix)
+{
+  bigit2_t u = radix;
+
+  rx->radix = radix;
+  rx->width = 1;
+  while (u * radix <= BIGIT_MAX) {
+    u *= radix;
+    rx->width++;
   }
+  rx->unit = (bigit_t) u;
+  rx->npows = 0;
+}
 
-DEFINE_CMP(eq)
-DEFINE_CMP(lt)
-DEFINE_CMP(le)
-DEFINE_CMP(gt)
-DEFINE_CMP(ge)
+static void
+radix_destroy(pic_state *pic, struct radix *rx)
+{
+  int i;
 
-#define DEFINE_AOP(op, v1, c0)                  \
-  static pic_value                              \
-  pic_number_##op(pic_state *pic)               \
-  {                                             \
-    int argc, i;                                \
-    pic_value *argv, tmp;                       \
-                                                \
-    pic_get_args(pic, "*", &argc, &argv);       \
-                                                \
-    if (argc == 0) {                            \
-      c0;                                       \
-    }                                           \
-    else if (argc == 1) {                       \
-      return v1;                                \
-    }                                           \
-                                                \
-    tmp = argv[0];                              \
-    for (i = 1; i < argc; ++i) {                \
-      tmp = pic_##op(pic, tmp, argv[i]);        \
-    }                                           \
-    return tmp;                                 \
+  for (i = 0; i < rx->npows; ++i) {
+    pic_free(pic, rx->pow[i]);
+    if (rx->inv[i] != NULL) {
+      pic_free(pic, rx->norm[i]);
+      pic_free(pic, rx->inv[i]);
+    }
   }
+}
 
-DEFINE_AOP(add, argv[0], do {
-    return pic_int_value(pic, 0);
-  } while (0))
-DEFINE_AOP(mul, argv[0], do {
-    return pic_int_value(pic, 1);
-  } while (0))
-DEFINE_AOP(sub, pic_sub(pic, pic_int_value(pic, 0), argv[0]), do {
-    pic_error(pic, "-: at least one argument required", 0);
-  } while (0))
-DEFINE_AOP(div, pic_div(pic, pic_int_value(pic, 1), argv[0]), do {
-    pic_error(pic, "/: at least one argument required", 0);
-  } while (0))
+static const bigit_t *
+radix_pow(pic_state *pic, struct radix *rx, int i, int *n)
+{
+  bigit_t *d;
+  int k, m;
+
+  while (rx->npows <= i) {
+    k = rx->npows;
+    if (k == 0) {
+      d = mag_alloc(pic, 1);
+      d[0] = rx->unit;
+      m = 1;
+    } else {
+      m = rx->pown[k - 1];
+      d = mag_alloc(pic, 2 * m);
+      mag_mul(pic, d, rx->pow[k - 1], m, rx->pow[k - 1], m);
+      m = mag_trim(d, 2 * m);
+    }
+    rx->pow[k] = d;
+    rx->pown[k] = m;
+    rx->inv[k] = NULL;
+    rx->npows++;
+  }
+  *n = rx->pown[i];
+  return rx->pow[i];
+}
+
+/*
+ * v = floor(B^2n / p) for p of n digits with its top bit set, where v has
+ * n + 2 digits. The reciprocal of the top half of p is refined by one
+ * Newton step, x' = x + x (B^2n - p x) / B^2n, which doubles its
+ * precision, and the few units left over are corrected one at a time.
+ */
+static void
+mag_recip(pic_state *pic, bigit_t *v, const bigit_t *p, int n)
+{
+  bigit_t *w, *t, *e, *xe, one = 1;
+  int l, h, tn, en, xn, wn = 2 * n + 1;
+  bool neg;
+
+  /* w = B^2n */
+  w = mag_alloc(pic, wn);
+  memset(w, 0, sizeof(bigit_t) * (wn - 1));
+  w[wn - 1] = 1;
+
+  if (n < KARATSUBA_CUTOFF) {
+    t = mag_alloc(pic, n);
+    mag_divmod(pic, v, t, w, wn, p, n);
+    pic_free(pic, t);
+    pic_free(pic, w);
+    return;
+  }
+
+  l = n / 2;
+  h = n - l;
+  memset(v, 0, sizeof(bigit_t) * l);
+  mag_recip(pic, v + l, p + l, h);
+
+  t = mag_alloc(pic, 2 * n + 3);
+  e = mag_alloc(pic, 2 * n + 3);
+
+  /* e = |B^2n - p v| */
+  memset(t, 0, sizeof(bigit_t) * l);
+  mag_mul(pic, t + l, p, n, v + l, h + 2);
+  tn = mag_trim(t, 2 * n + 2);
+  if ((neg = mag_cmp(t, tn, w, wn) > 0)) {
+    mag_sub(e, t, tn, w, wn);
+    en = mag_trim(e, tn);
+  } else {
+    mag_sub(e, w, wn, t, tn);
+    en = mag_trim(e, wn);
+  }
+
+  /* v = v -+ v e / B^2n */
+  if (en > 0) {
+    xe = mag_alloc(pic, n + 2 + en);
+    mag_mul(pic, xe, v, n + 2, e, en);
+    if ((xn = mag_trim(xe, n + 2 + en) - 2 * n) > 0) {
+      if (neg) {
+        mag_sub(v, v, n + 2, xe + 2 * n, xn);
+      } else {
+        mag_add(v, v, n + 2, xe + 2 * n, xn);
+      }
+    }
+    pic_free(pic, xe);
+  }
+
+  /* then step to the exact value, 0 <= B^2n - p v < p */
+  mag_mul(pic, t, p, n, v, n + 2);
+  tn = mag_trim(t, 2 * n + 2);
+  while (mag_cmp(t, tn, w, wn) > 0) {
+    mag_sub(v, v, n + 2, &one, 1);
+    mag_sub(t, t, tn, p, n);
+    tn = mag_trim(t, tn);
+  }
+  for (;;) {
+    e[tn] = mag_add(e, t, tn, p, n);
+    en = mag_trim(e, tn + 1);
+    if (mag_cmp(e, en, w, wn) > 0)
+      break;
+    mag_add(v, v, n + 2, &one, 1);
+    memcpy(t, e, sizeof(bigit_t) * en);
+    tn = en;
+  }
+
+  pic_free(pic, t);
+  pic_free(pic, e);
+  pic_free(pic, w);
+}
+
+/*
+ * q = a / p and r = a % p for a of 2n digits less than p B^n, where p has
+ * n digits with its top bit set and v = floor(B^2n / p). q has n digits
+ * and r has n. Barrett's estimate floor(floor(a / B^(n-1)) v / B^(n+1))
+ * falls short of q by at most two.
+ */
+static void
+mag_divmod_recip(pic_state *pic, bigit_t *q, bigit_t *r, const bigit_t *a, const bigit_t *p, const bigit_t *v, int n)
+{
+  bigit_t *t, *u, one = 1;
+  int tn, un;
+
+  t = mag_alloc(pic, 2 * n + 3);
+  u = mag_alloc(pic, 2 * n + 1);
+
+  mag_mul(pic, t, a + n - 1, n + 1, v, n + 2);
+  memcpy(q, t + n + 1, sizeof(bigit_t) * n);
+
+  /* u = a - q p, which is below 3 p */
+  mag_mul(pic, t, q, n, p, n);
+  tn = mag_trim(t, 2 * n);
+  mag_sub(u, a, 2 * n, t, tn);
+  un = mag_trim(u, 2 * n);
+  while (mag_cmp(u, un, p, n) >= 0) {
+    mag_sub(u, u, un, p, n);
+    un = mag_trim(u, un);
+    mag_add(q, q, n, &one, 1);
+  }
+  memset(r, 0, sizeof(bigit_t) * n);
+  memcpy(r, u, sizeof(bigit_t) * un);
+
+  pic_free(pic, t);
+  pic_free(pic, u);
+}
+
+/*
+ * q = a / pow[i] and r = a % pow[i], where q has an - pown[i] + 1 digits
+ * and r has pown[i]. a is divided pown[i] digits at a time from the top,
+ * each step a Barrett division by the normalized power.
+ */
+static void
+radix_divmod(pic_state *pic, struct radix *rx, int i, bigit_t *q, bigit_t *r, const bigit_t *a, int an)
+{
+  const bigit_t *pw;
+  bigit_t *u, *qq, *cur, *rem;
+  int pn, s, k, j;
+
+  pw = radix_pow(pic, rx, i, &pn);
+
+  if (pn < KARATSUBA_CUTOFF) {
+    mag_divmod(pic, q, r, a, an, pw, pn);
+    return;
+  }
+
+  if (rx->inv[i] == NULL) {
+    bigit2_t top;
+
+    for (s = 0, top = pw[pn - 1]; top <= BIGIT_MAX >> 1; top <<= 1) {
+      s++;
+    }
+    rx->norm[i] = mag_alloc(pic, pn);
+    mag_shl(rx->norm[i], pw, pn, s);
+    rx->shift[i] = s;
+    rx->inv[i] = mag_alloc(pic, pn + 2);
+    mag_recip(pic, rx->inv[i], rx->norm[i], pn);
+  }
+  s = rx->shift[i];
+
+  /* u = a << s, padded to whole blocks of pn digits */
+  k = an / pn + 1;
+  u = mag_alloc(pic, k * pn);
+  memset(u, 0, sizeof(bigit_t) * k * pn);
+  u[an] = mag_shl(u, a, an, s);
+
+  qq = mag_alloc(pic, k * pn);
+  cur = mag_alloc(pic, 2 * pn);
+  rem = cur + pn;
+  memset(rem, 0, sizeof(bigit_t) * pn);
+  for (j = k - 1; j >= 0; --j) {
+    memcpy(cur, u + j * pn, sizeof(bigit_t) * pn);
+    mag_divmod_recip(pic, qq + j * pn, rem, cur, rx->norm[i], rx->inv[i], pn);
+  }
+  mag_shr(r, rem, pn, s);
+  memcpy(q, qq, sizeof(bigit_t) * (an - pn + 1));
+
+  pic_free(pic, u);
+  pic_free(pic, qq);
+  pic_free(pic, cur);
+}
+
+/*
+ * Writes the digits of d, which is clobbered, so that they end just
+ * before end, zero-padded to at least width characters. Returns where
+ * they start.
+ */
+static char *
+mag_to_str(pic_state *pic, struct radix *rx, bigit_t *d, int n, char *end, int width)
+{
+  bigit_t *q, *r;
+  char *p = end;
+  int level, pn, i;
+
+  n = mag_trim(d, n);
+
+  if (n < RADIX_CUTOFF) {
+    while (n > 0) {
+      bigit_t c = mag_divmod1(d, d, n, rx->unit);
+
+      n = mag_trim(d, n);
+      for (i = 0; i < rx->width && (n > 0 || c != 0); ++i) {
+        *--p = digit_chars[c % rx->radix];
+        c /= rx->radix;
+      }
+    }
+    while (end - p < width) {
+      *--p = '0';
+    }
+    return p;
+  }
+
+  /* the largest power in the table no longer than half of d */
+  for (level = 0; radix_pow(pic, rx, level + 1, &pn), 2 * pn <= n + 1; ++level)
+    ;
+  radix_pow(pic, rx, level, &pn);
+
+  q = mag_alloc(pic, n - pn + 1);
+  r = mag_alloc(pic, pn);
+  radix_divmod(pic, rx, level, q, r, d, n);
+  p = mag_to_str(pic, rx, r, pn, end, rx->width << level);
+  p = mag_to_str(pic, rx, q, n - pn + 1, p, width - (rx->width << level));
+  pic_free(pic, q);
+  pic_free(pic, r);
+  return p;
+}
+
+/* the magnitude spelled by len valid digits at str */
+static bigit_t *
+mag_from_str(pic_state *pic, struct radix *rx, const char *str, int len, int *n)
+{
+  const bigit_t *pw;
+  bigit_t *d, *hi, *lo, c, m;
+  int level, hn, ln, pn, i, j, k;
+
+  if (len <= rx->width * RADIX_CUTOFF) {
+    d = mag_alloc(pic, len / rx->width + 1);
+    *n = 0;
+    for (i = 0; i < len; i += k) {
+      k = i == 0 ? (len - 1) % rx->width + 1 : rx->width;
+      for (c = 0, m = 1, j = 0; j < k; ++j) {
+        c = c * rx->radix + (strchr(digit_chars, tolower(str[i + j])) - digit_chars);
+        m *= rx->radix;
+      }
+      if ((c = mag_muladd1(d, *n, m, c)) != 0) {
+        d[(*n)++] = c;
+      }
+    }
+    return d;
+  }
+
+  /* the low part takes the largest power in the table shorter than str */
+  for (level = 0; (rx->width << (level + 1)) < len; ++level)
+    ;
+  k = rx->width << level;
+
+  hi = mag_from_str(pic, rx, str, len - k, &hn);
+  lo = mag_from_str(pic, rx, str + len - k, k, &ln);
+  pw = radix_pow(pic, rx, level, &pn);
+
+  d = mag_alloc(pic, hn + pn + 1);
+  mag_mul(pic, d, hi, hn, pw, pn);
+  d[hn + pn] = 0;
+  mag_add(d, d, hn + pn + 1, lo, ln);
+  *n = mag_trim(d, hn + pn + 1);
+
+  pic_free(pic, hi);
+  pic_free(pic, lo);
+  return d;
+}
+
+static pic_value
+int_to_str(pic_state *pic, pic_value v, int radix)
+{
+  struct intview x;
+  struct radix rx;
+  bigit_t *d;
+  char *buf, *p;
+  int size;
+  pic_value str;
+
+  int_view(pic, v, &x);
+
+  size = x.n * BIGIT_BITS + 2;
+  buf = pic_malloc(pic, size);
+  d = mag_alloc(pic, x.n);
+  memcpy(d, x.d, sizeof(bigit_t) * x.n);
+
+  radix_init(&rx, radix);
+  p = mag_to_str(pic, &rx, d, x.n, buf + size, 1);
+  if (x.neg) {
+    *--p = '-';
+  }
+  radix_destroy(pic, &rx);
+  pic_free(pic, d);
+
+  str = pic_str_value(pic, p, buf + size - p);
+  pic_free(pic, buf);
+  return str;
+}
+
+/* an exact integer literal of any length, or #f */
+static pic_value
+str_to_int(pic_state *pic, const char *str, int radix)
+{
+  struct radix rx;
+  const char *c;
+  bigit_t *d;
+  bool neg = false;
+  int n;
+
+  if (*str == '+' || *str == '-') {
+    neg = *str++ == '-';
+  }
+  for (c = str; *c != '\0'; ++c) {
+    const char *p = strchr(digit_chars, tolower(*c));
+    if (p == NULL || p - digit_chars >= radix)
+      return pic_false_value(pic);
+  }
+  if (c == str) {
+    return pic_false_value(pic);
+  }
+
+  radix_init(&rx, radix);
+  d = mag_from_str(pic, &rx, str, c - str, &n);
+  radix_destroy(pic, &rx);
+  return int_value(pic, neg, d, n);
+}
 
 static int
 int2str(long x, int base, char *buf)
 {
   static const char digits[36] = "0123456789abcdefghijklmnopqrstuvwxyz";
+  unsigned long u;
   int i, neg, len;
 
-  neg = 0;
-  if (x < 0) {
-    neg = 1;
-    x = -x;
-  }
+  neg = x < 0;
+  u = neg ? 0ul - (unsigned long) x : (unsigned long) x;
 
   i = 0;
   do {
-    buf[i++] = digits[x % base];
-  } while ((x /= base) != 0);
+    buf[i++] = digits[u % base];
+  } while ((u /= base) != 0);
 
   if (neg) {
     buf[i++] = '-';
@@ -204,26 +1857,32 @@ int2str(long x, int base, char *buf)
 static pic_value
 pic_number_number_to_string(pic_state *pic)
 {
-  double f;
-  bool e;
+  pic_value n;
   int radix = 10;
 
-  pic_get_args(pic, "F|i", &f, &e, &radix);
+  pic_get_args(pic, "o|i", &n, &radix);
 
   if (radix < 2 || radix > 36) {
     pic_error(pic, "invalid radix (between 2 and 36, inclusive)", 1, pic_int_value(pic, radix));
   }
 
-  if (e) {
-    char buf[sizeof(int) * CHAR_BIT + 3];
-    int len = int2str((int) f, radix, buf);
+  if (pic_int_p(pic, n)) {
+    char buf[sizeof(long) * CHAR_BIT + 3];
+    int len = int2str(pic_int(pic, n), radix, buf);
     return pic_str_value(pic, buf, len);
   }
-  else {
+  else if (pic_big_p(pic, n)) {
+    return int_to_str(pic, n, radix);
+  }
+  else if (pic_float_p(pic, n)) {
     char buf[64];
-    pic_dtoa(f, buf);
+    pic_dtoa(pic_float(pic, n), buf);
     return pic_cstr_value(pic, buf);
   }
+  else {
+    pic_error(pic, "number->string: number required", 1, n);
+  }
+  PIC_UNREACHABLE();
 }
 
 static bool
@@ -275,8 +1934,8 @@ string_to_number(pic_state *pic, const char *str)
 
   flt = pic_atod(str);
 
-  if (isint && INT_MIN <= flt && flt <= INT_MAX) {
-    return pic_int_value(pic, flt);
+  if (isint && FLOAT_FIXNUM_P(flt)) {
+    return pic_int_value(pic, (long) flt);
   } else {
     return pic_float_value(pic, flt);
   }
@@ -289,9 +1948,14 @@ pic_number_string_to_number(pic_state *pic)
   int radix = 10;
   long num;
   char *eptr;
+  pic_value n;
 
   pic_get_args(pic, "z|i", &str, &radix);
 
+  if (radix < 2 || radix > 36) {
+    pic_error(pic, "invalid radix (between 2 and 36, inclusive)", 1, pic_int_value(pic, radix));
+  }
+
   if (strcaseeq(str, "+inf.0"))
     return pic_float_value(pic, 1.0 / 0.0);
   if (strcaseeq(str, "-inf.0"))
@@ -302,8 +1966,11 @@ pic_number_string_to_number(pic_state *pic)
     return pic_float_value(pic, -0.0 / 0.0);
 
   num = strtol(str, &eptr, radix);
-  if (*eptr == '\0') {
-    return INT_MIN <= num && num <= INT_MAX ? pic_int_value(pic, num) : pic_float_value(pic, num);
+  if (*eptr == '\0' && FIXNUM_P(num) && num != LONG_MIN && num != LONG_MAX) { /* which strtol also returns on overflow */
+    return pic_int_value(pic, num);
+  }
+  if (! pic_false_p(pic, n = str_to_int(pic, str, radix))) {
+    return n;
   }
 
   return string_to_number(pic, str);
@@ -326,6 +1993,26 @@ pic_init_number(pic_state *pic)
   pic_defun(pic, "-", pic_number_sub);
   pic_defun(pic, "*", pic_number_mul);
   pic_defun(pic, "/", pic_number_div);
+  pic_defun(pic, "exact-integer?", pic_number_exact_integer_p);
+  pic_defun(pic, "floor/", pic_number_floor2);
+  pic_defun(pic, "floor-quotient", pic_number_floor_quotient);
+  pic_defun(pic, "floor-remainder", pic_number_floor_remainder);
+  pic_defun(pic, "truncate/", pic_number_truncate2);
+  pic_defun(pic, "truncate-quotient", pic_number_truncate_quotient);
+  pic_defun(pic, "truncate-remainder", pic_number_truncate_remainder);
+  pic_defun(pic, "gcd", pic_number_gcd);
+  pic_defun(pic, "lcm", pic_number_lcm);
+  pic_defun(pic, "exact-integer-sqrt", pic_number_exact_integer_sqrt);
+  pic_defun(pic, "bitwise-and", pic_number_bitwise_and);
+  pic_defun(pic, "bitwise-ior", pic_number_bitwise_ior);
+  pic_defun(pic, "bitwise-xor", pic_number_bitwise_xor);
+  pic_defun(pic, "bitwise-not", pic_number_bitwise_not);
+  pic_defun(pic, "arithmetic-shift", pic_number_arithmetic_shift);
+  pic_defun(pic, "bit-count", pic_number_bit_count);
+  pic_defun(pic, "integer-length", pic_number_integer_length);
+  pic_defun(pic, "first-set-bit", pic_number_first_set_bit);
+  pic_defun(pic, "bit-set?", pic_number_bit_set_p);
+  pic_defun(pic, "bit-field", pic_number_bit_field);
   pic_defun(pic, "number->string", pic_number_number_to_string);
   pic_defun(pic, "string->number", pic_number_string_to_number);
 }
@@ -26,11 +26,30 @@ struct blob {
   OBJECT_HEADER
   unsigned char *data;
   int len;
+  struct blob_buffer *buf;      /* if non-NULL, data lies in a buffer shared with others */
+  bool view;                    /* made by pic_blob_slice; its bytes are counted with the original */
+};
+
+/* memory shared by slices, input ports and foreign owners, freed with the last reference */
+struct blob_buffer {
+  int refs;
+  unsigned char *mem;
+  void (*dtor)(pic_state *, void *ptr, void *userdata); /* if NULL, mem is pic_free'd */
+  void *userdata;
+};
+
+/* a homogeneous numeric vector other than a bytevector, unboxed in native byte order */
+struct uvector {
+  OBJECT_HEADER
+  unsigned char kind;           /* PIC_UVEC_S8, ... */
+  int len;                      /* in elements */
+  unsigned char *data;
 };
 
 #define ROPE_HEADER                             \
   OBJECT_HEADER                                 \
-  int len;
+  int len;                      /* in bytes */  \
+  int nchars;
 
 struct rope {
   ROPE_HEADER
@@ -38,11 +57,15 @@ struct rope {
 
 struct rope_leaf {
   ROPE_HEADER
+  bool owned;                   /* only one string refers to this leaf, and may write to it */
   const char *str;
+  struct rope_leaf *base;       /* if non-NULL, str points into base's buffer */
+  int *crumbs;                  /* byte offsets of every ROPE_CRUMB-th char, built on demand */
 };
 
 struct rope_node {
   ROPE_HEADER
+  int depth;
   struct rope *s1;
   struct rope *s2;
 };
@@ -50,6 +73,29 @@ struct rope_node {
 struct string {
   OBJECT_HEADER
   struct rope *rope;
+  int hash;                     /* 0 until pic_str_hash computes it */
+};
+
+/*
+ * Exact integers outside the fixnum range. The magnitude is stored
+ * little-endian in base 2^BIGIT_BITS with no leading zero digits, and a
+ * bignum is never created for a value that fits in a fixnum.
+ */
+
+#if ULONG_MAX > 0xfffffffful
+typedef unsigned int bigit_t;
+# define BIGIT_BITS 32
+#else
+typedef unsigned short bigit_t;
+# define BIGIT_BITS 16
+#endif
+typedef unsigned long bigit2_t; /* holds the product of two bigits */
+
+struct bignum {
+  OBJECT_HEADER
+  bool neg;
+  int len;
+  bigit_t *digits;
 };
 
 struct symbol {
@@ -69,6 +115,13 @@ struct vector {
   int len;
 };
 
+/* a ring buffer: element i is data[(head + i) & (cap - 1)], cap being 0 or a power of two */
+struct array {
+  OBJECT_HEADER
+  pic_value *data;
+  int len, cap, head;
+};
+
 KHASH_DECLARE(dict, struct symbol *, pic_value)
 
 struct dict {
@@ -90,10 +143,45 @@ struct data {
   void *data;
 };
 
+struct record_type {
+  OBJECT_HEADER
+  pic_value name;
+  pic_value fields;             /* list of field names */
+  int nfields;
+};
+
 struct record {
   OBJECT_HEADER
-  struct symbol *type;
-  pic_value datum;
+  struct record_type *type;
+  pic_value fields[1];          /* type->nfields slots, allocated inline */
+};
+
+#define pic_record_size(n) (sizeof(struct record) + ((n) > 1 ? (n) - 1 : 0) * sizeof(pic_value))
+
+/*
+ * Open addressing with linear probing. Resizing is spread over
+ * insertions: next_slots is cleared a little at a time, then takes
+ * over, and old_slots is emptied into it a little at a time. Until
+ * old_slots is released a key may live in either array (never both).
+ */
+
+struct table_slot {
+  unsigned long hash;           /* 0 if the slot is empty, 1 if its entry was deleted */
+  pic_value key;
+  pic_value val;
+};
+
+struct table {
+  OBJECT_HEADER
+  unsigned char kind;           /* PIC_TABLE_EQ, ... */
+  bool immutable;
+  int size;                     /* live entries in both arrays */
+  int cap, used;                /* used counts live and deleted slots */
+  struct table_slot *slots;
+  int old_cap, moved;           /* old_slots[0..moved) are already moved */
+  struct table_slot *old_slots;
+  int next_cap, cleared;        /* next_slots[0..cleared) are cleared */
+  struct table_slot *next_slots;
 };
 
 enum {
@@ -110,9 +198,14 @@ enum {
   OP_LOADF = 0x0A,        /* 0x0A 0x**            OP_LOADF dest     */
   OP_LOADN = 0x0B,        /* 0x0B 0x**            OP_LOADN dest     */
   OP_LOADU = 0x0C,        /* 0x0C 0x**            OP_LOADU dest     */
-  OP_LOADI = 0x0D         /* 0x0D 0x** 0x**       OP_LOADI dest i   */
+  OP_LOADI = 0x0D,        /* 0x0D 0x** 0x**       OP_LOADI dest i   */
+  OP_RREF  = 0x0E,        /* 0x0E 0x** 0x**       OP_RREF rec i     */
+  OP_RSET  = 0x0F         /* 0x0F 0x** 0x**       OP_RSET rec i     */
 };
 
+/* OP_RREF and OP_RSET expect the record type in rec+1 (and the new value
+   in rec+2 for OP_RSET); the result overwrites rec. */
+
 typedef unsigned char code_t;
 
 #define IREP_VARG 1
@@ -153,6 +246,8 @@ struct proc {
 #define TYPENAME_proc  "procedure"
 #define TYPENAME_str   "string"
 #define TYPENAME_vec   "vector"
+#define TYPENAME_array "array"
+#define TYPENAME_uvec  "numeric vector"
 
 #define TYPE_CHECK(pic, v, type) do {                           \
     if (! pic_##type##_p(pic, v))                               \
@@ -202,20 +297,45 @@ DEFPTR(attr, struct attr)
 DEFPTR(data, struct data)
 DEFPTR(proc, struct proc)
 DEFPTR(rec, struct record)
+DEFPTR(rectype, struct record_type)
+DEFPTR(table, struct table)
+DEFPTR(array, struct array)
+DEFPTR(uvec, struct uvector)
 DEFPTR(irep, struct irep)
+DEFPTR(big, struct bignum)
 #undef pic_data_p
 
 struct object *pic_obj_alloc(pic_state *, int type);
 struct object *pic_obj_alloc_unsafe(pic_state *, int type);
+struct object *pic_obj_alloc_var(pic_state *, int type, size_t size); /* for objects with inline trailing data */
+void pic_obj_charge(pic_state *, struct object *, size_t size); /* counts payload allocated apart from obj */
 
 struct frame *pic_make_frame_unsafe(pic_state *, int n);
 pic_value pic_make_proc_irep_unsafe(pic_state *, struct irep *, struct frame *);
-pic_value pic_make_record(pic_state *, pic_value type, pic_value datum);
+pic_value pic_make_record_type(pic_state *, pic_value name, pic_value fields);
+pic_value pic_make_record(pic_state *, pic_value type, const pic_value *fields); /* fields may be NULL */
 pic_value pic_record_type(pic_state *pic, pic_value record);
-pic_value pic_record_datum(pic_state *pic, pic_value record);
+struct record *pic_record_cast(pic_state *pic, pic_value record, pic_value type); /* raises unless record is of type */
 pic_value pic_make_cont(pic_state *pic, pic_value k);
-int pic_str_hash(pic_state *pic, pic_value str);
+pic_value pic_make_str(pic_state *pic, char *buf, int len); /* takes buf, which must have room for len + 1 chars */
+int pic_utf8_encode(int c, char *buf); /* stores at most 4 bytes and returns their number */
+int pic_utf8_decode(const char *str, int len, int *c); /* returns bytes consumed, > 0 if len > 0; malformed input gives U+FFFD */
+int pic_utf8_width(int lead); /* sequence length announced by a lead byte, 0 if it is not one */
+int pic_utf8_ascii_span(const char *str, int len); /* length of the leading run of ASCII bytes */
+int pic_str_hash(pic_state *pic, pic_value str); /* memoized until the string is written to */
+int pic_str_hash_buf(const char *str, int len); /* agrees with pic_str_hash on equal contents */
 int pic_str_cmp(pic_state *pic, pic_value str1, pic_value str2);
+pic_value pic_add(pic_state *pic, pic_value a, pic_value b); /* as +, raising on non-numbers */
+pic_value pic_mul(pic_state *pic, pic_value a, pic_value b); /* as * */
+bool pic_lt(pic_state *pic, pic_value a, pic_value b); /* as <, raising on non-numbers */
+double pic_big_float(pic_state *pic, pic_value big); /* nearest flonum, possibly infinite */
+int pic_big_bytes(pic_state *pic, pic_value big, unsigned char *buf); /* little-endian magnitude; buf may be NULL */
+pic_value pic_big_value(pic_state *pic, bool neg, const unsigned char *buf, int len); /* a fixnum if it fits */
+int pic_uvec_size(int kind); /* bytes per element of a numeric vector */
+struct blob_buffer *pic_blob_share(pic_state *pic, pic_value blob); /* a new reference to its memory */
+void pic_blob_release(pic_state *pic, struct blob_buffer *buf);
+pic_value pic_uvec_load(pic_state *pic, int kind, const unsigned char *data, int i); /* data aligned for the kind */
+void pic_uvec_store(pic_state *pic, int kind, unsigned char *data, int i, pic_value v); /* raises if v does not fit */
 
 void pic_warnf(pic_state *pic, const char *fmt, ...); /* deprecated */
 
@@ -5,6 +5,7 @@
 #include <picrin.h>
 #include "value.h"
 #include "object.h"
+#include "state.h"
 
 pic_value
 pic_cons(pic_state *pic, pic_value car, pic_value cdr)
@@ -463,62 +464,77 @@ pic_pair_list_copy(pic_state *pic)
   return head;
 }
 
+/* feeds map and for-each, appending results after tail unless it is #f */
+struct pair_each {
+  pic_value *lists, tail;
+  int n;
+  bool started;
+};
+
+static bool
+pair_each(pic_state *pic, void *data, pic_value result, pic_value *argv)
+{
+  struct pair_each *e = data;
+  pic_value cell;
+  int j;
+
+  if (e->started && ! pic_false_p(pic, e->tail)) {
+    cell = pic_cons(pic, result, pic_nil_value(pic));
+    pic_set_cdr(pic, e->tail, cell);
+    e->tail = cell;
+  }
+  for (j = 0; j < e->n; ++j) {
+    if (! pic_pair_p(pic, e->lists[j])) {
+      return false;
+    }
+  }
+  for (j = 0; j < e->n; ++j) {
+    argv[j] = pic_car(pic, e->lists[j]);
+    e->lists[j] = pic_cdr(pic, e->lists[j]);
+  }
+  e->started = true;
+  return true;
+}
+
 static pic_value
 pic_pair_map(pic_state *pic)
 {
-  int argc, i;
-  pic_value proc, *args, *arg_list, ret;
+  int argc;
+  pic_value proc, *args, head;
+  struct pair_each e;
 
   pic_get_args(pic, "l*", &proc, &argc, &args);
 
   if (argc == 0)
     pic_error(pic, "map: wrong number of arguments (1 for at least 2)", 0);
 
-  arg_list = pic_alloca(pic, sizeof(pic_value) * argc);
+  head = pic_cons(pic, pic_nil_value(pic), pic_nil_value(pic));
 
-  ret = pic_nil_value(pic);
-  do {
-    for (i = 0; i < argc; ++i) {
-      if (! pic_pair_p(pic, args[i])) {
-        break;
-      }
-      arg_list[i] = pic_car(pic, args[i]);
-      args[i] = pic_cdr(pic, args[i]);
-    }
-
-    if (i != argc) {
-      break;
-    }
-    pic_push(pic, pic_apply(pic, proc, i, arg_list), ret);
-  } while (1);
-
-  return pic_reverse(pic, ret);
+  e.lists = args;
+  e.n = argc;
+  e.tail = head;
+  e.started = false;
+  pic_call_each(pic, proc, argc, pair_each, &e);
+  return pic_cdr(pic, head);
 }
 
 static pic_value
 pic_pair_for_each(pic_state *pic)
 {
-  int argc, i;
-  pic_value proc, *args, *arg_list;
+  int argc;
+  pic_value proc, *args;
+  struct pair_each e;
 
   pic_get_args(pic, "l*", &proc, &argc, &args);
 
-  arg_list = pic_alloca(pic, sizeof(pic_value) * argc);
-
-  do {
-    for (i = 0; i < argc; ++i) {
-      if (! pic_pair_p(pic, args[i])) {
-        break;
-      }
-      arg_list[i] = pic_car(pic, args[i]);
-      args[i] = pic_cdr(pic, args[i]);
-    }
-    if (i != argc) {
-      break;
-    }
-    pic_apply(pic, proc, i, arg_list);
-  } while (1);
+  if (argc == 0)
+    pic_error(pic, "for-each: wrong number of arguments (1 for at least 2)", 0);
 
+  e.lists = args;
+  e.n = argc;
+  e.tail = pic_false_value(pic);
+  e.started = false;
+  pic_call_each(pic, proc, argc, pair_each, &e);
   return pic_undef_value(pic);
 }
 
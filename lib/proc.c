@@ -140,6 +140,16 @@ assemble(pic_state *pic, pic_value as)
       code[i++] = pic_int(pic, pic_list_ref(pic, r, 1));
       code[i++] = pic_int(pic, pic_list_ref(pic, r, 2));
     }
+    else if (pic_eq_p(pic, op, pic_intern_lit(pic, "RREF"))) {
+      code[i++] = OP_RREF;
+      code[i++] = pic_int(pic, pic_list_ref(pic, r, 1));
+      code[i++] = pic_int(pic, pic_list_ref(pic, r, 2));
+    }
+    else if (pic_eq_p(pic, op, pic_intern_lit(pic, "RSET"))) {
+      code[i++] = OP_RSET;
+      code[i++] = pic_int(pic, pic_list_ref(pic, r, 1));
+      code[i++] = pic_int(pic, pic_list_ref(pic, r, 2));
+    }
   }
 
   ir = (struct irep *)pic_obj_alloc(pic, PIC_TYPE_IREP);
@@ -167,6 +177,7 @@ pic_make_frame_unsafe(pic_state *pic, int n)
 
   fp = (struct frame *)pic_obj_alloc_unsafe(pic, PIC_TYPE_FRAME);
   fp->regs = n ? pic_malloc(pic, sizeof(pic_value) * n) : NULL;
+  pic_obj_charge(pic, (struct object *) fp, sizeof(pic_value) * n);
   fp->regc = n;
   fp->up = NULL;
   for (i = 0; i < n; ++i) {
@@ -228,6 +239,17 @@ arg_error(pic_state *pic, int actual, bool varg, int expected)
   pic_error(pic, msg, 0);
 }
 
+static int
+int_arg(pic_state *pic, pic_value v)
+{
+  long i = pic_int(pic, v);
+
+  if (i < INT_MIN || INT_MAX < i) {
+    pic_error(pic, "pic_get_args: integer out of range", 1, v);
+  }
+  return (int) i;
+}
+
 #define GET_ARGC(pic) (pic->cxt->pc[1])
 #define GET_PROC(pic) (pic->cxt->fp->regs[0])
 #define GET_CONT(pic) (pic->cxt->fp->regs[1])
@@ -366,7 +388,7 @@ pic_get_args(pic_state *pic, const char *format, ...)
       break;
     }
 
-#define NUM_CASE(c1, c2, ctype)                                         \
+#define NUM_CASE(c1, c2, ctype, fix, big)                               \
       case c1: case c2: {                                               \
         ctype *n;                                                       \
         bool *e, dummy;                                                 \
@@ -382,7 +404,11 @@ pic_get_args(pic_state *pic, const char *format, ...)
           *e = false;                                                   \
           break;                                                        \
         case PIC_TYPE_INT:                                              \
-          *n = pic_int(pic, v);                                         \
+          *n = fix;                                                     \
+          *e = true;                                                    \
+          break;                                                        \
+        case PIC_TYPE_BIGNUM:                                           \
+          *n = big;                                                     \
           *e = true;                                                    \
           break;                                                        \
         default:                                                        \
@@ -391,8 +417,8 @@ pic_get_args(pic_state *pic, const char *format, ...)
         break;                                                          \
       }
 
-    NUM_CASE('i', 'I', int)
-    NUM_CASE('f', 'F', double)
+    NUM_CASE('i', 'I', int, int_arg(pic, v), (pic_error(pic, "pic_get_args: integer out of range", 1, v), 0))
+    NUM_CASE('f', 'F', double, pic_int(pic, v), pic_big_float(pic, v))
 
 #define VAL_CASE(c, type, ctype, conv)                                  \
       case c: {                                                         \
@@ -410,7 +436,7 @@ pic_get_args(pic_state *pic, const char *format, ...)
         break;                                                          \
       }
 
-    VAL_CASE('c', char, char, pic_char(pic, v))
+    VAL_CASE('c', char, int, pic_char(pic, v))
     VAL_CASE('z', str, const char *, pic_cstr(pic, v, NULL))
 
 #define OBJ_CASE(c, type) VAL_CASE(c, type, pic_value, v)
@@ -499,6 +525,7 @@ pic_vcall(pic_state *pic, pic_value proc, int n, va_list ap)
   struct context cxt;
   CONTEXT_VINITK(pic, &cxt, proc, pic->halt, n, ap);
   cxt.reset = 0;
+  cxt.next = NULL;
   pic_vm(pic, &cxt);
   return pic_protect(pic, cxt.fp->regs[1]);
 }
@@ -516,6 +543,7 @@ pic_apply(pic_state *pic, pic_value proc, int argc, pic_value *argv)
   struct context cxt;
   CONTEXT_INITK(pic, &cxt, proc, pic->halt, argc, argv);
   cxt.reset = 0;
+  cxt.next = NULL;
   pic_vm(pic, &cxt);
   return pic_protect(pic, cxt.fp->regs[1]);
 }
@@ -527,6 +555,62 @@ pic_applyk(pic_state *pic, pic_value proc, int argc, pic_value *argv)
   return pic_invalid_value(pic);
 }
 
+/*
+ * pic_call_each calls proc again and again within one VM context, so
+ * that a loop like vector-map pays for a frame per call rather than for
+ * a fresh context, a setjmp and a nested VM each time. Before each call
+ * each() writes the argc arguments straight into the callee's frame,
+ * and from the second call on it is also handed the previous result;
+ * it returns false to stop. Whatever each() allocates is dropped from
+ * the arena when it returns and must be kept reachable some other way.
+ */
+
+struct call_each {
+  struct context cxt;
+  pic_value proc;
+  int argc;
+  pic_each_t each;
+  void *data;
+};
+
+static bool
+call_each_next(pic_state *pic, struct context *cxt)
+{
+  struct call_each *ce = (struct call_each *) cxt;
+  pic_value result = cxt->fp != NULL ? cxt->fp->regs[1] : pic_invalid_value(pic);
+
+  cxt->sp = pic_make_frame_unsafe(pic, ce->argc + 3);
+  pic_protect(pic, obj_value(pic, cxt->sp));
+  cxt->sp->regs[0] = ce->proc;
+  cxt->sp->regs[1] = pic->halt;
+  if (! ce->each(pic, ce->data, result, cxt->sp->regs + 2)) {
+    return false;
+  }
+  cxt->pc = MKCALL(cxt, ce->argc + 1);
+  cxt->fp = NULL;
+  cxt->irep = NULL;
+  return true;
+}
+
+void
+pic_call_each(pic_state *pic, pic_value proc, int argc, pic_each_t each, void *data)
+{
+  struct call_each ce;
+  size_t ai = pic_enter(pic);
+
+  ce.proc = proc;
+  ce.argc = argc;
+  ce.each = each;
+  ce.data = data;
+  ce.cxt.fp = NULL;
+  ce.cxt.reset = 0;
+  ce.cxt.next = call_each_next;
+  if (call_each_next(pic, &ce.cxt)) {
+    pic_vm(pic, &ce.cxt);
+  }
+  pic_leave(pic, ai);
+}
+
 pic_value
 pic_values(pic_state *pic, int n, ...)
 {
@@ -591,7 +675,8 @@ pic_vm(pic_state *pic, struct context *cxt)
     [OP_LOAD] = &&L_OP_LOAD, [OP_LREF] = &&L_OP_LREF, [OP_LSET] = &&L_OP_LSET,
     [OP_GREF] = &&L_OP_GREF, [OP_GSET] = &&L_OP_GSET, [OP_COND] = &&L_OP_COND,
     [OP_LOADT] = &&L_OP_LOADT, [OP_LOADF] = &&L_OP_LOADF, [OP_LOADN] = &&L_OP_LOADN,
-    [OP_LOADU] = &&L_OP_LOADU, [OP_LOADI] = &&L_OP_LOADI
+    [OP_LOADU] = &&L_OP_LOADU, [OP_LOADI] = &&L_OP_LOADI, [OP_RREF] = &&L_OP_RREF,
+    [OP_RSET] = &&L_OP_RSET
   };
 #endif
 
@@ -601,6 +686,11 @@ pic_vm(pic_state *pic, struct context *cxt)
       pic_for_each (c, pic->cxt->conts, it) {
         proc_ptr(pic, c)->env->regs[0] = pic_false_value(pic);
       }
+      if (cxt->next != NULL && cxt->next(pic, cxt)) {
+        cxt->conts = pic_nil_value(pic);
+        SAVE;
+        JUMP;
+      }
       pic->cxt = pic->cxt->prev;
       return;
     }
@@ -706,6 +796,19 @@ pic_vm(pic_state *pic, struct context *cxt)
       REG(A) = pic_int_value(pic, (signed char) B);
       NEXT(3);
     }
+    CASE(OP_RREF) {
+      struct record *rec = pic_record_cast(pic, REG(A), REG(A + 1));
+      VALID_INDEX(pic, rec->type->nfields, B);
+      REG(A) = rec->fields[B];
+      NEXT(3);
+    }
+    CASE(OP_RSET) {
+      struct record *rec = pic_record_cast(pic, REG(A), REG(A + 1));
+      VALID_INDEX(pic, rec->type->nfields, B);
+      rec->fields[B] = REG(A + 2);
+      REG(A) = pic_undef_value(pic);
+      NEXT(3);
+    }
   } VM_LOOP_END
 }
 
@@ -0,0 +1,284 @@
+/**
+ * See Copyright Notice in picrin.h
+ */
+
+#include <picrin.h>
+#include <picrin/extra.h>
+#include "value.h"
+#include "object.h"
+#include "state.h"
+
+KHASH_DEFINE(prof_obj, struct object *, struct prof_sample, kh_ptr_hash_func, kh_ptr_hash_equal)
+KHASH_DEFINE(prof_site, const code_t *, int, kh_ptr_hash_func, kh_ptr_hash_equal)
+
+/*
+ * Allocation-site profiler
+ *
+ * While sampling is on, one allocation out of every `interval` bytes is
+ * recorded together with the pc of the running code. Payload charged to
+ * an object (vector data, string bytes, grown tables) is sampled the same
+ * way, so an object keeps a site and the number of samples its bytes
+ * took. A site is only the pc; the irep it belongs to is looked up when
+ * the census is written, so sampling keeps no irep alive. Allocations
+ * made by C primitives carry the pc of the CALL instruction that invoked
+ * them.
+ */
+
+void
+pic_heap_profile(pic_state *pic, size_t interval)
+{
+  struct heap_profile *prof = pic->prof;
+
+  if (interval == 0) {
+    if (prof != NULL) {
+      kh_destroy(prof_obj, &prof->objs);
+      kh_destroy(prof_site, &prof->index);
+      pic_free(pic, (void *) prof->sites);
+      pic_free(pic, prof);
+      pic->prof = NULL;
+    }
+    return;
+  }
+
+  if (prof == NULL) {
+    prof = pic_malloc(pic, sizeof(struct heap_profile));
+    kh_init(prof_obj, &prof->objs);
+    kh_init(prof_site, &prof->index);
+    prof->sites = NULL;
+    prof->nsites = prof->sites_size = 0;
+    pic->prof = prof;
+  }
+  prof->interval = prof->countdown = interval;
+}
+
+void
+pic_prof_sample(pic_state *pic, struct object *obj, size_t size)
+{
+  struct heap_profile *prof = pic->prof;
+  const code_t *pc;
+  size_t n;
+  int it, ret, site;
+
+  if (prof->countdown > size) {
+    prof->countdown -= size;
+    return;
+  }
+
+  /* one sample for every interval boundary these bytes cross */
+  size -= prof->countdown;
+  n = 1 + size / prof->interval;
+  prof->countdown = prof->interval - size % prof->interval;
+
+  pc = pic->cxt->pc;
+
+  it = kh_put(prof_site, &prof->index, pc, &ret);
+  if (ret != 0) {
+    if (prof->nsites == prof->sites_size) {
+      prof->sites_size = prof->sites_size * 2 + 16;
+      prof->sites = pic_realloc(pic, (void *) prof->sites, sizeof(const code_t *) * prof->sites_size);
+    }
+    prof->sites[prof->nsites] = pc;
+    kh_val(&prof->index, it) = prof->nsites++;
+  }
+
+  site = kh_val(&prof->index, it);
+  it = kh_put(prof_obj, &prof->objs, obj, &ret);
+  if (ret != 0) {
+    kh_val(&prof->objs, it).count = 0;
+  }
+  kh_val(&prof->objs, it).site = site;
+  kh_val(&prof->objs, it).count += n;
+}
+
+#if PIC_USE_PORT
+
+static void
+prof_put_size(pic_state *pic, pic_value port, size_t n)
+{
+  char buf[32];
+  int i = sizeof buf;
+
+  buf[--i] = '\0';
+  do {
+    buf[--i] = '0' + (n % 10);
+  } while ((n /= 10) != 0);
+  pic_fputs(pic, buf + i, port);
+}
+
+static void
+prof_name_irep(pic_state *pic, struct irep *irep, pic_value name, pic_value names, bool rec)
+{
+  struct heap_profile *prof = pic->prof;
+  const code_t *pc;
+  size_t i;
+  int j, n = pic_vec_len(pic, names);
+
+  for (j = 0; j < n; ++j) {
+    pc = prof->sites[j];
+    if (irep->code <= pc && pc < irep->code + irep->codec && ! pic_str_p(pic, pic_vec_ref(pic, names, j))) {
+      pic_vec_set(pic, names, j, pic_strf_value(pic, "%s+%d", pic_cstr(pic, name, NULL), (int) (pc - irep->code)));
+    }
+  }
+  for (i = 0; rec && i < irep->irepc; ++i) {
+    prof_name_irep(pic, irep->irep[i], pic_strf_value(pic, "%s/%d", pic_cstr(pic, name, NULL), (int) i), names, rec);
+  }
+}
+
+static pic_value
+prof_site_names(pic_state *pic, int nsites)
+{
+  khash_t(dict) *h = &dict_ptr(pic, pic->globals)->hash;
+  pic_value names, val;
+  struct object *obj;
+  size_t ai;
+  int it;
+
+  names = pic_make_vec(pic, nsites, NULL);
+
+  /* the heap is walked below, so nothing may be reclaimed meanwhile */
+  pic->gc_enable = false;
+
+  ai = pic_enter(pic);
+
+  /* name code reachable from global procedures first */
+  for (it = kh_begin(h); it != kh_end(h); ++it) {
+    if (! kh_exist(h, it))
+      continue;
+    val = kh_val(h, it);
+    if (pic_type(pic, val) == PIC_TYPE_PROC_IREP) {
+      prof_name_irep(pic, proc_ptr(pic, val)->u.irep, pic_sym_name(pic, obj_value(pic, kh_key(h, it))), names, true);
+    }
+    pic_leave(pic, ai);
+  }
+
+  /* then anonymous code still in the heap */
+  for (obj = pic->gc_head.next; obj != &pic->gc_head; obj = obj->next) {
+    if (obj_type(obj) == PIC_TYPE_IREP) {
+      prof_name_irep(pic, (struct irep *) obj, pic_strf_value(pic, "lambda@%p", obj), names, false);
+    }
+    pic_leave(pic, ai);
+  }
+
+  pic->gc_enable = true;
+  return names;
+}
+
+void
+pic_heap_dump(pic_state *pic, pic_value port)
+{
+  struct heap_profile *prof;
+  const struct pic_gc_stats *stats;
+  size_t *counts = NULL, interval = 0;
+  pic_value names, name;
+  int it, i, j, nsites = 0;
+
+  pic_gc(pic);
+
+  /* take the samples before anything else is allocated */
+  if ((prof = pic->prof) != NULL) {
+    interval = prof->interval;
+    nsites = prof->nsites;
+    counts = pic_alloca(pic, (size_t) nsites * PIC_GC_NTYPES * sizeof(size_t));
+    memset(counts, 0, (size_t) nsites * PIC_GC_NTYPES * sizeof(size_t));
+    for (it = kh_begin(&prof->objs); it != kh_end(&prof->objs); ++it) {
+      if (kh_exist(&prof->objs, it)) {
+        counts[kh_val(&prof->objs, it).site * PIC_GC_NTYPES + obj_type(kh_key(&prof->objs, it))] += kh_val(&prof->objs, it).count;
+      }
+    }
+  }
+
+  stats = pic_gc_stats(pic);
+
+  pic_fputs(pic, "# picrin heap profile\n", port);
+  pic_fputs(pic, "interval\t", port);
+  prof_put_size(pic, port, interval);
+  pic_fputs(pic, "\n", port);
+
+  for (i = 0; i < PIC_GC_NTYPES; ++i) {
+    if (pic_gc_typename(i) == NULL || stats->type[i].live_objects == 0)
+      continue;
+    pic_fprintf(pic, port, "census\t%s\t", pic_gc_typename(i));
+    prof_put_size(pic, port, stats->type[i].live_objects);
+    pic_fputs(pic, "\t", port);
+    prof_put_size(pic, port, stats->type[i].live_bytes);
+    pic_fputs(pic, "\n", port);
+  }
+
+  if (counts == NULL)
+    return;
+
+  names = prof_site_names(pic, nsites);
+
+  for (j = 0; j < nsites; ++j) {
+    name = pic_vec_ref(pic, names, j);
+    for (i = 0; i < PIC_GC_NTYPES; ++i) {
+      if (counts[j * PIC_GC_NTYPES + i] == 0)
+        continue;
+      pic_fprintf(pic, port, "site\t%s\t", pic_gc_typename(i));
+      prof_put_size(pic, port, counts[j * PIC_GC_NTYPES + i]);
+      pic_fputs(pic, "\t", port);
+      prof_put_size(pic, port, counts[j * PIC_GC_NTYPES + i] * interval);
+      pic_fprintf(pic, port, "\t%s\n", pic_str_p(pic, name) ? pic_cstr(pic, name, NULL) : "<unknown>");
+    }
+  }
+}
+
+#endif
+
+static pic_value
+pic_prof_heap_profile_sampling(pic_state *pic)
+{
+  int interval, argc;
+
+  argc = pic_get_args(pic, "|i", &interval);
+
+  if (argc > 0) {
+    if (interval < 0) {
+      pic_error(pic, "heap-profile-sampling: negative interval given", 1, pic_int_value(pic, interval));
+    }
+    pic_heap_profile(pic, interval);
+  }
+  return pic_int_value(pic, pic->prof ? (int) pic->prof->interval : 0);
+}
+
+#if PIC_USE_PORT
+
+static pic_value
+pic_prof_heap_profile(pic_state *pic)
+{
+  pic_value port = pic_stdout(pic);
+
+  pic_get_args(pic, "|o", &port);
+
+#if PIC_USE_FILE
+  if (pic_str_p(pic, port)) {
+    const char *fname = pic_cstr(pic, port, NULL);
+    FILE *fp;
+
+    if ((fp = fopen(fname, "w")) == NULL) {
+      pic_error(pic, "heap-profile: could not open file", 1, port);
+    }
+    port = pic_fopen(pic, fp, "w");
+    pic_heap_dump(pic, port);
+    pic_fclose(pic, port);
+    return pic_undef_value(pic);
+  }
+#endif
+
+  if (! pic_port_p(pic, port, NULL)) {
+    pic_error(pic, "heap-profile: port required", 1, port);
+  }
+  pic_heap_dump(pic, port);
+  return pic_undef_value(pic);
+}
+
+#endif
+
+void
+pic_init_prof(pic_state *pic)
+{
+  pic_defun(pic, "heap-profile-sampling", pic_prof_heap_profile_sampling);
+#if PIC_USE_PORT
+  pic_defun(pic, "heap-profile", pic_prof_heap_profile);
+#endif
+}
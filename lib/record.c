@@ -7,13 +7,30 @@
 #include "object.h"
 
 pic_value
-pic_make_record(pic_state *pic, pic_value type, pic_value datum)
+pic_make_record_type(pic_state *pic, pic_value name, pic_value fields)
+{
+  struct record_type *type;
+  int nfields = pic_length(pic, fields);
+
+  type = (struct record_type *)pic_obj_alloc(pic, PIC_TYPE_RECORD_TYPE);
+  type->name = name;
+  type->fields = fields;
+  type->nfields = nfields;
+
+  return obj_value(pic, type);
+}
+
+pic_value
+pic_make_record(pic_state *pic, pic_value type, const pic_value *fields)
 {
   struct record *rec;
+  int i, n = rectype_ptr(pic, type)->nfields;
 
-  rec = (struct record *)pic_obj_alloc(pic, PIC_TYPE_RECORD);
-  rec->type = sym_ptr(pic, type);
-  rec->datum = datum;
+  rec = (struct record *)pic_obj_alloc_var(pic, PIC_TYPE_RECORD, pic_record_size(n));
+  rec->type = rectype_ptr(pic, type);
+  for (i = 0; i < n; ++i) {
+    rec->fields[i] = fields ? fields[i] : pic_undef_value(pic);
+  }
 
   return obj_value(pic, rec);
 }
@@ -24,30 +41,93 @@ pic_record_type(pic_state *pic, pic_value rec)
   return obj_value(pic, rec_ptr(pic, rec)->type);
 }
 
-pic_value
-pic_record_datum(pic_state *pic, pic_value rec)
+struct record *
+pic_record_cast(pic_state *pic, pic_value rec, pic_value type)
 {
-  return rec_ptr(pic, rec)->datum;
+  if (! (pic_rec_p(pic, rec) && pic_rectype_p(pic, type) && rec_ptr(pic, rec)->type == rectype_ptr(pic, type))) {
+    pic_error(pic, "record type mismatch", 2, rec, pic_rectype_p(pic, type) ? rectype_ptr(pic, type)->name : type);
+  }
+  return rec_ptr(pic, rec);
 }
 
 static pic_value
-pic_rec_make_record(pic_state *pic)
+pic_rec_make_record_type(pic_state *pic)
+{
+  pic_value name, fields;
+
+  pic_get_args(pic, "oo", &name, &fields);
+
+  if (! pic_list_p(pic, fields)) {
+    pic_error(pic, "make-record-type: list of field names required", 1, fields);
+  }
+  return pic_make_record_type(pic, name, fields);
+}
+
+static pic_value
+pic_rec_record_type_p(pic_state *pic)
+{
+  pic_value obj;
+
+  pic_get_args(pic, "o", &obj);
+
+  return pic_bool_value(pic, pic_rectype_p(pic, obj));
+}
+
+static pic_value
+pic_rec_record_type_name(pic_state *pic)
 {
-  pic_value type, datum;
+  pic_value type;
 
-  pic_get_args(pic, "mo", &type, &datum);
+  pic_get_args(pic, "o", &type);
 
-  return pic_make_record(pic, type, datum);
+  if (! pic_rectype_p(pic, type)) {
+    pic_error(pic, "record type required", 1, type);
+  }
+  return rectype_ptr(pic, type)->name;
+}
+
+static pic_value
+pic_rec_record_type_fields(pic_state *pic)
+{
+  pic_value type;
+
+  pic_get_args(pic, "o", &type);
+
+  if (! pic_rectype_p(pic, type)) {
+    pic_error(pic, "record type required", 1, type);
+  }
+  return rectype_ptr(pic, type)->fields;
+}
+
+static pic_value
+pic_rec_make_record(pic_state *pic)
+{
+  pic_value type, *fields;
+  int n;
+
+  pic_get_args(pic, "o*", &type, &n, &fields);
+
+  if (! pic_rectype_p(pic, type)) {
+    pic_error(pic, "record type required", 1, type);
+  }
+  if (n != rectype_ptr(pic, type)->nfields) {
+    pic_error(pic, "make-record: wrong number of fields", 2, type, pic_int_value(pic, n));
+  }
+  return pic_make_record(pic, type, fields);
 }
 
 static pic_value
 pic_rec_record_p(pic_state *pic)
 {
-  pic_value rec;
+  pic_value rec, type;
+  int n;
 
-  pic_get_args(pic, "o", &rec);
+  n = pic_get_args(pic, "o|o", &rec, &type);
 
-  return pic_bool_value(pic, pic_rec_p(pic, rec));
+  if (n == 1 || ! pic_rec_p(pic, rec)) {
+    return pic_bool_value(pic, pic_rec_p(pic, rec));
+  }
+  return pic_bool_value(pic, pic_rectype_p(pic, type) && rec_ptr(pic, rec)->type == rectype_ptr(pic, type));
 }
 
 static pic_value
@@ -61,20 +141,44 @@ pic_rec_record_type(pic_state *pic)
 }
 
 static pic_value
-pic_rec_record_datum(pic_state *pic)
+pic_rec_record_ref(pic_state *pic)
 {
-  pic_value rec;
+  pic_value rec, type;
+  struct record *r;
+  int i;
 
-  pic_get_args(pic, "r", &rec);
+  pic_get_args(pic, "ooi", &rec, &type, &i);
+
+  r = pic_record_cast(pic, rec, type);
+  VALID_INDEX(pic, r->type->nfields, i);
+  return r->fields[i];
+}
+
+static pic_value
+pic_rec_record_set(pic_state *pic)
+{
+  pic_value rec, type, val;
+  struct record *r;
+  int i;
+
+  pic_get_args(pic, "ooio", &rec, &type, &i, &val);
 
-  return pic_record_datum(pic, rec);
+  r = pic_record_cast(pic, rec, type);
+  VALID_INDEX(pic, r->type->nfields, i);
+  r->fields[i] = val;
+  return pic_undef_value(pic);
 }
 
 void
 pic_init_record(pic_state *pic)
 {
+  pic_defun(pic, "make-record-type", pic_rec_make_record_type);
+  pic_defun(pic, "record-type?", pic_rec_record_type_p);
+  pic_defun(pic, "record-type-name", pic_rec_record_type_name);
+  pic_defun(pic, "record-type-fields", pic_rec_record_type_fields);
   pic_defun(pic, "make-record", pic_rec_make_record);
   pic_defun(pic, "record?", pic_rec_record_p);
   pic_defun(pic, "record-type", pic_rec_record_type);
-  pic_defun(pic, "record-datum", pic_rec_record_datum);
+  pic_defun(pic, "record-ref", pic_rec_record_ref);
+  pic_defun(pic, "record-set!", pic_rec_record_set);
 }
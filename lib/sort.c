@@ -0,0 +1,823 @@
+/**
+ * See Copyright Notice in picrin.h
+ */
+
+#include <picrin.h>
+#include "value.h"
+#include "object.h"
+#include "state.h"
+
+/*
+ * Sorting
+ *
+ * Every sort is a stable natural merge sort after Timsort: the elements
+ * are cut into ascending or strictly descending runs (the latter are
+ * reversed), runs shorter than a minimum are extended by binary
+ * insertion, and runs are merged as Timsort's stack invariants say.
+ * Before a merge, the part of either run that is already in place is
+ * found by binary search and left alone. There is no galloping.
+ *
+ * The sort is written as a state machine that stops at each comparison
+ * and asks for (less? x y). With <, string<? or char<? the answers are
+ * computed in C; any other procedure is called through pic_call_each, so
+ * that a whole sort runs in a single VM context. Lists are sorted in a
+ * vector of their elements. All the elements and the merge scratch are
+ * kept in vectors so that they stay reachable while the procedure runs.
+ */
+
+#define SORT_MIN_MERGE 64       /* shorter input is one run of binary insertion */
+#define SORT_MAX_RUNS 85        /* the invariants keep far fewer for any int length */
+
+enum {
+  SORT_START,
+  SORT_RUN_DIR,                 /* less?(v[lo + 1], v[lo]) */
+  SORT_RUN_SCAN,                /* less?(v[hi], v[hi - 1]) */
+  SORT_INSERT,                  /* less?(v[hi], v[m]) */
+  SORT_TRIM_A,                  /* less?(B[0], A[m]) */
+  SORT_TRIM_B,                  /* less?(B[m], A[na - 1]) */
+  SORT_MERGE_LO,                /* less?(v[j], tmp[i]) */
+  SORT_MERGE_HI,                /* less?(tmp[j], v[i]) */
+  SORT_DONE
+};
+
+struct sort {
+  pic_value *v, *w;             /* what is compared, and the values of those keys or NULL */
+  pic_value *tmp, *wtmp;        /* merge scratch, as long as the shorter run */
+  int n, minrun;
+  pic_value x, y;               /* the next comparison is (less? x y) */
+  int state;
+  bool desc;
+  int lo, hi, end, l, r, m;     /* the run being made and binary searches */
+  int a, na, b, nb, i, j, k;    /* the merge in progress */
+  int nruns;
+  int base[SORT_MAX_RUNS], len[SORT_MAX_RUNS];
+};
+
+/* v[i] = from[j], and the same for w */
+#define MOVE(s, i, from, wfrom, j) do {         \
+    (s)->v[i] = (from)[j];                      \
+    if ((s)->w) (s)->w[i] = (wfrom)[j];         \
+  } while (0)
+
+#define ASK(s, st, a1, a2) do {                 \
+    (s)->state = (st);                          \
+    (s)->x = (a1);                              \
+    (s)->y = (a2);                              \
+    return true;                                \
+  } while (0)
+
+static int
+sort_minrun(int n)
+{
+  int r = 0;
+
+  while (n >= SORT_MIN_MERGE) {
+    r |= n & 1;
+    n >>= 1;
+  }
+  return n + r;
+}
+
+static void
+sort_reverse(struct sort *s, int lo, int hi)
+{
+  pic_value t;
+
+  for (--hi; lo < hi; ++lo, --hi) {
+    t = s->v[lo]; s->v[lo] = s->v[hi]; s->v[hi] = t;
+    if (s->w) {
+      t = s->w[lo]; s->w[lo] = s->w[hi]; s->w[hi] = t;
+    }
+  }
+}
+
+/* moves v[hi] down to l, shifting v[l..hi) up by one */
+static void
+sort_rotate(struct sort *s, int l, int hi)
+{
+  pic_value t = s->v[hi], u = s->w ? s->w[hi] : t;
+  int i;
+
+  for (i = hi; i > l; --i) {
+    MOVE(s, i, s->v, s->w, i - 1);
+  }
+  s->v[l] = t;
+  if (s->w) s->w[l] = u;
+}
+
+static void
+sort_copy(struct sort *s, pic_value *to, pic_value *wto, int to_i, pic_value *from, pic_value *wfrom, int from_i, int n)
+{
+  memmove(to + to_i, from + from_i, sizeof(pic_value) * n);
+  if (s->w) memmove(wto + to_i, wfrom + from_i, sizeof(pic_value) * n);
+}
+
+/*
+ * Advances the sort given the answer to the last question, and returns
+ * true after storing the next question in s->x and s->y, or false when
+ * the elements are sorted.
+ */
+static bool
+sort_next(struct sort *s, bool lt)
+{
+  int k;
+
+  switch (s->state) {
+  case SORT_START: goto start;
+  case SORT_RUN_DIR: goto run_dir;
+  case SORT_RUN_SCAN: goto run_scan;
+  case SORT_INSERT: goto insert;
+  case SORT_TRIM_A: goto trim_a;
+  case SORT_TRIM_B: goto trim_b;
+  case SORT_MERGE_LO: goto merge_lo;
+  case SORT_MERGE_HI: goto merge_hi;
+  default: return false;
+  }
+
+ start:
+  if (s->lo == s->n)
+    goto collapse;              /* merging runs laid out beforehand */
+
+ next_run:
+  if (s->lo == s->n)
+    goto collapse_force;
+  s->hi = s->lo + 1;
+  s->desc = false;
+  if (s->hi == s->n)
+    goto extend;
+  ASK(s, SORT_RUN_DIR, s->v[s->hi], s->v[s->lo]);
+ run_dir:
+  s->desc = lt;
+  s->hi++;
+ scan:
+  if (s->hi == s->n)
+    goto run_found;
+  ASK(s, SORT_RUN_SCAN, s->v[s->hi], s->v[s->hi - 1]);
+ run_scan:
+  if (lt == s->desc) {
+    s->hi++;
+    goto scan;
+  }
+ run_found:
+  if (s->desc)
+    sort_reverse(s, s->lo, s->hi);
+
+ extend:
+  s->end = s->n - s->lo < s->minrun ? s->n : s->lo + s->minrun;
+  while (s->hi < s->end) {
+    s->l = s->lo;
+    s->r = s->hi;
+    while (s->l < s->r) {
+      s->m = s->l + (s->r - s->l) / 2;
+      ASK(s, SORT_INSERT, s->v[s->hi], s->v[s->m]);
+    insert:
+      if (lt)
+        s->r = s->m;
+      else
+        s->l = s->m + 1;
+    }
+    sort_rotate(s, s->l, s->hi);
+    s->hi++;
+  }
+  s->base[s->nruns] = s->lo;
+  s->len[s->nruns] = s->hi - s->lo;
+  s->nruns++;
+  s->lo = s->hi;
+
+ collapse:
+  while (s->nruns > 1) {
+    k = s->nruns - 2;
+    if ((k > 0 && s->len[k - 1] <= s->len[k] + s->len[k + 1]) || (k > 1 && s->len[k - 2] <= s->len[k - 1] + s->len[k])) {
+      if (s->len[k - 1] < s->len[k + 1])
+        k--;
+    } else if (s->len[k] > s->len[k + 1]) {
+      break;
+    }
+    goto merge_at;
+  }
+  goto next_run;
+
+ collapse_force:
+  if (s->nruns <= 1) {
+    s->state = SORT_DONE;
+    return false;
+  }
+  k = s->nruns - 2;
+  if (k > 0 && s->len[k - 1] < s->len[k + 1])
+    k--;
+
+ merge_at:
+  s->a = s->base[k];
+  s->na = s->len[k];
+  s->b = s->base[k + 1];
+  s->nb = s->len[k + 1];
+  s->len[k] += s->nb;
+  if (k == s->nruns - 3) {
+    s->base[k + 1] = s->base[k + 2];
+    s->len[k + 1] = s->len[k + 2];
+  }
+  s->nruns--;
+
+  /* the head of A up to the first element greater than B[0] stays */
+  s->l = 0;
+  s->r = s->na;
+  while (s->l < s->r) {
+    s->m = s->l + (s->r - s->l) / 2;
+    ASK(s, SORT_TRIM_A, s->v[s->b], s->v[s->a + s->m]);
+  trim_a:
+    if (lt)
+      s->r = s->m;
+    else
+      s->l = s->m + 1;
+  }
+  s->a += s->l;
+  s->na -= s->l;
+  if (s->na == 0)
+    goto collapse;
+
+  /* so does the tail of B from the first element not less than A's last */
+  s->l = 0;
+  s->r = s->nb;
+  while (s->l < s->r) {
+    s->m = s->l + (s->r - s->l) / 2;
+    ASK(s, SORT_TRIM_B, s->v[s->b + s->m], s->v[s->a + s->na - 1]);
+  trim_b:
+    if (lt)
+      s->l = s->m + 1;
+    else
+      s->r = s->m;
+  }
+  s->nb = s->l;
+  if (s->nb == 0)
+    goto collapse;
+
+  if (s->na <= s->nb) {
+    /* A goes to the scratch and the merge fills from the left */
+    sort_copy(s, s->tmp, s->wtmp, 0, s->v, s->w, s->a, s->na);
+    s->i = 0;
+    s->j = s->b;
+    s->k = s->a;
+    while (s->i < s->na && s->j < s->b + s->nb) {
+      ASK(s, SORT_MERGE_LO, s->v[s->j], s->tmp[s->i]);
+    merge_lo:
+      if (lt) {
+        MOVE(s, s->k, s->v, s->w, s->j);
+        s->j++;
+      } else {
+        MOVE(s, s->k, s->tmp, s->wtmp, s->i);
+        s->i++;
+      }
+      s->k++;
+    }
+    sort_copy(s, s->v, s->w, s->k, s->tmp, s->wtmp, s->i, s->na - s->i);
+  } else {
+    /* B goes to the scratch and the merge fills from the right */
+    sort_copy(s, s->tmp, s->wtmp, 0, s->v, s->w, s->b, s->nb);
+    s->i = s->a + s->na - 1;
+    s->j = s->nb - 1;
+    s->k = s->b + s->nb - 1;
+    while (s->j >= 0 && s->i >= s->a) {
+      ASK(s, SORT_MERGE_HI, s->tmp[s->j], s->v[s->i]);
+    merge_hi:
+      if (lt) {
+        MOVE(s, s->k, s->v, s->w, s->i);
+        s->i--;
+      } else {
+        MOVE(s, s->k, s->tmp, s->wtmp, s->j);
+        s->j--;
+      }
+      s->k--;
+    }
+    sort_copy(s, s->v, s->w, s->a, s->tmp, s->wtmp, 0, s->j + 1);
+  }
+  goto collapse;
+}
+
+enum {
+  LESS_PROC,
+  LESS_NUM,
+  LESS_STR,
+  LESS_CHAR
+};
+
+static int
+less_kind(pic_state *pic, pic_value less)
+{
+  static const struct {
+    const char *name;
+    int kind;
+  } builtins[] = {
+    { "<", LESS_NUM },
+    { "string<?", LESS_STR },
+    { "char<?", LESS_CHAR }
+  };
+  size_t i;
+
+  for (i = 0; i < sizeof builtins / sizeof builtins[0]; ++i) {
+    if (pic_eq_p(pic, less, pic_ref(pic, builtins[i].name))) {
+      return builtins[i].kind;
+    }
+  }
+  return LESS_PROC;
+}
+
+/* what the builtin would answer, errors included */
+static bool
+less_p(pic_state *pic, int kind, pic_value x, pic_value y)
+{
+  switch (kind) {
+  case LESS_NUM:
+    if (pic_int_p(pic, x) && pic_int_p(pic, y)) {
+      return pic_int(pic, x) < pic_int(pic, y);
+    }
+    return pic_lt(pic, x, y);
+  case LESS_STR:
+    return pic_str_p(pic, x) && pic_str_p(pic, y) && pic_str_cmp(pic, x, y) < 0;
+  case LESS_CHAR:
+    TYPE_CHECK(pic, x, char);
+    TYPE_CHECK(pic, y, char);
+    return pic_char(pic, x) < pic_char(pic, y);
+  }
+  PIC_UNREACHABLE();
+}
+
+static bool
+sort_each(pic_state *pic, void *data, pic_value result, pic_value *argv)
+{
+  struct sort *s = data;
+
+  if (! sort_next(s, ! pic_false_p(pic, result))) {
+    return false;
+  }
+  argv[0] = s->x;
+  argv[1] = s->y;
+  return true;
+}
+
+/* fills keys[0..n) with (key v[i]) */
+struct key_each {
+  pic_value *v, *keys;
+  int i, n;
+};
+
+static bool
+key_each(pic_state *pic, void *data, pic_value result, pic_value *argv)
+{
+  struct key_each *e = data;
+
+  (void)pic;
+  if (e->i > 0) {
+    e->keys[e->i - 1] = result;
+  }
+  if (e->i == e->n) {
+    return false;
+  }
+  argv[0] = e->v[e->i++];
+  return true;
+}
+
+/* the keys of v[0..n), in a fresh vector, or v itself if key is #f */
+static pic_value *
+sort_keys(pic_state *pic, pic_value key, pic_value *v, int n)
+{
+  struct key_each e;
+  pic_value keys;
+
+  if (pic_false_p(pic, key)) {
+    return v;
+  }
+  keys = pic_make_vec(pic, n, NULL);
+  e.v = v;
+  e.keys = vec_ptr(pic, keys)->data;
+  e.i = 0;
+  e.n = n;
+  pic_call_each(pic, key, 1, key_each, &e);
+  return e.keys;
+}
+
+/*
+ * Sorts v[0..n) in place by (less? (key x) (key y)). If mid is not
+ * negative, v[0..mid) and v[mid..n) are taken to be sorted already and
+ * are only merged.
+ */
+static void
+sort_values(pic_state *pic, pic_value less, pic_value key, pic_value *v, int n, int mid)
+{
+  struct sort s;
+  pic_value *keys;
+  int kind;
+  bool lt;
+
+  if (n < 2 || mid == 0 || mid == n) {
+    return;
+  }
+  kind = less_kind(pic, less);
+  keys = sort_keys(pic, key, v, n);
+
+  s.v = keys;
+  s.w = keys == v ? NULL : v;
+  s.tmp = s.wtmp = NULL;
+  if (n >= SORT_MIN_MERGE || mid >= 0) {
+    s.tmp = vec_ptr(pic, pic_make_vec(pic, n / 2 + 1, NULL))->data;
+    if (s.w) {
+      s.wtmp = vec_ptr(pic, pic_make_vec(pic, n / 2 + 1, NULL))->data;
+    }
+  }
+  s.n = n;
+  s.minrun = sort_minrun(n);
+  s.state = SORT_START;
+  s.lo = 0;
+  s.nruns = 0;
+  if (mid >= 0) {
+    s.base[0] = 0;
+    s.len[0] = mid;
+    s.base[1] = mid;
+    s.len[1] = n - mid;
+    s.nruns = 2;
+    s.lo = n;
+  }
+
+  if (kind == LESS_PROC) {
+    pic_call_each(pic, less, 2, sort_each, &s);
+  } else {
+    lt = false;
+    while (sort_next(&s, lt)) {
+      lt = less_p(pic, kind, s.x, s.y);
+    }
+  }
+}
+
+struct sorted_each {
+  pic_value *v;
+  int i, n;
+  bool sorted;
+};
+
+static bool
+sorted_each(pic_state *pic, void *data, pic_value result, pic_value *argv)
+{
+  struct sorted_each *e = data;
+
+  if (e->i > 1 && ! pic_false_p(pic, result)) {
+    e->sorted = false;
+    return false;
+  }
+  if (e->i == e->n) {
+    return false;
+  }
+  argv[0] = e->v[e->i];
+  argv[1] = e->v[e->i - 1];
+  e->i++;
+  return true;
+}
+
+static bool
+sorted_values(pic_state *pic, pic_value less, pic_value key, pic_value *v, int n)
+{
+  struct sorted_each e;
+  int kind, i;
+
+  if (n < 2) {
+    return true;
+  }
+  kind = less_kind(pic, less);
+  v = sort_keys(pic, key, v, n);
+
+  if (kind != LESS_PROC) {
+    for (i = 1; i < n; ++i) {
+      if (less_p(pic, kind, v[i], v[i - 1]))
+        return false;
+    }
+    return true;
+  }
+  e.v = v;
+  e.i = 1;
+  e.n = n;
+  e.sorted = true;
+  pic_call_each(pic, less, 2, sorted_each, &e);
+  return e.sorted;
+}
+
+/* a fresh vector of the elements of list, followed by those of rest */
+static pic_value
+list_values(pic_state *pic, pic_value list, pic_value rest)
+{
+  pic_value vec, e, it;
+  pic_value *data;
+  int i = 0;
+
+  vec = pic_make_vec(pic, pic_length(pic, list) + pic_length(pic, rest), NULL);
+  data = vec_ptr(pic, vec)->data;
+  pic_for_each (e, list, it) {
+    data[i++] = e;
+  }
+  pic_for_each (e, rest, it) {
+    data[i++] = e;
+  }
+  return vec;
+}
+
+static pic_value
+values_list(pic_state *pic, pic_value vec)
+{
+  size_t ai = pic_enter(pic);
+  pic_value acc = pic_nil_value(pic);
+  int i;
+
+  for (i = pic_vec_len(pic, vec); i > 0; --i) {
+    acc = pic_cons(pic, pic_vec_ref(pic, vec, i - 1), acc);
+
+    pic_leave(pic, ai);
+    pic_protect(pic, acc);
+  }
+  return acc;
+}
+
+/* stores the elements of vec into the cars of list */
+static pic_value
+values_into_list(pic_state *pic, pic_value vec, pic_value list)
+{
+  pic_value cell;
+  int i = 0;
+
+  for (cell = list; pic_pair_p(pic, cell); cell = pic_cdr(pic, cell)) {
+    pic_set_car(pic, cell, pic_vec_ref(pic, vec, i++));
+  }
+  return list;
+}
+
+static pic_value
+sort_list(pic_state *pic, pic_value less, pic_value list, pic_value key, bool in_place)
+{
+  pic_value vec = list_values(pic, list, pic_nil_value(pic));
+
+  sort_values(pic, less, key, vec_ptr(pic, vec)->data, pic_vec_len(pic, vec), -1);
+  return in_place ? values_into_list(pic, vec, list) : values_list(pic, vec);
+}
+
+static pic_value
+merge_lists(pic_state *pic, pic_value less, pic_value list1, pic_value list2, pic_value key, bool in_place)
+{
+  pic_value vec = list_values(pic, list1, list2), cell;
+
+  sort_values(pic, less, key, vec_ptr(pic, vec)->data, pic_vec_len(pic, vec), pic_length(pic, list1));
+  if (! in_place) {
+    return values_list(pic, vec);
+  }
+  if (pic_nil_p(pic, list1)) {
+    return list2;
+  }
+  for (cell = list1; pic_pair_p(pic, pic_cdr(pic, cell)); cell = pic_cdr(pic, cell))
+    ;
+  pic_set_cdr(pic, cell, list2);
+  return values_into_list(pic, vec, list1);
+}
+
+static pic_value
+sort_vector(pic_state *pic, pic_value less, pic_value vec, int start, int end, pic_value key, bool in_place)
+{
+  if (! in_place) {
+    vec = pic_make_vec(pic, end - start, vec_ptr(pic, vec)->data + start);
+    start = 0;
+    end = pic_vec_len(pic, vec);
+  }
+  sort_values(pic, less, key, vec_ptr(pic, vec)->data + start, end - start, -1);
+  return vec;
+}
+
+/* the ranges of the two vectors merged into a fresh vector */
+static pic_value
+merge_vectors(pic_state *pic, pic_value less, pic_value vec1, int s1, int e1, pic_value vec2, int s2, int e2, pic_value key)
+{
+  pic_value vec = pic_make_vec(pic, (e1 - s1) + (e2 - s2), NULL);
+  pic_value *data = vec_ptr(pic, vec)->data;
+
+  memcpy(data, vec_ptr(pic, vec1)->data + s1, sizeof(pic_value) * (e1 - s1));
+  memcpy(data + (e1 - s1), vec_ptr(pic, vec2)->data + s2, sizeof(pic_value) * (e2 - s2));
+  sort_values(pic, less, key, data, pic_vec_len(pic, vec), e1 - s1);
+  return vec;
+}
+
+static void
+vector_range(pic_state *pic, int n, pic_value vec, int *start, int *end, int skip)
+{
+  int len = pic_vec_len(pic, vec);
+
+  if (n <= skip) {
+    *start = 0;
+  }
+  if (n <= skip + 1) {
+    *end = len;
+  }
+  VALID_RANGE(pic, len, *start, *end);
+}
+
+/* SRFI 132 */
+
+static pic_value
+pic_sort_list_sort(pic_state *pic)
+{
+  pic_value less, list;
+
+  pic_get_args(pic, "lo", &less, &list);
+
+  return sort_list(pic, less, list, pic_false_value(pic), false);
+}
+
+static pic_value
+pic_sort_list_sort_i(pic_state *pic)
+{
+  pic_value less, list;
+
+  pic_get_args(pic, "lo", &less, &list);
+
+  return sort_list(pic, less, list, pic_false_value(pic), true);
+}
+
+static pic_value
+pic_sort_list_sorted_p(pic_state *pic)
+{
+  pic_value less, list, vec;
+
+  pic_get_args(pic, "lo", &less, &list);
+
+  vec = list_values(pic, list, pic_nil_value(pic));
+  return pic_bool_value(pic, sorted_values(pic, less, pic_false_value(pic), vec_ptr(pic, vec)->data, pic_vec_len(pic, vec)));
+}
+
+static pic_value
+pic_sort_list_merge(pic_state *pic)
+{
+  pic_value less, list1, list2;
+
+  pic_get_args(pic, "loo", &less, &list1, &list2);
+
+  return merge_lists(pic, less, list1, list2, pic_false_value(pic), false);
+}
+
+static pic_value
+pic_sort_list_merge_i(pic_state *pic)
+{
+  pic_value less, list1, list2;
+
+  pic_get_args(pic, "loo", &less, &list1, &list2);
+
+  return merge_lists(pic, less, list1, list2, pic_false_value(pic), true);
+}
+
+static pic_value
+pic_sort_vector_sort(pic_state *pic)
+{
+  pic_value less, vec;
+  int n, start, end;
+
+  n = pic_get_args(pic, "lv|ii", &less, &vec, &start, &end);
+
+  vector_range(pic, n, vec, &start, &end, 2);
+  return sort_vector(pic, less, vec, start, end, pic_false_value(pic), false);
+}
+
+static pic_value
+pic_sort_vector_sort_i(pic_state *pic)
+{
+  pic_value vec, less;
+  int n, start, end;
+
+  n = pic_get_args(pic, "vl|ii", &vec, &less, &start, &end);
+
+  vector_range(pic, n, vec, &start, &end, 2);
+  sort_vector(pic, less, vec, start, end, pic_false_value(pic), true);
+  return pic_undef_value(pic);
+}
+
+static pic_value
+pic_sort_vector_sorted_p(pic_state *pic)
+{
+  pic_value less, vec;
+  int n, start, end;
+
+  n = pic_get_args(pic, "lv|ii", &less, &vec, &start, &end);
+
+  vector_range(pic, n, vec, &start, &end, 2);
+  return pic_bool_value(pic, sorted_values(pic, less, pic_false_value(pic), vec_ptr(pic, vec)->data + start, end - start));
+}
+
+static pic_value
+pic_sort_vector_merge(pic_state *pic)
+{
+  pic_value less, vec1, vec2;
+  int n, s1, e1, s2, e2;
+
+  n = pic_get_args(pic, "lvv|iiii", &less, &vec1, &vec2, &s1, &e1, &s2, &e2);
+
+  vector_range(pic, n, vec1, &s1, &e1, 3);
+  vector_range(pic, n, vec2, &s2, &e2, 5);
+  return merge_vectors(pic, less, vec1, s1, e1, vec2, s2, e2, pic_false_value(pic));
+}
+
+static pic_value
+pic_sort_vector_merge_i(pic_state *pic)
+{
+  pic_value less, to, vec1, vec2, vec;
+  int n, at, s1, e1, s2, e2, len;
+
+  n = pic_get_args(pic, "lvvv|iiiii", &less, &to, &vec1, &vec2, &at, &s1, &e1, &s2, &e2);
+
+  if (n <= 4) {
+    at = 0;
+  }
+  vector_range(pic, n, vec1, &s1, &e1, 5);
+  vector_range(pic, n, vec2, &s2, &e2, 7);
+  vec = merge_vectors(pic, less, vec1, s1, e1, vec2, s2, e2, pic_false_value(pic));
+  len = pic_vec_len(pic, vec);
+  if (at < 0 || pic_vec_len(pic, to) - at < len) {
+    pic_error(pic, "vector-merge!: invalid range", 0);
+  }
+  memcpy(vec_ptr(pic, to)->data + at, vec_ptr(pic, vec)->data, sizeof(pic_value) * len);
+  return pic_undef_value(pic);
+}
+
+/* SRFI 95 */
+
+static pic_value
+pic_sort_sort(pic_state *pic)
+{
+  pic_value seq, less, key = pic_false_value(pic);
+
+  pic_get_args(pic, "ol|o", &seq, &less, &key);
+
+  if (pic_vec_p(pic, seq)) {
+    return sort_vector(pic, less, seq, 0, pic_vec_len(pic, seq), key, false);
+  }
+  return sort_list(pic, less, seq, key, false);
+}
+
+static pic_value
+pic_sort_sort_i(pic_state *pic)
+{
+  pic_value seq, less, key = pic_false_value(pic);
+
+  pic_get_args(pic, "ol|o", &seq, &less, &key);
+
+  if (pic_vec_p(pic, seq)) {
+    return sort_vector(pic, less, seq, 0, pic_vec_len(pic, seq), key, true);
+  }
+  return sort_list(pic, less, seq, key, true);
+}
+
+static pic_value
+pic_sort_sorted_p(pic_state *pic)
+{
+  pic_value seq, less, key = pic_false_value(pic);
+
+  pic_get_args(pic, "ol|o", &seq, &less, &key);
+
+  if (! pic_vec_p(pic, seq)) {
+    seq = list_values(pic, seq, pic_nil_value(pic));
+  }
+  return pic_bool_value(pic, sorted_values(pic, less, key, vec_ptr(pic, seq)->data, pic_vec_len(pic, seq)));
+}
+
+static pic_value
+pic_sort_merge(pic_state *pic)
+{
+  pic_value list1, list2, less, key = pic_false_value(pic);
+
+  pic_get_args(pic, "ool|o", &list1, &list2, &less, &key);
+
+  return merge_lists(pic, less, list1, list2, key, false);
+}
+
+static pic_value
+pic_sort_merge_i(pic_state *pic)
+{
+  pic_value list1, list2, less, key = pic_false_value(pic);
+
+  pic_get_args(pic, "ool|o", &list1, &list2, &less, &key);
+
+  return merge_lists(pic, less, list1, list2, key, true);
+}
+
+void
+pic_init_sort(pic_state *pic)
+{
+  pic_defun(pic, "list-sort", pic_sort_list_sort);
+  pic_defun(pic, "list-stable-sort", pic_sort_list_sort);
+  pic_defun(pic, "list-sort!", pic_sort_list_sort_i);
+  pic_defun(pic, "list-stable-sort!", pic_sort_list_sort_i);
+  pic_defun(pic, "list-sorted?", pic_sort_list_sorted_p);
+  pic_defun(pic, "list-merge", pic_sort_list_merge);
+  pic_defun(pic, "list-merge!", pic_sort_list_merge_i);
+  pic_defun(pic, "vector-sort", pic_sort_vector_sort);
+  pic_defun(pic, "vector-stable-sort", pic_sort_vector_sort);
+  pic_defun(pic, "vector-sort!", pic_sort_vector_sort_i);
+  pic_defun(pic, "vector-stable-sort!", pic_sort_vector_sort_i);
+  pic_defun(pic, "vector-sorted?", pic_sort_vector_sorted_p);
+  pic_defun(pic, "vector-merge", pic_sort_vector_merge);
+  pic_defun(pic, "vector-merge!", pic_sort_vector_merge_i);
+  pic_defun(pic, "sort", pic_sort_sort);
+  pic_defun(pic, "sort!", pic_sort_sort_i);
+  pic_defun(pic, "sorted?", pic_sort_sorted_p);
+  pic_defun(pic, "merge", pic_sort_merge);
+  pic_defun(pic, "merge!", pic_sort_merge_i);
+}
@@ -34,8 +34,13 @@ void pic_init_var(pic_state *);
 void pic_init_write(pic_state *);
 void pic_init_read(pic_state *);
 void pic_init_dict(pic_state *);
+void pic_init_table(pic_state *);
+void pic_init_sort(pic_state *);
+void pic_init_uvector(pic_state *);
 void pic_init_record(pic_state *);
 void pic_init_attr(pic_state *);
+void pic_init_gc(pic_state *);
+void pic_init_prof(pic_state *);
 void pic_init_file(pic_state *);
 void pic_init_state(pic_state *);
 void pic_init_eval(pic_state *);
@@ -61,8 +66,13 @@ pic_init_core(pic_state *pic)
   pic_init_str(pic); DONE;
   pic_init_var(pic); DONE;
   pic_init_dict(pic); DONE;
+  pic_init_table(pic); DONE;
+  pic_init_sort(pic); DONE;
+  pic_init_uvector(pic); DONE;
   pic_init_record(pic); DONE;
   pic_init_attr(pic); DONE;
+  pic_init_gc(pic); DONE;
+  pic_init_prof(pic); DONE;
   pic_init_state(pic); DONE;
 
 #if PIC_USE_CONT
@@ -115,6 +125,7 @@ pic_open(pic_allocf allocf, void *userdata, pic_panicf panicf)
   pic->default_cxt.sp = NULL;
   pic->default_cxt.irep = NULL;
   pic->default_cxt.prev = NULL;
+  pic->default_cxt.next = NULL;
   pic->default_cxt.conts = pic_nil_value(pic);
   pic->cxt = &pic->default_cxt;
 
@@ -133,7 +144,24 @@ pic_open(pic_allocf allocf, void *userdata, pic_panicf panicf)
   /* gc */
   pic->gc_head.next = (struct object *) &pic->gc_head;
   pic->gc_attrs = NULL;
+  kh_init(ephemeron, &pic->gc_eph.pending);
+  pic->gc_eph.chain = NULL;
+  pic->gc_eph.nchain = pic->gc_eph.chain_size = 0;
+  pic->gc_eph.ready = NULL;
+  pic->gc_eph.nready = pic->gc_eph.ready_size = 0;
   pic->gc_count = 0;
+  pic->gc_threshold = PIC_GC_PERIOD;
+  pic->gc_live = 0;
+  pic->gc_growth = PIC_GC_GROWTH;
+  pic->gc_min = PIC_GC_PERIOD;
+  pic->gc_max = PIC_GC_PERIOD_MAX;
+  memset(&pic->gc_stats, 0, sizeof pic->gc_stats);
+  pic->gc_log = false;
+  pic->prof = NULL;
+#if PIC_GC_THREADS
+  pic->gc_threads = PIC_GC_THREADS;
+  pic->gc_pool = NULL;
+#endif
 
   /* symbol table */
   kh_init(oblist, &pic->oblist);
@@ -200,9 +228,22 @@ pic_close(pic_state *pic)
 
   assert(pic->gc_head.next == (struct object *) &pic->gc_head);
 
+#if PIC_GC_THREADS
+  /* stop marker threads */
+  pic_gc_pool_close(pic);
+#endif
+
   /* free global stacks */
   kh_destroy(oblist, &pic->oblist);
 
+  /* free ephemeron work tables */
+  kh_destroy(ephemeron, &pic->gc_eph.pending);
+  pic_free(pic, pic->gc_eph.chain);
+  pic_free(pic, pic->gc_eph.ready);
+
+  /* stop sampling allocations */
+  pic_heap_profile(pic, 0);
+
   /* free GC arena */
   allocf(pic->userdata, pic->arena, 0);
   allocf(pic->userdata, pic, 0);
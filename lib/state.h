@@ -13,6 +13,30 @@ extern "C" {
 #include "object.h"
 
 KHASH_DECLARE(oblist, struct string *, struct symbol *)
+KHASH_DECLARE(ephemeron, struct object *, int)
+struct prof_sample {
+  int site;                     /* index into sites */
+  size_t count;                 /* samples taken in bytes charged to the object */
+};
+
+KHASH_DECLARE(prof_obj, struct object *, struct prof_sample)
+KHASH_DECLARE(prof_site, const code_t *, int)
+
+struct gc_ephemerons {
+  khash_t(ephemeron) pending;   /* unreached key to its first parked value */
+  struct { pic_value val; int next; } *chain;
+  int nchain, chain_size;
+  pic_value *ready;             /* values whose key has just been reached */
+  int nready, ready_size;
+};
+
+struct heap_profile {
+  size_t interval, countdown;
+  khash_t(prof_obj) objs;       /* sampled object to its samples */
+  khash_t(prof_site) index;     /* pc to site index */
+  const code_t **sites;         /* allocation sites, by pc */
+  int nsites, sites_size;
+};
 
 struct context {
   PIC_JMPBUF jmp;
@@ -27,6 +51,7 @@ struct context {
   code_t tmpcode[2];
   pic_value conts;
   bool reset;
+  bool (*next)(pic_state *, struct context *); /* consulted on halt, see pic_call_each */
 
   struct context *prev;
 };
@@ -47,13 +72,30 @@ struct pic_state {
   bool gc_enable;
   struct object gc_head;
   struct attr *gc_attrs;
-  size_t gc_count;
+  struct gc_ephemerons gc_eph;
+  size_t gc_count;              /* bytes allocated since the last collection */
+  size_t gc_threshold;          /* collect when gc_count exceeds this */
+  size_t gc_live;               /* bytes surviving the last collection */
+  double gc_growth;
+  size_t gc_min, gc_max;
+  struct pic_gc_stats gc_stats;
+  bool gc_log;
+  struct heap_profile *prof;    /* NULL unless sampling allocations */
+#if PIC_GC_THREADS
+  int gc_threads;
+  struct gc_pool *gc_pool;
+#endif
 
   pic_value halt;               /* top continuation */
 
   pic_panicf panicf;
 };
 
+#if PIC_GC_THREADS
+void pic_gc_pool_close(pic_state *);
+#endif
+void pic_prof_sample(pic_state *, struct object *, size_t);
+
 pic_value pic_global_ref(pic_state *pic, pic_value uid);
 void pic_global_set(pic_state *pic, pic_value uid, pic_value value);
 
@@ -114,6 +156,9 @@ void pic_global_set(pic_state *pic, pic_value uid, pic_value value);
 
 void pic_vm(pic_state *pic, struct context *cxt);
 
+typedef bool (*pic_each_t)(pic_state *pic, void *data, pic_value result, pic_value *argv);
+void pic_call_each(pic_state *pic, pic_value proc, int argc, pic_each_t each, void *data);
+
 #if defined(__cplusplus)
 }
 #endif
@@ -5,29 +5,533 @@
 #include <picrin.h>
 #include "value.h"
 #include "object.h"
+#include "state.h"
+
+/*
+ * UTF-8
+ *
+ * Strings are stored as UTF-8. Every leaf is checked when it is made and
+ * malformed input is replaced with U+FFFD on the way in, so the bytes of
+ * a rope are always well formed and can be stepped through by lead bytes
+ * alone. The check skips runs of ASCII a word at a time.
+ */
 
-pic_value
-pic_str_value(pic_state *pic, const char *str, int len)
+#define UTF8_HIGH_BITS (~0ul / 0xff * 0x80)
+
+int
+pic_utf8_width(int lead)
 {
-  char *buf;
-  struct rope_leaf *leaf;
-  struct string *s;
+  lead &= 0xff;
+  if (lead < 0x80)
+    return 1;
+  if (lead < 0xc2)
+    return 0;
+  if (lead < 0xe0)
+    return 2;
+  if (lead < 0xf0)
+    return 3;
+  if (lead < 0xf5)
+    return 4;
+  return 0;
+}
 
-  assert(str != NULL);
+int
+pic_utf8_encode(int c, char *buf)
+{
+  if (c < 0 || c > 0x10ffff || (0xd800 <= c && c < 0xe000)) {
+    c = 0xfffd;
+  }
+  if (c < 0x80) {
+    buf[0] = (char) c;
+    return 1;
+  }
+  if (c < 0x800) {
+    buf[0] = (char) (0xc0 | (c >> 6));
+    buf[1] = (char) (0x80 | (c & 0x3f));
+    return 2;
+  }
+  if (c < 0x10000) {
+    buf[0] = (char) (0xe0 | (c >> 12));
+    buf[1] = (char) (0x80 | ((c >> 6) & 0x3f));
+    buf[2] = (char) (0x80 | (c & 0x3f));
+    return 3;
+  }
+  buf[0] = (char) (0xf0 | (c >> 18));
+  buf[1] = (char) (0x80 | ((c >> 12) & 0x3f));
+  buf[2] = (char) (0x80 | ((c >> 6) & 0x3f));
+  buf[3] = (char) (0x80 | (c & 0x3f));
+  return 4;
+}
+
+int
+pic_utf8_decode(const char *str, int len, int *c)
+{
+  const unsigned char *s = (const unsigned char *) str;
+  int w, i, d, lo = 0x80, hi = 0xbf;
+
+  if ((w = pic_utf8_width(s[0])) <= 1) {
+    *c = w == 1 ? s[0] : 0xfffd;
+    return 1;
+  }
+
+  /* reject overlong forms, surrogates and anything above U+10FFFF at the second byte */
+  switch (s[0]) {
+  case 0xe0: lo = 0xa0; break;
+  case 0xed: hi = 0x9f; break;
+  case 0xf0: lo = 0x90; break;
+  case 0xf4: hi = 0x8f; break;
+  }
+
+  d = s[0] & (0x7f >> w);
+  for (i = 1; i < w; ++i) {
+    if (i >= len || s[i] < lo || s[i] > hi) {
+      *c = 0xfffd;
+      return i;
+    }
+    d = (d << 6) | (s[i] & 0x3f);
+    lo = 0x80;
+    hi = 0xbf;
+  }
+  *c = d;
+  return w;
+}
+
+int
+pic_utf8_ascii_span(const char *s, int len)
+{
+  unsigned long w;
+  int i = 0;
+
+  while (len - i >= (int) sizeof w) {
+    memcpy(&w, s + i, sizeof w);
+    if (w & UTF8_HIGH_BITS)
+      break;
+    i += sizeof w;
+  }
+  while (i < len && (s[i] & 0x80) == 0) {
+    i++;
+  }
+  return i;
+}
+
+/* counts the chars in s, or returns -1 if it is not well formed */
+static int
+utf8_count(const char *s, int len)
+{
+  int i = 0, n = 0, w, c, k;
+
+  while (i < len) {
+    k = pic_utf8_ascii_span(s + i, len - i);
+    i += k;
+    n += k;
+    if (i == len)
+      break;
+    w = pic_utf8_decode(s + i, len - i, &c);
+    if (c == 0xfffd && ! (w == 3 && memcmp(s + i, "\xef\xbf\xbd", 3) == 0))
+      return -1;
+    i += w;
+    n++;
+  }
+  return n;
+}
+
+static char *
+utf8_repair(pic_state *pic, char *buf, int *len, int *nchars)
+{
+  char *fix;
+  int i = 0, j = 0, n = 0, c;
+
+  fix = pic_malloc(pic, (size_t) *len * 3 + 1);
+  while (i < *len) {
+    i += pic_utf8_decode(buf + i, *len - i, &c);
+    j += pic_utf8_encode(c, fix + j);
+    n++;
+  }
+  pic_free(pic, buf);
+  *len = j;
+  *nchars = n;
+  return fix;
+}
+
+/*
+ * Ropes
+ *
+ * Concatenation merges pieces of up to ROPE_SHORT bytes into one flat
+ * leaf, including a short piece appended to (or prepended before) the
+ * short edge leaf of a node, so strings grown by small appends end up
+ * made of ROPE_SHORT-sized leaves. Once a node gets deeper than
+ * ROPE_MAX_DEPTH the rope is rebalanced as in Boehm et al., "Ropes: an
+ * Alternative to Strings": subtrees that are already balanced are kept
+ * whole and only the unbalanced spine above them is rebuilt, so the
+ * depth of every rope stays bounded and walks over it never recurse deeper
+ * than ROPE_MAX_DEPTH.
+ *
+ * Taking a substring of a leaf longer than ROPE_SLICE_MIN does not copy:
+ * the result is a slice leaf pointing into the buffer of its base leaf,
+ * which it keeps alive. Slices are not NUL-terminated; pic_cstr copies
+ * one out into a buffer of its own when it has to.
+ *
+ * Every rope knows both its length in bytes and in chars; indices are
+ * counted in chars. A leaf that is not pure ASCII finds the byte offset
+ * of a char through breadcrumbs, the offsets of every ROPE_CRUMB-th
+ * char, which are recorded the first time they are needed, so that
+ * string-ref and friends cost O(1) amortized.
+ */
+
+#define ROPE_SHORT 64
+#define ROPE_MAX_DEPTH 48
+#define ROPE_SLICE_MIN 256
+#define ROPE_CRUMB 32
+
+static int
+rope_depth(struct rope *rope)
+{
+  return obj_type(rope) == PIC_TYPE_ROPE_LEAF ? 0 : ((struct rope_node *) rope)->depth;
+}
+
+static struct rope *
+rope_leaf(pic_state *pic, char *buf, int len, int nchars)
+{
+  struct rope_leaf *leaf;
 
-  buf = pic_malloc(pic, len + 1);
   buf[len] = 0;
-  memcpy(buf, str, len);
 
   leaf = (struct rope_leaf *) pic_obj_alloc(pic, PIC_TYPE_ROPE_LEAF);
   leaf->len = len;
+  leaf->nchars = nchars;
+  leaf->owned = false;
   leaf->str = buf;
+  leaf->base = NULL;
+  leaf->crumbs = NULL;
+  pic_obj_charge(pic, (struct object *) leaf, len + 1);
+  return (struct rope *) leaf;
+}
+
+/* makes a leaf of bytes that came from outside, taking buf */
+static struct rope *
+rope_import(pic_state *pic, char *buf, int len)
+{
+  int nchars;
+
+  if ((nchars = utf8_count(buf, len)) < 0) {
+    buf = utf8_repair(pic, buf, &len, &nchars);
+  }
+  return rope_leaf(pic, buf, len, nchars);
+}
+
+static int
+leaf_offset(pic_state *pic, struct rope_leaf *leaf, int k)
+{
+  const char *s = leaf->str;
+  int i, off;
+
+  if (leaf->len == leaf->nchars)
+    return k;
+  if (k == leaf->nchars)
+    return leaf->len;
+
+  if (leaf->nchars <= ROPE_CRUMB) {
+    off = 0;
+  } else {
+    if (leaf->crumbs == NULL) {
+      int *crumbs = pic_malloc(pic, sizeof(int) * (leaf->nchars / ROPE_CRUMB + 1));
+      for (i = 0, off = 0; i < leaf->nchars; ++i) {
+        if (i % ROPE_CRUMB == 0) {
+          crumbs[i / ROPE_CRUMB] = off;
+        }
+        off += pic_utf8_width(s[off]);
+      }
+      leaf->crumbs = crumbs;
+    }
+    off = leaf->crumbs[k / ROPE_CRUMB];
+    k %= ROPE_CRUMB;
+  }
+  while (k-- > 0) {
+    off += pic_utf8_width(s[off]);
+  }
+  return off;
+}
+
+static struct rope *
+rope_slice(pic_state *pic, struct rope_leaf *leaf, int i, int j)
+{
+  struct rope_leaf *slice, *base;
+  int bi, bj;
+  char *buf;
+
+  bi = leaf_offset(pic, leaf, i);
+  bj = leaf_offset(pic, leaf, j);
+
+  base = leaf->base != NULL ? leaf->base : leaf;
+
+  if (base->len <= ROPE_SLICE_MIN) {
+    buf = pic_malloc(pic, bj - bi + 1);
+    memcpy(buf, leaf->str + bi, bj - bi);
+    return rope_leaf(pic, buf, bj - bi, j - i);
+  }
+
+  base->owned = false;
+
+  slice = (struct rope_leaf *) pic_obj_alloc(pic, PIC_TYPE_ROPE_LEAF);
+  slice->len = bj - bi;
+  slice->nchars = j - i;
+  slice->owned = false;
+  slice->str = leaf->str + bi;
+  slice->base = base;
+  slice->crumbs = NULL;
+  return (struct rope *) slice;
+}
+
+static struct rope *
+rope_node(pic_state *pic, struct rope *s1, struct rope *s2)
+{
+  struct rope_node *node;
+  int d1 = rope_depth(s1), d2 = rope_depth(s2);
+
+  node = (struct rope_node *) pic_obj_alloc(pic, PIC_TYPE_ROPE_NODE);
+  node->len = s1->len + s2->len;
+  node->nchars = s1->nchars + s2->nchars;
+  node->depth = (d1 > d2 ? d1 : d2) + 1;
+  node->s1 = s1;
+  node->s2 = s2;
+  return (struct rope *) node;
+}
+static void
+rope_flatten(struct rope *rope, char *buf)
+{
+  struct rope *stack[ROPE_MAX_DEPTH + 1];
+  int sp = 0;
+
+  for (;;) {
+    while (obj_type(rope) == PIC_TYPE_ROPE_NODE) {
+      assert(sp <= ROPE_MAX_DEPTH);
+      stack[sp++] = ((struct rope_node *) rope)->s2;
+      rope = ((struct rope_node *) rope)->s1;
+    }
+    memcpy(buf, ((struct rope_leaf *) rope)->str, rope->len);
+    buf += rope->len;
+    if (sp == 0)
+      break;
+    rope = stack[--sp];
+  }
+}
+
+static struct rope *
+rope_merge(pic_state *pic, struct rope *s1, struct rope *s2)
+{
+  char *buf;
+
+  buf = pic_malloc(pic, s1->len + s2->len + 1);
+  rope_flatten(s1, buf);
+  rope_flatten(s2, buf + s1->len);
+  return rope_leaf(pic, buf, s1->len + s2->len, s1->nchars + s2->nchars);
+}
+
+static struct rope *
+rope_join(pic_state *pic, struct rope *s1, struct rope *s2)
+{
+  struct rope_node *node;
+
+  if (s1->len == 0)
+    return s2;
+  if (s2->len == 0)
+    return s1;
+  if (s1->len + s2->len <= ROPE_SHORT) {
+    return rope_merge(pic, s1, s2);
+  }
+  if (s2->len < ROPE_SHORT && obj_type(s1) == PIC_TYPE_ROPE_NODE) {
+    node = (struct rope_node *) s1;
+    if (node->s2->len + s2->len <= ROPE_SHORT) {
+      return rope_node(pic, node->s1, rope_merge(pic, node->s2, s2));
+    }
+  }
+  if (s1->len < ROPE_SHORT && obj_type(s2) == PIC_TYPE_ROPE_NODE) {
+    node = (struct rope_node *) s2;
+    if (s1->len + node->s1->len <= ROPE_SHORT) {
+      return rope_node(pic, rope_merge(pic, s1, node->s1), node->s2);
+    }
+  }
+  return rope_node(pic, s1, s2);
+}
+
+struct rope_forest {
+  int min_len[ROPE_MAX_DEPTH + 2];
+  struct rope *slot[ROPE_MAX_DEPTH + 1];
+};
+
+static void
+rope_forest_add(pic_state *pic, struct rope_forest *f, struct rope *x)
+{
+  struct rope *sum = NULL;
+  int i = 0;
+
+  while (x->len > f->min_len[i + 1]) {
+    if (f->slot[i] != NULL) {
+      sum = sum ? rope_join(pic, f->slot[i], sum) : f->slot[i];
+      f->slot[i] = NULL;
+    }
+    i++;
+  }
+  sum = sum ? rope_join(pic, sum, x) : x;
+  while (sum->len >= f->min_len[i]) {
+    if (f->slot[i] != NULL) {
+      sum = rope_join(pic, f->slot[i], sum);
+      f->slot[i] = NULL;
+    }
+    i++;
+  }
+  f->slot[i - 1] = sum;
+}
+
+static struct rope *
+rope_balance(pic_state *pic, struct rope *rope)
+{
+  struct rope_forest f;
+  struct rope *stack[ROPE_MAX_DEPTH + 2], *sum = NULL;
+  int i, sp = 0;
+
+  f.min_len[0] = 1;
+  f.min_len[1] = 2;
+  for (i = 2; i < ROPE_MAX_DEPTH + 2; ++i) {
+    f.min_len[i] = f.min_len[i - 1] > INT_MAX - f.min_len[i - 2] ? INT_MAX : f.min_len[i - 1] + f.min_len[i - 2];
+  }
+  for (i = 0; i < ROPE_MAX_DEPTH + 1; ++i) {
+    f.slot[i] = NULL;
+  }
+
+  /* add every maximal balanced subtree to the forest, left to right */
+  stack[sp++] = rope;
+  while (sp > 0) {
+    rope = stack[--sp];
+    if (obj_type(rope) == PIC_TYPE_ROPE_NODE && (rope_depth(rope) >= ROPE_MAX_DEPTH || rope->len < f.min_len[rope_depth(rope)])) {
+      stack[sp++] = ((struct rope_node *) rope)->s2;
+      stack[sp++] = ((struct rope_node *) rope)->s1;
+    } else if (rope->len > 0) {
+      rope_forest_add(pic, &f, rope);
+    }
+  }
+
+  for (i = 0; i < ROPE_MAX_DEPTH + 1; ++i) {
+    if (f.slot[i] != NULL) {
+      sum = sum ? rope_join(pic, f.slot[i], sum) : f.slot[i];
+    }
+  }
+  return sum;
+}
+
+static struct rope *
+rope_cat(pic_state *pic, struct rope *s1, struct rope *s2)
+{
+  struct rope *rope = rope_join(pic, s1, s2);
+
+  if (rope_depth(rope) > ROPE_MAX_DEPTH) {
+    rope = rope_balance(pic, rope);
+  }
+  return rope;
+}
+
+static pic_value
+str_value(pic_state *pic, struct rope *rope)
+{
+  struct string *s;
 
   s = (struct string *) pic_obj_alloc(pic, PIC_TYPE_STRING);
-  s->rope = (struct rope *) leaf;
+  s->rope = rope;
+  s->hash = 0;
   return obj_value(pic, s);
 }
 
+/*
+ * Mutation
+ *
+ * A string whose rope is a leaf it alone refers to (leaf->owned) is
+ * written in place. The flag is dropped as soon as the rope is shared
+ * with another string (str_share), and the next write to either string
+ * first copies the contents into a fresh owned leaf.
+ */
+
+static struct rope *
+str_share(pic_state *pic, pic_value str)
+{
+  struct rope *rope = str_ptr(pic, str)->rope;
+
+  if (obj_type(rope) == PIC_TYPE_ROPE_LEAF) {
+    ((struct rope_leaf *) rope)->owned = false;
+  }
+  return rope;
+}
+
+static struct rope_leaf *
+str_own(pic_state *pic, pic_value str, char *buf, int len, int nchars)
+{
+  struct rope_leaf *leaf = (struct rope_leaf *) rope_leaf(pic, buf, len, nchars);
+
+  leaf->owned = true;
+  str_ptr(pic, str)->rope = (struct rope *) leaf;
+  return leaf;
+}
+
+static struct rope_leaf *
+str_mutable(pic_state *pic, pic_value str)
+{
+  struct rope *rope = str_ptr(pic, str)->rope;
+  char *buf;
+
+  str_ptr(pic, str)->hash = 0;
+
+  if (obj_type(rope) == PIC_TYPE_ROPE_LEAF && ((struct rope_leaf *) rope)->owned) {
+    return (struct rope_leaf *) rope;
+  }
+
+  buf = pic_malloc(pic, rope->len + 1);
+  rope_flatten(rope, buf);
+  return str_own(pic, str, buf, rope->len, rope->nchars);
+}
+
+/* makes bytes [i, j) of an owned leaf n bytes long and returns the buffer */
+static char *
+leaf_resize(pic_state *pic, struct rope_leaf *leaf, int i, int j, int n)
+{
+  char *buf;
+
+  if (j - i == n) {
+    return (char *) leaf->str;
+  }
+
+  buf = pic_malloc(pic, leaf->len - (j - i) + n + 1);
+  pic_obj_charge(pic, (struct object *) leaf, leaf->len - (j - i) + n + 1);
+  memcpy(buf, leaf->str, i);
+  memcpy(buf + i + n, leaf->str + j, leaf->len - j);
+  pic_free(pic, (char *) leaf->str);
+  pic_free(pic, leaf->crumbs);
+  leaf->len += n - (j - i);
+  leaf->str = buf;
+  leaf->crumbs = NULL;
+  buf[leaf->len] = 0;
+  return buf;
+}
+
+pic_value
+pic_make_str(pic_state *pic, char *buf, int len)
+{
+  struct rope *rope = rope_import(pic, buf, len);
+
+  ((struct rope_leaf *) rope)->owned = true;
+  return str_value(pic, rope);
+}
+
+pic_value
+pic_str_value(pic_state *pic, const char *str, int len)
+{
+  char *buf;
+
+  assert(str != NULL);
+
+  buf = pic_malloc(pic, len + 1);
+  memcpy(buf, str, len);
+  return pic_make_str(pic, buf, len);
+}
+
 pic_value
 pic_cstr_value(pic_state *pic, const char *cstr)
 {
@@ -70,14 +574,21 @@ pic_vstrf_value(pic_state *pic, const char *fmt, va_list ap)
     str2 = pic_funcall(pic, "number->string", 1, pic_int_value(pic, i));
     break;
   }
+  case 'l': {
+    long i = va_arg(ap, long);
+    if (*p == 'd' || *p == 'i')
+      p++;
+    str2 = pic_funcall(pic, "number->string", 1, pic_int_value(pic, i));
+    break;
+  }
   case 'f': {
     double f = va_arg(ap, double);
     str2 = pic_funcall(pic, "number->string", 1, pic_float_value(pic, f));
     break;
   }
   case 'c': {
-    char c = (char) va_arg(ap, int);
-    str2 = pic_str_value(pic, &c, 1);
+    char c[4];
+    str2 = pic_str_value(pic, c, pic_utf8_encode(va_arg(ap, int), c));
     break;
   }
   case 's': {
@@ -109,71 +620,88 @@ pic_vstrf_value(pic_state *pic, const char *fmt, va_list ap)
 int
 pic_str_len(pic_state *pic, pic_value str)
 {
-  return str_ptr(pic, str)->rope->len;
+  return str_ptr(pic, str)->rope->nchars;
 }
 
 pic_value
 pic_str_cat(pic_state *pic, pic_value a, pic_value b)
 {
-  struct rope *s1 = str_ptr(pic, a)->rope, *s2 = str_ptr(pic, b)->rope;
-  struct rope_node *node;
-  struct string *s;
-
-  node = (struct rope_node *) pic_obj_alloc(pic, PIC_TYPE_ROPE_NODE);
-  node->len = s1->len + s2->len;
-  node->s1 = s1;
-  node->s2 = s2;
-
-  s = (struct string *) pic_obj_alloc(pic, PIC_TYPE_STRING);
-  s->rope = (struct rope *) node;
-  return obj_value(pic, s);
+  return str_value(pic, rope_cat(pic, str_share(pic, a), str_share(pic, b)));
 }
 
-static pic_value
-str_sub(pic_state *pic, struct rope *rope, int i, int j)
+static struct rope *
+rope_sub(pic_state *pic, struct rope *rope, int i, int j)
 {
+  struct rope_node *node;
   int lweight;
-  pic_value s1, s2;
 
-  if (i == 0 && rope->len == j) {
-    return obj_value(pic, rope);
+  if (i == 0 && rope->nchars == j) {
+    return rope;
   }
 
   if (obj_type(rope) == PIC_TYPE_ROPE_LEAF) {
-    return pic_str_value(pic, ((struct rope_leaf *) rope)->str + i, j - i);
+    return rope_slice(pic, (struct rope_leaf *) rope, i, j);
   }
 
-  lweight = ((struct rope_node *) rope)->s1->len;
+  node = (struct rope_node *) rope;
+  lweight = node->s1->nchars;
 
   if (j <= lweight) {
-    return str_sub(pic, ((struct rope_node *) rope)->s1, i, j);
+    return rope_sub(pic, node->s1, i, j);
   }
   if (lweight <= i) {
-    return str_sub(pic, ((struct rope_node *) rope)->s2, i - lweight, j - lweight);
+    return rope_sub(pic, node->s2, i - lweight, j - lweight);
   }
-
-  s1 = str_sub(pic, ((struct rope_node *) rope)->s1, i, lweight);
-  s2 = str_sub(pic, ((struct rope_node *) rope)->s2, 0, j - lweight);
-  return pic_str_cat(pic, s1, s2);
+  return rope_cat(pic, rope_sub(pic, node->s1, i, lweight), rope_sub(pic, node->s2, 0, j - lweight));
 }
 
 pic_value
 pic_str_sub(pic_state *pic, pic_value str, int s, int e)
 {
-  return str_sub(pic, str_ptr(pic, str)->rope, s, e);
+  return str_value(pic, rope_sub(pic, str_share(pic, str), s, e));
+}
+
+static unsigned
+hash_bytes(unsigned h, const char *s, int len)
+{
+  while (len-- > 0) {
+    h = (h << 5) - h + (unsigned char) *s++;
+  }
+  return h;
+}
+
+static unsigned
+rope_hash(unsigned h, struct rope *rope)
+{
+  while (obj_type(rope) == PIC_TYPE_ROPE_NODE) {
+    h = rope_hash(h, ((struct rope_node *) rope)->s1);
+    rope = ((struct rope_node *) rope)->s2;
+  }
+  return hash_bytes(h, ((struct rope_leaf *) rope)->str, rope->len);
+}
+
+/* 0 is left to mean "not computed yet" */
+#define HASH_NONZERO(h) ((h) == 0 ? 1 : (int) (h))
+
+int
+pic_str_hash_buf(const char *str, int len)
+{
+  unsigned h = hash_bytes(0, str, len);
+
+  return HASH_NONZERO(h);
 }
 
 int
 pic_str_hash(pic_state *pic, pic_value str)
 {
-  int len, h = 0;
-  const char *s;
+  struct string *s = str_ptr(pic, str);
+  unsigned h;
 
-  s = pic_str(pic, str, &len);
-  while (len-- > 0) {
-    h = (h << 5) - h + *s++;
+  if (s->hash == 0) {
+    h = rope_hash(0, s->rope);
+    s->hash = HASH_NONZERO(h);
   }
-  return h;
+  return s->hash;
 }
 
 int
@@ -195,24 +723,11 @@ pic_str_cmp(pic_state *pic, pic_value str1, pic_value str2)
   return len1 - len2;
 }
 
-static void
-str_cstr(pic_state *pic, struct rope *rope, char *buf)
-{
-  if (obj_type(rope) == PIC_TYPE_ROPE_LEAF) {
-    memcpy(buf, ((struct rope_leaf *) rope)->str, rope->len);
-  } else {
-    struct rope_node *r = (struct rope_node *) rope;
-    str_cstr(pic, r->s1, buf);
-    str_cstr(pic, r->s2, buf + r->s1->len);
-  }
-}
-
 const char *
 pic_str(pic_state *pic, pic_value str, int *len)
 {
   struct rope *rope = str_ptr(pic, str)->rope;
   char *buf;
-  struct rope_leaf *leaf;
 
   if (len) {
     *len = rope->len;
@@ -223,15 +738,10 @@ pic_str(pic_state *pic, pic_value str, int *len)
   }
 
   buf = pic_malloc(pic, rope->len + 1);
-  buf[rope->len] = 0;
-  str_cstr(pic, rope, buf);
-
-  leaf = (struct rope_leaf *) pic_obj_alloc(pic, PIC_TYPE_ROPE_LEAF);
-  leaf->len = rope->len;
-  leaf->str = buf;
+  rope_flatten(rope, buf);
 
   /* cache the result */
-  str_ptr(pic, str)->rope = (struct rope *) leaf;
+  str_own(pic, str, buf, rope->len, rope->nchars);
 
   return buf;
 }
@@ -239,10 +749,22 @@ pic_str(pic_state *pic, pic_value str, int *len)
 const char *
 pic_cstr(pic_state *pic, pic_value str, int *len)
 {
+  struct rope_leaf *leaf;
   const char *buf;
+  char *copy;
   int l;
 
   buf = pic_str(pic, str, &l);
+  if (buf[l] != '\0') {
+    /* a slice: give it a terminated buffer of its own */
+    leaf = (struct rope_leaf *) str_ptr(pic, str)->rope;
+    copy = pic_malloc(pic, l + 1);
+    pic_obj_charge(pic, (struct object *) leaf, l + 1);
+    memcpy(copy, buf, l);
+    copy[l] = '\0';
+    leaf->str = buf = copy;
+    leaf->base = NULL;
+  }
   if (strchr(buf, '\0') != buf + l) {
     pic_error(pic, "casting scheme string containing null character to c string", 1, str);
   }
@@ -252,6 +774,24 @@ pic_cstr(pic_state *pic, pic_value str, int *len)
   return buf;
 }
 
+static struct rope_leaf *
+str_leaf(pic_state *pic, pic_value str)
+{
+  pic_str(pic, str, NULL);      /* flattens */
+  return (struct rope_leaf *) str_ptr(pic, str)->rope;
+}
+
+static int
+str_ref(pic_state *pic, pic_value str, int k)
+{
+  struct rope_leaf *leaf = str_leaf(pic, str);
+  int off, c;
+
+  off = leaf_offset(pic, leaf, k);
+  pic_utf8_decode(leaf->str + off, leaf->len - off, &c);
+  return c;
+}
+
 static pic_value
 pic_str_string_p(pic_state *pic)
 {
@@ -265,28 +805,27 @@ pic_str_string_p(pic_state *pic)
 static pic_value
 pic_str_string(pic_state *pic)
 {
-  int argc, i;
+  int argc, i, len = 0;
   pic_value *argv;
   char *buf;
 
   pic_get_args(pic, "*", &argc, &argv);
 
-  buf = pic_alloca(pic, argc);
+  buf = pic_alloca(pic, argc * 4);
 
   for (i = 0; i < argc; ++i) {
     TYPE_CHECK(pic, argv[i], char);
-    buf[i] = pic_char(pic, argv[i]);
+    len += pic_utf8_encode(pic_char(pic, argv[i]), buf + len);
   }
 
-  return pic_str_value(pic, buf, argc);
+  return pic_str_value(pic, buf, len);
 }
 
 static pic_value
 pic_str_make_string(pic_state *pic)
 {
-  int len;
-  char c = ' ';
-  char *buf;
+  int len, c = ' ', w, i;
+  char u[4], *buf;
 
   pic_get_args(pic, "i|c", &len, &c);
 
@@ -294,11 +833,21 @@ pic_str_make_string(pic_state *pic)
     pic_error(pic, "make-string: negative length given", 1, pic_int_value(pic, len));
   }
 
-  buf = pic_alloca(pic, len);
+  w = pic_utf8_encode(c, u);
+  if (len > (INT_MAX - 1) / w) {
+    pic_error(pic, "make-string: length too large", 1, pic_int_value(pic, len));
+  }
 
-  memset(buf, c, len);
+  buf = pic_malloc(pic, len * w + 1);
+  if (w == 1) {
+    memset(buf, c, len);
+  } else {
+    for (i = 0; i < len; ++i) {
+      memcpy(buf + i * w, u, w);
+    }
+  }
 
-  return pic_str_value(pic, buf, len);
+  return pic_make_str(pic, buf, len * w);
 }
 
 static pic_value
@@ -321,28 +870,25 @@ pic_str_string_ref(pic_state *pic)
 
   VALID_INDEX(pic, pic_str_len(pic, str), k);
 
-  return pic_char_value(pic, pic_str(pic, str, 0)[k]);
+  return pic_char_value(pic, str_ref(pic, str, k));
 }
 
 static pic_value
 pic_str_string_set(pic_state *pic)
 {
-  pic_value str, x, y, z, w;
-  char c;
-  int k, len;
+  pic_value str;
+  struct rope_leaf *leaf;
+  char u[4];
+  int k, c, w, off;
 
   pic_get_args(pic, "sic", &str, &k, &c);
 
-  len = pic_str_len(pic, str);
-
-  VALID_INDEX(pic, len, k);
-
-  x = pic_str_sub(pic, str, 0, k);
-  y = pic_str_value(pic, &c, 1);
-  z = pic_str_sub(pic, str, k + 1, len);
-  w = pic_str_cat(pic, x, pic_str_cat(pic, y, z));
+  VALID_INDEX(pic, pic_str_len(pic, str), k);
 
-  str_ptr(pic, str)->rope = str_ptr(pic, w)->rope;
+  leaf = str_mutable(pic, str);
+  off = leaf_offset(pic, leaf, k);
+  w = pic_utf8_encode(c, u);
+  memcpy(leaf_resize(pic, leaf, off, off + pic_utf8_width(leaf->str[off]), w) + off, u, w);
 
   return pic_undef_value(pic);
 }
@@ -402,8 +948,10 @@ pic_str_string_copy(pic_state *pic)
 static pic_value
 pic_str_string_copy_ip(pic_state *pic)
 {
-  pic_value to, from, x, y, z, w;
-  int n, at, start, end, tolen, fromlen;
+  pic_value to, from;
+  struct rope_leaf *leaf, *src;
+  int n, at, start, end, tolen, fromlen, i, j, si, sj;
+  char *tmp;
 
   n = pic_get_args(pic, "sis|ii", &to, &at, &from, &start, &end);
 
@@ -419,12 +967,22 @@ pic_str_string_copy_ip(pic_state *pic)
 
   VALID_ATRANGE(pic, tolen, at, fromlen, start, end);
 
-  x = pic_str_sub(pic, to, 0, at);
-  y = pic_str_sub(pic, from, start, end);
-  z = pic_str_sub(pic, to, at + end - start, tolen);
-  w = pic_str_cat(pic, x, pic_str_cat(pic, y, z));
+  leaf = str_mutable(pic, to);
+  src = str_leaf(pic, from);   /* the same leaf if to and from are one string */
+  i = leaf_offset(pic, leaf, at);
+  j = leaf_offset(pic, leaf, at + end - start);
+  si = leaf_offset(pic, src, start);
+  sj = leaf_offset(pic, src, end);
 
-  str_ptr(pic, to)->rope = str_ptr(pic, w)->rope;
+  if (j - i == sj - si) {
+    memmove((char *) leaf->str + i, src->str + si, sj - si);
+  } else {
+    /* resizing frees the old buffer, which the source may live in */
+    tmp = pic_malloc(pic, sj - si);
+    memcpy(tmp, src->str + si, sj - si);
+    memcpy(leaf_resize(pic, leaf, i, j, sj - si) + i, tmp, sj - si);
+    pic_free(pic, tmp);
+  }
 
   return pic_undef_value(pic);
 }
@@ -432,9 +990,10 @@ pic_str_string_copy_ip(pic_state *pic)
 static pic_value
 pic_str_string_fill_ip(pic_state *pic)
 {
-  pic_value str, x, y, z, w;
-  char c, *buf;
-  int n, start, end, len;
+  pic_value str;
+  struct rope_leaf *leaf;
+  char u[4], *buf;
+  int n, c, w, start, end, len, i, j;
 
   n = pic_get_args(pic, "sc|ii", &str, &c, &start, &end);
 
@@ -449,15 +1008,18 @@ pic_str_string_fill_ip(pic_state *pic)
 
   VALID_RANGE(pic, len, start, end);
 
-  buf = pic_alloca(pic, end - start);
-  memset(buf, c, end - start);
-
-  x = pic_str_sub(pic, str, 0, start);
-  y = pic_str_value(pic, buf, end - start);
-  z = pic_str_sub(pic, str, end, len);
-  w = pic_str_cat(pic, x, pic_str_cat(pic, y, z));
-
-  str_ptr(pic, str)->rope = str_ptr(pic, w)->rope;
+  leaf = str_mutable(pic, str);
+  i = leaf_offset(pic, leaf, start);
+  j = leaf_offset(pic, leaf, end);
+  w = pic_utf8_encode(c, u);
+  buf = leaf_resize(pic, leaf, i, j, (end - start) * w);
+  if (w == 1) {
+    memset(buf + i, c, end - start);
+  } else {
+    for (; start < end; ++start, i += w) {
+      memcpy(buf + i, u, w);
+    }
+  }
 
   return pic_undef_value(pic);
 }
@@ -478,72 +1040,84 @@ pic_str_string_append(pic_state *pic)
   return str;
 }
 
-static pic_value
-pic_str_string_map(pic_state *pic)
-{
-  pic_value proc, *argv, vals, val;
-  int argc, i, len, j;
+/* feeds string-map and string-for-each, encoding results into buf unless it is NULL */
+struct str_each {
+  pic_value *strs;
+  int n, i, len, pos;
   char *buf;
+};
 
-  pic_get_args(pic, "l*", &proc, &argc, &argv);
+static bool
+str_each(pic_state *pic, void *data, pic_value result, pic_value *argv)
+{
+  struct str_each *e = data;
+  int j;
 
-  if (argc == 0) {
-    pic_error(pic, "string-map: one or more strings expected, but got zero", 0);
+  if (e->i > 0 && e->buf != NULL) {
+    TYPE_CHECK(pic, result, char);
+    e->pos += pic_utf8_encode(pic_char(pic, result), e->buf + e->pos);
+  }
+  if (e->i == e->len) {
+    return false;
+  }
+  for (j = 0; j < e->n; ++j) {
+    argv[j] = pic_char_value(pic, str_ref(pic, e->strs[j], e->i));
   }
+  e->i++;
+  return true;
+}
+
+static void
+str_each_init(pic_state *pic, struct str_each *e, int argc, pic_value *argv)
+{
+  int i, l;
 
-  len = INT_MAX;
+  e->strs = argv;
+  e->n = argc;
+  e->i = e->pos = 0;
+  e->len = INT_MAX;
   for (i = 0; i < argc; ++i) {
-    int l;
     TYPE_CHECK(pic, argv[i], str);
     l = pic_str_len(pic, argv[i]);
-    len = len < l ? len : l;
+    e->len = e->len < l ? e->len : l;
   }
+}
 
-  buf = pic_alloca(pic, len);
-
-  for (i = 0; i < len; ++i) {
-    vals = pic_nil_value(pic);
-    for (j = 0; j < argc; ++j) {
-      pic_push(pic, pic_char_value(pic, pic_str(pic, argv[j], 0)[i]), vals);
-    }
-    vals = pic_reverse(pic, vals);
-    val = pic_funcall(pic, "apply", 2, proc, vals);
+static pic_value
+pic_str_string_map(pic_state *pic)
+{
+  pic_value proc, *argv;
+  int argc;
+  struct str_each e;
 
-    TYPE_CHECK(pic, val, char);
+  pic_get_args(pic, "l*", &proc, &argc, &argv);
 
-    buf[i] = pic_char(pic, val);
+  if (argc == 0) {
+    pic_error(pic, "string-map: one or more strings expected, but got zero", 0);
   }
-  return pic_str_value(pic, buf, len);
+
+  str_each_init(pic, &e, argc, argv);
+  e.buf = pic_alloca(pic, (size_t) e.len * 4);
+  pic_call_each(pic, proc, argc, str_each, &e);
+  return pic_str_value(pic, e.buf, e.pos);
 }
 
 static pic_value
 pic_str_string_for_each(pic_state *pic)
 {
-  pic_value proc, *argv, vals;
-  int argc, i, len, j;
+  pic_value proc, *argv;
+  int argc;
+  struct str_each e;
 
   pic_get_args(pic, "l*", &proc, &argc, &argv);
 
   if (argc == 0) {
-    pic_error(pic, "string-map: one or more strings expected, but got zero", 0);
-  }
-
-  len = INT_MAX;
-  for (i = 0; i < argc; ++i) {
-    int l;
-    TYPE_CHECK(pic, argv[i], str);
-    l = pic_str_len(pic, argv[i]);
-    len = len < l ? len : l;
+    pic_error(pic, "string-for-each: one or more strings expected, but got zero", 0);
   }
 
-  for (i = 0; i < len; ++i) {
-    vals = pic_nil_value(pic);
-    for (j = 0; j < argc; ++j) {
-      pic_push(pic, pic_char_value(pic, pic_str(pic, argv[j], 0)[i]), vals);
-    }
-    vals = pic_reverse(pic, vals);
-    pic_funcall(pic, "apply", 2, proc, vals);
-  }
+  str_each_init(pic, &e, argc, argv);
+  e.buf = NULL;
+  pic_call_each(pic, proc, argc, str_each, &e);
   return pic_undef_value(pic);
 }
 
@@ -556,13 +1130,13 @@ pic_str_list_to_string(pic_state *pic)
 
   pic_get_args(pic, "o", &list);
 
-  buf = pic_alloca(pic, pic_length(pic, list));
+  buf = pic_alloca(pic, (size_t) pic_length(pic, list) * 4);
 
   i = 0;
   pic_for_each (e, list, it) {
     TYPE_CHECK(pic, e, char);
 
-    buf[i++] = pic_char(pic, e);
+    i += pic_utf8_encode(pic_char(pic, e), buf + i);
   }
 
   return pic_str_value(pic, buf, i);
@@ -572,7 +1146,8 @@ static pic_value
 pic_str_string_to_list(pic_state *pic)
 {
   pic_value str, list;
-  int n, start, end, len, i;
+  struct rope_leaf *leaf;
+  int n, start, end, len, i, off, c;
 
   n = pic_get_args(pic, "s|ii", &str, &start, &end);
 
@@ -587,13 +1162,349 @@ pic_str_string_to_list(pic_state *pic)
 
   VALID_RANGE(pic, len, start, end);
 
+  leaf = str_leaf(pic, str);
+  off = leaf_offset(pic, leaf, start);
+
   list = pic_nil_value(pic);
   for (i = start; i < end; ++i) {
-    pic_push(pic, pic_char_value(pic, pic_str(pic, str, 0)[i]), list);
+    off += pic_utf8_decode(leaf->str + off, leaf->len - off, &c);
+    pic_push(pic, pic_char_value(pic, c), list);
+  }
+  return pic_reverse(pic, list);
+}
+
+static pic_value
+pic_str_utf8_to_string(pic_state *pic)
+{
+  unsigned char *buf;
+  int n, start, end, len;
+
+  n = pic_get_args(pic, "b|ii", &buf, &len, &start, &end);
+
+  switch (n) {
+  case 1:
+    start = 0;
+  case 2:
+    end = len;
+  }
+
+  VALID_RANGE(pic, len, start, end);
+
+  return pic_str_value(pic, (const char *) buf + start, end - start);
+}
+
+static pic_value
+pic_str_string_to_utf8(pic_state *pic)
+{
+  pic_value str;
+  struct rope_leaf *leaf;
+  int n, start, end, len, i, j;
+
+  n = pic_get_args(pic, "s|ii", &str, &start, &end);
+
+  len = pic_str_len(pic, str);
+
+  switch (n) {
+  case 1:
+    start = 0;
+  case 2:
+    end = len;
+  }
+
+  VALID_RANGE(pic, len, start, end);
+
+  leaf = str_leaf(pic, str);
+  i = leaf_offset(pic, leaf, start);
+  j = leaf_offset(pic, leaf, end);
+
+  return pic_blob_value(pic, (const unsigned char *) leaf->str + i, j - i);
+}
+
+/*
+ * Searching
+ *
+ * Patterns are matched byte for byte against the UTF-8 text: a pattern
+ * begins with a lead byte, so a match always starts on a char boundary.
+ * Each leaf of the haystack is scanned in place, with memchr for short
+ * patterns and Horspool's algorithm for longer ones. The last m - 1
+ * bytes seen are kept in a small window, joined with the head of the
+ * next leaf, to catch matches that straddle leaves, so the haystack is
+ * never flattened.
+ */
+
+#define SEARCH_HORSPOOL_MIN 3
+
+static int
+count_chars(const char *s, int n)
+{
+  int i, k = 0;
+
+  for (i = 0; i < n; ++i) {
+    k += (s[i] & 0xc0) != 0x80;
+  }
+  return k;
+}
+
+static int
+search_bytes(const char *hay, int n, const char *pat, int m, const int *skip)
+{
+  const char *p, *end = hay + n - m + 1;
+  int i, last = m - 1;
+
+  if (n < m) {
+    return -1;
+  }
+  if (m < SEARCH_HORSPOOL_MIN) {
+    for (p = hay; p < end && (p = memchr(p, pat[0], end - p)) != NULL; ++p) {
+      if (memcmp(p, pat, m) == 0)
+        return (int) (p - hay);
+    }
+    return -1;
+  }
+  for (i = 0; i <= n - m; i += skip[(unsigned char) hay[i + last]]) {
+    if (hay[i + last] == pat[last] && memcmp(hay + i, pat, last) == 0)
+      return i;
+  }
+  return -1;
+}
+
+/* char indices of at most max matches of pat in rope, in order */
+static pic_value
+rope_search(pic_state *pic, struct rope *rope, const char *pat, int m, int max, bool overlap)
+{
+  struct rope *stack[ROPE_MAX_DEPTH + 1];
+  struct rope_leaf *leaf;
+  int skip[256], i, j, n, at, sp = 0, tail = 0, found = 0;
+  int base = 0, chars = 0, next = 0, cur, curchars;
+  char *win;
+  pic_value list = pic_nil_value(pic);
+
+  assert(m > 0);
+
+  for (i = 0; i < 256; ++i) {
+    skip[i] = m;
+  }
+  for (i = 0; i < m - 1; ++i) {
+    skip[(unsigned char) pat[i]] = m - 1 - i;
+  }
+  win = pic_alloca(pic, 2 * m);
+
+  while (found < max) {
+    while (obj_type(rope) == PIC_TYPE_ROPE_NODE) {
+      stack[sp++] = ((struct rope_node *) rope)->s2;
+      rope = ((struct rope_node *) rope)->s1;
+    }
+    leaf = (struct rope_leaf *) rope;
+    n = leaf->len;
+
+    /* matches that begin in the window of earlier bytes */
+    if (tail > 0) {
+      j = n < m - 1 ? n : m - 1;
+      memcpy(win + tail, leaf->str, j);
+      for (i = 0; found < max && i < tail; i = at + 1) {
+        if ((at = search_bytes(win + i, tail + j - i, pat, m, skip)) < 0 || (at += i) >= tail)
+          break;
+        if (base - tail + at < next)
+          continue;
+        pic_push(pic, pic_int_value(pic, chars - count_chars(win + at, tail - at)), list);
+        found++;
+        next = base - tail + at + (overlap ? 1 : m);
+      }
+    }
+
+    /* matches within the leaf */
+    cur = curchars = 0;
+    for (i = next > base ? next - base : 0; found < max && i < n; i = next - base) {
+      if ((at = search_bytes(leaf->str + i, n - i, pat, m, skip)) < 0)
+        break;
+      at += i;
+      curchars += leaf->len == leaf->nchars ? at - cur : count_chars(leaf->str + cur, at - cur);
+      cur = at;
+      pic_push(pic, pic_int_value(pic, chars + curchars), list);
+      found++;
+      next = base + at + (overlap ? 1 : m);
+    }
+
+    /* keep the last m - 1 bytes for the next leaf */
+    if (n >= m - 1) {
+      tail = m - 1;
+      memcpy(win, leaf->str + n - tail, tail);
+    } else {
+      j = tail + n > m - 1 ? tail + n - (m - 1) : 0;
+      memmove(win, win + j, tail - j);
+      memcpy(win + tail - j, leaf->str, n);
+      tail = tail - j + n;
+    }
+    base += n;
+    chars += leaf->nchars;
+
+    if (sp == 0)
+      break;
+    rope = stack[--sp];
   }
   return pic_reverse(pic, list);
 }
 
+static pic_value
+str_search(pic_state *pic, pic_value str, int start, int end, const char *pat, int m, int max, bool overlap)
+{
+  pic_value list, it;
+
+  if (m == 0) {
+    /* the empty pattern matches at every index */
+    list = pic_nil_value(pic);
+    for (; start <= end && max-- > 0; ++start) {
+      pic_push(pic, pic_int_value(pic, start), list);
+    }
+    return pic_reverse(pic, list);
+  }
+  list = rope_search(pic, rope_sub(pic, str_share(pic, str), start, end), pat, m, max, overlap);
+  if (start != 0) {
+    for (it = list; ! pic_nil_p(pic, it); it = pic_cdr(pic, it)) {
+      pic_set_car(pic, it, pic_int_value(pic, pic_int(pic, pic_car(pic, it)) + start));
+    }
+  }
+  return list;
+}
+
+static pic_value
+pic_str_string_index(pic_state *pic)
+{
+  pic_value str, pred, list;
+  int n, start, end, len, i, w;
+  char u[4];
+
+  n = pic_get_args(pic, "so|ii", &str, &pred, &start, &end);
+
+  len = pic_str_len(pic, str);
+
+  switch (n) {
+  case 2:
+    start = 0;
+  case 3:
+    end = len;
+  }
+
+  VALID_RANGE(pic, len, start, end);
+
+  if (pic_char_p(pic, pred)) {
+    w = pic_utf8_encode(pic_char(pic, pred), u);
+    list = str_search(pic, str, start, end, u, w, 1, false);
+    return pic_nil_p(pic, list) ? pic_false_value(pic) : pic_car(pic, list);
+  }
+
+  TYPE_CHECK(pic, pred, proc);
+
+  for (i = start; i < end; ++i) {
+    if (! pic_false_p(pic, pic_call(pic, pred, 1, pic_char_value(pic, str_ref(pic, str, i))))) {
+      return pic_int_value(pic, i);
+    }
+  }
+  return pic_false_value(pic);
+}
+
+static pic_value
+pic_str_string_contains(pic_state *pic)
+{
+  pic_value str, pat, list;
+  const char *buf;
+  int n, start, end, len, m;
+
+  n = pic_get_args(pic, "ss|ii", &str, &pat, &start, &end);
+
+  len = pic_str_len(pic, str);
+
+  switch (n) {
+  case 2:
+    start = 0;
+  case 3:
+    end = len;
+  }
+
+  VALID_RANGE(pic, len, start, end);
+
+  buf = pic_str(pic, pat, &m);
+  list = str_search(pic, str, start, end, buf, m, 1, false);
+  return pic_nil_p(pic, list) ? pic_false_value(pic) : pic_car(pic, list);
+}
+
+static pic_value
+pic_str_string_search_forward(pic_state *pic)
+{
+  pic_value pat, str, list;
+  const char *buf;
+  int start = 0, len, m;
+
+  pic_get_args(pic, "ss|i", &pat, &str, &start);
+
+  len = pic_str_len(pic, str);
+
+  VALID_RANGE(pic, len, start, len);
+
+  buf = pic_str(pic, pat, &m);
+  list = str_search(pic, str, start, len, buf, m, 1, false);
+  return pic_nil_p(pic, list) ? pic_false_value(pic) : pic_car(pic, list);
+}
+
+static pic_value
+pic_str_string_search_all(pic_state *pic)
+{
+  pic_value pat, str;
+  const char *buf;
+  int n, start, end, len, m;
+
+  n = pic_get_args(pic, "ss|ii", &pat, &str, &start, &end);
+
+  len = pic_str_len(pic, str);
+
+  switch (n) {
+  case 2:
+    start = 0;
+  case 3:
+    end = len;
+  }
+
+  VALID_RANGE(pic, len, start, end);
+
+  buf = pic_str(pic, pat, &m);
+  return str_search(pic, str, start, end, buf, m, INT_MAX, true);
+}
+
+static pic_value
+pic_str_string_split(pic_state *pic)
+{
+  pic_value str, delim, list, result, e, it;
+  const char *buf;
+  char u[4];
+  int m, d, i;
+
+  pic_get_args(pic, "so", &str, &delim);
+
+  if (pic_char_p(pic, delim)) {
+    m = pic_utf8_encode(pic_char(pic, delim), u);
+    buf = u;
+    d = 1;
+  } else {
+    TYPE_CHECK(pic, delim, str);
+    buf = pic_str(pic, delim, &m);
+    d = pic_str_len(pic, delim);
+    if (m == 0) {
+      pic_error(pic, "string-split: empty delimiter", 0);
+    }
+  }
+
+  list = str_search(pic, str, 0, pic_str_len(pic, str), buf, m, INT_MAX, false);
+
+  result = pic_nil_value(pic);
+  i = 0;
+  pic_for_each (e, list, it) {
+    pic_push(pic, pic_str_sub(pic, str, i, pic_int(pic, e)), result);
+    i = pic_int(pic, e) + d;
+  }
+  pic_push(pic, pic_str_sub(pic, str, i, pic_str_len(pic, str)), result);
+  return pic_reverse(pic, result);
+}
+
 void
 pic_init_str(pic_state *pic)
 {
@@ -611,6 +1522,13 @@ pic_init_str(pic_state *pic)
   pic_defun(pic, "string-for-each", pic_str_string_for_each);
   pic_defun(pic, "list->string", pic_str_list_to_string);
   pic_defun(pic, "string->list", pic_str_string_to_list);
+  pic_defun(pic, "utf8->string", pic_str_utf8_to_string);
+  pic_defun(pic, "string->utf8", pic_str_string_to_utf8);
+  pic_defun(pic, "string-index", pic_str_string_index);
+  pic_defun(pic, "string-contains", pic_str_string_contains);
+  pic_defun(pic, "string-search-forward", pic_str_string_search_forward);
+  pic_defun(pic, "string-search-all", pic_str_string_search_all);
+  pic_defun(pic, "string-split", pic_str_string_split);
 
   pic_defun(pic, "string=?", pic_str_string_eq);
   pic_defun(pic, "string<?", pic_str_string_lt);
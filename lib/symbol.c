@@ -7,36 +7,111 @@
 #include "object.h"
 #include "state.h"
 
-/* FIXME: arena is consumed every time hash/cmp is executed */
-#define kh_pic_str_hash(a) (pic_str_hash(pic, obj_value(pic, (a))))
-#define kh_pic_str_equal(a,b) (pic_str_cmp(pic, obj_value(pic, (a)), obj_value(pic, (b))) == 0)
+/*
+ * Names in the oblist are private flat strings whose hash is filled in on
+ * insertion, so probing neither allocates nor rehashes them. A symbol can
+ * also be looked up by a borrowed buffer (struct oblist_key).
+ */
+
+struct oblist_key {
+  const char *str;
+  int len;
+  int hash;
+};
+
+#define oblist_leaf(s) ((struct rope_leaf *) (s)->rope)
+#define oblist_name_eq(s, buf, n) (oblist_leaf(s)->len == (n) && memcmp(oblist_leaf(s)->str, (buf), (n)) == 0)
+
+#define kh_pic_str_hash(a) ((a)->hash)
+#define kh_pic_str_equal(a,b) oblist_name_eq(a, oblist_leaf(b)->str, oblist_leaf(b)->len)
+#define kh_oblist_key_hash(k) ((k).hash)
+#define kh_oblist_key_equal(a,k) oblist_name_eq(a, (k).str, (k).len)
 
 KHASH_DEFINE(oblist, struct string *, struct symbol *, kh_pic_str_hash, kh_pic_str_equal)
+KHASH_DEFINE_LOOKUP(oblist, struct oblist_key, kh_oblist_key_hash, kh_oblist_key_equal)
 
-pic_value
-pic_intern(pic_state *pic, pic_value str)
+static pic_value
+oblist_get(pic_state *pic, const char *str, int len, int hash)
 {
   khash_t(oblist) *h = &pic->oblist;
+  struct oblist_key key;
   struct symbol *sym;
   int it;
-  int ret;
 
-  it = kh_put(oblist, h, str_ptr(pic, str), &ret);
-  if (ret == 0) {               /* if exists */
-    sym = kh_val(h, it);
-    pic_protect(pic, obj_value(pic, sym));
-    return obj_value(pic, sym);
+  key.str = str;
+  key.len = len;
+  key.hash = hash;
+
+  it = kh_lookup(oblist, h, key);
+  if (it == kh_end(h)) {
+    return pic_false_value(pic);
   }
+  sym = kh_val(h, it);
+  pic_protect(pic, obj_value(pic, sym));
+  return obj_value(pic, sym);
+}
+
+/* name must be a fresh string that no one else refers to */
+static pic_value
+oblist_add(pic_state *pic, pic_value name, int hash)
+{
+  struct string *str = str_ptr(pic, name);
+  struct symbol *sym;
+  int it, ret;
 
-  kh_val(h, it) = NULL;         /* dummy */
+  str->hash = hash;
+  /* string-set! on what pic_sym_name returns must not rename the symbol */
+  oblist_leaf(str)->owned = false;
 
   sym = (struct symbol *)pic_obj_alloc(pic, PIC_TYPE_SYMBOL);
-  sym->str = str_ptr(pic, str);
-  kh_val(h, it) = sym;
+  sym->str = str;
+
+  it = kh_put(oblist, &pic->oblist, str, &ret);
+  kh_val(&pic->oblist, it) = sym;
 
   return obj_value(pic, sym);
 }
 
+pic_value
+pic_intern(pic_state *pic, pic_value str)
+{
+  const char *buf;
+  pic_value sym;
+  int len, hash;
+
+  buf = pic_str(pic, str, &len);
+  hash = pic_str_hash(pic, str);
+
+  sym = oblist_get(pic, buf, len, hash);
+  if (! pic_false_p(pic, sym)) {
+    return sym;
+  }
+  return oblist_add(pic, pic_str_value(pic, buf, len), hash);
+}
+
+pic_value
+pic_intern_str(pic_state *pic, const char *str, int len)
+{
+  const char *buf;
+  pic_value sym, name;
+  int l, hash;
+
+  hash = pic_str_hash_buf(str, len);
+
+  sym = oblist_get(pic, str, len, hash);
+  if (! pic_false_p(pic, sym)) {
+    return sym;
+  }
+
+  name = pic_str_value(pic, str, len);
+  buf = pic_str(pic, name, &l);
+  if (l != len || memcmp(buf, str, len) != 0) {
+    /* malformed UTF-8 was repaired, so the name may exist after all */
+    return pic_intern(pic, name);
+  }
+  return oblist_add(pic, name, hash);
+}
+
 pic_value
 pic_sym_name(pic_state *pic, pic_value sym)
 {
@@ -75,11 +150,12 @@ pic_symbol_symbol_eq_p(pic_state *pic)
 static pic_value
 pic_symbol_symbol_to_string(pic_state *pic)
 {
-  pic_value sym;
+  pic_value sym, str;
 
   pic_get_args(pic, "m", &sym);
 
-  return pic_sym_name(pic, sym);
+  str = pic_sym_name(pic, sym);
+  return pic_str_sub(pic, str, 0, pic_str_len(pic, str));
 }
 
 static pic_value
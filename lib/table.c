@@ -0,0 +1,887 @@
+/**
+ * See Copyright Notice in picrin.h
+ */
+
+#include <picrin.h>
+#include "value.h"
+#include "object.h"
+#include "state.h"
+
+#define TABLE_MIN_CAP 8
+#define TABLE_CLEAR 32          /* slots of the next array cleared per insertion */
+#define TABLE_MIGRATE 8         /* old slots moved per insertion */
+#define HASH_BUDGET 64          /* nodes of a structure that equal-hash looks at */
+
+#define HASH_MIX(h, x) (((h) ^ (unsigned long) (x)) * 0x01000193ul)
+
+static unsigned long
+hash_bytes(unsigned long h, const void *ptr, size_t len)
+{
+  const unsigned char *p = ptr;
+  size_t i;
+
+  for (i = 0; i < len; ++i) {
+    h = HASH_MIX(h, p[i]);
+  }
+  return h;
+}
+
+/* eq? compares the bytes of two values, so their hash can too */
+static unsigned long
+eq_hash(pic_value v)
+{
+  return hash_bytes(0x811c9dc5ul, &v, sizeof v);
+}
+
+static unsigned long
+eqv_hash(pic_state *pic, pic_value v)
+{
+  struct bignum *big;
+
+  if (! pic_big_p(pic, v)) {
+    return eq_hash(v);
+  }
+  big = big_ptr(pic, v);
+  return hash_bytes(big->neg, big->digits, big->len * sizeof(bigit_t));
+}
+
+/*
+ * Structurally equal values hash alike. Only the first HASH_BUDGET
+ * nodes are looked at, always in the same order, which keeps the cost
+ * bounded and terminates on circular structure.
+ */
+static unsigned long
+equal_hash(pic_state *pic, pic_value v, int *budget)
+{
+  unsigned long h = pic_type(pic, v);
+  int i, len;
+
+  if ((*budget)-- <= 0) {
+    return h;
+  }
+
+  switch (pic_type(pic, v)) {
+  case PIC_TYPE_STRING:
+    return (unsigned) pic_str_hash(pic, v);
+  case PIC_TYPE_BLOB: {
+    const unsigned char *buf = pic_blob(pic, v, &len);
+    return hash_bytes(h, buf, len);
+  }
+  case PIC_TYPE_UVECTOR: {
+    const unsigned char *buf = pic_uvec(pic, v, &i, &len);
+    return hash_bytes(HASH_MIX(h, i), buf, len * pic_uvec_size(i));
+  }
+  case PIC_TYPE_PAIR:
+    do {
+      h = HASH_MIX(h, equal_hash(pic, pic_car(pic, v), budget));
+      v = pic_cdr(pic, v);
+    } while (pic_pair_p(pic, v) && (*budget)-- > 0);
+    return HASH_MIX(h, equal_hash(pic, v, budget));
+  case PIC_TYPE_VECTOR:
+    len = pic_vec_len(pic, v);
+    h = HASH_MIX(h, len);
+    for (i = 0; i < len && *budget > 0; ++i) {
+      h = HASH_MIX(h, equal_hash(pic, pic_vec_ref(pic, v, i), budget));
+    }
+    return h;
+  case PIC_TYPE_RECORD: {
+    struct record *rec = rec_ptr(pic, v);
+    h = HASH_MIX(h, eq_hash(obj_value(pic, rec->type)));
+    for (i = 0; i < rec->type->nfields && *budget > 0; ++i) {
+      h = HASH_MIX(h, equal_hash(pic, rec->fields[i], budget));
+    }
+    return h;
+  }
+  case PIC_TYPE_DICT:
+    return HASH_MIX(h, pic_dict_size(pic, v)); /* equal? compares contents */
+  case PIC_TYPE_DATA: {
+    void *data = pic_data(pic, v);
+    return hash_bytes(h, &data, sizeof data);
+  }
+  default:
+    return eqv_hash(pic, v);
+  }
+}
+
+unsigned long
+pic_hash(pic_state *pic, int kind, pic_value key)
+{
+  unsigned long h;
+  int budget = HASH_BUDGET;
+
+  switch (kind) {
+  case PIC_TABLE_EQ:
+    h = eq_hash(key);
+    break;
+  case PIC_TABLE_EQV:
+    h = eqv_hash(pic, key);
+    break;
+  case PIC_TABLE_STRING:
+    TYPE_CHECK(pic, key, str);
+    /* fall through */
+  default:
+    h = equal_hash(pic, key, &budget);
+    break;
+  }
+
+  /* spread the bits down to the ones the slot index is taken from */
+  h ^= h >> 15;
+  h *= 0x2c1b3c6dul;
+  h ^= h >> 12;
+  h *= 0x297a2d39ul;
+  h ^= h >> 15;
+  return h < 2 ? h + 2 : h;
+}
+
+static bool
+key_equal(pic_state *pic, int kind, pic_value x, pic_value y)
+{
+  switch (kind) {
+  case PIC_TABLE_EQ:
+    return pic_eq_p(pic, x, y);
+  case PIC_TABLE_EQV:
+    return pic_eqv_p(pic, x, y);
+  default:
+    return pic_equal_p(pic, x, y); /* string=? for PIC_TABLE_STRING */
+  }
+}
+
+static struct table_slot *
+probe(pic_state *pic, struct table *t, struct table_slot *slots, int cap, unsigned long hash, pic_value key)
+{
+  int i, mask = cap - 1;
+
+  if (cap == 0) {
+    return NULL;
+  }
+  for (i = hash & mask; slots[i].hash != 0; i = (i + 1) & mask) {
+    if (slots[i].hash == hash && key_equal(pic, t->kind, slots[i].key, key)) {
+      return &slots[i];
+    }
+  }
+  return NULL;
+}
+
+static struct table_slot *
+table_find(pic_state *pic, struct table *t, unsigned long hash, pic_value key)
+{
+  struct table_slot *s;
+
+  if ((s = probe(pic, t, t->slots, t->cap, hash, key)) != NULL) {
+    return s;
+  }
+  if (t->old_slots) {
+    return probe(pic, t, t->old_slots, t->old_cap, hash, key);
+  }
+  return NULL;
+}
+
+/* the caller knows that the key is in neither array */
+static void
+table_place(struct table *t, unsigned long hash, pic_value key, pic_value val)
+{
+  int i, mask = t->cap - 1;
+
+  for (i = hash & mask; t->slots[i].hash > 1; i = (i + 1) & mask)
+    ;
+  if (t->slots[i].hash == 0) {
+    t->used++;
+  }
+  t->slots[i].hash = hash;
+  t->slots[i].key = key;
+  t->slots[i].val = val;
+}
+
+static void
+table_migrate(pic_state *pic, struct table *t, int n)
+{
+  struct table_slot *s;
+
+  while (t->old_slots && n-- > 0) {
+    s = &t->old_slots[t->moved++];
+    if (s->hash > 1) {
+      table_place(t, s->hash, s->key, s->val);
+      s->hash = 1;
+    }
+    if (t->moved == t->old_cap) {
+      pic_free(pic, t->old_slots);
+      t->old_slots = NULL;
+      t->old_cap = t->moved = 0;
+    }
+  }
+}
+
+static void
+table_switch(struct table *t)
+{
+  if (t->cap > 0) {
+    t->old_slots = t->slots;
+    t->old_cap = t->cap;
+    t->moved = 0;
+  }
+  t->slots = t->next_slots;
+  t->cap = t->next_cap;
+  t->used = 0;
+  t->next_slots = NULL;
+  t->next_cap = t->cleared = 0;
+}
+
+static void
+table_clear_next(struct table *t, int n)
+{
+  if (n > t->next_cap - t->cleared) {
+    n = t->next_cap - t->cleared;
+  }
+  memset(t->next_slots + t->cleared, 0, n * sizeof(struct table_slot));
+  t->cleared += n;
+  if (t->cleared == t->next_cap) {
+    table_switch(t);
+  }
+}
+
+/*
+ * Resizing is spread over insertions. Once the table is half full a
+ * new array, twice as large unless most used slots hold deleted
+ * entries, is allocated and cleared TABLE_CLEAR slots per insertion.
+ * When it is ready it takes over, and the entries left in the previous
+ * array move across TABLE_MIGRATE slots per insertion. Both phases end
+ * long before the arrays involved are three quarters full; only if
+ * they did not would the rest of the work be done at once.
+ */
+static void
+table_reserve(pic_state *pic, struct table *t)
+{
+  int cap;
+
+  if (t->used >= t->cap - t->cap / 4) {
+    table_migrate(pic, t, t->old_cap);
+  }
+  if (t->next_slots == NULL && t->old_slots == NULL && t->used >= t->cap / 2) {
+    if (t->cap == 0) {
+      cap = TABLE_MIN_CAP;
+    } else {
+      cap = t->size > t->cap / 4 ? t->cap * 2 : t->cap;
+    }
+    t->next_slots = pic_malloc(pic, cap * sizeof(struct table_slot));
+    pic_obj_charge(pic, (struct object *) t, cap * sizeof(struct table_slot));
+    t->next_cap = cap;
+    t->cleared = 0;
+  }
+  if (t->used >= t->cap - t->cap / 4 && t->next_slots != NULL) {
+    table_clear_next(t, t->next_cap);
+  }
+  if (t->next_slots != NULL) {
+    table_clear_next(t, TABLE_CLEAR);
+  } else {
+    table_migrate(pic, t, TABLE_MIGRATE);
+  }
+}
+
+static void
+table_check_mutable(pic_state *pic, pic_value table)
+{
+  if (table_ptr(pic, table)->immutable) {
+    pic_error(pic, "hash table is immutable", 1, table);
+  }
+}
+
+pic_value
+pic_make_table(pic_state *pic, int kind)
+{
+  struct table *t;
+
+  t = (struct table *)pic_obj_alloc(pic, PIC_TYPE_TABLE);
+  t->kind = kind;
+  t->immutable = false;
+  t->size = t->cap = t->used = 0;
+  t->slots = NULL;
+  t->old_cap = t->moved = 0;
+  t->old_slots = NULL;
+  t->next_cap = t->cleared = 0;
+  t->next_slots = NULL;
+  return obj_value(pic, t);
+}
+
+bool
+pic_table_get(pic_state *pic, pic_value table, pic_value key, pic_value *val)
+{
+  struct table *t = table_ptr(pic, table);
+  struct table_slot *s;
+
+  s = table_find(pic, t, pic_hash(pic, t->kind, key), key);
+  if (s == NULL) {
+    return false;
+  }
+  if (val) *val = s->val;
+  return true;
+}
+
+pic_value
+pic_table_ref(pic_state *pic, pic_value table, pic_value key)
+{
+  pic_value val;
+
+  if (! pic_table_get(pic, table, key, &val)) {
+    pic_error(pic, "element not found for given key", 1, key);
+  }
+  return val;
+}
+
+bool
+pic_table_has(pic_state *pic, pic_value table, pic_value key)
+{
+  return pic_table_get(pic, table, key, NULL);
+}
+
+void
+pic_table_set(pic_state *pic, pic_value table, pic_value key, pic_value val)
+{
+  struct table *t = table_ptr(pic, table);
+  struct table_slot *s;
+  unsigned long hash;
+
+  table_check_mutable(pic, table);
+
+  hash = pic_hash(pic, t->kind, key);
+  if ((s = table_find(pic, t, hash, key)) != NULL) {
+    s->val = val;
+    return;
+  }
+  table_reserve(pic, t);
+  table_place(t, hash, key, val);
+  t->size++;
+}
+
+bool
+pic_table_del(pic_state *pic, pic_value table, pic_value key)
+{
+  struct table *t = table_ptr(pic, table);
+  struct table_slot *s;
+
+  table_check_mutable(pic, table);
+
+  s = table_find(pic, t, pic_hash(pic, t->kind, key), key);
+  if (s == NULL) {
+    return false;
+  }
+  s->hash = 1;
+  s->key = s->val = pic_undef_value(pic);
+  t->size--;
+  return true;
+}
+
+int
+pic_table_size(pic_state *pic, pic_value table)
+{
+  return table_ptr(pic, table)->size;
+}
+
+/* walks the current array, then what is left of the old one */
+bool
+pic_table_next(pic_state *pic, pic_value table, int *iter, pic_value *key, pic_value *val)
+{
+  struct table *t = table_ptr(pic, table);
+  struct table_slot *s;
+  int it;
+
+  for (it = *iter; it < t->cap + t->old_cap; ++it) {
+    s = it < t->cap ? &t->slots[it] : &t->old_slots[it - t->cap];
+    if (s->hash > 1) {
+      if (key) *key = s->key;
+      if (val) *val = s->val;
+      *iter = ++it;
+      return true;
+    }
+  }
+  return false;
+}
+
+static pic_value
+table_copy(pic_state *pic, pic_value table, bool immutable)
+{
+  struct table *t = table_ptr(pic, table), *u;
+  pic_value copy;
+
+  copy = pic_make_table(pic, t->kind);
+  u = table_ptr(pic, copy);
+  u->immutable = immutable;
+  u->size = t->size;
+  u->cap = t->cap;
+  u->used = t->used;
+  if (t->cap > 0) {
+    u->slots = pic_malloc(pic, t->cap * sizeof(struct table_slot));
+    pic_obj_charge(pic, (struct object *) u, t->cap * sizeof(struct table_slot));
+    memcpy(u->slots, t->slots, t->cap * sizeof(struct table_slot));
+  }
+  if (t->old_slots) {
+    u->old_slots = pic_malloc(pic, t->old_cap * sizeof(struct table_slot));
+    pic_obj_charge(pic, (struct object *) u, t->old_cap * sizeof(struct table_slot));
+    memcpy(u->old_slots, t->old_slots, t->old_cap * sizeof(struct table_slot));
+    u->old_cap = t->old_cap;
+    u->moved = t->moved;
+  }
+  return copy;
+}
+
+static void
+table_clear(pic_state *pic, pic_value table)
+{
+  struct table *t = table_ptr(pic, table);
+
+  pic_free(pic, t->slots);
+  pic_free(pic, t->old_slots);
+  pic_free(pic, t->next_slots);
+  t->size = t->cap = t->used = 0;
+  t->slots = NULL;
+  t->old_cap = t->moved = 0;
+  t->old_slots = NULL;
+  t->next_cap = t->cleared = 0;
+  t->next_slots = NULL;
+}
+
+#define TABLE_CHECK(pic, v) do {                                \
+    if (! pic_table_p(pic, v))                                  \
+      pic_error(pic, "hash table required", 1, v);              \
+  } while (0)
+
+static int
+equiv_kind(pic_state *pic, pic_value equiv)
+{
+  static const struct {
+    const char *name;
+    int kind;
+  } equivs[] = {
+    { "eq?", PIC_TABLE_EQ },
+    { "eqv?", PIC_TABLE_EQV },
+    { "equal?", PIC_TABLE_EQUAL },
+    { "string=?", PIC_TABLE_STRING }
+  };
+  size_t i;
+
+  for (i = 0; i < sizeof equivs / sizeof equivs[0]; ++i) {
+    if (pic_eq_p(pic, equiv, pic_ref(pic, equivs[i].name))) {
+      return equivs[i].kind;
+    }
+  }
+  pic_error(pic, "unsupported equivalence procedure", 1, equiv);
+  PIC_UNREACHABLE();
+}
+
+static pic_value
+pic_table_make_hash_table(pic_state *pic)
+{
+  pic_value *argv;
+  int argc;
+
+  pic_get_args(pic, "*", &argc, &argv);
+
+  /* the hash function and any size hint that follow are not needed */
+  return pic_make_table(pic, argc == 0 ? PIC_TABLE_EQUAL : equiv_kind(pic, argv[0]));
+}
+
+static pic_value
+pic_table_hash_table(pic_state *pic)
+{
+  pic_value equiv, table, *argv;
+  int argc, i;
+
+  pic_get_args(pic, "o*", &equiv, &argc, &argv);
+
+  if (argc % 2 != 0) {
+    pic_error(pic, "hash-table: keys and values must come in pairs", 0);
+  }
+  table = pic_make_table(pic, equiv_kind(pic, equiv));
+  for (i = argc - 2; i >= 0; i -= 2) {
+    pic_table_set(pic, table, argv[i], argv[i + 1]); /* the first of duplicate keys wins */
+  }
+  table_ptr(pic, table)->immutable = true;
+  return table;
+}
+
+static pic_value
+pic_table_hash_table_p(pic_state *pic)
+{
+  pic_value obj;
+
+  pic_get_args(pic, "o", &obj);
+
+  return pic_bool_value(pic, pic_table_p(pic, obj));
+}
+
+static pic_value
+pic_table_hash_table_contains_p(pic_state *pic)
+{
+  pic_value table, key;
+
+  pic_get_args(pic, "oo", &table, &key);
+
+  TABLE_CHECK(pic, table);
+  return pic_bool_value(pic, pic_table_has(pic, table, key));
+}
+
+static pic_value
+pic_table_hash_table_ref(pic_state *pic)
+{
+  pic_value table, key, failure, success, val;
+  int n;
+
+  n = pic_get_args(pic, "oo|oo", &table, &key, &failure, &success);
+
+  TABLE_CHECK(pic, table);
+  if (! pic_table_get(pic, table, key, &val)) {
+    if (n < 3) {
+      pic_error(pic, "element not found for given key", 1, key);
+    }
+    return pic_call(pic, failure, 0);
+  }
+  if (n == 4) {
+    return pic_call(pic, success, 1, val);
+  }
+  return val;
+}
+
+static pic_value
+pic_table_hash_table_ref_default(pic_state *pic)
+{
+  pic_value table, key, def, val;
+
+  pic_get_args(pic, "ooo", &table, &key, &def);
+
+  TABLE_CHECK(pic, table);
+  return pic_table_get(pic, table, key, &val) ? val : def;
+}
+
+static pic_value
+pic_table_hash_table_set(pic_state *pic)
+{
+  pic_value table, *argv;
+  int argc, i;
+
+  pic_get_args(pic, "o*", &table, &argc, &argv);
+
+  TABLE_CHECK(pic, table);
+  if (argc % 2 != 0) {
+    pic_error(pic, "hash-table-set!: keys and values must come in pairs", 0);
+  }
+  for (i = 0; i < argc; i += 2) {
+    pic_table_set(pic, table, argv[i], argv[i + 1]);
+  }
+  return pic_undef_value(pic);
+}
+
+static pic_value
+pic_table_hash_table_delete(pic_state *pic)
+{
+  pic_value table, *argv;
+  int argc, i, count = 0;
+
+  pic_get_args(pic, "o*", &table, &argc, &argv);
+
+  TABLE_CHECK(pic, table);
+  for (i = 0; i < argc; ++i) {
+    if (pic_table_del(pic, table, argv[i])) {
+      count++;
+    }
+  }
+  return pic_int_value(pic, count);
+}
+
+/* the updater may change the table, so the key is looked up again to store the result */
+static pic_value
+pic_table_hash_table_update(pic_state *pic)
+{
+  pic_value table, key, updater, failure, success, val;
+  int n;
+
+  n = pic_get_args(pic, "ool|oo", &table, &key, &updater, &failure, &success);
+
+  TABLE_CHECK(pic, table);
+  table_check_mutable(pic, table);
+  if (! pic_table_get(pic, table, key, &val)) {
+    if (n < 4) {
+      pic_error(pic, "element not found for given key", 1, key);
+    }
+    val = pic_call(pic, failure, 0);
+  }
+  else if (n == 5) {
+    val = pic_call(pic, success, 1, val);
+  }
+  pic_table_set(pic, table, key, pic_call(pic, updater, 1, val));
+  return pic_undef_value(pic);
+}
+
+static pic_value
+pic_table_hash_table_update_default(pic_state *pic)
+{
+  pic_value table, key, updater, def, val;
+
+  pic_get_args(pic, "oolo", &table, &key, &updater, &def);
+
+  TABLE_CHECK(pic, table);
+  table_check_mutable(pic, table);
+  if (! pic_table_get(pic, table, key, &val)) {
+    val = def;
+  }
+  pic_table_set(pic, table, key, pic_call(pic, updater, 1, val));
+  return pic_undef_value(pic);
+}
+
+static pic_value
+pic_table_hash_table_size(pic_state *pic)
+{
+  pic_value table;
+
+  pic_get_args(pic, "o", &table);
+
+  TABLE_CHECK(pic, table);
+  return pic_int_value(pic, pic_table_size(pic, table));
+}
+
+#define KEYS 1
+#define VALUES 2
+
+static pic_value
+table_list(pic_state *pic, int what)
+{
+  pic_value table, key, val, list = pic_nil_value(pic);
+  int it = 0;
+
+  pic_get_args(pic, "o", &table);
+
+  TABLE_CHECK(pic, table);
+  while (pic_table_next(pic, table, &it, &key, &val)) {
+    switch (what) {
+    case KEYS:
+      pic_push(pic, key, list);
+      break;
+    case VALUES:
+      pic_push(pic, val, list);
+      break;
+    default:
+      pic_push(pic, pic_cons(pic, key, val), list);
+      break;
+    }
+  }
+  return list;
+}
+
+static pic_value
+pic_table_hash_table_keys(pic_state *pic)
+{
+  return table_list(pic, KEYS);
+}
+
+static pic_value
+pic_table_hash_table_values(pic_state *pic)
+{
+  return table_list(pic, VALUES);
+}
+
+static pic_value
+pic_table_hash_table_to_alist(pic_state *pic)
+{
+  return table_list(pic, KEYS | VALUES);
+}
+
+/* feeds hash-table-fold and hash-table-for-each; acc is #f for the latter */
+struct table_each {
+  pic_value table, acc;
+  int it;
+  bool fold, started;
+};
+
+static bool
+table_each(pic_state *pic, void *data, pic_value result, pic_value *argv)
+{
+  struct table_each *e = data;
+
+  if (e->fold && e->started) {
+    e->acc = result;
+  }
+  e->started = true;
+  if (! pic_table_next(pic, e->table, &e->it, &argv[0], &argv[1])) {
+    return false;
+  }
+  if (e->fold) {
+    argv[2] = e->acc;
+  }
+  return true;
+}
+
+/* (hash-table-fold kons knil table), or SRFI 69's (hash-table-fold table kons knil) */
+static pic_value
+pic_table_hash_table_fold(pic_state *pic)
+{
+  pic_value a, b, c;
+  struct table_each e;
+
+  pic_get_args(pic, "ooo", &a, &b, &c);
+
+  if (pic_table_p(pic, a)) {
+    e.table = a;
+    e.acc = c;
+    a = b;
+  } else {
+    TABLE_CHECK(pic, c);
+    e.table = c;
+    e.acc = b;
+  }
+  e.it = 0;
+  e.fold = true;
+  e.started = false;
+  pic_call_each(pic, a, 3, table_each, &e);
+  return e.acc;
+}
+
+/* (hash-table-for-each proc table), or (hash-table-walk table proc) */
+static pic_value
+pic_table_hash_table_for_each(pic_state *pic)
+{
+  pic_value a, b;
+  struct table_each e;
+
+  pic_get_args(pic, "oo", &a, &b);
+
+  if (pic_table_p(pic, a)) {
+    e.table = a;
+    a = b;
+  } else {
+    TABLE_CHECK(pic, b);
+    e.table = b;
+  }
+  e.acc = pic_false_value(pic);
+  e.it = 0;
+  e.fold = false;
+  e.started = false;
+  pic_call_each(pic, a, 2, table_each, &e);
+  return pic_undef_value(pic);
+}
+
+static pic_value
+pic_table_hash_table_copy(pic_state *pic)
+{
+  pic_value table, mut = pic_true_value(pic);
+
+  /* SRFI 69 copies are mutable, so only an explicit #f makes one immutable */
+  pic_get_args(pic, "o|o", &table, &mut);
+
+  TABLE_CHECK(pic, table);
+  return table_copy(pic, table, pic_false_p(pic, mut));
+}
+
+static pic_value
+pic_table_hash_table_clear(pic_state *pic)
+{
+  pic_value table;
+
+  pic_get_args(pic, "o", &table);
+
+  TABLE_CHECK(pic, table);
+  table_check_mutable(pic, table);
+  table_clear(pic, table);
+  return pic_undef_value(pic);
+}
+
+static pic_value
+pic_table_hash_table_mutable_p(pic_state *pic)
+{
+  pic_value table;
+
+  pic_get_args(pic, "o", &table);
+
+  TABLE_CHECK(pic, table);
+  return pic_bool_value(pic, ! table_ptr(pic, table)->immutable);
+}
+
+static pic_value
+pic_table_hash_table_equivalence_function(pic_state *pic)
+{
+  static const char *names[] = { "eq?", "eqv?", "equal?", "string=?" };
+  pic_value table;
+
+  pic_get_args(pic, "o", &table);
+
+  TABLE_CHECK(pic, table);
+  return pic_ref(pic, names[table_ptr(pic, table)->kind]);
+}
+
+static pic_value
+pic_table_hash_table_hash_function(pic_state *pic)
+{
+  static const char *names[] = { "hash-by-identity", "hash", "hash", "string-hash" };
+  pic_value table;
+
+  pic_get_args(pic, "o", &table);
+
+  TABLE_CHECK(pic, table);
+  return pic_ref(pic, names[table_ptr(pic, table)->kind]);
+}
+
+static pic_value
+hash_value(pic_state *pic, int kind)
+{
+  pic_value obj;
+  unsigned long h;
+  int n, bound;
+
+  n = pic_get_args(pic, "o|i", &obj, &bound);
+
+  if (kind == PIC_TABLE_STRING) {
+    TYPE_CHECK(pic, obj, str);
+  }
+  h = pic_hash(pic, kind, obj);
+  if (n == 1) {
+    return pic_int_value(pic, (long) (h & 0x3ffffffful));
+  }
+  if (bound <= 0) {
+    pic_error(pic, "hash: bound must be positive", 1, pic_int_value(pic, bound));
+  }
+  return pic_int_value(pic, (long) (h % bound));
+}
+
+static pic_value
+pic_table_hash(pic_state *pic)
+{
+  return hash_value(pic, PIC_TABLE_EQUAL);
+}
+
+static pic_value
+pic_table_string_hash(pic_state *pic)
+{
+  return hash_value(pic, PIC_TABLE_STRING);
+}
+
+static pic_value
+pic_table_hash_by_identity(pic_state *pic)
+{
+  return hash_value(pic, PIC_TABLE_EQ);
+}
+
+void
+pic_init_table(pic_state *pic)
+{
+  pic_defun(pic, "make-hash-table", pic_table_make_hash_table);
+  pic_defun(pic, "hash-table", pic_table_hash_table);
+  pic_defun(pic, "hash-table?", pic_table_hash_table_p);
+  pic_defun(pic, "hash-table-contains?", pic_table_hash_table_contains_p);
+  pic_defun(pic, "hash-table-ref", pic_table_hash_table_ref);
+  pic_defun(pic, "hash-table-ref/default", pic_table_hash_table_ref_default);
+  pic_defun(pic, "hash-table-set!", pic_table_hash_table_set);
+  pic_defun(pic, "hash-table-delete!", pic_table_hash_table_delete);
+  pic_defun(pic, "hash-table-update!", pic_table_hash_table_update);
+  pic_defun(pic, "hash-table-update!/default", pic_table_hash_table_update_default);
+  pic_defun(pic, "hash-table-size", pic_table_hash_table_size);
+  pic_defun(pic, "hash-table-keys", pic_table_hash_table_keys);
+  pic_defun(pic, "hash-table-values", pic_table_hash_table_values);
+  pic_defun(pic, "hash-table->alist", pic_table_hash_table_to_alist);
+  pic_defun(pic, "hash-table-fold", pic_table_hash_table_fold);
+  pic_defun(pic, "hash-table-for-each", pic_table_hash_table_for_each);
+  pic_defun(pic, "hash-table-copy", pic_table_hash_table_copy);
+  pic_defun(pic, "hash-table-clear!", pic_table_hash_table_clear);
+  pic_defun(pic, "hash-table-mutable?", pic_table_hash_table_mutable_p);
+  pic_defun(pic, "hash-table-equivalence-function", pic_table_hash_table_equivalence_function);
+  pic_defun(pic, "hash-table-hash-function", pic_table_hash_table_hash_function);
+  pic_defun(pic, "hash", pic_table_hash);
+  pic_defun(pic, "string-hash", pic_table_string_hash);
+  pic_defun(pic, "hash-by-identity", pic_table_hash_by_identity);
+}
@@ -0,0 +1,1095 @@
+/**
+ * See Copyright Notice in picrin.h
+ */
+
+#include <picrin.h>
+#include "value.h"
+#include "object.h"
+#include "state.h"
+
+#if PIC_SSE2
+# include <emmintrin.h>
+#endif
+
+/*
+ * Homogeneous numeric vectors
+ *
+ * SRFI 4 vectors keep their elements unboxed in native byte order. The
+ * u8 kind is the bytevector itself; every other kind is a uvector. The
+ * procedures of all kinds share one implementation per operation, each
+ * closing over its kind.
+ */
+
+#ifdef PIC_INT64_T
+typedef PIC_INT64_T i64;
+typedef PIC_UINT64_T u64;
+#else
+typedef long i64;               /* 64-bit kinds are not available */
+typedef unsigned long u64;
+#endif
+
+static const struct {
+  const char *tag;
+  int size;
+} uvec_kinds[] = {
+  { "u8", 1 },
+  { "s8", 1 },
+  { "u16", 2 },
+  { "s16", 2 },
+  { "u32", 4 },
+  { "s32", 4 },
+  { "u64", 8 },
+  { "s64", 8 },
+  { "f32", 4 },
+  { "f64", 8 }
+};
+
+#define UVEC_KINDS (int) (sizeof uvec_kinds / sizeof uvec_kinds[0])
+
+int
+pic_uvec_size(int kind)
+{
+  return uvec_kinds[kind].size;
+}
+
+pic_value
+pic_make_uvec(pic_state *pic, int kind, int len)
+{
+  struct uvector *uvec;
+  pic_value blob;
+  size_t size;
+
+  if (kind == PIC_UVEC_U8) {
+    blob = pic_blob_value(pic, NULL, len);
+    memset(pic_blob(pic, blob, NULL), 0, len);
+    return blob;
+  }
+#ifndef PIC_INT64_T
+  if (kind == PIC_UVEC_U64 || kind == PIC_UVEC_S64) {
+    pic_error(pic, "64-bit integers are not supported", 0);
+  }
+#endif
+  if (len > INT_MAX / uvec_kinds[kind].size) {
+    pic_error(pic, "numeric vector too large", 1, pic_int_value(pic, len));
+  }
+  size = (size_t) len * uvec_kinds[kind].size;
+
+  uvec = (struct uvector *)pic_obj_alloc(pic, PIC_TYPE_UVECTOR);
+  uvec->kind = (unsigned char) kind;
+  uvec->len = 0;
+  uvec->data = NULL;
+  if (size > 0) {
+    uvec->data = pic_malloc(pic, size);
+    pic_obj_charge(pic, (struct object *) uvec, size);
+    memset(uvec->data, 0, size);
+  }
+  uvec->len = len;
+  return obj_value(pic, uvec);
+}
+
+void *
+pic_uvec(pic_state *pic, pic_value v, int *kind, int *len)
+{
+  struct uvector *uvec;
+
+  if (pic_blob_p(pic, v)) {
+    if (kind) {
+      *kind = PIC_UVEC_U8;
+    }
+    return pic_blob(pic, v, len);
+  }
+  uvec = uvec_ptr(pic, v);
+  if (kind) {
+    *kind = uvec->kind;
+  }
+  if (len) {
+    *len = uvec->len;
+  }
+  return uvec->data;
+}
+
+/* the exact integer (neg ? -mag : mag) */
+static pic_value
+uvec_int_value(pic_state *pic, bool neg, u64 mag)
+{
+  unsigned char buf[sizeof(u64)];
+  int i;
+
+  if (mag <= (u64) PIC_INT_MAX) {
+    return pic_int_value(pic, neg ? -(long) mag : (long) mag);
+  }
+  for (i = 0; i < (int) sizeof buf; ++i) {
+    buf[i] = (unsigned char) (mag >> i * 8);
+  }
+  return pic_big_value(pic, neg, buf, sizeof buf);
+}
+
+/* splits an exact integer into sign and magnitude, false if it is too large */
+static bool
+uvec_int(pic_state *pic, pic_value v, bool *neg, u64 *mag)
+{
+  struct bignum *big;
+  long i;
+  int k;
+
+  if (pic_int_p(pic, v)) {
+    i = pic_int(pic, v);
+    *neg = i < 0;
+    *mag = i < 0 ? 0 - (u64) i : (u64) i;
+    return true;
+  }
+  if (! pic_big_p(pic, v)) {
+    pic_error(pic, "exact integer required", 1, v);
+  }
+  big = big_ptr(pic, v);
+  if (big->len * BIGIT_BITS > (int) sizeof(u64) * 8) {
+    return false;
+  }
+  *neg = big->neg;
+  *mag = 0;
+  for (k = big->len - 1; k >= 0; --k) {
+    *mag = (*mag << (BIGIT_BITS - 1) << 1) | big->digits[k];
+  }
+  return true;
+}
+
+static double
+uvec_float(pic_state *pic, pic_value v)
+{
+  switch (pic_type(pic, v)) {
+  case PIC_TYPE_FLOAT:
+    return pic_float(pic, v);
+  case PIC_TYPE_INT:
+    return (double) pic_int(pic, v);
+  case PIC_TYPE_BIGNUM:
+    return pic_big_float(pic, v);
+  default:
+    pic_error(pic, "real number required", 1, v);
+  }
+}
+
+pic_value
+pic_uvec_load(pic_state *pic, int kind, const unsigned char *data, int i)
+{
+  i64 s;
+  u64 u;
+
+  switch (kind) {
+  case PIC_UVEC_U8: return pic_int_value(pic, data[i]);
+  case PIC_UVEC_S8: return pic_int_value(pic, ((const signed char *) data)[i]);
+  case PIC_UVEC_U16: return pic_int_value(pic, ((const unsigned short *) data)[i]);
+  case PIC_UVEC_S16: return pic_int_value(pic, ((const short *) data)[i]);
+  case PIC_UVEC_U32: return uvec_int_value(pic, false, ((const uint32_t *) data)[i]);
+  case PIC_UVEC_S32: return pic_int_value(pic, ((const int32_t *) data)[i]);
+  case PIC_UVEC_U64:
+    u = ((const u64 *) data)[i];
+    return uvec_int_value(pic, false, u);
+  case PIC_UVEC_S64:
+    s = ((const i64 *) data)[i];
+    return uvec_int_value(pic, s < 0, s < 0 ? 0 - (u64) s : (u64) s);
+  case PIC_UVEC_F32: return pic_float_value(pic, ((const float *) data)[i]);
+  case PIC_UVEC_F64: return pic_float_value(pic, ((const double *) data)[i]);
+  }
+  PIC_UNREACHABLE();
+}
+
+void
+pic_uvec_store(pic_state *pic, int kind, unsigned char *data, int i, pic_value v)
+{
+  static const u64 max[][2] = {     /* largest magnitudes, positive and negative */
+    { 0xff, 0 },
+    { 0x7f, 0x80 },
+    { 0xffff, 0 },
+    { 0x7fff, 0x8000 },
+    { 0xffffffff, 0 },
+    { 0x7fffffff, 0x80000000 },
+    { ~(u64) 0, 0 },
+    { ~(u64) 0 >> 1, (~(u64) 0 >> 1) + 1 }
+  };
+  bool neg;
+  u64 mag;
+  i64 s;
+
+  if (kind == PIC_UVEC_F32) {
+    ((float *) data)[i] = (float) uvec_float(pic, v);
+    return;
+  }
+  if (kind == PIC_UVEC_F64) {
+    ((double *) data)[i] = uvec_float(pic, v);
+    return;
+  }
+  if (! uvec_int(pic, v, &neg, &mag) || mag > max[kind][(int) neg]) {
+    pic_error(pic, "value out of range", 1, v);
+  }
+  s = neg ? -(i64) (mag - 1) - 1 : (i64) mag;
+
+  switch (kind) {
+  case PIC_UVEC_U8: data[i] = (unsigned char) mag; break;
+  case PIC_UVEC_S8: ((signed char *) data)[i] = (signed char) s; break;
+  case PIC_UVEC_U16: ((unsigned short *) data)[i] = (unsigned short) mag; break;
+  case PIC_UVEC_S16: ((short *) data)[i] = (short) s; break;
+  case PIC_UVEC_U32: ((uint32_t *) data)[i] = (uint32_t) mag; break;
+  case PIC_UVEC_S32: ((int32_t *) data)[i] = (int32_t) s; break;
+  case PIC_UVEC_U64: ((u64 *) data)[i] = mag; break;
+  case PIC_UVEC_S64: ((i64 *) data)[i] = s; break;
+  }
+}
+
+pic_value
+pic_uvec_ref(pic_state *pic, pic_value uvec, int i)
+{
+  int kind;
+  unsigned char *data = pic_uvec(pic, uvec, &kind, NULL);
+
+  return pic_uvec_load(pic, kind, data, i);
+}
+
+void
+pic_uvec_set(pic_state *pic, pic_value uvec, int i, pic_value v)
+{
+  int kind;
+  unsigned char *data = pic_uvec(pic, uvec, &kind, NULL);
+
+  pic_uvec_store(pic, kind, data, i, v);
+}
+
+/* the kind of the procedure being called */
+static int
+uvec_kind(pic_state *pic)
+{
+  return (int) pic_int(pic, pic_closure_ref(pic, 0));
+}
+
+static bool
+uvec_kind_p(pic_state *pic, pic_value v, int kind)
+{
+  if (kind == PIC_UVEC_U8) {
+    return pic_blob_p(pic, v);
+  }
+  return pic_uvec_p(pic, v) && uvec_ptr(pic, v)->kind == kind;
+}
+
+/* the elements and the length of v, which must be a vector of the kind */
+static unsigned char *
+uvec_check(pic_state *pic, pic_value v, int kind, int *len)
+{
+  const char *tag = uvec_kinds[kind].tag;
+  char msg[32];
+  size_t n;
+
+  if (! uvec_kind_p(pic, v, kind)) {
+    n = strlen(tag);
+    memcpy(msg, tag, n);
+    memcpy(msg + n, "vector required", sizeof "vector required");
+    pic_error(pic, msg, 1, v);
+  }
+  return pic_uvec(pic, v, NULL, len);
+}
+
+static void
+uvec_range(pic_state *pic, int n, int skip, int len, int *start, int *end)
+{
+  if (n <= skip) {
+    *start = 0;
+  }
+  if (n <= skip + 1) {
+    *end = len;
+  }
+  VALID_RANGE(pic, len, *start, *end);
+}
+
+static pic_value
+pic_uvec_uvector_p(pic_state *pic)
+{
+  pic_value v;
+
+  pic_get_args(pic, "o", &v);
+
+  return pic_bool_value(pic, uvec_kind_p(pic, v, uvec_kind(pic)));
+}
+
+static pic_value
+pic_uvec_make_uvector(pic_state *pic)
+{
+  pic_value uvec, fill;
+  int kind = uvec_kind(pic), n, len, i;
+  unsigned char *data;
+
+  n = pic_get_args(pic, "i|o", &len, &fill);
+
+  if (len < 0) {
+    pic_error(pic, "negative length given", 1, pic_int_value(pic, len));
+  }
+  uvec = pic_make_uvec(pic, kind, len);
+  if (n == 2) {
+    data = pic_uvec(pic, uvec, NULL, NULL);
+    for (i = 0; i < len; ++i) {
+      pic_uvec_store(pic, kind, data, i, fill);
+    }
+  }
+  return uvec;
+}
+
+static pic_value
+pic_uvec_uvector(pic_state *pic)
+{
+  pic_value uvec, *argv;
+  int kind = uvec_kind(pic), argc, i;
+  unsigned char *data;
+
+  pic_get_args(pic, "*", &argc, &argv);
+
+  uvec = pic_make_uvec(pic, kind, argc);
+  data = pic_uvec(pic, uvec, NULL, NULL);
+  for (i = 0; i < argc; ++i) {
+    pic_uvec_store(pic, kind, data, i, argv[i]);
+  }
+  return uvec;
+}
+
+static pic_value
+pic_uvec_uvector_length(pic_state *pic)
+{
+  pic_value v;
+  int len;
+
+  pic_get_args(pic, "o", &v);
+
+  uvec_check(pic, v, uvec_kind(pic), &len);
+  return pic_int_value(pic, len);
+}
+
+static pic_value
+pic_uvec_uvector_ref(pic_state *pic)
+{
+  pic_value v;
+  int kind = uvec_kind(pic), len, k;
+  unsigned char *data;
+
+  pic_get_args(pic, "oi", &v, &k);
+
+  data = uvec_check(pic, v, kind, &len);
+  VALID_INDEX(pic, len, k);
+
+  return pic_uvec_load(pic, kind, data, k);
+}
+
+static pic_value
+pic_uvec_uvector_set(pic_state *pic)
+{
+  pic_value v, obj;
+  int kind = uvec_kind(pic), len, k;
+  unsigned char *data;
+
+  pic_get_args(pic, "oio", &v, &k, &obj);
+
+  data = uvec_check(pic, v, kind, &len);
+  VALID_INDEX(pic, len, k);
+
+  pic_uvec_store(pic, kind, data, k, obj);
+  return pic_undef_value(pic);
+}
+
+static pic_value
+pic_uvec_uvector_to_list(pic_state *pic)
+{
+  pic_value v, list;
+  int kind = uvec_kind(pic), n, len, start, end, i;
+  unsigned char *data;
+
+  n = pic_get_args(pic, "o|ii", &v, &start, &end);
+
+  data = uvec_check(pic, v, kind, &len);
+  uvec_range(pic, n, 1, len, &start, &end);
+
+  list = pic_nil_value(pic);
+  for (i = end; i > start; --i) {
+    pic_push(pic, pic_uvec_load(pic, kind, data, i - 1), list);
+  }
+  return list;
+}
+
+static pic_value
+pic_uvec_list_to_uvector(pic_state *pic)
+{
+  pic_value list, uvec, e, it;
+  int kind = uvec_kind(pic), i = 0;
+  unsigned char *data;
+
+  pic_get_args(pic, "o", &list);
+
+  if (! pic_list_p(pic, list)) {
+    pic_error(pic, "list required", 1, list);
+  }
+  uvec = pic_make_uvec(pic, kind, pic_length(pic, list));
+  data = pic_uvec(pic, uvec, NULL, NULL);
+  pic_for_each (e, list, it) {
+    pic_uvec_store(pic, kind, data, i++, e);
+  }
+  return uvec;
+}
+
+static pic_value
+pic_uvec_uvector_to_vector(pic_state *pic)
+{
+  pic_value v, vec;
+  int kind = uvec_kind(pic), n, len, start, end, i;
+  unsigned char *data;
+
+  n = pic_get_args(pic, "o|ii", &v, &start, &end);
+
+  data = uvec_check(pic, v, kind, &len);
+  uvec_range(pic, n, 1, len, &start, &end);
+
+  vec = pic_make_vec(pic, end - start, NULL);
+  for (i = start; i < end; ++i) {
+    pic_vec_set(pic, vec, i - start, pic_uvec_load(pic, kind, data, i));
+  }
+  return vec;
+}
+
+static pic_value
+pic_uvec_vector_to_uvector(pic_state *pic)
+{
+  pic_value vec, uvec;
+  int kind = uvec_kind(pic), n, start, end, i;
+  unsigned char *data;
+
+  n = pic_get_args(pic, "v|ii", &vec, &start, &end);
+
+  uvec_range(pic, n, 1, pic_vec_len(pic, vec), &start, &end);
+
+  uvec = pic_make_uvec(pic, kind, end - start);
+  data = pic_uvec(pic, uvec, NULL, NULL);
+  for (i = start; i < end; ++i) {
+    pic_uvec_store(pic, kind, data, i - start, pic_vec_ref(pic, vec, i));
+  }
+  return uvec;
+}
+
+static pic_value
+pic_uvec_uvector_copy(pic_state *pic)
+{
+  pic_value v, uvec;
+  int kind = uvec_kind(pic), size = uvec_kinds[kind].size, n, len, start, end;
+  unsigned char *data;
+
+  n = pic_get_args(pic, "o|ii", &v, &start, &end);
+
+  data = uvec_check(pic, v, kind, &len);
+  uvec_range(pic, n, 1, len, &start, &end);
+
+  uvec = pic_make_uvec(pic, kind, end - start);
+  if (end > start) {
+    memcpy(pic_uvec(pic, uvec, NULL, NULL), data + start * size, (size_t) (end - start) * size);
+  }
+  return uvec;
+}
+
+static pic_value
+pic_uvec_uvector_copy_i(pic_state *pic)
+{
+  pic_value to, from;
+  int kind = uvec_kind(pic), size = uvec_kinds[kind].size, n, at, start, end, tolen, fromlen;
+  unsigned char *todata, *fromdata;
+
+  n = pic_get_args(pic, "oio|ii", &to, &at, &from, &start, &end);
+
+  todata = uvec_check(pic, to, kind, &tolen);
+  fromdata = uvec_check(pic, from, kind, &fromlen);
+
+  switch (n) {
+  case 3:
+    start = 0;
+  case 4:
+    end = fromlen;
+  }
+
+  VALID_ATRANGE(pic, tolen, at, fromlen, start, end);
+
+  if (end > start) {
+    memmove(todata + at * size, fromdata + start * size, (size_t) (end - start) * size);
+  }
+  return pic_undef_value(pic);
+}
+
+static pic_value
+pic_uvec_uvector_append(pic_state *pic)
+{
+  pic_value uvec, *argv;
+  int kind = uvec_kind(pic), size = uvec_kinds[kind].size, argc, len, l, i;
+  unsigned char *data, *src;
+
+  pic_get_args(pic, "*", &argc, &argv);
+
+  len = 0;
+  for (i = 0; i < argc; ++i) {
+    uvec_check(pic, argv[i], kind, &l);
+    if (l > INT_MAX - len) {
+      pic_error(pic, "numeric vector too large", 0);
+    }
+    len += l;
+  }
+
+  uvec = pic_make_uvec(pic, kind, len);
+  data = pic_uvec(pic, uvec, NULL, NULL);
+  for (i = 0; i < argc; ++i) {
+    src = uvec_check(pic, argv[i], kind, &l);
+    if (l > 0) {
+      memcpy(data, src, (size_t) l * size);
+      data += l * size;
+    }
+  }
+  return uvec;
+}
+
+static pic_value
+pic_uvec_uvector_fill_i(pic_state *pic)
+{
+  pic_value v, obj;
+  int kind = uvec_kind(pic), size = uvec_kinds[kind].size, n, len, start, end, i;
+  unsigned char *data;
+
+  n = pic_get_args(pic, "oo|ii", &v, &obj, &start, &end);
+
+  data = uvec_check(pic, v, kind, &len);
+  uvec_range(pic, n, 2, len, &start, &end);
+
+  if (end > start) {
+    pic_uvec_store(pic, kind, data, start, obj);
+    for (i = start + 1; i < end; ++i) {
+      memcpy(data + i * size, data + start * size, size);
+    }
+  }
+  return pic_undef_value(pic);
+}
+
+/*
+ * Bulk arithmetic
+ *
+ * Element-wise operations run one typed loop per kind over the whole
+ * vector, simple enough for the compiler to vectorize. A number given in
+ * place of a vector is spread over a chunk of UVEC_CHUNK elements so that
+ * the same loops serve both. Integer kinds wrap around like C unsigned
+ * arithmetic and divide truncating. Floating-point reductions are summed
+ * in a few independent lanes, with SSE2 where it is available, so their
+ * rounding does not follow the order of the elements.
+ */
+
+enum {
+  UVEC_ADD,
+  UVEC_SUB,
+  UVEC_MUL,
+  UVEC_DIV,
+  UVEC_FMA,
+  UVEC_EQ,                      /* comparisons make a mask of 0 and 1 */
+  UVEC_LT,
+  UVEC_LE,
+  UVEC_GT,
+  UVEC_GE
+};
+
+#define UVEC_CHUNK 256
+
+#define LOOP(t, expr) do {                      \
+    for (i = 0; i < n; ++i) {                   \
+      t[i] = (expr);                            \
+    }                                           \
+  } while (0); break
+
+#define COMPARE_CASES                           \
+  case UVEC_EQ: LOOP(m, x[i] == y[i]);          \
+  case UVEC_LT: LOOP(m, x[i] < y[i]);           \
+  case UVEC_LE: LOOP(m, x[i] <= y[i]);          \
+  case UVEC_GT: LOOP(m, x[i] > y[i]);           \
+  case UVEC_GE: LOOP(m, x[i] >= y[i])
+
+/* U is an unsigned type at least as wide as T, S whether T is signed */
+#define DEFINE_INT_OPS(tag, T, U, S)                                    \
+  static void                                                           \
+  arith_##tag(int op, void *to, const void *xp, const void *yp, const void *zp, int n) \
+  {                                                                     \
+    T *t = to;                                                          \
+    unsigned char *m = to;                                              \
+    const T *x = xp, *y = yp, *z = zp;                                  \
+    int i;                                                              \
+                                                                        \
+    switch (op) {                                                       \
+    case UVEC_ADD: LOOP(t, (T) ((U) x[i] + (U) y[i]));                  \
+    case UVEC_SUB: LOOP(t, (T) ((U) x[i] - (U) y[i]));                  \
+    case UVEC_MUL: LOOP(t, (T) ((U) x[i] * (U) y[i]));                  \
+    case UVEC_DIV: LOOP(t, S && y[i] == (T) -1 ? (T) (0 - (U) x[i]) : (T) (x[i] / y[i])); \
+    case UVEC_FMA: LOOP(t, (T) ((U) x[i] * (U) y[i] + (U) z[i]));       \
+    COMPARE_CASES;                                                      \
+    }                                                                   \
+  }                                                                     \
+                                                                        \
+  /* the sum of x, or of x times y; only for kinds that cannot overflow */ \
+  static i64                                                            \
+  sum_##tag(const void *xp, const void *yp, int n)                     \
+  {                                                                     \
+    const T *x = xp, *y = yp;                                           \
+    i64 s = 0;                                                          \
+    int i;                                                              \
+                                                                        \
+    if (y == NULL) {                                                    \
+      for (i = 0; i < n; ++i) {                                         \
+        s += (i64) x[i];                                                \
+      }                                                                 \
+    } else {                                                            \
+      for (i = 0; i < n; ++i) {                                         \
+        s += (i64) x[i] * y[i];                                         \
+      }                                                                 \
+    }                                                                   \
+    return s;                                                           \
+  }                                                                     \
+                                                                        \
+  static void                                                           \
+  minmax_##tag(const void *xp, int n, void *lo, void *hi)               \
+  {                                                                     \
+    const T *x = xp;                                                    \
+    T a = x[0], b = x[0];                                               \
+    int i;                                                              \
+                                                                        \
+    for (i = 1; i < n; ++i) {                                           \
+      a = x[i] < a ? x[i] : a;                                          \
+      b = x[i] > b ? x[i] : b;                                          \
+    }                                                                   \
+    memcpy(lo, &a, sizeof a);                                           \
+    memcpy(hi, &b, sizeof b);                                           \
+  }
+
+#define DEFINE_FLOAT_OPS(tag, T)                                        \
+  static void                                                           \
+  arith_##tag(int op, void *to, const void *xp, const void *yp, const void *zp, int n) \
+  {                                                                     \
+    T *t = to;                                                          \
+    unsigned char *m = to;                                              \
+    const T *x = xp, *y = yp, *z = zp;                                  \
+    int i;                                                              \
+                                                                        \
+    switch (op) {                                                       \
+    case UVEC_ADD: LOOP(t, x[i] + y[i]);                                \
+    case UVEC_SUB: LOOP(t, x[i] - y[i]);                                \
+    case UVEC_MUL: LOOP(t, x[i] * y[i]);                                \
+    case UVEC_DIV: LOOP(t, x[i] / y[i]);                                \
+    case UVEC_FMA: LOOP(t, x[i] * y[i] + z[i]);                         \
+    COMPARE_CASES;                                                      \
+    }                                                                   \
+  }
+
+DEFINE_INT_OPS(u8, unsigned char, unsigned long, 0)
+DEFINE_INT_OPS(s8, signed char, unsigned long, 1)
+DEFINE_INT_OPS(u16, unsigned short, unsigned long, 0)
+DEFINE_INT_OPS(s16, short, unsigned long, 1)
+DEFINE_INT_OPS(u32, uint32_t, unsigned long, 0)
+DEFINE_INT_OPS(s32, int32_t, unsigned long, 1)
+DEFINE_INT_OPS(u64, u64, u64, 0)
+DEFINE_INT_OPS(s64, i64, u64, 1)
+DEFINE_FLOAT_OPS(f32, float)
+DEFINE_FLOAT_OPS(f64, double)
+
+/* the sum of x, or of x times y when y is not NULL */
+static double
+fsum_f64(const double *x, const double *y, int n)
+{
+  double s = 0;
+  int i = 0;
+#if PIC_SSE2
+  __m128d s0 = _mm_setzero_pd(), s1 = _mm_setzero_pd();
+  double lanes[2];
+
+  if (y == NULL) {
+    for (; i + 4 <= n; i += 4) {
+      s0 = _mm_add_pd(s0, _mm_loadu_pd(x + i));
+      s1 = _mm_add_pd(s1, _mm_loadu_pd(x + i + 2));
+    }
+  } else {
+    for (; i + 4 <= n; i += 4) {
+      s0 = _mm_add_pd(s0, _mm_mul_pd(_mm_loadu_pd(x + i), _mm_loadu_pd(y + i)));
+      s1 = _mm_add_pd(s1, _mm_mul_pd(_mm_loadu_pd(x + i + 2), _mm_loadu_pd(y + i + 2)));
+    }
+  }
+  _mm_storeu_pd(lanes, _mm_add_pd(s0, s1));
+  s = lanes[0] + lanes[1];
+#endif
+
+  for (; i < n; ++i) {
+    s += y == NULL ? x[i] : x[i] * y[i];
+  }
+  return s;
+}
+
+/* ... in double precision */
+static double
+fsum_f32(const float *x, const float *y, int n)
+{
+  double s = 0;
+  int i = 0;
+#if PIC_SSE2
+  __m128d s0 = _mm_setzero_pd(), s1 = _mm_setzero_pd();
+  __m128 v, w;
+  double lanes[2];
+
+  for (; i + 4 <= n; i += 4) {
+    v = _mm_loadu_ps(x + i);
+    if (y == NULL) {
+      s0 = _mm_add_pd(s0, _mm_cvtps_pd(v));
+      s1 = _mm_add_pd(s1, _mm_cvtps_pd(_mm_movehl_ps(v, v)));
+    } else {
+      w = _mm_loadu_ps(y + i);
+      s0 = _mm_add_pd(s0, _mm_mul_pd(_mm_cvtps_pd(v), _mm_cvtps_pd(w)));
+      s1 = _mm_add_pd(s1, _mm_mul_pd(_mm_cvtps_pd(_mm_movehl_ps(v, v)), _mm_cvtps_pd(_mm_movehl_ps(w, w))));
+    }
+  }
+  _mm_storeu_pd(lanes, _mm_add_pd(s0, s1));
+  s = lanes[0] + lanes[1];
+#endif
+
+  for (; i < n; ++i) {
+    s += y == NULL ? (double) x[i] : (double) x[i] * y[i];
+  }
+  return s;
+}
+
+/* the least and greatest elements, or NaN for both if there is one */
+static void
+minmax_f64(const void *xp, int n, void *lo, void *hi)
+{
+  const double *x = xp;
+  double a = x[0], b = x[0];
+  int i = 0;
+#if PIC_SSE2
+  __m128d vlo = _mm_set1_pd(a), vhi = vlo, nan = _mm_setzero_pd(), v;
+  double lanes[2];
+
+  for (; i + 2 <= n; i += 2) {
+    v = _mm_loadu_pd(x + i);
+    vlo = _mm_min_pd(vlo, v);
+    vhi = _mm_max_pd(vhi, v);
+    nan = _mm_or_pd(nan, _mm_cmpunord_pd(v, v));
+  }
+  if (_mm_movemask_pd(nan) != 0) {
+    i = 0;                      /* let the loop below find it */
+  } else {
+    _mm_storeu_pd(lanes, vlo);
+    a = lanes[0] < lanes[1] ? lanes[0] : lanes[1];
+    _mm_storeu_pd(lanes, vhi);
+    b = lanes[0] > lanes[1] ? lanes[0] : lanes[1];
+  }
+#endif
+
+  for (; i < n; ++i) {
+    if (x[i] != x[i]) {
+      a = b = x[i];
+      break;
+    }
+    a = x[i] < a ? x[i] : a;
+    b = x[i] > b ? x[i] : b;
+  }
+  memcpy(lo, &a, sizeof a);
+  memcpy(hi, &b, sizeof b);
+}
+
+static void
+minmax_f32(const void *xp, int n, void *lo, void *hi)
+{
+  const float *x = xp;
+  float a = x[0], b = x[0];
+  int i = 0;
+#if PIC_SSE2
+  __m128 vlo = _mm_set1_ps(a), vhi = vlo, nan = _mm_setzero_ps(), v;
+  float lanes[4];
+  int k;
+
+  for (; i + 4 <= n; i += 4) {
+    v = _mm_loadu_ps(x + i);
+    vlo = _mm_min_ps(vlo, v);
+    vhi = _mm_max_ps(vhi, v);
+    nan = _mm_or_ps(nan, _mm_cmpunord_ps(v, v));
+  }
+  if (_mm_movemask_ps(nan) != 0) {
+    i = 0;
+  } else {
+    _mm_storeu_ps(lanes, vlo);
+    for (k = 0; k < 4; ++k) {
+      a = lanes[k] < a ? lanes[k] : a;
+    }
+    _mm_storeu_ps(lanes, vhi);
+    for (k = 0; k < 4; ++k) {
+      b = lanes[k] > b ? lanes[k] : b;
+    }
+  }
+#endif
+
+  for (; i < n; ++i) {
+    if (x[i] != x[i]) {
+      a = b = x[i];
+      break;
+    }
+    a = x[i] < a ? x[i] : a;
+    b = x[i] > b ? x[i] : b;
+  }
+  memcpy(lo, &a, sizeof a);
+  memcpy(hi, &b, sizeof b);
+}
+
+static const struct {
+  void (*arith)(int op, void *to, const void *x, const void *y, const void *z, int n);
+  i64 (*sum)(const void *x, const void *y, int n);
+  void (*minmax)(const void *x, int n, void *lo, void *hi);
+} uvec_ops[] = {
+  { arith_u8, sum_u8, minmax_u8 },
+  { arith_s8, sum_s8, minmax_s8 },
+  { arith_u16, sum_u16, minmax_u16 },
+  { arith_s16, sum_s16, minmax_s16 },
+  { arith_u32, sum_u32, minmax_u32 },
+  { arith_s32, sum_s32, minmax_s32 },
+  { arith_u64, sum_u64, minmax_u64 },
+  { arith_s64, sum_s64, minmax_s64 },
+  { arith_f32, NULL, minmax_f32 },
+  { arith_f64, NULL, minmax_f64 }
+};
+
+/* the elements of a numeric vector or bytevector of any kind */
+static unsigned char *
+uvec_any(pic_state *pic, pic_value v, int *kind, int *len)
+{
+  if (! pic_uvec_p(pic, v) && ! pic_blob_p(pic, v)) {
+    pic_error(pic, "numeric vector required", 1, v);
+  }
+  return pic_uvec(pic, v, kind, len);
+}
+
+/* the elements of an operand of the kind and length, or NULL for a number spread over chunk */
+static const unsigned char *
+uvec_operand(pic_state *pic, pic_value v, int kind, int len, unsigned char *chunk)
+{
+  int size = uvec_kinds[kind].size, n, i;
+  unsigned char *data;
+
+  if (pic_uvec_p(pic, v) || pic_blob_p(pic, v)) {
+    data = uvec_check(pic, v, kind, &n);
+    if (n != len) {
+      pic_error(pic, "numeric vectors of different lengths given", 1, v);
+    }
+    return data;
+  }
+  pic_uvec_store(pic, kind, chunk, 0, v);
+  for (i = 1; i < UVEC_CHUNK; ++i) {
+    memcpy(chunk + i * size, chunk, size);
+  }
+  return NULL;
+}
+
+static bool
+uvec_zero_p(const unsigned char *elt, int size)
+{
+  while (size-- > 0) {
+    if (*elt++ != 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/* (op x y [to]), (fma x y z [to]) and the comparisons */
+static pic_value
+pic_uvec_arith(pic_state *pic)
+{
+  double chunks[3][UVEC_CHUNK]; /* doubles, to align them */
+  const unsigned char *args[3], *ptrs[3];
+  pic_value *argv, to;
+  int op = uvec_kind(pic), arity = op == UVEC_FMA ? 3 : 2, argc, kind, size, len, n, k, i;
+  unsigned char *data;
+
+  pic_get_args(pic, "*", &argc, &argv);
+
+  if (argc != arity && argc != arity + 1) {
+    pic_error(pic, "wrong number of arguments", 1, pic_int_value(pic, argc));
+  }
+  args[0] = uvec_any(pic, argv[0], &kind, &len);
+  size = uvec_kinds[kind].size;
+  for (k = 1; k < arity; ++k) {
+    args[k] = uvec_operand(pic, argv[k], kind, len, (unsigned char *) chunks[k]);
+  }
+
+  if (op == UVEC_DIV && kind != PIC_UVEC_F32 && kind != PIC_UVEC_F64) {
+    data = args[1] ? (unsigned char *) args[1] : (unsigned char *) chunks[1];
+    for (i = 0; i < (args[1] ? len : 1); ++i) {
+      if (uvec_zero_p(data + i * size, size)) {
+        pic_error(pic, "division by zero", 1, argv[1]);
+      }
+    }
+  }
+
+  k = op >= UVEC_EQ ? PIC_UVEC_U8 : kind;
+  if (argc > arity) {
+    data = uvec_check(pic, to = argv[arity], k, &n);
+    if (n != len) {
+      pic_error(pic, "numeric vectors of different lengths given", 1, to);
+    }
+  } else {
+    data = pic_uvec(pic, to = pic_make_uvec(pic, k, len), NULL, NULL);
+  }
+
+  for (i = 0; i < len; i += n) {
+    n = len - i < UVEC_CHUNK ? len - i : UVEC_CHUNK;
+    for (k = 0; k < arity; ++k) {
+      ptrs[k] = args[k] ? args[k] + i * size : (unsigned char *) chunks[k];
+    }
+    uvec_ops[kind].arith(op, data + i * (op >= UVEC_EQ ? 1 : size), ptrs[0], ptrs[1], ptrs[arity - 1], n);
+  }
+  return to;
+}
+
+/* the sum of x, or of x times y, one boxed element at a time */
+static pic_value
+uvec_sum_boxed(pic_state *pic, int kind, const unsigned char *x, const unsigned char *y, int len)
+{
+  pic_value sum = pic_int_value(pic, 0), e;
+  size_t ai = pic_enter(pic);
+  int i;
+
+  for (i = 0; i < len; ++i) {
+    e = pic_uvec_load(pic, kind, x, i);
+    if (y != NULL) {
+      e = pic_mul(pic, e, pic_uvec_load(pic, kind, y, i));
+    }
+    sum = pic_add(pic, sum, e);
+    pic_leave(pic, ai);
+    pic_protect(pic, sum);
+  }
+  return sum;
+}
+
+static pic_value
+uvec_sum(pic_state *pic, int kind, const unsigned char *x, const unsigned char *y, int len)
+{
+  switch (kind) {
+  case PIC_UVEC_F32:
+    return pic_float_value(pic, fsum_f32((const float *) x, (const float *) y, len));
+  case PIC_UVEC_F64:
+    return pic_float_value(pic, fsum_f64((const double *) x, (const double *) y, len));
+  }
+#ifdef PIC_INT64_T
+  /* 2^31 elements of 32 bits, or products of 16 bits, fit in 63 bits */
+  if (uvec_kinds[kind].size <= (y == NULL ? 4 : 2)) {
+    i64 s = uvec_ops[kind].sum(x, y, len);
+    return uvec_int_value(pic, s < 0, s < 0 ? 0 - (u64) s : (u64) s);
+  }
+#endif
+  return uvec_sum_boxed(pic, kind, x, y, len);
+}
+
+static pic_value
+pic_uvec_sum(pic_state *pic)
+{
+  pic_value v;
+  int kind, len;
+  unsigned char *data;
+
+  pic_get_args(pic, "o", &v);
+
+  data = uvec_any(pic, v, &kind, &len);
+  return uvec_sum(pic, kind, data, NULL, len);
+}
+
+static pic_value
+pic_uvec_dot(pic_state *pic)
+{
+  pic_value v, w;
+  int kind, len, n;
+  unsigned char *x, *y;
+
+  pic_get_args(pic, "oo", &v, &w);
+
+  x = uvec_any(pic, v, &kind, &len);
+  y = uvec_check(pic, w, kind, &n);
+  if (n != len) {
+    pic_error(pic, "numeric vectors of different lengths given", 2, v, w);
+  }
+  return uvec_sum(pic, kind, x, y, len);
+}
+
+/* min if the closure holds 0, max if 1 */
+static pic_value
+pic_uvec_minmax(pic_state *pic)
+{
+  double elts[2];
+  pic_value v;
+  int kind, len;
+  unsigned char *data;
+
+  pic_get_args(pic, "o", &v);
+
+  data = uvec_any(pic, v, &kind, &len);
+  if (len == 0) {
+    pic_error(pic, "empty numeric vector given", 1, v);
+  }
+  uvec_ops[kind].minmax(data, len, &elts[0], &elts[1]);
+  return pic_uvec_load(pic, kind, (unsigned char *) &elts[uvec_kind(pic)], 0);
+}
+
+/* defines prefix ## tag ## suffix for the kind */
+static void
+uvec_defun(pic_state *pic, int kind, const char *prefix, const char *suffix, pic_func_t f)
+{
+  const char *tag = uvec_kinds[kind].tag;
+  char name[32];
+  size_t n = 0, l;
+  size_t ai = pic_enter(pic);
+
+  l = strlen(prefix);
+  memcpy(name + n, prefix, l);
+  n += l;
+  l = strlen(tag);
+  memcpy(name + n, tag, l);
+  n += l;
+  l = strlen(suffix);
+  memcpy(name + n, suffix, l + 1);
+
+  pic_define(pic, name, pic_lambda(pic, f, 1, pic_int_value(pic, kind)));
+  pic_leave(pic, ai);
+}
+
+void
+pic_init_uvector(pic_state *pic)
+{
+  static const char *const uvec_arith_names[] = {
+    "uvector-add", "uvector-sub", "uvector-mul", "uvector-div", "uvector-fma",
+    "uvector=", "uvector<", "uvector<=", "uvector>", "uvector>="
+  };
+  int kind, op;
+
+  for (kind = 0; kind < UVEC_KINDS; ++kind) {
+#ifndef PIC_INT64_T
+    if (kind == PIC_UVEC_U64 || kind == PIC_UVEC_S64) {
+      continue;
+    }
+#endif
+    uvec_defun(pic, kind, "", "vector?", pic_uvec_uvector_p);
+    uvec_defun(pic, kind, "make-", "vector", pic_uvec_make_uvector);
+    uvec_defun(pic, kind, "", "vector", pic_uvec_uvector);
+    uvec_defun(pic, kind, "", "vector-length", pic_uvec_uvector_length);
+    uvec_defun(pic, kind, "", "vector-ref", pic_uvec_uvector_ref);
+    uvec_defun(pic, kind, "", "vector-set!", pic_uvec_uvector_set);
+    uvec_defun(pic, kind, "", "vector->list", pic_uvec_uvector_to_list);
+    uvec_defun(pic, kind, "list->", "vector", pic_uvec_list_to_uvector);
+    uvec_defun(pic, kind, "", "vector->vector", pic_uvec_uvector_to_vector);
+    uvec_defun(pic, kind, "vector->", "vector", pic_uvec_vector_to_uvector);
+    uvec_defun(pic, kind, "", "vector-copy", pic_uvec_uvector_copy);
+    uvec_defun(pic, kind, "", "vector-copy!", pic_uvec_uvector_copy_i);
+    uvec_defun(pic, kind, "", "vector-append", pic_uvec_uvector_append);
+    uvec_defun(pic, kind, "", "vector-fill!", pic_uvec_uvector_fill_i);
+  }
+
+  for (op = UVEC_ADD; op <= UVEC_GE; ++op) {
+    pic_define(pic, uvec_arith_names[op], pic_lambda(pic, pic_uvec_arith, 1, pic_int_value(pic, op)));
+  }
+  pic_define(pic, "uvector-scale", pic_lambda(pic, pic_uvec_arith, 1, pic_int_value(pic, UVEC_MUL)));
+  pic_define(pic, "uvector-min", pic_lambda(pic, pic_uvec_minmax, 1, pic_int_value(pic, 0)));
+  pic_define(pic, "uvector-max", pic_lambda(pic, pic_uvec_minmax, 1, pic_int_value(pic, 1)));
+  pic_defun(pic, "uvector-sum", pic_uvec_sum);
+  pic_defun(pic, "uvector-dot", pic_uvec_dot);
+}
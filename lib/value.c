@@ -6,7 +6,7 @@
 #include "value.h"
 #include "state.h"
 
-int
+long
 pic_int(pic_state *PIC_UNUSED(pic), pic_value v)
 {
   assert(pic_int_p(pic, v));
@@ -20,7 +20,7 @@ pic_float(pic_state *PIC_UNUSED(pic), pic_value v)
   return value_float(&v);
 }
 
-char
+int
 pic_char(pic_state *PIC_UNUSED(pic), pic_value v)
 {
   assert(pic_char_p(pic, v));
@@ -41,9 +41,10 @@ pic_type(pic_state *PIC_UNUSED(pic), pic_value v)
 }
 
 pic_value
-pic_int_value(pic_state *PIC_UNUSED(pic), int i)
+pic_int_value(pic_state *PIC_UNUSED(pic), long i)
 {
   pic_value v;
+  assert(PIC_INT_MIN <= i && i <= PIC_INT_MAX);
   make_int_value(&v, i);
   return v;
 }
@@ -57,7 +58,7 @@ pic_float_value(pic_state *PIC_UNUSED(pic), double f)
 }
 
 pic_value
-pic_char_value(pic_state *PIC_UNUSED(pic), char c)
+pic_char_value(pic_state *PIC_UNUSED(pic), int c)
 {
   pic_value v;
   make_char_value(&v, c);
@@ -114,11 +115,16 @@ DEFPRED(pic_blob_p, PIC_TYPE_BLOB)
 DEFPRED(pic_dict_p, PIC_TYPE_DICT)
 DEFPRED(pic_attr_p, PIC_TYPE_ATTR)
 DEFPRED(pic_rec_p, PIC_TYPE_RECORD)
+DEFPRED(pic_rectype_p, PIC_TYPE_RECORD_TYPE)
+DEFPRED(pic_table_p, PIC_TYPE_TABLE)
+DEFPRED(pic_array_p, PIC_TYPE_ARRAY)
+DEFPRED(pic_uvec_p, PIC_TYPE_UVECTOR)
 DEFPRED(pic_sym_p, PIC_TYPE_SYMBOL)
 DEFPRED(pic_pair_p, PIC_TYPE_PAIR)
 DEFPRED(pic_proc_func_p, PIC_TYPE_PROC_FUNC)
 DEFPRED(pic_proc_irep_p, PIC_TYPE_PROC_IREP)
 DEFPRED(pic_irep_p, PIC_TYPE_IREP)
+DEFPRED(pic_big_p, PIC_TYPE_BIGNUM)
 
 bool
 pic_bool_p(pic_state *pic, pic_value v)
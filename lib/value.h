@@ -36,6 +36,11 @@ enum {
   PIC_TYPE_PROC_IREP = 28,
   PIC_TYPE_ROPE_LEAF = 29,
   PIC_TYPE_ROPE_NODE = 30,
+  PIC_TYPE_BIGNUM    = 31,
+  PIC_TYPE_RECORD_TYPE = 32,
+  PIC_TYPE_TABLE     = 33,
+  PIC_TYPE_ARRAY     = 34,
+  PIC_TYPE_UVECTOR   = 35,
   PIC_TYPE_MAX       = 63
 };
 
@@ -50,7 +55,7 @@ make_value(struct value *v, int type)
 }
 
 PIC_STATIC_INLINE void
-make_int_value(struct value *v, int i)
+make_int_value(struct value *v, long i)
 {
   make_value(v, PIC_TYPE_INT);
   v->u.i = i;
@@ -64,7 +69,7 @@ make_float_value(struct value *v, double f)
 }
 
 PIC_STATIC_INLINE void
-make_char_value(struct value *v, char c)
+make_char_value(struct value *v, int c)
 {
   make_value(v, PIC_TYPE_CHAR);
   v->u.c = c;
@@ -83,7 +88,7 @@ value_type(struct value *v)
   return (int)(v->type);
 }
 
-PIC_STATIC_INLINE int
+PIC_STATIC_INLINE long
 value_int(struct value *v)
 {
   return v->u.i;
@@ -95,7 +100,7 @@ value_float(struct value *v)
   return v->u.f;
 }
 
-PIC_STATIC_INLINE char
+PIC_STATIC_INLINE int
 value_char(struct value *v)
 {
   return v->u.c;
@@ -125,7 +130,7 @@ value_eqv_p(struct value *x, struct value *y)
  * value representation by nan-boxing:
  *   float : FFFFFFFFFFFFFFFF FFFFFFFFFFFFFFFF FFFFFFFFFFFFFFFF FFFFFFFFFFFFFFFF
  *   ptr   : 111111111111TTTT TTPPPPPPPPPPPPPP PPPPPPPPPPPPPPPP PPPPPPPPPPPPPPPP
- *   int   : 111111111111TTTT TT00000000000000 IIIIIIIIIIIIIIII IIIIIIIIIIIIIIII
+ *   int   : 111111111111TTTT TTIIIIIIIIIIIIII IIIIIIIIIIIIIIII IIIIIIIIIIIIIIII
  *   char  : 111111111111TTTT TT00000000000000 CCCCCCCCCCCCCCCC CCCCCCCCCCCCCCCC
  */
 
@@ -136,10 +141,10 @@ make_value(struct value *v, int type)
 }
 
 PIC_STATIC_INLINE void
-make_int_value(struct value *v, int i)
+make_int_value(struct value *v, long i)
 {
   make_value(v, PIC_TYPE_INT);
-  v->v |= (unsigned)i;
+  v->v |= 0x3ffffffffffful & (uint64_t)i;
 }
 
 PIC_STATIC_INLINE void
@@ -155,10 +160,10 @@ make_float_value(struct value *v, double f)
 }
 
 PIC_STATIC_INLINE void
-make_char_value(struct value *v, char c)
+make_char_value(struct value *v, int c)
 {
   make_value(v, PIC_TYPE_CHAR);
-  v->v |= (unsigned char)c;
+  v->v |= (unsigned)c;
 }
 
 PIC_STATIC_INLINE void
@@ -174,12 +179,11 @@ value_type(struct value *v)
   return 0xfff0000000000000ul >= v->v ? PIC_TYPE_FLOAT : ((v->v >> 46) & 0x3f);
 }
 
-PIC_STATIC_INLINE int
+PIC_STATIC_INLINE long
 value_int(struct value *v)
 {
-  union { int i; unsigned u; } u;
-  u.u = v->v & 0xfffffffful;
-  return u.i;
+  /* sign-extend the 46-bit payload */
+  return (long)((int64_t)(v->v << 18) >> 18);
 }
 
 PIC_STATIC_INLINE double
@@ -190,7 +194,7 @@ value_float(struct value *v)
   return u.f;
 }
 
-PIC_STATIC_INLINE char
+PIC_STATIC_INLINE int
 value_char(struct value *v)
 {
   return v->v & 0xfffffffful;
@@ -238,12 +242,17 @@ DEFPRED(blob, PIC_TYPE_BLOB)
 DEFPRED(dict, PIC_TYPE_DICT)
 DEFPRED(attr, PIC_TYPE_ATTR)
 DEFPRED(rec, PIC_TYPE_RECORD)
+DEFPRED(rectype, PIC_TYPE_RECORD_TYPE)
+DEFPRED(table, PIC_TYPE_TABLE)
+DEFPRED(array, PIC_TYPE_ARRAY)
+DEFPRED(uvec, PIC_TYPE_UVECTOR)
 DEFPRED(sym, PIC_TYPE_SYMBOL)
 DEFPRED(pair, PIC_TYPE_PAIR)
 DEFPRED(proc_func, PIC_TYPE_PROC_FUNC)
 DEFPRED(proc_irep, PIC_TYPE_PROC_IREP)
 DEFPRED(irep, PIC_TYPE_IREP)
 DEFPRED(data, PIC_TYPE_DATA)
+DEFPRED(big, PIC_TYPE_BIGNUM)
 
 #undef DEFPRED
 
@@ -260,7 +269,9 @@ pic_value pic_obj_value(pic_state *, void *, int);
 bool pic_invalid_p(pic_state *, pic_value);
 bool pic_attr_p(pic_state *, pic_value);
 bool pic_rec_p(pic_state *, pic_value);
+bool pic_rectype_p(pic_state *, pic_value);
 bool pic_irep_p(pic_state *, pic_value);
+bool pic_big_p(pic_state *, pic_value);
 bool pic_proc_func_p(pic_state *, pic_value);
 bool pic_proc_irep_p(pic_state *, pic_value);
 bool pic_obj_p(pic_state *, pic_value);
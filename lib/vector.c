@@ -5,6 +5,7 @@
 #include <picrin.h>
 #include "value.h"
 #include "object.h"
+#include "state.h"
 
 pic_value
 pic_make_vec(pic_state *pic, int len, pic_value *argv)
@@ -15,6 +16,7 @@ pic_make_vec(pic_state *pic, int len, pic_value *argv)
   vec = (struct vector *)pic_obj_alloc(pic, PIC_TYPE_VECTOR);
   vec->len = len;
   vec->data = (pic_value *)pic_malloc(pic, sizeof(pic_value) * len);
+  pic_obj_charge(pic, (struct object *) vec, sizeof(pic_value) * len);
   if (argv == NULL) {
     for (i = 0; i < len; ++i) {
       vec->data[i] = pic_undef_value(pic);
@@ -222,45 +224,72 @@ pic_vec_vector_fill_i(pic_state *pic)
   return pic_undef_value(pic);
 }
 
-static pic_value
-pic_vec_vector_map(pic_state *pic)
-{
-  int argc, i, len, j;
-  pic_value proc, *argv, vec, vals;
+/* feeds vector-map and vector-for-each, storing results in ret unless it is #f */
+struct vec_each {
+  pic_value *vecs, ret;
+  int n, i, len;
+};
 
-  pic_get_args(pic, "l*", &proc, &argc, &argv);
+static bool
+vec_each(pic_state *pic, void *data, pic_value result, pic_value *argv)
+{
+  struct vec_each *e = data;
+  int j;
 
-  if (argc == 0) {
-    pic_error(pic, "vector-map: wrong number of arguments (1 for at least 2)", 0);
+  if (e->i > 0 && ! pic_false_p(pic, e->ret)) {
+    pic_vec_set(pic, e->ret, e->i - 1, result);
+  }
+  if (e->i == e->len) {
+    return false;
   }
+  for (j = 0; j < e->n; ++j) {
+    argv[j] = pic_vec_ref(pic, e->vecs[j], e->i);
+  }
+  e->i++;
+  return true;
+}
+
+static void
+vec_each_init(pic_state *pic, struct vec_each *e, int argc, pic_value *argv)
+{
+  int i, l;
 
-  len = INT_MAX;
+  e->vecs = argv;
+  e->n = argc;
+  e->i = 0;
+  e->len = INT_MAX;
   for (i = 0; i < argc; ++i) {
-    int l;
     TYPE_CHECK(pic, argv[i], vec);
     l = pic_vec_len(pic, argv[i]);
-    len = len < l ? len : l;
+    e->len = e->len < l ? e->len : l;
   }
+}
 
-  vec = pic_make_vec(pic, len, NULL);
+static pic_value
+pic_vec_vector_map(pic_state *pic)
+{
+  int argc;
+  pic_value proc, *argv;
+  struct vec_each e;
 
-  for (i = 0; i < len; ++i) {
-    vals = pic_nil_value(pic);
-    for (j = 0; j < argc; ++j) {
-      pic_push(pic, pic_vec_ref(pic, argv[j], i), vals);
-    }
-    vals = pic_reverse(pic, vals);
-    pic_vec_set(pic, vec, i, pic_funcall(pic, "apply", 2, proc, vals));
+  pic_get_args(pic, "l*", &proc, &argc, &argv);
+
+  if (argc == 0) {
+    pic_error(pic, "vector-map: wrong number of arguments (1 for at least 2)", 0);
   }
 
-  return vec;
+  vec_each_init(pic, &e, argc, argv);
+  e.ret = pic_make_vec(pic, e.len, NULL);
+  pic_call_each(pic, proc, argc, vec_each, &e);
+  return e.ret;
 }
 
 static pic_value
 pic_vec_vector_for_each(pic_state *pic)
 {
-  int argc, i, len, j;
-  pic_value proc, *argv, vals;
+  int argc;
+  pic_value proc, *argv;
+  struct vec_each e;
 
   pic_get_args(pic, "l*", &proc, &argc, &argv);
 
@@ -268,23 +297,9 @@ pic_vec_vector_for_each(pic_state *pic)
     pic_error(pic, "vector-for-each: wrong number of arguments (1 for at least 2)", 0);
   }
 
-  len = INT_MAX;
-  for (i = 0; i < argc; ++i) {
-    int l;
-    TYPE_CHECK(pic, argv[i], vec);
-    l = pic_vec_len(pic, argv[i]);
-    len = len < l ? len : l;
-  }
-
-  for (i = 0; i < len; ++i) {
-    vals = pic_nil_value(pic);
-    for (j = 0; j < argc; ++j) {
-      pic_push(pic, pic_vec_ref(pic, argv[j], i), vals);
-    }
-    vals = pic_reverse(pic, vals);
-    pic_funcall(pic, "apply", 2, proc, vals);
-  }
-
+  vec_each_init(pic, &e, argc, argv);
+  e.ret = pic_false_value(pic);
+  pic_call_each(pic, proc, argc, vec_each, &e);
   return pic_undef_value(pic);
 }
 
@@ -337,7 +352,7 @@ pic_vec_vector_to_string(pic_state *pic)
 {
   pic_value vec, t;
   char *buf;
-  int n, start, end, i, len;
+  int n, start, end, i, len, k = 0;
 
   n = pic_get_args(pic, "v|ii", &vec, &start, &end);
 
@@ -352,28 +367,28 @@ pic_vec_vector_to_string(pic_state *pic)
 
   VALID_RANGE(pic, len, start, end);
 
-  buf = pic_alloca(pic, end - start);
+  buf = pic_alloca(pic, (size_t) (end - start) * 4);
   for (i = start; i < end; ++i) {
     t = pic_vec_ref(pic, vec, i);
 
     TYPE_CHECK(pic, t, char);
 
-    buf[i - start] = pic_char(pic, t);
+    k += pic_utf8_encode(pic_char(pic, t), buf + k);
   }
 
-  return pic_str_value(pic, buf, end - start);
+  return pic_str_value(pic, buf, k);
 }
 
 static pic_value
 pic_vec_string_to_vector(pic_state *pic)
 {
   pic_value str, vec;
-  int n, start, end, len, i;
+  int n, start, end, len, i, c, off, size;
   const char *buf;
 
   n = pic_get_args(pic, "s|ii", &str, &start, &end);
 
-  buf = pic_str(pic, str, &len);
+  len = pic_str_len(pic, str);
 
   switch (n) {
   case 1:
@@ -386,12 +401,448 @@ pic_vec_string_to_vector(pic_state *pic)
 
   vec = pic_make_vec(pic, end - start, NULL);
 
-  for (i = 0; i < end - start; ++i) {
-    pic_vec_set(pic, vec, i, pic_char_value(pic, buf[i + start]));
+  buf = pic_str(pic, str, &size);
+  for (i = 0, off = 0; i < end; ++i) {
+    off += pic_utf8_decode(buf + off, size - off, &c);
+    if (i >= start) {
+      pic_vec_set(pic, vec, i - start, pic_char_value(pic, c));
+    }
+  }
+  return vec;
+}
+
+/*
+ * Arrays
+ *
+ * A growable vector kept as a ring buffer, so that pushing and popping
+ * at either end takes amortized constant time. The capacity is a power
+ * of two and doubles when the array is full; growing also moves the
+ * elements back to the start of the buffer. Only live slots are marked.
+ */
+
+#define ARRAY_MIN_CAP 8
+
+#define array_slot(ary, i) ((ary)->data[((ary)->head + (i)) & ((ary)->cap - 1)])
+
+/* makes room for n more elements */
+static void
+array_reserve(pic_state *pic, struct array *ary, int n)
+{
+  pic_value *data;
+  int cap, first;
+
+  if (n <= ary->cap - ary->len) {
+    return;
+  }
+  if (n > INT_MAX / 2 - ary->len) {
+    pic_error(pic, "array too large", 0);
+  }
+  for (cap = ary->cap ? ary->cap * 2 : ARRAY_MIN_CAP; cap - ary->len < n; cap *= 2)
+    ;
+  data = pic_malloc(pic, sizeof(pic_value) * cap);
+  pic_obj_charge(pic, (struct object *) ary, sizeof(pic_value) * cap);
+  if (ary->len > 0) {
+    first = ary->cap - ary->head < ary->len ? ary->cap - ary->head : ary->len;
+    memcpy(data, ary->data + ary->head, sizeof(pic_value) * first);
+    memcpy(data + first, ary->data, sizeof(pic_value) * (ary->len - first));
+  }
+  pic_free(pic, ary->data);
+  ary->data = data;
+  ary->cap = cap;
+  ary->head = 0;
+}
+
+pic_value
+pic_make_array(pic_state *pic, int cap)
+{
+  struct array *ary;
+
+  ary = (struct array *)pic_obj_alloc(pic, PIC_TYPE_ARRAY);
+  ary->data = NULL;
+  ary->len = ary->cap = ary->head = 0;
+  array_reserve(pic, ary, cap);
+  return obj_value(pic, ary);
+}
+
+pic_value
+pic_array_ref(pic_state *pic, pic_value ary, int k)
+{
+  return array_slot(array_ptr(pic, ary), k);
+}
+
+void
+pic_array_set(pic_state *pic, pic_value ary, int k, pic_value val)
+{
+  array_slot(array_ptr(pic, ary), k) = val;
+}
+
+int
+pic_array_len(pic_state *pic, pic_value ary)
+{
+  return array_ptr(pic, ary)->len;
+}
+
+void
+pic_array_push(pic_state *pic, pic_value ary, pic_value val)
+{
+  struct array *a = array_ptr(pic, ary);
+
+  array_reserve(pic, a, 1);
+  array_slot(a, a->len) = val;
+  a->len++;
+}
+
+pic_value
+pic_array_pop(pic_state *pic, pic_value ary)
+{
+  struct array *a = array_ptr(pic, ary);
+
+  if (a->len == 0) {
+    pic_error(pic, "array-pop!: empty array", 1, ary);
+  }
+  a->len--;
+  return array_slot(a, a->len);
+}
+
+void
+pic_array_unshift(pic_state *pic, pic_value ary, pic_value val)
+{
+  struct array *a = array_ptr(pic, ary);
+
+  array_reserve(pic, a, 1);
+  a->head = (a->head - 1) & (a->cap - 1);
+  a->data[a->head] = val;
+  a->len++;
+}
+
+pic_value
+pic_array_shift(pic_state *pic, pic_value ary)
+{
+  struct array *a = array_ptr(pic, ary);
+  pic_value val;
+
+  if (a->len == 0) {
+    pic_error(pic, "array-shift!: empty array", 1, ary);
+  }
+  val = a->data[a->head];
+  a->head = (a->head + 1) & (a->cap - 1);
+  a->len--;
+  return val;
+}
+
+/* appends the elements of a vector, a list or an array */
+static void
+array_append(pic_state *pic, struct array *ary, pic_value seq)
+{
+  struct array *src;
+  pic_value e, it;
+  int i, n;
+
+  if (pic_vec_p(pic, seq)) {
+    n = pic_vec_len(pic, seq);
+    array_reserve(pic, ary, n);
+    for (i = 0; i < n; ++i) {
+      array_slot(ary, ary->len + i) = vec_ptr(pic, seq)->data[i];
+    }
+  } else if (pic_array_p(pic, seq)) {
+    src = array_ptr(pic, seq);
+    n = src->len;
+    array_reserve(pic, ary, n);
+    for (i = 0; i < n; ++i) {
+      array_slot(ary, ary->len + i) = array_slot(src, i);
+    }
+  } else if (pic_list_p(pic, seq)) {
+    n = pic_length(pic, seq);
+    array_reserve(pic, ary, n);
+    i = 0;
+    pic_for_each (e, seq, it) {
+      array_slot(ary, ary->len + i++) = e;
+    }
+  } else {
+    pic_error(pic, "array-append!: vector, list or array required", 1, seq);
+  }
+  ary->len += n;
+}
+
+static pic_value
+pic_vec_array_p(pic_state *pic)
+{
+  pic_value v;
+
+  pic_get_args(pic, "o", &v);
+
+  return pic_bool_value(pic, pic_array_p(pic, v));
+}
+
+static pic_value
+pic_vec_make_array(pic_state *pic)
+{
+  int n, cap;
+
+  n = pic_get_args(pic, "|i", &cap);
+
+  if (n == 0) {
+    cap = 0;
+  }
+  if (cap < 0) {
+    pic_error(pic, "make-array: negative capacity given", 1, pic_int_value(pic, cap));
+  }
+  return pic_make_array(pic, cap);
+}
+
+static pic_value
+pic_vec_array(pic_state *pic)
+{
+  pic_value *argv, ary;
+  int argc, i;
+
+  pic_get_args(pic, "*", &argc, &argv);
+
+  ary = pic_make_array(pic, argc);
+  for (i = 0; i < argc; ++i) {
+    pic_array_push(pic, ary, argv[i]);
+  }
+  return ary;
+}
+
+static pic_value
+pic_vec_array_length(pic_state *pic)
+{
+  pic_value ary;
+
+  pic_get_args(pic, "o", &ary);
+
+  TYPE_CHECK(pic, ary, array);
+
+  return pic_int_value(pic, pic_array_len(pic, ary));
+}
+
+static pic_value
+pic_vec_array_ref(pic_state *pic)
+{
+  pic_value ary;
+  int k;
+
+  pic_get_args(pic, "oi", &ary, &k);
+
+  TYPE_CHECK(pic, ary, array);
+  VALID_INDEX(pic, pic_array_len(pic, ary), k);
+
+  return pic_array_ref(pic, ary, k);
+}
+
+static pic_value
+pic_vec_array_set(pic_state *pic)
+{
+  pic_value ary, obj;
+  int k;
+
+  pic_get_args(pic, "oio", &ary, &k, &obj);
+
+  TYPE_CHECK(pic, ary, array);
+  VALID_INDEX(pic, pic_array_len(pic, ary), k);
+
+  pic_array_set(pic, ary, k, obj);
+  return pic_undef_value(pic);
+}
+
+static pic_value
+pic_vec_array_push(pic_state *pic)
+{
+  pic_value ary, obj;
+
+  pic_get_args(pic, "oo", &ary, &obj);
+
+  TYPE_CHECK(pic, ary, array);
+
+  pic_array_push(pic, ary, obj);
+  return pic_undef_value(pic);
+}
+
+static pic_value
+pic_vec_array_pop(pic_state *pic)
+{
+  pic_value ary;
+
+  pic_get_args(pic, "o", &ary);
+
+  TYPE_CHECK(pic, ary, array);
+
+  return pic_array_pop(pic, ary);
+}
+
+static pic_value
+pic_vec_array_unshift(pic_state *pic)
+{
+  pic_value ary, obj;
+
+  pic_get_args(pic, "oo", &ary, &obj);
+
+  TYPE_CHECK(pic, ary, array);
+
+  pic_array_unshift(pic, ary, obj);
+  return pic_undef_value(pic);
+}
+
+static pic_value
+pic_vec_array_shift(pic_state *pic)
+{
+  pic_value ary;
+
+  pic_get_args(pic, "o", &ary);
+
+  TYPE_CHECK(pic, ary, array);
+
+  return pic_array_shift(pic, ary);
+}
+
+static pic_value
+pic_vec_array_append_i(pic_state *pic)
+{
+  pic_value ary, *argv;
+  int argc, i;
+
+  pic_get_args(pic, "o*", &ary, &argc, &argv);
+
+  TYPE_CHECK(pic, ary, array);
+
+  for (i = 0; i < argc; ++i) {
+    array_append(pic, array_ptr(pic, ary), argv[i]);
+  }
+  return pic_undef_value(pic);
+}
+
+static pic_value
+pic_vec_array_clear_i(pic_state *pic)
+{
+  pic_value ary;
+
+  pic_get_args(pic, "o", &ary);
+
+  TYPE_CHECK(pic, ary, array);
+
+  array_ptr(pic, ary)->len = 0;
+  array_ptr(pic, ary)->head = 0;
+  return pic_undef_value(pic);
+}
+
+/* feeds array-map and array-for-each, storing results in ret unless it is #f */
+struct array_each {
+  pic_value ary, ret;
+  int i;
+};
+
+static bool
+array_each(pic_state *pic, void *data, pic_value result, pic_value *argv)
+{
+  struct array_each *e = data;
+
+  if (e->i > 0 && ! pic_false_p(pic, e->ret)) {
+    pic_array_push(pic, e->ret, result);
+  }
+  if (e->i >= pic_array_len(pic, e->ary)) {
+    return false;
+  }
+  argv[0] = pic_array_ref(pic, e->ary, e->i++);
+  return true;
+}
+
+static pic_value
+pic_vec_array_map(pic_state *pic)
+{
+  pic_value proc, ary;
+  struct array_each e;
+
+  pic_get_args(pic, "lo", &proc, &ary);
+
+  TYPE_CHECK(pic, ary, array);
+
+  e.ary = ary;
+  e.ret = pic_make_array(pic, pic_array_len(pic, ary));
+  e.i = 0;
+  pic_call_each(pic, proc, 1, array_each, &e);
+  return e.ret;
+}
+
+static pic_value
+pic_vec_array_for_each(pic_state *pic)
+{
+  pic_value proc, ary;
+  struct array_each e;
+
+  pic_get_args(pic, "lo", &proc, &ary);
+
+  TYPE_CHECK(pic, ary, array);
+
+  e.ary = ary;
+  e.ret = pic_false_value(pic);
+  e.i = 0;
+  pic_call_each(pic, proc, 1, array_each, &e);
+  return pic_undef_value(pic);
+}
+
+static pic_value
+pic_vec_array_to_list(pic_state *pic)
+{
+  pic_value ary, list;
+  int i;
+
+  pic_get_args(pic, "o", &ary);
+
+  TYPE_CHECK(pic, ary, array);
+
+  list = pic_nil_value(pic);
+  for (i = pic_array_len(pic, ary); i > 0; --i) {
+    pic_push(pic, pic_array_ref(pic, ary, i - 1), list);
+  }
+  return list;
+}
+
+static pic_value
+pic_vec_array_to_vector(pic_state *pic)
+{
+  pic_value ary, vec;
+  int i, len;
+
+  pic_get_args(pic, "o", &ary);
+
+  TYPE_CHECK(pic, ary, array);
+
+  len = pic_array_len(pic, ary);
+  vec = pic_make_vec(pic, len, NULL);
+  for (i = 0; i < len; ++i) {
+    pic_vec_set(pic, vec, i, pic_array_ref(pic, ary, i));
   }
   return vec;
 }
 
+static pic_value
+pic_vec_list_to_array(pic_state *pic)
+{
+  pic_value list, ary;
+
+  pic_get_args(pic, "o", &list);
+
+  if (! pic_list_p(pic, list)) {
+    pic_error(pic, "list required", 1, list);
+  }
+  ary = pic_make_array(pic, 0);
+  array_append(pic, array_ptr(pic, ary), list);
+  return ary;
+}
+
+static pic_value
+pic_vec_vector_to_array(pic_state *pic)
+{
+  pic_value vec, ary;
+
+  pic_get_args(pic, "v", &vec);
+
+  ary = pic_make_array(pic, 0);
+  array_append(pic, array_ptr(pic, ary), vec);
+  return ary;
+}
+
 void
 pic_init_vector(pic_state *pic)
 {
@@ -411,4 +862,22 @@ pic_init_vector(pic_state *pic)
   pic_defun(pic, "vector->list", pic_vec_vector_to_list);
   pic_defun(pic, "string->vector", pic_vec_string_to_vector);
   pic_defun(pic, "vector->string", pic_vec_vector_to_string);
+  pic_defun(pic, "array?", pic_vec_array_p);
+  pic_defun(pic, "make-array", pic_vec_make_array);
+  pic_defun(pic, "array", pic_vec_array);
+  pic_defun(pic, "array-length", pic_vec_array_length);
+  pic_defun(pic, "array-ref", pic_vec_array_ref);
+  pic_defun(pic, "array-set!", pic_vec_array_set);
+  pic_defun(pic, "array-push!", pic_vec_array_push);
+  pic_defun(pic, "array-pop!", pic_vec_array_pop);
+  pic_defun(pic, "array-unshift!", pic_vec_array_unshift);
+  pic_defun(pic, "array-shift!", pic_vec_array_shift);
+  pic_defun(pic, "array-append!", pic_vec_array_append_i);
+  pic_defun(pic, "array-clear!", pic_vec_array_clear_i);
+  pic_defun(pic, "array-map", pic_vec_array_map);
+  pic_defun(pic, "array-for-each", pic_vec_array_for_each);
+  pic_defun(pic, "array->list", pic_vec_array_to_list);
+  pic_defun(pic, "array->vector", pic_vec_array_to_vector);
+  pic_defun(pic, "list->array", pic_vec_list_to_array);
+  pic_defun(pic, "vector->array", pic_vec_vector_to_array);
 }
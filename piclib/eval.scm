@@ -111,7 +111,9 @@
              core#lambda
              core#if
              core#begin
-             core#define-macro))
+             core#define-macro
+             core#record-ref
+             core#record-set!))
           (lambda ()
             env)))
 
@@ -602,29 +604,45 @@
           (let ((type (car (cdr form)))
                 (ctor (car (cdr (cdr form))))
                 (pred (car (cdr (cdr (cdr form)))))
-                (fields (cdr (cdr (cdr (cdr form))))))
+                (fields (cdr (cdr (cdr (cdr form)))))
+                (rtd (the 'rtd)))
+
+            ;; every procedure closes over the descriptor itself, so that
+            ;; the constructor may share its name with the type
+            (define (with-rtd proc)
+              `(,(the 'let) ((,rtd ,type)) ,proc))
+
+            ;; field i of a record of this type, checked by the VM
+            (define (field-ref pos)
+              (if (< pos 256)
+                  `(,(the 'core#record-ref) obj ,rtd ,pos)
+                  `(,(the 'record-ref) obj ,rtd ,pos)))
+
+            (define (field-set! pos)
+              (if (< pos 256)
+                  `(,(the 'core#record-set!) obj ,rtd ,pos value)
+                  `(,(the 'record-set!) obj ,rtd ,pos value)))
+
             `(,the-begin
-              (,the-define ,ctor
-                           (,(the 'make-record) ',type
-                            (,(the 'vector) . ,(map (lambda (field) (if (memq (car field) (cdr ctor)) (car field) #undefined)) fields))))
+              (,the-define ,type
+                           (,(the 'make-record-type) ',type ',(map car fields)))
               (,the-define ,pred
-                           (,(the 'lambda) (obj)
-                            (,(the 'and) (,(the 'record?) obj) (,(the 'eq?) (,(the 'record-type) obj) ',type))))
-              . ,(let loop ((fields fields) (pos 0) (acc '()))
-                   (if (null? fields)
-                       acc
-                       (let ((field (car fields)))
-                         (let ((defs `((,the-define (,(cadr field) obj)
-                                                    (,the-if (,pred obj)
-                                                             (,(the 'vector-ref) (,(the 'record-datum) obj) ,pos)
-                                                             (,(the 'error) "record type mismatch" obj ',type)))
-                                       . ,(if (null? (cddr field))
-                                              '()
-                                              `((,the-define (,(car (cddr field)) obj value)
-                                                             (,the-if (,pred obj)
-                                                                      (,(the 'vector-set!) (,(the 'record-datum) obj) ,pos value)
-                                                                      (,(the 'error) "record type mismatch" obj ',type))))))))
-                           (loop (cdr fields) (+ pos 1) `(,@defs . ,acc))))))))))
+                           ,(with-rtd `(,the-lambda (obj) (,(the 'record?) obj ,rtd))))
+              ,@(let loop ((fields fields) (pos 0) (acc '()))
+                  (if (null? fields)
+                      acc
+                      (let ((field (car fields)))
+                        (let ((defs `((,the-define ,(cadr field)
+                                                   ,(with-rtd `(,the-lambda (obj) ,(field-ref pos))))
+                                      . ,(if (null? (cddr field))
+                                             '()
+                                             `((,the-define ,(car (cddr field))
+                                                            ,(with-rtd `(,the-lambda (obj value) ,(field-set! pos)))))))))
+                          (loop (cdr fields) (+ pos 1) `(,@defs . ,acc))))))
+              (,the-define ,(car ctor)
+                           ,(with-rtd
+                             `(,the-lambda ,(cdr ctor)
+                               (,(the 'make-record) ,rtd . ,(map (lambda (field) (if (memq (car field) (cdr ctor)) (car field) #undefined)) fields)))))))))
 
       (define-transformer 'include
         (letrec ((read-file
@@ -648,6 +666,7 @@
 
       (define (caddr x) (car (cddr x)))
       (define (cadddr x) (cadr (cddr x)))
+      (define (cddddr x) (cddr (cddr x)))
       (define (max a b) (if (< a b) b a))
       (define (integer? n) (and (number? n) (exact? n)))
 
@@ -683,6 +702,8 @@
                 ((core#set!) `(set! ,(cadr e) ,(normalize (caddr e))))
                 ((core#if) `(if . ,(map normalize (cdr e))))
                 ((core#begin) `(begin . ,(map normalize (cdr e))))
+                ((core#record-ref) `(record-ref ,(cadddr e) ,(normalize (cadr e)) ,(normalize (caddr e))))
+                ((core#record-set!) `(record-set! ,(cadddr e) ,(normalize (cadr e)) ,(normalize (caddr e)) ,(normalize (car (cddddr e)))))
                 (else
                  (map normalize e))))))
 
@@ -698,11 +719,13 @@
           ;; E ::= A
           ;;     | (if A E E)
           ;;     | (set! v A E)
+          ;;     | (record-set! i A A A E)
           ;;     | (A A ...)
           ;; A ::= (lambda (var ...) E)
           ;;     | (ref v)
           ;;     | (quote x)
           ;;     | (undefined)
+          ;;     | (record-ref i A A)
 
           (define uniq
             (let ((n 0))
@@ -714,6 +737,12 @@
           (define (transform-k e k)
             (case (car e)
               ((ref lambda quote) (k (transform-v e)))
+              ((record-ref) (transform*-k (cddr e)
+                                          (lambda (args)
+                                            (k `(record-ref ,(cadr e) . ,args)))))
+              ((record-set!) (transform*-k (cddr e)
+                                           (lambda (args)
+                                             `(record-set! ,(cadr e) ,@args ,(k '(undefined))))))
               ((begin) (transform-k (cadr e)
                                     (lambda (_)
                                       (transform-k (caddr e) k))))
@@ -750,6 +779,12 @@
           (define (transform-c e c)
             (case (car e)
               ((ref lambda quote) `(,c ,(transform-v e)))
+              ((record-ref) (transform*-k (cddr e)
+                                          (lambda (args)
+                                            `(,c (record-ref ,(cadr e) . ,args)))))
+              ((record-set!) (transform*-k (cddr e)
+                                           (lambda (args)
+                                             `(record-set! ,(cadr e) ,@args (,c (undefined))))))
               ((begin) (transform-k (cadr e)
                                     (lambda (_)
                                       (transform-c (caddr e) c))))
@@ -837,9 +872,27 @@
           (define (emit-label label)
             (code (cons label (code))))
 
+          ;; registers needed to evaluate e into register i; a record-ref
+          ;; takes its record and type in i and i + 1
+          (define (frame-size-a e i)
+            (if (eq? 'record-ref (car e))
+                (max (frame-size-a (caddr e) i) (frame-size-a (cadddr e) (+ i 1)))
+                (+ i 1)))
+
+          (define (frame-size-a* es i)
+            (if (null? es)
+                i
+                (max (frame-size-a (car es) i) (frame-size-a* (cdr es) (+ i 1)))))
+
           (define (codegen-e e)
             (case (car e)
-              ((ref lambda quote undefined) (codegen-a e 0))
+              ((ref lambda quote undefined record-ref) (codegen-a e 0))
+              ((record-set!) (let ((args (cddr e)))
+                               (codegen-a (car args) 0)
+                               (codegen-a (cadr args) 1)
+                               (codegen-a (caddr args) 2)
+                               (emit `(RSET 0 ,(cadr e)))
+                               (codegen-e (cadddr args))))
               ((set!) (begin
                         (codegen-a (caddr e) 0)
                         (let ((x (lookup (cadr e) (env))))
@@ -878,13 +931,21 @@
                                (else (let ((n (emit-obj obj)))
                                        (emit `(LOAD ,i ,n)))))))
               ((undefined) (emit `(LOADU ,i)))
+              ((record-ref) (begin
+                              (codegen-a (caddr e) i)
+                              (codegen-a (cadddr e) (+ i 1))
+                              (emit `(RREF ,i ,(cadr e)))))
               ((lambda) (let ((frame-size
                                (let loop ((e (caddr e)))
                                  (case (car e)
-                                   ((ref lambda quote undefined) 1)
-                                   ((if) (max (loop (caddr e)) (loop (cadddr e))))
-                                   ((set!) (loop (cadddr e)))
-                                   (else (+ 1 (length e))))))
+                                   ((ref lambda quote undefined record-ref) (frame-size-a e 0))
+                                   ((if) (max (frame-size-a (cadr e) 0)
+                                              (max (loop (caddr e)) (loop (cadddr e)))))
+                                   ((set!) (max (frame-size-a (caddr e) 0) (loop (cadddr e))))
+                                   ((record-set!) (let ((args (cddr e)))
+                                                    (max (frame-size-a* (list (car args) (cadr args) (caddr args)) 0)
+                                                         (loop (cadddr args)))))
+                                   (else (max (+ 1 (length e)) (frame-size-a* e 0))))))
                               (argc-varg
                                (let loop ((args (cadr e)) (c 0))
                                  (if (symbol? args)
@@ -0,0 +1,68 @@
+(import (scheme base)
+        (picrin base)
+        (picrin test))
+
+(test-begin)
+
+(define (fact n)
+  (let loop ((i 1) (acc 1))
+    (if (> i n)
+        acc
+        (loop (+ i 1) (* acc i)))))
+
+;; results that leave the fixnum range stay exact
+
+(test 265252859812191058636308480000000 (fact 30))
+(test #t (exact? (fact 30)))
+(test #t (exact-integer? (fact 30)))
+(test 9999999999800000000001 (* 99999999999 99999999999))
+(test 870 (/ (fact 30) (fact 28)))
+(test 0 (- (fact 25) (fact 25)))
+(test #t (eqv? (fact 30) (* (fact 29) 30)))
+(test #t (equal? (list (fact 20)) (list (* (fact 19) 20))))
+(test #t (< (fact 30) (fact 31)))
+(test #t (> (- (fact 30)) (- (fact 31))))
+(test #t (< (fact 30) 1e40))
+
+;; literals and radix conversion
+
+(test "123456789012345678901234567890" (number->string 123456789012345678901234567890))
+(test "-8eeae81b84c7f27e080fde64ff05254000000000" (number->string (- (fact 40)) 16))
+(test (- (fact 40)) (string->number "-8eeae81b84c7f27e080fde64ff05254000000000" 16))
+(test (fact 300) (string->number (number->string (fact 300))))
+(test (fact 1000) (string->number (number->string (fact 1000) 7) 7))
+
+(define (pow b e)
+  (if (= e 0)
+      1
+      (let ((h (pow b (floor-quotient e 2))))
+        (if (even? e) (* h h) (* h h b)))))
+
+(define fact3000 (number->string (fact 3000)))
+(test 9131 (string-length fact3000))
+(test "414935960343785408555686709308" (substring fact3000 0 30))
+(test (fact 3000) (string->number fact3000))
+(test (make-string 5000 #\9) (number->string (- (pow 10 5000) 1)))
+(test (string-append "1" (make-string 5000 #\0)) (number->string (pow 10 5000)))
+(test (string-append "1" (make-string 5000 #\0) "1") (number->string (+ (pow 10 5001) 1)))
+(define hex (number->string (- (pow 3 20000) 1) 16))
+(test 7925 (string-length hex))
+(test "9838540cef7f8da7f722d175" (substring hex 0 24))
+(test "aaaf7c46cd926beb62b49680" (substring hex 7901 7925))
+(test (- (pow 3 20000) 1) (string->number hex 16))
+(test 1000000000000000019884624838656 (exact 1e30))
+
+;; division, gcd and square roots
+
+(test '(-37893265687455865519472640000000 0) (call-with-values (lambda () (floor/ (- (fact 30)) 7)) list))
+(test '(-1 -1) (call-with-values (lambda () (floor/ (- (fact 30) 1) (- (fact 30)))) list))
+(test (list 0 (- 1 (fact 30))) (call-with-values (lambda () (truncate/ (- 1 (fact 30)) (- (fact 30)))) list))
+(test 1179949680000 (floor-remainder (fact 30) (- (fact 22) 5)))
+(test 1 (truncate-quotient (+ (fact 30) 1) (fact 30)))
+(test (fact 20) (gcd (fact 30) (- (fact 20))))
+(test (fact 25) (lcm (fact 20) (fact 25) 4))
+(test '(16286585271694955 27460809907547975) (call-with-values (lambda () (exact-integer-sqrt (fact 30))) list))
+(test (fact 200) (call-with-values (lambda () (exact-integer-sqrt (* (fact 200) (fact 200)))) (lambda (s r) s)))
+(test '(3037000499 5928526806) (call-with-values (lambda () (exact-integer-sqrt 9223372036854775807)) list))
+
+(test-end)
@@ -0,0 +1,57 @@
+(import (scheme base)
+        (picrin base)
+        (picrin test))
+
+(test-begin)
+
+(test 8 (bitwise-and 12 10))
+(test 14 (bitwise-ior 12 10))
+(test 6 (bitwise-xor 12 10))
+(test -1 (bitwise-and))
+(test 0 (bitwise-ior))
+(test -13 (bitwise-not 12))
+(test -5 (bitwise-ior -8 3))
+(test 40 (arithmetic-shift 5 3))
+(test -4 (arithmetic-shift -7 -1))
+(test -1 (arithmetic-shift -7 -100))
+(test 3 (bit-count 11))
+(test 1 (bit-count -5))
+(test 0 (integer-length -1))
+(test 8 (integer-length 255))
+(test 8 (integer-length -256))
+(test 9 (integer-length -257))
+(test -1 (first-set-bit 0))
+(test 5 (first-set-bit -96))
+(test #t (bit-set? 3 8))
+(test #f (bit-set? 2 -5))
+(test #t (bit-set? 1000 -5))
+(test 6 (bit-field 874 4 8))
+(test 15 (bit-field -1 4 8))
+
+;; operands and results beyond the fixnum range
+
+(define big (arithmetic-shift 1 100))
+
+(test 1267650600228229401496703205376 big)
+(test 1 (arithmetic-shift big -100))
+(test -1 (arithmetic-shift (- big) -101))
+(test big (bitwise-and (- big) big))
+(test (- (* 2 big)) (bitwise-xor (- big) big))
+(test (- big 1) (bitwise-and -1 (- big 1)))
+(test (* -3 big) (bitwise-and (* -3 big) (- big)))
+(test -1 (bitwise-ior (- big) (- big 1)))
+(test (- -1 big) (bitwise-not big))
+(test 0 (bitwise-and big (bitwise-not big)))
+(test 100 (bit-count (- big 1)))
+(test 100 (bit-count (- big)))
+(test 101 (integer-length big))
+(test 100 (integer-length (- big)))
+(test 100 (first-set-bit (- big)))
+(test #t (bit-set? 100 big))
+(test #f (bit-set? 99 big))
+(test #t (bit-set? 200 (- big)))
+(test #f (bit-set? 99 (- big)))
+(test (- big 1) (bit-field -1 0 100))
+(test 1 (bit-field big 100 200))
+
+(test-end)
@@ -0,0 +1,97 @@
+(import (scheme base)
+        (picrin base)
+        (picrin test))
+
+(test-begin)
+
+(define (caught thunk)
+  (call/cc
+   (lambda (k)
+     (with-exception-handler
+      (lambda (e) (k (error-object-message e)))
+      thunk))))
+
+(define b (make-bytevector 16 0))
+
+;; integers, at unaligned offsets
+
+(bytevector-u32-set! b 1 16909060 'big)
+(test #u8(0 1 2 3 4 0 0 0 0 0 0 0 0 0 0 0) b)
+(test 16909060 (bytevector-u32-ref b 1 'big))
+(test 67305985 (bytevector-u32-ref b 1 'little))
+(test 258 (bytevector-u16-ref b 1 'big))
+(test 513 (bytevector-u16-ref b 1 'little))
+
+(bytevector-s16-set! b 0 -2 'little)
+(test -2 (bytevector-s16-ref b 0 'little))
+(test 65279 (bytevector-u16-ref b 0 'big))
+(test -257 (bytevector-s16-ref b 0 'big))
+
+(bytevector-s32-set! b 5 -2147483648 'big)
+(test -2147483648 (bytevector-s32-ref b 5 'big))
+(test 128 (bytevector-u32-ref b 5 'little))
+
+(bytevector-u64-set! b 8 18446744073709551615 'big)
+(test -1 (bytevector-s64-ref b 8 'little))
+(bytevector-s64-set! b 7 -9223372036854775808 'little)
+(test 128 (bytevector-u8-ref b 14))
+(test -9223372036854775808 (bytevector-s64-ref b 7 'little))
+
+(bytevector-s8-set! b 0 -1)
+(test -1 (bytevector-s8-ref b 0))
+(test 255 (bytevector-u8-ref b 0))
+
+;; floating point
+
+(bytevector-ieee-double-set! b 3 1.5 'big)
+(test '(63 248 0 0) (list (bytevector-u8-ref b 3) (bytevector-u8-ref b 4) (bytevector-u8-ref b 5) (bytevector-u8-ref b 6)))
+(test 1.5 (bytevector-ieee-double-ref b 3 'big))
+(bytevector-ieee-single-set! b 9 -0.75 'little)
+(test -0.75 (bytevector-ieee-single-ref b 9 'little))
+(test 191 (bytevector-u8-ref b 12))
+
+;; native order
+
+(bytevector-u32-native-set! b 2 305419896)
+(test 305419896 (bytevector-u32-native-ref b 2))
+(test 305419896 (bytevector-u32-ref b 2 (native-endianness)))
+(bytevector-ieee-single-native-set! b 5 0.25)
+(test 0.25 (bytevector-ieee-single-native-ref b 5))
+(test #t (if (memq (native-endianness) '(big little)) #t #f))
+
+;; slices share storage with the bytevector they come from
+
+(define whole (bytevector 0 1 2 3 4 5 6 7))
+(define part (bytevector-slice whole 2 6))
+(test #u8(2 3 4 5) part)
+(bytevector-u8-set! part 0 42)
+(test 42 (bytevector-u8-ref whole 2))
+(bytevector-u16-set! whole 4 258 'big)
+(test 258 (bytevector-u16-ref part 2 'big))
+(test #u8(1 2) (bytevector-slice (bytevector-slice whole 1) 3 5))
+(test #u8() (bytevector-slice whole 8))
+(test #u8(42 3) (bytevector-copy part 0 2))
+(test "invalid end index" (caught (lambda () (bytevector-slice whole 3 9))))
+
+;; input ports over slices
+
+(define port (open-input-bytevector (bytevector-slice whole 2 6)))
+(test 42 (read-u8 port))
+(test 3 (read-u8 port))
+(test #u8(1 2) (read-bytevector 2 port))
+(test #t (eof-object? (read-u8 port)))
+
+;; errors
+
+(test "index out of range" (caught (lambda () (bytevector-u32-ref b 13 'big))))
+(test "index out of range" (caught (lambda () (bytevector-u16-native-ref b -1))))
+(test "value out of range" (caught (lambda () (bytevector-u16-set! b 0 65536 'big))))
+(test "value out of range" (caught (lambda () (bytevector-s8-set! b 0 128))))
+(test "endianness must be big or little" (caught (lambda () (bytevector-u16-ref b 0 'middle))))
+(test #t (string? (caught (lambda () (bytevector-u16-native-ref b 0 'big)))))
+(test #t (string? (caught (lambda () (bytevector-u32-native-set! b 0 1 'little)))))
+(test #t (string? (caught (lambda () (bytevector-s8-ref b 0 'big)))))
+(test #t (string? (caught (lambda () (bytevector-s8-set! b 0 1 'little)))))
+(test #t (string? (caught (lambda () (bytevector-u16-ref b 0)))))
+
+(test-end)
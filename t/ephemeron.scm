@@ -0,0 +1,58 @@
+(import (scheme base)
+        (picrin base)
+        (picrin test))
+
+(test-begin)
+
+;; key -> value -> key chains through attributes must survive as long as
+;; the head of the chain is reachable, however they are laid out.
+
+(define (next attrs j)
+  (if (= (+ j 1) (vector-length attrs)) 0 (+ j 1)))
+
+(define (make-chain attrs n)
+  (let ((head (list 'head)))
+    (let loop ((i 0) (j 0) (k head))
+      (if (= i n)
+          head
+          (let ((v (list i)))
+            ((vector-ref attrs j) k v)
+            (loop (+ i 1) (next attrs j) v))))))
+
+(define (chain-length attrs head)
+  (let loop ((i 0) (j 0) (k head))
+    (let ((v ((vector-ref attrs j) k)))
+      (if v
+          (loop (+ i 1) (next attrs j) v)
+          i))))
+
+(define (churn n)
+  (let loop ((i 0))
+    (if (< i n)
+        (begin
+          (make-vector 8 i)
+          (loop (+ i 1))))))
+
+(define one (vector (make-attribute)))
+(define many (vector (make-attribute) (make-attribute) (make-attribute)))
+
+(define head1 (make-chain one 50000))
+(define head2 (make-chain many 50000))
+
+(churn 500000)
+
+(test 50000 (chain-length one head1))
+(test 50000 (chain-length many head2))
+
+;; a chain whose head is dropped is reclaimed entirely
+
+(define cleared (cdr (assq 'weak-cleared (gc-stats))))
+
+(make-chain one 10000)
+
+(churn 500000)
+
+(test #t (>= (- (cdr (assq 'weak-cleared (gc-stats))) cleared) 10000))
+(test 50000 (chain-length one head1))
+
+(test-end)
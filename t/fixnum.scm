@@ -0,0 +1,51 @@
+(import (scheme base)
+        (picrin base)
+        (picrin test))
+
+(test-begin)
+
+;; exact integers well beyond 32 bits
+
+(test 4294967296 (* 65536 65536))
+(test #t (exact? (* 65536 65536)))
+(test 17592186044416 (* 4194304 4194304))
+(test #t (exact? (* 4194304 4194304)))
+(test 4294967296 (+ 4294967295 1))
+(test -4294967296 (- 4294967296))
+(test 2147483648 (- 2147483647 -1))
+(test 3000000000 (/ 6000000000 2))
+(test #t (exact? (/ 6000000000 2)))
+(test 3.5 (/ 7 2))
+(test #t (< 4294967295 4294967296))
+(test #t (= 12345678901 (+ 12345678900 1)))
+
+;; reading and printing
+
+(test 123456789012 (string->number "123456789012"))
+(test #t (exact? (string->number "-123456789012")))
+(test "123456789012" (number->string 123456789012))
+(test "-ffffffffff" (number->string -1099511627775 16))
+(test 1000000000000 (exact 1e12))
+(test 1e12 (inexact 1000000000000))
+
+;; results that leave the fixnum range become bignums
+
+(define big 4611686018427387904)        ; 2^62
+(test #t (= big (* 2147483648 2147483648)))
+(test #t (exact? (* big big)))
+(test #t (exact? (* big 4)))
+(test #t (exact? (+ big big)))
+(test #t (= (* big 4) (+ (* big 2) (* big 2))))
+(test 99999999999999999999 (string->number "99999999999999999999"))
+
+;; indices beyond int are rejected, not wrapped around
+
+(define (out-of-range thunk)
+  (guard (e (#t (error-object-message e))) (thunk)))
+(test "pic_get_args: integer out of range" (out-of-range (lambda () (vector-ref #(a b c) 4294967297))))
+(test "pic_get_args: integer out of range" (out-of-range (lambda () (string-ref "abc" 4294967297))))
+(test "pic_get_args: integer out of range" (out-of-range (lambda () (bytevector-u8-ref (bytevector 1 2 3) 4294967297))))
+(test "pic_get_args: integer out of range" (out-of-range (lambda () (make-string 4294967297 #\a))))
+(test "pic_get_args: integer out of range" (out-of-range (lambda () (vector-ref #(a b c) -4294967295))))
+
+(test-end)
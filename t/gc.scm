@@ -0,0 +1,84 @@
+(import (scheme base)
+        (picrin base)
+        (picrin test))
+
+(test-begin)
+
+(define saved (gc-tune))
+
+(test '(2. 1000000 0) (gc-tune 2. 1000000 0))
+(test '(1.5 1000000 0) (gc-tune 1.5))
+
+(define keep
+  (let loop ((i 0) (acc '()))
+    (if (= i 100000)
+        acc
+        (loop (+ i 1) (cons (make-vector 2 i) acc)))))
+
+(test 100000 (length keep))
+
+;; payload allocated apart from the object counts towards the live heap
+
+(define big (make-bytevector 10000000 0))
+(set! keep (make-vector 2 big))
+(test #t (>= (cdr (assq 'live-bytes (gc-stats))) 10000000))
+
+(apply gc-tune saved)
+
+(define stats (gc-stats))
+
+(test #t (> (cdr (assq 'collections stats)) 0))
+(test #t (>= (cdr (assq 'max-pause stats)) 0))
+(test #t (>= (cdr (assq 'total-pause stats)) (cdr (assq 'max-pause stats))))
+
+(let ((pair (cdr (assq 'pair (cdr (assq 'types stats))))))
+  (test #t (>= (cdr (assq 'allocated-objects pair)) 100000))
+  (test #t (>= (cdr (assq 'live-objects pair)) 0)))
+
+(let ((bytevector (cdr (assq 'bytevector (cdr (assq 'types stats))))))
+  (test #t (>= (cdr (assq 'allocated-bytes bytevector)) 10000000))
+  (test #t (>= (cdr (assq 'live-bytes bytevector)) 10000000)))
+
+
+(test 1024 (heap-profile-sampling 1024))
+
+(define profiled
+  (let loop ((i 0) (acc '()))
+    (if (= i 10000)
+        acc
+        (loop (+ i 1) (cons (make-vector 4 i) acc)))))
+
+(let ((port (open-output-string)))
+  (heap-profile port)
+  (test "# picrin heap profile"
+        (read-line (open-input-string (get-output-string port)))))
+
+(test 0 (heap-profile-sampling 0))
+
+;; payload bytes are sampled too, not just object headers
+
+(define (split-tabs s)
+  (let loop ((cs (string->list s)) (cur '()) (acc '()))
+    (cond ((null? cs) (reverse (cons (list->string (reverse cur)) acc)))
+          ((char=? (car cs) #\tab) (loop (cdr cs) '() (cons (list->string (reverse cur)) acc)))
+          (else (loop (cdr cs) (cons (car cs) cur) acc)))))
+
+(define (profiled-bytes type)
+  (let ((port (open-output-string)))
+    (heap-profile port)
+    (let ((in (open-input-string (get-output-string port))))
+      (let loop ((sum 0))
+        (let ((line (read-line in)))
+          (if (eof-object? line)
+              sum
+              (let ((f (split-tabs line)))
+                (loop (if (and (equal? (car f) "site") (equal? (cadr f) type))
+                          (+ sum (string->number (list-ref f 3)))
+                          sum)))))))))
+
+(heap-profile-sampling 65536)
+(define big-vectors (list (make-vector 100000 0) (make-vector 100000 0) (make-vector 100000 0)))
+(test #t (>= (profiled-bytes "vector") 2000000))
+(test 0 (heap-profile-sampling 0))
+
+(test-end)
@@ -0,0 +1,125 @@
+(import (scheme base)
+        (picrin base)
+        (picrin test))
+
+(test-begin)
+
+;; each equivalence
+
+(define h-eq (make-hash-table eq?))
+(define h-eqv (make-hash-table eqv?))
+(define h-equal (make-hash-table equal?))
+(define h-string (make-hash-table string=?))
+
+(test #t (hash-table? h-eq))
+(test #f (hash-table? (make-dictionary)))
+(test #f (hash-table? '((a . 1))))
+
+(hash-table-set! h-eq 'a 1 'b 2)
+(test 1 (hash-table-ref h-eq 'a))
+(test 2 (hash-table-ref h-eq 'b))
+(test #f (hash-table-contains? h-eq 'c))
+(test #f (hash-table-contains? h-eq (string->symbol "c")))
+(test #t (hash-table-contains? h-eq (string->symbol "a")))
+
+(hash-table-set! h-eqv 1.5 'flo 12345678901234567890 'big #\x 'char)
+(test 'flo (hash-table-ref h-eqv 1.5))
+(test 'big (hash-table-ref h-eqv (* 1234567890123456789 10)))
+(test 'char (hash-table-ref h-eqv #\x))
+(test #f (hash-table-contains? h-eqv "x"))
+
+(hash-table-set! h-equal "key" 1 '(1 (2 #(3 "four"))) 2 (bytevector 1 2 3) 3)
+(test 1 (hash-table-ref h-equal (string-append "k" "ey")))
+(test 2 (hash-table-ref h-equal (list 1 (list 2 (vector 3 "four")))))
+(test 3 (hash-table-ref h-equal (bytevector 1 2 3)))
+(test #f (hash-table-contains? h-equal '(1 (2 #(3 "five")))))
+
+(hash-table-set! h-string "abc" 1)
+(test 1 (hash-table-ref h-string (string #\a #\b #\c)))
+(test "string required" (guard (e (#t (error-object-message e))) (hash-table-set! h-string 'abc 1)))
+
+(test 'equal (begin (hash-table-set! (make-hash-table) '(1) 'equal) 'equal))
+(test "unsupported equivalence procedure" (guard (e (#t (error-object-message e))) (make-hash-table =)))
+
+;; references and updates
+
+(test 'none (hash-table-ref h-eq 'z (lambda () 'none)))
+(test 20 (hash-table-ref h-eq 'b (lambda () 'none) (lambda (x) (* x 10))))
+(test 0 (hash-table-ref/default h-eq 'z 0))
+(test "element not found for given key" (guard (e (#t (error-object-message e))) (hash-table-ref h-eq 'z)))
+
+(test 11 (begin (hash-table-update! h-eq 'a (lambda (x) (+ x 10))) (hash-table-ref h-eq 'a)))
+(test 5 (begin (hash-table-update! h-eq 'n (lambda (x) (+ x 1)) (lambda () 4)) (hash-table-ref h-eq 'n)))
+(test '(x) (begin (hash-table-update!/default h-eq 'l (lambda (x) (cons 'x x)) '()) (hash-table-ref h-eq 'l)))
+(test '(x x) (begin (hash-table-update!/default h-eq 'l (lambda (x) (cons 'x x)) '()) (hash-table-ref h-eq 'l)))
+
+(test 4 (hash-table-size h-eq))
+(test 2 (hash-table-delete! h-eq 'n 'l 'nothing))
+(test 2 (hash-table-size h-eq))
+(test 0 (hash-table-delete! h-eq 'n))
+
+;; whole-table operations
+
+(define small (hash-table eqv? 1 'one 2 'two 3 'three))
+
+(test 6 (hash-table-fold (lambda (k v acc) (+ k acc)) 0 small))
+(test 6 (hash-table-fold small (lambda (k v acc) (+ k acc)) 0))
+(test 6 (apply + (hash-table-keys small)))
+(test 3 (length (hash-table-values small)))
+(test '(2 . two) (assv 2 (hash-table->alist small)))
+(test 3 (let ((n 0)) (hash-table-for-each (lambda (k v) (set! n (+ n 1))) small) n))
+(test 3 (let ((n 0)) (hash-table-for-each small (lambda (k v) (set! n (+ n 1)))) n))
+
+(test #f (hash-table-mutable? small))
+(test "hash table is immutable" (guard (e (#t (error-object-message e))) (hash-table-set! small 4 'four)))
+(test #t (hash-table-mutable? (hash-table-copy small)))
+(test #f (hash-table-mutable? (hash-table-copy small #f)))
+(test 'four (let ((c (hash-table-copy small #t))) (hash-table-set! c 4 'four) (hash-table-ref c 4)))
+(test #f (hash-table-contains? small 4))
+
+(test 0 (let ((c (hash-table-copy small))) (hash-table-clear! c) (hash-table-size c)))
+(test eqv? (hash-table-equivalence-function small))
+(test string-hash (hash-table-hash-function h-string))
+
+;; hash functions
+
+(test (hash "abc") (hash (string-append "a" "bc")))
+(test (hash '(1 #(2 3) "x")) (hash (list 1 (vector 2 3) (string #\x))))
+(test #t (< (hash '(a b c) 10) 10))
+(test (string-hash "hello") (string-hash (string-copy "hello")))
+(test (hash-by-identity 'a) (hash-by-identity 'a))
+(test #t (<= 0 (let ((l (list 1 2))) (set-cdr! (cdr l) l) (hash l))))
+
+;; many entries: growth, deletion, and tables that survive collections
+
+(define big (make-hash-table eqv?))
+
+(let loop ((i 0))
+  (when (< i 100000)
+    (hash-table-set! big i (* i 2))
+    (loop (+ i 1))))
+
+(test 100000 (hash-table-size big))
+(test 199998 (hash-table-ref big 99999))
+(test 9999900000 (hash-table-fold (lambda (k v acc) (+ v acc)) 0 big))
+
+(let loop ((i 0))
+  (when (< i 100000)
+    (hash-table-delete! big i)
+    (loop (+ i 2))))
+
+(test 50000 (hash-table-size big))
+(test #f (hash-table-contains? big 0))
+(test 2 (hash-table-ref big 1))
+
+(define strings (make-hash-table string=?))
+
+(let loop ((i 0))
+  (when (< i 20000)
+    (hash-table-set! strings (number->string i) (list i))
+    (loop (+ i 1))))
+
+(test '(12345) (hash-table-ref strings "12345"))
+(test 20000 (length (hash-table-keys strings)))
+
+(test-end)
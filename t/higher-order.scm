@@ -0,0 +1,45 @@
+(import (scheme base)
+        (picrin base)
+        (picrin test))
+
+(test-begin)
+
+(test '(1 4 9) (map (lambda (x) (* x x)) '(1 2 3)))
+(test '(11 22) (map + '(1 2 3) '(10 20)))
+(test '() (map car '()))
+(test #(1 4 9) (vector-map (lambda (x) (* x x)) #(1 2 3)))
+(test #(#(1 3) #(2 4)) (vector-map vector #(1 2) #(3 4 5)))
+(test #() (vector-map car #()))
+(test "IBM" (string-map (lambda (c) (integer->char (+ 1 (char->integer c)))) "HAL"))
+(test "abbb" (string-map (lambda (a b) (if (char<? a b) a b)) "adcz" "bbbbbb"))
+
+(define sum 0)
+(define (add! . xs) (set! sum (apply + sum xs)))
+
+(for-each add! '(1 2 3) '(4 5 6))
+(test 21 sum)
+(vector-for-each add! #(1 2 3))
+(test 27 sum)
+(string-for-each (lambda (c) (add! (char->integer c))) "AB")
+(test 158 sum)
+
+(define d (make-dictionary))
+(dictionary-set! d 'a 1)
+(dictionary-set! d 'b 2)
+(test 3 (apply + (dictionary-map (lambda (k) (dictionary-ref d k)) d)))
+
+;; continuations and nesting
+
+(test 'escaped (call/cc (lambda (k) (vector-map (lambda (x) (if (= x 2) (k 'escaped) x)) #(1 2 3)))))
+(test '(1 escaped) (list 1 (call/cc (lambda (k) (for-each (lambda (x) (if (= x 2) (k 'escaped))) '(1 2 3))))))
+(test #(2 4 6) (vector-map (lambda (x) (call/cc (lambda (k) (k (* 2 x))))) #(1 2 3)))
+(test '(#(11 12) #(21 22)) (map (lambda (x) (vector-map (lambda (y) (+ x y)) #(1 2))) '(10 20)))
+
+;; results survive collections in the middle of the loop
+
+(define big (vector-map (lambda (x) (list x (make-vector 10 x))) (make-vector 20000 7)))
+(test 20000 (vector-length big))
+(test '(7 #(7 7 7 7 7 7 7 7 7 7)) (vector-ref big 19999))
+(test 20000 (length (map (lambda (x) (cons x x)) (vector->list big))))
+
+(test-end)
@@ -0,0 +1,40 @@
+(import (scheme base)
+        (picrin base)
+        (picrin test))
+
+(test-begin)
+
+(test #t (eq? 'abc (string->symbol "abc")))
+(test #t (eq? 'abc (string->symbol (string-append "a" "b" "c"))))
+(test #t (eq? 'bc (string->symbol (string-copy "abcd" 1 3))))
+(test #t (eq? '|a b| (string->symbol "a b")))
+(test #t (eq? '|λx| (string->symbol "λx")))
+(test #t (eq? 'λx (string->symbol (string-append "λ" "x"))))
+(test #f (eq? 'abc 'abd))
+
+;; writing to a string does not rename the symbol it named, and a
+;; written string interns under its new contents
+
+(define s (string-copy "foo"))
+(define foo (string->symbol s))
+(string-set! s 0 #\g)
+(test "foo" (symbol->string foo))
+(test #t (eq? 'goo (string->symbol s)))
+(test #t (eq? foo (string->symbol "foo")))
+
+(define n (symbol->string 'bar))
+(string-set! n 0 #\c)
+(test "bar" (symbol->string 'bar))
+(test "car" n)
+
+;; many symbols, looked up again after the table grows
+
+(define (name i) (string-append "sym-" (number->string i)))
+(define syms (let loop ((i 0) (acc '()))
+               (if (= i 2000)
+                   acc
+                   (loop (+ i 1) (cons (string->symbol (name i)) acc)))))
+(test #t (eq? (car syms) (string->symbol (name 1999))))
+(test #t (eq? (list-ref syms 1999) (string->symbol "sym-0")))
+
+(test-end)
@@ -0,0 +1,32 @@
+(import (scheme base)
+        (picrin base)
+        (picrin test))
+
+(test-begin)
+
+(define p (open-input-string "hello world\n\nsecond line\nlast"))
+(test "hello world" (read-line p))
+(test "" (read-line p))
+(test "second line" (read-line p))
+(test "last" (read-line p))
+(test #t (eof-object? (read-line p)))
+
+(define long-line (make-string 10000 #\x))
+(define q (open-input-string (string-append long-line "\n" long-line)))
+(test 10000 (string-length (read-line q)))
+(test long-line (read-line q))
+(test #t (eof-object? (read-line q)))
+
+(define r (open-input-string "ab\ncd"))
+(test #\a (read-char r))
+(test "b" (read-line r))
+(test #\c (peek-char r))
+(test "cd" (read-line r))
+
+(define s (open-input-string "abcdefghij"))
+(test "abc" (read-string 3 s))
+(test "" (read-string 0 s))
+(test "defghij" (read-string 100 s))
+(test #t (eof-object? (read-string 2 s)))
+
+(test-end)
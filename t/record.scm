@@ -0,0 +1,118 @@
+(import (scheme base)
+        (picrin base)
+        (picrin test))
+
+(test-begin)
+
+(define-record-type <point>
+  (make-point x y)
+  point?
+  (x point-x set-point-x!)
+  (y point-y))
+
+(define p (make-point 1 2))
+
+(test #t (point? p))
+(test #f (point? (vector 1 2)))
+(test #f (point? 'point))
+(test 1 (point-x p))
+(test 2 (point-y p))
+(test 10 (begin (set-point-x! p 10) (point-x p)))
+(test #t (record? p))
+(test #t (record? p <point>))
+(test #t (record-type? <point>))
+(test <point> (record-type p))
+(test '<point> (record-type-name <point>))
+(test '(x y) (record-type-fields <point>))
+
+;; fields left out of the constructor, and a constructor that takes
+;; its fields in another order
+
+(define-record-type cell
+  (make-cell value)
+  cell?
+  (tag cell-tag set-cell-tag!)
+  (value cell-value))
+
+(test 5 (cell-value (make-cell 5)))
+(test #t (let ((c (make-cell 5))) (set-cell-tag! c 'a) (eq? 'a (cell-tag c))))
+
+(define-record-type pare
+  (kons y x)
+  pare?
+  (x kar)
+  (y kdr))
+
+(test '(1 2) (let ((k (kons 2 1))) (list (kar k) (kdr k))))
+
+;; types with the same name stay distinct
+
+(define other-point
+  (let ()
+    (define-record-type <point>
+      (make-point x y)
+      point?
+      (x point-x)
+      (y point-y))
+    (make-point 1 2)))
+
+(test #f (point? other-point))
+(test "record type mismatch" (guard (e (#t (error-object-message e))) (point-x other-point)))
+(test "record type mismatch" (guard (e (#t (error-object-message e))) (point-y 'foo)))
+(test "record type mismatch" (guard (e (#t (error-object-message e))) (set-point-x! (make-cell 1) 0)))
+
+;; the constructor may share the name of the type
+
+(define-record-type node
+  (node left right)
+  node?
+  (left node-left)
+  (right node-right))
+
+(test '(1 2) (let ((n (node 1 2))) (list (node-left n) (node-right n))))
+
+;; accessors used as values and in every argument position
+
+(test '(10 20 30) (map point-x (list (make-point 10 0) (make-point 20 0) (make-point 30 0))))
+(test 6 (+ (point-y (make-point 0 1)) (point-y (make-point 0 2)) (kar (kons 0 3))))
+(test 'ok (if (point-x (make-point #f 0)) 'ng 'ok))
+(test 3 ((point-x (make-point (lambda (n) (+ n 1)) 0)) 2))
+
+;; equality compares types and fields
+
+(test #t (equal? (make-point 1 (list 2)) (make-point 1 (list 2))))
+(test #f (equal? (make-point 1 2) (make-point 1 3)))
+(test #f (equal? (make-point 1 2) other-point))
+(test #f (eqv? (make-point 1 2) (make-point 1 2)))
+
+;; the procedural interface
+
+(define rt (make-record-type 'triple '(a b c)))
+(define t (make-record rt 1 2 3))
+
+(test #t (record? t rt))
+(test #f (record? t <point>))
+(test 2 (record-ref t rt 1))
+(test 'z (begin (record-set! t rt 2 'z) (record-ref t rt 2)))
+(test "index out of range" (guard (e (#t (error-object-message e))) (record-ref t rt 3)))
+(test "record type mismatch" (guard (e (#t (error-object-message e))) (record-ref p rt 0)))
+
+;; many fields, and records that survive collections
+
+(define-record-type big
+  (make-big f0 f1 f2 f3 f4 f5 f6 f7)
+  big?
+  (f0 big-f0) (f1 big-f1) (f2 big-f2) (f3 big-f3)
+  (f4 big-f4) (f5 big-f5) (f6 big-f6) (f7 big-f7 set-big-f7!))
+
+(define bigs
+  (let loop ((i 0) (acc '()))
+    (if (= i 20000)
+        acc
+        (loop (+ i 1) (cons (make-big i 1 2 3 4 5 6 (list i)) acc)))))
+
+(test 19999 (big-f0 (car bigs)))
+(test '(0) (big-f7 (list-ref bigs 19999)))
+(test 399980000 (let loop ((l bigs) (s 0)) (if (null? l) s (loop (cdr l) (+ s (big-f0 (car l)) (car (big-f7 (car l))))))))
+
+(test-end)
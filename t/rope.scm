@@ -0,0 +1,55 @@
+(import (scheme base)
+        (picrin base)
+        (picrin test))
+
+(test-begin)
+
+(define (append-right n piece)
+  (let loop ((i 0) (s ""))
+    (if (= i n)
+        s
+        (loop (+ i 1) (string-append s piece)))))
+
+(define (append-left n piece)
+  (let loop ((i 0) (s ""))
+    (if (= i n)
+        s
+        (loop (+ i 1) (string-append piece s)))))
+
+(test "abc" (string-copy "abc"))
+(test #t (string? (string-copy "hello" 0 5)))
+
+(define s (append-right 100000 "ab"))
+(test 200000 (string-length s))
+(test #\a (string-ref s 0))
+(test #\b (string-ref s 199999))
+(test "baba" (string-copy s 5 9))
+
+(define t (append-left 100000 "xyz"))
+(test 300000 (string-length t))
+(test "zxyzxyzxyz" (string-copy t 299990 300000))
+
+(define u (append-right 20000 (make-string 100 #\q)))
+(test 2000000 (string-length u))
+(test #\q (string-ref u 1999999))
+
+(define v (string-append (string-copy s 0 1000) (string-copy t 0 1000)))
+(test 2000 (string-length v))
+(test "abxy" (string-copy v 998 1002))
+
+;; substrings of long leaves share their text
+
+(define big (string-append (make-string 300 #\1) "abcdef" (make-string 300 #\2)))
+(string-ref big 0)
+(define a (string-copy big 298 304))
+(define b (string-copy a 1 4))
+(test "11abcd" a)
+(test "1ab" b)
+(test 111 (string->number (string-copy big 0 3)))
+(test '1ab (string->symbol b))
+(string-set! a 0 #\X)
+(test "X1abcd" a)
+(test "1ab" b)
+(test #\1 (string-ref big 298))
+
+(test-end)
@@ -0,0 +1,110 @@
+(import (scheme base)
+        (picrin base)
+        (picrin test))
+
+(test-begin)
+
+;; lists
+
+(test '() (list-sort < '()))
+(test '(1) (list-sort < '(1)))
+(test '(1 2 3 4 5) (list-sort < '(3 5 1 4 2)))
+(test '(5 4 3 2 1) (list-sort > '(3 5 1 4 2)))
+(test '(1.5 2 3) (list-sort < '(3 1.5 2)))
+(test '("a" "b" "c") (list-sort string<? '("c" "a" "b")))
+(test '(#\a #\b #\c) (list-sort char<? '(#\b #\c #\a)))
+(test '(1 2 3) (list-sort (lambda (x y) (< x y)) '(2 3 1)))
+(test '(3 2 1) (list-stable-sort > '(1 2 3)))
+
+(define l (list 3 1 2))
+(test '(1 2 3) (list-sort! < l))
+(test '(1 2 3) l)
+
+(test #t (list-sorted? < '()))
+(test #t (list-sorted? < '(1 2 2 3)))
+(test #f (list-sorted? < '(1 3 2)))
+(test #t (list-sorted? (lambda (x y) (< x y)) '(1 2 3)))
+
+(test '(1 2 3 4 5) (list-merge < '(1 3 5) '(2 4)))
+(test '(1 2) (list-merge < '() '(1 2)))
+(test '(1 2) (list-merge! < (list 1 2) '()))
+(test '(1 2 3 4) (list-merge! < (list 1 4) (list 2 3)))
+
+;; stability
+
+(test '((1 . a) (1 . b) (2 . c) (2 . d))
+      (list-sort (lambda (x y) (< (car x) (car y))) '((2 . c) (1 . a) (2 . d) (1 . b))))
+(test '((1 . a) (1 . b) (2 . c))
+      (list-merge (lambda (x y) (< (car x) (car y))) '((1 . a) (2 . c)) '((1 . b))))
+
+;; vectors
+
+(test #() (vector-sort < #()))
+(test #(1 2 3 4) (vector-sort < #(4 2 3 1)))
+(test #(1 2 3) (vector-sort < #(9 3 1 2) 1))
+(test #(2 3) (vector-sort < #(9 3 2 1) 1 3))
+
+(define v (vector 5 4 3 2 1 0))
+(vector-sort! v <)
+(test #(0 1 2 3 4 5) v)
+(define v (vector 5 4 3 2 1 0))
+(vector-sort! v < 1 4)
+(test #(5 2 3 4 1 0) v)
+
+(test #t (vector-sorted? < #(1 2 3)))
+(test #f (vector-sorted? < #(1 3 2)))
+(test #t (vector-sorted? < #(1 3 2) 0 2))
+
+(test #(1 2 3 4 5) (vector-merge < #(1 3 5) #(2 4)))
+(test #(1 2 3 4 5) (vector-merge < #(9 1 3 5) #(2 4 9) 1 4 0 2))
+(define v (make-vector 7 0))
+(vector-merge! < v #(1 3 5) #(2 4) 2)
+(test #(0 0 1 2 3 4 5) v)
+
+;; sort and merge after SRFI 95
+
+(test '(1 2 3) (sort '(3 1 2) <))
+(test #(1 2 3) (sort #(3 1 2) <))
+(test '((a . 1) (b . 2)) (sort '((b . 2) (a . 1)) < cdr))
+(test #(-3 2 -1) (sort #(-1 2 -3) > (lambda (x) (* x x))))
+(test '(1 2 3) (sort! (list 2 3 1) <))
+(test #t (sorted? #(1 2 3) <))
+(test #t (sorted? '(3 2 1) < -))
+(test '(1 2 3 4) (merge '(1 3) '(2 4) <))
+(test '((a . 1) (b . 2) (c . 3)) (merge '((a . 1) (c . 3)) '((b . 2)) < cdr))
+(test '(1 2 3 4) (merge! (list 1 3) (list 2 4) <))
+
+;; errors come from the comparison
+
+(test "pic_lt: non-number operand given"
+      (call/cc (lambda (k) (with-exception-handler (lambda (e) (k (error-object-message e))) (lambda () (list-sort < '(2 a 1)))))))
+(test 'escaped
+      (call/cc (lambda (k) (list-sort (lambda (x y) (if (= x 2) (k 'escaped) (< x y))) '(3 2 1)))))
+
+;; longer input: runs, merges, and comparators that allocate
+
+(define (random-list n)
+  (let loop ((i 0) (seed 1) (acc '()))
+    (if (= i n)
+        acc
+        (let ((seed (floor-remainder (+ (* seed 1103515245) 12345) 2147483648)))
+          (loop (+ i 1) seed (cons (floor-remainder (floor-quotient seed 16) 1000) acc))))))
+
+(define (ascending? l)
+  (if (null? l)
+      #t
+      (if (null? (cdr l))
+          #t
+          (if (< (cadr l) (car l))
+              #f
+              (ascending? (cdr l))))))
+
+(define big (random-list 5000))
+
+(test #t (ascending? (list-sort < big)))
+(test (list-sort < big) (list-sort (lambda (x y) (< (car (list x (make-vector 4))) y)) big))
+(test (list-sort < big) (vector->list (vector-sort < (list->vector big))))
+(test (list-sort < (append big big)) (list-sort < (append (list-sort < big) (list-sort > big))))
+(test 5000 (length (list-sort! < (list-copy big))))
+
+(test-end)
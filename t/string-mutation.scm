@@ -0,0 +1,50 @@
+(import (scheme base)
+        (picrin base)
+        (picrin test))
+
+(test-begin)
+
+;; writes go to the string's own buffer, never to text it shares
+
+(define a (make-string 5 #\x))
+(define b (string-copy a))
+(string-set! a 0 #\A)
+(test "Axxxx" a)
+(test "xxxxx" b)
+
+(define c (string-append a "yz"))
+(string-set! a 1 #\B)
+(test "ABxxx" a)
+(test "Axxxxyz" c)
+
+(string-fill! a #\- 2 4)
+(test "AB--x" a)
+
+(define d (string-copy "abcdefgh"))
+(string-copy! d 2 d 0 5)
+(test "ababcdeh" d)
+
+(define e (string-copy "abcdefgh"))
+(string-copy! e 0 e 3 8)
+(test "defghfgh" e)
+
+(define f (string-append (make-string 100 #\a) (make-string 100 #\b)))
+(define g (string-copy f 140 160))
+(string-set! f 150 #\X)
+(test #\X (string-ref f 150))
+(test "bbbbbbbbbbbbbbbbbbbb" g)
+
+;; symbols keep their names
+
+(define s (make-string 3 #\a))
+(define sym (string->symbol s))
+(string-set! s 0 #\b)
+(test "aaa" (symbol->string sym))
+(test #t (eq? sym (string->symbol "aaa")))
+
+(define n (symbol->string 'hello))
+(string-set! n 0 #\j)
+(test "jello" n)
+(test "hello" (symbol->string 'hello))
+
+(test-end)
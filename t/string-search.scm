@@ -0,0 +1,62 @@
+(import (scheme base)
+        (picrin base)
+        (picrin test))
+
+(test-begin)
+
+(test 2 (string-index "abcabc" #\c))
+(test 5 (string-index "abcabc" #\c 3))
+(test #f (string-index "abcabc" #\c 3 5))
+(test #f (string-index "abc" #\z))
+(test 1 (string-index "aλb" #\λ))
+(test 3 (string-index "ab1c" (lambda (c) (char=? c #\c))))
+(test #f (string-index "" #\a))
+
+(test 2 (string-contains "abcdef" "cde"))
+(test #f (string-contains "abcdef" "cdf"))
+(test 0 (string-contains "abc" ""))
+(test 4 (string-contains "abcabc" "bc" 2))
+(test #f (string-contains "ab" "abc"))
+(test 2 (string-contains "αβγδ" "γδ"))
+(test 6 (string-contains "the quick brown fox" "ick brown"))
+
+(test 3 (string-search-forward "def" "abcdef" 0))
+(test 3 (string-search-forward "a" "abca" 1))
+(test #f (string-search-forward "x" "abca"))
+
+(test '(0 1 2 3) (string-search-all "aa" "aaaaaa" 0 5))
+(test '(0 1 2 3 4) (string-search-all "aa" "aaaaaa"))
+(test '(1 5) (string-search-all "ελ" "λελλλελ"))
+(test '() (string-search-all "q" "abc"))
+
+(test '("a" "b" "" "c") (string-split "a,b,,c" #\,))
+(test '("" "") (string-split "," #\,))
+(test '("") (string-split "" #\,))
+(test '("key" "value") (string-split "key := value" " := "))
+(test '("α" "β" "γ") (string-split "α→β→γ" #\→))
+
+;; matches that straddle leaves of a rope
+
+(define (build n)
+  (let loop ((i 0) (acc ""))
+    (if (= i n)
+        acc
+        (loop (+ i 1) (string-append acc (number->string i) "-")))))
+
+(define big (string-append (make-string 300 #\x) "needle" (make-string 300 #\y)))
+(define rope (string-append (string-copy big 0 303) (string-copy big 303 606)))
+(test 300 (string-contains rope "needle"))
+(test 300 (string-contains rope "needle" 299))
+(test #f (string-contains rope "needle" 301))
+(test '(302) (string-search-all "ed" rope))
+
+(define pieces (string-append "ab" "c" "d" "e" (make-string 100 #\.) "fg"))
+(test 0 (string-contains pieces "abcde"))
+(test 103 (string-contains pieces "..fg"))
+
+(define numbers (build 1000))
+(test 11 (length (string-search-all "-99" numbers)))
+(test 1001 (length (string-split numbers #\-)))
+(test "998" (list-ref (string-split numbers #\-) 998))
+
+(test-end)
@@ -0,0 +1,120 @@
+(import (scheme base)
+        (picrin base)
+        (picrin test))
+
+(test-begin)
+
+;; chars are code points, strings are indexed by char
+
+(test 955 (char->integer #\λ))
+(test #\λ (integer->char 955))
+(test #\x1F600 (integer->char 128512))
+(test #t (char<? #\z #\λ #\x1F600))
+
+(define s "aλ€😀z")
+(test 5 (string-length s))
+(test #\λ (string-ref s 1))
+(test #\€ (string-ref s 2))
+(test #\x1F600 (string-ref s 3))
+(test #\z (string-ref s 4))
+(test "λ€" (string-copy s 1 3))
+(test '(#\€ #\x1F600) (string->list s 2 4))
+(test #(#\λ #\€) (string->vector s 1 3))
+(test "λ€" (vector->string #(#\λ #\€)))
+(test s (list->string (string->list s)))
+(test "ΛΛΛ" (make-string 3 #\Λ))
+(test "xλ" (string #\x #\λ))
+(test "λ\x3bb;" (string #\λ #\λ))
+
+;; a long string with breadcrumbs, and a slice of it
+
+(define long (let loop ((i 0) (acc ""))
+               (if (= i 200)
+                   acc
+                   (loop (+ i 1) (string-append acc "aé€")))))
+(test 600 (string-length long))
+(test #\€ (string-ref long 599))
+(test #\é (string-ref long 301))
+(test "é€" (string-copy long 298 300))
+(define slice (string-copy long 3 597))
+(test 594 (string-length slice))
+(test #\é (string-ref slice 592))
+
+;; writes that change the width of a char
+
+(define m (string-copy "abc"))
+(string-set! m 1 #\x1F600)
+(test "a\x1F600;c" m)
+(string-set! m 1 #\b)
+(test "abc" m)
+(string-fill! m #\λ 1)
+(test "aλλ" m)
+(string-copy! m 0 "€x")
+(test "€xλ" m)
+(string-copy! m 1 m 0 2)
+(test "€€x" m)
+
+(test "λμ" (string-map (lambda (c) (integer->char (+ 1 (char->integer c)))) "κλ"))
+
+;; UTF-8 conversion validates and replaces malformed input
+
+(test #u8(206 187 226 130 172) (string->utf8 "λ€"))
+(test #u8(226 130 172) (string->utf8 "aλ€" 2))
+(test "λ€" (utf8->string #u8(206 187 226 130 172)))
+(test "a\xFFFD;b" (utf8->string #u8(97 255 98)))
+(test "\xFFFD;\xFFFD;" (utf8->string #u8(192 128)))
+(test "\xFFFD;a" (utf8->string #u8(226 130 97)))
+(test "\xFFFD;\xFFFD;\xFFFD;" (utf8->string #u8(237 160 128)))
+(test 2 (string-length (utf8->string #u8(240 159 152 128 33))))
+
+;; ports read and write chars
+
+(define p (open-input-string "λ€😀x"))
+(test #\λ (peek-char p))
+(test #\λ (read-char p))
+(test "€😀" (read-string 2 p))
+(test #\x (read-char p))
+(test #t (eof-object? (read-char p)))
+
+;; read-string counts a malformed or truncated sequence as one U+FFFD
+
+(define p (open-input-bytevector #u8(97 226 130 98 99 100 101 102 103 104)))
+(test "a\xFFFD;" (read-string 2 p))
+(test "bcdefgh" (read-string 100 p))
+(define p (open-input-bytevector #u8(224 128 98)))
+(test "\xFFFD;" (read-string 1 p))
+(test "\xFFFD;b" (read-string 2 p))
+(define p (open-input-bytevector #u8(255 128 98)))
+(test "\xFFFD;\xFFFD;" (read-string 2 p))
+(test "b" (read-string 2 p))
+(define p (open-input-bytevector #u8(240 159 152 97 98)))
+(test "\xFFFD;ab" (read-string 3 p))
+(define p (open-input-bytevector #u8(226 130)))
+(test "\xFFFD;" (read-string 1 p))
+(test #t (eof-object? (read-string 1 p)))
+
+(define o (open-output-string))
+(write-char #\λ o)
+(write-string "a€😀b" o 1 3)
+(write #\€ o)
+(test "λ€😀#\\€" (get-output-string o))
+
+;; the reader refuses surrogates and values past U+10FFFF
+
+(define (read-fails? s)
+  (call/cc
+   (lambda (k)
+     (with-exception-handler
+      (lambda (e) (k (read-error? e)))
+      (lambda () (read (open-input-string s)) #f)))))
+
+(test #t (read-fails? "#\\xD800"))
+(test #t (read-fails? "#\\xDFFF"))
+(test #t (read-fails? "#\\x110000"))
+(test #t (read-fails? "\"\\xD800;\""))
+(test #t (read-fails? "\"\\x110000;\""))
+(test #t (read-fails? "\"\\x10FFFF0;\""))
+(test 57344 (char->integer (read (open-input-string "#\\xE000"))))
+(test 1114111 (char->integer (string-ref (read (open-input-string "\"\\x10FFFF;\"")) 0)))
+
+(test-end)
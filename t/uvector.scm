@@ -0,0 +1,116 @@
+(import (scheme base)
+        (scheme write)
+        (picrin base)
+        (picrin test))
+
+(test-begin)
+
+(define (written x)
+  (let ((port (open-output-string)))
+    (write x port)
+    (get-output-string port)))
+
+(define (caught thunk)
+  (call/cc
+   (lambda (k)
+     (with-exception-handler
+      (lambda (e) (k (error-object-message e)))
+      thunk))))
+
+;; range of each kind
+
+(test '(0 255) (u8vector->list (u8vector 0 255)))
+(test '(-128 127) (s8vector->list (s8vector -128 127)))
+(test '(0 65535) (u16vector->list (u16vector 0 65535)))
+(test '(-32768 32767) (s16vector->list (s16vector -32768 32767)))
+(test '(0 4294967295) (u32vector->list (u32vector 0 4294967295)))
+(test '(-2147483648 2147483647) (s32vector->list (s32vector -2147483648 2147483647)))
+(test '(0 18446744073709551615) (u64vector->list (u64vector 0 18446744073709551615)))
+(test '(-9223372036854775808 9223372036854775807) (s64vector->list (s64vector -9223372036854775808 9223372036854775807)))
+(test "value out of range" (caught (lambda () (u8vector 256))))
+(test "value out of range" (caught (lambda () (s8vector -129))))
+(test "value out of range" (caught (lambda () (u16vector -1))))
+(test "value out of range" (caught (lambda () (s32vector 2147483648))))
+(test "value out of range" (caught (lambda () (u64vector 18446744073709551616))))
+(test "value out of range" (caught (lambda () (s64vector 9223372036854775808))))
+(test "exact integer required" (caught (lambda () (s16vector 1.5))))
+(test "real number required" (caught (lambda () (f64vector 'a))))
+(test "s16vector required" (caught (lambda () (s16vector-ref (u16vector 1) 0))))
+
+;; floats keep the precision of their kind
+
+(test 0.5 (f32vector-ref (f32vector 0.5) 0))
+(test #f (= 0.1 (f32vector-ref (f32vector 0.1) 0)))
+(test 0.1 (f64vector-ref (f64vector 0.1) 0))
+(test 3.0 (f64vector-ref (f64vector 3) 0))
+
+;; u8vectors are bytevectors
+
+(test #t (bytevector? (make-u8vector 2 7)))
+(test #t (u8vector? #u8(1)))
+(test #f (u8vector? #s8(1)))
+(test #f (bytevector? #s8(1)))
+
+;; SRFI 160 extras
+
+(test '#(2 3) (s16vector->vector (s16vector 1 2 3 4) 1 3))
+(test '(3 4) (s16vector->list (vector->s16vector #(1 2 3 4) 2)))
+(test '(2.0 3.0) (f64vector->list (f64vector-copy (f64vector 1 2 3) 1)))
+(test '(1 2 3) (u32vector->list (u32vector-append (u32vector 1) (u32vector) (u32vector 2 3))))
+(test '(0 7 8 0) (let ((v (make-s32vector 4 0))) (s32vector-copy! v 1 (s32vector 6 7 8) 1) (s32vector->list v)))
+(test '(1 1 9 9) (let ((v (make-u64vector 4 1))) (u64vector-fill! v 9 2) (u64vector->list v)))
+
+;; read and write syntax
+
+(test "#s8(-1 2)" (written '#s8(-1 2)))
+(test "#u16()" (written (make-u16vector 0)))
+(test "#s64(-9223372036854775808)" (written (s64vector -9223372036854775808)))
+(test "#f32(0.5 -2.25)" (written #f32(0.5 -2.25)))
+(test '(1 2) (u64vector->list '#u64(1 2)))
+(test '(#f #false 1) (list #f #false (car '(1))))
+
+;; equality
+
+(test #t (equal? #f64(1 2) (f64vector 1 2)))
+(test #f (equal? #f64(1 2) #f32(1 2)))
+(test #f (equal? #s16(1 2) #s16(1 2 3)))
+(test #f (eqv? (s16vector 1) (s16vector 1)))
+
+;; bulk arithmetic
+
+(test '(-56 56 3) (s8vector->list (uvector-add (s8vector 100 -100 1) (s8vector 100 -100 2))))
+(test #u8(254 255) (uvector-sub #u8(1 2) 3))
+(test '(3.0 8.0) (f64vector->list (uvector-mul #f64(1.5 2) #f64(2 4))))
+(test '(-7 7 -2147483648) (s32vector->list (uvector-div #s32(7 -7 -2147483648) -1)))
+(test '(3 -3) (s32vector->list (uvector-div #s32(7 -7) 2)))
+(test "division by zero" (caught (lambda () (uvector-div #u16(1 2) #u16(1 0)))))
+(test '(3.5 6.25) (f32vector->list (uvector-fma #f32(1 2) 3 #f32(0.5 0.25))))
+(test '(2.0 4.0 6.0) (let ((v (f64vector 1 2 3))) (uvector-scale v 2 v) (f64vector->list v)))
+(test "value out of range" (caught (lambda () (uvector-add #u8(1) 256))))
+(test "numeric vectors of different lengths given" (caught (lambda () (uvector-add #f64(1) #f64(1 2)))))
+(test "f64vector required" (caught (lambda () (uvector-add #f64(1) #f32(1)))))
+
+(test #u8(1 0 0) (uvector< #s16(1 5 3) 3))
+(test #u8(1 0 1) (uvector>= #f64(1 5 3) #f64(1 6 2)))
+(test #u8(0 1) (uvector= #u64(1 2) #u64(2 2)))
+
+(test 765 (uvector-sum #u8(255 255 255)))
+(test 36893488147419103230 (uvector-sum (u64vector 18446744073709551615 18446744073709551615)))
+(test 9223372032559808513 (uvector-dot #s32(2147483647 -2147483648) #s32(2147483647 -2147483648)))
+(test 20.0 (uvector-dot #f64(1 2 3 4 5) #f64(1 1 1 1 2)))
+(test 3.75 (uvector-sum #f32(0.5 0.25 1 1 1)))
+(test 0 (uvector-sum #s16()))
+(test '(-4 9) (list (uvector-min #s8(3 -4 9)) (uvector-max #s8(3 -4 9))))
+(test '(-4.0 9.0) (list (uvector-min #f64(3 -4 9 7 8)) (uvector-max #f64(3 -4 9 7 8 -1))))
+(test -8.0 (uvector-min (f32vector 1 2 -3 4 5 6 7 -8 9)))
+(test #t (let ((m (uvector-max (f64vector 1 2 (/ 0. 0.) 4)))) (not (= m m))))
+(test "empty numeric vector given" (caught (lambda () (uvector-max #f64()))))
+
+;; long enough for the chunks and the vector loops to matter
+
+(define big (make-f64vector 1003 0.5))
+(test 1003.0 (uvector-sum (uvector-add big big)))
+(test 1003 (uvector-sum (uvector< big 1)))
+(test 501.5 (uvector-dot big (make-f64vector 1003 1)))
+
+(test-end)
@@ -0,0 +1,55 @@
+#!/usr/bin/perl
+
+# Render a heap profile written by (heap-profile) / pic_heap_dump.
+#
+#   perl tools/heapprof.pl heap.prof            # census and allocation sites
+#   perl tools/heapprof.pl --folded heap.prof | flamegraph.pl > heap.svg
+
+use strict;
+
+my $folded = 0;
+if (@ARGV && $ARGV[0] eq '--folded') {
+    $folded = 1;
+    shift @ARGV;
+}
+
+my ($interval, @census, @sites) = (0);
+
+while (<>) {
+    chomp;
+    next if /^#/ || /^\s*$/;
+    my @f = split /\t/;
+    if ($f[0] eq 'interval') {
+        $interval = $f[1];
+    } elsif ($f[0] eq 'census') {
+        push @census, { type => $f[1], objects => $f[2], bytes => $f[3] };
+    } elsif ($f[0] eq 'site') {
+        push @sites, { type => $f[1], samples => $f[2], bytes => $f[3], site => $f[4] };
+    }
+}
+
+if ($folded) {
+    for my $s (@sites) {
+        my $frames = join ';', split m{/}, $s->{site};
+        print "$frames;$s->{type} $s->{bytes}\n";
+    }
+    exit 0;
+}
+
+my $total = 0;
+$total += $_->{bytes} for @census;
+
+printf "%-16s %12s %14s %7s\n", 'type', 'objects', 'bytes', '%';
+for my $c (sort { $b->{bytes} <=> $a->{bytes} } @census) {
+    printf "%-16s %12d %14d %6.1f%%\n", $c->{type}, $c->{objects}, $c->{bytes},
+        $total ? 100 * $c->{bytes} / $total : 0;
+}
+printf "%-16s %12s %14d\n\n", 'total', '', $total;
+
+exit 0 unless @sites;
+
+printf "allocation sites (one sample per %d bytes)\n", $interval;
+printf "%14s %8s  %-16s %s\n", 'est. bytes', 'samples', 'type', 'site';
+for my $s (sort { $b->{bytes} <=> $a->{bytes} } @sites) {
+    printf "%14d %8d  %-16s %s\n", $s->{bytes}, $s->{samples}, $s->{type}, $s->{site};
+}